@@ -0,0 +1,111 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CitySampleCrowdActorWarmPoolSubsystem.h"
+#include "MassRepresentationSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+static TAutoConsoleVariable<int32> CVarCrowdWarmActorPoolMaxPerTemplate(
+	TEXT("CitySample.crowd.WarmActorPoolMaxPerTemplate"),
+	4,
+	TEXT("Maximum number of pre-spawned hidden crowd actors kept warm per template actor. 0 disables the warm pool."));
+
+static TAutoConsoleVariable<float> CVarCrowdWarmActorPoolRateWindow(
+	TEXT("CitySample.crowd.WarmActorPoolRateWindow"),
+	5.0f,
+	TEXT("Window in seconds over which crowd actor promotions are counted to size the warm actor pools."));
+
+AActor* UCitySampleCrowdActorWarmPoolSubsystem::ClaimWarmActor(const int16 TemplateActorIndex)
+{
+	FTemplatePool* Pool = Pools.Find(TemplateActorIndex);
+
+	while (Pool && Pool->WarmActors.Num() > 0)
+	{
+		AActor* WarmActor = Pool->WarmActors.Pop().Get();
+
+		if (WarmActor)
+		{
+			WarmActor->SetActorHiddenInGame(false);
+			WarmActor->SetActorEnableCollision(true);
+			WarmActor->SetActorTickEnabled(true);
+			return WarmActor;
+		}
+	}
+
+	return nullptr;
+}
+
+void UCitySampleCrowdActorWarmPoolSubsystem::NotifyActorPromotion(UMassRepresentationSubsystem& RepresentationSubsystem, const int16 TemplateActorIndex)
+{
+	FTemplatePool& Pool = Pools.FindOrAdd(TemplateActorIndex);
+	Pool.RepresentationSubsystem = &RepresentationSubsystem;
+	Pool.PromotionTimes.Add(FPlatformTime::Seconds());
+}
+
+int32 UCitySampleCrowdActorWarmPoolSubsystem::GetTargetPoolSize(FTemplatePool& Pool) const
+{
+	const double WindowStart = FPlatformTime::Seconds() - CVarCrowdWarmActorPoolRateWindow.GetValueOnGameThread();
+
+	Pool.PromotionTimes.RemoveAll([WindowStart](double Time) { return Time < WindowStart; });
+
+	return FMath::Min(Pool.PromotionTimes.Num(), CVarCrowdWarmActorPoolMaxPerTemplate.GetValueOnGameThread());
+}
+
+void UCitySampleCrowdActorWarmPoolSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UWorld* World = GetWorld();
+
+	if (World == nullptr)
+	{
+		return;
+	}
+
+	// Top up at most one actor per tick across all pools; a warm spawn costs the same as a promotion
+	// spawn, it just happens on a frame of our choosing
+	for (TPair<int16, FTemplatePool>& PoolPair : Pools)
+	{
+		FTemplatePool& Pool = PoolPair.Value;
+
+		Pool.WarmActors.RemoveAll([](const TWeakObjectPtr<AActor>& Actor) { return !Actor.IsValid(); });
+
+		if (Pool.WarmActors.Num() >= GetTargetPoolSize(Pool))
+		{
+			continue;
+		}
+
+		UMassRepresentationSubsystem* RepresentationSubsystem = Pool.RepresentationSubsystem.Get();
+
+		if (RepresentationSubsystem == nullptr)
+		{
+			continue;
+		}
+
+		const TSubclassOf<AActor> TemplateActorClass = RepresentationSubsystem->GetTemplateActorClass(PoolPair.Key);
+
+		if (!TemplateActorClass)
+		{
+			continue;
+		}
+
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		SpawnParameters.ObjectFlags |= RF_Transient;
+
+		if (AActor* WarmActor = World->SpawnActor<AActor>(TemplateActorClass, FTransform::Identity, SpawnParameters))
+		{
+			WarmActor->SetActorHiddenInGame(true);
+			WarmActor->SetActorEnableCollision(false);
+			WarmActor->SetActorTickEnabled(false);
+			Pool.WarmActors.Add(WarmActor);
+		}
+
+		break;
+	}
+}
+
+TStatId UCitySampleCrowdActorWarmPoolSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCitySampleCrowdActorWarmPoolSubsystem, STATGROUP_Tickables);
+}
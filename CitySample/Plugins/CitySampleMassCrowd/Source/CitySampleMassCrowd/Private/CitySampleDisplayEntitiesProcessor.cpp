@@ -19,6 +19,13 @@ namespace CitySample
 
 	float GDisplayEntitiesFOVAngleInDegrees = 50.0f; // degrees
 	FAutoConsoleVariableRef CVarCitySampleFOVAngleInDegrees(TEXT("CitySample.DisplayEntitiesFOVAngleInDegrees"), GDisplayEntitiesFOVAngleInDegrees, TEXT("FOV half angle in degrees to cull entities"));
+
+	int32 GDisplayEntitiesUpdateLadder = 1;
+	FAutoConsoleVariableRef CVarCitySampleDisplayEntitiesUpdateLadder(TEXT("CitySample.DisplayEntitiesUpdateLadder"), GDisplayEntitiesUpdateLadder, TEXT("Re-evaluate the display view cull every frame for near entities, every 3 frames for mid and every 8 for far, with per-entity phase offsets. 0 = full rate for everything"));
+
+	// Distance bands for the update ladder, as fractions of the far clipping distance
+	constexpr float GDisplayEntitiesNearBandFraction = 0.25f;
+	constexpr float GDisplayEntitiesMidBandFraction = 0.6f;
 }
 
 namespace UE::MassCrowd
@@ -118,9 +125,12 @@ void UCitySampleDisplayEntitiesProcessor::Execute(FMassEntityManager& EntityMana
 	// mode) and as such requires queries run to be owned by processors in order for us to properly arrange execution order.
 	ExecutionContext.SetExecutionType(EMassExecutionContextType::Local);
 
+	const float NearBandDistSquared = FMath::Square(CitySample::GDisplayEntitiesNearBandFraction * CitySample::GDisplayEntitiesFarClippingDistance);
+	const float MidBandDistSquared = FMath::Square(CitySample::GDisplayEntitiesMidBandFraction * CitySample::GDisplayEntitiesFarClippingDistance);
+
 	for (FCitySampleDisplayEntitiesConfig& Config : DisplayConfigs)
 	{
-		Config.EntityQuery.ForEachEntityChunk(ExecutionContext, [&Config, &ISMInfo, &LocalViewerLocation, &LocalViewerDirection, &CosFOVAngleToDriveVisibility, &MaxRenderDistSquared](FMassExecutionContext& Context)
+		Config.EntityQuery.ForEachEntityChunk(ExecutionContext, [this, &Config, &ISMInfo, &LocalViewerLocation, &LocalViewerDirection, &CosFOVAngleToDriveVisibility, &MaxRenderDistSquared, NearBandDistSquared, MidBandDistSquared](FMassExecutionContext& Context)
 		{
 			TConstArrayView<FTransformFragment> TransformList = Context.GetFragmentView<FTransformFragment>();
 
@@ -134,11 +144,35 @@ void UCitySampleDisplayEntitiesProcessor::Execute(FMassEntityManager& EntityMana
 					continue;
 				}
 
-				const FVector ViewerToEntityNorm = ViewerToEntity * FMath::InvSqrt(DistToViewerSquared);
-				const float Dot = LocalViewerDirection | ViewerToEntityNorm;
+				// The view cull is laddered by distance band: near entities re-evaluate every frame, mid and
+				// far ones reuse their previous result between refreshes, with a per-entity phase offset so
+				// refreshes (and any resulting pops) stay staggered. The instance batch is rebuilt every
+				// frame, so displayed entities must still be submitted below on every frame.
+				const FMassEntityHandle Entity = Context.GetEntity(EntityIt);
+				bool bRefreshViewCull = true;
+				if (CitySample::GDisplayEntitiesUpdateLadder)
+				{
+					const uint32 RefreshPeriod = DistToViewerSquared < NearBandDistSquared ? 1 : (DistToViewerSquared < MidBandDistSquared ? 3 : 8);
+					bRefreshViewCull = (RefreshPeriod == 1) || ((GFrameCounter + Entity.Index) % RefreshPeriod) == 0;
+				}
+
+				if (Entity.Index >= DisplayedLastUpdate.Num())
+				{
+					// First time we see this entity index, evaluate regardless of phase
+					DisplayedLastUpdate.Add(false, Entity.Index + 1 - DisplayedLastUpdate.Num());
+					bRefreshViewCull = true;
+				}
+
+				if (bRefreshViewCull)
+				{
+					const FVector ViewerToEntityNorm = ViewerToEntity * FMath::InvSqrt(DistToViewerSquared);
+					const float Dot = LocalViewerDirection | ViewerToEntityNorm;
+
+					// Skip entities not in frustum
+					DisplayedLastUpdate[Entity.Index] = (Dot >= CosFOVAngleToDriveVisibility);
+				}
 
-				// Skip entities not in frustum
-				if (Dot < CosFOVAngleToDriveVisibility)
+				if (!DisplayedLastUpdate[Entity.Index])
 				{
 					continue;
 				}
@@ -148,11 +182,11 @@ void UCitySampleDisplayEntitiesProcessor::Execute(FMassEntityManager& EntityMana
 					const FTransform& TransformOffset = ISMInfo[Config.StaticMeshDescHandle.ToIndex()].GetTransformOffset();
 					const FTransform SMTransform = TransformOffset * TransformFragment.GetTransform();
 
-					ISMInfo[Config.StaticMeshDescHandle.ToIndex()].AddBatchedTransform(Context.GetEntity(EntityIt), SMTransform, SMTransform, 0.0f);
+					ISMInfo[Config.StaticMeshDescHandle.ToIndex()].AddBatchedTransform(Entity, SMTransform, SMTransform, 0.0f);
 				}
 				else
 				{
-					ISMInfo[Config.StaticMeshDescHandle.ToIndex()].AddBatchedTransform(Context.GetEntity(EntityIt)
+					ISMInfo[Config.StaticMeshDescHandle.ToIndex()].AddBatchedTransform(Entity
 						, TransformFragment.GetTransform(), TransformFragment.GetTransform(), 0.0f);
 				}
 			}
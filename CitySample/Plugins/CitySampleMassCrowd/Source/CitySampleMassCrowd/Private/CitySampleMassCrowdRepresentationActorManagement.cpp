@@ -1,11 +1,48 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "CitySampleMassCrowdRepresentationActorManagement.h"
+#include "CitySampleCrowdActorWarmPoolSubsystem.h"
 #include "IMassCrowdActor.h"
 #include "MassEntityManager.h"
+#include "MassRepresentationSubsystem.h"
 
 #include "MassCrowdSpawnerSubsystem.h"
 #include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+
+AActor* UCitySampleMassCrowdRepresentationActorManagement::GetOrSpawnActor(UMassRepresentationSubsystem& RepresentationSubsystem, FMassEntityManager& EntityManager
+	, const FMassEntityHandle MassAgent, FMassActorFragment& ActorInfo, const FTransform& Transform, const int16 TemplateActorIndex
+	, FMassActorSpawnRequestHandle& SpawnRequestHandle, const float Priority) const
+{
+	UWorld* World = RepresentationSubsystem.GetWorld();
+	UCitySampleCrowdActorWarmPoolSubsystem* WarmPool = World ? World->GetSubsystem<UCitySampleCrowdActorWarmPoolSubsystem>() : nullptr;
+
+	if (WarmPool)
+	{
+		WarmPool->NotifyActorPromotion(RepresentationSubsystem, TemplateActorIndex);
+
+		// Only claim from the pool when nothing has been spawned or requested for this entity yet
+		if (ActorInfo.Get() == nullptr && !SpawnRequestHandle.IsValid())
+		{
+			if (AActor* WarmActor = WarmPool->ClaimWarmActor(TemplateActorIndex))
+			{
+				WarmActor->SetActorTransform(Transform, /*bSweep*/false, /*OutSweepHitResult*/nullptr, ETeleportType::TeleportPhysics);
+				ActorInfo.SetAndUpdateHandleMap(MassAgent, WarmActor, /*bIsOwnedByMass*/true);
+
+				// Same reconfiguration path the post-spawn callback runs: the actor rebuilds its
+				// visual parts from the entity's character definition
+				if (IMassCrowdActorInterface* MassCrowdActor = Cast<IMassCrowdActorInterface>(WarmActor))
+				{
+					MassCrowdActor->OnGetOrSpawn(&EntityManager, MassAgent);
+				}
+
+				return WarmActor;
+			}
+		}
+	}
+
+	return Super::GetOrSpawnActor(RepresentationSubsystem, EntityManager, MassAgent, ActorInfo, Transform, TemplateActorIndex, SpawnRequestHandle, Priority);
+}
 
 EMassActorSpawnRequestAction UCitySampleMassCrowdRepresentationActorManagement::OnPostActorSpawn(const FMassActorSpawnRequestHandle& SpawnRequestHandle
 	, FConstStructView SpawnRequest, TSharedRef<FMassEntityManager> EntityManager) const
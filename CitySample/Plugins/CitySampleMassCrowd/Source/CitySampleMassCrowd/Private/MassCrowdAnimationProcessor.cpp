@@ -27,6 +27,7 @@
 #include "GameFramework/Character.h"
 #include "Kismet/GameplayStatics.h"
 #include "Animation/AnimMontage.h"
+#include "Async/ParallelFor.h"
 
 
 void UMassFragmentInitializer_Animation::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
@@ -79,7 +80,7 @@ UMassProcessor_Animation::UMassProcessor_Animation()
 	bRequiresGameThreadExecution = true;
 }
 
-void UMassProcessor_Animation::UpdateAnimationFragmentData(FMassEntityManager& EntityManager, FMassExecutionContext& Context, float GlobalTime, TArray<FMassEntityHandle, TInlineAllocator<32>>& ActorEntities)
+void UMassProcessor_Animation::UpdateAnimationFragmentData(FMassEntityManager& EntityManager, FMassExecutionContext& Context, float GlobalTime, TArray<FMassEntityHandle, TInlineAllocator<64>>& ActorEntities)
 {
 	TArrayView<FCrowdAnimationFragment> AnimationDataList = Context.GetMutableFragmentView<FCrowdAnimationFragment>();
 	TConstArrayView<FMassMontageFragment> MontageDataList = Context.GetFragmentView<FMassMontageFragment>();
@@ -99,7 +100,7 @@ void UMassProcessor_Animation::UpdateAnimationFragmentData(FMassEntityManager& E
 
 		const bool bWasActor = (Visualization.PrevRepresentation == EMassRepresentationType::HighResSpawnedActor) || (Visualization.PrevRepresentation == EMassRepresentationType::LowResSpawnedActor);
 		const bool bIsActor = (Visualization.CurrentRepresentation == EMassRepresentationType::HighResSpawnedActor) || (Visualization.CurrentRepresentation == EMassRepresentationType::LowResSpawnedActor);
-		AnimationData.bSwappedThisFrame = (bWasActor != bIsActor);
+		AnimationData.SetSwappedThisFrame(bWasActor != bIsActor);
 
 		if (!MontageDataList.IsEmpty() && MontageDataList[EntityIt].MontageInstance.SequenceChangedThisFrame())
 		{
@@ -156,19 +157,20 @@ void UMassProcessor_Animation::UpdateVertexAnimationState(FMassEntityManager& En
 				{
 					StateIndex = 1;
 					const float AuthoredAnimSpeed = 140.0f;
-					const float PrevPlayRate = AnimationData.PlayRate;
-					AnimationData.PlayRate = FMath::Clamp(FMath::Sqrt(VelocitySizeSq / (AuthoredAnimSpeed * AuthoredAnimSpeed)), 0.8f, 2.0f);
+					const float PrevPlayRate = AnimationData.GetPlayRate();
+					AnimationData.SetPlayRate(FMath::Clamp(FMath::Sqrt(VelocitySizeSq / (AuthoredAnimSpeed * AuthoredAnimSpeed)), 0.8f, 2.0f));
 
 					// Need to conserve current frame on a playrate switch so (GlobalTime - Offset1) * Playrate1 == (GlobalTime - Offset2) * Playrate2
-					AnimationData.GlobalStartTime = GlobalTime - PrevPlayRate * (GlobalTime - AnimationData.GlobalStartTime) / AnimationData.PlayRate;
+					// Read the rate back so the rebase uses the quantized value actually stored
+					AnimationData.GlobalStartTime = GlobalTime - PrevPlayRate * (GlobalTime - AnimationData.GlobalStartTime) / AnimationData.GetPlayRate();
 				}
 				else
 				{
-					AnimationData.PlayRate = 1.0f;
+					AnimationData.SetPlayRate(1.0f);
 					StateIndex = 0;
 				}
 			}
-			AnimationData.AnimationStateIndex = StateIndex;
+			AnimationData.SetAnimationStateIndex(StateIndex);
 		}
 	}
 }
@@ -233,13 +235,27 @@ void UMassProcessor_Animation::UpdateSkeletalAnimation(FMassEntityManager& Entit
 		}
 	}
 
-	for (FMassEntityHandle& Entity : ActorEntities)
+	// Per-entity state resolved during the parallel update that the game thread montage pass needs afterwards
+	struct FMontageUpdateData
 	{
-		FMassEntityView EntityView(EntityManager, Entity);
+		UAnimInstance* AnimInstance = nullptr;
+		const AActor* Actor = nullptr;
+		const FMassMontageFragment* MontageFragment = nullptr;
+		bool bSwappedThisFrame = false;
+	};
+
+	TArray<FMontageUpdateData> MontageUpdates;
+	MontageUpdates.AddDefaulted(ActorEntities.Num());
+
+	// Pushing the per-entity data into the anim instances is a plain data copy, so fan it out across worker
+	// threads. Montage playback and the forced animation ticks mutate shared animation state, so they are
+	// deferred to the game thread pass below once the parallel update has completed.
+	ParallelFor(ActorEntities.Num(), [&EntityManager, &ActorEntities, &MontageUpdates, GlobalTime, PlayerMeshLocation, PlayerMeshRotation, PlayerVelocity2D](int32 EntityIndex)
+	{
+		FMassEntityView EntityView(EntityManager, ActorEntities[EntityIndex]);
 
 		FCrowdAnimationFragment& AnimationData = EntityView.GetFragmentData<FCrowdAnimationFragment>();
 		FTransformFragment& TransformFragment = EntityView.GetFragmentData<FTransformFragment>();
-		FMassRepresentationFragment& Visualization = EntityView.GetFragmentData<FMassRepresentationFragment>();
 
 		const FMassActorFragment& ActorFragment = EntityView.GetFragmentData<FMassActorFragment>();
 		const FMassLookAtFragment* LookAtFragment = EntityView.GetFragmentDataPtr<FMassLookAtFragment>();
@@ -259,12 +275,12 @@ void UMassProcessor_Animation::UpdateSkeletalAnimation(FMassEntityManager& Entit
 			
 			AnimInstanceData.FarLODAnimSequence = nullptr;
 			AnimInstanceData.FarLODPlaybackStartTime = 0.0f;
-			if (AnimationData.AnimToTextureData.IsValid() && AnimationData.AnimToTextureData->Animations.IsValidIndex(AnimationData.AnimationStateIndex))
+			if (AnimationData.AnimToTextureData.IsValid() && AnimationData.AnimToTextureData->Animations.IsValidIndex(AnimationData.GetAnimationStateIndex()))
 			{
-				AnimInstanceData.FarLODAnimSequence = AnimationData.AnimToTextureData->AnimSequences[AnimationData.AnimationStateIndex].AnimSequence;
+				AnimInstanceData.FarLODAnimSequence = AnimationData.AnimToTextureData->AnimSequences[AnimationData.GetAnimationStateIndex()].AnimSequence;
 				if (AnimInstanceData.FarLODAnimSequence)
 				{
-					AnimInstanceData.FarLODAnimSequence = AnimationData.AnimToTextureData->AnimSequences[AnimationData.AnimationStateIndex].AnimSequence;
+					AnimInstanceData.FarLODAnimSequence = AnimationData.AnimToTextureData->AnimSequences[AnimationData.GetAnimationStateIndex()].AnimSequence;
 
 					const float SequenceLength = AnimInstanceData.FarLODAnimSequence->GetPlayLength();
 					AnimInstanceData.FarLODPlaybackStartTime = FMath::Fmod(AnimationData.GlobalStartTime - GlobalTime,SequenceLength);
@@ -277,7 +293,7 @@ void UMassProcessor_Animation::UpdateSkeletalAnimation(FMassEntityManager& Entit
 			}
 
 			AnimInstanceData.Significance = EntityView.GetFragmentData<FMassRepresentationLODFragment>().LODSignificance;
-			AnimInstanceData.bSwappedThisFrame = AnimationData.bSwappedThisFrame;
+			AnimInstanceData.bSwappedThisFrame = AnimationData.IsSwappedThisFrame();
 
 			MassAnimInstance->SetMassAnimInstanceData(AnimInstanceData);
 
@@ -301,8 +317,17 @@ void UMassProcessor_Animation::UpdateSkeletalAnimation(FMassEntityManager& Entit
 				MassAnimInstance->StopPredictionData.ActionAtEndOfPath = MovementTargetFragment->IntentAtGoal;
 			}
 		}
-		
-		const FMassMontageFragment* MontageFragment = EntityManager.GetFragmentDataPtr<FMassMontageFragment>(Entity);
+
+		FMontageUpdateData& MontageUpdate = MontageUpdates[EntityIndex];
+		MontageUpdate.AnimInstance = AnimInstance;
+		MontageUpdate.Actor = Actor;
+		MontageUpdate.MontageFragment = EntityView.GetFragmentDataPtr<FMassMontageFragment>();
+		MontageUpdate.bSwappedThisFrame = AnimationData.IsSwappedThisFrame();
+	});
+
+	for (const FMontageUpdateData& MontageUpdate : MontageUpdates)
+	{
+		const FMassMontageFragment* MontageFragment = MontageUpdate.MontageFragment;
 		UAnimMontage* Montage = MontageFragment ? MontageFragment->MontageInstance.GetMontage() : nullptr;
 
 		if (Montage == nullptr)
@@ -310,6 +335,9 @@ void UMassProcessor_Animation::UpdateSkeletalAnimation(FMassEntityManager& Entit
 			continue;
 		}
 
+		UAnimInstance* AnimInstance = MontageUpdate.AnimInstance;
+		const AActor* Actor = MontageUpdate.Actor;
+
 		if (AnimInstance && Actor)
 		{
 			// Don't play the montage again, even if it's blending out. UAnimInstance::GetCurrentActiveMontage and AnimInstance::Montage_IsPlaying return false if the montage is blending out.
@@ -336,13 +364,13 @@ void UMassProcessor_Animation::UpdateSkeletalAnimation(FMassEntityManager& Entit
 				FAlphaBlendArgs BlendIn;
 				BlendIn = Montage->GetBlendInArgs();
 				// Instantly blend in if we swapped to skeletal mesh this frame to avoid pop
-				BlendIn.BlendTime = AnimationData.bSwappedThisFrame ? 0.0f : BlendIn.BlendTime;
+				BlendIn.BlendTime = MontageUpdate.bSwappedThisFrame ? 0.0f : BlendIn.BlendTime;
 
 				AnimInstance->Montage_PlayWithBlendIn(Montage, BlendIn, 1.0f, EMontagePlayReturnType::MontageLength, MontageFragment->MontageInstance.GetPosition());
 			}
 
 			// Force an animation update if we swapped this frame to prevent t-posing
-			if (AnimationData.bSwappedThisFrame)
+			if (MontageUpdate.bSwappedThisFrame)
 			{
 				if (USkeletalMeshComponent* OwningComp = AnimInstance->GetOwningComponent())
 				{
@@ -412,7 +440,7 @@ void UMassProcessor_Animation::Execute(FMassEntityManager& EntityManager, FMassE
 
 	const float GlobalTime = World->GetTimeSeconds();
 
-	TArray<FMassEntityHandle, TInlineAllocator<32>> ActorEntities;
+	TArray<FMassEntityHandle, TInlineAllocator<64>> ActorEntities;
 	
 	{
 		QUICK_SCOPE_CYCLE_COUNTER(UMassProcessor_Animation_UpdateMontage);
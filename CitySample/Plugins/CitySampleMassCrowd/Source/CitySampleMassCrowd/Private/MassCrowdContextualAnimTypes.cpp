@@ -0,0 +1,56 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Animation/MassCrowdContextualAnimTypes.h"
+
+#include "Animation/AnimMontage.h"
+#include "ContextualAnimSceneAsset.h"
+
+void UMassCrowdContextualAnimationDataAsset::PostLoad()
+{
+	Super::PostLoad();
+
+	RebuildAnimCache();
+}
+
+#if WITH_EDITOR
+void UMassCrowdContextualAnimationDataAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	RebuildAnimCache();
+}
+#endif
+
+void UMassCrowdContextualAnimationDataAsset::RebuildAnimCache()
+{
+	CachedAnimsMap.Reset();
+
+	for (const TPair<FName, FMassCrowdContextualAnimDescription>& AnimsMapPair : AnimsMap)
+	{
+		FMassCrowdContextualAnimCachedDescription CachedDescription;
+		CachedDescription.AlignmentTrack = AnimsMapPair.Value.AlignmentTrack;
+		CachedDescription.InteractorRole = AnimsMapPair.Value.InteractorRole;
+
+		for (const FMassCrowdContextualAnimation& Anim : AnimsMapPair.Value.Anims)
+		{
+			if (Anim.ContextualAnimAsset == nullptr && Anim.FallbackMontage == nullptr)
+			{
+				continue;
+			}
+
+			FMassCrowdContextualAnimCachedEntry& CachedEntry = CachedDescription.ValidAnims.AddDefaulted_GetRef();
+			CachedEntry.ContextualAnimAsset = Anim.ContextualAnimAsset;
+			CachedEntry.FallbackMontage = Anim.FallbackMontage;
+			if (Anim.FallbackMontage != nullptr)
+			{
+				CachedEntry.FallbackMontageLength = Anim.FallbackMontage->GetPlayLength();
+				CachedEntry.bFallbackMontageHasRootMotion = Anim.FallbackMontage->HasRootMotion();
+			}
+		}
+
+		if (!CachedDescription.ValidAnims.IsEmpty())
+		{
+			CachedAnimsMap.Add(AnimsMapPair.Key, MoveTemp(CachedDescription));
+		}
+	}
+}
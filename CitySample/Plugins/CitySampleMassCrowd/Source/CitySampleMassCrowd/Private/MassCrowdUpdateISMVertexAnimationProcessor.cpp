@@ -59,9 +59,18 @@ void UMassCrowdUpdateISMVertexAnimationProcessor::Execute(FMassEntityManager& En
 
 void UMassCrowdUpdateISMVertexAnimationProcessor::UpdateISMVertexAnimation(FMassInstancedStaticMeshInfo& ISMInfo, FCrowdAnimationFragment& AnimationData, const float LODSignificance, const float PrevLODSignificance, const int32 NumFloatsToPad /*= 0*/)
 {
+	// Only go back to the data asset when the animation state actually changed. The instance batch
+	// still needs this entity's custom floats every frame, but for an unchanged looping state the
+	// cached values can be reused without resolving the asset.
+	if (!AnimationData.IsCachedAnimStateCurrent())
+	{
+		UMassTrafficInstancePlaybackLibrary::AnimStateFromDataAsset(AnimationData.AnimToTextureData.Get(), AnimationData.GetAnimationStateIndex(), AnimationData.CachedAnimState);
+		AnimationData.MarkCachedAnimStateCurrent();
+	}
+
 	FMassTrafficInstancePlaybackData InstanceData;
-	UMassTrafficInstancePlaybackLibrary::AnimStateFromDataAsset(AnimationData.AnimToTextureData.Get(), AnimationData.AnimationStateIndex, InstanceData.CurrentState);
+	InstanceData.CurrentState = AnimationData.CachedAnimState;
 	InstanceData.CurrentState.GlobalStartTime = AnimationData.GlobalStartTime;
-	InstanceData.CurrentState.PlayRate = AnimationData.PlayRate;
+	InstanceData.CurrentState.PlayRate = AnimationData.GetPlayRate();
 	ISMInfo.AddBatchedCustomData<FMassTrafficInstancePlaybackData>(InstanceData, LODSignificance, PrevLODSignificance, NumFloatsToPad);
 }
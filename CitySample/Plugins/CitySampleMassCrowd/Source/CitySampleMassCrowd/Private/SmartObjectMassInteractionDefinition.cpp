@@ -4,10 +4,56 @@
 
 #include "SmartObjectSubsystem.h"
 #include "Animation/AnimMontage.h"
+#include "ContextualAnimSceneAsset.h"
 #include "MassCrowdAnimationTypes.h"
 #include "MassCommandBuffer.h"
 #include "MassSmartObjectFragments.h"
 
+void USmartObjectMassInteractionDefinition::PostLoad()
+{
+	Super::PostLoad();
+
+	RebuildInteractionCache();
+}
+
+#if WITH_EDITOR
+void USmartObjectMassInteractionDefinition::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	RebuildInteractionCache();
+}
+#endif // WITH_EDITOR
+
+void USmartObjectMassInteractionDefinition::RebuildInteractionCache()
+{
+	bRoleSupportedByAsset = false;
+	CachedMontagePlayLengths.Reset();
+
+	if (ContextualAnimAsset == nullptr)
+	{
+		return;
+	}
+
+	// Walk the anim sets of section 0 (the only section the crowd interaction path plays, see
+	// UMassCrowdAnimationProcessor) and resolve the montage lengths the role's tracks can produce
+	for (int32 AnimSetIdx = 0; ; ++AnimSetIdx)
+	{
+		const FContextualAnimTrack* AnimTrack = ContextualAnimAsset->GetAnimTrack(0, AnimSetIdx, InteractorRole);
+		if (AnimTrack == nullptr)
+		{
+			break;
+		}
+
+		bRoleSupportedByAsset = true;
+
+		if (UAnimMontage* Montage = Cast<UAnimMontage>(AnimTrack->Animation))
+		{
+			CachedMontagePlayLengths.Add(Montage, Montage->GetPlayLength());
+		}
+	}
+}
+
 void USmartObjectMassInteractionDefinition::Activate(FMassCommandBuffer& CommandBuffer, const FMassBehaviorEntityContext& EntityContext) const
 {
 	if (ContextualAnimAsset == nullptr)
@@ -34,21 +80,34 @@ void USmartObjectMassInteractionDefinition::Activate(FMassCommandBuffer& Command
 
 	FContextualAnimQueryResult& ContextualAnimQueryResult = AnimRequest.QueryResult;
 	const FTransform& EntityTransform = TransformFragment.GetTransform();
-	
-	FContextualAnimQueryParams ContextualAnimQueryParams;
-	ContextualAnimQueryParams.bComplexQuery = true;
-	ContextualAnimQueryParams.bFindAnimStartTime = true;
-	ContextualAnimQueryParams.QueryTransform = EntityTransform;
-	
-	if (!ContextualAnimAsset->Query(InteractorRole, ContextualAnimQueryResult, ContextualAnimQueryParams, SOTransform))
+
+	// Both queries are guaranteed to fail when the asset has no track for the role; the cache lets
+	// a wave of simultaneous claims skip them instead of re-proving it per agent
+	if (bRoleSupportedByAsset)
 	{
-		ContextualAnimQueryParams.bComplexQuery = false;
-		ContextualAnimAsset->Query(InteractorRole, ContextualAnimQueryResult, ContextualAnimQueryParams, SOTransform);
+		FContextualAnimQueryParams ContextualAnimQueryParams;
+		ContextualAnimQueryParams.bComplexQuery = true;
+		ContextualAnimQueryParams.bFindAnimStartTime = true;
+		ContextualAnimQueryParams.QueryTransform = EntityTransform;
+
+		if (!ContextualAnimAsset->Query(InteractorRole, ContextualAnimQueryResult, ContextualAnimQueryParams, SOTransform))
+		{
+			ContextualAnimQueryParams.bComplexQuery = false;
+			ContextualAnimAsset->Query(InteractorRole, ContextualAnimQueryResult, ContextualAnimQueryParams, SOTransform);
+		}
 	}
 
 	FMassSmartObjectTimedBehaviorFragment TimedBehaviorFragment;
 	UAnimMontage* EntryMontage = ContextualAnimQueryResult.Animation.Get();
-	TimedBehaviorFragment.UseTime = (EntryMontage ? EntryMontage->GetPlayLength() : UseTime);
+	if (EntryMontage != nullptr)
+	{
+		const float* CachedPlayLength = CachedMontagePlayLengths.Find(EntryMontage);
+		TimedBehaviorFragment.UseTime = CachedPlayLength ? *CachedPlayLength : EntryMontage->GetPlayLength();
+	}
+	else
+	{
+		TimedBehaviorFragment.UseTime = UseTime;
+	}
 
 	// Use existing fragment or push one
 	FMassMontageFragment* MontageFragment = EntityContext.EntityView.GetFragmentDataPtr<FMassMontageFragment>();
@@ -32,6 +32,41 @@ struct FMassCrowdContextualAnimDescription
 	FName InteractorRole;
 };
 
+/** Per-anim data resolved once at asset load, so starting an interaction does no montage traversal. */
+USTRUCT()
+struct FMassCrowdContextualAnimCachedEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TObjectPtr<class UContextualAnimSceneAsset> ContextualAnimAsset = nullptr;
+
+	UPROPERTY(Transient)
+	TObjectPtr<class UAnimMontage> FallbackMontage = nullptr;
+
+	UPROPERTY(Transient)
+	float FallbackMontageLength = 0.0f;
+
+	UPROPERTY(Transient)
+	bool bFallbackMontageHasRootMotion = false;
+};
+
+/** Load-time cache of an anim description, pruned to entries that have an asset to play. */
+USTRUCT()
+struct FMassCrowdContextualAnimCachedDescription
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<FMassCrowdContextualAnimCachedEntry> ValidAnims;
+
+	UPROPERTY(Transient)
+	FName AlignmentTrack;
+
+	UPROPERTY(Transient)
+	FName InteractorRole;
+};
+
 UCLASS(MinimalAPI, Blueprintable)
 class UMassCrowdContextualAnimationDataAsset : public UDataAsset
 {
@@ -39,6 +74,28 @@ class UMassCrowdContextualAnimationDataAsset : public UDataAsset
 
 public:
 
+	//~ Begin UObject Interface
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	//~ End UObject Interface
+
+	/** Returns the cached description for the given anim name, or null if there is none with playable entries. */
+	const FMassCrowdContextualAnimCachedDescription* FindCachedAnimDescription(const FName AnimName) const
+	{
+		return CachedAnimsMap.Find(AnimName);
+	}
+
 	UPROPERTY(EditAnywhere, Category = Anim, meta = (GetOptions = "CitySampleMassCrowd.MassCrowdAnimationSettings.GetContextualAnimOptions"))
 	TMap<FName, FMassCrowdContextualAnimDescription> AnimsMap;
+
+private:
+
+	/** Rebuilds the per-anim caches from AnimsMap. */
+	void RebuildAnimCache();
+
+	/** AnimsMap with null entries pruned and montage data resolved, built at load and on edit. */
+	UPROPERTY(Transient)
+	TMap<FName, FMassCrowdContextualAnimCachedDescription> CachedAnimsMap;
 };
\ No newline at end of file
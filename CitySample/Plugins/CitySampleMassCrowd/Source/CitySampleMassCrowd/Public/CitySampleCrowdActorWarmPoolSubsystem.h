@@ -0,0 +1,53 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+
+#include "CitySampleCrowdActorWarmPoolSubsystem.generated.h"
+
+class UMassRepresentationSubsystem;
+
+/**
+* Keeps a small pool of pre-spawned hidden crowd actors per template actor so LOD promotions can
+* reconfigure a warm actor through the character definition pipeline instead of paying the full
+* actor spawn cost on the frame of promotion. Target pool sizes follow the recent promotion rate
+* of each template and pools are topped up at most one actor per tick to spread the spawn cost.
+*/
+UCLASS()
+class CITYSAMPLEMASSCROWD_API UCitySampleCrowdActorWarmPoolSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Returns a warm actor for the given template, unhidden and re-enabled, or nullptr when the pool is empty */
+	AActor* ClaimWarmActor(const int16 TemplateActorIndex);
+
+	/** Records a promotion for the given template so its pool size tracks demand, and remembers the
+	* representation subsystem the template actor class is resolved from when topping up */
+	void NotifyActorPromotion(UMassRepresentationSubsystem& RepresentationSubsystem, const int16 TemplateActorIndex);
+
+	//~ Begin UTickableWorldSubsystem Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End UTickableWorldSubsystem Interface
+
+protected:
+
+	struct FTemplatePool
+	{
+		/** Pre-spawned hidden actors ready to claim. The level keeps them alive; stale entries are pruned */
+		TArray<TWeakObjectPtr<AActor>> WarmActors;
+
+		/** Times of recent promotions, used to derive the target pool size */
+		TArray<double> PromotionTimes;
+
+		TWeakObjectPtr<UMassRepresentationSubsystem> RepresentationSubsystem;
+	};
+
+	/** Returns how many warm actors the pool should hold given its recent promotions */
+	int32 GetTargetPoolSize(FTemplatePool& Pool) const;
+
+	TMap<int16, FTemplatePool> Pools;
+};
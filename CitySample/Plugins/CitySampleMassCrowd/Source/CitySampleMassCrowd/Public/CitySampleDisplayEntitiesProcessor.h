@@ -52,4 +52,7 @@ protected:
 
 	UPROPERTY(Transient)
 	UMassRepresentationSubsystem* RepresentationSubsystem;
+
+	/** Last view cull result per entity index, reused on frames where the entity's distance band skips re-evaluation */
+	TBitArray<> DisplayedLastUpdate;
 };
@@ -17,6 +17,23 @@ class CITYSAMPLEMASSCROWD_API UCitySampleMassCrowdRepresentationActorManagement
 {
 	GENERATED_BODY()
 
+	/**
+	* Tries to hand out a pre-spawned warm actor for the requested template before falling back to
+	* the regular async spawn request, turning LOD promotion spawn hitches into reconfigurations
+	* @param RepresentationSubsystem to use to resolve template actors
+	* @param EntityManager associated with the mass agent
+	* @param MassAgent is the handle to the associated mass agent
+	* @param ActorInfo is the fragment where we are going to store the actor pointer
+	* @param Transform where to spawn the actor
+	* @param TemplateActorIndex is the index of the type fetched with UMassRepresentationSubsystem::FindOrAddTemplateActor()
+	* @param SpawnRequestHandle (in/out) In: previously requested spawn Out: newly requested spawn
+	* @param Priority of this spawn request in comparison with the others, the lower the value is, the higher the priority is
+	* @return The actor spawned
+	*/
+	virtual AActor* GetOrSpawnActor(UMassRepresentationSubsystem& RepresentationSubsystem, FMassEntityManager& EntityManager, const FMassEntityHandle MassAgent
+		, FMassActorFragment& ActorInfo, const FTransform& Transform, const int16 TemplateActorIndex, FMassActorSpawnRequestHandle& SpawnRequestHandle
+		, const float Priority) const override;
+
 	/**
 	* Method that will be bound to a delegate used post-spawn to notify and let the requester configure the actor
 	* @param SpawnRequestHandle the handle of the spawn request that was just spawned
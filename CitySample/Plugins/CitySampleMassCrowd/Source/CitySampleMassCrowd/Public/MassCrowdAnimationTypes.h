@@ -5,6 +5,7 @@
 #include "ContextualAnimSceneAsset.h"
 #include "MassCommonFragments.h"
 #include "MassTrafficLightweightMontageInstance.h"
+#include "MassTrafficInstancePlaybackHelpers.h"
 #include "MassCrowdAnimationTypes.generated.h"
 
 class UAnimInstance;
@@ -50,8 +51,49 @@ struct CITYSAMPLEMASSCROWD_API FCrowdAnimationFragment : public FMassFragment
 	GENERATED_BODY()
 
 	TWeakObjectPtr<UAnimToTextureDataAsset> AnimToTextureData;
+
+	// Kept at full precision: this anchors playback to absolute world time, and quantizing it would
+	// make long-running loops drift. The play rate, animation state and flags below are packed
+	// since every crowd processor streams this fragment for 10k+ entities per frame.
 	float GlobalStartTime = 0.0f;
-	float PlayRate = 1.0f;
-	int32 AnimationStateIndex = 0;
-	bool bSwappedThisFrame = false;
+
+	/** Play rate in 1/16384 steps, covering 0-4x; well below anything visible at crowd distances */
+	float GetPlayRate() const { return PackedPlayRate * (1.0f / PlayRateQuantizationScale); }
+	void SetPlayRate(const float InPlayRate) { PackedPlayRate = static_cast<uint16>(FMath::Clamp(InPlayRate * PlayRateQuantizationScale + 0.5f, 0.0f, static_cast<float>(MAX_uint16))); }
+
+	int32 GetAnimationStateIndex() const { return AnimationStateIndex; }
+	void SetAnimationStateIndex(const int32 InAnimationStateIndex) { AnimationStateIndex = static_cast<uint8>(FMath::Clamp(InAnimationStateIndex, 0, MAX_uint8 - 1)); }
+
+	bool IsSwappedThisFrame() const { return (Flags & ESwappedThisFrame) != 0; }
+	void SetSwappedThisFrame(const bool bInSwappedThisFrame) { Flags = bInSwappedThisFrame ? (Flags | ESwappedThisFrame) : (Flags & ~ESwappedThisFrame); }
+
+	/** True while the cached playback state still matches the current asset and animation state */
+	bool IsCachedAnimStateCurrent() const { return CachedAnimationStateIndex == AnimationStateIndex && CachedAnimToTextureData == AnimToTextureData; }
+
+	/** Marks the cached playback state as rebuilt for the current asset and animation state */
+	void MarkCachedAnimStateCurrent()
+	{
+		CachedAnimToTextureData = AnimToTextureData;
+		CachedAnimationStateIndex = AnimationStateIndex;
+	}
+
+	// Playback state cached from the anim-to-texture data asset so the per-frame ISM custom data
+	// write doesn't resolve the asset again while the animation state is unchanged (looping idle is
+	// the common case). Refreshed by UMassCrowdUpdateISMVertexAnimationProcessor::UpdateISMVertexAnimation.
+	FMassTrafficAnimState CachedAnimState;
+
+private:
+	static constexpr float PlayRateQuantizationScale = 16384.0f;
+	static constexpr uint8 InvalidAnimationStateIndex = MAX_uint8;
+
+	enum EFlags : uint8
+	{
+		ESwappedThisFrame = 1 << 0,
+	};
+
+	TWeakObjectPtr<UAnimToTextureDataAsset> CachedAnimToTextureData;
+	uint16 PackedPlayRate = static_cast<uint16>(PlayRateQuantizationScale);
+	uint8 AnimationStateIndex = 0;
+	uint8 Flags = 0;
+	uint8 CachedAnimationStateIndex = InvalidAnimationStateIndex;
 };
\ No newline at end of file
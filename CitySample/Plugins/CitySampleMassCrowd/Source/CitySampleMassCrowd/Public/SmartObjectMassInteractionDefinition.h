@@ -5,14 +5,26 @@
 #include "MassSmartObjectBehaviorDefinition.h"
 #include "SmartObjectMassInteractionDefinition.generated.h"
 
+class UAnimMontage;
+
 UCLASS(EditInlineNew)
 class USmartObjectMassInteractionDefinition : public USmartObjectMassBehaviorDefinition
 {
 	GENERATED_BODY()
 
+public:
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif // WITH_EDITOR
+
 protected:
 	virtual void Activate(FMassCommandBuffer& CommandBuffer, const FMassBehaviorEntityContext& EntityContext) const override;
 
+	/** Resolves everything about the contextual anim asset that doesn't depend on the claiming
+	* agent's transform, so mass claim events don't repeat the same asset traversal per agent */
+	void RebuildInteractionCache();
+
 	UPROPERTY(EditAnywhere, Category = Anim)
 	class UContextualAnimSceneAsset* ContextualAnimAsset;
 
@@ -21,4 +33,13 @@ protected:
 
 	UPROPERTY(EditAnywhere, Category = Anim)
 	FName InteractorRole;
+
+	/** Whether the asset has any anim track for InteractorRole; when false the per-claim queries
+	* are guaranteed to fail and Activate skips them entirely */
+	UPROPERTY(Transient)
+	bool bRoleSupportedByAsset = false;
+
+	/** Play length per entry montage the role can resolve to, so claim time doesn't touch the montage */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UAnimMontage>, float> CachedMontagePlayLengths;
 };
@@ -2,6 +2,7 @@
 
 #include "NiagaraDataInterfaceCitySampleSensorGrid.h"
 
+#include "Async/ParallelFor.h"
 #include "CitySampleSensorGridShaders.h"
 #include "GlobalDistanceFieldParameters.h"
 #include "NiagaraCompileHashVisitor.h"
@@ -26,6 +27,46 @@ static FAutoConsoleVariableRef CVarCitySampleSensorGridRadiusOverride(
 	ECVF_Default
 );
 
+static bool GCitySampleSensorGridCpuReadback = false;
+static FAutoConsoleVariableRef CVarCitySampleSensorGridCpuReadback(
+	TEXT("CitySample.sensorgrid.CpuReadback"),
+	GCitySampleSensorGridCpuReadback,
+	TEXT("When true the nearest-sensor results are mirrored to the CPU through a double buffered, non blocking readback. Results lag the GPU by a frame or two."),
+	ECVF_Default
+);
+
+static int32 GCitySampleSensorGridMaxOwnersPerPartition = 0;
+static FAutoConsoleVariableRef CVarCitySampleSensorGridMaxOwnersPerPartition(
+	TEXT("CitySample.sensorgrid.MaxOwnersPerPartition"),
+	GCitySampleSensorGridMaxOwnersPerPartition,
+	TEXT("Maximum number of owners bucketed into a single sensor grid partition. When 0 the shader's owner limit is used."),
+	ECVF_Default
+);
+
+static int32 GCitySampleSensorGridRepartitionInterval = 64;
+static FAutoConsoleVariableRef CVarCitySampleSensorGridRepartitionInterval(
+	TEXT("CitySample.sensorgrid.RepartitionInterval"),
+	GCitySampleSensorGridRepartitionInterval,
+	TEXT("Number of frames between spatial repartitions of the sensor grid owners. Owners being added or removed always trigger a repartition. When <= 0 owner movement never triggers one."),
+	ECVF_Default
+);
+
+static float GCitySampleSensorGridBudgetHalfResDistance = 0.0f;
+static FAutoConsoleVariableRef CVarCitySampleSensorGridBudgetHalfResDistance(
+	TEXT("CitySample.sensorgrid.BudgetHalfResDistance"),
+	GCitySampleSensorGridBudgetHalfResDistance,
+	TEXT("When > 0, owners further than this from the observer run their sensor grid at half density along each axis. Requires an observer location to be provided."),
+	ECVF_Default
+);
+
+static float GCitySampleSensorGridBudgetQuarterResDistance = 0.0f;
+static FAutoConsoleVariableRef CVarCitySampleSensorGridBudgetQuarterResDistance(
+	TEXT("CitySample.sensorgrid.BudgetQuarterResDistance"),
+	GCitySampleSensorGridBudgetQuarterResDistance,
+	TEXT("When > 0, owners further than this from the observer run their sensor grid at quarter density along each axis. Requires an observer location to be provided."),
+	ECVF_Default
+);
+
 #define LOCTEXT_NAMESPACE "NiagaraDataInterfaceCitySampleSensorGrid"
 
 namespace NDICitySampleSensorGridLocal
@@ -85,22 +126,89 @@ namespace NDICitySampleSensorGridLocal
 	static const FText OutputOwnerIndexDescription = IF_WITH_EDITORONLY_DATA(LOCTEXT("OutputOwnerIndexDescription", "Identifier of the grid associatd with the closest sensor from the previous frame - not guaranteed to be stable"), FText());
 	static const FText OutputUserChannelDescription = IF_WITH_EDITORONLY_DATA(LOCTEXT("OutputUserChanneldDescription", "Value of the user channel from the previous frame"), FText());
 
-	struct FSensorGridNetworkProxy
+	// world space location used to scale the per-owner sensor budgets, shared by all networks
+	static FCriticalSection ObserverLocationGuard;
+	static TOptional<FVector> ObserverLocation;
+
+	// spreads the lower 16 bits out to the even bits so two axes can be interleaved
+	static uint32 ExpandBits2d(uint32 Value)
+	{
+		Value &= 0x0000FFFF;
+		Value = (Value | (Value << 8)) & 0x00FF00FF;
+		Value = (Value | (Value << 4)) & 0x0F0F0F0F;
+		Value = (Value | (Value << 2)) & 0x33333333;
+		Value = (Value | (Value << 1)) & 0x55555555;
+		return Value;
+	}
+
+	static uint32 MortonCode2d(uint32 X, uint32 Y)
+	{
+		return ExpandBits2d(X) | (ExpandBits2d(Y) << 1);
+	}
+
+	// per instance payload passed from the game thread to the proxy; the change counter is only
+	// bumped when the owner has actually moved, letting the render thread tell whether anything
+	// has changed since the last repartition
+	struct FInstanceLocation
+	{
+		FVector3f Location = FVector3f::ZeroVector;
+		uint32 ChangeId = 0;
+	};
+
+	// one independently built and traversed grid - owners are bucketed into partitions by
+	// spatial region so each stays within the shader's owner limit. Queries only see sensors
+	// within their own partition.
+	struct FSensorGridPartition
 	{
 		TRefCountPtr<FRDGPooledBuffer> ExtractedSensorInfo;
 		TRefCountPtr<FRDGPooledBuffer> ExtractedUserChannelData;
 
 		TUniquePtr<FCitySampleSensorGridHelper::FTransientResources> TransientResources;
 
-		// mapping between the system instance ID and the subnetwork within the buffers
-		TMap<FNiagaraSystemInstanceID, int32> InstanceOwnerReadIndexMap;
-		TMap<FNiagaraSystemInstanceID, int32> InstanceOwnerWriteIndexMap;
+		// optional CPU mirror of the traversal results (see CitySample.sensorgrid.CpuReadback)
+		FCitySampleSensorGridAsyncReadback ResultsReadback;
 
-		TSet<FNiagaraSystemInstanceID> RegisteredInstances;
+		// per owner sensor strides for the current frame (see CitySample.sensorgrid.Budget*)
+		TArray<uint32> OwnerStrides;
 
-		int32 QueuedOwnerCount = 0;
 		int32 AllocatedOwnerCount = 0;
-		int32 ResultsOwnerCount = 0;
+
+		// owner count the extracted buffers were built with, which may lag AllocatedOwnerCount
+		// by a frame around repartitions
+		int32 ExtractedOwnerCount = 0;
+
+		FSensorGridPartition()
+		{
+			TransientResources = MakeUnique<FCitySampleSensorGridHelper::FTransientResources>();
+		}
+	};
+
+	// location of a system instance's owner within the partitioned buffers
+	struct FOwnerSlot
+	{
+		int32 PartitionIndex = INDEX_NONE;
+		int32 OwnerIndex = INDEX_NONE;
+	};
+
+	struct FSensorGridNetworkProxy
+	{
+		TArray<TUniquePtr<FSensorGridPartition>> Partitions;
+
+		// mapping between the system instance ID and its slot within the partitioned buffers.
+		// The read slots match the extracted buffers of the previous frame.
+		TMap<FNiagaraSystemInstanceID, FOwnerSlot> InstanceOwnerReadSlots;
+		TMap<FNiagaraSystemInstanceID, FOwnerSlot> InstanceOwnerWriteSlots;
+
+		// instances that have queued a simulation this frame
+		TSet<FNiagaraSystemInstanceID> QueuedInstances;
+
+		TSet<FNiagaraSystemInstanceID> RegisteredInstances;
+
+		uint32 FramesSinceRepartition = 0;
+
+		// value of the proxy's location change counter at the last repartition, used to skip
+		// cadence driven re-sorts while every owner is standing still
+		uint32 LastRepartitionChangeCount = 0;
 
 		// XY is the grid of sensors
 		const uint32 SensorGridLayerCount;
@@ -114,56 +222,229 @@ namespace NDICitySampleSensorGridLocal
 			: SensorGridLayerCount(InSensorGridLayerCount)
 			, UserChannelCount(InUserChannelCount)
 		{
-			TransientResources = MakeUnique<FCitySampleSensorGridHelper::FTransientResources>();
 		}
 
-		void PrepareSimulation(FRDGBuilder& GraphBuilder, ERHIFeatureLevel::Type InFeatureLevel)
+		static int32 GetMaxOwnersPerPartition()
 		{
-			FCitySampleSensorGridHelper::FResourceSizingInfo SizingInfo;
-			SizingInfo.SensorCount = (1 << SensorGridLayerCount) * (1 << SensorGridLayerCount);
-			SizingInfo.OwnerCount = QueuedOwnerCount;
-			SizingInfo.UserChannelCount = UserChannelCount;
+			const int32 ShaderLimit = (int32)FCitySampleSensorGridHelper::GetMaxOwnerCount();
+			return GCitySampleSensorGridMaxOwnersPerPartition > 0
+				? FMath::Clamp(GCitySampleSensorGridMaxOwnersPerPartition, 2, ShaderLimit)
+				: ShaderLimit;
+		}
 
-			AllocatedOwnerCount = QueuedOwnerCount;
-			QueuedOwnerCount = 0;
+		bool RequiresRepartition(uint32 LocationChangeCount) const
+		{
+			if (InstanceOwnerWriteSlots.Num() != QueuedInstances.Num())
+			{
+				return true;
+			}
 
-			TransientResources->Build(GraphBuilder,	SizingInfo);
-			if (TransientResources->HasBuffers)
+			for (const FNiagaraSystemInstanceID& InstanceID : QueuedInstances)
 			{
-				FCitySampleSensorGridHelper Helper(InFeatureLevel, FUintVector4(SensorGridLayerCount, SensorGridLayerCount, AllocatedOwnerCount, 0), GFrameNumberRenderThread);
-				Helper.InitBuffers(GraphBuilder, *TransientResources);
+				if (!InstanceOwnerWriteSlots.Contains(InstanceID))
+				{
+					return true;
+				}
 			}
+
+			// assignments are kept stable between repartitions so that the cached bvh state of
+			// each partition stays usable, but owners drift so we re-sort on a fixed cadence -
+			// unless the change counter shows that nothing has actually moved since the last one
+			return GCitySampleSensorGridRepartitionInterval > 0
+				&& FramesSinceRepartition >= (uint32)GCitySampleSensorGridRepartitionInterval
+				&& LocationChangeCount != LastRepartitionChangeCount;
 		}
 
-		void EndSimulation(FRDGBuilder& GraphBuilder, ERHIFeatureLevel::Type InFeatureLevel, const FVector2D& GlobalSensorRange)
+		void Repartition(const TMap<FNiagaraSystemInstanceID, FInstanceLocation>& InstanceLocations, uint32 LocationChangeCount)
 		{
-			FRHICommandListImmediate& RHICmdList = GraphBuilder.RHICmdList;
+			// sort the owners along a 2d morton curve so that slicing them into evenly sized
+			// partitions keeps spatial neighbors (and so potential query hits) together
+			FBox3f LocationBounds(EForceInit::ForceInit);
+			for (const FNiagaraSystemInstanceID& InstanceID : QueuedInstances)
+			{
+				if (const FInstanceLocation* Instance = InstanceLocations.Find(InstanceID))
+				{
+					LocationBounds += Instance->Location;
+				}
+			}
+
+			const FVector3f BoundsSize = LocationBounds.IsValid ? LocationBounds.GetSize() : FVector3f::ZeroVector;
+			const float QuantizeX = BoundsSize.X > UE_SMALL_NUMBER ? 65535.0f / BoundsSize.X : 0.0f;
+			const float QuantizeY = BoundsSize.Y > UE_SMALL_NUMBER ? 65535.0f / BoundsSize.Y : 0.0f;
 
-			if (AllocatedOwnerCount)
+			const TArray<FNiagaraSystemInstanceID> QueuedInstanceArray = QueuedInstances.Array();
+
+			TArray<TPair<uint32, FNiagaraSystemInstanceID>> SortedInstances;
+			SortedInstances.SetNumUninitialized(QueuedInstanceArray.Num());
+
+			// the keys are independent per owner, so the gather fans out over worker threads with
+			// each writing its own preallocated slot
+			ParallelFor(QueuedInstanceArray.Num(), [&](int32 InstanceIt)
 			{
-				const uint32 SensorCountPerSide = 1 << SensorGridLayerCount;
+				const FNiagaraSystemInstanceID InstanceID = QueuedInstanceArray[InstanceIt];
 
-				FVector2D SensorRange = GlobalSensorRange;
-				if (GCitySampleSensorGridRadiusOverride > 0.0f)
+				uint32 SortKey = 0;
+				if (const FInstanceLocation* Instance = LocationBounds.IsValid ? InstanceLocations.Find(InstanceID) : nullptr)
 				{
-					SensorRange.Y = GCitySampleSensorGridRadiusOverride;
+					const uint32 QuantizedX = (uint32)FMath::Clamp((Instance->Location.X - LocationBounds.Min.X) * QuantizeX, 0.0f, 65535.0f);
+					const uint32 QuantizedY = (uint32)FMath::Clamp((Instance->Location.Y - LocationBounds.Min.Y) * QuantizeY, 0.0f, 65535.0f);
+					SortKey = MortonCode2d(QuantizedX, QuantizedY);
 				}
 
-				if (TransientResources->HasBuffers)
+				SortedInstances[InstanceIt] = TPair<uint32, FNiagaraSystemInstanceID>(SortKey, InstanceID);
+			});
+
+			// ties broken on the instance ID to keep the ordering deterministic
+			SortedInstances.Sort([](const TPair<uint32, FNiagaraSystemInstanceID>& Lhs, const TPair<uint32, FNiagaraSystemInstanceID>& Rhs)
+			{
+				return Lhs.Key != Rhs.Key ? Lhs.Key < Rhs.Key : Lhs.Value < Rhs.Value;
+			});
+
+			// spreading the owners evenly avoids degenerate single owner partitions, which can
+			// never produce any results
+			const int32 InstanceCount = SortedInstances.Num();
+			const int32 PartitionCount = FMath::DivideAndRoundUp(InstanceCount, GetMaxOwnersPerPartition());
+			const int32 OwnersPerPartition = PartitionCount ? FMath::DivideAndRoundUp(InstanceCount, PartitionCount) : 0;
+
+			Partitions.SetNum(PartitionCount);
+			for (TUniquePtr<FSensorGridPartition>& Partition : Partitions)
+			{
+				if (!Partition)
 				{
-					FCitySampleSensorGridHelper Helper(InFeatureLevel, FUintVector4(SensorGridLayerCount, SensorGridLayerCount, AllocatedOwnerCount, 0), GFrameNumberRenderThread);
-					Helper.NearestSensors(GraphBuilder, SensorRange, *TransientResources);
+					Partition = MakeUnique<FSensorGridPartition>();
+				}
+			}
+
+			InstanceOwnerWriteSlots.Reset();
+			for (int32 InstanceIt = 0; InstanceIt < InstanceCount; ++InstanceIt)
+			{
+				FOwnerSlot& Slot = InstanceOwnerWriteSlots.Add(SortedInstances[InstanceIt].Value);
+				Slot.PartitionIndex = InstanceIt / OwnersPerPartition;
+				Slot.OwnerIndex = InstanceIt % OwnersPerPartition;
+			}
+
+			FramesSinceRepartition = 0;
+			LastRepartitionChangeCount = LocationChangeCount;
+		}
+
+		void PrepareSimulation(FRDGBuilder& GraphBuilder, ERHIFeatureLevel::Type InFeatureLevel, const TMap<FNiagaraSystemInstanceID, FInstanceLocation>& InstanceLocations, uint32 LocationChangeCount)
+		{
+			if (RequiresRepartition(LocationChangeCount))
+			{
+				Repartition(InstanceLocations, LocationChangeCount);
+			}
+			else
+			{
+				++FramesSinceRepartition;
+			}
+
+			for (TUniquePtr<FSensorGridPartition>& Partition : Partitions)
+			{
+				Partition->AllocatedOwnerCount = 0;
+			}
 
-					GraphBuilder.QueueBufferExtraction(TransientResources->TraversalResults, &ExtractedSensorInfo);
-					if (UserChannelCount)
+			for (const TPair<FNiagaraSystemInstanceID, FOwnerSlot>& SlotIt : InstanceOwnerWriteSlots)
+			{
+				FSensorGridPartition& Partition = *Partitions[SlotIt.Value.PartitionIndex];
+				Partition.AllocatedOwnerCount = FMath::Max(Partition.AllocatedOwnerCount, SlotIt.Value.OwnerIndex + 1);
+			}
+
+			for (TUniquePtr<FSensorGridPartition>& Partition : Partitions)
+			{
+				Partition->OwnerStrides.Init(1, Partition->AllocatedOwnerCount);
+			}
+
+			TOptional<FVector> Observer;
+			{
+				FScopeLock _Scope(&ObserverLocationGuard);
+				Observer = ObserverLocation;
+			}
+
+			if (Observer.IsSet() && (GCitySampleSensorGridBudgetHalfResDistance > 0.0f || GCitySampleSensorGridBudgetQuarterResDistance > 0.0f))
+			{
+				const FVector3f ObserverLocationFloat = (FVector3f)Observer.GetValue();
+
+				for (const TPair<FNiagaraSystemInstanceID, FOwnerSlot>& SlotIt : InstanceOwnerWriteSlots)
+				{
+					const FInstanceLocation* Instance = InstanceLocations.Find(SlotIt.Key);
+					if (!Instance)
+					{
+						continue;
+					}
+
+					const float ObserverDistance = FVector3f::Dist(Instance->Location, ObserverLocationFloat);
+
+					uint32 OwnerStride = 1;
+					if (GCitySampleSensorGridBudgetHalfResDistance > 0.0f && ObserverDistance > GCitySampleSensorGridBudgetHalfResDistance)
+					{
+						OwnerStride = 2;
+					}
+					if (GCitySampleSensorGridBudgetQuarterResDistance > 0.0f && ObserverDistance > GCitySampleSensorGridBudgetQuarterResDistance)
 					{
-						GraphBuilder.QueueBufferExtraction(TransientResources->UserChannelData, &ExtractedUserChannelData);
+						OwnerStride = 4;
 					}
+
+					Partitions[SlotIt.Value.PartitionIndex]->OwnerStrides[SlotIt.Value.OwnerIndex] = OwnerStride;
+				}
+			}
+
+			for (TUniquePtr<FSensorGridPartition>& Partition : Partitions)
+			{
+				FCitySampleSensorGridHelper::FResourceSizingInfo SizingInfo;
+				SizingInfo.SensorCount = (1 << SensorGridLayerCount) * (1 << SensorGridLayerCount);
+				SizingInfo.OwnerCount = Partition->AllocatedOwnerCount;
+				SizingInfo.UserChannelCount = UserChannelCount;
+
+				Partition->TransientResources->Build(GraphBuilder, SizingInfo);
+				if (Partition->TransientResources->HasBuffers)
+				{
+					FCitySampleSensorGridHelper Helper(InFeatureLevel, FUintVector4(SensorGridLayerCount, SensorGridLayerCount, Partition->AllocatedOwnerCount, 0), GFrameNumberRenderThread);
+					Helper.InitBuffers(GraphBuilder, *Partition->TransientResources);
+				}
+			}
+
+			QueuedInstances.Reset();
+		}
+
+		void EndSimulation(FRDGBuilder& GraphBuilder, ERHIFeatureLevel::Type InFeatureLevel, const FVector2D& GlobalSensorRange)
+		{
+			const uint32 SensorCountPerSide = 1 << SensorGridLayerCount;
+
+			FVector2D SensorRange = GlobalSensorRange;
+			if (GCitySampleSensorGridRadiusOverride > 0.0f)
+			{
+				SensorRange.Y = GCitySampleSensorGridRadiusOverride;
+			}
+
+			// each partition is an independent pass chain over disjoint buffers, leaving the
+			// render graph free to overlap their dispatches
+			for (TUniquePtr<FSensorGridPartition>& Partition : Partitions)
+			{
+				if (!Partition->AllocatedOwnerCount || !Partition->TransientResources->HasBuffers)
+				{
+					continue;
+				}
+
+				FCitySampleSensorGridHelper Helper(InFeatureLevel, FUintVector4(SensorGridLayerCount, SensorGridLayerCount, Partition->AllocatedOwnerCount, 0), GFrameNumberRenderThread);
+				Helper.ApplySensorBudgets(GraphBuilder, *Partition->TransientResources, Partition->OwnerStrides);
+				Helper.NearestSensors(GraphBuilder, SensorRange, *Partition->TransientResources);
+
+				GraphBuilder.QueueBufferExtraction(Partition->TransientResources->TraversalResults, &Partition->ExtractedSensorInfo);
+				if (UserChannelCount)
+				{
+					GraphBuilder.QueueBufferExtraction(Partition->TransientResources->UserChannelData, &Partition->ExtractedUserChannelData);
 				}
 
-				InstanceOwnerReadIndexMap = InstanceOwnerWriteIndexMap;
-				InstanceOwnerWriteIndexMap.Reset();
+				Partition->ExtractedOwnerCount = Partition->AllocatedOwnerCount;
+
+				if (GCitySampleSensorGridCpuReadback)
+				{
+					const uint32 ResultCount = (SensorCountPerSide * SensorCountPerSide) * Partition->AllocatedOwnerCount;
+					Partition->ResultsReadback.EnqueueCopy(GraphBuilder, Partition->TransientResources->TraversalResults, ResultCount);
+				}
 			}
+
+			InstanceOwnerReadSlots = InstanceOwnerWriteSlots;
 		}
 
 	};
@@ -177,9 +458,27 @@ namespace NDICitySampleSensorGridLocal
 		FVector2D GlobalSensorRange = FVector2D(EForceInit::ForceInitToZero);
 		int32 UserChannelCount = 0;
 
+		// latest known world space location of each system instance, used to bucket owners
+		// into spatial partitions and to scale their sensor budgets
+		TMap<FNiagaraSystemInstanceID, FInstanceLocation> InstanceLocations;
+
+		// bumped whenever any instance reports a new location or an instance goes away
+		uint32 LocationChangeCount = 0;
+
 		int32 PerInstanceDataPassedToRenderThreadSize() const
 		{
-			return 0;
+			return sizeof(FInstanceLocation);
+		}
+
+		virtual void ConsumePerInstanceDataFromGameThread(void* PerInstanceData, const FNiagaraSystemInstanceID& Instance) override
+		{
+			const FInstanceLocation* InstanceLocation = static_cast<const FInstanceLocation*>(PerInstanceData);
+			FInstanceLocation& StoredLocation = InstanceLocations.FindOrAdd(Instance);
+			if (StoredLocation.ChangeId != InstanceLocation->ChangeId)
+			{
+				StoredLocation = *InstanceLocation;
+				++LocationChangeCount;
+			}
 		}
 
 		FSensorGridNetworkProxy* GetNetwork(const FNiagaraGpuComputeDispatchInterface* Batcher)
@@ -214,6 +513,11 @@ namespace NDICitySampleSensorGridLocal
 					}
 				}
 			}
+
+			if (InstanceLocations.Remove(SystemInstanceID))
+			{
+				++LocationChangeCount;
+			}
 		}
 
 		virtual void PreStage(const FNDIGpuComputePreStageContext& Context) override
@@ -222,14 +526,9 @@ namespace NDICitySampleSensorGridLocal
 
 			if (FSensorGridNetworkProxy* Network = GetNetwork(&Context.GetComputeDispatchInterface()))
 			{
-				int32& OwnerIndex = Network->InstanceOwnerWriteIndexMap.FindOrAdd(Context.GetSystemInstanceID(), INDEX_NONE);
-				if (OwnerIndex == INDEX_NONE)
-				{
-					if (ensure(Network->QueuedOwnerCount < ((int32)FCitySampleSensorGridHelper::GetMaxOwnerCount())))
-					{
-						OwnerIndex = Network->QueuedOwnerCount++;
-					}
-				}
+				// slots are handed out in FinalizePreStage once the full set of owners for the
+				// frame is known, so overflowing a single partition is no longer a concern
+				Network->QueuedInstances.Add(Context.GetSystemInstanceID());
 			}
 		}
 
@@ -244,7 +543,7 @@ namespace NDICitySampleSensorGridLocal
 
 			if (FSensorGridNetworkProxy* Network = GetNetwork(&ComputeDispatchInterface))
 			{
-				Network->PrepareSimulation(GraphBuilder, ComputeDispatchInterface.GetFeatureLevel());
+				Network->PrepareSimulation(GraphBuilder, ComputeDispatchInterface.GetFeatureLevel(), InstanceLocations, LocationChangeCount);
 			}
 		}
 
@@ -470,13 +769,21 @@ bool UNiagaraDataInterfaceCitySampleSensorGrid::UpgradeFunctionCall(FNiagaraFunc
 
 int32 UNiagaraDataInterfaceCitySampleSensorGrid::PerInstanceDataSize() const
 {
-	return 4;
+	return sizeof(NDICitySampleSensorGridLocal::FInstanceLocation);
 }
 
 bool UNiagaraDataInterfaceCitySampleSensorGrid::InitPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance)
 {
+	NDICitySampleSensorGridLocal::FInstanceLocation* InstanceLocation = new (PerInstanceData) NDICitySampleSensorGridLocal::FInstanceLocation();
+	InstanceLocation->ChangeId = 1;
+
 	if (SystemInstance)
 	{
+		if (USceneComponent* AttachComponent = SystemInstance->GetAttachComponent())
+		{
+			InstanceLocation->Location = (FVector3f)AttachComponent->GetComponentLocation();
+		}
+
 		NDICitySampleSensorGridLocal::FNDIProxy* RT_Proxy = GetProxyAs<NDICitySampleSensorGridLocal::FNDIProxy>();
 
 		// Push Updates to Proxy
@@ -490,6 +797,45 @@ bool UNiagaraDataInterfaceCitySampleSensorGrid::InitPerInstanceData(void* PerIns
 	return true;
 }
 
+bool UNiagaraDataInterfaceCitySampleSensorGrid::PerInstanceTick(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance, float DeltaSeconds)
+{
+	if (SystemInstance)
+	{
+		if (USceneComponent* AttachComponent = SystemInstance->GetAttachComponent())
+		{
+			NDICitySampleSensorGridLocal::FInstanceLocation* InstanceLocation = static_cast<NDICitySampleSensorGridLocal::FInstanceLocation*>(PerInstanceData);
+
+			// only bump the change counter when the owner has actually moved so the render thread
+			// can tell stationary frames apart
+			const FVector3f ComponentLocation = (FVector3f)AttachComponent->GetComponentLocation();
+			if (!ComponentLocation.Equals(InstanceLocation->Location))
+			{
+				InstanceLocation->Location = ComponentLocation;
+				++InstanceLocation->ChangeId;
+			}
+		}
+	}
+
+	return false;
+}
+
+void UNiagaraDataInterfaceCitySampleSensorGrid::ProvidePerInstanceDataForRenderThread(void* DataForRenderThread, void* PerInstanceData, const FNiagaraSystemInstanceID& SystemInstance)
+{
+	*static_cast<NDICitySampleSensorGridLocal::FInstanceLocation*>(DataForRenderThread) = *static_cast<const NDICitySampleSensorGridLocal::FInstanceLocation*>(PerInstanceData);
+}
+
+void UNiagaraDataInterfaceCitySampleSensorGrid::SetObserverLocation(const FVector& Location)
+{
+	FScopeLock _Scope(&NDICitySampleSensorGridLocal::ObserverLocationGuard);
+	NDICitySampleSensorGridLocal::ObserverLocation = Location;
+}
+
+void UNiagaraDataInterfaceCitySampleSensorGrid::ClearObserverLocation()
+{
+	FScopeLock _Scope(&NDICitySampleSensorGridLocal::ObserverLocationGuard);
+	NDICitySampleSensorGridLocal::ObserverLocation.Reset();
+}
+
 void UNiagaraDataInterfaceCitySampleSensorGrid::DestroyPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance)
 {
 	if (SystemInstance)
@@ -569,18 +915,37 @@ void UNiagaraDataInterfaceCitySampleSensorGrid::SetShaderParameters(const FNiaga
 	const bool bEnableUAVOverlap = true;
 	const ERDGUnorderedAccessViewFlags UAVFlags = bEnableUAVOverlap ? ERDGUnorderedAccessViewFlags::SkipBarrier : ERDGUnorderedAccessViewFlags::None;
 
+	const FNiagaraSystemInstanceID InstanceID = Context.GetSystemInstanceID();
+
+	const FOwnerSlot* WriteSlot = NetworkProxy->InstanceOwnerWriteSlots.Find(InstanceID);
+	FSensorGridPartition* WritePartition = (WriteSlot && NetworkProxy->Partitions.IsValidIndex(WriteSlot->PartitionIndex))
+		? NetworkProxy->Partitions[WriteSlot->PartitionIndex].Get()
+		: nullptr;
+
+	// the read slots reference the buffers extracted last frame, which may no longer exist (or
+	// cover fewer owners) when the network has just been repartitioned
+	const FOwnerSlot* ReadSlot = NetworkProxy->InstanceOwnerReadSlots.Find(InstanceID);
+	FSensorGridPartition* ReadPartition = (ReadSlot && NetworkProxy->Partitions.IsValidIndex(ReadSlot->PartitionIndex))
+		? NetworkProxy->Partitions[ReadSlot->PartitionIndex].Get()
+		: nullptr;
+
+	if (ReadPartition && (!ReadPartition->ExtractedSensorInfo || ReadSlot->OwnerIndex >= ReadPartition->ExtractedOwnerCount))
+	{
+		ReadPartition = nullptr;
+	}
+
 	if (Context.IsResourceBound(&ShaderParameters->RWSensorLocations))
 	{
-		ShaderParameters->RWSensorLocations = NetworkProxy->TransientResources->SensorLocations
-			? GraphBuilder.CreateUAV(NetworkProxy->TransientResources->SensorLocations, PF_A32B32G32R32F, UAVFlags)
+		ShaderParameters->RWSensorLocations = (WritePartition && WritePartition->TransientResources->SensorLocations)
+			? GraphBuilder.CreateUAV(WritePartition->TransientResources->SensorLocations, PF_A32B32G32R32F, UAVFlags)
 			: Context.GetComputeDispatchInterface().GetEmptyBufferUAV(GraphBuilder, PF_A32B32G32R32F);
 	}
 
 	if (Context.IsResourceBound(&ShaderParameters->SensorInfo))
 	{
-		if (NetworkProxy->ExtractedSensorInfo)
+		if (ReadPartition)
 		{
-			ShaderParameters->SensorInfo = GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(NetworkProxy->ExtractedSensorInfo));
+			ShaderParameters->SensorInfo = GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(ReadPartition->ExtractedSensorInfo));
 		}
 		else
 		{
@@ -592,29 +957,28 @@ void UNiagaraDataInterfaceCitySampleSensorGrid::SetShaderParameters(const FNiaga
 
 	if (Context.IsResourceBound(&ShaderParameters->RWSensorGridUserChannelData))
 	{
-		ShaderParameters->RWSensorGridUserChannelData = NetworkProxy->TransientResources->UserChannelData
-			? GraphBuilder.CreateUAV(NetworkProxy->TransientResources->UserChannelData, PF_A32B32G32R32F, UAVFlags)
+		ShaderParameters->RWSensorGridUserChannelData = (WritePartition && WritePartition->TransientResources->UserChannelData)
+			? GraphBuilder.CreateUAV(WritePartition->TransientResources->UserChannelData, PF_A32B32G32R32F, UAVFlags)
 			: Context.GetComputeDispatchInterface().GetEmptyBufferUAV(GraphBuilder, PF_A32B32G32R32F);
 	}
 
 	if (Context.IsResourceBound(&ShaderParameters->SensorGridPreviousUserChannelData))
 	{
-		ShaderParameters->SensorGridPreviousUserChannelData = NetworkProxy->ExtractedUserChannelData
-			? GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(NetworkProxy->ExtractedUserChannelData))
+		ShaderParameters->SensorGridPreviousUserChannelData = (ReadPartition && ReadPartition->ExtractedUserChannelData)
+			? GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(ReadPartition->ExtractedUserChannelData))
 			: Context.GetComputeDispatchInterface().GetEmptyBufferSRV(GraphBuilder, PF_A32B32G32R32F);
 	}
 
-	const FUintVector4 SensorGridDimensions(NetworkProxy->SensorGridLayerCount, NetworkProxy->SensorGridLayerCount, NetworkProxy->AllocatedOwnerCount, 1);
-
 	// we tag the read dimensions as being invalid (w component being 0) so that ee don't even bother reading from the empty srv
-	ShaderParameters->ReadSensorGridDimensions = NetworkProxy->ExtractedSensorInfo ? SensorGridDimensions : FUintVector4(0, 0, 0, 0);
-	ShaderParameters->WriteSensorGridDimensions = NetworkProxy->TransientResources->HasBuffers ? SensorGridDimensions : FUintVector4(0, 0, 0, 0);
-
-	const int32* WriteIndexPtr = NetworkProxy->InstanceOwnerWriteIndexMap.Find(Context.GetSystemInstanceID());
-	ShaderParameters->SensorGridWriteIndex = WriteIndexPtr ? *WriteIndexPtr : INDEX_NONE;
-
-	const int32* ReadIndexPtr = NetworkProxy->InstanceOwnerReadIndexMap.Find(Context.GetSystemInstanceID());
-	ShaderParameters->SensorGridReadIndex = ReadIndexPtr ? *ReadIndexPtr : INDEX_NONE;
+	ShaderParameters->ReadSensorGridDimensions = ReadPartition
+		? FUintVector4(NetworkProxy->SensorGridLayerCount, NetworkProxy->SensorGridLayerCount, ReadPartition->ExtractedOwnerCount, 1)
+		: FUintVector4(0, 0, 0, 0);
+	ShaderParameters->WriteSensorGridDimensions = (WritePartition && WritePartition->TransientResources->HasBuffers)
+		? FUintVector4(NetworkProxy->SensorGridLayerCount, NetworkProxy->SensorGridLayerCount, WritePartition->AllocatedOwnerCount, 1)
+		: FUintVector4(0, 0, 0, 0);
+
+	ShaderParameters->SensorGridWriteIndex = WriteSlot ? WriteSlot->OwnerIndex : INDEX_NONE;
+	ShaderParameters->SensorGridReadIndex = (ReadSlot && ReadPartition) ? ReadSlot->OwnerIndex : INDEX_NONE;
 
 	ShaderParameters->SensorGridUserChannelCount = NetworkProxy->UserChannelCount;
 }
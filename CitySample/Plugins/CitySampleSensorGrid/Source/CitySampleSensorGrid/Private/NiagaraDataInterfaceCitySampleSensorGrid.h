@@ -50,6 +50,17 @@ public:
 	virtual int32 PerInstanceDataSize() const override;
 	virtual bool InitPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance) override;
 	virtual void DestroyPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance) override;
+	virtual bool PerInstanceTick(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance, float DeltaSeconds) override;
+	virtual void ProvidePerInstanceDataForRenderThread(void* DataForRenderThread, void* PerInstanceData, const FNiagaraSystemInstanceID& SystemInstance) override;
+
+	/**
+	 * Sets the world space location (typically the player) that per-owner sensor budgets are
+	 * scaled against - owners beyond the distances configured through the
+	 * CitySample.sensorgrid.Budget* cvars run their grids at reduced density. Without an
+	 * observer every owner runs at full density.
+	 */
+	static void SetObserverLocation(const FVector& Location);
+	static void ClearObserverLocation();
 
 	virtual bool Equals(const UNiagaraDataInterface* Other) const override;
 
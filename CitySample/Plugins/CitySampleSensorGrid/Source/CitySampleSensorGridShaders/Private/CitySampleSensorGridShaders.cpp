@@ -4,9 +4,12 @@
 
 #include "Algo/RemoveIf.h"
 #include "GPUSort.h"
+#include "Math/Float16.h"
 #include "NiagaraRenderGraphUtils.h"
+#include "RenderCore.h"
 #include "RenderGraphBuilder.h"
 #include "RenderGraphUtils.h"
+#include "RHIGPUReadback.h"
 #include "ShaderPermutation.h"
 #include "ShaderParameterStruct.h"
 #include "GlobalShader.h"
@@ -36,6 +39,45 @@ static FAutoConsoleVariableRef CVarCitySampleSensorGridBuildDisabled(
 	ECVF_Default
 );
 
+static int32 GCitySampleSensorGridRefitInterval = 4;
+static FAutoConsoleVariableRef CVarCitySampleSensorGridRefitInterval(
+	TEXT("CitySample.sensorgrid.RefitInterval"),
+	GCitySampleSensorGridRefitInterval,
+	TEXT("When > 1 the full BVH build (sort + hierarchy generation) is amortized to every Nth frame with the node bounds refit bottom-up over the cached topology in between. <= 1 rebuilds every frame."),
+	ECVF_Default
+);
+
+static float GCitySampleSensorGridRefitMaxDisplacement = 100.0f;
+static FAutoConsoleVariableRef CVarCitySampleSensorGridRefitMaxDisplacement(
+	TEXT("CitySample.sensorgrid.RefitMaxDisplacement"),
+	GCitySampleSensorGridRefitMaxDisplacement,
+	TEXT("Distance any sensor may move from the last full build before a rebuild is forced in place of a refit. Measured on the GPU and read back with a few frames of latency. <= 0 disables the check."),
+	ECVF_Default
+);
+
+static bool GCitySampleSensorGridAsyncCompute = true;
+static FAutoConsoleVariableRef CVarCitySampleSensorGridAsyncCompute(
+	TEXT("CitySample.sensorgrid.AsyncCompute"),
+	GCitySampleSensorGridAsyncCompute,
+	TEXT("When true (and the RHI supports efficient async compute) the BVH build and traversal passes run on the async compute queue, overlapping with rasterization. The morton code radix sort stays on the graphics queue - SortGPUBuffers requires a graphics command list - so only refit frames overlap end to end."),
+	ECVF_Default
+);
+
+// RDG inserts the cross queue fences from the resource dependencies, so consumers of the
+// traversal results don't need any manual synchronization
+static ERDGPassFlags GetSensorGridComputePassFlags()
+{
+	return (GCitySampleSensorGridAsyncCompute && GSupportsEfficientAsyncCompute) ? ERDGPassFlags::AsyncCompute : ERDGPassFlags::Compute;
+}
+
+static bool GCitySampleSensorGridHalfPrecisionLocations = false;
+static FAutoConsoleVariableRef CVarCitySampleSensorGridHalfPrecisionLocations(
+	TEXT("CitySample.sensorgrid.HalfPrecisionLocations"),
+	GCitySampleSensorGridHalfPrecisionLocations,
+	TEXT("When true the sort and traversal passes read the sensor locations from a half precision mirror (positions rebased onto per owner origins), halving their bandwidth at the cost of ~owner extent * 2^-11 of positional precision."),
+	ECVF_Default
+);
+
 class FCitySampleSensorGridResetSensorLocationsCs : public FGlobalShader
 {
 	DECLARE_GLOBAL_SHADER(FCitySampleSensorGridResetSensorLocationsCs);
@@ -149,6 +191,7 @@ public:
 		SHADER_PARAMETER(uint32, SensorCount)
 		SHADER_PARAMETER(uint32, PaddedOutputCount)
 		SHADER_PARAMETER(uint32, OwnerBitCount)
+		SHADER_PARAMETER(uint32, LocationsAreOwnerLocal)
 	END_SHADER_PARAMETER_STRUCT()
 
 	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
@@ -294,6 +337,83 @@ public:
 };
 IMPLEMENT_GLOBAL_SHADER(FCitySampleSensorGridBvhGenBottomUpCs, "/CitySampleSensorGrid/CitySampleSensorGridBvh.usf", "BoundsGeneration_BottomUp", SF_Compute);
 
+class FCitySampleSensorGridMeasureDisplacementCs : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FCitySampleSensorGridMeasureDisplacementCs);
+	SHADER_USE_PARAMETER_STRUCT(FCitySampleSensorGridMeasureDisplacementCs, FGlobalShader);
+
+public:
+	static const uint32 ChunkSize = 128;
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, CITYSAMPLESENSORGRIDSHADERS_API)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<float4>, SensorLocations)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<float4>, BaselineLocations)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, MaxDisplacementSq)
+		SHADER_PARAMETER(uint32, SensorCount)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+
+		OutEnvironment.SetDefine(TEXT("MEASURE_DISPLACEMENT_CS"), 1);
+		OutEnvironment.SetDefine(TEXT("MEASURE_DISPLACEMENT_CHUNK_SIZE"), ChunkSize);
+	}
+};
+IMPLEMENT_GLOBAL_SHADER(FCitySampleSensorGridMeasureDisplacementCs, "/CitySampleSensorGrid/CitySampleSensorGridBvh.usf", "MeasureDisplacement", SF_Compute);
+
+class FCitySampleSensorGridApplyBudgetsCs : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FCitySampleSensorGridApplyBudgetsCs);
+	SHADER_USE_PARAMETER_STRUCT(FCitySampleSensorGridApplyBudgetsCs, FGlobalShader);
+
+public:
+	static const uint32 ChunkSize = 128;
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, CITYSAMPLESENSORGRIDSHADERS_API)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<uint>, OwnerStrides)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<float4>, SensorLocations)
+		SHADER_PARAMETER(uint32, SensorsPerOwner)
+		SHADER_PARAMETER(uint32, SensorGridFactor)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+
+		OutEnvironment.SetDefine(TEXT("APPLY_SENSOR_BUDGETS_CS"), 1);
+		OutEnvironment.SetDefine(TEXT("APPLY_SENSOR_BUDGETS_CHUNK_SIZE"), ChunkSize);
+	}
+};
+IMPLEMENT_GLOBAL_SHADER(FCitySampleSensorGridApplyBudgetsCs, "/CitySampleSensorGrid/CitySampleSensorGridBvh.usf", "ApplySensorBudgets", SF_Compute);
+
+class FCitySampleSensorGridRebaseLocationsCs : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FCitySampleSensorGridRebaseLocationsCs);
+	SHADER_USE_PARAMETER_STRUCT(FCitySampleSensorGridRebaseLocationsCs, FGlobalShader);
+
+public:
+	static const uint32 ChunkSize = 128;
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, CITYSAMPLESENSORGRIDSHADERS_API)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<float4>, SensorLocations)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<float4>, BoundingBoxes)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<float4>, OwnerLocalLocations)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<float4>, OwnerOrigins)
+		SHADER_PARAMETER(uint32, SensorsPerOwner)
+		SHADER_PARAMETER(uint32, bRefreshOrigins)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+
+		OutEnvironment.SetDefine(TEXT("REBASE_LOCATIONS_CS"), 1);
+		OutEnvironment.SetDefine(TEXT("REBASE_LOCATIONS_CHUNK_SIZE"), ChunkSize);
+	}
+};
+IMPLEMENT_GLOBAL_SHADER(FCitySampleSensorGridRebaseLocationsCs, "/CitySampleSensorGrid/CitySampleSensorGridBvh.usf", "RebaseLocations", SF_Compute);
+
 class FCitySampleSensorGridBvhTraversalCs : public FGlobalShader
 {
 	DECLARE_GLOBAL_SHADER(FCitySampleSensorGridBvhTraversalCs);
@@ -311,6 +431,7 @@ public:
 	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, CITYSAMPLESENSORGRIDSHADERS_API)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<uint>, SensorCounts)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<float4>, SensorLocations)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<float4>, OwnerOrigins)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FInternalNodes>, InternalNodes)
 		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<FSensorInfo>, NearestSensors)
 		SHADER_PARAMETER(float, MaxDistance)
@@ -319,6 +440,7 @@ public:
 		SHADER_PARAMETER(uint32, PaddedInternalNodeCount)
 		SHADER_PARAMETER(uint32, OwnerCount)
 		SHADER_PARAMETER(uint32, SensorGridFactor)
+		SHADER_PARAMETER(uint32, LocationsAreOwnerLocal)
 	END_SHADER_PARAMETER_STRUCT()
 
 	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
@@ -359,9 +481,14 @@ FCitySampleSensorGridHelper::~FCitySampleSensorGridHelper()
 {
 }
 
+FCitySampleSensorGridHelper::FTransientResources::~FTransientResources() = default;
+
 bool FCitySampleSensorGridHelper::FTransientResources::Supports(const FResourceSizingInfo& OtherSizingInfo) const
 {
-	return OtherSizingInfo.SensorCount <= SizingInfo.SensorCount && OtherSizingInfo.OwnerCount <= SizingInfo.OwnerCount;
+	// the location format is resolved from the cvar at build time, so a toggle forces a rebuild
+	return OtherSizingInfo.SensorCount <= SizingInfo.SensorCount
+		&& OtherSizingInfo.OwnerCount <= SizingInfo.OwnerCount
+		&& SizingInfo.bHalfPrecisionLocations == GCitySampleSensorGridHalfPrecisionLocations;
 }
 
 void FCitySampleSensorGridHelper::FTransientResources::Reset()
@@ -380,13 +507,26 @@ void FCitySampleSensorGridHelper::FTransientResources::Reset()
 	OwnerBoundingBoxes = nullptr;
 	InternalNodes = nullptr;
 	SensorCounts = nullptr;
+	OwnerLocalLocations = nullptr;
+	OwnerOrigins = nullptr;
 
 	HasBuffers = false;
+
+	// without valid buffers the cached topology can no longer be trusted
+	PooledInternalNodes = nullptr;
+	PooledParentIndices = nullptr;
+	PooledSensorCounts = nullptr;
+	PooledBaselineLocations = nullptr;
+	PooledOwnerOrigins = nullptr;
+	FramesSinceFullBuild = 0;
+	bFullRebuildPending = false;
+	bRefitThisFrame = false;
 }
 
 void FCitySampleSensorGridHelper::FTransientResources::Build(FRDGBuilder& GraphBuilder, const FResourceSizingInfo& InSizingInfo)
 {
 	SizingInfo = InSizingInfo;
+	SizingInfo.bHalfPrecisionLocations = GCitySampleSensorGridHalfPrecisionLocations;
 
 	if (SizingInfo.SensorCount <= 1)
 	{
@@ -394,6 +534,46 @@ void FCitySampleSensorGridHelper::FTransientResources::Build(FRDGBuilder& GraphB
 		return;
 	}
 
+	// resolve the displacement measured on a previous refit frame; results enqueued before the
+	// last full build no longer relate to the current baseline and are discarded
+	if (bDisplacementReadbackPending && DisplacementReadback.IsValid() && DisplacementReadback->IsReady())
+	{
+		uint32 MaxDisplacementSqBits = 0;
+		if (const void* ReadbackData = DisplacementReadback->Lock(sizeof(uint32)))
+		{
+			FMemory::Memcpy(&MaxDisplacementSqBits, ReadbackData, sizeof(uint32));
+			DisplacementReadback->Unlock();
+		}
+		bDisplacementReadbackPending = false;
+
+		if (DisplacementReadbackFrame >= LastFullBuildFrame && GCitySampleSensorGridRefitMaxDisplacement > 0.0f)
+		{
+			// the shader stores asuint() of the squared distance (ordering is preserved for positive floats)
+			float MaxDisplacementSq = 0.0f;
+			FMemory::Memcpy(&MaxDisplacementSq, &MaxDisplacementSqBits, sizeof(float));
+
+			if (MaxDisplacementSq > FMath::Square(GCitySampleSensorGridRefitMaxDisplacement))
+			{
+				bFullRebuildPending = true;
+			}
+		}
+	}
+
+	const bool bRefitSupported =
+		GCitySampleSensorGridRefitInterval > 1 &&
+		!GCitySampleSensorGridBuildDisabled &&
+		SizingInfo.OwnerCount > 1 &&
+		PooledInternalNodes.IsValid() &&
+		PooledParentIndices.IsValid() &&
+		PooledSensorCounts.IsValid() &&
+		PooledBaselineLocations.IsValid() &&
+		(!SizingInfo.bHalfPrecisionLocations || PooledOwnerOrigins.IsValid()) &&
+		SizingInfo.SensorCount == PooledSizingInfo.SensorCount &&
+		SizingInfo.OwnerCount == PooledSizingInfo.OwnerCount &&
+		SizingInfo.bHalfPrecisionLocations == PooledSizingInfo.bHalfPrecisionLocations;
+
+	bRefitThisFrame = bRefitSupported && !bFullRebuildPending && (FramesSinceFullBuild + 1) < (uint32)GCitySampleSensorGridRefitInterval;
+
 	const uint32 InternalNodesPerOwner = SizingInfo.SensorCount - 1;
 	const uint32 ParentsPerOwner = SizingInfo.SensorCount + InternalNodesPerOwner;
 	const uint32 AlignedSensorsPerOwner = Align(InSizingInfo.SensorCount, CitySampleSensorGridShaders::SensorsPerOwnerAlignment);
@@ -403,37 +583,74 @@ void FCitySampleSensorGridHelper::FTransientResources::Build(FRDGBuilder& GraphB
 
 	SensorLocations = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(FVector4f), SizingInfo.SensorCount * SizingInfo.OwnerCount), TEXT("CitySampleSensorGridSensorLocations"));
 
+	if (SizingInfo.bHalfPrecisionLocations)
+	{
+		// half precision mirror of the locations (viewed as PF_FloatRGBA) for the sort and traversal passes
+		OwnerLocalLocations = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(FFloat16) * 4, SizingInfo.SensorCount * SizingInfo.OwnerCount), TEXT("CitySampleSensorGridOwnerLocalLocations"));
+	}
+	else
+	{
+		OwnerLocalLocations = nullptr;
+	}
+
 	if (SizingInfo.UserChannelCount > 0)
 	{
 		UserChannelData = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(FVector4f), SizingInfo.SensorCount * SizingInfo.OwnerCount * SizingInfo.UserChannelCount), TEXT("CitySampleSensorGridUserChannelData"));
 	}
 
-	PartialBounds = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(FVector4f), Align(IntermediaryBoundsPerOwner, FCitySampleSensorGridBvhFinalizeBoundsCs::ChunkSize) * SizingInfo.OwnerCount * 2), TEXT("CitySampleSensorGridBvhPartialBounds"));
+	HierarchyGates = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), Align(InternalNodesPerOwner, CitySampleSensorGridShaders::SensorsPerOwnerAlignment) * SizingInfo.OwnerCount), TEXT("CitySampleSensorGridBvhAccumGates"));
 
-	for (FRDGBufferRef& LeafIndicesBuff : LeafIndices)
+	if (bRefitThisFrame)
 	{
-		LeafIndicesBuff = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), AlignedSensorsPerOwner * SizingInfo.OwnerCount), TEXT("CitySampleSensorGridBvhLeafIndicesSorting"));
+		// the sorted leaves and node relationships are reused from the last full build, so only
+		// the buffers needed to refit the bounds and run the traversals are required
+		PartialBounds = nullptr;
+		LeafIndices[0] = nullptr;
+		LeafIndices[1] = nullptr;
+		MortonCodes[0] = nullptr;
+		MortonCodes[1] = nullptr;
+		DuplicateCounts = nullptr;
+		CopyCommands = nullptr;
+		OwnerBoundingBoxes = nullptr;
+
+		ParentIndices = GraphBuilder.RegisterExternalBuffer(PooledParentIndices);
+		InternalNodes = GraphBuilder.RegisterExternalBuffer(PooledInternalNodes);
+		SensorCounts = GraphBuilder.RegisterExternalBuffer(PooledSensorCounts);
+
+		// refits rebase against the origins captured at the last full build
+		OwnerOrigins = SizingInfo.bHalfPrecisionLocations ? GraphBuilder.RegisterExternalBuffer(PooledOwnerOrigins) : nullptr;
 	}
-
-	for (FRDGBufferRef& MortonCodesBuff : MortonCodes)
+	else
 	{
-		MortonCodesBuff = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), AlignedSensorsPerOwner * SizingInfo.OwnerCount), TEXT("CitySampleSensorGridBvhMortonCodesSorting"));
-	}
+		PartialBounds = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(FVector4f), Align(IntermediaryBoundsPerOwner, FCitySampleSensorGridBvhFinalizeBoundsCs::ChunkSize) * SizingInfo.OwnerCount * 2), TEXT("CitySampleSensorGridBvhPartialBounds"));
 
-	DuplicateCounts = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), DuplicateCountBlocks), TEXT("CitySampleSensorGridBvhDuplicateCounts"));
+		for (FRDGBufferRef& LeafIndicesBuff : LeafIndices)
+		{
+			LeafIndicesBuff = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), AlignedSensorsPerOwner * SizingInfo.OwnerCount), TEXT("CitySampleSensorGridBvhLeafIndicesSorting"));
+		}
 
-	CopyCommands = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(FUintVector4), DuplicateCountBlocks), TEXT("CitySampleSensorGridBvhCopyCommands"));
+		for (FRDGBufferRef& MortonCodesBuff : MortonCodes)
+		{
+			MortonCodesBuff = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), AlignedSensorsPerOwner * SizingInfo.OwnerCount), TEXT("CitySampleSensorGridBvhMortonCodesSorting"));
+		}
 
-	ParentIndices = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), Align(ParentsPerOwner, CitySampleSensorGridShaders::SensorsPerOwnerAlignment) * SizingInfo.OwnerCount), TEXT("CitySampleSensorGridBvhParentIndices"));
+		DuplicateCounts = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), DuplicateCountBlocks), TEXT("CitySampleSensorGridBvhDuplicateCounts"));
 
-	HierarchyGates = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), Align(InternalNodesPerOwner, CitySampleSensorGridShaders::SensorsPerOwnerAlignment) * SizingInfo.OwnerCount), TEXT("CitySampleSensorGridBvhAccumGates"));
+		CopyCommands = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(FUintVector4), DuplicateCountBlocks), TEXT("CitySampleSensorGridBvhCopyCommands"));
+
+		ParentIndices = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), Align(ParentsPerOwner, CitySampleSensorGridShaders::SensorsPerOwnerAlignment) * SizingInfo.OwnerCount), TEXT("CitySampleSensorGridBvhParentIndices"));
+
+		// buffer to store the bounds for each of the owners
+		OwnerBoundingBoxes = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(FVector4f), SizingInfo.OwnerCount * 2), TEXT("CitySampleSensorGridBvhOwnerBounds"));
 
-	// buffer to store the bounds for each of the owners
-	OwnerBoundingBoxes = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(FVector4f), SizingInfo.OwnerCount * 2), TEXT("CitySampleSensorGridBvhOwnerBounds"));
+		InternalNodes = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(CitySampleSensorGridShaders::FInternalNode), Align(InternalNodesPerOwner, CitySampleSensorGridShaders::SensorsPerOwnerAlignment) * SizingInfo.OwnerCount), TEXT("CitySampleSensorGridBvhInternalNodes"));
 
-	InternalNodes = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(CitySampleSensorGridShaders::FInternalNode), Align(InternalNodesPerOwner, CitySampleSensorGridShaders::SensorsPerOwnerAlignment) * SizingInfo.OwnerCount), TEXT("CitySampleSensorGridBvhInternalNodes"));
+		SensorCounts = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), SizingInfo.OwnerCount), TEXT("CitySampleSensorGridBvhSensorCounts"));
 
-	SensorCounts = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), SizingInfo.OwnerCount), TEXT("CitySampleSensorGridBvhSensorCounts"));
+		OwnerOrigins = SizingInfo.bHalfPrecisionLocations
+			? GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(FVector4f), SizingInfo.OwnerCount), TEXT("CitySampleSensorGridOwnerOrigins"))
+			: nullptr;
+	}
 
 	TraversalResults = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(FSensorInfo), SizingInfo.SensorCount * SizingInfo.OwnerCount), TEXT("CitySampleSensorGridTraversalResults"));
 
@@ -473,6 +690,7 @@ void FCitySampleSensorGridHelper::ResetResults(
 	FComputeShaderUtils::AddPass(
 		GraphBuilder,
 		RDG_EVENT_NAME("CitySampleSensorGrid_ClearResults"),
+		GetSensorGridComputePassFlags(),
 		TShaderMapRef<FCitySampleSensorGridClearResultsCs>(GetGlobalShaderMap(FeatureLevel)),
 		PassParameters,
 		FIntVector(FMath::DivideAndRoundUp(PassParameters->SensorCount, FCitySampleSensorGridResetSensorLocationsCs::ChunkSize), 1, 1));
@@ -500,6 +718,7 @@ void FCitySampleSensorGridHelper::GenerateOwnerBounds(
 		FComputeShaderUtils::AddPass(
 			GraphBuilder,
 			RDG_EVENT_NAME("CitySampleSensorGrid_PrimetLeafBounds"),
+			GetSensorGridComputePassFlags(),
 			TShaderMapRef<FCitySampleSensorGridBvhPrimeBoundsCs>(GetGlobalShaderMap(FeatureLevel)),
 			PassParameters,
 			FIntVector(IntermediaryBoundsPerOwner, SensorGridDimensions.Z, 1));
@@ -516,12 +735,47 @@ void FCitySampleSensorGridHelper::GenerateOwnerBounds(
 		FComputeShaderUtils::AddPass(
 			GraphBuilder,
 			RDG_EVENT_NAME("CitySampleSensorGrid_FinalizeLeafBounds"),
+			GetSensorGridComputePassFlags(),
 			TShaderMapRef<FCitySampleSensorGridBvhFinalizeBoundsCs>(GetGlobalShaderMap(FeatureLevel)),
 			PassParameters,
 			FIntVector(SensorGridDimensions.Z, 1, 1));
 	}
 }
 
+void FCitySampleSensorGridHelper::AddRebaseLocationsPass(
+	FRDGBuilder& GraphBuilder,
+	FTransientResources& TransientResources,
+	FRDGBufferSRVRef SensorLocationsSrv,
+	bool bRefreshOrigins)
+{
+	check(TransientResources.HasBuffers);
+	check(TransientResources.SizingInfo.bHalfPrecisionLocations);
+
+	const uint32 SensorsPerOwner = (1 << SensorGridDimensions.X) * (1 << SensorGridDimensions.Y);
+
+	FCitySampleSensorGridRebaseLocationsCs::FParameters* PassParameters = GraphBuilder.AllocParameters<FCitySampleSensorGridRebaseLocationsCs::FParameters>();
+	PassParameters->SensorLocations = SensorLocationsSrv;
+
+	// refit frames reuse the captured origins and never touch the bounds, which aren't built
+	// on those frames - bind the locations again to keep the parameters valid
+	PassParameters->BoundingBoxes = bRefreshOrigins
+		? GraphBuilder.CreateSRV(TransientResources.OwnerBoundingBoxes, PF_A32B32G32R32F)
+		: SensorLocationsSrv;
+
+	PassParameters->OwnerLocalLocations = GraphBuilder.CreateUAV(TransientResources.OwnerLocalLocations, PF_FloatRGBA);
+	PassParameters->OwnerOrigins = GraphBuilder.CreateUAV(TransientResources.OwnerOrigins, PF_A32B32G32R32F);
+	PassParameters->SensorsPerOwner = SensorsPerOwner;
+	PassParameters->bRefreshOrigins = bRefreshOrigins ? 1 : 0;
+
+	FComputeShaderUtils::AddPass(
+		GraphBuilder,
+		RDG_EVENT_NAME("CitySampleSensorGrid_RebaseLocations"),
+		GetSensorGridComputePassFlags(),
+		TShaderMapRef<FCitySampleSensorGridRebaseLocationsCs>(GetGlobalShaderMap(FeatureLevel)),
+		PassParameters,
+		FIntVector(FMath::DivideAndRoundUp(SensorsPerOwner, FCitySampleSensorGridRebaseLocationsCs::ChunkSize), SensorGridDimensions.Z, 1));
+}
+
 void FCitySampleSensorGridHelper::GenerateSortedLeaves(
 	FRDGBuilder& GraphBuilder,
 	FTransientResources& TransientResources,
@@ -550,10 +804,12 @@ void FCitySampleSensorGridHelper::GenerateSortedLeaves(
 		PassParameters->SensorCount = SensorsPerOwner;
 		PassParameters->PaddedOutputCount = Align(SensorsPerOwner, CitySampleSensorGridShaders::SensorsPerOwnerAlignment);
 		PassParameters->OwnerBitCount = CitySampleSensorGridShaders::MortonCodeBitsReservedForOwner;
+		PassParameters->LocationsAreOwnerLocal = TransientResources.SizingInfo.bHalfPrecisionLocations ? 1 : 0;
 
 		FComputeShaderUtils::AddPass(
 			GraphBuilder,
 			RDG_EVENT_NAME("CitySampleSensorGrid_BvhMorton"),
+			GetSensorGridComputePassFlags(),
 			TShaderMapRef<FCitySampleSensorGridBvhMortonCs>(GetGlobalShaderMap(FeatureLevel)),
 			PassParameters,
 			FIntVector(FMath::DivideAndRoundUp(SensorsPerOwner, FCitySampleSensorGridBvhMortonCs::ChunkSize), SensorGridDimensions.Z, 1));
@@ -574,8 +830,8 @@ void FCitySampleSensorGridHelper::GenerateSortedLeaves(
 		
 		const int32 NumTotalSensors = SensorsPerOwner * SensorGridDimensions.Z;
 
-		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(TransientResources.MortonCodes[1], PF_R32_UINT), 0);
-		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(TransientResources.LeafIndices[0], PF_R32_UINT), 0);
+		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(TransientResources.MortonCodes[1], PF_R32_UINT), 0, GetSensorGridComputePassFlags());
+		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(TransientResources.LeafIndices[0], PF_R32_UINT), 0, GetSensorGridComputePassFlags());
 
 		GraphBuilder.AddPass(
 			RDG_EVENT_NAME("CitySampleSensorGrid_SortMortonCodes"),
@@ -619,6 +875,7 @@ void FCitySampleSensorGridHelper::GenerateSortedLeaves(
 		FComputeShaderUtils::AddPass(
 			GraphBuilder,
 			RDG_EVENT_NAME("CitySampleSensorGrid_MortonCompaction"),
+			GetSensorGridComputePassFlags(),
 			TShaderMapRef<FCitySampleSensorGridMortonCompactionCs>(GetGlobalShaderMap(FeatureLevel)),
 			PassParameters,
 			FIntVector(DuplicateCountBlocks, 1, 1));
@@ -638,6 +895,7 @@ void FCitySampleSensorGridHelper::GenerateSortedLeaves(
 		FComputeShaderUtils::AddPass(
 			GraphBuilder,
 			RDG_EVENT_NAME("CitySampleSensorGrid_BuildCopyCommands"),
+			GetSensorGridComputePassFlags(),
 			TShaderMapRef<FCitySampleSensorGridBuildCopyCommandsCs>(GetGlobalShaderMap(FeatureLevel)),
 			PassParameters,
 			FIntVector(SensorGridDimensions.Z, 1, 1));
@@ -654,6 +912,7 @@ void FCitySampleSensorGridHelper::GenerateSortedLeaves(
 		FComputeShaderUtils::AddPass(
 			GraphBuilder,
 			RDG_EVENT_NAME("CitySampleSensorGrid_ShuffleMorton"),
+			GetSensorGridComputePassFlags(),
 			ShuffleDataShader,
 			ShuffleMortonParameters,
 			FIntVector(DuplicateCountBlocks, 1, 1));
@@ -666,6 +925,7 @@ void FCitySampleSensorGridHelper::GenerateSortedLeaves(
 		FComputeShaderUtils::AddPass(
 			GraphBuilder,
 			RDG_EVENT_NAME("CitySampleSensorGrid_ShuffleIndices"),
+			GetSensorGridComputePassFlags(),
 			ShuffleDataShader,
 			ShuffleIndicesParameters,
 			FIntVector(DuplicateCountBlocks, 1, 1));
@@ -703,33 +963,137 @@ void FCitySampleSensorGridHelper::GenerateBvh(
 		FComputeShaderUtils::AddPass(
 			GraphBuilder,
 			RDG_EVENT_NAME("CitySampleSensorGrid_BvhGenTopDown"),
+			GetSensorGridComputePassFlags(),
 			TShaderMapRef<FCitySampleSensorGridBvhGenTopDownCs>(GetGlobalShaderMap(FeatureLevel)),
 			PassParameters,
 			FIntVector(FMath::DivideAndRoundUp(InternalNodesPerOwner, FCitySampleSensorGridBvhGenTopDownCs::ChunkSize), SensorGridDimensions.Z, 1));
 	}
 
 	// bottom up pass for completing bounds generation
+	AddBottomUpBoundsPass(GraphBuilder, TransientResources, SensorLocationsSrv);
+}
+
+void FCitySampleSensorGridHelper::AddBottomUpBoundsPass(
+	FRDGBuilder& GraphBuilder,
+	FTransientResources& TransientResources,
+	FRDGBufferSRVRef SensorLocationsSrv)
+{
+	check((CitySampleSensorGridShaders::SensorsPerOwnerAlignment % FCitySampleSensorGridBvhGenBottomUpCs::ChunkSize) == 0);
+
+	const uint32 SensorsPerOwner = (1 << SensorGridDimensions.X) * (1 << SensorGridDimensions.Y);
+	const uint32 InternalNodesPerOwner = SensorsPerOwner - 1;
+	const uint32 ParentsPerOwner = SensorsPerOwner + InternalNodesPerOwner;
+
+	FCitySampleSensorGridBvhGenBottomUpCs::FParameters* PassParameters = GraphBuilder.AllocParameters<FCitySampleSensorGridBvhGenBottomUpCs::FParameters>();
+	PassParameters->SensorCounts = GraphBuilder.CreateSRV(TransientResources.SensorCounts, PF_R32_UINT);
+	PassParameters->SensorLocations = SensorLocationsSrv;
+	PassParameters->ParentIndices = GraphBuilder.CreateSRV(TransientResources.ParentIndices, PF_R32_UINT);
+	PassParameters->InternalNodes = GraphBuilder.CreateUAV(TransientResources.InternalNodes, PF_Unknown);
+	PassParameters->AccumulationGates = GraphBuilder.CreateUAV(TransientResources.HierarchyGates, PF_R32_UINT);
+	PassParameters->InternalNodeParentOffset = SensorsPerOwner;
+	PassParameters->MaxSensorsPerOwner = SensorsPerOwner;
+	PassParameters->PaddedInternalNodeCount = Align(InternalNodesPerOwner, CitySampleSensorGridShaders::SensorsPerOwnerAlignment);
+	PassParameters->PaddedParentCount = Align(ParentsPerOwner, CitySampleSensorGridShaders::SensorsPerOwnerAlignment);
+
+	FComputeShaderUtils::AddPass(
+		GraphBuilder,
+		RDG_EVENT_NAME("CitySampleSensorGrid_BvhGenBottomUp"),
+		GetSensorGridComputePassFlags(),
+		TShaderMapRef<FCitySampleSensorGridBvhGenBottomUpCs>(GetGlobalShaderMap(FeatureLevel)),
+		PassParameters,
+		FIntVector(FMath::DivideAndRoundUp(SensorsPerOwner, FCitySampleSensorGridBvhGenBottomUpCs::ChunkSize), SensorGridDimensions.Z, 1));
+}
+
+void FCitySampleSensorGridHelper::RefitBvh(
+	FRDGBuilder& GraphBuilder,
+	FTransientResources& TransientResources,
+	FRDGBufferSRVRef SensorLocationsSrv)
+{
+	check(TransientResources.HasBuffers);
+	RDG_EVENT_SCOPE(GraphBuilder, "RefitBvh");
+
+	// the accumulation gates are normally zeroed by the top down pass, which doesn't run on refit frames
+	AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(TransientResources.HierarchyGates, PF_R32_UINT), 0, GetSensorGridComputePassFlags());
+
+	AddBottomUpBoundsPass(GraphBuilder, TransientResources, SensorLocationsSrv);
+}
+
+void FCitySampleSensorGridHelper::MeasureSensorDisplacement(
+	FRDGBuilder& GraphBuilder,
+	FTransientResources& TransientResources,
+	FRDGBufferSRVRef SensorLocationsSrv)
+{
+	if (GCitySampleSensorGridRefitMaxDisplacement <= 0.0f || TransientResources.bDisplacementReadbackPending)
 	{
-		check((CitySampleSensorGridShaders::SensorsPerOwnerAlignment % FCitySampleSensorGridBvhGenBottomUpCs::ChunkSize) == 0);
+		return;
+	}
 
-		FCitySampleSensorGridBvhGenBottomUpCs::FParameters* PassParameters = GraphBuilder.AllocParameters<FCitySampleSensorGridBvhGenBottomUpCs::FParameters>();
-		PassParameters->SensorCounts = GraphBuilder.CreateSRV(TransientResources.SensorCounts, PF_R32_UINT);
-		PassParameters->SensorLocations = SensorLocationsSrv;
-		PassParameters->ParentIndices = GraphBuilder.CreateSRV(TransientResources.ParentIndices, PF_R32_UINT);
-		PassParameters->InternalNodes = GraphBuilder.CreateUAV(TransientResources.InternalNodes, PF_Unknown);
-		PassParameters->AccumulationGates = GraphBuilder.CreateUAV(TransientResources.HierarchyGates, PF_R32_UINT);
-		PassParameters->InternalNodeParentOffset = SensorsPerOwner;
-		PassParameters->MaxSensorsPerOwner = SensorsPerOwner;
-		PassParameters->PaddedInternalNodeCount = Align(InternalNodesPerOwner, CitySampleSensorGridShaders::SensorsPerOwnerAlignment);
-		PassParameters->PaddedParentCount = Align(ParentsPerOwner, CitySampleSensorGridShaders::SensorsPerOwnerAlignment);
+	const uint32 SensorsPerOwner = (1 << SensorGridDimensions.X) * (1 << SensorGridDimensions.Y);
 
-		FComputeShaderUtils::AddPass(
-			GraphBuilder,
-			RDG_EVENT_NAME("CitySampleSensorGrid_BvhGenBottomUp"),
-			TShaderMapRef<FCitySampleSensorGridBvhGenBottomUpCs>(GetGlobalShaderMap(FeatureLevel)),
-			PassParameters,
-			FIntVector(FMath::DivideAndRoundUp(SensorsPerOwner, FCitySampleSensorGridBvhGenBottomUpCs::ChunkSize), SensorGridDimensions.Z, 1));
+	FRDGBufferRef MaxDisplacement = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), 1), TEXT("CitySampleSensorGridMaxDisplacement"));
+	AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(MaxDisplacement, PF_R32_UINT), 0, GetSensorGridComputePassFlags());
+
+	FCitySampleSensorGridMeasureDisplacementCs::FParameters* PassParameters = GraphBuilder.AllocParameters<FCitySampleSensorGridMeasureDisplacementCs::FParameters>();
+	PassParameters->SensorLocations = SensorLocationsSrv;
+	PassParameters->BaselineLocations = GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(TransientResources.PooledBaselineLocations), PF_A32B32G32R32F);
+	PassParameters->MaxDisplacementSq = GraphBuilder.CreateUAV(MaxDisplacement, PF_R32_UINT);
+	PassParameters->SensorCount = SensorsPerOwner * SensorGridDimensions.Z;
+
+	FComputeShaderUtils::AddPass(
+		GraphBuilder,
+		RDG_EVENT_NAME("CitySampleSensorGrid_MeasureDisplacement"),
+		GetSensorGridComputePassFlags(),
+		TShaderMapRef<FCitySampleSensorGridMeasureDisplacementCs>(GetGlobalShaderMap(FeatureLevel)),
+		PassParameters,
+		FIntVector(FMath::DivideAndRoundUp(PassParameters->SensorCount, FCitySampleSensorGridMeasureDisplacementCs::ChunkSize), 1, 1));
+
+	if (!TransientResources.DisplacementReadback.IsValid())
+	{
+		TransientResources.DisplacementReadback = MakeUnique<FRHIGPUBufferReadback>(TEXT("CitySampleSensorGridDisplacementReadback"));
 	}
+
+	AddEnqueueCopyPass(GraphBuilder, TransientResources.DisplacementReadback.Get(), MaxDisplacement, sizeof(uint32));
+	TransientResources.DisplacementReadbackFrame = GFrameNumberRenderThread;
+	TransientResources.bDisplacementReadbackPending = true;
+}
+
+void FCitySampleSensorGridHelper::ApplySensorBudgets(
+	FRDGBuilder& GraphBuilder,
+	FTransientResources& TransientResources,
+	TConstArrayView<uint32> OwnerStrides)
+{
+	check(TransientResources.HasBuffers);
+	check(OwnerStrides.Num() >= (int32)SensorGridDimensions.Z);
+
+	// nothing to mask when every owner is running at full density
+	bool bAnyReducedOwners = false;
+	for (uint32 OwnerIt = 0; OwnerIt < SensorGridDimensions.Z; ++OwnerIt)
+	{
+		bAnyReducedOwners |= OwnerStrides[OwnerIt] > 1;
+	}
+
+	if (!bAnyReducedOwners)
+	{
+		return;
+	}
+
+	const uint32 SensorsPerOwner = (1 << SensorGridDimensions.X) * (1 << SensorGridDimensions.Y);
+
+	FRDGBufferRef StrideBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), SensorGridDimensions.Z), TEXT("CitySampleSensorGridOwnerStrides"));
+	GraphBuilder.QueueBufferUpload(StrideBuffer, OwnerStrides.GetData(), sizeof(uint32) * SensorGridDimensions.Z);
+
+	FCitySampleSensorGridApplyBudgetsCs::FParameters* PassParameters = GraphBuilder.AllocParameters<FCitySampleSensorGridApplyBudgetsCs::FParameters>();
+	PassParameters->OwnerStrides = GraphBuilder.CreateSRV(StrideBuffer, PF_R32_UINT);
+	PassParameters->SensorLocations = GraphBuilder.CreateUAV(TransientResources.SensorLocations, PF_A32B32G32R32F);
+	PassParameters->SensorsPerOwner = SensorsPerOwner;
+	PassParameters->SensorGridFactor = SensorGridDimensions.X;
+
+	FComputeShaderUtils::AddPass(
+		GraphBuilder,
+		RDG_EVENT_NAME("CitySampleSensorGrid_ApplySensorBudgets"),
+		TShaderMapRef<FCitySampleSensorGridApplyBudgetsCs>(GetGlobalShaderMap(FeatureLevel)),
+		PassParameters,
+		FIntVector(FMath::DivideAndRoundUp(SensorsPerOwner, FCitySampleSensorGridApplyBudgetsCs::ChunkSize), SensorGridDimensions.Z, 1));
 }
 
 void FCitySampleSensorGridHelper::RunTraversals(
@@ -751,9 +1115,14 @@ void FCitySampleSensorGridHelper::RunTraversals(
 			return;
 		}
 
+		const bool bOwnerLocalLocations = TransientResources.SizingInfo.bHalfPrecisionLocations;
+
 		FCitySampleSensorGridBvhTraversalCs::FParameters* PassParameters = GraphBuilder.AllocParameters<FCitySampleSensorGridBvhTraversalCs::FParameters>();
 		PassParameters->SensorCounts = GraphBuilder.CreateSRV(TransientResources.SensorCounts, PF_R32_UINT);
 		PassParameters->SensorLocations = SensorLocationsSrv;
+		PassParameters->OwnerOrigins = bOwnerLocalLocations
+			? GraphBuilder.CreateSRV(TransientResources.OwnerOrigins, PF_A32B32G32R32F)
+			: SensorLocationsSrv;
 		PassParameters->InternalNodes = GraphBuilder.CreateSRV(TransientResources.InternalNodes);
 		PassParameters->NearestSensors = ResultsUav;
 		PassParameters->MaxDistance = GlobalSensorRange.Y;
@@ -762,6 +1131,7 @@ void FCitySampleSensorGridHelper::RunTraversals(
 		PassParameters->PaddedInternalNodeCount = Align(InternalNodesPerOwner, CitySampleSensorGridShaders::SensorsPerOwnerAlignment);
 		PassParameters->OwnerCount = SensorGridDimensions.Z;
 		PassParameters->SensorGridFactor = SensorGridDimensions.X;
+		PassParameters->LocationsAreOwnerLocal = bOwnerLocalLocations ? 1 : 0;
 
 		FCitySampleSensorGridBvhTraversalCs::FPermutationDomain PermutationVector;
 		PermutationVector.Set<FCitySampleSensorGridBvhTraversalCs::FMaxSensorCountLogTwo>(SensorsPerOwnerLogTwo);
@@ -769,6 +1139,7 @@ void FCitySampleSensorGridHelper::RunTraversals(
 		FComputeShaderUtils::AddPass(
 			GraphBuilder,
 			RDG_EVENT_NAME("CitySampleSensorGrid_BvhTraversal"),
+			GetSensorGridComputePassFlags(),
 			TShaderMapRef<FCitySampleSensorGridBvhTraversalCs>(GetGlobalShaderMap(FeatureLevel), PermutationVector),
 			PassParameters,
 			FIntVector(FMath::DivideAndRoundUp(SensorsPerOwner, FCitySampleSensorGridBvhTraversalCs::ChunkSize), SensorGridDimensions.Z, 1));
@@ -789,9 +1160,124 @@ void FCitySampleSensorGridHelper::NearestSensors(
 
 	if (TransientResources.SizingInfo.OwnerCount > 1 && TransientResources.HasBuffers && !GCitySampleSensorGridBuildDisabled)
 	{
-		GenerateOwnerBounds(GraphBuilder, TransientResources, LocationsSRV);
-		GenerateSortedLeaves(GraphBuilder, TransientResources, LocationsSRV);
-		GenerateBvh(GraphBuilder, TransientResources, LocationsSRV);
-		RunTraversals(GraphBuilder, GlobalSensorRange, TransientResources, LocationsSRV, ResultsUAV);
+		const bool bHalfPrecisionLocations = TransientResources.SizingInfo.bHalfPrecisionLocations;
+
+		// the sort and traversal passes read the locations through the half precision mirror when
+		// enabled; the bounds and displacement passes stay on the full precision source
+		FRDGBufferSRVRef CompactLocationsSRV = bHalfPrecisionLocations
+			? GraphBuilder.CreateSRV(TransientResources.OwnerLocalLocations, PF_FloatRGBA)
+			: LocationsSRV;
+
+		if (TransientResources.bRefitThisFrame)
+		{
+			// small per-frame movement - tighten the node bounds over the cached topology and keep an
+			// eye on how far the sensors have drifted so a full rebuild can be forced when it matters
+			if (bHalfPrecisionLocations)
+			{
+				AddRebaseLocationsPass(GraphBuilder, TransientResources, LocationsSRV, false);
+			}
+
+			RefitBvh(GraphBuilder, TransientResources, LocationsSRV);
+			MeasureSensorDisplacement(GraphBuilder, TransientResources, LocationsSRV);
+
+			++TransientResources.FramesSinceFullBuild;
+		}
+		else
+		{
+			GenerateOwnerBounds(GraphBuilder, TransientResources, LocationsSRV);
+
+			if (bHalfPrecisionLocations)
+			{
+				AddRebaseLocationsPass(GraphBuilder, TransientResources, LocationsSRV, true);
+			}
+
+			GenerateSortedLeaves(GraphBuilder, TransientResources, CompactLocationsSRV);
+			GenerateBvh(GraphBuilder, TransientResources, LocationsSRV);
+
+			// keep the topology and a location baseline around so the next frames can refit instead of rebuilding
+			GraphBuilder.QueueBufferExtraction(TransientResources.InternalNodes, &TransientResources.PooledInternalNodes);
+			GraphBuilder.QueueBufferExtraction(TransientResources.ParentIndices, &TransientResources.PooledParentIndices);
+			GraphBuilder.QueueBufferExtraction(TransientResources.SensorCounts, &TransientResources.PooledSensorCounts);
+			GraphBuilder.QueueBufferExtraction(TransientResources.SensorLocations, &TransientResources.PooledBaselineLocations);
+
+			if (bHalfPrecisionLocations)
+			{
+				GraphBuilder.QueueBufferExtraction(TransientResources.OwnerOrigins, &TransientResources.PooledOwnerOrigins);
+			}
+
+			TransientResources.PooledSizingInfo = TransientResources.SizingInfo;
+			TransientResources.LastFullBuildFrame = GFrameNumberRenderThread;
+			TransientResources.FramesSinceFullBuild = 0;
+			TransientResources.bFullRebuildPending = false;
+		}
+
+		RunTraversals(GraphBuilder, GlobalSensorRange, TransientResources, CompactLocationsSRV, ResultsUAV);
 	}
 }
+
+FCitySampleSensorGridAsyncReadback::~FCitySampleSensorGridAsyncReadback() = default;
+
+void FCitySampleSensorGridAsyncReadback::ResolveCompletedReadbacks()
+{
+	for (int32 SlotIt = 0; SlotIt < UE_ARRAY_COUNT(Readbacks); ++SlotIt)
+	{
+		if (!bReadbackPending[SlotIt] || !Readbacks[SlotIt]->IsReady())
+		{
+			continue;
+		}
+
+		bReadbackPending[SlotIt] = false;
+
+		// only hold onto the data if it's newer than what we've already got
+		if (ReadbackFrames[SlotIt] > ResultsFrame)
+		{
+			const uint32 NumBytes = ReadbackCounts[SlotIt] * sizeof(FCitySampleSensorGridHelper::FSensorInfo);
+			if (const void* ReadbackData = Readbacks[SlotIt]->Lock(NumBytes))
+			{
+				FScopeLock _Scope(&ResultsGuard);
+				Results.SetNumUninitialized(ReadbackCounts[SlotIt]);
+				FMemory::Memcpy(Results.GetData(), ReadbackData, NumBytes);
+				ResultsFrame = ReadbackFrames[SlotIt];
+			}
+			Readbacks[SlotIt]->Unlock();
+		}
+	}
+}
+
+void FCitySampleSensorGridAsyncReadback::EnqueueCopy(FRDGBuilder& GraphBuilder, FRDGBufferRef TraversalResults, uint32 ResultCount)
+{
+	ResolveCompletedReadbacks();
+
+	// when both slots are still in flight the GPU is far enough behind that we just skip the
+	// frame rather than introducing a wait
+	if (bReadbackPending[WriteIndex] || !ResultCount)
+	{
+		return;
+	}
+
+	if (!Readbacks[WriteIndex].IsValid())
+	{
+		Readbacks[WriteIndex] = MakeUnique<FRHIGPUBufferReadback>(TEXT("CitySampleSensorGridResultsReadback"));
+	}
+
+	AddEnqueueCopyPass(GraphBuilder, Readbacks[WriteIndex].Get(), TraversalResults, ResultCount * sizeof(FCitySampleSensorGridHelper::FSensorInfo));
+	ReadbackFrames[WriteIndex] = GFrameNumberRenderThread;
+	ReadbackCounts[WriteIndex] = ResultCount;
+	bReadbackPending[WriteIndex] = true;
+
+	WriteIndex = 1 - WriteIndex;
+}
+
+bool FCitySampleSensorGridAsyncReadback::GetResults(TArray<FCitySampleSensorGridHelper::FSensorInfo>& OutResults, uint32& OutResultsFrame) const
+{
+	FScopeLock _Scope(&ResultsGuard);
+
+	if (!ResultsFrame)
+	{
+		return false;
+	}
+
+	OutResults = Results;
+	OutResultsFrame = ResultsFrame;
+	return true;
+}
@@ -7,6 +7,7 @@
 #include "RenderGraphFwd.h"
 #include "RHI.h"
 
+class FRHIGPUBufferReadback;
 class FRHIShaderResourceView;
 class FRHIUnorderedAccessView;
 
@@ -21,6 +22,10 @@ public:
 		uint32 SensorCount = 0;
 		uint32 OwnerCount = 0;
 		uint32 UserChannelCount = 0;
+
+		// Resolved from CitySample.sensorgrid.HalfPrecisionLocations when the buffers are built;
+		// Supports() reports a mismatch with the current setting so the resources get rebuilt
+		bool bHalfPrecisionLocations = false;
 	};
 
 	// c++ mirror of the struct defined in CitySampleSensorGridCommon.ush
@@ -35,6 +40,7 @@ public:
 	struct FTransientResources
 	{
 		FTransientResources() = default;
+		CITYSAMPLESENSORGRIDSHADERS_API ~FTransientResources();
 
 		FTransientResources(const FTransientResources&) = delete;
 		FTransientResources& operator=(const FTransientResources&) = delete;
@@ -61,11 +67,41 @@ public:
 		FRDGBufferRef SensorCounts;
 		FRDGBufferRef TraversalResults;
 
+		// fp16 mirror of SensorLocations (positions rebased onto per owner origins) consumed by
+		// the bandwidth heavy sort & traversal passes. Only allocated when
+		// SizingInfo.bHalfPrecisionLocations is set.
+		FRDGBufferRef OwnerLocalLocations;
+		FRDGBufferRef OwnerOrigins;
+
 		FRDGBufferSRVRef PreviousSensorInfoSRV;
 		FRDGBufferSRVRef PreviousUserChannelDataSRV;
 
 		FResourceSizingInfo SizingInfo;
 		bool HasBuffers = false;
+
+		// State carried between frames so that the BVH bounds can be refit over the cached
+		// topology (CitySample.sensorgrid.RefitInterval) instead of rebuilding from scratch.
+		TRefCountPtr<FRDGPooledBuffer> PooledInternalNodes;
+		TRefCountPtr<FRDGPooledBuffer> PooledParentIndices;
+		TRefCountPtr<FRDGPooledBuffer> PooledSensorCounts;
+
+		// Sensor locations captured at the last full build, used to measure how far the
+		// sensors have drifted from the tree's leaf ordering
+		TRefCountPtr<FRDGPooledBuffer> PooledBaselineLocations;
+
+		// Owner origins captured at the last full build so refit frames rebase into the same
+		// local space the hierarchy was sorted in (half precision locations only)
+		TRefCountPtr<FRDGPooledBuffer> PooledOwnerOrigins;
+
+		TUniquePtr<FRHIGPUBufferReadback> DisplacementReadback;
+		uint32 DisplacementReadbackFrame = 0;
+		bool bDisplacementReadbackPending = false;
+
+		FResourceSizingInfo PooledSizingInfo;
+		uint32 LastFullBuildFrame = 0;
+		uint32 FramesSinceFullBuild = 0;
+		bool bFullRebuildPending = false;
+		bool bRefitThisFrame = false;
 	};
 
 	static uint32 GetMaxSensorDensity();
@@ -80,6 +116,14 @@ public:
 		FRDGBuilder& GraphBuilder,
 		FTransientResources& TransientResources);
 
+	// Invalidates the sensors whose grid coordinates fall off their owner's stride lattice so
+	// distant owners can run at reduced density. Strides must be powers of two and are provided
+	// per owner; a stride of one leaves the owner at full density.
+	void ApplySensorBudgets(
+		FRDGBuilder& GraphBuilder,
+		FTransientResources& TransientResources,
+		TConstArrayView<uint32> OwnerStrides);
+
 private:
 	void ResetResults(
 		FRDGBuilder& GraphBuilder,
@@ -90,6 +134,12 @@ private:
 		FTransientResources& TransientResources,
 		FRDGBufferSRVRef SensorLocationsSrv);
 
+	void AddRebaseLocationsPass(
+		FRDGBuilder& GraphBuilder,
+		FTransientResources& TransientResources,
+		FRDGBufferSRVRef SensorLocationsSrv,
+		bool bRefreshOrigins);
+
 	void GenerateSortedLeaves(
 		FRDGBuilder& GraphBuilder,
 		FTransientResources& TransientResources,
@@ -100,6 +150,21 @@ private:
 		FTransientResources& TransientResources,
 		FRDGBufferSRVRef SensorLocationsSrv);
 
+	void RefitBvh(
+		FRDGBuilder& GraphBuilder,
+		FTransientResources& TransientResources,
+		FRDGBufferSRVRef SensorLocationsSrv);
+
+	void AddBottomUpBoundsPass(
+		FRDGBuilder& GraphBuilder,
+		FTransientResources& TransientResources,
+		FRDGBufferSRVRef SensorLocationsSrv);
+
+	void MeasureSensorDisplacement(
+		FRDGBuilder& GraphBuilder,
+		FTransientResources& TransientResources,
+		FRDGBufferSRVRef SensorLocationsSrv);
+
 	void RunTraversals(
 		FRDGBuilder& GraphBuilder,
 		const FVector2D& GlobalSensorRange,
@@ -110,3 +175,38 @@ private:
 	const ERHIFeatureLevel::Type FeatureLevel;
 	const FUintVector4 SensorGridDimensions;
 };
+
+// Latency tolerant CPU mirror of the nearest-sensor results. Copies are double buffered and
+// never waited on - consumers get the newest completed readback, which will generally lag the
+// GPU by a frame or two. The frame number the results were captured on is reported alongside
+// them so callers can judge their staleness.
+class CITYSAMPLESENSORGRIDSHADERS_API FCitySampleSensorGridAsyncReadback
+{
+public:
+	FCitySampleSensorGridAsyncReadback() = default;
+	~FCitySampleSensorGridAsyncReadback();
+
+	FCitySampleSensorGridAsyncReadback(const FCitySampleSensorGridAsyncReadback&) = delete;
+	FCitySampleSensorGridAsyncReadback& operator=(const FCitySampleSensorGridAsyncReadback&) = delete;
+
+	// Resolves any completed readbacks and enqueues a copy of the provided results buffer when a
+	// slot is free. Render thread only.
+	void EnqueueCopy(FRDGBuilder& GraphBuilder, FRDGBufferRef TraversalResults, uint32 ResultCount);
+
+	// Copies out the newest completed results along with the frame they were captured on.
+	// Returns false if no readback has completed yet. Safe to call from any thread.
+	bool GetResults(TArray<FCitySampleSensorGridHelper::FSensorInfo>& OutResults, uint32& OutResultsFrame) const;
+
+private:
+	void ResolveCompletedReadbacks();
+
+	TUniquePtr<FRHIGPUBufferReadback> Readbacks[2];
+	uint32 ReadbackFrames[2] = { 0, 0 };
+	uint32 ReadbackCounts[2] = { 0, 0 };
+	bool bReadbackPending[2] = { false, false };
+	int32 WriteIndex = 0;
+
+	mutable FCriticalSection ResultsGuard;
+	TArray<FCitySampleSensorGridHelper::FSensorInfo> Results;
+	uint32 ResultsFrame = 0;
+};
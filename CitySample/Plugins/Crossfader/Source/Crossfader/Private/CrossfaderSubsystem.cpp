@@ -159,12 +159,16 @@ void UCrossfaderSubsystem::AddBank(const UMixStateBank* MixStateBank)
 		// If Bank is valid, get soft object path to use as master bank key
 		FSoftObjectPath BankPath = FSoftObjectPath(MixStateBank);
 
-		// Append stored data to master bank
+		// Append the bank's compiled data to the master bank - already validated, deduplicated
+		// and sorted when the asset was saved
 		TArray<FCrossfaderMixPair> BankData;
-		BankData.Append(MixStateBank->MixStates);
+		BankData.Append(MixStateBank->GetCompiledMixStates());
 
 		// Bank path is used as key so data can be removed and added easily
 		MasterMixStateBank.Add(BankPath, BankData);
+
+		// Fold the new data into the compiled lookup table
+		RebuildCompiledMixStates();
 	}
 }
 
@@ -179,6 +183,49 @@ void UCrossfaderSubsystem::RemoveBank(const UMixStateBank* MixStateBank)
 		{
 			// If key is found, remove the bank data from the Master Bank
 			MasterMixStateBank.Remove(BankKey);
+
+			// Drop the removed data from the compiled lookup table
+			RebuildCompiledMixStates();
+		}
+	}
+}
+
+void UCrossfaderSubsystem::RebuildCompiledMixStates()
+{
+	CompiledMixStates.Reset();
+
+	// Flatten the Master Bank into a single MixState keyed table, loading each bus mix now so
+	// SetMixState never has to load during a transition
+	for (auto BankIt = MasterMixStateBank.CreateConstIterator(); BankIt; ++BankIt)
+	{
+		for (auto It = BankIt.Value().CreateConstIterator(); It; ++It)
+		{
+			if (!It->MixState.IsValid())
+			{
+				continue;
+			}
+
+			// Try to load the Bank Bus Mix
+			if (UObject* BankObj = It->ControlBusMix.TryLoad())
+			{
+				if (USoundControlBusMix* BankMix = Cast<USoundControlBusMix>(BankObj))
+				{
+					FCrossfaderCompiledMixState& CompiledMixState = CompiledMixStates.FindOrAdd(It->MixState);
+					CompiledMixState.ControlBusMix = BankMix;
+				}
+				else
+				{
+					// Mix failed cast
+					const FString ObjName = BankObj->GetFullName();
+					UE_LOG(LogCrossfader, Warning, TEXT("Failed to cast %s to SoundControlBusMix while compiling MixStates."), *ObjName);
+				}
+			}
+			else
+			{
+				// Failed to load SoftObjectPath
+				const FString SoftObjPathName = It->ControlBusMix.GetAssetPathString();
+				UE_LOG(LogCrossfader, Warning, TEXT("Failed to load SoundControlBusMix SoftObjectPath %s while compiling MixStates."), *SoftObjPathName);
+			}
 		}
 	}
 }
@@ -201,94 +248,45 @@ bool UCrossfaderSubsystem::SetMixState(const UObject* WorldContextObject, FGamep
 		return false;
 	}
 
-	// Loop through find exact match, if no exact match is found, look for exact parent match
-	TArray<TArray<FCrossfaderMixPair>> MasterListArray;
-	MasterMixStateBank.GenerateValueArray(MasterListArray);
-
 	// Set up variables for search
-	USoundControlBusMix* BankMixToAdd = nullptr;
-	FSoftObjectPath BankMixPath;
-	bool bExactMatchFound = false;
 	FGameplayTag MixStateParent = MixState.RequestDirectParent();
-	FGameplayTag SelectedMixState;
+	FGameplayTag SelectedMixState = MixState;
+
+	// Look for an exact match in the compiled table
+	const FCrossfaderCompiledMixState* CompiledMixState = CompiledMixStates.Find(MixState);
+	const bool bExactMatchFound = CompiledMixState != nullptr;
 
-	// Begin search
-	for (auto ItA = MasterListArray.CreateConstIterator(); ItA; ++ItA)
+	if (!CompiledMixState && bFallBackToNearestParent)
 	{
-		TArray<FCrossfaderMixPair> BankArray = *ItA;
-		
-		for (auto ItB = BankArray.CreateConstIterator(); ItB; ++ItB)
+		// No exact match, walk up the namespace until we find the nearest registered parent
+		FGameplayTag MixStateTag = MixState.RequestDirectParent();
+
+		while (MixStateTag.IsValid() && !CompiledMixState)
 		{
-			FGameplayTag BankTag = ItB->MixState;
-			
-			if (MixState.MatchesTagExact(BankTag))
+			CompiledMixState = CompiledMixStates.Find(MixStateTag);
+
+			if (CompiledMixState)
 			{
 				// Cache matching bank tag
-				SelectedMixState = BankTag;
-
-				// If we have an exact state match, set the BankMixPath
-				BankMixPath = ItB->ControlBusMix;
-
-				// Try to load the Bank Bus Mix
-				if (UObject* BankObj = BankMixPath.TryLoad())
-				{
-					// Cast to a USoundControlBusMix
-					BankMixToAdd = Cast<USoundControlBusMix>(BankObj);
-
-					// We found a match, set flag to true
-					bExactMatchFound = true;
-
-					// We found a match, we can leave the loop
-					break;
-				}
+				SelectedMixState = MixStateTag;
 			}
 			else
 			{
-				// If we want to fall back to nearest parent, do so in this loop
-				if (bFallBackToNearestParent)
-				{
-					FGameplayTag MixStateTag = MixState;
-
-					// Search for nearest valid parent tag
-					for (uint32 i = 0; i < MixStateTagDepth; ++i)
-					{
-						MixStateTag = MixStateTag.RequestDirectParent();
-
-						if (MixStateTag.MatchesTagExact(BankTag))
-						{
-							// Cache matching bank tag
-							SelectedMixState = BankTag;
-
-							// If the MixStateTag matches, cache just in case we never find an exact match
-							BankMixPath = ItB->ControlBusMix;
-
-							// Try to load the Bank Bus Mix
-							if (UObject* BankObj = BankMixPath.TryLoad())
-							{
-								// Cast to a USoundControlBusMix
-								BankMixToAdd = Cast<USoundControlBusMix>(BankObj);
-							}
-						}
-					}
-
-				}
+				MixStateTag = MixStateTag.RequestDirectParent();
 			}
 		}
-
-		if (bExactMatchFound)
-		{
-			// We found an exact match in the last sub-loop, we can leave the search
-			break;
-		}
 	}
 
-	if (!BankMixToAdd)
+	if (!CompiledMixState || !CompiledMixState->ControlBusMix)
 	{
 		// No Mix has been found
 		return false;
 	}
 
-	TArray<FGameplayTag> OldMixesToRemove;
+	USoundControlBusMix* BankMixToAdd = CompiledMixState->ControlBusMix;
+
+	TArray<FGameplayTag>& OldMixesToRemove = PendingMixRemovals;
+	OldMixesToRemove.Reset();
 	bool bMixAlreadyActive = false;
 	bool bMixesAreSiblings = false;
 
@@ -405,7 +403,8 @@ void UCrossfaderSubsystem::ClearMixState(const UObject* WorldContextObject, FGam
 	// Validate UWorld and Tag
 	if (WorldContextObject || MixState.IsValid())
 	{
-		TArray<FGameplayTag> OldMixesToRemove;
+		TArray<FGameplayTag>& OldMixesToRemove = PendingMixRemovals;
+		OldMixesToRemove.Reset();
 		bool bMixAlreadyActive = false;
 
 		// Check Active Mixes to determine if we need to deactivate a current mix
@@ -478,17 +477,16 @@ void UCrossfaderSubsystem::ClearMixState(const UObject* WorldContextObject, FGam
 
 uint32 UCrossfaderSubsystem::GameplayTagDepth(FGameplayTag GameplayTag)
 {
-	// Convert to string
-	FString GameplayTagString = GameplayTag.ToString();
+	// Count the namespaces by walking up the parent chain, avoiding the string round trip
+	uint32 Depth = 0;
 
-	// Create an Array
-	TArray<FString> ParsedArray;
-
-	// Parse string out into Array using "." as delimter
-	GameplayTagString.ParseIntoArray(ParsedArray, TEXT("."), true);
+	while (GameplayTag.IsValid())
+	{
+		++Depth;
+		GameplayTag = GameplayTag.RequestDirectParent();
+	}
 
-	// Return num of elements in parsed array
-	return ParsedArray.Num();
+	return Depth;
 }
 
 void UCrossfaderSubsystem::Tick(float DeltaTime)
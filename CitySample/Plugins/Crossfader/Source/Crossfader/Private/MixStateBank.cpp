@@ -1,4 +1,71 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 
-#include "MixStateBank.h"
\ No newline at end of file
+#include "MixStateBank.h"
+#include "UObject/ObjectSaveContext.h"
+
+void UMixStateBank::PostLoad()
+{
+	Super::PostLoad();
+
+	// Banks saved before the compiled data existed (or edited outside a save) compile on load
+	if (CompiledMixStates.IsEmpty() && !MixStates.IsEmpty())
+	{
+		CompileMixStates();
+	}
+}
+
+#if WITH_EDITOR
+void UMixStateBank::PreSave(FObjectPreSaveContext SaveContext)
+{
+	// Compile before every save so the cooked asset always carries current lookup data
+	CompileMixStates();
+
+	Super::PreSave(SaveContext);
+}
+
+void UMixStateBank::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Keep the compiled data current for PIE without requiring a save
+	CompileMixStates();
+}
+#endif
+
+void UMixStateBank::CompileMixStates()
+{
+	CompiledMixStates.Reset();
+	CompiledMixStates.Reserve(MixStates.Num());
+
+	for (const FCrossfaderMixPair& MixPair : MixStates)
+	{
+		// Entries without a state or a mix can never resolve, drop them here rather than at runtime
+		if (!MixPair.MixState.IsValid() || MixPair.ControlBusMix.IsNull())
+		{
+			continue;
+		}
+
+		// Later entries override earlier ones for the same state, matching how the subsystem
+		// folds bank data into its compiled table
+		const int32 ExistingIndex = CompiledMixStates.IndexOfByPredicate([&MixPair](const FCrossfaderMixPair& Existing)
+		{
+			return Existing.MixState == MixPair.MixState;
+		});
+
+		if (ExistingIndex != INDEX_NONE)
+		{
+			CompiledMixStates[ExistingIndex].ControlBusMix = MixPair.ControlBusMix;
+		}
+		else
+		{
+			CompiledMixStates.Add(MixPair);
+		}
+	}
+
+	// Lexical sort keeps the cooked data deterministic and binary searchable
+	CompiledMixStates.Sort([](const FCrossfaderMixPair& LHS, const FCrossfaderMixPair& RHS)
+	{
+		return LHS.MixState.GetTagName().LexicalLess(RHS.MixState.GetTagName());
+	});
+}
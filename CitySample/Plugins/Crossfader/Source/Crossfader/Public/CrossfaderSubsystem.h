@@ -73,6 +73,20 @@ struct CROSSFADER_API FCrossfaderMixBusStatePair
 	}
 };
 
+/**
+* A single entry in the compiled MixState lookup table. The SoundControlBusMix is loaded when the
+* table is built so state transitions never need to hit the asset registry.
+*/
+USTRUCT()
+struct CROSSFADER_API FCrossfaderCompiledMixState
+{
+	GENERATED_BODY()
+
+	/** Pointer to the preloaded SoundControlBusMix for this MixState */
+	UPROPERTY(Transient)
+	USoundControlBusMix* ControlBusMix = nullptr;
+};
+
 /**
  * CrossfaderSubsystem is the high-level manager that filters GameplayTag MixStates and activates/deactivates associated SoundControlBusMixes.
  */
@@ -149,10 +163,20 @@ private:
 	/** The master list of bank data is stored as F Objects only (FSoftObjectPaths and FGameplayTags), no UObjects are stored in this list. */
 	TMap<FSoftObjectPath, TArray<FCrossfaderMixPair>> MasterMixStateBank;
 
+	/** The master bank compiled down to a flat MixState keyed table with the bus mixes preloaded. Rebuilt whenever a bank is added or removed. */
+	UPROPERTY(Transient)
+	TMap<FGameplayTag, FCrossfaderCompiledMixState> CompiledMixStates;
+
 	/** A Map of Active Mixes, the Mix State Parent (x.y) is used as a key to a struct containing both the Active State (x.y.z or x.y) and a Control Bus Mix. */
 	UPROPERTY()
 	TMap<FGameplayTag, FCrossfaderMixBusStatePair> ActiveMixes;
 
+	// Scratch list of mix keys to drop from ActiveMixes, reused across state changes so transitions don't allocate
+	TArray<FGameplayTag> PendingMixRemovals;
+
+	// Rebuild the compiled MixState table from the Master Bank, loading the associated bus mixes up front
+	void RebuildCompiledMixStates();
+
 	// Helper funcction to determine how many tags are in the GameplayTag (e.g. x.y will return 2, x.y.z will return 3, etc.)
 	uint32 GameplayTagDepth(FGameplayTag GameplayTag);
 
@@ -36,5 +36,30 @@ public:
 	/** The MixState associations stored in this MixStateBank */
 	UPROPERTY(EditAnywhere, Category = "MixStates")
 	TArray<FCrossfaderMixPair> MixStates;
+
+	/**
+	* The bank data compiled for runtime consumption: invalid entries dropped, duplicate states
+	* collapsed (last entry wins, matching the subsystem fold order) and the result sorted by
+	* state tag name. Built when the asset is saved so it cooks with the bank and the subsystem
+	* never scans the editor-facing MixStates array at runtime.
+	*/
+	const TArray<FCrossfaderMixPair>& GetCompiledMixStates() const { return CompiledMixStates; }
+
+	//~ Begin UObject Interface
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	//~ End UObject Interface
+
+private:
+
+	// Rebuild CompiledMixStates from MixStates
+	void CompileMixStates();
+
+	/** Compiled form of MixStates, serialized with the asset */
+	UPROPERTY()
+	TArray<FCrossfaderMixPair> CompiledMixStates;
 };
 
@@ -14,6 +14,13 @@
 
 #define LOCTEXT_NAMESPACE "HoverDroneMovementComponent"
 
+int32 HoverDroneAsyncAltitudeTraces = 1;
+FAutoConsoleVariableRef CVarHoverDroneAsyncAltitudeTraces(
+	TEXT("HoverDrone.AsyncAltitudeTraces"),
+	HoverDroneAsyncAltitudeTraces,
+	TEXT("When non-zero the per-frame altitude probe runs as an async trace and consumes the previous frame's result, instead of blocking on the physics scene.\n"),
+	ECVF_Default);
+
 UHoverDroneMovementComponent::UHoverDroneMovementComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -90,6 +97,8 @@ void UHoverDroneMovementComponent::BeginPlay()
 	{
 		DirectRotationInputGoalRotation = UpdatedComponent->GetComponentRotation();
 	}
+
+	AltitudeTraceDelegate.BindUObject(this, &UHoverDroneMovementComponent::OnAltitudeTraceComplete);
 }
 
 // internal
@@ -136,7 +145,7 @@ void UHoverDroneMovementComponent::ApplyControlInputToVelocity(float DeltaTime)
 	// make sure that if players are out of bounds, we don't let them push farther out of bounds but we do
 	// let them push back in.
 	// Also apply any speed limitation we want to place on the drone
-	UpdatedMaxAllowedSpeed(UEHoverDrone::ApplyDroneLimiters(GetOwner(), ControlAcceleration));
+	UpdatedMaxAllowedSpeed(UEHoverDrone::ApplyDroneLimiters(GetOwner(), ControlAcceleration, &LimiterQueryCache));
 	
 	// basic Z thrust exactly counteracts gravity
 	float ZThrust = -GetGravityZ();
@@ -510,7 +519,7 @@ void UHoverDroneMovementComponent::TickComponent(float DeltaTime, enum ELevelTic
 
 
 	// cache altitude
-	CurrentAltitude = MeasureAltitude(PawnOwner->GetActorLocation());
+	UpdateAltitude();
 
 	bResetInterpolation = false;
 }
@@ -601,7 +610,19 @@ void UHoverDroneMovementComponent::Init()
 	if (PawnOwner)
 	{
 		CurrentAltitude = MeasureAltitude(PawnOwner->GetActorLocation());
+		if (const UWorld* World = GetWorld())
+		{
+			LastAltitudeMeasureTime = World->GetTimeSeconds();
+		}
 		DirectRotationInputGoalRotation = UpdatedComponent->GetComponentRotation();
+
+		// Clear any in-flight rotation state so a reused or teleported drone holds its new
+		// transform instead of interpolating back toward goals captured before the move
+		RotVelocity = FRotator::ZeroRotator;
+		RotationInput = FRotator::ZeroRotator;
+		DirectRotationInput = FRotator::ZeroRotator;
+		bResetInterpolation = true;
+
 		MaxAllowedSpeedIndex = FMath::Clamp<>(MaxAllowedSpeedIndex, 0, DroneSpeedParameters.Num() - 1);
 		DroneSpeedParamIndex = FMath::Clamp<>(DroneSpeedParamIndex, 0, DroneSpeedParameters.Num() - 1);
 	}
@@ -637,6 +658,13 @@ void UHoverDroneMovementComponent::UpdatedMaxAllowedSpeed(int32 NewMaxAllowedSpe
 //#include "DrawDebugHelpers.h"
 float UHoverDroneMovementComponent::MeasureAltitude(FVector Location) const
 {
+	// another drone may have already probed this cell
+	float CachedGroundZ = 0.f;
+	if (UEHoverDrone::FindCachedGroundHeight(GetWorld(), Location, CachedGroundZ) && (Location.Z >= CachedGroundZ))
+	{
+		return Location.Z - CachedGroundZ;
+	}
+
 	FCollisionQueryParams TraceParams(SCENE_QUERY_STAT(Reverb_HoverDrone_MeasureAltitude), true, PawnOwner);
 	FHitResult Hit;
 
@@ -646,12 +674,77 @@ float UHoverDroneMovementComponent::MeasureAltitude(FVector Location) const
 	if (bHit)
 	{
 //		DrawDebugSphere(PawnOwner->GetWorld(), Hit.ImpactPoint, 30.f, 10, FColor::Yellow, false, 0.5f);
+		UEHoverDrone::CacheGroundHeight(GetWorld(), TraceStart, Hit.ImpactPoint.Z);
 		return (Hit.ImpactPoint - TraceStart).Size();
 	}
 
 	return 0.f;
 }
 
+void UHoverDroneMovementComponent::UpdateAltitude()
+{
+	UWorld* World = GetWorld();
+	const FVector Location = PawnOwner->GetActorLocation();
+
+	// serve from the shared cache first - drones flying over the same cell share a single probe
+	float CachedGroundZ = 0.f;
+	if (UEHoverDrone::FindCachedGroundHeight(World, Location, CachedGroundZ) && (Location.Z >= CachedGroundZ))
+	{
+		CurrentAltitude = Location.Z - CachedGroundZ;
+		LastAltitudeMeasureTime = World->GetTimeSeconds();
+		return;
+	}
+
+	if (!HoverDroneAsyncAltitudeTraces)
+	{
+		CurrentAltitude = MeasureAltitude(Location);
+		LastAltitudeMeasureTime = World->GetTimeSeconds();
+		return;
+	}
+
+	// kick off a trace for the completion delegate to consume, unless one is already in flight
+	if (!World->IsTraceHandleValid(PendingAltitudeTraceHandle, false))
+	{
+		FCollisionQueryParams TraceParams(SCENE_QUERY_STAT(Reverb_HoverDrone_MeasureAltitude), true, PawnOwner);
+
+		FVector const TraceStart = Location;
+		FVector const TraceEnd = TraceStart - FVector::UpVector * 100000.f;
+		PendingAltitudeTraceHandle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, TraceStart, TraceEnd, ECC_WorldStatic, TraceParams, FCollisionResponseParams::DefaultResponseParam, &AltitudeTraceDelegate);
+	}
+}
+
+void UHoverDroneMovementComponent::OnAltitudeTraceComplete(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	PendingAltitudeTraceHandle = FTraceHandle();
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	if (TraceDatum.OutHits.Num() > 0)
+	{
+		const FHitResult& Hit = TraceDatum.OutHits[0];
+		CurrentAltitude = (Hit.ImpactPoint - TraceDatum.Start).Size();
+		UEHoverDrone::CacheGroundHeight(World, TraceDatum.Start, Hit.ImpactPoint.Z);
+	}
+	else
+	{
+		// matches the synchronous behavior when there is no ground beneath us
+		CurrentAltitude = 0.f;
+	}
+
+	LastAltitudeMeasureTime = World->GetTimeSeconds();
+}
+
+float UHoverDroneMovementComponent::GetAltitude(float& OutStalenessSeconds) const
+{
+	const UWorld* World = GetWorld();
+	OutStalenessSeconds = (World && (LastAltitudeMeasureTime >= 0.f)) ? (World->GetTimeSeconds() - LastAltitudeMeasureTime) : 0.f;
+	return CurrentAltitude;
+}
+
 float UHoverDroneMovementComponent::GetInputFOVScale() const
 {
 	if (bUseFOVScaling)
@@ -743,7 +836,10 @@ void UHoverDroneMovementComponent::DrawDebug(UCanvas* Canvas, float& YL, float&
 		DebugString.Appendf(TEXT("MaintainHoverHeightTolerance: %f\n"), MaintainHoverHeightTolerance);
 		DebugString.Appendf(TEXT("MaintainHoverHeightPredictionTime: %f\n"), MaintainHoverHeightPredictionTime);
 		DebugString.Appendf(TEXT("DesiredHoverHeight: %f\n"), DesiredHoverHeight);
+		float AltitudeStaleness = 0.f;
+		GetAltitude(AltitudeStaleness);
 		DebugString.Appendf(TEXT("CurrentAltitude: %f\n"), CurrentAltitude);
+		DebugString.Appendf(TEXT("AltitudeStaleness: %f\n"), AltitudeStaleness);
 
 		YPos += 16;
 		YPos += Canvas->DrawText(RenderFont, DebugString.ToString(), 4, YPos);
@@ -10,8 +10,97 @@
 #include "Engine/GameInstance.h"
 #include "Engine/HitResult.h"
 
+float HoverDroneGroundCacheCellSize = 2000.f;
+FAutoConsoleVariableRef CVarHoverDroneGroundCacheCellSize(
+	TEXT("HoverDrone.GroundCacheCellSize"),
+	HoverDroneGroundCacheCellSize,
+	TEXT("Size in cm of the cells of the shared terrain height cache. Set to 0 to disable the cache.\n"),
+	ECVF_Default);
+
+float HoverDroneGroundCacheMaxAge = 0.25f;
+FAutoConsoleVariableRef CVarHoverDroneGroundCacheMaxAge(
+	TEXT("HoverDrone.GroundCacheMaxAge"),
+	HoverDroneGroundCacheMaxAge,
+	TEXT("Seconds a shared terrain height cache entry stays valid.\n"),
+	ECVF_Default);
+
+float HoverDroneVolumeQueryInnerMargin = 500.f;
+FAutoConsoleVariableRef CVarHoverDroneVolumeQueryInnerMargin(
+	TEXT("HoverDrone.VolumeQueryInnerMargin"),
+	HoverDroneVolumeQueryInnerMargin,
+	TEXT("Distance in cm the drone must keep from the edges of its resolved limiter volumes for the cached query result to be reused. 0 disables reuse.\n"),
+	ECVF_Default);
+
 namespace UEHoverDrone
 {
+	struct FCachedGroundHeight
+	{
+		float GroundZ = 0.f;
+		float Timestamp = 0.f;
+	};
+
+	// Cache shared by all drones, keyed by 2D cell. Only ever touched from the game thread.
+	static TMap<FIntPoint, FCachedGroundHeight> GroundHeightCache;
+	static TWeakObjectPtr<const UWorld> GroundHeightCacheWorld;
+
+	static FIntPoint GroundCacheCell(const FVector& Location)
+	{
+		const float CellSize = FMath::Max(HoverDroneGroundCacheCellSize, 1.f);
+		return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+	}
+
+	// Drops the cache whenever the world changes so stale heights never leak across worlds
+	static bool PrepareGroundHeightCache(const UWorld* World)
+	{
+		if (!World || HoverDroneGroundCacheCellSize <= 0.f)
+		{
+			return false;
+		}
+
+		if (GroundHeightCacheWorld.Get() != World)
+		{
+			GroundHeightCache.Reset();
+			GroundHeightCacheWorld = World;
+		}
+
+		return true;
+	}
+
+	bool FindCachedGroundHeight(const UWorld* World, const FVector& Location, float& OutGroundZ)
+	{
+		if (!PrepareGroundHeightCache(World))
+		{
+			return false;
+		}
+
+		const FIntPoint Cell = GroundCacheCell(Location);
+		if (const FCachedGroundHeight* CachedHeight = GroundHeightCache.Find(Cell))
+		{
+			if ((World->GetTimeSeconds() - CachedHeight->Timestamp) <= HoverDroneGroundCacheMaxAge)
+			{
+				OutGroundZ = CachedHeight->GroundZ;
+				return true;
+			}
+
+			// entry went stale, drop it
+			GroundHeightCache.Remove(Cell);
+		}
+
+		return false;
+	}
+
+	void CacheGroundHeight(const UWorld* World, const FVector& Location, float GroundZ)
+	{
+		if (!PrepareGroundHeightCache(World))
+		{
+			return;
+		}
+
+		FCachedGroundHeight& CachedHeight = GroundHeightCache.FindOrAdd(GroundCacheCell(Location));
+		CachedHeight.GroundZ = GroundZ;
+		CachedHeight.Timestamp = World->GetTimeSeconds();
+	}
+
 	float MeasureAltitude(const AActor* Actor, FVector Offset)
 	{
 		if (Actor)
@@ -55,25 +144,8 @@ namespace UEHoverDrone
 		}
 	}
 
-	template<typename T>
-	void FindClosestVolume(const TSet<T*>& Volumes, const FVector PlayerLoc, float& OutDistance, const T*& OutVolume)
-	{
-		for (const T* DroneVolume : Volumes)
-		{
-			const FBox TestBox = DroneVolume->GetBounds().GetBox();
-			const FVector ClosestPoint = TestBox.GetClosestPointTo(PlayerLoc);
-			const float TestDistance = FVector::Distance(PlayerLoc, ClosestPoint);
-
-			if (TestDistance < OutDistance)
-			{
-				OutDistance = TestDistance;
-				OutVolume = DroneVolume;
-			}
-		}
-	};
-	
 	// TODO: This feels like it belongs in the Simulation.
-	int32 ApplyDroneLimiters(const AActor* Actor, FVector& ControlAcceleration)
+	int32 ApplyDroneLimiters(const AActor* Actor, FVector& ControlAcceleration, FDroneLimiterQueryCache* QueryCache)
 	{
 		if (!Actor)
 		{
@@ -91,39 +163,46 @@ namespace UEHoverDrone
 
 		FVector const PlayerLoc = Actor->GetActorLocation();
 
+		// fast path - while the drone stays inside the inner margin of the volumes it resolved
+		// against last time, the cached answer still holds and no clamping can apply
+		if (QueryCache
+			&& QueryCache->bValid
+			&& QueryCache->VolumeSetSerial == VolumeManager->GetVolumeSetSerial()
+			&& QueryCache->SpeedLimitInnerBounds.IsInsideOrOn(PlayerLoc)
+			&& (!QueryCache->bHasBlockingVolume || QueryCache->BlockingInnerBounds.IsInsideOrOn(PlayerLoc)))
+		{
+			return QueryCache->MaxAllowedSpeedIndex;
+		}
+
 		// @todo: On any future project we'll benefit from housing all functionality in a single volume type. This late in the Reverb game, we don't want to update
 		// all existing blocking volumes to a new class (and we can't add the speed limiter variable to the existing one), so we add a second kind of volume,
-		// which makes the logic more involved. 
-		const ABlockingVolume* ClosestBlockVolume = nullptr;
-		const AHoverDroneSpeedLimitBox* ClosestSpeedLimitBox = nullptr;
-		float ClosestBlockDistance = FLT_MAX;
-		float ClosestSpeedLimitDistance = FLT_MAX;
-
-		FindClosestVolume<>(VolumeManager->GetSpeedLimitBoxes(), PlayerLoc, ClosestSpeedLimitDistance, ClosestSpeedLimitBox);
-		FindClosestVolume<>(VolumeManager->GetBlockingVolumes(), PlayerLoc, ClosestBlockDistance, ClosestBlockVolume);
+		// which makes the logic more involved.
+		FBox BlockingBounds(ForceInit);
+		const ABlockingVolume* ClosestBlockVolume = VolumeManager->FindClosestBlockingVolume(PlayerLoc, BlockingBounds);
 
 		if (ClosestBlockVolume)
 		{
-			const FBox Bounds = ClosestBlockVolume->GetBounds().GetBox();
-			LimitControlAccelOnAxis(ControlAcceleration.X, PlayerLoc.X, Bounds.Min.X, Bounds.Max.X);
-			LimitControlAccelOnAxis(ControlAcceleration.Y, PlayerLoc.Y, Bounds.Min.Y, Bounds.Max.Y);
-			LimitControlAccelOnAxis(ControlAcceleration.Z, PlayerLoc.Z, Bounds.Min.Z, Bounds.Max.Z);
+			LimitControlAccelOnAxis(ControlAcceleration.X, PlayerLoc.X, BlockingBounds.Min.X, BlockingBounds.Max.X);
+			LimitControlAccelOnAxis(ControlAcceleration.Y, PlayerLoc.Y, BlockingBounds.Min.Y, BlockingBounds.Max.Y);
+			LimitControlAccelOnAxis(ControlAcceleration.Z, PlayerLoc.Z, BlockingBounds.Min.Z, BlockingBounds.Max.Z);
 		}
 
-		if (ClosestSpeedLimitBox)
-		{
-			TArray<AActor*> LimitBoxOverlaps;
-			ClosestSpeedLimitBox->GetOverlappingActors(LimitBoxOverlaps, Actor->GetClass());
+		FBox SpeedLimitBounds(ForceInit);
+		const AHoverDroneSpeedLimitBox* SpeedLimitBox = VolumeManager->FindSpeedLimitBoxAtLocation(PlayerLoc, SpeedLimitBounds);
+		const int32 MaxAllowedSpeedIndex = SpeedLimitBox ? SpeedLimitBox->MaxAllowedSpeedIndex : INDEX_NONE;
 
-			for (AActor* OverlappedActor : LimitBoxOverlaps)
-			{
-				if (OverlappedActor == Actor)
-				{
-					return ClosestSpeedLimitBox->MaxAllowedSpeedIndex;
-				}
-			}
+		if (QueryCache)
+		{
+			QueryCache->VolumeSetSerial = VolumeManager->GetVolumeSetSerial();
+			QueryCache->MaxAllowedSpeedIndex = MaxAllowedSpeedIndex;
+			QueryCache->bHasBlockingVolume = ClosestBlockVolume != nullptr;
+			QueryCache->SpeedLimitInnerBounds = SpeedLimitBounds.ExpandBy(-HoverDroneVolumeQueryInnerMargin);
+			QueryCache->BlockingInnerBounds = BlockingBounds.ExpandBy(-HoverDroneVolumeQueryInnerMargin);
+
+			// only reusable once the drone has actually resolved to a containing box
+			QueryCache->bValid = (SpeedLimitBox != nullptr) && (HoverDroneVolumeQueryInnerMargin > 0.f);
 		}
 
-		return INDEX_NONE;
+		return MaxAllowedSpeedIndex;
 	}
 }
\ No newline at end of file
@@ -10,6 +10,155 @@
 
 static const FName HoverDroneVolumeTag("Drone");
 
+float HoverDroneVolumeGridCellSize = 10000.f;
+FAutoConsoleVariableRef CVarHoverDroneVolumeGridCellSize(
+	TEXT("HoverDrone.VolumeGridCellSize"),
+	HoverDroneVolumeGridCellSize,
+	TEXT("Size in cm of the cells of the drone volume spatial index.\n"),
+	ECVF_Default);
+
+// Volumes overlapping more cells than this go to the always-tested list instead of bloating the grid
+static const int32 MaxVolumeGridCellsPerEntry = 256;
+
+void UHoverDroneVolumeManager::FVolumeGrid::Reset()
+{
+	Entries.Reset();
+	Cells.Reset();
+	OversizedEntries.Reset();
+}
+
+void UHoverDroneVolumeManager::FVolumeGrid::Add(AActor* Volume, const FBox& Bounds)
+{
+	const int32 EntryIndex = Entries.Num();
+	FEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Bounds = Bounds;
+	Entry.Volume = Volume;
+
+	const float CellSize = FMath::Max(HoverDroneVolumeGridCellSize, 1.f);
+	const int32 MinCellX = FMath::FloorToInt(Bounds.Min.X / CellSize);
+	const int32 MinCellY = FMath::FloorToInt(Bounds.Min.Y / CellSize);
+	const int32 MaxCellX = FMath::FloorToInt(Bounds.Max.X / CellSize);
+	const int32 MaxCellY = FMath::FloorToInt(Bounds.Max.Y / CellSize);
+
+	const int64 CellCount = (int64)(MaxCellX - MinCellX + 1) * (int64)(MaxCellY - MinCellY + 1);
+	if (CellCount > MaxVolumeGridCellsPerEntry)
+	{
+		OversizedEntries.Add(EntryIndex);
+		return;
+	}
+
+	for (int32 CellY = MinCellY; CellY <= MaxCellY; ++CellY)
+	{
+		for (int32 CellX = MinCellX; CellX <= MaxCellX; ++CellX)
+		{
+			Cells.FindOrAdd(FIntPoint(CellX, CellY)).Add(EntryIndex);
+		}
+	}
+}
+
+AActor* UHoverDroneVolumeManager::FVolumeGrid::FindContaining(const FVector& Location, FBox& OutBounds) const
+{
+	const float CellSize = FMath::Max(HoverDroneVolumeGridCellSize, 1.f);
+	const FIntPoint Cell(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+
+	if (const TArray<int32>* CellEntries = Cells.Find(Cell))
+	{
+		for (int32 EntryIndex : *CellEntries)
+		{
+			const FEntry& Entry = Entries[EntryIndex];
+			if (Entry.Bounds.IsInsideOrOn(Location))
+			{
+				OutBounds = Entry.Bounds;
+				return Entry.Volume;
+			}
+		}
+	}
+
+	for (int32 EntryIndex : OversizedEntries)
+	{
+		const FEntry& Entry = Entries[EntryIndex];
+		if (Entry.Bounds.IsInsideOrOn(Location))
+		{
+			OutBounds = Entry.Bounds;
+			return Entry.Volume;
+		}
+	}
+
+	return nullptr;
+}
+
+AActor* UHoverDroneVolumeManager::FVolumeGrid::FindClosest(const FVector& Location, FBox& OutBounds) const
+{
+	// the common case is being inside a volume, which the grid answers directly
+	if (AActor* ContainingVolume = FindContaining(Location, OutBounds))
+	{
+		return ContainingVolume;
+	}
+
+	// outside everything - scan the cached bounds (no actor calls) for the nearest one
+	AActor* ClosestVolume = nullptr;
+	FVector::FReal ClosestDistanceSq = FLT_MAX;
+
+	for (const FEntry& Entry : Entries)
+	{
+		const FVector::FReal TestDistanceSq = Entry.Bounds.ComputeSquaredDistanceToPoint(Location);
+		if (TestDistanceSq < ClosestDistanceSq)
+		{
+			ClosestDistanceSq = TestDistanceSq;
+			ClosestVolume = Entry.Volume;
+			OutBounds = Entry.Bounds;
+		}
+	}
+
+	return ClosestVolume;
+}
+
+AHoverDroneSpeedLimitBox* UHoverDroneVolumeManager::FindSpeedLimitBoxAtLocation(const FVector& Location, FBox& OutBounds)
+{
+	ConditionalRebuildVolumeGrids();
+	return Cast<AHoverDroneSpeedLimitBox>(SpeedLimitBoxGrid.FindContaining(Location, OutBounds));
+}
+
+ABlockingVolume* UHoverDroneVolumeManager::FindClosestBlockingVolume(const FVector& Location, FBox& OutBounds)
+{
+	ConditionalRebuildVolumeGrids();
+	return Cast<ABlockingVolume>(BlockingVolumeGrid.FindClosest(Location, OutBounds));
+}
+
+void UHoverDroneVolumeManager::MarkVolumeGridsDirty()
+{
+	bVolumeGridsDirty = true;
+	++VolumeSetSerial;
+}
+
+void UHoverDroneVolumeManager::ConditionalRebuildVolumeGrids()
+{
+	if (!bVolumeGridsDirty)
+	{
+		return;
+	}
+
+	SpeedLimitBoxGrid.Reset();
+	for (AHoverDroneSpeedLimitBox* SpeedLimitBox : SpeedLimitBoxes)
+	{
+		if (IsValid(SpeedLimitBox))
+		{
+			SpeedLimitBoxGrid.Add(SpeedLimitBox, SpeedLimitBox->GetBounds().GetBox());
+		}
+	}
+
+	BlockingVolumeGrid.Reset();
+	for (ABlockingVolume* BlockingVolume : BlockingVolumes)
+	{
+		if (IsValid(BlockingVolume))
+		{
+			BlockingVolumeGrid.Add(BlockingVolume, BlockingVolume->GetBounds().GetBox());
+		}
+	}
+
+	bVolumeGridsDirty = false;
+}
+
 void UHoverDroneVolumeManager::Initialize(FSubsystemCollectionBase& Collection)
 {
 	OnLevelRemovedFromWorldHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &ThisClass::OnLevelRemovedFromWorld);
@@ -35,12 +184,15 @@ void UHoverDroneVolumeManager::Initialize(FSubsystemCollectionBase& Collection)
 			SpeedLimitBoxes.Add(Actor);
 		}
 	}
+
+	MarkVolumeGridsDirty();
 }
 
 void UHoverDroneVolumeManager::Deinitialize()
 {
 	SpeedLimitBoxes.Empty();
 	BlockingVolumes.Empty();
+	MarkVolumeGridsDirty();
 
 	FWorldDelegates::LevelRemovedFromWorld.Remove(OnLevelRemovedFromWorldHandle);
 	FWorldDelegates::LevelAddedToWorld.Remove(OnLevelAddedToWorldHandle);
@@ -68,6 +220,8 @@ void UHoverDroneVolumeManager::PostGarbageCollect()
 			It.RemoveCurrent();
 		}
 	}
+
+	MarkVolumeGridsDirty();
 }
 
 void UHoverDroneVolumeManager::OnLevelRemovedFromWorld(class ULevel* Level, class UWorld* World)
@@ -92,6 +246,8 @@ void UHoverDroneVolumeManager::OnLevelRemovedFromWorld(class ULevel* Level, clas
 			It.RemoveCurrent();
 		}
 	}
+
+	MarkVolumeGridsDirty();
 }
 
 void UHoverDroneVolumeManager::OnLevelAddedToWorld(class ULevel* Level, class UWorld* World)
@@ -5,6 +5,8 @@
 #include "GameFramework/FloatingPawnMovement.h"
 #include "GameFramework/SpectatorPawnMovement.h"
 #include "HoverDroneTypes.h"
+#include "HoverDroneUtils.h"
+#include "WorldCollision.h"
 #include "HoverDroneMovementComponent.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FMaxAllowedSpeedUpdated);
@@ -63,11 +65,19 @@ public:
 	/** Returns height above the ground. */
 	float GetAltitude() const { return CurrentAltitude; };
 
+	/**
+	 * Returns height above the ground along with how long ago, in seconds, it was measured.
+	 * Async altitude traces and the shared terrain height cache can serve results that are a
+	 * few frames old; consumers that care about staleness should use this overload.
+	 */
+	float GetAltitude(float& OutStalenessSeconds) const;
+
 	/** Turbo controls */
 	void SetTurbo(bool bNewTurbo) { bTurbo = bNewTurbo; };
 	bool IsTurbo() { return bTurbo; };
 
-	/** Call when switch to this to do internal setup */
+	/** Call when switch to this to do internal setup. Also runs on teleport, anchoring the
+	 *  rotation goals to the new transform so a reused drone behaves like a fresh spawn. */
 	void Init();
 
 	FVector MeasuredVelocity;
@@ -241,6 +251,21 @@ private:
 
 	float MeasureAltitude(FVector Location) const;
 
+	/** Refreshes CurrentAltitude, either synchronously or by kicking off an async trace whose result is consumed next frame. */
+	void UpdateAltitude();
+
+	/** Consumes the async altitude trace result. */
+	void OnAltitudeTraceComplete(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
+	FTraceDelegate AltitudeTraceDelegate;
+	FTraceHandle PendingAltitudeTraceHandle;
+
+	/** Cached limiter volume query results, reused while we stay inside the resolved volumes. */
+	UEHoverDrone::FDroneLimiterQueryCache LimiterQueryCache;
+
+	/** World time when CurrentAltitude was last measured, negative until the first measurement. */
+	float LastAltitudeMeasureTime = -1.f;
+
 	float GetInputFOVScale() const;
 
 	/**FOV the movement component is currently scaling input for */
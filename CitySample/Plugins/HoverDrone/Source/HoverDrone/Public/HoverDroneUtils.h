@@ -6,9 +6,48 @@
 #include "Math/Vector.h"
 
 class AActor;
+class UWorld;
 
 namespace UEHoverDrone
 {
+	/**
+	 * Per-drone cache of the last limiter volume query. While the drone stays inside the inner
+	 * margin of the volumes it last resolved against, ApplyDroneLimiters reuses the cached result
+	 * instead of requerying the volume manager.
+	 */
+	struct HOVERDRONE_API FDroneLimiterQueryCache
+	{
+		/** Volume set serial the cached result was computed against, @see UHoverDroneVolumeManager::GetVolumeSetSerial */
+		uint32 VolumeSetSerial = MAX_uint32;
+
+		/** True when the cached result can be reused at all (the drone resolved to a containing speed limit box). */
+		bool bValid = false;
+
+		/** True when a blocking volume was found; the cache is only reusable inside its inner bounds, where no clamping happens. */
+		bool bHasBlockingVolume = false;
+
+		/** Cached speed index from the containing speed limit box. */
+		int32 MaxAllowedSpeedIndex = INDEX_NONE;
+
+		/** Containing speed limit box bounds, shrunk by the reuse margin. */
+		FBox SpeedLimitInnerBounds = FBox(ForceInit);
+
+		/** Closest blocking volume bounds, shrunk by the reuse margin. */
+		FBox BlockingInnerBounds = FBox(ForceInit);
+	};
+
 	float HOVERDRONE_API MeasureAltitude(const AActor* Actor, FVector Offset = FVector(ForceInitToZero));
-	int32 HOVERDRONE_API ApplyDroneLimiters(const AActor* Actor, FVector& ControlAcceleration);
+	int32 HOVERDRONE_API ApplyDroneLimiters(const AActor* Actor, FVector& ControlAcceleration, FDroneLimiterQueryCache* QueryCache = nullptr);
+
+	/**
+	 * Shared terrain height cache. Ground probe results are bucketed into 2D cells and reused by
+	 * every drone in the world, so several drones flying over the same area contend on the physics
+	 * scene once per cell rather than once per drone.
+	 */
+
+	/** Looks up the cached ground height for the cell containing Location. Returns false if there is no fresh entry. */
+	bool HOVERDRONE_API FindCachedGroundHeight(const UWorld* World, const FVector& Location, float& OutGroundZ);
+
+	/** Stores a measured ground height for the cell containing Location. */
+	void HOVERDRONE_API CacheGroundHeight(const UWorld* World, const FVector& Location, float GroundZ);
 }
\ No newline at end of file
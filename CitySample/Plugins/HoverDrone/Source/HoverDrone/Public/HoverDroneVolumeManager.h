@@ -22,6 +22,18 @@ public:
 		return BlockingVolumes;
 	}
 
+	/** Returns the speed limit box whose bounds contain Location (or null), using the cell grid so the cost doesn't scale with the number of registered boxes. */
+	class AHoverDroneSpeedLimitBox* FindSpeedLimitBoxAtLocation(const FVector& Location, FBox& OutBounds);
+
+	/** Returns the registered blocking volume nearest to Location (or null) along with its cached bounds. Containment is answered from the cell grid; only when the location is outside every volume do we fall back to a scan over the cached bounds. */
+	class ABlockingVolume* FindClosestBlockingVolume(const FVector& Location, FBox& OutBounds);
+
+	/** Bumped whenever the registered volume set changes, so per-drone query caches know when to invalidate. */
+	uint32 GetVolumeSetSerial() const
+	{
+		return VolumeSetSerial;
+	}
+
 	//~ Begin USubsystem Interface
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
@@ -33,6 +45,40 @@ private:
 	void OnLevelAddedToWorld(class ULevel* Level, class UWorld* World);
 	void PostGarbageCollect();
 
+	/**
+	 * Static spatial index over the registered volumes - cached AABBs bucketed into a uniform XY
+	 * cell grid. Built when the volume set changes so per-tick containment queries don't iterate
+	 * (or call into) every registered actor.
+	 */
+	struct FVolumeGrid
+	{
+		void Reset();
+		void Add(AActor* Volume, const FBox& Bounds);
+		AActor* FindContaining(const FVector& Location, FBox& OutBounds) const;
+		AActor* FindClosest(const FVector& Location, FBox& OutBounds) const;
+
+	private:
+		struct FEntry
+		{
+			FBox Bounds = FBox(ForceInit);
+			AActor* Volume = nullptr;
+		};
+
+		TArray<FEntry> Entries;
+		TMap<FIntPoint, TArray<int32>> Cells;
+
+		/** Volumes spanning too many cells to be worth bucketing; tested on every query. */
+		TArray<int32> OversizedEntries;
+	};
+
+	void MarkVolumeGridsDirty();
+	void ConditionalRebuildVolumeGrids();
+
+	FVolumeGrid SpeedLimitBoxGrid;
+	FVolumeGrid BlockingVolumeGrid;
+	bool bVolumeGridsDirty = true;
+	uint32 VolumeSetSerial = 0;
+
 	UPROPERTY(Transient)
 	TSet<class AHoverDroneSpeedLimitBox*> SpeedLimitBoxes;
 
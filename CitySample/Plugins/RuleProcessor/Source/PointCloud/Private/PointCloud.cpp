@@ -51,6 +51,54 @@ bool UPointCloud::LoadFromPoints(const TArray<FPointCloudPoint>& InPoints)
 	return LoadFromStructuredPoints(InPoints, FBox(EForceInit::ForceInit));
 }
 
+void UPointCloud::MarkRegionDirty(const FBox& InRegion)
+{
+	// Cap the number of tracked regions by folding the two oldest entries together. The merged entry keeps
+	// the newer of the two revisions, so any "untouched since" query older than that revision conservatively
+	// sees the merged region
+	const int32 MaxTrackedDirtyRegions = 64;
+
+	ImportRevisionNumber++;
+
+	FPointCloudDirtyRegion& NewRegion = DirtyRegions.Emplace_GetRef();
+	NewRegion.ImportRevisionNumber = ImportRevisionNumber;
+	NewRegion.Region = InRegion;
+
+	if (DirtyRegions.Num() > MaxTrackedDirtyRegions)
+	{
+		if (DirtyRegions[0].Region.IsValid && DirtyRegions[1].Region.IsValid)
+		{
+			DirtyRegions[1].Region += DirtyRegions[0].Region;
+		}
+		else
+		{
+			// Either of the merged entries standing for the whole cloud makes the merged entry do so too
+			DirtyRegions[1].Region = FBox(EForceInit::ForceInit);
+		}
+
+		DirtyRegions.RemoveAt(0);
+	}
+}
+
+bool UPointCloud::IsRegionUntouchedSince(const FBox& InRegion, uint64 InImportRevisionNumber) const
+{
+	for (const FPointCloudDirtyRegion& DirtyRegion : DirtyRegions)
+	{
+		if (DirtyRegion.ImportRevisionNumber <= InImportRevisionNumber)
+		{
+			continue;
+		}
+
+		// An invalid box on either side stands for the whole cloud
+		if (!DirtyRegion.Region.IsValid || !InRegion.IsValid || DirtyRegion.Region.Intersect(InRegion))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 void UPointCloud::ClearRootViews()
 {
 	for (UPointCloudView* View : RootViews)
@@ -297,13 +297,15 @@ void ParseAlembicObject(const Alembic::Abc::IObject& InObject, TArray<FTransform
 					Alembic::Abc::StringArraySamplePtr SamplePtr = Param.getExpandedValue().getVals();
 
 					TArray<FString> Values;
-					for (uint32 PointIndex = 0; PointIndex < NumPoints; PointIndex++) {
+					Values.SetNum(NumPoints);
+					ParallelFor(int32(NumPoints), [&](int32 PointIndex)
+					{
 						Alembic::Abc::StringArraySample::value_type Value = (*SamplePtr)[PointIndex];
-						Values.Add(Value.c_str());
-					}
+						Values[PointIndex] = Value.c_str();
+					});
 
 					OutMetadataColumnNames.Add(PropName);
-					OutMetadataValues.Add(PropName, Values);
+					OutMetadataValues.Add(PropName, MoveTemp(Values));
 				}
 				break;
 				default:
@@ -316,8 +318,11 @@ void ParseAlembicObject(const Alembic::Abc::IObject& InObject, TArray<FTransform
 			}
 		}
 
-		// default properties
-		for (uint32 PointIndex = 0; PointIndex < NumPoints; PointIndex++)
+		// default properties. Built into a staging array in parallel, then merged onto the
+		// accumulated transforms so multiple point objects in one archive still append in order.
+		TArray<FTransform> StagedTransforms;
+		StagedTransforms.SetNum(NumPoints);
+		ParallelFor(int32(NumPoints), [&](int32 PointIndex)
 		{
 			Alembic::Abc::P3fArraySample::value_type Position = (*Positions)[PointIndex];
 
@@ -345,9 +350,10 @@ void ParseAlembicObject(const Alembic::Abc::IObject& InObject, TArray<FTransform
 				Scale = FVector(Scalex, Scalez, Scaley);
 			}
 
-			FTransform Transform = FTransform(Ori, Pos, Scale);
-			OutPreparedTransforms.Add(Transform);
-		}
+			StagedTransforms[PointIndex] = FTransform(Ori, Pos, Scale);
+		});
+
+		OutPreparedTransforms.Append(MoveTemp(StagedTransforms));
 	}
 
 	if (NumChildren > 0)
@@ -4,6 +4,9 @@
 #include "PointCloud.h"
 #include "PointCloudUtils.h"
 #include "Runtime/Core/Public/Async/ParallelFor.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FeedbackContext.h"
 #include "Misc/FileHelper.h"
 
 #define LOCTEXT_NAMESPACE "PointCloudCsv"
@@ -97,13 +100,236 @@ FPointCloudCsv::FPointCloudCsv(const TArray<FString> &InStrings, FFeedbackContex
 	Timer.Report(TEXT("Process PSV"));
 }
 				
-FPointCloudCsv FPointCloudCsv::Open(const FString& Name, FFeedbackContext* Warn)
+FPointCloudCsv::FPointCloudCsv(const ANSICHAR* InData, int64 InSize, FFeedbackContext* Warn)
 {
-	TArray<FString> InStrings;
+	PointCloud::UtilityTimer Timer;
+	IsOpen = true;
+
+	if (InData == nullptr || InSize <= 0)
+	{
+		UE_LOG(PointCloudLog, Warning, TEXT("Malformed CSV. Empty File\n"));
+		IsOpen = false;
+		return;
+	}
+
+	// Skip over a UTF-8 byte order mark if the file starts with one
+	if (InSize >= 3 && (uint8)InData[0] == 0xEF && (uint8)InData[1] == 0xBB && (uint8)InData[2] == 0xBF)
+	{
+		InData += 3;
+		InSize -= 3;
+	}
+
+	// Find the end of the column headers line
+	int64 HeaderEnd = 0;
+	while (HeaderEnd < InSize && InData[HeaderEnd] != '\n')
+	{
+		++HeaderEnd;
+	}
+
+	// if we don't have at least the column names line and one data line, consider this file invalid
+	if (HeaderEnd >= InSize)
+	{
+		UE_LOG(PointCloudLog, Warning, TEXT("Malformed CSV. Less than 2 Lines\n"));
+		IsOpen = false;
+		return;
+	}
+
+	const int64 HeaderLength = (HeaderEnd > 0 && InData[HeaderEnd - 1] == '\r') ? HeaderEnd - 1 : HeaderEnd;
+
+	FUTF8ToTCHAR ConvertedHeader(InData, (int32)HeaderLength);
+	const FString HeaderLine = FString::ConstructFromPtrSize(ConvertedHeader.Get(), ConvertedHeader.Length());
+
+	// read in the column names
+	if (HeaderLine.ParseIntoArray(ColumnNames, TEXT(","), true) == 0)
+	{
+		// if we don't have at least one column name then consider this file invalid
+		UE_LOG(PointCloudLog, Warning, TEXT("Malformed CSV. Cannot Read Column Names From Line 0\n"));
+		IsOpen = false;
+		return;
+	}
+
+	// Cache the number of columns
+	const int32 ColumnCount = GetColumnCount();
+
+	// Divide the data lines into ranges that each start on a line boundary and end just after one.
+	// Each range is parsed by one worker into its own column buffers, so the workers never contend
+	const int64 DataStart = HeaderEnd + 1;
+	const int64 DataSize = InSize - DataStart;
+
+	if (DataSize <= 0)
+	{
+		UE_LOG(PointCloudLog, Warning, TEXT("Malformed CSV. Less than 2 Lines\n"));
+		IsOpen = false;
+		return;
+	}
+
+	const int64 MinBytesPerRange = 1024 * 1024;
+	const int32 NumWorkers = FMath::Max(1, FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+	const int32 NumRanges = (int32)FMath::Clamp<int64>(DataSize / MinBytesPerRange, 1, (int64)NumWorkers * 8);
+	const int64 IdealRangeSize = FMath::Max<int64>(1, DataSize / NumRanges);
+
+	struct FLineRange
+	{
+		int64 Start = 0;
+		int64 End = 0;
+	};
+
+	TArray<FLineRange> Ranges;
+	Ranges.Reserve(NumRanges);
+
+	int64 RangeStart = DataStart;
+
+	while (RangeStart < InSize)
+	{
+		int64 RangeEnd = FMath::Min(RangeStart + IdealRangeSize, InSize);
+
+		while (RangeEnd < InSize && InData[RangeEnd - 1] != '\n')
+		{
+			++RangeEnd;
+		}
+
+		Ranges.Add({ RangeStart, RangeEnd });
+		RangeStart = RangeEnd;
+	}
+
+	struct FParsedRange
+	{
+		TArray<TArray<FString>> Columns;
+	};
+
+	TArray<FParsedRange> ParsedRanges;
+	ParsedRanges.SetNum(Ranges.Num());
+
+	// Parse the ranges in batches of one range per worker, which leaves a point between batches to
+	// report progress against the number of bytes consumed and to honor a cancel request
+	for (int32 BatchStart = 0; BatchStart < Ranges.Num(); BatchStart += NumWorkers)
+	{
+		const int32 BatchCount = FMath::Min(NumWorkers, Ranges.Num() - BatchStart);
 
+		ParallelFor(BatchCount, [&](int32 BatchIndex)
+		{
+			const int32 RangeIndex = BatchStart + BatchIndex;
+			const FLineRange& Range = Ranges[RangeIndex];
+			FParsedRange& Parsed = ParsedRanges[RangeIndex];
+
+			Parsed.Columns.SetNum(ColumnCount);
+
+			TArray<FString> Values;
+
+			int64 LineStart = Range.Start;
+
+			while (LineStart < Range.End)
+			{
+				int64 LineEnd = LineStart;
+
+				while (LineEnd < Range.End && InData[LineEnd] != '\n')
+				{
+					++LineEnd;
+				}
+
+				int64 LineLength = LineEnd - LineStart;
+
+				if (LineLength > 0 && InData[LineStart + LineLength - 1] == '\r')
+				{
+					--LineLength;
+				}
+
+				// Silently skip blank lines, such as the one produced by a trailing newline at the end of the file
+				if (LineLength > 0)
+				{
+					FUTF8ToTCHAR ConvertedLine(InData + LineStart, (int32)LineLength);
+					const FString Line = FString::ConstructFromPtrSize(ConvertedLine.Get(), ConvertedLine.Length());
+
+					if (Line.ParseIntoArray(Values, TEXT(","), false) != ColumnCount)
+					{
+						// malformed line
+						UE_LOG(PointCloudLog, Warning, TEXT("Malformed CSV Line At Offset %lld\n"), LineStart);
+					}
+					else
+					{
+						// Add each of the values to the relevant column record
+						for (int32 c = 0; c < ColumnCount; c++)
+						{
+							// Use Move Semanics to Avoid a copy into the Column record
+							Parsed.Columns[c].Add(MoveTemp(Values[c]));
+						}
+					}
+				}
+
+				LineStart = LineEnd + 1;
+			}
+		});
+
+		if (Warn)
+		{
+			const int64 BytesConsumed = Ranges[BatchStart + BatchCount - 1].End - DataStart;
+			Warn->UpdateProgress((int32)(100 * BytesConsumed / FMath::Max<int64>(1, DataSize)), 100);
+
+			if (Warn->ReceivedUserCancel())
+			{
+				UE_LOG(PointCloudLog, Warning, TEXT("CSV import cancelled by user\n"));
+				IsOpen = false;
+				return;
+			}
+		}
+	}
+
+	// Stitch the per-worker column buffers together in file order
+	RowCount = 0;
+
+	for (const FParsedRange& Parsed : ParsedRanges)
+	{
+		if (Parsed.Columns.Num() == ColumnCount)
+		{
+			RowCount += Parsed.Columns[0].Num();
+		}
+	}
+
+	for (int32 c = 0; c < ColumnCount; c++)
+	{
+		TArray<FString>& Column = Columns.FindOrAdd(GetColumnName(c));
+		Column.Reserve(RowCount);
+
+		for (FParsedRange& Parsed : ParsedRanges)
+		{
+			if (Parsed.Columns.Num() == ColumnCount)
+			{
+				Column.Append(MoveTemp(Parsed.Columns[c]));
+			}
+		}
+	}
+
+	UE_LOG(PointCloudLog, Log, TEXT("Row Count %d\n"), RowCount);
+
+	Timer.Report(TEXT("Process PSV"));
+}
+
+FPointCloudCsv FPointCloudCsv::Open(const FString& Name, FFeedbackContext* Warn)
+{
 	PointCloud::UtilityTimer Timer;
-						
-	if (!FFileHelper::LoadANSITextFileToStrings(*Name, nullptr, InStrings))
+
+	// Map the file rather than reading it; the workers below parse straight out of the mapping,
+	// which avoids materializing a second multi-gigabyte copy of a large import file
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	TUniquePtr<IMappedFileHandle> MappedFile(PlatformFile.OpenMapped(*Name));
+
+	if (MappedFile)
+	{
+		TUniquePtr<IMappedFileRegion> MappedRegion(MappedFile->MapRegion());
+
+		if (MappedRegion)
+		{
+			Timer.Report(TEXT("Map PSV From Disk"));
+
+			return FPointCloudCsv(reinterpret_cast<const ANSICHAR*>(MappedRegion->GetMappedPtr()), MappedRegion->GetMappedSize(), Warn);
+		}
+	}
+
+	// Not every platform file layer supports mapping, so fall back to reading the file into memory
+	TArray64<uint8> FileContents;
+
+	if (!FFileHelper::LoadFileToArray(FileContents, *Name))
 	{
 		UE_LOG(PointCloudLog, Warning, TEXT("Cannot open file CSV: %s\n"), *Name);
 		return FPointCloudCsv();
@@ -111,7 +337,7 @@ FPointCloudCsv FPointCloudCsv::Open(const FString& Name, FFeedbackContext* Warn)
 
 	Timer.Report(TEXT("Load PSV From Disk"));
 
-	return FPointCloudCsv(InStrings,Warn);
+	return FPointCloudCsv(reinterpret_cast<const ANSICHAR*>(FileContents.GetData()), FileContents.Num(), Warn);
 }
 
 bool FPointCloudCsv::GetIsOpen()
@@ -3,6 +3,8 @@
 #include "PointCloudImpl.h"
 
 #include "Algo/AnyOf.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
 #include "HAL/PlatformFileManager.h"
 #include "IncludeSQLite.h"
 #include "Misc/FeedbackContext.h"
@@ -28,6 +30,34 @@ THIRD_PARTY_INCLUDES_END
 DEFINE_LOG_CATEGORY(PointCloudLog)
 #define LOCTEXT_NAMESPACE "PointCloudImpl"
 
+static TAutoConsoleVariable<int32> CVarRuleProcessorDiskQueryCache(
+	TEXT("t.RuleProcessor.DiskQueryCache"),
+	1,
+	TEXT("If non-zero, filter query result tables are cached on disk between editor sessions."));
+
+static TAutoConsoleVariable<int32> CVarRuleProcessorSlowQueryThresholdMs(
+	TEXT("t.RuleProcessor.SlowQueryThresholdMs"),
+	0,
+	TEXT("If non-zero, queries that run for at least this many milliseconds are recorded in the point cloud's slow query log together with their query plan."));
+
+static TAutoConsoleVariable<int32> CVarRuleProcessorDbCacheSizeMb(
+	TEXT("t.RuleProcessor.DbCacheSizeMb"),
+	0,
+	TEXT("If non-zero, the sqlite page cache for each point cloud database is set to this many megabytes at open. ")
+	TEXT("Build machines processing large point clouds benefit from values of 1024 or more; the default leaves sqlite's own default in place. ")
+	TEXT("Use the point cloud's database status report to check the resulting cache hit rate."));
+
+static TAutoConsoleVariable<int32> CVarRuleProcessorSerializeVacuumThresholdPercent(
+	TEXT("t.RuleProcessor.SerializeVacuumThresholdPercent"),
+	5,
+	TEXT("If the database freelist holds at least this percentage of the total pages when a point cloud is saved, the database is vacuumed first so free pages are not written into the asset. 0 disables the vacuum."));
+
+static TAutoConsoleVariable<int32> CVarRuleProcessorDbTempStore(
+	TEXT("t.RuleProcessor.DbTempStore"),
+	0,
+	TEXT("Where sqlite keeps temporary tables and indices for point cloud databases: 0 leaves sqlite's default, 1 forces file storage, 2 forces memory. ")
+	TEXT("Rule execution makes heavy use of temporary result tables, so build machines with enough memory should use 2."));
+
 // Convenience macros
 #define RUN_QUERY(Query) RunQuery(Query, __FILE__, __LINE__)
 #define RUN_QUERY_P(PointCloud, Query) PointCloud->RunQuery(Query, __FILE__, __LINE__)
@@ -70,6 +100,21 @@ namespace PointCloudPrivateNamespace
 	}
 #endif
 
+	// Callback for EXPLAIN QUERY PLAN; appends the detail column of each plan row to the given string
+	int AppendQueryPlanRow(void* UsrData, int argc, char** argv, char** azColName)
+	{
+		FString* Plan = static_cast<FString*>(UsrData);
+
+		if (Plan && argc > 0 && argv[argc - 1])
+		{
+			Plan->Append(TEXT("    "));
+			Plan->Append(ANSI_TO_TCHAR(argv[argc - 1]));
+			Plan->Append(TEXT("\n"));
+		}
+
+		return 0;
+	}
+
 	FString SanitizeTableName(const FString& InTableName)
 	{
 		// Hash the string and return the hashed name
@@ -208,6 +253,15 @@ FString UPointCloudImpl::GetTemporaryQueryTable(const FString& Query)
 		return CachedTableName;
 	}
 
+	// Try to restore the results written by a previous session before paying for the query
+	const FString CacheFilePath = GetQueryResultDiskCachePath(Query);
+
+	if (TryRestoreTableFromDiskCache(TempName, CacheFilePath))
+	{
+		AddTemporaryTable(KeyName, TempName);
+		return TempName;
+	}
+
 	// Otherwise, create the table
 	const FString CreateTableQuery = FString::Printf(TEXT("CREATE TEMPORARY TABLE IF NOT EXISTS %s AS %s"), *TempName, *Query);
 	if (RUN_QUERY(CreateTableQuery) == false)
@@ -215,11 +269,307 @@ FString UPointCloudImpl::GetTemporaryQueryTable(const FString& Query)
 		return FString();
 	}
 
+	// Save the results so future sessions running the same rules over unchanged data skip the query
+	SaveTableToDiskCache(TempName, CacheFilePath);
+
 	AddTemporaryTable(KeyName, TempName);
 
 	return TempName;
 }
 
+FString UPointCloudImpl::GetQueryResultDiskCacheDir()
+{
+	return FPaths::ProjectSavedDir() / TEXT("RuleProcessor") / TEXT("QueryCache");
+}
+
+int32 UPointCloudImpl::GetQueryResultDiskCacheVersion()
+{
+	return 1;
+}
+
+FString UPointCloudImpl::GetQueryResultDiskCachePath(const FString& Query) const
+{
+	if (CVarRuleProcessorDiskQueryCache.GetValueOnAnyThread() == 0)
+	{
+		return FString();
+	}
+
+	// Make sure the content hash is up to date. This is a no-op unless the point cloud was modified
+	// since the hash was last calculated
+	CalculateWholeDbHash();
+
+	if (IsHashInvalid())
+	{
+		return FString();
+	}
+
+	const FString QueryHash = FMD5::HashAnsiString(*Query);
+
+	return GetQueryResultDiskCacheDir() / GetHashAsString() / QueryHash + TEXT(".bin");
+}
+
+bool UPointCloudImpl::TryRestoreTableFromDiskCache(const FString& TableName, const FString& CacheFilePath)
+{
+	if (CacheFilePath.IsEmpty())
+	{
+		return false;
+	}
+
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*CacheFilePath));
+
+	if (!Reader)
+	{
+		return false;
+	}
+
+	PointCloud::UtilityTimer Timer;
+
+	int32 Version = 0;
+	*Reader << Version;
+
+	if (Version != GetQueryResultDiskCacheVersion())
+	{
+		return false;
+	}
+
+	TArray<FString> ColumnNames;
+	*Reader << ColumnNames;
+
+	if (ColumnNames.Num() == 0 || Reader->IsError())
+	{
+		return false;
+	}
+
+	const FString CreateTableQuery = FString::Printf(TEXT("CREATE TEMPORARY TABLE IF NOT EXISTS %s (%s)"), *TableName, *FString::Join(ColumnNames, TEXT(", ")));
+
+	if (RUN_QUERY(CreateTableQuery) == false)
+	{
+		return false;
+	}
+
+	TArray<FString> Placeholders;
+	Placeholders.Init(TEXT("?"), ColumnNames.Num());
+
+	const FString InsertQuery = FString::Printf(TEXT("INSERT INTO %s VALUES (%s)"), *TableName, *FString::Join(Placeholders, TEXT(", ")));
+
+	sqlite3_stmt* Statement = PreparedStatements.Acquire(InternalDatabase, InsertQuery);
+
+	bool bSuccess = Statement != nullptr;
+
+	if (bSuccess)
+	{
+		FPointCloudTransactionHolder TransactionHolder(this);
+
+		while (bSuccess)
+		{
+			// Each row sits behind a continuation flag; a clear flag marks the end of the file
+			uint8 bHasRow = 0;
+			*Reader << bHasRow;
+
+			if (Reader->IsError())
+			{
+				bSuccess = false;
+				break;
+			}
+
+			if (!bHasRow)
+			{
+				break;
+			}
+
+			for (int32 ColumnIndex = 0; bSuccess && ColumnIndex < ColumnNames.Num(); ++ColumnIndex)
+			{
+				int8 ColumnType = 0;
+				*Reader << ColumnType;
+
+				switch (ColumnType)
+				{
+				case SQLITE_INTEGER:
+				{
+					int64 Value = 0;
+					*Reader << Value;
+					bSuccess = sqlite3_bind_int64(Statement, ColumnIndex + 1, Value) == SQLITE_OK;
+					break;
+				}
+				case SQLITE_FLOAT:
+				{
+					double Value = 0.0;
+					*Reader << Value;
+					bSuccess = sqlite3_bind_double(Statement, ColumnIndex + 1, Value) == SQLITE_OK;
+					break;
+				}
+				case SQLITE_TEXT:
+				{
+					FString Value;
+					*Reader << Value;
+					bSuccess = sqlite3_bind_text16(Statement, ColumnIndex + 1, *Value, -1, SQLITE_TRANSIENT) == SQLITE_OK;
+					break;
+				}
+				case SQLITE_BLOB:
+				{
+					TArray<uint8> Value;
+					*Reader << Value;
+					bSuccess = sqlite3_bind_blob(Statement, ColumnIndex + 1, Value.GetData(), Value.Num(), SQLITE_TRANSIENT) == SQLITE_OK;
+					break;
+				}
+				case SQLITE_NULL:
+				{
+					bSuccess = sqlite3_bind_null(Statement, ColumnIndex + 1) == SQLITE_OK;
+					break;
+				}
+				default:
+				{
+					bSuccess = false;
+					break;
+				}
+				}
+
+				bSuccess &= !Reader->IsError();
+			}
+
+			if (bSuccess)
+			{
+				bSuccess = sqlite3_step(Statement) == SQLITE_DONE;
+				sqlite3_clear_bindings(Statement);
+				bSuccess &= sqlite3_reset(Statement) == SQLITE_OK;
+			}
+		}
+
+		if (!bSuccess)
+		{
+			TransactionHolder.RollBack();
+		}
+
+		PreparedStatements.Release(InsertQuery, Statement);
+	}
+
+	if (!bSuccess)
+	{
+		const FString DeleteTableQuery = FString::Printf(TEXT("DROP TABLE IF EXISTS %s"), *TableName);
+		RUN_QUERY(DeleteTableQuery);
+
+		// The file couldn't be replayed; remove it so we don't retry every session
+		Reader.Reset();
+		IFileManager::Get().Delete(*CacheFilePath);
+
+		UE_LOG(PointCloudLog, Log, TEXT("Discarded unreadable query cache file %s"), *CacheFilePath);
+
+		return false;
+	}
+
+	Timer.Report(TEXT("Restore Query Disk Cache"));
+
+	return true;
+}
+
+void UPointCloudImpl::SaveTableToDiskCache(const FString& TableName, const FString& CacheFilePath)
+{
+	if (CacheFilePath.IsEmpty())
+	{
+		return;
+	}
+
+	PointCloud::UtilityTimer Timer;
+
+	const FString SelectQuery = FString::Printf(TEXT("SELECT * FROM %s"), *TableName);
+
+	sqlite3_stmt* Statement = PreparedStatements.Acquire(InternalDatabase, SelectQuery);
+
+	if (Statement == nullptr)
+	{
+		return;
+	}
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(CacheFilePath), true);
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*CacheFilePath));
+
+	if (!Writer)
+	{
+		PreparedStatements.Release(SelectQuery, Statement);
+		return;
+	}
+
+	int32 Version = GetQueryResultDiskCacheVersion();
+	*Writer << Version;
+
+	const int32 ColumnCount = sqlite3_column_count(Statement);
+
+	TArray<FString> ColumnNames;
+	ColumnNames.Reserve(ColumnCount);
+
+	for (int32 ColumnIndex = 0; ColumnIndex < ColumnCount; ++ColumnIndex)
+	{
+		ColumnNames.Emplace((const char*)sqlite3_column_name(Statement, ColumnIndex));
+	}
+
+	*Writer << ColumnNames;
+
+	// Each row is written behind a continuation flag so the reader doesn't need a row count up front
+	while (sqlite3_step(Statement) == SQLITE_ROW)
+	{
+		uint8 bHasRow = 1;
+		*Writer << bHasRow;
+
+		for (int32 ColumnIndex = 0; ColumnIndex < ColumnCount; ++ColumnIndex)
+		{
+			int8 ColumnType = (int8)sqlite3_column_type(Statement, ColumnIndex);
+			*Writer << ColumnType;
+
+			switch (ColumnType)
+			{
+			case SQLITE_INTEGER:
+			{
+				int64 Value = sqlite3_column_int64(Statement, ColumnIndex);
+				*Writer << Value;
+				break;
+			}
+			case SQLITE_FLOAT:
+			{
+				double Value = sqlite3_column_double(Statement, ColumnIndex);
+				*Writer << Value;
+				break;
+			}
+			case SQLITE_TEXT:
+			{
+				FString Value = (const char*)sqlite3_column_text(Statement, ColumnIndex);
+				*Writer << Value;
+				break;
+			}
+			case SQLITE_BLOB:
+			{
+				TArray<uint8> Value;
+				Value.Append((const uint8*)sqlite3_column_blob(Statement, ColumnIndex), sqlite3_column_bytes(Statement, ColumnIndex));
+				*Writer << Value;
+				break;
+			}
+			default:
+			{
+				// Nulls carry no payload
+				break;
+			}
+			}
+		}
+	}
+
+	uint8 bEndMarker = 0;
+	*Writer << bEndMarker;
+
+	const bool bWriteFailed = Writer->IsError();
+
+	Writer.Reset();
+
+	PreparedStatements.Release(SelectQuery, Statement);
+
+	if (bWriteFailed)
+	{
+		IFileManager::Get().Delete(*CacheFilePath);
+		return;
+	}
+
+	Timer.Report(TEXT("Save Query Disk Cache"));
+}
+
 void UPointCloudImpl::AddTemporaryTable(const FString& Key, const FString& Name)
 {
 	check(Key.IsEmpty() == false);
@@ -241,6 +591,22 @@ void UPointCloudImpl::AddTemporaryTable(const FString& Key, const FString& Name)
 	}
 }
 
+void UPointCloudImpl::PinTemporaryTable(const FString& Name)
+{
+	if (!Name.IsEmpty())
+	{
+		TemporaryTables.Pin(Name);
+	}
+}
+
+void UPointCloudImpl::UnpinTemporaryTable(const FString& Name)
+{
+	if (!Name.IsEmpty())
+	{
+		TemporaryTables.Unpin(Name);
+	}
+}
+
 FString UPointCloudImpl::GetTemporaryAttributeTable(const FString& MetadataKey)
 {
 	FString CachedTableName = TemporaryTables.GetFromCache(MetadataKey);
@@ -301,7 +667,7 @@ void UPointCloudImpl::ClearTemporaryTables()
 	}
 }
 
-UPointCloudImpl::UPointCloudImpl() : bInTransaction(false), InternalDatabase(nullptr)
+UPointCloudImpl::UPointCloudImpl() : bInTransaction(false), InternalDatabase(nullptr), PendingDbImage(nullptr), PendingDbImageSize(0)
 {
 	LogFile = nullptr;
 	NumTablesSinceOptimize = 0;
@@ -339,6 +705,9 @@ UPointCloudImpl::EPointCloudSchemaVersions UPointCloudImpl::GetSchemaVersion() c
 	case 2:
 		SchemaVersion = EPointCloudSchemaVersions::POINTCLOUD_VERSION_2;
 		break;
+	case 3:
+		SchemaVersion = EPointCloudSchemaVersions::POINTCLOUD_VERSION_3;
+		break;
 	default:
 		SchemaVersion = EPointCloudSchemaVersions::POINTCLOUD_VERSION_INVALID;
 		break;
@@ -349,7 +718,7 @@ UPointCloudImpl::EPointCloudSchemaVersions UPointCloudImpl::GetSchemaVersion() c
 
 UPointCloudImpl::EPointCloudSchemaVersions UPointCloudImpl::GetLatestSchemaVersion()
 {
-	return EPointCloudSchemaVersions::POINTCLOUD_VERSION_2;
+	return EPointCloudSchemaVersions::POINTCLOUD_VERSION_3;
 }
 
 bool UPointCloudImpl::NeedsUpdating() const
@@ -374,6 +743,48 @@ bool UPointCloudImpl::UpdateFromSchemaVersionOneToVersionTwo()
 	return true;
 }
 
+bool UPointCloudImpl::UpdateFromSchemaVersionTwoToVersionThree()
+{
+	check(GetSchemaVersion() == EPointCloudSchemaVersions::POINTCLOUD_VERSION_2);
+
+	RUN_QUERY(PointCloud::ConvertFromSchemaTwoToThreeQuery);
+
+	if (PopulateNumericAttributeValues() == false)
+	{
+		return false;
+	}
+
+	SchemaVersion = EPointCloudSchemaVersions::POINTCLOUD_VERSION_3;
+
+	MarkPackageDirty();
+
+	return true;
+}
+
+bool UPointCloudImpl::PopulateNumericAttributeValues()
+{
+	// Run the numeric inference once per distinct value in the dictionary. Values that lex as a
+	// number get a typed entry in the NumericValue column, everything else is left NULL
+	TArray<TArray<FString>> NumericRows;
+
+	ForEachValuePair<int, FString>(TEXT("SELECT rowid as ID, Value FROM AttributeValues"), { TEXT("ID") }, { TEXT("Value") }, [&NumericRows](const int& RowId, const FString& Value)
+		{
+			double NumericValue = 0.0;
+			if (LexTryParseString(NumericValue, *Value))
+			{
+				// The NumericValue column has REAL affinity, so the bound text is stored as a native REAL
+				NumericRows.Add({ LexToString(NumericValue), FString::FromInt(RowId) });
+			}
+		});
+
+	if (NumericRows.Num() == 0)
+	{
+		return true;
+	}
+
+	return RunBatchedWrite(TEXT("UPDATE AttributeValues SET NumericValue=? WHERE rowid=?"), NumericRows);
+}
+
 bool UPointCloudImpl::AttemptToUpdate()
 {
 	if (NeedsUpdating() == false)
@@ -386,9 +797,12 @@ bool UPointCloudImpl::AttemptToUpdate()
 	switch (GetSchemaVersion())
 	{
 	case EPointCloudSchemaVersions::POINTCLOUD_VERSION_1:
-		// Convert from one to 2 
+		// Convert from one to 2, then on to the latest version
 		UE_LOG(PointCloudLog, Warning, TEXT("Attempting to convert from Schema Version 1 to Schema Version 2"));
-		return UpdateFromSchemaVersionOneToVersionTwo();
+		return UpdateFromSchemaVersionOneToVersionTwo() && UpdateFromSchemaVersionTwoToVersionThree();
+	case EPointCloudSchemaVersions::POINTCLOUD_VERSION_2:
+		UE_LOG(PointCloudLog, Warning, TEXT("Attempting to convert from Schema Version 2 to Schema Version 3"));
+		return UpdateFromSchemaVersionTwoToVersionThree();
 	default:
 		UE_LOG(PointCloudLog, Warning, TEXT("Unkown Schema Version"));
 		// cannot convert from the get version
@@ -398,8 +812,17 @@ bool UPointCloudImpl::AttemptToUpdate()
 
 UPointCloudImpl::~UPointCloudImpl()
 {
+	if (PendingDbImage)
+	{
+		// The database was never touched after loading, so ownership of the image was never passed to sqlite
+		FMemory::Free(PendingDbImage);
+		PendingDbImage = nullptr;
+	}
+
 	if (InternalDatabase)
 	{
+		// Cached statements must be finalized before the database they were compiled against is closed
+		PreparedStatements.FinalizeStatements();
 		sqlite3_close(InternalDatabase);
 	}
 }
@@ -552,6 +975,14 @@ bool UPointCloudImpl::EndTransaction()
 
 bool UPointCloudImpl::IsInitialized() const
 {
+	// Every database access checks initialization first, which makes this the single choke point for
+	// loading a deserialized database image on first use. Const cast as the deferred load mutates the
+	// connection but not the observable state of the point cloud
+	if (PendingDbImage)
+	{
+		const_cast<UPointCloudImpl*>(this)->ApplyPendingDbImage();
+	}
+
 	return (InternalDatabase != nullptr);
 }
 
@@ -634,13 +1065,20 @@ bool UPointCloudImpl::InitFromPreparedData(const FString& ObjectName,
 
 	PointCloudPrivateNamespace::DropIndexes(this);
 
+	// Insert the attribute keys through the batched write path; the values are bound
+	// rather than spliced into the statement, so names need no escaping
+	TArray<TArray<FString>> AttributeKeyRows;
+	AttributeKeyRows.Reserve(MetadataColumnNames.Num());
+
 	for (const FString& Name : MetadataColumnNames)
 	{
-		if (RUN_QUERY(FString::Printf(TEXT("INSERT INTO AttributeKeys(Name) VALUES('%s');"), *Name)) == false)
-		{
-			Holder.RollBack();
-			return false;
-		}
+		AttributeKeyRows.Add({ Name });
+	}
+
+	if (RunBatchedWrite(TEXT("INSERT INTO AttributeKeys(Name) VALUES(?)"), AttributeKeyRows) == false)
+	{
+		Holder.RollBack();
+		return false;
 	}
 
 	uint32 index = 0;
@@ -661,7 +1099,7 @@ bool UPointCloudImpl::InitFromPreparedData(const FString& ObjectName,
 	Query += FString::Printf(TEXT("( %s, ?,?,?,?,?,?,?,0,0,?,?,?)"), *ObjectId);
 	InsertVertexQuery.SetQuery(Query);
 
-	Query = FString::Printf(TEXT("INSERT OR IGNORE INTO AttributeValues VALUES(?);"));
+	Query = FString::Printf(TEXT("INSERT OR IGNORE INTO AttributeValues(Value, NumericValue) VALUES(?,?);"));
 	InsertAttributeQuery.SetQuery(Query);
 
 	Query = FString::Printf(TEXT("INSERT INTO VertexToAttribute(vertex_id, key_id, value_id) VALUES(?,?,?)"));
@@ -692,12 +1130,21 @@ bool UPointCloudImpl::InitFromPreparedData(const FString& ObjectName,
 	}
 
 	InsertAttributeQuery.Begin();
-	// now insert all of the Metadata values	
+	// now insert all of the Metadata values. Values that lex as a number also get a typed entry
+	// in the NumericValue column so numeric consumers can read them without string conversion
 	for (const FString& Value : MetadataValueSet)
 	{
 		FTCHARToUTF8 EchoStrUtf8(*Value);
 		TArray<char> UTF8Value(EchoStrUtf8.Get(), EchoStrUtf8.Length() + 1);
-		InsertAttributeQuery.Step(UTF8Value);
+
+		TOptional<double> NumericValue;
+		double ParsedValue = 0.0;
+		if (LexTryParseString(ParsedValue, *Value))
+		{
+			NumericValue = ParsedValue;
+		}
+
+		InsertAttributeQuery.Step(UTF8Value, NumericValue);
 	}
 	InsertAttributeQuery.End();
 
@@ -740,6 +1187,9 @@ bool UPointCloudImpl::InitFromPreparedData(const FString& ObjectName,
 	int CurrentTopVertexRowId = GetValue<int>("SELECT Max(rowid) from Vertex");
 	int CurrentMetadataIndex = 0;
 
+	// Track the bounds of the points actually inserted so the affected region can be recorded below
+	FBox InsertedBounds(EForceInit::ForceInit);
+
 	InsertVertexQuery.Begin();
 	VertexToAttributeQuery.Begin();
 
@@ -761,6 +1211,8 @@ bool UPointCloudImpl::InitFromPreparedData(const FString& ObjectName,
 			continue;
 		}
 
+		InsertedBounds += Transform.GetTranslation();
+
 		VertexValues[0] = Transform.GetTranslation().X;
 		VertexValues[1] = Transform.GetTranslation().Y;
 		VertexValues[2] = Transform.GetTranslation().Z;
@@ -827,6 +1279,12 @@ bool UPointCloudImpl::InitFromPreparedData(const FString& ObjectName,
 
 	UE_LOG(PointCloudLog, Log, TEXT("Took %.2f Seconds to Insert Object\n"), Timer.ToSeconds());
 
+	// Record the region this import touched so consumers can detect localized changes
+	if (InsertedBounds.IsValid)
+	{
+		MarkRegionDirty(InsertedBounds);
+	}
+
 	// Calculate the hash of the database
 	CalculateWholeDbHash();
 
@@ -1398,11 +1856,18 @@ bool UPointCloudImpl::LoadFromStructuredPoints(const TArray<FPointCloudPoint>& I
 
 int32 UPointCloudImpl::GetTemporaryTableCacheSize()
 {
-	// Magic Number alert. This is a method for the moment but it may become dynamic down the line, hence using a method 
-	// rather than a static variable 
+	// Magic Number alert. This is a method for the moment but it may become dynamic down the line, hence using a method
+	// rather than a static variable
 	return 5000;
 }
 
+int32 UPointCloudImpl::GetPreparedStatementCacheSize()
+{
+	// Magic Number alert. This is a method for the moment but it may become dynamic down the line, hence using a method
+	// rather than a static variable
+	return 256;
+}
+
 namespace
 {
 #if WITH_EDITOR
@@ -1498,6 +1963,10 @@ bool UPointCloudImpl::ReloadInternal(const TArray<FString >& Files, const FBox&
 {
 	PointCloud::UtilityTimer Timer;
 
+	// The original database is either closed (on success) or restored (on failure) below; either way the
+	// statements compiled against it cannot be reused
+	PreparedStatements.FinalizeStatements();
+
 	// create a new database and store the original
 	sqlite3* CopyInternalDatabase = InternalDatabase;
 
@@ -1549,6 +2018,10 @@ bool UPointCloudImpl::ReloadInternal(const TArray<FString >& Files, const FBox&
 	}
 	else
 	{
+		// The database was rebuilt from scratch, so previous content anywhere in the cloud may have
+		// been dropped or renumbered; the whole cloud has to be considered touched
+		MarkRegionDirty(FBox(EForceInit::ForceInit));
+
 		MarkPackageDirty();
 		sqlite3_close(CopyInternalDatabase);
 	}
@@ -1595,6 +2068,73 @@ namespace
 }
 
 // Initialize the database
+void UPointCloudImpl::ApplyDatabaseConfig()
+{
+	// Apply the tunable database configuration. The database itself lives in memory, so journal
+	// mode, synchronous level and mmap size have no effect here; the knobs that matter are the
+	// page cache serving this connection and where temporary tables are stored
+	const int32 CacheSizeMb = CVarRuleProcessorDbCacheSizeMb.GetValueOnAnyThread();
+	if (CacheSizeMb > 0)
+	{
+		// A negative cache_size is interpreted by sqlite as a size in KiB rather than in pages
+		RUN_QUERY(FString::Printf(TEXT("PRAGMA cache_size = -%d"), CacheSizeMb * 1024));
+	}
+
+	const int32 TempStore = CVarRuleProcessorDbTempStore.GetValueOnAnyThread();
+	if (TempStore == 1 || TempStore == 2)
+	{
+		RUN_QUERY(FString::Printf(TEXT("PRAGMA temp_store = %d"), TempStore));
+	}
+}
+
+FString UPointCloudImpl::GetDbStatusReport() const
+{
+	if (!IsInitialized())
+	{
+		return TEXT("No database open.\n");
+	}
+
+	TStringBuilder<1024> ReportBuilder;
+
+	int Current = 0;
+	int Highwater = 0;
+
+	if (sqlite3_db_status(InternalDatabase, SQLITE_DBSTATUS_CACHE_USED, &Current, &Highwater, 0) == SQLITE_OK)
+	{
+		ReportBuilder.Appendf(TEXT("Page cache used : %.1f MB\n"), Current / (1024.0 * 1024.0));
+	}
+
+	int CacheHits = 0;
+	int CacheMisses = 0;
+
+	if (sqlite3_db_status(InternalDatabase, SQLITE_DBSTATUS_CACHE_HIT, &CacheHits, &Highwater, 0) == SQLITE_OK &&
+		sqlite3_db_status(InternalDatabase, SQLITE_DBSTATUS_CACHE_MISS, &CacheMisses, &Highwater, 0) == SQLITE_OK)
+	{
+		const int64 TotalLookups = (int64)CacheHits + (int64)CacheMisses;
+		const double HitRate = TotalLookups > 0 ? (100.0 * CacheHits) / TotalLookups : 100.0;
+		ReportBuilder.Appendf(TEXT("Page cache hits : %d\n"), CacheHits);
+		ReportBuilder.Appendf(TEXT("Page cache misses : %d\n"), CacheMisses);
+		ReportBuilder.Appendf(TEXT("Page cache hit rate : %.1f%%\n"), HitRate);
+	}
+
+	if (sqlite3_db_status(InternalDatabase, SQLITE_DBSTATUS_CACHE_SPILL, &Current, &Highwater, 0) == SQLITE_OK)
+	{
+		ReportBuilder.Appendf(TEXT("Page cache spills : %d\n"), Current);
+	}
+
+	if (sqlite3_db_status(InternalDatabase, SQLITE_DBSTATUS_SCHEMA_USED, &Current, &Highwater, 0) == SQLITE_OK)
+	{
+		ReportBuilder.Appendf(TEXT("Schema memory : %.1f KB\n"), Current / 1024.0);
+	}
+
+	if (sqlite3_db_status(InternalDatabase, SQLITE_DBSTATUS_STMT_USED, &Current, &Highwater, 0) == SQLITE_OK)
+	{
+		ReportBuilder.Appendf(TEXT("Statement memory : %.1f KB\n"), Current / 1024.0);
+	}
+
+	return ReportBuilder.ToString();
+}
+
 void UPointCloudImpl::InitDb()
 {
 	// if we already have a database, then return
@@ -1634,6 +2174,7 @@ void UPointCloudImpl::InitDb()
 	sqlite3_create_function(InternalDatabase, "POW", 2, SQLITE_UTF8 | SQLITE_DETERMINISTIC, nullptr, &SQLExtension::sqlpow, nullptr, nullptr);
 	sqlite3_create_function(InternalDatabase, "IN_SPHERE", 7, SQLITE_UTF8 | SQLITE_DETERMINISTIC, nullptr, &SQLExtension::sqlIsInSphere, nullptr, nullptr);
 	sqlite3_create_function(InternalDatabase, "IN_OBB", 12, SQLITE_UTF8 | SQLITE_DETERMINISTIC, nullptr, &SQLExtension::sqlIsInOBB, nullptr, nullptr);
+	SQLExtension::RegisterGeometryBatchModules(InternalDatabase);
 
 	sqlite3_create_function(InternalDatabase, "SHA3", 1, SQLITE_UTF8 | SQLITE_INNOCUOUS | SQLITE_DETERMINISTIC, nullptr, &SQLExtension::sha3Func, nullptr, nullptr);
 	sqlite3_create_function(InternalDatabase, "SHA3", 2, SQLITE_UTF8 | SQLITE_INNOCUOUS | SQLITE_DETERMINISTIC, nullptr, &SQLExtension::sha3Func, nullptr, nullptr);
@@ -1648,6 +2189,8 @@ void UPointCloudImpl::InitDb()
 		InternalDatabase = 0;
 	}
 
+	ApplyDatabaseConfig();
+
 	// This needs to be called now to set the internal Schema Version 
 	EPointCloudSchemaVersions Version = GetSchemaVersion();
 
@@ -1854,6 +2397,23 @@ void UPointCloudImpl::SerializeDb(FArchive& Ar)
 
 	PointCloud::UtilityTimer Timer;
 
+	// Dropped filter result tables and removed attributes leave pages on the freelist, and
+	// sqlite3_serialize copies those pages into the asset. Compact the database first when enough
+	// of it is free space to be worth the rewrite
+	const int32 VacuumThresholdPercent = CVarRuleProcessorSerializeVacuumThresholdPercent.GetValueOnAnyThread();
+
+	if (VacuumThresholdPercent > 0)
+	{
+		const int FreePageCount = GetValue<int>("PRAGMA freelist_count", "freelist_count");
+		const int TotalPageCount = GetValue<int>("PRAGMA page_count", "page_count");
+
+		if (TotalPageCount > 0 && FreePageCount * 100 >= TotalPageCount * VacuumThresholdPercent)
+		{
+			UE_LOG(PointCloudLog, Log, TEXT("Vacuuming Point Cloud Database Before Save (%d of %d Pages Free)"), FreePageCount, TotalPageCount);
+			RUN_QUERY("VACUUM");
+		}
+	}
+
 	// This number is the maximum buffer size that sqlite will allocate. Have a look at  void *sqlite3Malloc(u64 n) which is at Line 27408 in sqlite3.inl at the time of writing
 	// sqlite3_serialize will fail to create the buffer for databases above this size. 
 	static unsigned int MAX_SQLITE_ALLOC_SIZE = 0x7fffff00;
@@ -1956,14 +2516,54 @@ void UPointCloudImpl::DeSerializeDb(FArchive& Ar)
 	Ar.SerializeCompressedNew(Copy, Size);
 	Ar.Serialize(WholeDbHash.m_digest, WholeDbHash.DigestSize);
 
-	// Calculate the hash of the database on loading to ensure it is up to date	
+	// Keep the image aside rather than loading it into the sqlite connection here. Editor loads
+	// frequently deserialize point cloud assets that nothing ever queries; those now skip the
+	// reconstruction cost entirely, and assets that are queried pay it on first touch instead
+	// (see ApplyPendingDbImage)
+	PendingDbImageLock.Lock();
+	if (PendingDbImage)
+	{
+		FMemory::Free(PendingDbImage);
+	}
+	PendingDbImage = Copy;
+	PendingDbImageSize = Size;
+	PendingDbImageLock.Unlock();
+
+	Timer.Report(TEXT("Deserialize"));
+}
+
+void UPointCloudImpl::ApplyPendingDbImage()
+{
+	PendingDbImageLock.Lock();
+
+	uint8* Image = PendingDbImage;
+	const int64 Size = PendingDbImageSize;
+
+	// Another thread may have loaded the image while this one waited on the lock
+	if (Image == nullptr)
+	{
+		PendingDbImageLock.Unlock();
+		return;
+	}
+
+	// Cleared before anything below calls back into IsInitialized, which would otherwise re-enter
+	PendingDbImage = nullptr;
+	PendingDbImageSize = 0;
+
+	PointCloud::UtilityTimer Timer;
+
+	// Loading the image replaces the database content, invalidating any statements compiled against it
+	PreparedStatements.FinalizeStatements();
+
+	// Calculate the hash if required (the digest serialized alongside the image normally makes this a no-op)
+	CalculateWholeDbHash(Image, Size);
 
 	int rc = sqlite3_deserialize(
 		InternalDatabase,				/* The database connection */
 		"main",							/* Which DB to reopen with the deserialization */
-		Copy,							/* The serialized database content */
+		Image,							/* The serialized database content */
 		Size,							/* Number bytes in the deserialization */
-		Size * 2,							/* Total size of buffer pData[] */
+		Size * 2,						/* Total size of buffer pData[] */
 		SQLITE_DESERIALIZE_FREEONCLOSE | SQLITE_DESERIALIZE_RESIZEABLE
 	);
 
@@ -1972,12 +2572,14 @@ void UPointCloudImpl::DeSerializeDb(FArchive& Ar)
 		UE_LOG(PointCloudLog, Warning, TEXT("Point Cloud '%s' Uses An Old Schema (PointCloud=%d Current=%d), Please Update Or Recreate"), *GetPathName(), SchemaVersion, GetLatestSchemaVersion());
 	}
 
+	// Deserializing reopens the main database, which resets its per-schema settings
+	ApplyDatabaseConfig();
+
 	OptimizeIfRequired();
 
-	// Calculate the hash if required
-	CalculateWholeDbHash(Copy, Size);
+	Timer.Report(TEXT("Deferred DB Load"));
 
-	Timer.Report(TEXT("Deserialize"));
+	PendingDbImageLock.Unlock();
 }
 
 namespace
@@ -1996,7 +2598,12 @@ namespace
 bool UPointCloudImpl::RunQuery(const FString& Query, int (*Callback)(void*, int, char**, char**), void* UsrData, const FString& InOriginatingFile, const uint32 InOriginatingLine)
 {
 	PointCloud::QueryLogger(this, Query, FString(), InOriginatingFile, InOriginatingLine);
-	return RunQueryInternal(Query, Callback, UsrData);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const bool bResult = RunQueryInternal(Query, Callback, UsrData);
+	RecordSlowQuery(Query, (FPlatformTime::Seconds() - StartTime) * 1000.0, InOriginatingFile, InOriginatingLine);
+
+	return bResult;
 }
 
 bool UPointCloudImpl::RunQueryInternal(const FString& Query, int (*Callback)(void*, int, char**, char**), void* UsrData)
@@ -2029,7 +2636,12 @@ bool UPointCloudImpl::RunQueryInternal(const FString& Query, int (*Callback)(voi
 bool UPointCloudImpl::RunQuery(const FString& Query, const FString& InOriginatingFile, const uint32 InOriginatingLine)
 {
 	PointCloud::QueryLogger(this, Query, FString(), InOriginatingFile, InOriginatingLine);
-	return RunQueryInternal(Query);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const bool bResult = RunQueryInternal(Query);
+	RecordSlowQuery(Query, (FPlatformTime::Seconds() - StartTime) * 1000.0, InOriginatingFile, InOriginatingLine);
+
+	return bResult;
 }
 
 bool UPointCloudImpl::RunQueryInternal(const FString& Query)
@@ -2037,6 +2649,132 @@ bool UPointCloudImpl::RunQueryInternal(const FString& Query)
 	return RunQueryInternal(Query, PrintCallBack, nullptr);
 }
 
+void UPointCloudImpl::RecordSlowQuery(const FString& Query, double Milliseconds, const FString& InOriginatingFile, uint32 InOriginatingLine)
+{
+	const int32 ThresholdMs = CVarRuleProcessorSlowQueryThresholdMs.GetValueOnAnyThread();
+
+	if (ThresholdMs <= 0 || Milliseconds < (double)ThresholdMs)
+	{
+		return;
+	}
+
+	// Don't capture plan statements themselves
+	if (Query.StartsWith(TEXT("EXPLAIN")))
+	{
+		return;
+	}
+
+	FSlowQueryEntry Entry;
+	Entry.Query = Query;
+	Entry.OriginatingFile = InOriginatingFile;
+	Entry.OriginatingLine = InOriginatingLine;
+	Entry.Milliseconds = Milliseconds;
+
+	// Ask sqlite how it executed the statement; full table scans show up in the plan as SCAN
+	// rows without a covering index, which is what this log exists to surface
+	RunQueryInternal(FString::Printf(TEXT("EXPLAIN QUERY PLAN %s"), *Query), PointCloudPrivateNamespace::AppendQueryPlanRow, &Entry.Plan);
+
+	FScopeLock Lock(&SlowQueryLogLock);
+
+	const int32 MaxSlowQueryEntries = 256;
+
+	if (SlowQueryLog.Num() >= MaxSlowQueryEntries)
+	{
+		SlowQueryLog.RemoveAt(0);
+	}
+
+	SlowQueryLog.Add(MoveTemp(Entry));
+}
+
+TArray<UPointCloudImpl::FSlowQueryEntry> UPointCloudImpl::GetSlowQueryLog() const
+{
+	FScopeLock Lock(&SlowQueryLogLock);
+	return SlowQueryLog;
+}
+
+void UPointCloudImpl::ClearSlowQueryLog()
+{
+	FScopeLock Lock(&SlowQueryLogLock);
+	SlowQueryLog.Empty();
+}
+
+FString UPointCloudImpl::GetSlowQueryReport() const
+{
+	FScopeLock Lock(&SlowQueryLogLock);
+
+	if (SlowQueryLog.IsEmpty())
+	{
+		return TEXT("No slow queries recorded. Set t.RuleProcessor.SlowQueryThresholdMs to a non-zero threshold before running rules to record queries and their plans.\n");
+	}
+
+	TStringBuilder<4096> ReportBuilder;
+
+	for (const FSlowQueryEntry& Entry : SlowQueryLog)
+	{
+		ReportBuilder.Appendf(TEXT("%.1f ms"), Entry.Milliseconds);
+
+		if (!Entry.OriginatingFile.IsEmpty())
+		{
+			ReportBuilder.Appendf(TEXT(" (%s:%u)"), *Entry.OriginatingFile, Entry.OriginatingLine);
+		}
+
+		ReportBuilder.Append(TEXT("\n"));
+		ReportBuilder.Append(*Entry.Query);
+		ReportBuilder.Append(TEXT("\n"));
+
+		if (!Entry.Plan.IsEmpty())
+		{
+			ReportBuilder.Append(TEXT("Plan:\n"));
+			ReportBuilder.Append(*Entry.Plan);
+		}
+
+		ReportBuilder.Append(TEXT("\n"));
+	}
+
+	return ReportBuilder.ToString();
+}
+
+bool UPointCloudImpl::RunBatchedWrite(const FString& Query, const TArray<TArray<FString>>& Rows)
+{
+	if (Rows.IsEmpty())
+	{
+		return true;
+	}
+
+	FPointCloudQuery WriteQuery(this);
+
+	if (!WriteQuery.SetQuery(Query))
+	{
+		return false;
+	}
+
+	// The writes change the content of the database, so any cached whole database hash is stale
+	InvalidateHash();
+
+	// If the caller already opened a transaction the rows simply join it and the caller
+	// remains responsible for the final commit or rollback
+	const bool bOpenedTransaction = !bInTransaction && BeginTransaction();
+
+	WriteQuery.Begin();
+
+	for (const TArray<FString>& Row : Rows)
+	{
+		if (!WriteQuery.Step(Row))
+		{
+			if (bOpenedTransaction)
+			{
+				RollbackTransaction();
+			}
+
+			return false;
+		}
+	}
+
+	WriteQuery.End();
+
+	return !bOpenedTransaction || EndTransaction();
+}
+
 void UPointCloudImpl::GetValues(const FString& Query, const TArray<FString>& ColumnNames, TFunction<void(sqlite3_stmt*, int*)> Retrieval) const
 {
 	if (!IsInitialized())
@@ -2052,17 +2790,18 @@ void UPointCloudImpl::GetValues(const FString& Query, const TArray<FString>& Col
 
 	LOG_QUERY(Query);
 
-	sqlite3_stmt* stmt = nullptr;
+	// Check a compiled statement out of the cache, compiling it on a cache miss. Rule runs issue thousands of
+	// near-identical queries, so reusing compiled statements removes most of the sqlite3_prepare_v2 cost
+	sqlite3_stmt* stmt = PreparedStatements.Acquire(InternalDatabase, Query);
 
-	// execute statement
-	int retval = sqlite3_prepare_v2(InternalDatabase, TCHAR_TO_ANSI(*Query), -1, &stmt, 0);
-
-	if (retval)
+	if (stmt == nullptr)
 	{
-		UE_LOG(PointCloudLog, Warning, TEXT("Error Fetching Value (%d) : %s (%s)\n"), retval, ANSI_TO_TCHAR(sqlite3_errmsg(InternalDatabase)), (*Query));
+		UE_LOG(PointCloudLog, Warning, TEXT("Error Fetching Value : %s (%s)\n"), ANSI_TO_TCHAR(sqlite3_errmsg(InternalDatabase)), (*Query));
 		return;
 	}
 
+	int retval = 0;
+
 	// Identify given column names
 	TArray<int> ColumnIndices;
 	ColumnIndices.SetNum(ColumnNames.Num());
@@ -2097,7 +2836,7 @@ void UPointCloudImpl::GetValues(const FString& Query, const TArray<FString>& Col
 				else
 				{
 					UE_LOG(PointCloudLog, Warning, TEXT("Column Not Found (%s)\n"), *ColumnName);
-					sqlite3_finalize(stmt);
+					PreparedStatements.Release(Query, stmt);
 					return;
 				}
 			}
@@ -2133,7 +2872,8 @@ void UPointCloudImpl::GetValues(const FString& Query, const TArray<FString>& Col
 		}
 	}
 
-	sqlite3_finalize(stmt);
+	// Hand the statement back for reuse; Release resets it, or finalizes it if the reset fails
+	PreparedStatements.Release(Query, stmt);
 }
 
 // Undef convenience macros
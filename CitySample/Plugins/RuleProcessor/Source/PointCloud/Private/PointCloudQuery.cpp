@@ -37,9 +37,19 @@ bool FPointCloudQuery::SetQuery(const FString& InQuery)
 		return false;
 	}
 
+	// Make sure any deferred database image is loaded before compiling against the connection
+	if (!Cloud->IsInitialized())
+	{
+		UE_LOG(PointCloudLog, Warning, TEXT("Cloud is not initialized"));
+		return false;
+	}
+
 	QUERY_LOG(Query, TEXT("Set Query"));
 
-	if (sqlite3_prepare_v2(Cloud->InternalDatabase, TCHAR_TO_ANSI(*Query), -1, &Statement, 0) != SQLITE_OK)
+	// Check the compiled statement out of the point cloud's statement cache; it is handed back in End
+	Statement = Cloud->PreparedStatements.Acquire(Cloud->InternalDatabase, Query);
+
+	if (Statement == nullptr)
 	{
 		UE_LOG(PointCloudLog, Warning, TEXT("Prepare Statement Failed"));
 		return false;
@@ -184,6 +194,50 @@ bool FPointCloudQuery::Step(const TArray<char>& Values)
 	return true;
 }
 
+bool FPointCloudQuery::Step(const TArray<char>& Values, const TOptional<double>& NumericValue)
+{
+	if (!Cloud || !Statement)
+	{
+		UE_LOG(PointCloudLog, Warning, TEXT("Null Cloud or Statement"));
+		return false;
+	}
+
+	QUERY_LOG(FString(), TEXT("Step(const TArray<char>& Values, const TOptional<double>& NumericValue)"));
+
+	if (sqlite3_bind_text(Statement, 1, Values.GetData(), -1, SQLITE_TRANSIENT) != SQLITE_OK)
+	{
+		UE_LOG(PointCloudLog, Warning, TEXT("Bind Attribute 1 failed"));
+		return false;
+	}
+
+	const int BindResult = NumericValue.IsSet() ? sqlite3_bind_double(Statement, 2, NumericValue.GetValue()) : sqlite3_bind_null(Statement, 2);
+
+	if (BindResult != SQLITE_OK)
+	{
+		UE_LOG(PointCloudLog, Warning, TEXT("Bind Attribute 2 failed"));
+		return false;
+	}
+
+	int StepResult = sqlite3_step(Statement);
+
+	if (StepResult != SQLITE_DONE)
+	{
+		UE_LOG(PointCloudLog, Warning, TEXT("Step Failed - %s"), ANSI_TO_TCHAR(sqlite3_errstr(StepResult)));
+		return false;
+	}
+
+	sqlite3_clear_bindings(Statement);
+	int rc = sqlite3_reset(Statement);
+
+	if (rc != SQLITE_OK)
+	{
+		UE_LOG(PointCloudLog, Warning, TEXT("Cleanup Failed"));
+		return false;
+	}
+
+	return true;
+}
+
 bool FPointCloudQuery::Step()
 {
 	if (!Cloud || !Statement)
@@ -353,11 +407,8 @@ bool FPointCloudQuery::End()
 		return false;
 	}
 
-	if (sqlite3_finalize(Statement) != SQLITE_OK)
-	{
-		UE_LOG(PointCloudLog, Warning, TEXT("Finalize Failed"));
-		return false;
-	}
+	// Hand the statement back to the cache so the next query with the same SQL skips the compile
+	Cloud->PreparedStatements.Release(Query, Statement);
 
 	Statement = nullptr;
 	Cloud = nullptr;
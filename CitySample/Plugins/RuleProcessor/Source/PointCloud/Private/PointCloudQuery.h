@@ -102,6 +102,15 @@ public:
 	*/
 	bool Step(const TArray<char>& Value);
 
+	/**
+	* Special case step function for metadata value insertion. Binds an 8-bit string parameter followed by an optional
+	* double, with NULL bound when the optional is unset
+	* @param Value - The string value for the first parameter
+	* @param NumericValue - The optional numeric value for the second parameter
+	* @return True if the query can be stepped given the provided values
+	*/
+	bool Step(const TArray<char>& Value, const TOptional<double>& NumericValue);
+
 	/**
 	* Run this prepared statement substituting parameters with floats. parameters will be replaced in the order they appear in the statement.
 	* @param Values - Parameter substitution values. This Array must contain one value for each expected parameter in the Query.
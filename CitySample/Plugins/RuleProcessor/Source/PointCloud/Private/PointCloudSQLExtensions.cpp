@@ -2,6 +2,7 @@
 
 #include "PointCloudSQLExtensions.h"
 #include "IncludeSQLite.h"
+#include "Math/VectorRegister.h"
 #include "PointCloud.h"
 #include <limits>
 
@@ -112,6 +113,437 @@ void SQLExtension::sqlIsInOBB(sqlite3_context* context, int argc, sqlite3_value*
 	}
 }
 
+namespace
+{
+	// Table declarations for the batch geometry table-valued functions. The arguments arrive as
+	// constraints on the HIDDEN columns, the Id column carries the result rows
+	const char* SphereBatchSchema = "CREATE TABLE x(Id INTEGER, cx HIDDEN, cy HIDDEN, cz HIDDEN, radius HIDDEN)";
+	const char* OBBBatchSchema = "CREATE TABLE x(Id INTEGER, pitch HIDDEN, yaw HIDDEN, roll HIDDEN, tx HIDDEN, ty HIDDEN, tz HIDDEN, sx HIDDEN, sy HIDDEN, sz HIDDEN, invert HIDDEN)";
+
+	const int32 SphereBatchArgCount = 4;
+	const int32 OBBBatchArgCount = 10;
+
+	struct FGeometryBatchVTab
+	{
+		sqlite3_vtab Base;
+		sqlite3* Db;
+	};
+
+	struct FGeometryBatchCursor
+	{
+		sqlite3_vtab_cursor Base;
+
+		// Ids of the points that passed the batch test, served one row at a time
+		TArray<sqlite3_int64> Ids;
+		int32 Position;
+	};
+
+	// Candidate points pulled out of the spatial index in a single scan, stored as
+	// structure-of-arrays so the geometry tests can consume four points per SIMD iteration
+	struct FGeometryBatch
+	{
+		TArray<double> Xs;
+		TArray<double> Ys;
+		TArray<double> Zs;
+		TArray<sqlite3_int64> Ids;
+	};
+
+	// The r-tree stores single precision coordinates, so give the probe a little slack around the
+	// exact bounds to keep it conservative
+	FBox ExpandProbeBounds(const FBox& InBounds)
+	{
+		const double Iota = 1.0e-6;
+
+		const FVector BoundsMin = FVector(
+			InBounds.Min.X * (1.0 - FMath::Sign(InBounds.Min.X) * Iota),
+			InBounds.Min.Y * (1.0 - FMath::Sign(InBounds.Min.Y) * Iota),
+			InBounds.Min.Z * (1.0 - FMath::Sign(InBounds.Min.Z) * Iota));
+
+		const FVector BoundsMax = FVector(
+			InBounds.Max.X * (1.0 + FMath::Sign(InBounds.Max.X) * Iota),
+			InBounds.Max.Y * (1.0 + FMath::Sign(InBounds.Max.Y) * Iota),
+			InBounds.Max.Z * (1.0 + FMath::Sign(InBounds.Max.Z) * Iota));
+
+		return FBox(BoundsMin, BoundsMax);
+	}
+
+	bool PullGeometryBatch(sqlite3* Db, const FBox* ProbeBounds, FGeometryBatch& OutBatch)
+	{
+		// The points sit in the r-tree as degenerate boxes, so the Min columns are the positions.
+		// When conservative bounds are provided the r-tree narrows the candidate set before the
+		// batch test runs
+		FString Query = TEXT("SELECT id, Minx, Miny, Minz FROM SpatialQuery");
+
+		if (ProbeBounds)
+		{
+			Query += FString::Printf(TEXT(" WHERE (Minx>=%f AND Maxx<=%f) AND (Miny>=%f AND Maxy<=%f) AND (Minz>=%f AND Maxz<=%f)"),
+				ProbeBounds->Min.X, ProbeBounds->Max.X,
+				ProbeBounds->Min.Y, ProbeBounds->Max.Y,
+				ProbeBounds->Min.Z, ProbeBounds->Max.Z);
+		}
+
+		sqlite3_stmt* Statement = nullptr;
+
+		if (sqlite3_prepare_v2(Db, TCHAR_TO_UTF8(*Query), -1, &Statement, nullptr) != SQLITE_OK)
+		{
+			return false;
+		}
+
+		while (sqlite3_step(Statement) == SQLITE_ROW)
+		{
+			OutBatch.Ids.Add(sqlite3_column_int64(Statement, 0));
+			OutBatch.Xs.Add(sqlite3_column_double(Statement, 1));
+			OutBatch.Ys.Add(sqlite3_column_double(Statement, 2));
+			OutBatch.Zs.Add(sqlite3_column_double(Statement, 3));
+		}
+
+		sqlite3_finalize(Statement);
+
+		return true;
+	}
+
+	void EvaluateSphereBatch(const FGeometryBatch& Batch, const FVector& Center, double Radius, TArray<sqlite3_int64>& OutIds)
+	{
+		const int32 Num = Batch.Ids.Num();
+		OutIds.Reset(Num);
+
+		const VectorRegister4Double CenterX = VectorSetDouble1(Center.X);
+		const VectorRegister4Double CenterY = VectorSetDouble1(Center.Y);
+		const VectorRegister4Double CenterZ = VectorSetDouble1(Center.Z);
+		const VectorRegister4Double RadiusSquared = VectorSetDouble1(Radius * Radius);
+
+		int32 Index = 0;
+
+		for (; Index + 4 <= Num; Index += 4)
+		{
+			const VectorRegister4Double Dx = VectorSubtract(VectorLoad(&Batch.Xs[Index]), CenterX);
+			const VectorRegister4Double Dy = VectorSubtract(VectorLoad(&Batch.Ys[Index]), CenterY);
+			const VectorRegister4Double Dz = VectorSubtract(VectorLoad(&Batch.Zs[Index]), CenterZ);
+
+			const VectorRegister4Double DistSquared = VectorMultiplyAdd(Dz, Dz, VectorMultiplyAdd(Dy, Dy, VectorMultiply(Dx, Dx)));
+
+			const int32 MaskBits = VectorMaskBits(VectorCompareLT(DistSquared, RadiusSquared));
+
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				if (MaskBits & (1 << Lane))
+				{
+					OutIds.Add(Batch.Ids[Index + Lane]);
+				}
+			}
+		}
+
+		// Scalar tail for the last few points
+		for (; Index < Num; ++Index)
+		{
+			const FVector Delta = FVector(Batch.Xs[Index], Batch.Ys[Index], Batch.Zs[Index]) - Center;
+
+			if (Delta.SizeSquared() < Radius * Radius)
+			{
+				OutIds.Add(Batch.Ids[Index]);
+			}
+		}
+	}
+
+	void EvaluateOBBBatch(const FGeometryBatch& Batch, const FTransform& Transform, bool bInvert, TArray<sqlite3_int64>& OutIds)
+	{
+		const int32 Num = Batch.Ids.Num();
+		OutIds.Reset(Num);
+
+		// Invert the transform once for the whole batch rather than per point
+		const FMatrix WorldToLocal = Transform.ToInverseMatrixWithScale();
+
+		const VectorRegister4Double M00 = VectorSetDouble1(WorldToLocal.M[0][0]);
+		const VectorRegister4Double M01 = VectorSetDouble1(WorldToLocal.M[0][1]);
+		const VectorRegister4Double M02 = VectorSetDouble1(WorldToLocal.M[0][2]);
+		const VectorRegister4Double M10 = VectorSetDouble1(WorldToLocal.M[1][0]);
+		const VectorRegister4Double M11 = VectorSetDouble1(WorldToLocal.M[1][1]);
+		const VectorRegister4Double M12 = VectorSetDouble1(WorldToLocal.M[1][2]);
+		const VectorRegister4Double M20 = VectorSetDouble1(WorldToLocal.M[2][0]);
+		const VectorRegister4Double M21 = VectorSetDouble1(WorldToLocal.M[2][1]);
+		const VectorRegister4Double M22 = VectorSetDouble1(WorldToLocal.M[2][2]);
+		const VectorRegister4Double M30 = VectorSetDouble1(WorldToLocal.M[3][0]);
+		const VectorRegister4Double M31 = VectorSetDouble1(WorldToLocal.M[3][1]);
+		const VectorRegister4Double M32 = VectorSetDouble1(WorldToLocal.M[3][2]);
+		const VectorRegister4Double One = VectorSetDouble1(1.0);
+
+		int32 Index = 0;
+
+		for (; Index + 4 <= Num; Index += 4)
+		{
+			const VectorRegister4Double Px = VectorLoad(&Batch.Xs[Index]);
+			const VectorRegister4Double Py = VectorLoad(&Batch.Ys[Index]);
+			const VectorRegister4Double Pz = VectorLoad(&Batch.Zs[Index]);
+
+			// Row vector times matrix, like FMatrix::TransformPosition
+			const VectorRegister4Double LocalX = VectorMultiplyAdd(Pz, M20, VectorMultiplyAdd(Py, M10, VectorMultiplyAdd(Px, M00, M30)));
+			const VectorRegister4Double LocalY = VectorMultiplyAdd(Pz, M21, VectorMultiplyAdd(Py, M11, VectorMultiplyAdd(Px, M01, M31)));
+			const VectorRegister4Double LocalZ = VectorMultiplyAdd(Pz, M22, VectorMultiplyAdd(Py, M12, VectorMultiplyAdd(Px, M02, M32)));
+
+			const VectorRegister4Double Inside = VectorBitwiseAnd(
+				VectorBitwiseAnd(VectorCompareLE(VectorAbs(LocalX), One), VectorCompareLE(VectorAbs(LocalY), One)),
+				VectorCompareLE(VectorAbs(LocalZ), One));
+
+			int32 MaskBits = VectorMaskBits(Inside);
+
+			if (bInvert)
+			{
+				MaskBits = ~MaskBits;
+			}
+
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				if (MaskBits & (1 << Lane))
+				{
+					OutIds.Add(Batch.Ids[Index + Lane]);
+				}
+			}
+		}
+
+		// Scalar tail for the last few points
+		for (; Index < Num; ++Index)
+		{
+			const FVector LocalPoint = WorldToLocal.TransformPosition(FVector(Batch.Xs[Index], Batch.Ys[Index], Batch.Zs[Index]));
+
+			const bool bInside = FMath::Abs(LocalPoint.X) <= 1.0 &&
+				FMath::Abs(LocalPoint.Y) <= 1.0 &&
+				FMath::Abs(LocalPoint.Z) <= 1.0;
+
+			if (bInside != bInvert)
+			{
+				OutIds.Add(Batch.Ids[Index]);
+			}
+		}
+	}
+
+	int GeometryBatchConnect(sqlite3* Db, void* DeclarationSql, int, const char* const*, sqlite3_vtab** OutVTab, char**)
+	{
+		if (sqlite3_declare_vtab(Db, reinterpret_cast<const char*>(DeclarationSql)) != SQLITE_OK)
+		{
+			return SQLITE_ERROR;
+		}
+
+		FGeometryBatchVTab* VTab = new FGeometryBatchVTab();
+		FMemory::Memzero(VTab->Base);
+		VTab->Db = Db;
+
+		*OutVTab = &VTab->Base;
+
+		return SQLITE_OK;
+	}
+
+	int GeometryBatchDisconnect(sqlite3_vtab* VTab)
+	{
+		delete reinterpret_cast<FGeometryBatchVTab*>(VTab);
+		return SQLITE_OK;
+	}
+
+	int GeometryBatchOpen(sqlite3_vtab*, sqlite3_vtab_cursor** OutCursor)
+	{
+		FGeometryBatchCursor* Cursor = new FGeometryBatchCursor();
+		FMemory::Memzero(Cursor->Base);
+		Cursor->Position = 0;
+
+		*OutCursor = &Cursor->Base;
+
+		return SQLITE_OK;
+	}
+
+	int GeometryBatchClose(sqlite3_vtab_cursor* Cursor)
+	{
+		delete reinterpret_cast<FGeometryBatchCursor*>(Cursor);
+		return SQLITE_OK;
+	}
+
+	int GeometryBatchNext(sqlite3_vtab_cursor* Cursor)
+	{
+		++reinterpret_cast<FGeometryBatchCursor*>(Cursor)->Position;
+		return SQLITE_OK;
+	}
+
+	int GeometryBatchEof(sqlite3_vtab_cursor* Cursor)
+	{
+		const FGeometryBatchCursor* BatchCursor = reinterpret_cast<FGeometryBatchCursor*>(Cursor);
+		return BatchCursor->Position >= BatchCursor->Ids.Num();
+	}
+
+	int GeometryBatchColumn(sqlite3_vtab_cursor* Cursor, sqlite3_context* Context, int Column)
+	{
+		const FGeometryBatchCursor* BatchCursor = reinterpret_cast<FGeometryBatchCursor*>(Cursor);
+
+		if (Column == 0)
+		{
+			sqlite3_result_int64(Context, BatchCursor->Ids[BatchCursor->Position]);
+		}
+		else
+		{
+			sqlite3_result_null(Context);
+		}
+
+		return SQLITE_OK;
+	}
+
+	int GeometryBatchRowid(sqlite3_vtab_cursor* Cursor, sqlite3_int64* OutRowid)
+	{
+		const FGeometryBatchCursor* BatchCursor = reinterpret_cast<FGeometryBatchCursor*>(Cursor);
+		*OutRowid = BatchCursor->Ids[BatchCursor->Position];
+		return SQLITE_OK;
+	}
+
+	// Require an equality constraint for every hidden argument column and hand them to xFilter in
+	// column order
+	int GeometryBatchBestIndex(sqlite3_index_info* IndexInfo, int32 ArgCount)
+	{
+		int32 SeenArgs = 0;
+
+		for (int32 ConstraintIndex = 0; ConstraintIndex < IndexInfo->nConstraint; ++ConstraintIndex)
+		{
+			const auto& Constraint = IndexInfo->aConstraint[ConstraintIndex];
+
+			if (Constraint.usable && Constraint.iColumn >= 1 && Constraint.op == SQLITE_INDEX_CONSTRAINT_EQ)
+			{
+				IndexInfo->aConstraintUsage[ConstraintIndex].argvIndex = Constraint.iColumn;
+				IndexInfo->aConstraintUsage[ConstraintIndex].omit = 1;
+				++SeenArgs;
+			}
+		}
+
+		if (SeenArgs < ArgCount)
+		{
+			return SQLITE_CONSTRAINT;
+		}
+
+		IndexInfo->estimatedCost = 1000000.0;
+
+		return SQLITE_OK;
+	}
+
+	int SphereBatchBestIndex(sqlite3_vtab*, sqlite3_index_info* IndexInfo)
+	{
+		return GeometryBatchBestIndex(IndexInfo, SphereBatchArgCount);
+	}
+
+	int OBBBatchBestIndex(sqlite3_vtab*, sqlite3_index_info* IndexInfo)
+	{
+		return GeometryBatchBestIndex(IndexInfo, OBBBatchArgCount);
+	}
+
+	int SphereBatchFilter(sqlite3_vtab_cursor* Cursor, int, const char*, int ArgC, sqlite3_value** Args)
+	{
+		FGeometryBatchCursor* BatchCursor = reinterpret_cast<FGeometryBatchCursor*>(Cursor);
+		FGeometryBatchVTab* VTab = reinterpret_cast<FGeometryBatchVTab*>(Cursor->pVtab);
+
+		BatchCursor->Ids.Reset();
+		BatchCursor->Position = 0;
+
+		if (ArgC != SphereBatchArgCount)
+		{
+			return SQLITE_ERROR;
+		}
+
+		const FVector Center(sqlite3_value_double(Args[0]), sqlite3_value_double(Args[1]), sqlite3_value_double(Args[2]));
+		const double Radius = sqlite3_value_double(Args[3]);
+
+		const FBox ProbeBounds = ExpandProbeBounds(FBox(Center - FVector(Radius), Center + FVector(Radius)));
+
+		FGeometryBatch Batch;
+
+		if (!PullGeometryBatch(VTab->Db, &ProbeBounds, Batch))
+		{
+			return SQLITE_ERROR;
+		}
+
+		EvaluateSphereBatch(Batch, Center, Radius, BatchCursor->Ids);
+
+		return SQLITE_OK;
+	}
+
+	int OBBBatchFilter(sqlite3_vtab_cursor* Cursor, int, const char*, int ArgC, sqlite3_value** Args)
+	{
+		FGeometryBatchCursor* BatchCursor = reinterpret_cast<FGeometryBatchCursor*>(Cursor);
+		FGeometryBatchVTab* VTab = reinterpret_cast<FGeometryBatchVTab*>(Cursor->pVtab);
+
+		BatchCursor->Ids.Reset();
+		BatchCursor->Position = 0;
+
+		if (ArgC != OBBBatchArgCount)
+		{
+			return SQLITE_ERROR;
+		}
+
+		const FRotator Rotation(sqlite3_value_double(Args[0]), sqlite3_value_double(Args[1]), sqlite3_value_double(Args[2]));
+		const FVector Translation(sqlite3_value_double(Args[3]), sqlite3_value_double(Args[4]), sqlite3_value_double(Args[5]));
+		const FVector Scale(sqlite3_value_double(Args[6]), sqlite3_value_double(Args[7]), sqlite3_value_double(Args[8]));
+		const bool bInvert = sqlite3_value_int(Args[9]) != 0;
+
+		const FTransform Transform(Rotation, Translation, Scale);
+
+		FGeometryBatch Batch;
+
+		if (!bInvert)
+		{
+			// The test is against the unit box in local space, so the world space bounds of the OBB
+			// can narrow the candidate set through the r-tree
+			const FBox ProbeBounds = ExpandProbeBounds(FBox(FVector(-1.0), FVector(1.0)).TransformBy(Transform));
+
+			if (!PullGeometryBatch(VTab->Db, &ProbeBounds, Batch))
+			{
+				return SQLITE_ERROR;
+			}
+		}
+		else
+		{
+			// An inverted selection keeps everything outside the OBB, which no probe can narrow
+			if (!PullGeometryBatch(VTab->Db, nullptr, Batch))
+			{
+				return SQLITE_ERROR;
+			}
+		}
+
+		EvaluateOBBBatch(Batch, Transform, bInvert, BatchCursor->Ids);
+
+		return SQLITE_OK;
+	}
+
+	const sqlite3_module SphereBatchModule = {
+		0,						/* iVersion */
+		nullptr,				/* xCreate - null makes the table-valued function eponymous-only */
+		GeometryBatchConnect,
+		SphereBatchBestIndex,
+		GeometryBatchDisconnect,
+		nullptr,				/* xDestroy */
+		GeometryBatchOpen,
+		GeometryBatchClose,
+		SphereBatchFilter,
+		GeometryBatchNext,
+		GeometryBatchEof,
+		GeometryBatchColumn,
+		GeometryBatchRowid,
+	};
+
+	const sqlite3_module OBBBatchModule = {
+		0,						/* iVersion */
+		nullptr,				/* xCreate - null makes the table-valued function eponymous-only */
+		GeometryBatchConnect,
+		OBBBatchBestIndex,
+		GeometryBatchDisconnect,
+		nullptr,				/* xDestroy */
+		GeometryBatchOpen,
+		GeometryBatchClose,
+		OBBBatchFilter,
+		GeometryBatchNext,
+		GeometryBatchEof,
+		GeometryBatchColumn,
+		GeometryBatchRowid,
+	};
+}
+
+void SQLExtension::RegisterGeometryBatchModules(sqlite3* db_handle)
+{
+	sqlite3_create_module(db_handle, "IN_SPHERE_BATCH", &SphereBatchModule, (void*)SphereBatchSchema);
+	sqlite3_create_module(db_handle, "IN_OBB_BATCH", &OBBBatchModule, (void*)OBBBatchSchema);
+}
+
 struct RtreeBoundingBoxData
 {
 	explicit RtreeBoundingBoxData(int32 InDimension)
@@ -43,6 +43,26 @@ public:
 	*/
 	static void sqlIsInOBB(sqlite3_context* context, int argc, sqlite3_value** argv);
 
+	/**
+	* Register the batch geometry table-valued functions on the given connection.
+	*
+	* IN_SPHERE_BATCH(
+	*	Center.X, Center.Y, Center.Z,
+	*	Radius)
+	*
+	* IN_OBB_BATCH(
+	*	Rotation.Pitch, Rotation.Yaw, Rotation.Roll,
+	*	Translation.X, Translation.Y, Translation.Z,
+	*	Scale.X, Scale.Y, Scale.Z,
+	*	Invert)
+	*
+	* Both return one Id row per point passing the test. Unlike the scalar IN_SPHERE / IN_OBB
+	* functions, which sqlite evaluates through a C function call per candidate row, these pull the
+	* candidate positions out of the spatial index in a single scan and run the geometry test over
+	* the whole batch with SIMD
+	*/
+	static void RegisterGeometryBatchModules(sqlite3* db_handle);
+
 	// Helper function to query the bounds of a table/view
 	static FBox query_rtree_bbox(sqlite3* db_handle, const char* rtree_name);
 
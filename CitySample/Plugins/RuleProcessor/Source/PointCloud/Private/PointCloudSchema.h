@@ -19,7 +19,7 @@ namespace PointCloud
 		PRAGMA journal_mode = MEMORY;
 		PRAGMA page_size = 8096;
 		PRAGMA encoding = 'UTF-8';
-		PRAGMA user_version = 2;
+		PRAGMA user_version = 3;
 
 		CREATE TABLE if not exists Vertex (ObjectId INTEGER, 
 				x REAL, 
@@ -38,18 +38,19 @@ namespace PointCloud
 		CREATE TABLE AttributeKeys( Name STRING UNIQUE);
 
 		CREATE TABLE AttributeValues(
-			Value TEXT NOT NULL	UNIQUE
-		); 
+			Value TEXT NOT NULL	UNIQUE,
+			NumericValue REAL
+		);
 
 		CREATE TABLE VertexToAttribute(
-			vertex_id  	INTEGER NOT NULL, 
-			key_id  	INTEGER NOT NULL, 
+			vertex_id  	INTEGER NOT NULL,
+			key_id  	INTEGER NOT NULL,
 			value_id 	INTEGER NOT NULL
-		); 
+		);
 
 		CREATE TABLE if not exists Object (Name STRING UNIQUE);
 
-		CREATE VIEW MetaData AS SELECT VertexToAttribute.vertex_id As Vertex_Id, AttributeKeys.Name As Attribute_Name, AttributeValues.Value As Attribute_Value FROM AttributeValues INNER JOIN VertexToAttribute ON AttributeValues.rowid = VertexToAttribute.value_id INNER JOIN AttributeKeys ON AttributeKeys.rowid = VertexToAttribute.key_id;
+		CREATE VIEW MetaData AS SELECT VertexToAttribute.vertex_id As Vertex_Id, AttributeKeys.Name As Attribute_Name, AttributeValues.Value As Attribute_Value, AttributeValues.NumericValue As Attribute_NumericValue FROM AttributeValues INNER JOIN VertexToAttribute ON AttributeValues.rowid = VertexToAttribute.value_id INNER JOIN AttributeKeys ON AttributeKeys.rowid = VertexToAttribute.key_id;
 		;)SchmStrnLtr";
 
 		//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -98,6 +99,23 @@ namespace PointCloud
 
 		VACUUM;
 		ANALYZE;)SchmStrnLtr";
+
+		//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	// Adds the typed NumericValue column to the metadata value dictionary. The column itself is
+	// populated from C++ after this runs, where the numeric inference happens per distinct value
+	static const FString ConvertFromSchemaTwoToThreeQuery = R"SchmStrnLtr(
+		BEGIN TRANSACTION;
+
+		ALTER TABLE AttributeValues ADD COLUMN NumericValue REAL;
+
+		DROP VIEW IF EXISTS MetaData;
+
+		CREATE VIEW MetaData AS SELECT VertexToAttribute.vertex_id As Vertex_Id, AttributeKeys.Name As Attribute_Name, AttributeValues.Value As Attribute_Value, AttributeValues.NumericValue As Attribute_NumericValue FROM AttributeValues INNER JOIN VertexToAttribute ON AttributeValues.rowid = VertexToAttribute.value_id INNER JOIN AttributeKeys ON AttributeKeys.rowid = VertexToAttribute.key_id;
+
+		END TRANSACTION;
+
+		PRAGMA user_version = 3;)SchmStrnLtr";
 }
 
 
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "PointCloudSliceAndDiceCommandlet.h"
+#include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Engine/World.h"
 #include "Engine/Level.h"
@@ -106,6 +107,40 @@ int32 USliceAndDiceCommandlet::Main(const FString& Params)
 		return 1;
 	}
 
+	// Work partitioning: -Partition=I/N makes this invocation execute only the mappings assigned to
+	// worker I of N. Mappings are assigned round-robin in enumeration order, which is deterministic
+	// for a given world, so N invocations with the same world and manager arguments cover every
+	// mapping exactly once. -WriteManifest=<file> enumerates the assignments instead of running,
+	// so a build coordinator can fan the partitions out to its workers
+	FString PartitionStr;
+	if (FParse::Value(*Params, TEXT("Partition="), PartitionStr))
+	{
+		FString IndexStr, CountStr;
+		if (!PartitionStr.Split(TEXT("/"), &IndexStr, &CountStr) ||
+			!LexTryParseString(PartitionIndex, *IndexStr) ||
+			!LexTryParseString(PartitionCount, *CountStr) ||
+			PartitionCount <= 0 || PartitionIndex < 0 || PartitionIndex >= PartitionCount)
+		{
+			UE_LOG(LogSliceAndDiceCommandlet, Error, TEXT("Invalid -Partition argument '%s', expected <Index>/<Count> with 0 <= Index < Count"), *PartitionStr);
+			return 1;
+		}
+	}
+
+	FParse::Value(*Params, TEXT("WriteManifest="), ManifestPath);
+
+	if ((PartitionCount > 0 || !ManifestPath.IsEmpty()) && !bRun)
+	{
+		UE_LOG(LogSliceAndDiceCommandlet, Error, TEXT("-Partition and -WriteManifest only apply to 'Run'"));
+		return 1;
+	}
+
+	int32 NumManifestWorkers = 0;
+	if (!ManifestPath.IsEmpty() && (!FParse::Value(*Params, TEXT("Workers="), NumManifestWorkers) || NumManifestWorkers <= 0))
+	{
+		UE_LOG(LogSliceAndDiceCommandlet, Error, TEXT("-WriteManifest requires -Workers=<Count> with a positive worker count"));
+		return 1;
+	}
+
 	if (bVerbose)
 	{
 		LogSliceAndDiceCommandlet.SetVerbosity(ELogVerbosity::Verbose);
@@ -164,9 +199,51 @@ int32 USliceAndDiceCommandlet::Main(const FString& Params)
 		}
 	}
 
+	// Coordinator mode: enumerate the partition each mapping would run under and write the manifest
+	// instead of executing. Workers then invoke the commandlet with -Run -Partition=<Index>/<Workers>;
+	// each commits its own actor packages, so the merge is the union of the workers' changelists
+	if (bSuccess && !ManifestPath.IsEmpty())
+	{
+		TArray<FString> ManifestLines;
+		ManifestLines.Add(TEXT("# Partition, Manager, MappingIndex, PointCloud, RuleSet"));
+
+		int32 GlobalMappingIndex = 0;
+		for (ASliceAndDiceManager* Manager : Managers)
+		{
+			for (int32 MappingIndex = 0; MappingIndex < Manager->Mappings.Num(); ++MappingIndex)
+			{
+				const USliceAndDiceMapping* Mapping = Manager->Mappings[MappingIndex];
+				ManifestLines.Add(FString::Printf(TEXT("%d, %s, %d, %s, %s"),
+					GlobalMappingIndex % NumManifestWorkers,
+					*Manager->GetActorLabel(),
+					MappingIndex,
+					Mapping ? *Mapping->PointCloud.ToString() : TEXT("None"),
+					Mapping ? *Mapping->RuleSet.ToString() : TEXT("None")));
+				++GlobalMappingIndex;
+			}
+		}
+
+		if (FFileHelper::SaveStringArrayToFile(ManifestLines, *ManifestPath))
+		{
+			UE_LOG(LogSliceAndDiceCommandlet, Display, TEXT("Wrote partition manifest for %d mappings across %d workers to %s"), GlobalMappingIndex, NumManifestWorkers, *ManifestPath);
+		}
+		else
+		{
+			UE_LOG(LogSliceAndDiceCommandlet, Error, TEXT("Unable to write partition manifest to %s"), *ManifestPath);
+			bSuccess = false;
+		}
+
+		World->DestroyWorld(/*bBroadcastWorldDestroyedEvent=*/false);
+
+		return bSuccess ? 0 : 1;
+	}
+
 	bool bGatherActors = (bRun || bClean) && (bCommitChanges || bMoveChangesToNewChangelist) && World->GetWorldPartition() != nullptr;
 	TSet<FString> ChangedFilesSet;
 
+	// Round-robin counter matching the manifest enumeration when this invocation is a partition worker
+	int32 GlobalMappingIndex = 0;
+
 	for (ASliceAndDiceManager* Manager : Managers)
 	{
 		if (!bSuccess)
@@ -181,8 +258,32 @@ int32 USliceAndDiceCommandlet::Main(const FString& Params)
 
 		if (bRun)
 		{
-			UE_LOG(LogSliceAndDiceCommandlet, Display, TEXT("Running all rules on %s..."), *(Manager->GetActorLabel()));
-			bSuccess &= Manager->RunRules();
+			if (PartitionCount > 0)
+			{
+				TArray<USliceAndDiceMapping*> AssignedMappings;
+				for (USliceAndDiceMapping* Mapping : Manager->Mappings)
+				{
+					if ((GlobalMappingIndex++ % PartitionCount) == PartitionIndex)
+					{
+						AssignedMappings.Add(Mapping);
+					}
+				}
+
+				if (AssignedMappings.Num() > 0)
+				{
+					UE_LOG(LogSliceAndDiceCommandlet, Display, TEXT("Running rules on %d of %d mappings on %s (partition %d/%d)..."), AssignedMappings.Num(), Manager->Mappings.Num(), *(Manager->GetActorLabel()), PartitionIndex, PartitionCount);
+					bSuccess &= Manager->RunRulesOnMappings(AssignedMappings);
+				}
+				else
+				{
+					UE_LOG(LogSliceAndDiceCommandlet, Display, TEXT("No mappings assigned to partition %d/%d on %s, skipping"), PartitionIndex, PartitionCount, *(Manager->GetActorLabel()));
+				}
+			}
+			else
+			{
+				UE_LOG(LogSliceAndDiceCommandlet, Display, TEXT("Running all rules on %s..."), *(Manager->GetActorLabel()));
+				bSuccess &= Manager->RunRules();
+			}
 		}
 		else if (bClean)
 		{
@@ -4,7 +4,9 @@
 #include "PointCloudSliceAndDiceRuleInstance.h"
 #include "PointCloudSliceAndDiceContext.h"
 #include "PointCloudSliceAndDiceManager.h"
+#include "PointCloudSliceAndDiceRule.h"
 #include "PointCloudWorldPartitionHelpers.h"
+#include "Async/Async.h"
 #include "Engine/World.h"
 #include "WorldPartition/WorldPartition.h"
 #include "GameFramework/Actor.h"
@@ -24,6 +26,11 @@ static TAutoConsoleVariable<int32> CVarBatchIterationFrequency(
 	8192,
 	TEXT("Control how frequently Rule Processor will do internal cleanup (save, unload, GC) when generating lots of actors."));
 
+static TAutoConsoleVariable<int32> CVarPipelinedQueryPrefetch(
+	TEXT("t.RuleProcessor.PipelinedQueryPrefetch"),
+	0,
+	TEXT("If non-zero, single threaded execution issues the next generator rule instance's skip-check hash query on a worker thread while the current sibling runs, overlapping read-only query work with game thread actor spawning."));
+
 FSliceAndDiceExecutionContext::FSliceAndDiceExecutionContext(const FSliceAndDiceContext& InContext, bool bSaveAndUnload)
 {
 	World = InContext.GetOriginatingWorld();
@@ -81,6 +88,8 @@ bool FSliceAndDiceExecutionContext::CanSkipExecution(FPointCloudRuleInstance* In
 	}
 
 	// 3) The mapping results hash is the same as the previous execution
+	// Note that the hashes are served from the mapping's view hash cache when no import has touched
+	// the region the views read, in which case this check runs no query at all
 	if(!RuleActors->ContainsHash(InRule->GetParentHash(), InRule->GetHash()))
 	{
 		return false;
@@ -325,6 +334,27 @@ bool FSliceAndDiceExecutionContext::CommitAndCleanup()
 
 namespace SliceAndDiceExecution
 {
+	namespace
+	{
+		/** Computes a generator instance's skip-check hash on a worker thread ahead of its turn.
+		* A generator's hash reads only its parent's (already materialized) view and its own rule data,
+		* so it can be issued while the previous sibling is still spawning actors on the game thread;
+		* by the time the instance's own pre-execute runs the hash check, the mapping's view hash
+		* cache is warm. Filters are excluded as their hash depends on their own execution, and a
+		* prefetch that turns out to be unneeded only warms the cache. */
+		TFuture<void> PrefetchInstanceHash(FPointCloudRuleInstancePtr InRule)
+		{
+			if (InRule->GetRule() == nullptr ||
+				InRule->GetRule()->GetType() != UPointCloudRule::RuleType::GENERATOR ||
+				InRule->GetManagedActors() == nullptr)
+			{
+				return TFuture<void>();
+			}
+
+			return Async(EAsyncExecution::ThreadPool, [InRule]() { InRule->GetHash(); });
+		}
+	}
+
 	void SingleThreadedRuleInstanceExecute(FPointCloudRuleInstancePtr InRule, FSliceAndDiceExecutionContextPtr Context)
 	{
 		check(InRule);
@@ -332,9 +362,26 @@ namespace SliceAndDiceExecution
 
 		if(!InRule->IsSkipped() && !InRule->AreChildrenSkipped())
 		{
-			for (FPointCloudRuleInstancePtr Child : InRule->Children)
+			// Only pipeline from the game thread; in multithreaded executor mode siblings already
+			// overlap through the task graph and a nested prefetch would just add contention
+			const bool bPipelineQueries = CVarPipelinedQueryPrefetch.GetValueOnAnyThread() != 0 && IsInGameThread();
+			TFuture<void> PendingPrefetch;
+
+			for (int32 ChildIndex = 0; ChildIndex < InRule->Children.Num(); ++ChildIndex)
 			{
-				SingleThreadedRuleInstanceExecute(Child, Context);
+				if (bPipelineQueries && ChildIndex + 1 < InRule->Children.Num())
+				{
+					PendingPrefetch = PrefetchInstanceHash(InRule->Children[ChildIndex + 1]);
+				}
+
+				SingleThreadedRuleInstanceExecute(InRule->Children[ChildIndex], Context);
+
+				// Join before the next sibling executes so its hash query never runs on two threads at once
+				if (PendingPrefetch.IsValid())
+				{
+					PendingPrefetch.Wait();
+					PendingPrefetch = TFuture<void>();
+				}
 			}
 		}
 
@@ -769,6 +769,75 @@ void USliceAndDiceMapping::PostExecute(UWorld* InWorld, TArray<TSoftObjectPtr<AA
 	}
 }
 
+bool USliceAndDiceMapping::FindCachedViewHash(const FString& InViewKey, FString& OutHash) const
+{
+	UPointCloud* LoadedPointCloud = PointCloud.Get();
+
+	if (!LoadedPointCloud)
+	{
+		return false;
+	}
+
+	FScopeLock Lock(&CachedViewHashesLock);
+
+	if (CachedViewHashesPointCloud != PointCloud.ToSoftObjectPath())
+	{
+		return false;
+	}
+
+	const FSliceAndDiceCachedViewHash* Entry = CachedViewHashes.Find(InViewKey);
+
+	if (!Entry)
+	{
+		return false;
+	}
+
+	// An entry recorded at a revision the cloud has not reached was computed against data that has
+	// since been rolled back (e.g. the cloud was not saved alongside the manager)
+	if (Entry->ImportRevisionNumber > LoadedPointCloud->GetImportRevisionNumber())
+	{
+		return false;
+	}
+
+	if (!LoadedPointCloud->IsRegionUntouchedSince(Entry->ConsumedBounds, Entry->ImportRevisionNumber))
+	{
+		return false;
+	}
+
+	OutHash = Entry->Hash;
+	return true;
+}
+
+void USliceAndDiceMapping::CacheViewHash(const FString& InViewKey, const FBox& InConsumedBounds, const FString& InHash)
+{
+	// Bound the cache footprint; entries keyed on filter statements go stale as rules change
+	const int32 MaxCachedViewHashes = 4096;
+
+	UPointCloud* LoadedPointCloud = PointCloud.Get();
+
+	if (!LoadedPointCloud || InHash.IsEmpty())
+	{
+		return;
+	}
+
+	FScopeLock Lock(&CachedViewHashesLock);
+
+	if (CachedViewHashesPointCloud != PointCloud.ToSoftObjectPath())
+	{
+		CachedViewHashes.Empty();
+		CachedViewHashesPointCloud = PointCloud.ToSoftObjectPath();
+	}
+	else if (CachedViewHashes.Num() >= MaxCachedViewHashes && !CachedViewHashes.Contains(InViewKey))
+	{
+		CachedViewHashes.Empty();
+	}
+
+	FSliceAndDiceCachedViewHash& Entry = CachedViewHashes.FindOrAdd(InViewKey);
+	Entry.Hash = InHash;
+	Entry.ImportRevisionNumber = LoadedPointCloud->GetImportRevisionNumber();
+	Entry.ConsumedBounds = InConsumedBounds;
+}
+
 void USliceAndDiceManagedActors::PreExecute(const TArray<FPointCloudRuleInstancePtr>& RootInstances, UWorld* World, USliceAndDiceMapping* InMapping, TArray<TSoftObjectPtr<AActor>>& OutLoadedActorsToDelete)
 {
 	// Go through full hierarchy, reset execution flags
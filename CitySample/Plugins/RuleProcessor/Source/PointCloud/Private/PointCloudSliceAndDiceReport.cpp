@@ -40,14 +40,27 @@ FPointCloudSliceAndDiceReport::FPointCloudSliceAndDiceReport(bool InIsActive, EP
 
 void FPointCloudSliceAndDiceReport::PushFrame(const FString& Name)
 {
-	Frames.Emplace(MakeShared<FPointCloudSliceAndDiceReportFrame>(ReportingLevel, Name));
+	// Inactive reports still maintain the frame stack so rule instances always have a frame
+	// to record into, but the frames are marked inactive and discard anything recorded
+	FPointCloudSliceAndDiceReportFramePtr Frame = MakeShared<FPointCloudSliceAndDiceReportFrame>(ReportingLevel, bIsActive ? Name : FString());
+	Frame->bIsActive = bIsActive;
+	Frames.Emplace(MoveTemp(Frame));
 }
 
 void FPointCloudSliceAndDiceReport::PushFrame(const UPointCloudRule* InRule)
 {
 	if (InRule == nullptr)
 	{
-		return; 
+		return;
+	}
+
+	if (bIsActive == false)
+	{
+		// Nothing in this frame will ever be displayed; skip the name formatting
+		FPointCloudSliceAndDiceReportFramePtr Frame = MakeShared<FPointCloudSliceAndDiceReportFrame>(ReportingLevel, FString(), InRule);
+		Frame->bIsActive = false;
+		Frames.Emplace(MoveTemp(Frame));
+		return;
 	}
 
 	FString Name = FString::Printf(TEXT("%s (%s)"), *InRule->RuleName(), *InRule->Label);
@@ -88,11 +101,14 @@ void FPointCloudSliceAndDiceReportFrame::ToString(FString& InOutString, int Dept
 		{
 			switch (Entry->Type)
 			{
-			case FPointCloudSliceAndDiceReportEntry::EntryType::Message:				
-				PRINT_LINE_INDENT(Entry->MessageString);				
-				break; 
-			case FPointCloudSliceAndDiceReportEntry::EntryType::Frame:								
-				Entry->Frame->ToString(InOutString, Depth +1);									
+			case FPointCloudSliceAndDiceReportEntry::EntryType::Message:
+				PRINT_LINE_INDENT(Entry->MessageString);
+				break;
+			case FPointCloudSliceAndDiceReportEntry::EntryType::Parameter:
+				PRINT_LINE_INDENT(Entry->ToString());
+				break;
+			case FPointCloudSliceAndDiceReportEntry::EntryType::Frame:
+				Entry->Frame->ToString(InOutString, Depth +1);
 				break;
 			}
 		}
@@ -104,6 +120,24 @@ void FPointCloudSliceAndDiceReportFrame::ToString(FString& InOutString, int Dept
 	}
 }
 
+FString FPointCloudSliceAndDiceReportEntry::ToString() const
+{
+	switch (Type)
+	{
+	case EntryType::Parameter:
+		if (bNumericValue)
+		{
+			return FString::Printf(TEXT("%s = %lld"), *MessageString, NumericValue);
+		}
+		else
+		{
+			return MessageString + TEXT(" = ") + ValueString;
+		}
+	default:
+		return MessageString;
+	}
+}
+
 void FPointCloudSliceAndDiceReport::AddBreak()
 {
 	AddMessage(LINE_TERMINATOR);
@@ -150,10 +184,10 @@ void FPointCloudSliceAndDiceReport::PushMessage(const FString& Message)
 
 void FPointCloudSliceAndDiceReport::PushParameter(const FString& Name, const FString& Value)
 {
-	TStringBuilder<64> Builder;
-	Builder.Append(Name).Append(TEXT("=")).Append(Value);
-
-	PushMessage(Builder.ToString());
+	if (CurrentFrame())
+	{
+		CurrentFrame()->PushParameter(Name, Value);
+	}
 }
 
 FString FPointCloudSliceAndDiceReport::ToString() const
@@ -169,15 +203,18 @@ FString FPointCloudSliceAndDiceReport::ToString() const
 
 void FPointCloudSliceAndDiceReport::AddParameter(const FString& Name, const FString& Value)
 {
-	TStringBuilder<64> Builder;
-	Builder.Append(Name).Append(TEXT("=")).Append(Value);
-	
-	AddMessage(Builder.ToString());
+	if (CurrentFrame())
+	{
+		CurrentFrame()->AddParameter(Name, Value);
+	}
 }
 
 void FPointCloudSliceAndDiceReport::AddParameter(const FString& Name, int Value)
 {
-	AddParameter(Name, FString::FromInt(Value));
+	if (CurrentFrame())
+	{
+		CurrentFrame()->AddParameter(Name, Value);
+	}
 }
 
 FPointCloudSliceAndDiceReportFramePtr FPointCloudSliceAndDiceReport::CurrentFrame()
@@ -216,7 +253,13 @@ FPointCloudSliceAndDiceRuleReporter::FPointCloudSliceAndDiceRuleReporter(const U
 	if (Rule != nullptr)
 	{
 		Context.ReportObject.PushFrame(InRule);
-		Rule->ReportParameters(Context);
+
+		// Parameter reporting only builds strings for display; skip it entirely when the
+		// report will never be shown (execute-only runs)
+		if (Context.ReportObject.GetIsActive())
+		{
+			Rule->ReportParameters(Context);
+		}
 	}
 }
 
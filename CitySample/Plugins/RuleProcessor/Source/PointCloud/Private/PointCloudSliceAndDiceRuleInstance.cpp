@@ -5,7 +5,9 @@
 #include "PointCloudView.h"
 #include "PointCloudSliceAndDiceRule.h"
 #include "PointCloudSliceAndDiceExecutionContext.h"
+#include "PointCloudSliceAndDiceManager.h"
 #include "GameFramework/Actor.h"
+#include "Misc/SecureHash.h"
 
 FPointCloudRuleInstance::FPointCloudRuleInstance(const FPointCloudRuleInstance& InToCopy, FPointCloudRuleData* InData)
 {
@@ -29,6 +31,12 @@ FPointCloudRuleInstance::FPointCloudRuleInstance(const FPointCloudRuleInstance&
 
 void FPointCloudRuleInstance::ClearView()
 {
+	if (View != nullptr)
+	{
+		// Drop any pins this instance is still holding so the tables become evictable again
+		View->UnpinFilterResultTables();
+	}
+
 	if (View != nullptr && Parent != nullptr && Parent->GetView() != nullptr)
 	{
 		Parent->GetView()->RemoveChildView(View);
@@ -173,6 +181,14 @@ bool FPointCloudRuleInstance::PreExecute(FSliceAndDiceExecutionContextPtr Contex
 		Context->KeepUntouchedActors(this);
 	}
 
+	if (bExecuteOk && !IsSkipped() && View)
+	{
+		// Pin this rule's intermediate result tables for as long as its children are executing, so
+		// branches sharing the same sub-filters reuse the materialized tables instead of re-running
+		// them if the temporary table cache churns. Released in PostExecute
+		View->PinFilterResultTables();
+	}
+
 	return bExecuteOk;
 }
 
@@ -185,6 +201,13 @@ bool FPointCloudRuleInstance::PostExecute(FSliceAndDiceExecutionContextPtr Conte
 	else
 	{
 		bool bPostExecuteOk = PostExecuteInternal(Context);
+
+		// All branches below this rule are done with its intermediate result tables
+		if (View)
+		{
+			View->UnpinFilterResultTables();
+		}
+
 		Context->PostExecute(this);
 		return bPostExecuteOk;
 	}
@@ -197,7 +220,41 @@ bool FPointCloudRuleInstance::PostExecuteInternal(FSliceAndDiceExecutionContextP
 
 FString FPointCloudRuleInstance::GetHash()
 {
-	return GetView()->GetHash();
+	return GetViewHashThroughCache(FString(), [this]() { return GetView()->GetHash(); });
+}
+
+FString FPointCloudRuleInstance::GetViewHashThroughCache(const FString& InKeySalt, TFunctionRef<FString()> InComputeHash)
+{
+	// The mapping is only bound to the managed actors while executing; reporting runs compute their hashes directly
+	USliceAndDiceMapping* Mapping = (ManagedActors && GenerateAssets()) ? ManagedActors->GetMapping() : nullptr;
+
+	if (!Mapping)
+	{
+		return InComputeHash();
+	}
+
+	UPointCloudView* RuleView = GetView();
+	const TArray<FString> FilterStatements = RuleView->GetFilterStatements();
+
+	if (InKeySalt.IsEmpty() && FilterStatements.IsEmpty())
+	{
+		// The unfiltered view hash is the whole-database hash, which the point cloud caches itself
+		return InComputeHash();
+	}
+
+	const FString ViewKey = FMD5::HashAnsiString(*(InKeySalt + TEXT("\n") + FString::Join(FilterStatements, TEXT("\n"))));
+
+	FString Hash;
+
+	if (Mapping->FindCachedViewHash(ViewKey, Hash))
+	{
+		return Hash;
+	}
+
+	Hash = InComputeHash();
+	Mapping->CacheViewHash(ViewKey, RuleView->GetSpatialFilterBounds(), Hash);
+
+	return Hash;
 }
 
 FString FPointCloudRuleInstance::GetParentHash()
@@ -44,13 +44,15 @@ bool FPointCloudSliceAndDiceRuleSetExecutor::ExecuteWorkloads()
 
 	if (CVarRuleSetExecutorMultithreaded.GetValueOnAnyThread() != 0)
 	{
-		// Known issue: with the task graph usage like we do, we do not wait until the jobs are done
-		// because 1) we don't know what to wait for until we're executing
-		// and 2) using an event here prevents the task graph from executing
-		// and 3) we have no guarantees that even if we were to dispatch a waiting task that it would
-		//  be executed first
-		// However, the task graph will be "emptied" later in the frame in any case
+		// The instance tree is the dependency graph: children are only dispatched after their parent's
+		// pre-execute has run, and a parent's post-execute only once all of its children completed
+		// (see ExecutingChildCount). Independent subtrees run concurrently on worker threads, while
+		// instances that spawn actors declare a game thread affinity through CanBeExecutedOnAnyThread.
+		// We can't know the full job set up front - jobs dispatch their children as they execute - so
+		// completion is tracked with a job counter and waited on here, pumping the game thread queue
+		// so that game-thread-affine jobs dispatched by workers can make progress.
 		QueueRuleInstances(nullptr, RuleInstances, ExecutionContext);
+		WaitForCompletion();
 	}
 	else // single threaded
 	{
@@ -75,6 +77,8 @@ void FPointCloudSliceAndDiceRuleSetExecutor::QueueRuleInstances(FPointCloudRuleI
 	// NOTE: not true if we move instances in the hierarchy at compilation
 	for (FPointCloudRuleInstancePtr Child : InChildInstances)
 	{
+		++PendingJobCount;
+
 		FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
 			FSimpleDelegateGraphTask::FDelegate::CreateLambda([InParentInstance, Child, ExecutionContext, this]() {
 				Child->PreExecute(ExecutionContext);
@@ -87,6 +91,9 @@ void FPointCloudSliceAndDiceRuleSetExecutor::QueueRuleInstances(FPointCloudRuleI
 				{
 					NotifyParentInstanceThatChildJobIsDone(InParentInstance, ExecutionContext);
 				}
+
+				// Decremented after any child jobs were queued (and counted) so the count can't reach zero early
+				--PendingJobCount;
 			}),
 			GET_STATID(STAT_RuleProcessorExecutionTime),
 			nullptr,
@@ -101,14 +108,30 @@ void FPointCloudSliceAndDiceRuleSetExecutor::QueueRuleInstances(FPointCloudRuleI
 	}
 }
 
+void FPointCloudSliceAndDiceRuleSetExecutor::WaitForCompletion()
+{
+	check(IsInGameThread());
+
+	while (PendingJobCount.load() > 0)
+	{
+		// Run any game-thread-affine jobs (e.g. actor spawning rules) dispatched by worker threads,
+		// then yield so we don't spin while only worker jobs remain
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+		FPlatformProcess::Sleep(0.0f);
+	}
+}
+
 void FPointCloudSliceAndDiceRuleSetExecutor::NotifyParentInstanceThatChildJobIsDone(FPointCloudRuleInstancePtr InInstance, FSliceAndDiceExecutionContextPtr ExecutionContext)
 {
 	if (InInstance && InInstance->EndChildExecution())
 	{
+		++PendingJobCount;
+
 		FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
 			FSimpleDelegateGraphTask::FDelegate::CreateLambda([InInstance, ExecutionContext, this]() {
 				InInstance->PostExecute(ExecutionContext);
 				NotifyParentInstanceThatChildJobIsDone(InInstance->Parent, ExecutionContext);
+				--PendingJobCount;
 				}),
 			GET_STATID(STAT_RuleProcessorExecutionTime),
 			nullptr,
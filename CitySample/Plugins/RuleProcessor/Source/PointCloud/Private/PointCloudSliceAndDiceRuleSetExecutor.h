@@ -20,7 +20,13 @@ private:
 	void QueueRuleInstances(FPointCloudRuleInstancePtr InParentInstance, const TArray<FPointCloudRuleInstancePtr>& InChildInstances, FSliceAndDiceExecutionContextPtr Context);
 	void NotifyParentInstanceThatChildJobIsDone(FPointCloudRuleInstancePtr InInstance, FSliceAndDiceExecutionContextPtr Context);
 
+	/** Process game thread tasks until all dispatched rule instance jobs have completed */
+	void WaitForCompletion();
+
 private:
 	FSliceAndDiceContext& Context;
 	TArray<FPointCloudRuleInstancePtr> RuleInstances;
+
+	/** Number of dispatched rule instance jobs that haven't completed yet */
+	std::atomic<int32> PendingJobCount{ 0 };
 };
\ No newline at end of file
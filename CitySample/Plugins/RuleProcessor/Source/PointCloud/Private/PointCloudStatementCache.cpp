@@ -0,0 +1,132 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "PointCloudStatementCache.h"
+#include "PointCloudImpl.h"
+
+#include "IncludeSQLite.h"
+
+FPointCloudPreparedStatementCache::FPointCloudPreparedStatementCache()
+	: CachedStatements(UPointCloudImpl::GetPreparedStatementCacheSize() + 1)
+	, CacheHits(0)
+	, CacheMisses(0)
+	, CacheSize(UPointCloudImpl::GetPreparedStatementCacheSize())
+{
+
+}
+
+FString FPointCloudPreparedStatementCache::NormalizeQuery(const FString& InQuery)
+{
+	FString Normalized;
+	Normalized.Reserve(InQuery.Len());
+
+	bool bPendingSpace = false;
+
+	for (const TCHAR Char : InQuery)
+	{
+		if (FChar::IsWhitespace(Char))
+		{
+			bPendingSpace = Normalized.Len() > 0;
+		}
+		else
+		{
+			if (bPendingSpace)
+			{
+				Normalized.AppendChar(TEXT(' '));
+				bPendingSpace = false;
+			}
+
+			Normalized.AppendChar(Char);
+		}
+	}
+
+	return Normalized;
+}
+
+sqlite3_stmt* FPointCloudPreparedStatementCache::Acquire(sqlite3* InDatabase, const FString& InQuery)
+{
+	if (InDatabase == nullptr || InQuery.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	const FString Key = NormalizeQuery(InQuery);
+
+	sqlite3_stmt* Statement = nullptr;
+
+	CacheLock.Lock();
+	if (CachedStatements.Contains(Key))
+	{
+		// Check the statement out of the cache so no other caller can bind against it while it is in use
+		Statement = CachedStatements.FindAndTouchRef(Key);
+		CachedStatements.Remove(Key);
+		++CacheHits;
+	}
+	else
+	{
+		++CacheMisses;
+	}
+	CacheLock.Unlock();
+
+	if (Statement == nullptr)
+	{
+		if (sqlite3_prepare_v2(InDatabase, TCHAR_TO_ANSI(*InQuery), -1, &Statement, 0) != SQLITE_OK)
+		{
+			return nullptr;
+		}
+	}
+
+	return Statement;
+}
+
+void FPointCloudPreparedStatementCache::Release(const FString& InQuery, sqlite3_stmt* InStatement)
+{
+	if (InStatement == nullptr)
+	{
+		return;
+	}
+
+	// Leave the statement ready for the next caller to bind. If resetting fails the statement is in an
+	// unknown state and shouldn't be reused
+	sqlite3_clear_bindings(InStatement);
+	if (sqlite3_reset(InStatement) != SQLITE_OK)
+	{
+		sqlite3_finalize(InStatement);
+		return;
+	}
+
+	const FString Key = NormalizeQuery(InQuery);
+
+	sqlite3_stmt* StatementToFinalize = nullptr;
+
+	CacheLock.Lock();
+	if (CachedStatements.Contains(Key))
+	{
+		// Another caller re-compiled the same query while this statement was checked out; keep the cached one
+		StatementToFinalize = InStatement;
+	}
+	else
+	{
+		CachedStatements.Add(Key, InStatement);
+
+		if (CachedStatements.Num() > CacheSize)
+		{
+			StatementToFinalize = *CachedStatements.RemoveLeastRecent();
+		}
+	}
+	CacheLock.Unlock();
+
+	if (StatementToFinalize)
+	{
+		sqlite3_finalize(StatementToFinalize);
+	}
+}
+
+void FPointCloudPreparedStatementCache::FinalizeStatements()
+{
+	CacheLock.Lock();
+	while (CachedStatements.Num() > 0)
+	{
+		sqlite3_finalize(*CachedStatements.RemoveLeastRecent());
+	}
+	CacheLock.Unlock();
+}
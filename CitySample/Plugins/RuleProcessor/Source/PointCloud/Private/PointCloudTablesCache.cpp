@@ -59,8 +59,32 @@ FString FPointCloudTemporaryTablesCache::AddToCache(const FString& InKey, const
 
 	if (TemporaryTables.Num() > CacheSize)
 	{
-		TableToEject = *TemporaryTables.RemoveLeastRecent();
-		++EjectedTablesCount;
+		if (PinCounts.IsEmpty())
+		{
+			TableToEject = *TemporaryTables.RemoveLeastRecent();
+			++EjectedTablesCount;
+		}
+		else
+		{
+			// Evict the least recently used table that isn't pinned. The iterator runs from most to
+			// least recent, so the last unpinned entry seen is the eviction candidate. If every table
+			// is pinned the cache temporarily exceeds its budget rather than dropping a live table
+			FString KeyToEject;
+			for (auto It = TemporaryTables.begin(); It != TemporaryTables.end(); ++It)
+			{
+				if (!PinCounts.Contains(It.Value()))
+				{
+					KeyToEject = It.Key();
+					TableToEject = It.Value();
+				}
+			}
+
+			if (!KeyToEject.IsEmpty())
+			{
+				TemporaryTables.Remove(KeyToEject);
+				++EjectedTablesCount;
+			}
+		}
 	}
 
 #if defined RULEPROCESSOR_ENABLE_LOGGING
@@ -86,8 +110,10 @@ FString FPointCloudTemporaryTablesCache::RemoveLeastRecentNotThreadSafe()
 	{
 		FString TableToDrop = *TemporaryTables.RemoveLeastRecent();
 
-		// Remove from cache
+		// Remove from cache. This path is a full teardown of the temporary tables, so any
+		// outstanding pin is dropped along with the table
 		CacheHits.Remove(TableToDrop);
+		PinCounts.Remove(TableToDrop);
 
 		return TableToDrop;
 	}
@@ -95,4 +121,24 @@ FString FPointCloudTemporaryTablesCache::RemoveLeastRecentNotThreadSafe()
 	{
 		return FString();
 	}
+}
+
+void FPointCloudTemporaryTablesCache::Pin(const FString& InName)
+{
+	CacheLock.Lock();
+	++PinCounts.FindOrAdd(InName, 0);
+	CacheLock.Unlock();
+}
+
+void FPointCloudTemporaryTablesCache::Unpin(const FString& InName)
+{
+	CacheLock.Lock();
+	if (int32* PinCount = PinCounts.Find(InName))
+	{
+		if (--(*PinCount) <= 0)
+		{
+			PinCounts.Remove(InName);
+		}
+	}
+	CacheLock.Unlock();
 }
\ No newline at end of file
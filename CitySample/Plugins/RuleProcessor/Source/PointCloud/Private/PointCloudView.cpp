@@ -4,6 +4,38 @@
 #include "PointCloudImpl.h"
 #include "PointCloudSQLExtensions.h"
 
+namespace
+{
+	// We will increase/decrease values by a small value around the last digit we'll display to make sure we do the proper query
+	FBox ExpandQueryBounds(const FBox& InBounds)
+	{
+		const double Iota = 1.0e-6;
+
+		const FVector BoundsMin = FVector(
+			InBounds.Min.X * (1.0 - FMath::Sign(InBounds.Min.X) * Iota),
+			InBounds.Min.Y * (1.0 - FMath::Sign(InBounds.Min.Y) * Iota),
+			InBounds.Min.Z * (1.0 - FMath::Sign(InBounds.Min.Z) * Iota));
+
+		const FVector BoundsMax = FVector(
+			InBounds.Max.X * (1.0 + FMath::Sign(InBounds.Max.X) * Iota),
+			InBounds.Max.Y * (1.0 + FMath::Sign(InBounds.Max.Y) * Iota),
+			InBounds.Max.Z * (1.0 + FMath::Sign(InBounds.Max.Z) * Iota));
+
+		return FBox(BoundsMin, BoundsMax);
+	}
+
+	// Range constraints on the rtree columns that the rtree module can serve through its index. Custom
+	// functions like IN_SPHERE and IN_OBB are opaque to the module and force a scan of every entry, so
+	// the spatial filters prepend these to narrow the candidate set before the exact test runs
+	FString MakeSpatialIndexProbe(const FBox& InBounds)
+	{
+		return FString::Printf(TEXT("(Minx>=%f AND Maxx<=%f) AND (Miny>=%f AND Maxy<=%f) AND (Minz>=%f AND Maxz<=%f)"),
+			InBounds.Min.X, InBounds.Max.X,
+			InBounds.Min.Y, InBounds.Max.Y,
+			InBounds.Min.Z, InBounds.Max.Z);
+	}
+}
+
 UPointCloudView::~UPointCloudView()
 {
 
@@ -104,7 +136,7 @@ void UPointCloudView::SetParentView(UPointCloudView* InParentView)
 	}
 }
 
-UPointCloudView::UPointCloudView() : PointCloud(nullptr), ParentView(nullptr),  bInGetDataState(false)
+UPointCloudView::UPointCloudView() : PointCloud(nullptr), ParentView(nullptr), SpatialFilterBounds(EForceInit::ForceInit), bInGetDataState(false)
 {
 	ViewGuid = FGuid::NewGuid();
 }
@@ -146,12 +178,15 @@ void UPointCloudView::FilterOnBoundingSphere(const FVector& Center, float Radius
 		return ;
 	}
 
-	FString FullQuery = FString::Printf(TEXT("SELECT Id FROM SpatialQuery WHERE IN_SPHERE( %f, %f, %f, %f, Minx, Miny, Minz)>0"), 										
-										Center.X, Center.Y, Center.Z, 
+	// The batch table-valued function probes the spatial index itself and runs the sphere test over
+	// all candidates at once instead of through a scalar function call per row
+	FString FullQuery = FString::Printf(TEXT("SELECT Id FROM IN_SPHERE_BATCH(%f, %f, %f, %f)"),
+										Center.X, Center.Y, Center.Z,
 										Radius);
 
-	AddFilterStatement(FullQuery);	
-	
+	AddFilterStatement(FullQuery);
+	IntersectSpatialFilterBounds(FBox(Center - FVector(Radius), Center + FVector(Radius)));
+
 	return;
 }
 
@@ -164,29 +199,20 @@ void UPointCloudView::FilterOnBoundingBox(const FBox& Query, bool bInvertSelecti
 
 	FString FullQuery;
 
-	// We will increase/decrease values by a small value around the last digit we'll display to make sure we do the proper query
-	const double Iota = 1.0e-6;
-
-	FVector QueryMin = FVector(
-		Query.Min.X * (1.0 - FMath::Sign(Query.Min.X) * Iota),
-		Query.Min.Y * (1.0 - FMath::Sign(Query.Min.Y) * Iota),
-		Query.Min.Z * (1.0 - FMath::Sign(Query.Min.Z) * Iota));
+	const FBox ExpandedQuery = ExpandQueryBounds(Query);
+	const FVector QueryMin = ExpandedQuery.Min;
+	const FVector QueryMax = ExpandedQuery.Max;
 
-	FVector QueryMax = FVector(
-		Query.Max.X * (1.0 + FMath::Sign(Query.Max.X) * Iota),
-		Query.Max.Y * (1.0 + FMath::Sign(Query.Max.Y) * Iota),
-		Query.Max.Z * (1.0 + FMath::Sign(Query.Max.Z) * Iota));
-	
 	if (!bInvertSelection)
 	{
-		FullQuery = FString::Printf(TEXT("SELECT Id FROM SpatialQuery WHERE (Minx>=%f AND Maxx<=%f) AND (Miny>=%f AND Maxy<=%f) AND (Minz>=%f AND Maxz<=%f)"),			
-			QueryMin.X, QueryMax.X,
-			QueryMin.Y, QueryMax.Y,
-			QueryMin.Z, QueryMax.Z);
+		FullQuery = FString::Printf(TEXT("SELECT Id FROM SpatialQuery WHERE %s"), *MakeSpatialIndexProbe(ExpandedQuery));
+
+		// Inverted selections read from the complement and cannot narrow the spatial bounds
+		IntersectSpatialFilterBounds(ExpandedQuery);
 	}
 	else
 	{
-		FullQuery = FString::Printf(TEXT("SELECT Id FROM SpatialQuery WHERE (Minx<%f OR Maxx>%f) OR (Miny<%f OR Maxy>%f) OR (Minz<%f OR Maxz>%f)"),			
+		FullQuery = FString::Printf(TEXT("SELECT Id FROM SpatialQuery WHERE (Minx<%f OR Maxx>%f) OR (Miny<%f OR Maxy>%f) OR (Minz<%f OR Maxz>%f)"),
 			QueryMin.X, QueryMax.X,
 			QueryMin.Y, QueryMax.Y,
 			QueryMin.Z, QueryMax.Z);
@@ -214,13 +240,22 @@ void UPointCloudView::FilterOnOrientedBoundingBox(const FTransform& InOBB, bool
 	const FVector Translation = InOBB.GetTranslation();
 	const FVector Scale = InOBB.GetScale3D();
 
-	const FString FullQuery = FString::Printf(TEXT("SELECT Id FROM SpatialQuery WHERE %s IN_OBB(%f,%f,%f,%f,%f,%f,%f,%f,%f,Minx,Miny,Minz)"),		
-		bInvertSelection ? TEXT("NOT") : TEXT(""),
+	// The batch table-valued function probes the spatial index itself (when the selection isn't
+	// inverted) and runs the box test over all candidates at once instead of through a scalar
+	// function call per row
+	const FString FullQuery = FString::Printf(TEXT("SELECT Id FROM IN_OBB_BATCH(%f, %f, %f, %f, %f, %f, %f, %f, %f, %d)"),
 		Rotation.Pitch, Rotation.Yaw, Rotation.Roll,
 		Translation.X, Translation.Y, Translation.Z,
-		Scale.X, Scale.Y, Scale.Z);
+		Scale.X, Scale.Y, Scale.Z,
+		bInvertSelection ? 1 : 0);
 
 	AddFilterStatement(FullQuery);
+
+	if (!bInvertSelection)
+	{
+		// The oriented box is the unit box transformed by InOBB; its axis-aligned bound narrows the spatial bounds
+		IntersectSpatialFilterBounds(FBox(FVector(-1.0), FVector(1.0)).TransformBy(InOBB));
+	}
 }
 
 void UPointCloudView::FilterOnTile(int InNumTilesX, int InNumTilesY, int InNumTilesZ, int InTileX, int InTileY, int InTileZ, bool bInvertSelection, EFilterMode Mode)
@@ -307,6 +342,39 @@ void UPointCloudView::FilterOnIndex(int32 Index, EFilterMode Mode)
 	return;
 }
 
+void UPointCloudView::FilterOnIndexes(const TArray<int32>& Indexes, EFilterMode Mode)
+{
+	if (PointCloud == nullptr)
+	{
+		return;
+	}
+
+	if (Indexes.Num() == 0)
+	{
+		UE_LOG(PointCloudLog, Warning, TEXT("No Indexes Given To Filter On"));
+		return;
+	}
+
+	TStringBuilder<4096> Builder;
+	Builder.Append(TEXT("SELECT Id FROM SpatialQuery WHERE Id IN ("));
+
+	for (int32 IndexIndex = 0; IndexIndex < Indexes.Num(); ++IndexIndex)
+	{
+		if (IndexIndex > 0)
+		{
+			Builder.Append(TEXT(","));
+		}
+
+		Builder.Appendf(TEXT("%d"), Indexes[IndexIndex]);
+	}
+
+	Builder.Append(TEXT(")"));
+
+	AddFilterStatement(Builder.ToString());
+
+	return;
+}
+
 void UPointCloudView::FilterOnRange(int32 StartIndex, int32 EndIndex, EFilterMode Mode)
 {
 	if (PointCloud==nullptr)
@@ -699,12 +767,18 @@ TArray<T> UPointCloudView::GetMetadataValuesArray(const FString& Key) const
 		return Result;
 	}
 
+	// Numeric consumers read the typed NumericValue column added in schema version 3 so sqlite
+	// returns native REAL values instead of converting the string dictionary per row. Older
+	// schemas and string consumers keep reading the text column
+	const bool bReadNumericColumn = TIsArithmetic<T>::Value && PointCloud->GetSchemaVersion() >= UPointCloudImpl::POINTCLOUD_VERSION_3;
+
 	FString SelectQuery;
 
 	if (HasFiltersApplied() == false)
 	{
 		const FString MetaDataQuery = GetMetadataQuery();
-		SelectQuery = FString::Printf(TEXT("SELECT Attribute_Value FROM %s WHERE Attribute_Name=\'%s\'"), *MetaDataQuery, *Key);
+		const TCHAR* ValueColumn = bReadNumericColumn ? TEXT("Attribute_NumericValue") : TEXT("Attribute_Value");
+		SelectQuery = FString::Printf(TEXT("SELECT %s AS Attribute_Value FROM %s WHERE Attribute_Name=\'%s\'"), ValueColumn, *MetaDataQuery, *Key);
 	}
 	else
 	{
@@ -726,8 +800,9 @@ TArray<T> UPointCloudView::GetMetadataValuesArray(const FString& Key) const
 		TArray< FStringFormatArg > args;
 		args.Add(FStringFormatArg(AttributeTempTable));
 		args.Add(FStringFormatArg(ResultTable));
+		args.Add(FStringFormatArg(bReadNumericColumn ? TEXT("NumericValue") : TEXT("Value")));
 
-		SelectQuery = FString::Format(TEXT("SELECT AttributeValues.Value AS Attribute_Value FROM {1} INNER JOIN {0} ON {1}.Id = {0}.Id JOIN AttributeValues ON ValueId=AttributeValues.rowid"), args);
+		SelectQuery = FString::Format(TEXT("SELECT AttributeValues.{2} AS Attribute_Value FROM {1} INNER JOIN {0} ON {1}.Id = {0}.Id JOIN AttributeValues ON ValueId=AttributeValues.rowid"), args);
 	}
 
 	Result = PointCloud->GetValueArray<T>(SelectQuery);
@@ -835,9 +910,18 @@ void UPointCloudView::PreCacheFilters()
 }
 
 FString UPointCloudView::GetFilterResultTable(bool bSilentOnNoFilter) const
+{
+	const TArray<FString> Chain = GetFilterResultTableChain(bSilentOnNoFilter);
+
+	return Chain.Num() ? Chain.Last() : FString();
+}
+
+TArray<FString> UPointCloudView::GetFilterResultTableChain(bool bSilentOnNoFilter) const
 {
 	const TArray<FString> Filters = GetFilterStatements();
 
+	TArray<FString> Chain;
+
 	if (Filters.Num() == 0)
 	{
 		if (!bSilentOnNoFilter)
@@ -845,26 +929,53 @@ FString UPointCloudView::GetFilterResultTable(bool bSilentOnNoFilter) const
 			UE_LOG(PointCloudLog, Warning, TEXT("No Filters On View. GetTransformsIntermediates Only works with Views on which filters have been applied"));
 		}
 
-		return FString();
+		return Chain;
 	}
 
-	FString TableName;
+	FString TableName = PointCloud->GetTemporaryQueryTable(Filters[0]);
+	Chain.Add(TableName);
 
-	if (Filters.Num() == 1)
+	// go through each pair of filters, creating intersection tables for them in order
+	for (int i = 1; i < Filters.Num(); i++)
 	{
-		TableName = PointCloud->GetTemporaryQueryTable(Filters[0]);
+		TableName = PointCloud->GetTemporaryIntersectionTable(UPointCloudImpl::EArgumentType::Table, TableName, UPointCloudImpl::EArgumentType::Query, Filters[i]);
+		Chain.Add(TableName);
 	}
-	else if (Filters.Num() > 1)
+
+	return Chain;
+}
+
+void UPointCloudView::PinFilterResultTables()
+{
+	if (PinnedResultTables.Num() || PointCloud == nullptr)
+	{
+		// Already pinned; pins are held until UnpinFilterResultTables
+		return;
+	}
+
+	// Materializing the chain here means sibling branches extending this view find every
+	// intermediate table already built, and the pins keep them resident until the branches finish
+	for (const FString& TableName : GetFilterResultTableChain(/*bSilentOnNoFilter=*/true))
 	{
-		TableName = PointCloud->GetTemporaryQueryTable(Filters[0]);
-		// go through each pair of filters, creating intersection tables for them in order
-		for (int i = 1; i < Filters.Num(); i++)
+		if (!TableName.IsEmpty())
 		{
-			TableName = PointCloud->GetTemporaryIntersectionTable(UPointCloudImpl::EArgumentType::Table, TableName, UPointCloudImpl::EArgumentType::Query, Filters[i]);
+			PointCloud->PinTemporaryTable(TableName);
+			PinnedResultTables.Add(TableName);
 		}
 	}
-	
-	return TableName;
+}
+
+void UPointCloudView::UnpinFilterResultTables()
+{
+	if (PointCloud != nullptr)
+	{
+		for (const FString& TableName : PinnedResultTables)
+		{
+			PointCloud->UnpinTemporaryTable(TableName);
+		}
+	}
+
+	PinnedResultTables.Reset();
 }
 
 TArray<FString> UPointCloudView::GetFilterStatements() const
@@ -877,7 +988,47 @@ TArray<FString> UPointCloudView::GetFilterStatements() const
 	}
 
 	Result.Append(FilterStatementList);
-	
+
+	return Result;
+}
+
+void UPointCloudView::IntersectSpatialFilterBounds(const FBox& InBounds)
+{
+	if (!InBounds.IsValid)
+	{
+		return;
+	}
+
+	if (SpatialFilterBounds.IsValid)
+	{
+		// Note that the overlap of disjoint boxes is an invalid box, which stands for an unconstrained
+		// view; that only makes the bound looser than it could be, never wrong
+		SpatialFilterBounds = SpatialFilterBounds.Overlap(InBounds);
+	}
+	else
+	{
+		SpatialFilterBounds = InBounds;
+	}
+}
+
+FBox UPointCloudView::GetSpatialFilterBounds() const
+{
+	FBox Result = SpatialFilterBounds;
+
+	if (ParentView != nullptr)
+	{
+		const FBox ParentBounds = ParentView->GetSpatialFilterBounds();
+
+		if (Result.IsValid && ParentBounds.IsValid)
+		{
+			Result = Result.Overlap(ParentBounds);
+		}
+		else if (ParentBounds.IsValid)
+		{
+			Result = ParentBounds;
+		}
+	}
+
 	return Result;
 }
 
@@ -941,31 +1092,37 @@ TArray<FTransform> UPointCloudView::GetTransforms() const
 	return PointCloud->GetValueArray<FTransform>(GetTransformsQuery);
 }
 
-TArray<TPair<int32, FTransform>> UPointCloudView::GetPerIdTransforms() const
+FString UPointCloudView::GetPerIdTransformsQuery() const
 {
-	if (PointCloud == nullptr)
+	if (HasFiltersApplied() == false)
 	{
-		UE_LOG(PointCloudLog, Warning, TEXT("Point Cloud Is NULL"));
-		return TArray<TPair<int32, FTransform>>();
+		return FString::Printf(TEXT("SELECT rowid as Id, Vertex.x, Vertex.y, Vertex.z, Vertex.nx, Vertex.ny, Vertex.nz, Vertex.nw, Vertex.sx, Vertex.sy, Vertex.sz FROM Vertex"));
 	}
 
-	FString GetIdAndTransformQuery;
+	// return all of the transforms / ids remaining after the filters have been applied
+	const FString ResultTableName = GetFilterResultTable();
 
-	if (HasFiltersApplied() == false)
+	if (ResultTableName.IsEmpty())
 	{
-		GetIdAndTransformQuery = FString::Printf(TEXT("SELECT rowid as Id, Vertex.x, Vertex.y, Vertex.z, Vertex.nx, Vertex.ny, Vertex.nz, Vertex.nw, Vertex.sx, Vertex.sy, Vertex.sz FROM Vertex"));
+		return FString();
 	}
-	else
+
+	return FString::Printf(TEXT("SELECT Id, Vertex.x, Vertex.y, Vertex.z, Vertex.nx, Vertex.ny, Vertex.nz, Vertex.nw, Vertex.sx, Vertex.sy, Vertex.sz FROM %s INNER JOIN Vertex ON Id = Vertex.rowid; "), *ResultTableName);
+}
+
+TArray<TPair<int32, FTransform>> UPointCloudView::GetPerIdTransforms() const
+{
+	if (PointCloud == nullptr)
 	{
-		// return all of the transforms / ids remaining after the filters have been applied
-		const FString ResultTableName = GetFilterResultTable();
+		UE_LOG(PointCloudLog, Warning, TEXT("Point Cloud Is NULL"));
+		return TArray<TPair<int32, FTransform>>();
+	}
 
-		if (ResultTableName.IsEmpty())
-		{
-			return TArray<TPair<int32, FTransform>>();
-		}
+	const FString GetIdAndTransformQuery = GetPerIdTransformsQuery();
 
-		GetIdAndTransformQuery = FString::Printf(TEXT("SELECT Id, Vertex.x, Vertex.y, Vertex.z, Vertex.nx, Vertex.ny, Vertex.nz, Vertex.nw, Vertex.sx, Vertex.sy, Vertex.sz FROM %s INNER JOIN Vertex ON Id = Vertex.rowid; "), *ResultTableName);
+	if (GetIdAndTransformQuery.IsEmpty())
+	{
+		return TArray<TPair<int32, FTransform>>();
 	}
 
 	return PointCloud->GetValuePairArray<int, FTransform>(GetIdAndTransformQuery);
@@ -987,6 +1144,52 @@ int UPointCloudView::GetTransformsAndIds(TArray<FTransform>& OutTransforms, TArr
 	return OutTransforms.Num();
 }
 
+int UPointCloudView::GetTransformsAndIds(TFunctionRef<void(TArray<FTransform>&, TArray<int32>&)> ChunkCallback, int32 MaxChunkSize) const
+{
+	if (PointCloud == nullptr)
+	{
+		UE_LOG(PointCloudLog, Warning, TEXT("Point Cloud Is NULL"));
+		return 0;
+	}
+
+	const FString GetIdAndTransformQuery = GetPerIdTransformsQuery();
+
+	if (GetIdAndTransformQuery.IsEmpty())
+	{
+		return 0;
+	}
+
+	MaxChunkSize = FMath::Max(MaxChunkSize, 1);
+
+	TArray<FTransform> TransformChunk;
+	TArray<int32> IdChunk;
+	TransformChunk.Reserve(MaxChunkSize);
+	IdChunk.Reserve(MaxChunkSize);
+
+	int Count = 0;
+
+	PointCloud->ForEachValuePair<int, FTransform>(GetIdAndTransformQuery, [&ChunkCallback, &TransformChunk, &IdChunk, &Count, MaxChunkSize](const int& Id, const FTransform& Transform) {
+		TransformChunk.Add(Transform);
+		IdChunk.Add(Id);
+		++Count;
+
+		if (TransformChunk.Num() >= MaxChunkSize)
+		{
+			ChunkCallback(TransformChunk, IdChunk);
+			TransformChunk.Reset();
+			IdChunk.Reset();
+		}
+		});
+
+	// Flush the final partial chunk
+	if (TransformChunk.Num() > 0)
+	{
+		ChunkCallback(TransformChunk, IdChunk);
+	}
+
+	return Count;
+}
+
 FString UPointCloudView::GetValuesAndTransformsHash(const TArray<FString>& Keys) const
 {
 	if (Keys.Num() == 0)
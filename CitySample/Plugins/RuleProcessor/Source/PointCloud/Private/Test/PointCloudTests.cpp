@@ -178,6 +178,41 @@ bool FPointCloudGetValueTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPointCloudBatchedWriteTest, FPointCloudTestBaseClass, "RuleProcessor.PointCloud.BatchedWrite", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+// Run some basic tests where we create a point cloud and write rows through the batched write path
+bool FPointCloudBatchedWriteTest::RunTest(const FString& Parameters)
+{
+	// Make the test pass by returning true, or fail by returning false.
+	FAssetDeleter<UPointCloud> P(CreateTestAsset());
+
+	UPointCloudImpl* PC = static_cast<UPointCloudImpl*>(P.Get());
+
+	TestTrue("Create target table", PC->RunQuery(TEXT("CREATE TEMPORARY TABLE BatchedWriteTest (Name TEXT, Value TEXT)")));
+
+	const int NumRows = 100;
+
+	TArray<TArray<FString>> Rows;
+	Rows.Reserve(NumRows);
+	for (int I = 0; I < NumRows; ++I)
+	{
+		Rows.Add({ FString::Printf(TEXT("Name %d"), I), FString::Printf(TEXT("Value 'with quotes' %d"), I) });
+	}
+
+	TestTrue("Run batched write", PC->RunBatchedWrite(TEXT("INSERT INTO BatchedWriteTest VALUES(?, ?)"), Rows));
+
+	int Count = PC->GetValue<int>("SELECT COUNT(*) FROM BatchedWriteTest", "COUNT(*)");
+
+	TestTrue("Check the right number of rows was written", Count == NumRows);
+
+	// Check that the bound values were not mangled by any escaping
+	FString QuotedValue = PC->GetValue<FString>("SELECT Value FROM BatchedWriteTest WHERE Name = 'Name 0'", "Value");
+
+	TestTrue("Check bound values round trip", QuotedValue == TEXT("Value 'with quotes' 0"));
+
+	return true;
+}
+
 IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPointCloudLoadFromPoints, FPointCloudTestBaseClass, "RuleProcessor.PointCloud.LoadFromPoints", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
 
 // Run some basic tests where we create a point cloud and run a basic query
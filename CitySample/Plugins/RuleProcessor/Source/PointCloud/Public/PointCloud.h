@@ -34,6 +34,24 @@ struct POINTCLOUD_API FPointCloudPoint
 	TMap<FString, FString> Attributes;
 };
 
+/**
+* Records the region affected by a single import into a point cloud, so consumers can check
+* whether the data they previously read has been touched since they last ran
+*/
+USTRUCT()
+struct POINTCLOUD_API FPointCloudDirtyRegion
+{
+	GENERATED_BODY()
+
+	/** Import revision at which this region was touched */
+	UPROPERTY()
+	uint64 ImportRevisionNumber = 0;
+
+	/** The region affected by the import. An invalid box stands for the whole cloud */
+	UPROPERTY()
+	FBox Region = FBox(EForceInit::ForceInit);
+};
+
 /**
  * Implements a prototype point cloud data structure using SQLLITE as the backend
  */
@@ -228,7 +246,28 @@ public: // I/O Interface
 	* @return True if the given file is included in this pointcloud
 	*/
 	bool IsFileLoaded(const FString& Name) const;
-	
+
+public: // ~ Dirty region interface
+
+	/**
+	* Record that an import has modified the given region of the point cloud. This advances the import revision
+	* number, which allows consumers (e.g. the Slice and Dice manager) to test whether the data they previously
+	* read has been touched since they last read it
+	* @param InRegion - The region affected by the import. Pass an invalid box to mark the whole cloud as dirty
+	*/
+	void MarkRegionDirty(const FBox& InRegion);
+
+	/** Return the import revision number of the most recent import into this point cloud */
+	uint64 GetImportRevisionNumber() const { return ImportRevisionNumber; }
+
+	/**
+	* Query whether any import after the given revision has touched the given region
+	* @param InRegion - The region to test. Pass an invalid box to test against the whole cloud
+	* @param InImportRevisionNumber - The revision to test from, typically saved from a previous call to GetImportRevisionNumber
+	* @return True if no import after the given revision intersects the given region
+	*/
+	bool IsRegionUntouchedSince(const FBox& InRegion, uint64 InImportRevisionNumber) const;
+
 public:
 
 	/**
@@ -267,6 +306,14 @@ protected: //Data Section
 	// Store a flag to enable / disable logging of SQL to DISK
 	bool bLoggingEnabled = false;
 
+	/** Monotonically increasing revision number, advanced by every import that touches the database */
+	UPROPERTY()
+	uint64 ImportRevisionNumber = 0;
+
+	/** Regions touched by imports. The oldest entries are collapsed together to bound the size of the list */
+	UPROPERTY()
+	TArray<FPointCloudDirtyRegion> DirtyRegions;
+
 	/** Store pointers to the root views so that they don't get garbage collected while we are processing */
 	UPROPERTY(Transient)
 	TSet<TObjectPtr<UPointCloudView>> RootViews;
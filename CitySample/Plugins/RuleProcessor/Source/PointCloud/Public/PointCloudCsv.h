@@ -17,6 +17,17 @@ public:
 	*/
 	FPointCloudCsv(const TArray<FString>& InStrings, FFeedbackContext* Warn = nullptr);
 
+	/**
+	* Constructor taking the raw contents of the CSV file. The buffer is split into per-worker ranges on
+	* line boundaries and the lines are parsed in parallel directly out of the buffer, so the file never
+	* has to be converted into an intermediate array of line strings. This is the constructor used when
+	* the file could be memory mapped, in which case the data is read straight from the mapping.
+	* @param InData - The contents of the CSV file
+	* @param InSize - The size of the buffer in bytes
+	* @param Warn - A feedback context giving information about the loading progress and allowing the user to cancel
+	*/
+	FPointCloudCsv(const ANSICHAR* InData, int64 InSize, FFeedbackContext* Warn = nullptr);
+
 	/**
 	* Default Constructor
 	*/
@@ -4,6 +4,7 @@
 
 #include "PointCloud.h"
 #include "PointCloudSqliteHelpers.h"
+#include "PointCloudStatementCache.h"
 #include "PointCloudTablesCache.h"
 
 #include "PointCloudImpl.generated.h"
@@ -31,7 +32,8 @@ class POINTCLOUD_API UPointCloudImpl : public UPointCloud
 	{
 		POINTCLOUD_VERSION_INVALID = 0,  // This is an invalid version number. Something is wrong with the point cloud
 		POINTCLOUD_VERSION_1 = 1,  // The default schema version. This is implicit in PCs created before version 2
-		POINTCLOUD_VERSION_2 = 2   // 2/9/2021 - Update to deduplicate metadata values and added Schema Versioning
+		POINTCLOUD_VERSION_2 = 2,  // 2/9/2021 - Update to deduplicate metadata values and added Schema Versioning
+		POINTCLOUD_VERSION_3 = 3   // Added the typed NumericValue column to AttributeValues so numeric metadata reads avoid per-row string conversion
 		// NOTE : When adding new versions to this enum, make sure to update PointCloudSchemaVersion Below
 	};
 
@@ -49,7 +51,7 @@ public: // enums
 		Query		// Argument is query and contains a SELECT statement
 	};
 
-	static const EPointCloudSchemaVersions PointCloudSchemaVersion = EPointCloudSchemaVersions::POINTCLOUD_VERSION_2;
+	static const EPointCloudSchemaVersions PointCloudSchemaVersion = EPointCloudSchemaVersions::POINTCLOUD_VERSION_3;
 
 public:
 
@@ -248,6 +250,71 @@ public: // ~ Query interface
 	*/
 	bool RunQuery(const FString& Query, int (*Callback)(void*, int, char**, char**), void* UsrData, const FString& InOriginatingFile = FString(), const uint32 InOriginatingLine = 0);
 
+	/**
+	* Run a parameterized write statement once for each entry in the given array of rows, inside a single
+	* transaction that is committed once at the end. Sqlite commits implicitly after each statement executed
+	* outside of a transaction, so issuing bulk writes through this method instead of one RunQuery per row
+	* avoids paying for a commit on every row. The statement is compiled once and the values are bound, so
+	* no escaping of the values is required. If any row fails the transaction is rolled back.
+	* @param Query - A parameterized SQL write statement, e.g. "INSERT INTO MyTable VALUES(?, ?)"
+	* @param Rows - One array of parameter values for each execution of the statement
+	* @return True if every row was written and the transaction was committed
+	*/
+	bool RunBatchedWrite(const FString& Query, const TArray<TArray<FString>>& Rows);
+
+public: // ~ Slow query log interface
+
+	/** One record in the slow query log. Captures a query that ran for longer than the threshold set by
+	* the t.RuleProcessor.SlowQueryThresholdMs console variable, along with the plan sqlite used to execute
+	* it and the location in the code the query originated from.
+	*/
+	struct FSlowQueryEntry
+	{
+		/** The query that exceeded the threshold */
+		FString Query;
+		/** The EXPLAIN QUERY PLAN output for the query, one row per line */
+		FString Plan;
+		/** The file the query originated from, if it was provided to RunQuery */
+		FString OriginatingFile;
+		/** The line the query originated from, if it was provided to RunQuery */
+		uint32 OriginatingLine = 0;
+		/** How long the query ran for */
+		double Milliseconds = 0.0;
+	};
+
+	/** Return a copy of the slow query log. Empty unless t.RuleProcessor.SlowQueryThresholdMs is set to a
+	* non-zero threshold before the queries run.
+	* @return The recorded slow query entries, oldest first
+	*/
+	TArray<FSlowQueryEntry> GetSlowQueryLog() const;
+
+	/** Discard the contents of the slow query log */
+	void ClearSlowQueryLog();
+
+	/** Build a human readable report of the slow query log, suitable for display or saving
+	* @return The report, or a note on how to enable recording when the log is empty
+	*/
+	FString GetSlowQueryReport() const;
+
+	/** Build a human readable report of the sqlite page cache counters for this database, including
+	* the cache hit rate. Useful for tuning t.RuleProcessor.DbCacheSizeMb on large point clouds
+	* @return The report, or a note when no database is open
+	*/
+	FString GetDbStatusReport() const;
+
+private:
+
+	/** Record the given query in the slow query log if it ran for longer than the configured threshold.
+	* Captures the plan sqlite used by running EXPLAIN QUERY PLAN on the query.
+	*/
+	void RecordSlowQuery(const FString& Query, double Milliseconds, const FString& InOriginatingFile, uint32 InOriginatingLine);
+
+	/** Queries that exceeded the slow query threshold, oldest first, capped to a fixed number of entries */
+	TArray<FSlowQueryEntry> SlowQueryLog;
+
+	/** Guards the slow query log as queries may be issued from worker threads */
+	mutable FCriticalSection SlowQueryLogLock;
+
 private:
 
 	/** Internal version of the RunQuery method that remove extraneous parameters */
@@ -318,6 +385,28 @@ public:
 	template<typename T, typename U>
 	TArray<TPair<T, U>> GetValuePairArray(const FString& Query, const FString& FirstColumnName = FString(), const FString& SecondColumnName = FString()) const { return GetValuePairArray<T, U>(Query, TArray<FString>({ FirstColumnName }), TArray<FString>({ SecondColumnName })); }
 
+	/**
+	* Run a query over the database, invoking a callback with one pair per row instead of materializing the full result set.
+	* Use this instead of GetValuePairArray when the result set is too large to hold in memory at once.
+	* Note that only some types are supported (int, float, double, FString, FBox, FTransform, TArray)
+	* @param Query - The SQL query to execute on this pointcloud
+	* @param ColumnNames - List of columns to return; use multiple only if type is array.
+	* @param Callback - Called with the values found in the given column(s) of each row of the result set
+	*/
+	template<typename T, typename U>
+	void ForEachValuePair(const FString& Query, const TArray<FString>& FirstColumnNames, const TArray<FString>& SecondColumnNames, TFunctionRef<void(const T&, const U&)> Callback) const;
+
+	/**
+	* Run a query over the database, invoking a callback with one pair per row instead of materializing the full result set.
+	* Use this instead of GetValuePairArray when the result set is too large to hold in memory at once.
+	* Note that only some types are supported (int, float, double, FString, FBox, FTransform, TArray)
+	* @param Query - The SQL query to execute on this pointcloud
+	* @param ColumnName - Name of the column to return, if empty will return the first column.
+	* @param Callback - Called with the values found in the given column(s) of each row of the result set
+	*/
+	template<typename T, typename U>
+	void ForEachValuePair(const FString& Query, TFunctionRef<void(const T&, const U&)> Callback, const FString& FirstColumnName = FString(), const FString& SecondColumnName = FString()) const { ForEachValuePair<T, U>(Query, TArray<FString>({ FirstColumnName }), TArray<FString>({ SecondColumnName }), Callback); }
+
 	/**
 	* Run a query over the database an array containing one entry in the map per row, assuming all keys are different
 	* Note that only some types are supported (int, float, double, FString, FBox, FTransform, TArray)
@@ -391,6 +480,11 @@ public:
 	*/
 	static uint32 GetCacheHitBeforeIndexCount();
 
+	/** Return the number of compiled sqlite statements to keep around, this controls the size of PreparedStatements
+	* @return - The number of prepared statements to cache in the LRU
+	*/
+	static int32 GetPreparedStatementCacheSize();
+
 private:
 
 	/**
@@ -414,19 +508,37 @@ private:
 	void SerializeDb(FArchive& Ar);
 
 	/**
-	* Copy the Serialized database into the internal; Used as part of the internal serialization process
+	* Copy the Serialized database into the internal; Used as part of the internal serialization process.
+	* The decompressed database image is kept aside and only loaded into the sqlite connection when
+	* something first touches the database; see ApplyPendingDbImage
 	*/
 	void DeSerializeDb(FArchive& Ar);
 
+	/**
+	* Load the database image stashed by DeSerializeDb into the sqlite connection. Called from
+	* IsInitialized so the reconstruction cost is only paid when the database is actually used
+	*/
+	void ApplyPendingDbImage();
+
 	/**
 	* Setup the schema on the database, return true on success
 	* @return True if the internal database was initialized correctly with the schema
 	*/
 	bool SetupSchema();
 
+	/** Apply the tunable database settings from the t.RuleProcessor.Db* console variables. Called at
+	* open and again after deserializing an image, which resets the per-schema settings */
+	void ApplyDatabaseConfig();
+
 	/** Internal Method to Update PCs from Schema Version 1 to 2*/
 	bool UpdateFromSchemaVersionOneToVersionTwo();
 
+	/** Internal Method to Update PCs from Schema Version 2 to 3*/
+	bool UpdateFromSchemaVersionTwoToVersionThree();
+
+	/** Fill in the typed NumericValue column for every metadata value in the dictionary that parses as a number */
+	bool PopulateNumericAttributeValues();
+
 	/**
 	* Helper function to sanitize and escape strings correctly for insertion in the database
 	* @param InString - The string to sanitize
@@ -492,6 +604,47 @@ private:
 	*/
 	void AddTemporaryTable(const FString& Key, const FString& Name);
 
+	/** Pin a temporary table so it is not evicted from the LRU while rule instances sharing it are executing.
+	* Pins are reference counted; call UnpinTemporaryTable once per pin
+	* @param Name - The name of the temporary table to pin
+	*/
+	void PinTemporaryTable(const FString& Name);
+
+	/** Release a pin taken with PinTemporaryTable
+	* @param Name - The name of the temporary table to unpin
+	*/
+	void UnpinTemporaryTable(const FString& Name);
+
+	/** Return the directory under Saved/ where query result tables are cached between editor sessions */
+	static FString GetQueryResultDiskCacheDir();
+
+	/** Version number written into disk cached result tables. Bump this when the file format changes */
+	static int32 GetQueryResultDiskCacheVersion();
+
+	/**
+	* Return the disk cache file holding the results of the given query, or an empty string when the
+	* disk cache is disabled or unavailable. The path combines the hash of the database content with
+	* the hash of the query so any change to the point cloud invalidates all of its cached results
+	* @param Query - The statement whose results are being cached
+	* @return The full path of the cache file for the query, or an empty string
+	*/
+	FString GetQueryResultDiskCachePath(const FString& Query) const;
+
+	/**
+	* Try to rebuild a temporary table from the disk cached results of a previous session
+	* @param TableName - The name of the temporary table to create
+	* @param CacheFilePath - The cache file to restore from, as returned by GetQueryResultDiskCachePath
+	* @return True if the table was restored from the cache
+	*/
+	bool TryRestoreTableFromDiskCache(const FString& TableName, const FString& CacheFilePath);
+
+	/**
+	* Write the contents of a temporary table into the disk cache for future sessions
+	* @param TableName - The name of the temporary table to save
+	* @param CacheFilePath - The cache file to write, as returned by GetQueryResultDiskCachePath
+	*/
+	void SaveTableToDiskCache(const FString& TableName, const FString& CacheFilePath);
+
 private: // Data Section
 
 	// This is set to true if the pointcloud is already in a BeginTransaction without a matching EndTransaction. Used to detect nested transactions
@@ -521,6 +674,18 @@ private: // Data Section
 
 	/** Thread-safe cache for temporary table names in the DB */
 	FPointCloudTemporaryTablesCache TemporaryTables;
+
+	/** Thread-safe cache of compiled sqlite statements, keyed by normalized query text. Mutable as the read-only query methods use it */
+	mutable FPointCloudPreparedStatementCache PreparedStatements;
+
+	/** Decompressed database image read from the asset archive, waiting to be loaded into the sqlite connection on first use */
+	uint8* PendingDbImage;
+
+	/** Size in bytes of the pending database image */
+	int64 PendingDbImageSize;
+
+	/** A lock so concurrent first touches only load the pending database image once */
+	FCriticalSection PendingDbImageLock;
 };
 
 // Template implementations
@@ -562,6 +727,24 @@ TArray<TPair<T, U>> UPointCloudImpl::GetValuePairArray(const FString& Query, con
 	return Values;
 }
 
+template<typename T, typename U>
+void UPointCloudImpl::ForEachValuePair(const FString& Query, const TArray<FString>& FirstColumnNames, const TArray<FString>& SecondColumnNames, TFunctionRef<void(const T&, const U&)> Callback) const
+{
+	TArray<FString> MergedColumnNames = FirstColumnNames;
+	MergedColumnNames.Append(SecondColumnNames);
+
+	GetValues(Query, MergedColumnNames, [&Callback, &FirstColumnNames, &SecondColumnNames](sqlite3_stmt* stmt, int* ColumnIndices) {
+		int ReadColumns = 0;
+		T Key;
+		PointCloudSqliteHelpers::ResultRetrieval(stmt, FirstColumnNames.Num(), ColumnIndices, ReadColumns, Key);
+
+		U Value;
+		PointCloudSqliteHelpers::ResultRetrieval(stmt, SecondColumnNames.Num(), ColumnIndices + FirstColumnNames.Num(), ReadColumns, Value);
+
+		Callback(Key, Value);
+		});
+}
+
 template<typename T, typename U>
 TMap<T, U> UPointCloudImpl::GetValueMap(const FString& Query, const TArray<FString>& KeyNames, const TArray<FString>& ValueNames) const
 {
@@ -36,4 +36,13 @@ protected:
 	bool bMoveChangesToNewChangelist = false;
 	bool bForceClean = false;
 	bool bSkipHashCheck = false;
+
+	/** When partitioned with -Partition=I/N, the worker index this invocation executes (0 to N-1) */
+	int32 PartitionIndex = INDEX_NONE;
+
+	/** When partitioned with -Partition=I/N, the total number of worker invocations */
+	int32 PartitionCount = 0;
+
+	/** When set with -WriteManifest=<file>, enumerate the partition assignments into the file instead of running */
+	FString ManifestPath;
 };
\ No newline at end of file
@@ -37,6 +37,30 @@ struct POINTCLOUD_API FSliceAndDiceManagedActorsHashInfo
 	uint32 ActorCount = 0;
 };
 
+/**
+* Holds a view result hash computed during a previous execution, together with the point cloud
+* region the view read and the import revision the hash was computed at. The hash stays valid for
+* as long as no import has touched that region, which allows rule instances to be skipped without
+* re-running their hash queries
+*/
+USTRUCT()
+struct POINTCLOUD_API FSliceAndDiceCachedViewHash
+{
+	GENERATED_BODY()
+
+	/** The view result hash */
+	UPROPERTY()
+	FString Hash;
+
+	/** Import revision of the point cloud when the hash was computed */
+	UPROPERTY()
+	uint64 ImportRevisionNumber = 0;
+
+	/** Conservative bound on the region the view read. An invalid box stands for the whole cloud */
+	UPROPERTY()
+	FBox ConsumedBounds = FBox(EForceInit::ForceInit);
+};
+
 /**
 * Class to hold mapping of rule hierarchy to actor soft paths
 */
@@ -143,6 +167,9 @@ public:
 	*/
 	bool ContainsHash(const FString& InParentHash, const FString& InHash) const;
 
+	/** Returns the mapping this actor hierarchy is executing against. Only set during execution */
+	USliceAndDiceMapping* GetMapping() const { return Mapping; }
+
 protected:
 	/** Flat list of managed actor entries for serialization */
 	UPROPERTY()
@@ -232,6 +259,36 @@ public:
 	* @param OutActorsToDelete Outstanding list of actors that were not reused and need to be deleted
 	*/
 	void PostExecute(UWorld* World, TArray<TSoftObjectPtr<AActor>>& OutActorsToDelete, TArray<FActorInstanceHandle>& OutActorHandlesToDelete);
+
+	/**
+	* Looks up a view result hash cached by a previous execution. The hash is returned only if no import
+	* into the point cloud has touched the region the view reads since the hash was computed.
+	* @param InViewKey Key identifying the view, as built from its filter statements
+	* @param OutHash Will contain the cached hash when the lookup succeeds
+	* @return True if a still-valid cached hash was found
+	*/
+	bool FindCachedViewHash(const FString& InViewKey, FString& OutHash) const;
+
+	/**
+	* Caches a view result hash together with the region the view read and the current import revision
+	* of the point cloud, for reuse by subsequent executions.
+	* @param InViewKey Key identifying the view, as built from its filter statements
+	* @param InConsumedBounds Conservative bound on the region the view read; an invalid box stands for the whole cloud
+	* @param InHash The view result hash to cache
+	*/
+	void CacheViewHash(const FString& InViewKey, const FBox& InConsumedBounds, const FString& InHash);
+
+private:
+	/** Cached view result hashes from previous executions, keyed by the views' filter statements */
+	UPROPERTY()
+	TMap<FString, FSliceAndDiceCachedViewHash> CachedViewHashes;
+
+	/** Point cloud the cached view hashes were computed against, used to drop the cache when the cloud is swapped */
+	UPROPERTY()
+	FSoftObjectPath CachedViewHashesPointCloud;
+
+	/** Guards the cached view hashes, which are read & written from rule execution threads */
+	mutable FCriticalSection CachedViewHashesLock;
 };
 
 /**
@@ -32,7 +32,10 @@ struct POINTCLOUD_API FPointCloudSliceAndDiceReportFrame
 	*/
 	void AddMessage(const FString& Message)
 	{
-		Entries.Emplace(MakeShared<FPointCloudSliceAndDiceReportEntry>(Message));
+		if (bIsActive)
+		{
+			Entries.Emplace(MakeShared<FPointCloudSliceAndDiceReportEntry>(Message));
+		}
 	}
 
 	/**
@@ -41,7 +44,10 @@ struct POINTCLOUD_API FPointCloudSliceAndDiceReportFrame
 	*/
 	void PushMessage(const FString& Message)
 	{
-		Entries.EmplaceAt(0,MakeShared<FPointCloudSliceAndDiceReportEntry>(Message));
+		if (bIsActive)
+		{
+			Entries.EmplaceAt(0,MakeShared<FPointCloudSliceAndDiceReportEntry>(Message));
+		}
 	}
 
 	/**
@@ -51,7 +57,10 @@ struct POINTCLOUD_API FPointCloudSliceAndDiceReportFrame
 	*/
 	void PushParameter(const FString& InName, const FString& InValue)
 	{
-		PushMessage(InName + " = " + InValue);
+		if (bIsActive)
+		{
+			Entries.EmplaceAt(0, MakeShared<FPointCloudSliceAndDiceReportEntry>(InName, InValue));
+		}
 	}
 
 	/**
@@ -61,7 +70,10 @@ struct POINTCLOUD_API FPointCloudSliceAndDiceReportFrame
 	*/
 	void PushParameter(const FString& InName, const int32& InValue)
 	{
-		PushMessage(InName + " = " + FString::FromInt(InValue));
+		if (bIsActive)
+		{
+			Entries.EmplaceAt(0, MakeShared<FPointCloudSliceAndDiceReportEntry>(InName, static_cast<int64>(InValue)));
+		}
 	}
 
 	/**
@@ -71,7 +83,23 @@ struct POINTCLOUD_API FPointCloudSliceAndDiceReportFrame
 	*/
 	void AddParameter(const FString& InName, const FString& InValue)
 	{
-		AddMessage(InName + " = " + InValue);		
+		if (bIsActive)
+		{
+			Entries.Emplace(MakeShared<FPointCloudSliceAndDiceReportEntry>(InName, InValue));
+		}
+	}
+
+	/**
+	* Add a record of a name / value pair into the current frame
+	* @oaram Name - The name of the value
+	* @oaram Value - The Value
+	*/
+	void AddParameter(const FString& InName, const int32& InValue)
+	{
+		if (bIsActive)
+		{
+			Entries.Emplace(MakeShared<FPointCloudSliceAndDiceReportEntry>(InName, static_cast<int64>(InValue)));
+		}
 	}
 
 	// A human readable name for this frame
@@ -85,6 +113,10 @@ struct POINTCLOUD_API FPointCloudSliceAndDiceReportFrame
 
 	// Reporting level for this frame
 	EPointCloudReportLevel ReportingLevel;
+
+	// Set to false when the owning report is inactive (execute-only runs). Inactive frames discard
+	// entries on record so rule execution never pays for report bookkeeping it will not display
+	bool bIsActive = true;
 };
 
 using FPointCloudSliceAndDiceReportFramePtr = TSharedPtr<FPointCloudSliceAndDiceReportFrame>;
@@ -94,6 +126,7 @@ struct POINTCLOUD_API FPointCloudSliceAndDiceReportEntry
 	enum class EntryType
 	{
 		Message,
+		Parameter,
 		Frame
 	};
 
@@ -104,12 +137,33 @@ struct POINTCLOUD_API FPointCloudSliceAndDiceReportEntry
 
 
 	FPointCloudSliceAndDiceReportEntry(const FString& InMessage) : Type(EntryType::Message)
-	{		
-			MessageString = InMessage;			
+	{
+			MessageString = InMessage;
 	}
 
+	/** Record a name / value pair without formatting it. The "Name = Value" string is built on demand in ToString */
+	FPointCloudSliceAndDiceReportEntry(const FString& InName, const FString& InValue)
+		: Type(EntryType::Parameter)
+		, MessageString(InName)
+		, ValueString(InValue)
+	{}
+
+	/** Record a name / counter pair in its native form. Conversion to text happens on demand in ToString */
+	FPointCloudSliceAndDiceReportEntry(const FString& InName, int64 InValue)
+		: Type(EntryType::Parameter)
+		, MessageString(InName)
+		, NumericValue(InValue)
+		, bNumericValue(true)
+	{}
+
+	/** Format this entry for display. Only valid for Message and Parameter entries */
+	FString ToString() const;
+
 	EntryType Type;
 	FString	MessageString;
+	FString	ValueString;
+	int64 NumericValue = 0;
+	bool bNumericValue = false;
 	FPointCloudSliceAndDiceReportFramePtr Frame;
 };
 
@@ -203,6 +203,16 @@ protected:
 	*/
 	virtual void UpdateData();
 
+	/**
+	* Computes a view-derived hash through the mapping's persistent view hash cache when one is bound.
+	* If no import has touched the region the view reads since the hash was last computed, the cached
+	* value is returned without running any query.
+	* @param InKeySalt Extra key material to distinguish hashes computed differently from the same view
+	* @param InComputeHash Invoked to compute the hash on a cache miss
+	* @return The cached or freshly computed hash
+	*/
+	FString GetViewHashThroughCache(const FString& InKeySalt, TFunctionRef<FString()> InComputeHash);
+
 	/**
 	* Keeps track of a new actor(s)
 	*/
@@ -0,0 +1,67 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "HAL/CriticalSection.h"
+#include "Containers/LruCache.h"
+#include "PointCloudConfig.h"
+
+struct sqlite3;
+struct sqlite3_stmt;
+
+/** Thread-safe LRU cache of compiled sqlite statements, keyed by normalized query text.
+*
+* Rule runs issue thousands of near-identical queries and sqlite3_prepare_v2 is a measurable part of their cost.
+* Callers check statements out with Acquire (preparing on a cache miss), bind and step them, then hand them back
+* with Release which resets the statement and returns it to the cache for the next caller. A checked-out statement
+* is removed from the cache for the duration, so two threads never share one compiled statement; if a second
+* thread asks for the same query while it is checked out it simply pays for a fresh prepare.
+*/
+class FPointCloudPreparedStatementCache
+{
+public:
+	FPointCloudPreparedStatementCache();
+
+	/** Normalize query text for use as a cache key by trimming and collapsing runs of whitespace */
+	static FString NormalizeQuery(const FString& InQuery);
+
+	/**
+	* Check a compiled statement for the given query out of the cache, compiling it if it isn't cached.
+	* The statement must be handed back with Release or finalized by the caller.
+	* @param InDatabase - The database to compile the query against on a cache miss
+	* @param InQuery - The SQL query text
+	* @return A compiled statement ready for binding, or nullptr if the query failed to compile
+	*/
+	sqlite3_stmt* Acquire(sqlite3* InDatabase, const FString& InQuery);
+
+	/**
+	* Hand a statement acquired with Acquire back to the cache. The statement is reset and its bindings cleared;
+	* if resetting fails, or an equivalent statement was re-cached in the meantime, it is finalized instead.
+	* @param InQuery - The query text the statement was acquired with
+	* @param InStatement - The statement to return
+	*/
+	void Release(const FString& InQuery, sqlite3_stmt* InStatement);
+
+	/** Finalize all cached statements. This must be called before the database they were compiled against is closed or replaced */
+	void FinalizeStatements();
+
+	/** Return the number of Acquire calls served from the cache */
+	int32 GetCacheHitCount() const { return CacheHits; }
+
+	/** Return the number of Acquire calls that had to compile their statement */
+	int32 GetCacheMissCount() const { return CacheMisses; }
+
+private:
+	// Least recently used cache of compiled statements. The size of this cache is controlled by
+	// UPointCloudImpl::GetPreparedStatementCacheSize; once full, the least recently used statement is finalized
+	TLruCache<FString, sqlite3_stmt*> CachedStatements;
+
+	// A lock to protect access to this struct's members
+	mutable FCriticalSection CacheLock;
+
+	int32 CacheHits;
+
+	int32 CacheMisses;
+
+	int32 CacheSize;
+};
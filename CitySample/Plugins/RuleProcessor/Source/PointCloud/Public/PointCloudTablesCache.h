@@ -18,6 +18,10 @@ public:
 	FString AddToCache(const FString& InKey, const FString& InName);
 	FString RemoveLeastRecentNotThreadSafe();
 
+	/** Pin a table so it is skipped by LRU eviction. Pins are reference counted; call Unpin once per Pin */
+	void Pin(const FString& InName);
+	void Unpin(const FString& InName);
+
 #if defined RULEPROCESSOR_ENABLE_LOGGING
 	const TMap<FString, int32>& GetCacheMisses() const { return CacheMisses; }
 #endif
@@ -41,6 +45,10 @@ private:
 	// Map between Queries and cache miss counts
 	TMap<FString, int32> CacheHits;
 
+	// Reference counts for pinned tables, keyed by table name. Pinned tables are never evicted;
+	// views pin their intermediate result tables while rule instances that share them are executing
+	TMap<FString, int32> PinCounts;
+
 	int32 CacheSize;
 
 	int32 EjectedTablesCount;
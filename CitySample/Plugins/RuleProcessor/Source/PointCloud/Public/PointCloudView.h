@@ -65,6 +65,17 @@ public:	// ~ Transform interface
 	UFUNCTION(BlueprintCallable, Category = "PointCloudView|Transforms")
 	int GetTransformsAndIds(TArray<FTransform>& OutTransforms, TArray<int32>& OutIds) const;
 
+	/**
+	* Stream the transforms and point ids from this view in fixed-size chunks rather than materializing the whole result set.
+	* Use this for views large enough that the full transform array would be a significant transient allocation.
+	* The arrays handed to the callback are scratch buffers reused between chunks; the callback may modify them in place
+	* but must copy out anything that needs to outlive the call.
+	* @return The total number of points streamed by this call
+	* @param ChunkCallback - Called with up to MaxChunkSize transforms and their matching point ids
+	* @param MaxChunkSize - The maximum number of entries handed to each callback invocation
+	*/
+	int GetTransformsAndIds(TFunctionRef<void(TArray<FTransform>&, TArray<int32>&)> ChunkCallback, int32 MaxChunkSize = 64 * 1024) const;
+
 	/**
 	* Get transforms and the point ids from this view.
 	* This method uses a pathway that utilizes intermediate tables
@@ -268,16 +279,32 @@ public: // ~ Filter interface
 	UFUNCTION(BlueprintCallable, Category = "PointCloudView|Filters")
 	void FilterOnIndex(int32 Index=-1, EFilterMode Mode = EFilterMode::FILTER_Or);
 
-public: 
+	/**
+	* Only Return points with the given set of indexes. Lets iterator rules hand a batch of points to
+	* a single child view rather than issuing one query per point
+	* @param Indexes - The indexes of the points to return
+	* @param Mode - How the results of this filter are combined with the result set. Allows inclusion, exclusion and intersection of matching results
+	*/
+	UFUNCTION(BlueprintCallable, Category = "PointCloudView|Filters")
+	void FilterOnIndexes(const TArray<int32>& Indexes, EFilterMode Mode = EFilterMode::FILTER_Or);
+
+public:
 
 	/** Returns the point cloud this view is associated to */
 	UFUNCTION(BlueprintCallable, Category = "PointCloudView|Management")
 	UPointCloud* GetPointCloud() const;
-	
-	/** Return the list of filter statements for this view and the associated, sanitized hashes for each Statement. 
+
+	/** Return the list of filter statements for this view and the associated, sanitized hashes for each Statement.
 	*/
 	TArray<FString> GetFilterStatements() const;
 
+	/**
+	* Return a conservative bound on the region of the point cloud this view reads, derived from the spatial
+	* filters applied to this view and its parents. An invalid box means the view is not spatially constrained
+	* and may read from anywhere in the cloud
+	*/
+	FBox GetSpatialFilterBounds() const;
+
 protected:
 
 	/**
@@ -311,16 +338,37 @@ public:
 	/** Precache the filter results */
 	void PreCacheFilters();
 
+	/**
+	* Materialize the chain of intermediate result tables for this view and pin them so they are not
+	* evicted from the temporary table cache. Rule execution pins a view's tables while the rule
+	* instances branching from it run, so sub-filters shared by several branches execute once per run.
+	* Pins are reference counted; every call must be matched by a call to UnpinFilterResultTables
+	*/
+	void PinFilterResultTables();
+
+	/** Release the pins taken by PinFilterResultTables */
+	void UnpinFilterResultTables();
+
 private:
 
 	/** Return the union of all of the Metadata queries */
-	FString GetMetadataQuery() const; 
+	FString GetMetadataQuery() const;
+
+	/** Materialize and return the chain of intermediate result tables for this view, one entry per
+	* filter in the chain with the final result table last, or an empty array if no filters are applied */
+	TArray<FString> GetFilterResultTableChain(bool bSilentOnNoFilter) const;
+
+	/** Return the query that selects the ids and transforms of this view, or an empty string on failure */
+	FString GetPerIdTransformsQuery() const;
 
 	/** Add a statement to the list of view creation statements. This will be added at the end of the list and executed after all previous entries
-	* This should be a valid SQL statement. 
+	* This should be a valid SQL statement.
 	*/
 	void AddFilterStatement(const FString &Statement);
 
+	/** Narrow the spatial filter bounds with the region selected by a newly added spatial filter */
+	void IntersectSpatialFilterBounds(const FBox& InBounds);
+
 	/** Clear the list of create view statements */
 	void ClearFilterStatements();
 
@@ -346,8 +394,11 @@ private: /** Data */
 	TObjectPtr<UPointCloudView> ParentView;
 
 	/** The array of Statements required to generate this view. As there are dependencies between the statements these should be executed in order */
-	TArray<FString> FilterStatementList; 
-	
+	TArray<FString> FilterStatementList;
+
+	/** Intersection of the regions selected by the spatial filters on this view, or an invalid box if none constrain it */
+	FBox SpatialFilterBounds;
+
 	/** A flag to indicate if this view is in GetData State. */
 	bool bInGetDataState;
 	
@@ -359,4 +410,7 @@ private: /** Data */
 
 	/** Contains cached hash of current view results, or empty if not computed */
 	mutable FString CachedResultHash;
+
+	/** The result tables currently pinned by PinFilterResultTables, empty when nothing is pinned */
+	TArray<FString> PinnedResultTables;
 };
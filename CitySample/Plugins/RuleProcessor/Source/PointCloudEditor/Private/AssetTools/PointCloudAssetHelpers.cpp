@@ -225,52 +225,77 @@ namespace PointCloudAssetHelpers
 		}
 	}
 
-	bool UpdateIsmComponent(UInstancedStaticMeshComponent* Component, UPointCloudView *View, const FPointCloudManagedActorData& AsManaged)
+	bool UpdateIsmComponent(UInstancedStaticMeshComponent* Component, const FPointCloudComponentData& ComponentData, const FPointCloudManagedActorData& AsManaged)
 	{
+		UPointCloudView* View = ComponentData.View;
+
 		if (!Component || !View || !AsManaged.Actor)
 		{
 			return false;
 		}
 
-		TArray<FTransform> Transforms = View->GetTransforms();
 		// Currently we'll promote values that might be integers to floats, which might lead to data loss,
 		// because we're pushing that to the custom data in any case.
 		// If there are some instances where we'd want to copy integers as "float bits" we would need to do a few changes here
 		TArray<float> PerModuleAttributes;
 
 		const FTransform InverseActorTransform = AsManaged.Actor->GetTransform().Inverse();
-		if (!InverseActorTransform.Equals(FTransform::Identity))
-		{
-			for (FTransform& Transform : Transforms)
-			{
-				Transform *= InverseActorTransform;
-			}
-		}
+		const bool bApplyInverseActorTransform = !InverseActorTransform.Equals(FTransform::Identity);
 
 		if (AsManaged.ModuleAttributeKey.IsEmpty() == false)
 		{
 			// the user has requested a column be added to the modules as per instance attributes.
 			// get the values for that column if it exists
 			PerModuleAttributes = View->GetMetadataValuesArrayAsFloat(AsManaged.ModuleAttributeKey);
+
+			// Size the custom data channel up front so the per-instance arrays grow in step with the
+			// instances below instead of being reallocated once everything has been added
+			Component->NumCustomDataFloats = 1;
 		}
 
-		if (Transforms.Num())
+		// The component count was established when the component data was built, so the
+		// instance arrays can be reserved in one allocation rather than growing chunk by chunk
+		if (ComponentData.Count > 0)
 		{
+			Component->PreAllocateInstancesMemory(ComponentData.Count);
+		}
+
+		FScopedSlowTask SpawnTask(FMath::Max(ComponentData.Count, 0), LOCTEXT("AddingInstancesText", "Adding Instances"));
+		SpawnTask.MakeDialogDelayed(1.0f);
+
+		int32 RemainingInstances = ComponentData.Count;
+
+		// Stream the instances onto the component a chunk at a time; materializing every transform in
+		// a large view at once is a transient allocation big enough to OOM the editor. Reporting progress
+		// per chunk also keeps the editor UI responsive while a big component is populated
+		const int32 InstanceCount = View->GetTransformsAndIds([Component, &InverseActorTransform, bApplyInverseActorTransform, &SpawnTask, &RemainingInstances](TArray<FTransform>& Transforms, TArray<int32>& Ids) {
+			if (bApplyInverseActorTransform)
+			{
+				for (FTransform& Transform : Transforms)
+				{
+					Transform *= InverseActorTransform;
+				}
+			}
+
 			Component->AddInstances(Transforms, false);
+
+			const int32 ProgressThisChunk = FMath::Min(Transforms.Num(), RemainingInstances);
+			RemainingInstances -= ProgressThisChunk;
+			SpawnTask.EnterProgressFrame(ProgressThisChunk);
+			});
+
+		if (InstanceCount)
+		{
 			// If we save the asset in the same call hierarchy before an engine tick
 			// the bounds won't have been updated, so we must do it here.
 			Component->UpdateBounds();
 		}
 
-		if (PerModuleAttributes.Num() == Transforms.Num())
+		if (PerModuleAttributes.Num() == InstanceCount && Component->PerInstanceSMCustomData.Num() == InstanceCount)
 		{
-			Component->NumCustomDataFloats = 1;
-
-			// "Write" one float per instance
-			for (int32 InstanceIndex = 0; InstanceIndex < PerModuleAttributes.Num(); ++InstanceIndex)
-			{
-				Component->SetCustomData(InstanceIndex, { PerModuleAttributes[InstanceIndex] });
-			}
+			// Write the whole channel in one go rather than issuing a SetCustomData call per instance
+			FMemory::Memcpy(Component->PerInstanceSMCustomData.GetData(), PerModuleAttributes.GetData(), InstanceCount * sizeof(float));
+			Component->MarkRenderStateDirty();
 		}
 
 		return true;
@@ -355,7 +380,7 @@ void UPointCloudAssetsHelpers::UpdateManagedActorInstance(const FPointCloudManag
 		{
 			if (UInstancedStaticMeshComponent* AsIsmComponent = PointCloudAssetHelpers::GetComponentFromActorAndRef<UInstancedStaticMeshComponent>(ManagedActorData.Actor, ComponentRef))
 			{
-				PointCloudAssetHelpers::UpdateIsmComponent(AsIsmComponent, View, ManagedActorData);
+				PointCloudAssetHelpers::UpdateIsmComponent(AsIsmComponent, ComponentData, ManagedActorData);
 			}
 			else if (UStaticMeshComponent* AsStaticMeshComponent = PointCloudAssetHelpers::GetComponentFromActorAndRef<UStaticMeshComponent>(ManagedActorData.Actor, ComponentRef))
 			{
@@ -1032,6 +1057,30 @@ void UPointCloudAssetsHelpers::DeleteAllActorsOnDataLayer(UWorld* InWorld, const
 	}
 }
 
+bool UPointCloudAssetsHelpers::AddActorsToDataLayers(const TArray<AActor*>& InActors, const TArray<UDataLayerInstance*>& InDataLayers)
+{
+	if (InActors.Num() == 0 || InDataLayers.Num() == 0)
+	{
+		return true;
+	}
+
+	UDataLayerEditorSubsystem* DataLayerEditorSubsystem = UDataLayerEditorSubsystem::Get();
+
+	if (!DataLayerEditorSubsystem)
+	{
+		UE_LOG(PointCloudLog, Warning, TEXT("Unable to get the data layer editor subsystem"));
+		return false;
+	}
+
+	if (!DataLayerEditorSubsystem->AddActorsToDataLayers(InActors, InDataLayers))
+	{
+		UE_LOG(PointCloudLog, Log, TEXT("Some of the %d actors were unable to be added to their target data layers"), InActors.Num());
+		return false;
+	}
+
+	return true;
+}
+
 void UPointCloudAssetsHelpers::DeleteAllActorsByPrefixInPartitionedWorld(UWorld* InWorld, const FString& InPrefix)
 {
 	UWorld* World = InWorld;
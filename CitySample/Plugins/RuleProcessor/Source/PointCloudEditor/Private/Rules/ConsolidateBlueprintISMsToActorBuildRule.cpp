@@ -123,7 +123,9 @@ bool UConsolidateBlueprintISMsToActorBuildRule::Compile(FSliceAndDiceContext& Co
 
 FString FConsolidateBlueprintISMsToActorBuildRuleInstance::GetHash()
 {
-	return GetView()->GetValuesAndTransformsHash({ Data.ActorMetadataKey });
+	const TArray<FString> HashKeys = { Data.ActorMetadataKey };
+
+	return GetViewHashThroughCache(FString::Join(HashKeys, TEXT(",")), [this, &HashKeys]() { return GetView()->GetValuesAndTransformsHash(HashKeys); });
 }
 
 bool FConsolidateBlueprintISMsToActorBuildRuleInstance::Execute(FSliceAndDiceExecutionContextPtr Context)
@@ -180,6 +182,8 @@ bool FConsolidateBlueprintISMsToActorBuildRuleInstance::Execute(FSliceAndDiceExe
 
 	bool Result = false;
 
+	TArray<AActor*> ActorsForDataLayers;
+
 	// For each Actor get associated Blueprints
 	for (int ActorIndex = 0; ActorIndex < UniqueActorMetadataValue.Num(); ActorIndex++)
 	{
@@ -395,14 +399,7 @@ bool FConsolidateBlueprintISMsToActorBuildRuleInstance::Execute(FSliceAndDiceExe
 				FString Name = UConsolidateBlueprintISMsToActorBuildRule::MakeName(PointCloud, UniqueActorMetadataValue[ActorIndex], Data.NamePattern, Data.NameValue, ActorIndex);
 				ConsolidatedISMActor->SetActorLabel(Name);
 
-				// Add actor to layers
-				if (DataLayerEditorSubsystem && DataLayers.Num() > 0)
-				{
-					if (!DataLayerEditorSubsystem->AddActorToDataLayers(ConsolidatedISMActor, DataLayers))
-					{
-						UE_LOG(PointCloudLog, Log, TEXT("Actor %s was unable to be added to its target data layers"), *ConsolidatedISMActor->GetActorLabel());
-					}
-				}
+				ActorsForDataLayers.Add(ConsolidatedISMActor);
 
 				NewActorAdded(ConsolidatedISMActor, BlueprintsPerActorView);
 
@@ -410,6 +407,10 @@ bool FConsolidateBlueprintISMsToActorBuildRuleInstance::Execute(FSliceAndDiceExe
 			}
 		}
 	}
+
+	// Add the new actors to the target layers in one batched subsystem call rather than per actor
+	UPointCloudAssetsHelpers::AddActorsToDataLayers(ActorsForDataLayers, DataLayers);
+
 	return Result;
 }
 
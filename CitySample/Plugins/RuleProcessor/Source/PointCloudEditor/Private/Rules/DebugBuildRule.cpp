@@ -104,7 +104,9 @@ void UDebugBuildRule::ReportParameters(FSliceAndDiceContext& Context) const
 
 FString FDebugBuildRuleInstance::GetHash()
 {
-	return GetView()->GetValuesAndTransformsHash({ PointCloudAssetHelpers::GetUnrealAssetMetadataKey() });
+	const TArray<FString> HashKeys = { PointCloudAssetHelpers::GetUnrealAssetMetadataKey() };
+
+	return GetViewHashThroughCache(FString::Join(HashKeys, TEXT(",")), [this, &HashKeys]() { return GetView()->GetValuesAndTransformsHash(HashKeys); });
 }
 
 bool FDebugBuildRuleInstance::Execute()
@@ -173,6 +175,7 @@ bool FDebugBuildRuleInstance::Execute()
 
 				// Add Instances
 				TArray<FTransform> PointTransforms;
+				PointTransforms.Reserve(Transforms.Num());
 				for (int32 i = 0; i < Transforms.Num(); i++)
 				{
 					SlowTask.EnterProgressFrame();
@@ -144,7 +144,7 @@ FString FMultiActorRuleInstance::GetHash()
 		HashKeys.AddUnique(MaterialOverrideKey);
 	}
 
-	return GetView()->GetValuesAndTransformsHash(HashKeys);
+	return GetViewHashThroughCache(FString::Join(HashKeys, TEXT(",")), [this, &HashKeys]() { return GetView()->GetValuesAndTransformsHash(HashKeys); });
 }
 
 bool FMultiActorRuleInstance::Execute(FSliceAndDiceExecutionContextPtr Context)
@@ -139,7 +139,7 @@ FString FOneActorRuleInstance::GetHash()
 		HashKeys.AddUnique(MaterialOverrideKey);
 	}
 
-	return GetView()->GetValuesAndTransformsHash(HashKeys);
+	return GetViewHashThroughCache(FString::Join(HashKeys, TEXT(",")), [this, &HashKeys]() { return GetView()->GetValuesAndTransformsHash(HashKeys); });
 }
 
 bool FOneActorRuleInstance::Execute(FSliceAndDiceExecutionContextPtr Context)
@@ -81,6 +81,7 @@ bool UPerPointIterator::Compile(FSliceAndDiceContext& Context) const
 	}
 		
 	Context.ReportObject.AddParameter(TEXT("NamePattern"), Data.NamePattern);
+	Context.ReportObject.AddParameter(TEXT("BatchSize"), Data.BatchSize);
 
 	bool Result = false;
 
@@ -118,7 +119,13 @@ bool FPerPointIteratorFilterInstance::Iterate(FSliceAndDiceExecutionContextPtr C
 	check(Context);
 	Context->BatchOnRule(this);
 
-	FScopedSlowTask SlowTask(Points.Num() * Children.Num(), LOCTEXT("PerPointIteration", "Iterating on all points"));
+	// Batch size 0 or 1 runs the inner rule once per point; anything larger hands the inner rule
+	// batches of that many points through a single child view, so the per-iteration query
+	// overhead is paid once per batch rather than once per point
+	const int32 PointsPerBatch = FMath::Max(Data.BatchSize, 1);
+	const int32 NumBatches = FMath::DivideAndRoundUp(Points.Num(), PointsPerBatch);
+
+	FScopedSlowTask SlowTask(NumBatches * Children.Num(), LOCTEXT("PerPointIteration", "Iterating on all points"));
 	SlowTask.MakeDialog();
 
 	for (FPointCloudRuleInstancePtr Child : Children)
@@ -128,13 +135,28 @@ bool FPerPointIteratorFilterInstance::Iterate(FSliceAndDiceExecutionContextPtr C
 			continue;
 		}
 
-		for (int32 VertexId : Points)
+		for (int32 BatchIndex = 0; BatchIndex < NumBatches; ++BatchIndex)
 		{
 			SlowTask.EnterProgressFrame();
-			Data.OverrideNameValue(VertexId);
+
+			const int32 BatchStart = BatchIndex * PointsPerBatch;
+			const int32 BatchCount = FMath::Min(PointsPerBatch, Points.Num() - BatchStart);
+
+			// The name resolves against the first point in the batch, which keeps names unique
+			// per iteration and matches the per-point behavior when the batch size is 1
+			Data.OverrideNameValue(Points[BatchStart]);
 
 			UPointCloudView* PerChildView = GetView()->MakeChildView();
-			PerChildView->FilterOnIndex(VertexId);
+
+			if (BatchCount == 1)
+			{
+				PerChildView->FilterOnIndex(Points[BatchStart]);
+			}
+			else
+			{
+				PerChildView->FilterOnIndexes(TArray<int32>(Points.GetData() + BatchStart, BatchCount));
+			}
+
 			Child->SetView(PerChildView);
 
 			SliceAndDiceExecution::SingleThreadedRuleInstanceExecute(Child, Context);
@@ -20,7 +20,13 @@ public:
 	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	FString NamePattern;
-	
+
+	/** Number of points handed to the inner rule per iteration. Values of 0 or 1 run the inner rule
+	* once per point. Larger values run it once per batch of this many points, which amortizes the
+	* per-iteration query overhead; $VERTEX_ID in the name pattern resolves to the first point in the batch */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	int32 BatchSize = 0;
+
 	FString BuildNameString(int32 VertexId) const;
 
 	/** Updates the previous name value */
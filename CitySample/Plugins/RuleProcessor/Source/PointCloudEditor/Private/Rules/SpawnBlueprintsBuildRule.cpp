@@ -127,7 +127,9 @@ bool USpawnBlueprintsBuildRule::Compile(FSliceAndDiceContext& Context) const
 
 FString FSpawnBlueprintsBuildRuleInstance::GetHash()
 {
-	return GetView()->GetValuesAndTransformsHash({ Data.MetadataKey });
+	const TArray<FString> HashKeys = { Data.MetadataKey };
+
+	return GetViewHashThroughCache(FString::Join(HashKeys, TEXT(",")), [this, &HashKeys]() { return GetView()->GetValuesAndTransformsHash(HashKeys); });
 }
 
 bool FSpawnBlueprintsBuildRuleInstance::Execute(FSliceAndDiceExecutionContextPtr Context)
@@ -298,15 +300,6 @@ bool FSpawnBlueprintsBuildRuleInstance::Execute(FSliceAndDiceExecutionContextPtr
 					Actor->SetFolderPath(Data.FolderPath);
 				}
 
-				// Add actor to layers
-				if (DataLayerEditorSubsystem && DataLayers.Num() > 0)
-				{
-					if (!DataLayerEditorSubsystem->AddActorToDataLayers(Actor, DataLayers))
-					{
-						UE_LOG(PointCloudLog, Log, TEXT("Actor %s was unable to be added to its target data layers"), *Actor->GetActorLabel());
-					}
-				}
-
 				// This might not be needed, was added as a safe-guard in case there was something wrong in the blueprint
 				Actor->ForEachComponent<USceneComponent>(/*bIncludeFromChildActors=*/true, [](USceneComponent* Component) { Component->UpdateBounds(); });
 
@@ -321,6 +314,9 @@ bool FSpawnBlueprintsBuildRuleInstance::Execute(FSliceAndDiceExecutionContextPtr
 		}
 	}
 
+	// Add the new actors to the target layers in one batched subsystem call rather than per actor
+	UPointCloudAssetsHelpers::AddActorsToDataLayers(ActorsCreated, DataLayers);
+
 	if (ActorsCreated.Num() > 0 || ActorHandlesCreated.Num() > 0)
 	{
 		NewActorsAdded(ActorsCreated, ActorHandlesCreated, GetView());
@@ -118,16 +118,10 @@ USpawnNiagaraRule::USpawnNiagaraRule()
 
 FString FSpawnNiagaraRuleInstance::GetHash()
 {
-	if (Data.SpawnMode == ENiagaraSpawnMode::Data)
-	{
-		return GetView()->GetValuesAndTransformsHash({ Data.MetadataKey });
-	}
-	else
-	{
-		// Default to using the "default" identifying key
-		return GetView()->GetValuesAndTransformsHash({ PointCloudAssetHelpers::GetUnrealAssetMetadataKey() });
-	}
-	
+	// Default to using the "default" identifying key when not spawning from data
+	const TArray<FString> HashKeys = { Data.SpawnMode == ENiagaraSpawnMode::Data ? Data.MetadataKey : PointCloudAssetHelpers::GetUnrealAssetMetadataKey() };
+
+	return GetViewHashThroughCache(FString::Join(HashKeys, TEXT(",")), [this, &HashKeys]() { return GetView()->GetValuesAndTransformsHash(HashKeys); });
 }
 
 bool FSpawnNiagaraRuleInstance::Execute(FSliceAndDiceExecutionContextPtr Context)
@@ -5,6 +5,7 @@
 #include "SSliceAndDiceDataLayerPicker.h"
 #include "Interfaces/IMainFrameModule.h"
 #include "PointCloudSliceAndDiceManager.h"
+#include "PointCloudImpl.h"
 #include "PointCloudAssetHelpers.h"
 #include "Editor/PropertyEditor/Private/SDetailsView.h"
 #include "Widgets/Docking/SDockTab.h"
@@ -172,6 +173,16 @@ TSharedRef<SWidget> SSliceAndDiceManagerWidget::MakeToolBar()
 		LOCTEXT("Manager_RunReport_Tooltip", "Generate a report for all rule mappings"),
 		FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Info"));
 
+	ToolBarBuilder.AddToolBarButton(
+		FUIAction(
+			FExecuteAction::CreateSP(this, &SSliceAndDiceManagerWidget::ShowSlowQueryLog),
+			FCanExecuteAction::CreateSP(this, &SSliceAndDiceManagerWidget::CanRun)
+		),
+		NAME_None,
+		LOCTEXT("Manager_SlowQueryLog", "Slow Queries"),
+		LOCTEXT("Manager_SlowQueryLog_Tooltip", "Show queries that exceeded t.RuleProcessor.SlowQueryThresholdMs during rule execution, with their query plans"),
+		FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Info"));
+
 	ToolBarBuilder.AddToolBarButton(
 		FUIAction(
 			FExecuteAction::CreateSP(this, &SSliceAndDiceManagerWidget::DeleteManagedActors, /*bCleanDisabled*/false),
@@ -571,8 +582,52 @@ void SSliceAndDiceManagerWidget::RunReportOnMappings(const TArray<USliceAndDiceM
 	);
 }
 
+void SSliceAndDiceManagerWidget::ShowSlowQueryLog()
+{
+	// Collect the unique point clouds across the mappings; several mappings can share one cloud
+	TSet<UPointCloudImpl*> PointClouds;
+
+	for (USliceAndDiceMapping* Mapping : Manager->Mappings)
+	{
+		if (Mapping)
+		{
+			if (UPointCloudImpl* PointCloud = Cast<UPointCloudImpl>(Mapping->PointCloud.Get()))
+			{
+				PointClouds.Add(PointCloud);
+			}
+		}
+	}
+
+	FString FullReport;
+
+	FullReport += TEXT("Rule Processor Slow Query Log\n");
+	FullReport += TEXT("-------------\n\n");
+
+	if (PointClouds.Num() == 0)
+	{
+		FullReport += TEXT("No loaded point clouds on the mappings of this manager.\n");
+	}
+
+	for (UPointCloudImpl* PointCloud : PointClouds)
+	{
+		FullReport += FString::Printf(TEXT("Point Cloud : %s\n\n"), *PointCloud->GetName());
+		FullReport += PointCloud->GetSlowQueryReport();
+		FullReport += TEXT("\nDatabase Status\n");
+		FullReport += PointCloud->GetDbStatusReport();
+		FullReport += TEXT("\n");
+	}
+
+	ShowDialogForTextOutput(
+		FText::FromString(TEXT("Slow Query Log")),
+		"SliceAndDiceSlowQueryLog",
+		FullReport,
+		/*bShowSaveReport=*/true,
+		/*bShowCopyToClipboard=*/true
+	);
+}
+
 void SSliceAndDiceManagerWidget::RunRules()
-{	
+{
 	if( FMessageDialog::Open(EAppMsgType::OkCancel,
 		FText::FromString(TEXT("Run All Rule Mappings? This may take a few minutes.")),
 		FText::FromString(TEXT("Run All Rules?"))) != EAppReturnType::Ok)
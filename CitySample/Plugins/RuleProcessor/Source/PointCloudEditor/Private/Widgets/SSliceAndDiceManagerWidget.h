@@ -32,6 +32,7 @@ private:
 	TSharedRef<ITableRow> OnGenerateRow(USliceAndDiceMapping* Item, const TSharedRef<STableViewBase>& OwnerTable);
 
 	void RunReport();
+	void ShowSlowQueryLog();
 	void ReloadPointClouds();
 	void RunRules();
 	void DeleteManagedActors(bool bCleanDisabled);
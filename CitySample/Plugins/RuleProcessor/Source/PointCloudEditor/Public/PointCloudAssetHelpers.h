@@ -308,6 +308,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "PointCloud")
 	static void DeleteAllActorsOnDataLayer(UWorld* InWorld, const UDataLayerInstance* InDataLayerInstance);
 
+	/**
+	* Add a batch of actors to the given data layers through a single editor subsystem call. Rules that
+	* spawn many actors should collect them and call this once after their spawn loop; the subsystem
+	* updates its editor-side state once for the whole group instead of once per actor
+	* @param InActors - The actors to add to the data layers
+	* @param InDataLayers - The data layer instances to add the actors to
+	* @return True if all actors were added to all of the data layers
+	*/
+	static bool AddActorsToDataLayers(const TArray<AActor*>& InActors, const TArray<UDataLayerInstance*>& InDataLayers);
+
 	UFUNCTION(BlueprintCallable, Category = "PointCloud")
 	static void DeleteAllActorsByPrefixInPartitionedWorld(UWorld* InWorld, const FString& InPrefix);
 
@@ -1,28 +1,315 @@
 #include "StrandsInputServerSubsystem.h"
+#include "StrandsBatchInputReceiver.h"
 #include "StrandsInputServerSettings.h"
 
 #include "Sockets.h"
 #include "SocketSubsystem.h"
+#include "INetworkingWebSocket.h"
+#include "IWebSocketServer.h"
+#include "IWebSocketNetworkingModule.h"
 #include "IPAddress.h"
 #include "Common/TcpListener.h"
+#include "Common/TcpSocketBuilder.h"
 #include "Interfaces/IPv4/IPv4Endpoint.h"
 
+#include "Engine/Engine.h"
 #include "Engine/World.h"
+#include "EngineUtils.h"
+#include "WorldCollision.h"
 #include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+#include "MassTrafficSubsystem.h"
 
+#include "Algo/SortBy.h"
 #include "Async/Async.h"
 #include "Misc/ScopeLock.h"
 #include "HAL/PlatformTime.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
 
 #include "Json.h"
 #include "JsonUtilities.h"
 #include "HighResScreenshot.h"
+#include "Engine/GameViewportClient.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Modules/ModuleManager.h"
 #include "Misc/Paths.h"
 #include "Misc/FileHelper.h"
 #include "HAL/FileManager.h"
 #include "Components/CapsuleComponent.h"
+#include "Components/SceneCaptureComponent2D.h"
+#include "Engine/SceneCapture2D.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "TextureResource.h"
+
+// Per-command and per-tick diagnostics are off by default; the log formatting
+// alone is measurable at high command rates.
+static TAutoConsoleVariable<int32> CVarStrandsVerboseLog(
+	TEXT("Strands.VerboseLog"),
+	0,
+	TEXT("Enables verbose per-command logging in the Strands input server."),
+	ECVF_Default);
+
+// Per-tick apply budgets: a flooding agent's backlog stays in the receiver
+// queue and degrades that agent's latency instead of the frame rate. 0
+// disables the respective limit.
+static TAutoConsoleVariable<int32> CVarStrandsMaxCommandsPerTick(
+	TEXT("strands.MaxCommandsPerTick"),
+	64,
+	TEXT("Maximum queued commands applied per tick; the surplus carries over to the next tick. 0 = unlimited."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarStrandsCommandBudgetMicroseconds(
+	TEXT("strands.CommandBudgetMicroseconds"),
+	500,
+	TEXT("Time budget in microseconds for applying queued commands per tick. 0 = unlimited."),
+	ECVF_Default);
+
+// Toggling at runtime starts/stops the server in every game world, so non-agent
+// sessions can drop the listener and receiver thread entirely.
+static void Strands_OnEnabledChanged(IConsoleVariable* Var);
+
+static TAutoConsoleVariable<int32> CVarStrandsEnabled(
+	TEXT("strands.Enabled"),
+	1,
+	TEXT("Enables the Strands input server. 0 suspends the listener and receiver thread; 1 restores them."),
+	FConsoleVariableDelegate::CreateStatic(&Strands_OnEnabledChanged),
+	ECVF_Default);
+
+static void Strands_OnEnabledChanged(IConsoleVariable* Var)
+{
+	if (!GEngine)
+	{
+		return;
+	}
+
+	const bool bEnabled = Var->GetInt() != 0;
+	for (const FWorldContext& Context : GEngine->GetWorldContexts())
+	{
+		UWorld* World = Context.World();
+		if (!World || !World->IsGameWorld())
+		{
+			continue;
+		}
+
+		if (UStrandsInputServerSubsystem* Subsystem = World->GetSubsystem<UStrandsInputServerSubsystem>())
+		{
+			if (bEnabled)
+			{
+				Subsystem->StartServer();
+			}
+			else
+			{
+				Subsystem->StopServer();
+			}
+		}
+	}
+}
+
+static FAutoConsoleCommandWithWorld GStrandsDumpStatsCommand(
+	TEXT("strands.DumpStats"),
+	TEXT("Dumps per-command-type receive-to-apply latency stats for the Strands input server."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (World)
+		{
+			if (UStrandsInputServerSubsystem* Subsystem = World->GetSubsystem<UStrandsInputServerSubsystem>())
+			{
+				Subsystem->DumpCommandLatencyStats();
+			}
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs GStrandsStartRecordingCommand(
+	TEXT("strands.StartRecording"),
+	TEXT("Starts recording received Strands commands to a binary log. Optional arg: output file path."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (World)
+		{
+			if (UStrandsInputServerSubsystem* Subsystem = World->GetSubsystem<UStrandsInputServerSubsystem>())
+			{
+				Subsystem->StartRecording(Args.Num() > 0 ? Args[0] : FString());
+			}
+		}
+	}));
+
+static FAutoConsoleCommandWithWorld GStrandsStopRecordingCommand(
+	TEXT("strands.StopRecording"),
+	TEXT("Stops the active Strands command recording and flushes it to disk."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (World)
+		{
+			if (UStrandsInputServerSubsystem* Subsystem = World->GetSubsystem<UStrandsInputServerSubsystem>())
+			{
+				Subsystem->StopRecording();
+			}
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs GStrandsReplayCommand(
+	TEXT("strands.Replay"),
+	TEXT("Replays a recorded Strands command log: strands.Replay <path> [fast]. 'fast' applies the whole log as fast as possible."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (Args.Num() == 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("StrandsInputServer: strands.Replay requires a log file path."));
+			return;
+		}
+
+		if (World)
+		{
+			if (UStrandsInputServerSubsystem* Subsystem = World->GetSubsystem<UStrandsInputServerSubsystem>())
+			{
+				const bool bFast = Args.Num() > 1 && Args[1].Equals(TEXT("fast"), ESearchCase::IgnoreCase);
+				Subsystem->StartReplay(Args[0], bFast);
+			}
+		}
+	}));
+
+static const ANSICHAR GStrandsRecordingMagic[4] = { 'S', 'R', 'L', '1' };
+
+static bool Strands_AppendToFile(const FString& Path, const TArray<uint8>& Bytes)
+{
+	TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileWriter(*Path, FILEWRITE_Append));
+	if (!Ar.IsValid())
+	{
+		return false;
+	}
+	Ar->Serialize(const_cast<uint8*>(Bytes.GetData()), Bytes.Num());
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// FStrandsSessionRecorder
+
+FStrandsSessionRecorder::FStrandsSessionRecorder(const FString& InPath)
+	: Path(InPath)
+{
+	const FString Dir = FPaths::GetPath(Path);
+	if (!Dir.IsEmpty())
+	{
+		IFileManager::Get().MakeDirectory(*Dir, true);
+	}
+
+	// Create (truncate) the file and write the magic up front; everything
+	// after this appends.
+	if (TUniquePtr<FArchive> Ar = TUniquePtr<FArchive>(IFileManager::Get().CreateFileWriter(*Path)))
+	{
+		Ar->Serialize(const_cast<ANSICHAR*>(GStrandsRecordingMagic), sizeof(GStrandsRecordingMagic));
+		bFileValid = true;
+	}
+
+	StartTime = FPlatformTime::Seconds();
+}
+
+void FStrandsSessionRecorder::RecordLine(FAnsiStringView Line)
+{
+	if (!bFileValid || Line.Len() <= 0)
+	{
+		return;
+	}
+
+	const double Time = FPlatformTime::Seconds() - StartTime;
+	const uint32 Length = (uint32)Line.Len();
+
+	FScopeLock ScopedLock(&Lock);
+	Buffer.Append((const uint8*)&Time, sizeof(Time));
+	Buffer.Append((const uint8*)&Length, sizeof(Length));
+	Buffer.Append((const uint8*)Line.GetData(), Line.Len());
+
+	// At most one background flush at a time keeps the appends ordered
+	if (Buffer.Num() >= FlushThresholdBytes && !bFlushInFlight)
+	{
+		KickAsyncFlush();
+	}
+}
+
+void FStrandsSessionRecorder::KickAsyncFlush()
+{
+	bFlushInFlight = true;
+
+	TArray<uint8> ToWrite = MoveTemp(Buffer);
+	Buffer.Reset();
+
+	TSharedRef<FStrandsSessionRecorder, ESPMode::ThreadSafe> Self = AsShared();
+	Async(EAsyncExecution::ThreadPool, [Self, ToWrite = MoveTemp(ToWrite)]()
+	{
+		Strands_AppendToFile(Self->Path, ToWrite);
+
+		FScopeLock ScopedLock(&Self->Lock);
+		Self->bFlushInFlight = false;
+	});
+}
+
+void FStrandsSessionRecorder::Flush()
+{
+	if (!bFileValid)
+	{
+		return;
+	}
+
+	for (;;)
+	{
+		{
+			FScopeLock ScopedLock(&Lock);
+			if (!bFlushInFlight)
+			{
+				if (Buffer.Num() > 0)
+				{
+					Strands_AppendToFile(Path, Buffer);
+					Buffer.Reset();
+				}
+				return;
+			}
+		}
+
+		// An async flush owns the file; wait for it so writes stay ordered
+		FPlatformProcess::Sleep(0.001f);
+	}
+}
+
+static const TCHAR* Strands_CommandTypeName(EStrandsCommandType Type)
+{
+	switch (Type)
+	{
+	case EStrandsCommandType::Move:             return TEXT("move");
+	case EStrandsCommandType::MoveTo:           return TEXT("moveTo");
+	case EStrandsCommandType::Look:             return TEXT("look");
+	case EStrandsCommandType::Jump:             return TEXT("jump");
+	case EStrandsCommandType::Sprint:           return TEXT("sprint");
+	case EStrandsCommandType::Screenshot:       return TEXT("screenshot");
+	case EStrandsCommandType::ScreenshotStream: return TEXT("screenshot_stream");
+	case EStrandsCommandType::State:            return TEXT("state");
+	case EStrandsCommandType::Subscribe:        return TEXT("subscribe");
+	case EStrandsCommandType::Register:         return TEXT("register");
+	case EStrandsCommandType::Stats:            return TEXT("stats");
+	}
+	return TEXT("unknown");
+}
+
+// Percentile over the buffered ring samples; copies and sorts, acceptable at
+// stats-dump frequency.
+static float Strands_LatencyPercentile(const FStrandsCommandLatencyRing& Ring, float Percentile)
+{
+	const int32 Num = Ring.NumBuffered();
+	if (Num == 0)
+	{
+		return 0.f;
+	}
+
+	TArray<float, TInlineAllocator<FStrandsCommandLatencyRing::Capacity>> Sorted(Ring.SamplesMS, Num);
+	Sorted.Sort();
+	const int32 Index = FMath::Clamp(FMath::RoundToInt32(Percentile * (Num - 1)), 0, Num - 1);
+	return Sorted[Index];
+}
 
 void UStrandsInputServerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -34,6 +321,12 @@ void UStrandsInputServerSubsystem::Initialize(FSubsystemCollectionBase& Collecti
 	{
 		bAutoStart = Settings->bAutoStart;
 		Port = Settings->Port;
+		bUsePortRange = Settings->bUsePortRange;
+		PortRangeSize = Settings->PortRangeSize;
+		bEnableWebSocketServer = Settings->bEnableWebSocketServer;
+		WebSocketPort = Settings->WebSocketPort;
+		bEnableSharedMemoryState = Settings->bEnableSharedMemoryState;
+		SharedMemoryName = Settings->SharedMemoryName;
 		DefaultMoveDuration = Settings->DefaultMoveDuration;
 		DefaultLookDuration = Settings->DefaultLookDuration;
 		NormalWalkSpeed = Settings->NormalWalkSpeed;
@@ -58,6 +351,7 @@ void UStrandsInputServerSubsystem::Initialize(FSubsystemCollectionBase& Collecti
 
 void UStrandsInputServerSubsystem::Deinitialize()
 {
+	StopRecording();
 	StopServer();
 
 	Super::Deinitialize();
@@ -70,17 +364,53 @@ bool UStrandsInputServerSubsystem::StartServer()
 		return true;
 	}
 
-	FIPv4Endpoint Endpoint(FIPv4Address::InternalLoopback, Port);
+	if (CVarStrandsEnabled.GetValueOnGameThread() == 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Not starting; disabled by strands.Enabled."));
+		return false;
+	}
+
+	// Bind the listen socket here rather than through FTcpListener's endpoint
+	// constructor so a taken port is detected as a bind failure and the next
+	// port in the range can be tried. Deliberately not reusable: SO_REUSEADDR
+	// would let two instances silently share the same port on some platforms.
+	const int32 NumPortsToTry = bUsePortRange ? FMath::Max(1, PortRangeSize) : 1;
+	for (int32 PortOffset = 0; PortOffset < NumPortsToTry && !ListenSocket; ++PortOffset)
+	{
+		const int32 CandidatePort = Port + PortOffset;
+		const FIPv4Endpoint Endpoint(FIPv4Address::InternalLoopback, (uint16)CandidatePort);
+		ListenSocket = FTcpSocketBuilder(TEXT("StrandsInputServerListener"))
+			.BoundToEndpoint(Endpoint)
+			.Listening(8);
+		if (ListenSocket)
+		{
+			BoundPort = CandidatePort;
+		}
+	}
 
-	// Create listener
-	Listener = MakeUnique<FTcpListener>(Endpoint, FTimespan::FromMilliseconds(10));
-	if (!Listener.IsValid())
+	if (!ListenSocket)
 	{
-		UE_LOG(LogTemp, Error, TEXT("StrandsInputServer: Failed to create TCP listener on 127.0.0.1:%d"), Port);
+		UE_LOG(LogTemp, Error, TEXT("StrandsInputServer: Failed to bind 127.0.0.1 port%s %d%s"),
+			NumPortsToTry > 1 ? TEXT("s") : TEXT(""), Port,
+			NumPortsToTry > 1 ? *FString::Printf(TEXT("-%d"), Port + NumPortsToTry - 1) : TEXT(""));
 		return false;
 	}
 
-	// Bind accept callback - runs on listener thread; enqueue registration on game thread
+	Listener = MakeUnique<FTcpListener>(*ListenSocket, FTimespan::FromMilliseconds(10));
+
+	// Load the image wrapper module on the game thread so background compression
+	// tasks can fetch it without touching the module manager's loading path
+	FModuleManager::Get().LoadModuleChecked<IImageWrapperModule>("ImageWrapper");
+
+	// Spin up the receiver thread before accepting connections
+	Receiver = MakeShared<FStrandsSocketReceiver, ESPMode::ThreadSafe>(DefaultMoveDuration, DefaultLookDuration);
+	if (SessionRecorder.IsValid())
+	{
+		Receiver->SetRecorder(SessionRecorder);
+	}
+	Receiver->Start();
+
+	// Bind accept callback - runs on listener thread; hand the socket straight to the receiver
 	Listener->OnConnectionAccepted().BindLambda([this](FSocket* InSocket, const FIPv4Endpoint& InEndpoint)
 	{
 		if (!InSocket)
@@ -91,549 +421,2511 @@ bool UStrandsInputServerSubsystem::StartServer()
 		InSocket->SetNonBlocking(true);
 		InSocket->SetNoDelay(true);
 
-		TWeakObjectPtr<UStrandsInputServerSubsystem> WeakThis(this);
-		AsyncTask(ENamedThreads::GameThread, [WeakThis, InSocket]()
-		{
-			if (!WeakThis.IsValid())
-			{
-				// If subsystem is gone, close and destroy socket
-				ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(InSocket);
-				return;
-			}
-
-			UStrandsInputServerSubsystem* Self = WeakThis.Get();
-			FStrandsClientState NewClient;
-			NewClient.Socket = InSocket;
-			Self->Clients.Add(MoveTemp(NewClient));
-			UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Client connected."));
-			FStrandsClientState& NewRef = Self->Clients.Last();
-			Self->DrainClient(NewRef);
-		});
-
+		Receiver->AddClient(InSocket);
 		return true;
 	});
 
+	if (bEnableWebSocketServer)
+	{
+		StartWebSocketServer();
+	}
+
+	if (bEnableSharedMemoryState && !StateSharedMemory)
+	{
+		StateSharedMemory = FPlatformMemory::MapNamedSharedMemoryRegion(
+			*SharedMemoryName, /*bCreate*/ true,
+			FPlatformMemory::ESharedMemoryAccess::Read | FPlatformMemory::ESharedMemoryAccess::Write,
+			StateSharedMemorySize);
+		if (StateSharedMemory)
+		{
+			FMemory::Memzero(StateSharedMemory->GetAddress(), StateSharedMemorySize);
+			UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Shared-memory state channel '%s' (%d bytes)"), *SharedMemoryName, (int32)StateSharedMemorySize);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("StrandsInputServer: Failed to map shared-memory region '%s'"), *SharedMemoryName);
+		}
+	}
+
 	bRunning = true;
-	UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Listening on 127.0.0.1:%d"), Port);
+	UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Listening on 127.0.0.1:%d%s"), BoundPort,
+		BoundPort != Port ? *FString::Printf(TEXT(" (configured port %d was busy)"), Port) : TEXT(""));
+
+	// Advertise the negotiated port(s) so local agents can discover instances
+	// without parsing logs: Saved/Strands/Ports/<pid>-<port>.port, one JSON line.
+	PortDiscoveryFile = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Strands"), TEXT("Ports"),
+		FString::Printf(TEXT("%u-%d.port"), FPlatformProcess::GetCurrentProcessId(), BoundPort));
+	const FString Discovery = BoundWebSocketPort > 0
+		? FString::Printf(TEXT("{\"pid\":%u,\"port\":%d,\"wsPort\":%d}\n"), FPlatformProcess::GetCurrentProcessId(), BoundPort, BoundWebSocketPort)
+		: FString::Printf(TEXT("{\"pid\":%u,\"port\":%d}\n"), FPlatformProcess::GetCurrentProcessId(), BoundPort);
+	if (!FFileHelper::SaveStringToFile(Discovery, *PortDiscoveryFile, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("StrandsInputServer: Failed to write port discovery file %s"), *PortDiscoveryFile);
+	}
+
 	return true;
 }
 
-void UStrandsInputServerSubsystem::StopServer()
+bool UStrandsInputServerSubsystem::StartWebSocketServer()
 {
-	bRunning = false;
+	if (WebSocketServer.IsValid())
+	{
+		return true;
+	}
 
-	// Close and destroy all client sockets
-	for (FStrandsClientState& C : Clients)
+	WebSocketServer = FModuleManager::LoadModuleChecked<IWebSocketNetworkingModule>(TEXT("WebSocketNetworking")).CreateServer();
+	if (!WebSocketServer.IsValid())
 	{
-		if (C.Socket)
-		{
-			C.Socket->Close();
-			ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(C.Socket);
-			C.Socket = nullptr;
-		}
+		UE_LOG(LogTemp, Error, TEXT("StrandsInputServer: Failed to create WebSocket server."));
+		return false;
 	}
-	Clients.Empty();
 
-	// Destroy listener
-	if (Listener.IsValid())
+	FWebSocketClientConnectedCallBack ConnectedCallback;
+	ConnectedCallback.BindUObject(this, &UStrandsInputServerSubsystem::OnWebSocketClientConnected);
+
+	// Shift by the same offset the TCP port-range scan landed on so parallel
+	// instances keep their WebSocket ports separated too
+	const int32 PortToUse = WebSocketPort + (BoundPort > 0 ? BoundPort - Port : 0);
+	if (!WebSocketServer->Init(PortToUse, ConnectedCallback))
 	{
-		Listener.Reset();
+		UE_LOG(LogTemp, Error, TEXT("StrandsInputServer: Failed to start WebSocket server on port %d"), PortToUse);
+		WebSocketServer.Reset();
+		return false;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Stopped."));
+	BoundWebSocketPort = PortToUse;
+	UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: WebSocket listening on port %d"), PortToUse);
+	return true;
 }
 
-void UStrandsInputServerSubsystem::Tick(float DeltaTime)
+void UStrandsInputServerSubsystem::OnWebSocketClientConnected(INetworkingWebSocket* Socket)
 {
-	if (bRunning)
+	if (!Socket)
 	{
-		PollClients(DeltaTime);
+		return;
 	}
 
-	ApplyScheduledActions(DeltaTime);
-	ApplySprintIfPending();
+	const uint64 ClientId = WebSocketClientIdBit | NextWebSocketClientId++;
+	WebSocketClients.Add(ClientId, Socket);
+	UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: WebSocket client connected."));
+
+	// WebSocket messages arrive as complete frames on the game thread; they go
+	// through the same command dispatch as TCP lines and apply immediately.
+	FWebSocketPacketReceivedCallBack ReceiveCallback;
+	ReceiveCallback.BindWeakLambda(this, [this, ClientId](void* Data, int32 Size)
+	{
+		const double ReceiveTime = FPlatformTime::Seconds();
+
+		if (SessionRecorder.IsValid())
+		{
+			SessionRecorder->RecordLine(FAnsiStringView((const ANSICHAR*)Data, Size));
+		}
+
+		FUTF8ToTCHAR Converted((const ANSICHAR*)Data, Size);
+		const FString Message(Converted.Length(), Converted.Get());
+
+		TArray<FStrandsParsedCommand> Parsed;
+		Strands_ParseTextCommands(ClientId, Message, Parsed);
+		for (FStrandsParsedCommand& Command : Parsed)
+		{
+			Command.ReceiveTime = ReceiveTime;
+			ApplyParsedCommand(Command);
+		}
+	});
+	Socket->SetReceiveCallBack(ReceiveCallback);
+
+	FWebSocketInfoCallBack ClosedCallback;
+	ClosedCallback.BindWeakLambda(this, [this, ClientId]()
+	{
+		WebSocketClients.Remove(ClientId);
+		UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: WebSocket client disconnected."));
+	});
+	Socket->SetSocketClosedCallBack(ClosedCallback);
 }
 
-bool UStrandsInputServerSubsystem::HandleConnectionAccepted(FSocket* InSocket, const FIPv4Endpoint& InEndpoint)
+void UStrandsInputServerSubsystem::SendToClientTransport(uint64 ClientId, TArray<uint8>&& Bytes)
 {
-	// Not used (we bind a lambda), but keep implementation to match signature if needed.
-	return true;
+	if ((ClientId & WebSocketClientIdBit) != 0)
+	{
+		check(IsInGameThread());
+		if (INetworkingWebSocket** Socket = WebSocketClients.Find(ClientId))
+		{
+			(*Socket)->Send(Bytes.GetData(), Bytes.Num(), /*bPrependSize*/ false);
+		}
+	}
+	else if (Receiver.IsValid())
+	{
+		Receiver->SendToClient(ClientId, MoveTemp(Bytes));
+	}
 }
 
-static void Strands_SplitLines(FString& Accumulator, TArray<FString>& OutLines)
+void UStrandsInputServerSubsystem::StopServer()
 {
-	int32 NewlineIndex;
-	while (Accumulator.FindChar(TEXT('\n'), NewlineIndex))
+	bRunning = false;
+
+	// Destroy listener first so no new sockets are handed to the receiver
+	if (Listener.IsValid())
+	{
+		Listener.Reset();
+	}
+
+	// The listen socket is owned here, not by the listener (see StartServer)
+	if (ListenSocket)
+	{
+		ListenSocket->Close();
+		if (ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM))
+		{
+			SocketSubsystem->DestroySocket(ListenSocket);
+		}
+		ListenSocket = nullptr;
+	}
+	BoundPort = 0;
+	BoundWebSocketPort = 0;
+
+	// Retract the port advertisement
+	if (!PortDiscoveryFile.IsEmpty())
+	{
+		IFileManager::Get().Delete(*PortDiscoveryFile, /*RequireExists*/ false, /*EvenReadOnly*/ false, /*Quiet*/ true);
+		PortDiscoveryFile.Reset();
+	}
+
+	// Unbind from viewport capture notifications
+	if (ScreenshotCapturedHandle.IsValid())
 	{
-		FString Line = Accumulator.Left(NewlineIndex);
-		Accumulator.RemoveAt(0, NewlineIndex + 1, EAllowShrinking::No);
-		Line.TrimStartAndEndInline();
-		if (!Line.IsEmpty())
+		if (UWorld* World = GetWorld())
 		{
-			// Strip optional trailing \r
-			if (Line.Len() > 0 && Line[Line.Len() - 1] == TEXT('\r'))
+			if (UGameViewportClient* Viewport = World->GetGameViewport())
 			{
-				Line.RemoveAt(Line.Len() - 1, 1, EAllowShrinking::No);
+				Viewport->OnScreenshotCaptured().Remove(ScreenshotCapturedHandle);
 			}
-			OutLines.Add(MoveTemp(Line));
 		}
+		ScreenshotCapturedHandle.Reset();
+	}
+	PendingStreamRequests.Reset();
+
+	// Drop the pooled vision capture actor with the session
+	if (ASceneCapture2D* CaptureActor = AgentVisionActor.Get())
+	{
+		CaptureActor->Destroy();
+	}
+	AgentVisionActor.Reset();
+
+	// Stop the receiver thread; it closes and destroys all client sockets on exit
+	if (Receiver.IsValid())
+	{
+		Receiver.Reset();
+	}
+
+	// Tear down the WebSocket listener and its connections
+	WebSocketClients.Empty();
+	if (WebSocketServer.IsValid())
+	{
+		WebSocketServer.Reset();
+	}
+
+	if (StateSharedMemory)
+	{
+		FPlatformMemory::UnmapNamedSharedMemoryRegion(StateSharedMemory);
+		StateSharedMemory = nullptr;
 	}
+
+	UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Stopped."));
 }
 
-void UStrandsInputServerSubsystem::DrainClient(FStrandsClientState& Client)
+bool UStrandsInputServerSubsystem::IsTickable() const
 {
-	if (!Client.Socket) return;
+	if (bReplaying)
+	{
+		return true;
+	}
 
-	uint32 PendingSize = 0;
-	while (Client.Socket->HasPendingData(PendingSize) && PendingSize > 0)
+	if (!bRunning)
 	{
-		const uint32 ToRead = FMath::Min(PendingSize, (uint32)65536);
-		TArray<uint8> Buffer;
-		Buffer.SetNumUninitialized(ToRead);
+		// Any actions still scheduled when the server stops must keep expiring
+		return HasPendingTargetWork();
+	}
 
-		int32 ActuallyRead = 0;
-		if (Client.Socket->Recv(Buffer.GetData(), Buffer.Num(), ActuallyRead, ESocketReceiveFlags::None) && ActuallyRead > 0)
+	// The WebSocket server accepts during Tick, and the shared-memory channel
+	// publishes every tick, so either keeps the subsystem ticking while running.
+	if (WebSocketServer.IsValid() || StateSharedMemory || PendingStreamRequests.Num() > 0)
+	{
+		return true;
+	}
+
+	if (Receiver.IsValid() && (Receiver->GetConnectedClientCount() > 0 || Receiver->HasQueuedCommands()))
+	{
+		return true;
+	}
+
+	return HasPendingTargetWork();
+}
+
+void UStrandsInputServerSubsystem::Tick(float DeltaTime)
+{
+	if (bRunning && Receiver.IsValid())
+	{
+		// Budgeted apply: stop once either limit is hit; the surplus stays in
+		// the receiver's queue and is carried into the next tick.
+		const int32 MaxCommands = CVarStrandsMaxCommandsPerTick.GetValueOnGameThread();
+		const double BudgetSeconds = (double)CVarStrandsCommandBudgetMicroseconds.GetValueOnGameThread() * 1e-6;
+		const double BudgetStart = FPlatformTime::Seconds();
+
+		TArray<uint64, TInlineAllocator<8>> ClientsThisTick;
+		int32 NumApplied = 0;
+		FStrandsParsedCommand Command;
+		while (Receiver->DequeueCommand(Command))
 		{
-			// Assume ASCII/UTF-8 JSON lines; append bytes to string
-			FString Chunk;
-			Chunk.Reserve(ActuallyRead);
-			for (int32 b = 0; b < ActuallyRead; ++b)
+			ApplyParsedCommand(Command);
+			ClientsThisTick.AddUnique(Command.ClientId);
+			++NumApplied;
+
+			if ((MaxCommands > 0 && NumApplied >= MaxCommands) ||
+				(BudgetSeconds > 0.0 && FPlatformTime::Seconds() - BudgetStart >= BudgetSeconds))
 			{
-				Chunk.AppendChar((TCHAR)Buffer[b]);
+				break;
 			}
+		}
 
-			Client.Pending += Chunk;
-
-			// Extract complete lines
-			TArray<FString> Lines;
-			Strands_SplitLines(Client.Pending, Lines);
-			for (FString& Line : Lines)
+		// Backpressure notification: tell the clients we served this tick that
+		// their remaining commands are queued, once per backlog episode.
+		if (Receiver->HasQueuedCommands())
+		{
+			if (!bBackpressureNotified)
 			{
-				ProcessLine(Line);
+				bBackpressureNotified = true;
+				TAnsiStringBuilder<64> Builder;
+				Builder.Appendf("{\"backpressure\":true,\"ts\":%.6f}\n", FPlatformTime::Seconds());
+				for (const uint64 ClientId : ClientsThisTick)
+				{
+					if (ClientId != 0)
+					{
+						TArray<uint8> Bytes((const uint8*)Builder.GetData(), Builder.Len());
+						SendToClientTransport(ClientId, MoveTemp(Bytes));
+					}
+				}
+				UE_LOG(LogTemp, Warning, TEXT("StrandsInputServer: Command backlog; applied %d this tick, deferring the rest."), NumApplied);
 			}
 		}
 		else
 		{
-			break;
+			bBackpressureNotified = false;
 		}
 	}
-}
 
-void UStrandsInputServerSubsystem::PollClients(float DeltaSeconds)
-{
-	// Iterate backwards so we can remove disconnected clients
-	for (int32 i = Clients.Num() - 1; i >= 0; --i)
+	// The WebSocket server accepts and receives during its tick
+	if (bRunning && WebSocketServer.IsValid())
+	{
+		WebSocketServer->Tick();
+	}
+
+	// Feed due replayed commands through the same apply path as live ones
+	if (bReplaying)
+	{
+		TickReplay(FPlatformTime::Seconds());
+	}
+
+	ApplyScheduledActions(DeltaTime);
+
+	// Push delta-encoded state to subscribed clients that have come due
+	if (bRunning && Subscriptions.Num() > 0)
+	{
+		TickSubscriptions(FPlatformTime::Seconds());
+	}
+
+	// Publish the state snapshot for zero-syscall local readers
+	if (bRunning && StateSharedMemory)
+	{
+		UpdateSharedMemoryState();
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+// FStrandsSocketReceiver
+
+FStrandsSocketReceiver::FStrandsSocketReceiver(float InDefaultMoveDuration, float InDefaultLookDuration)
+	: DefaultMoveDuration(InDefaultMoveDuration)
+	, DefaultLookDuration(InDefaultLookDuration)
+{
+	RecvBuffer.SetNumUninitialized(65536);
+}
+
+FStrandsSocketReceiver::~FStrandsSocketReceiver()
+{
+	if (Thread)
+	{
+		Thread->Kill(/*bShouldWait*/ true);
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	// If the thread never ran (or sockets were queued after exit), clean up here
+	CloseAllClients();
+	FSocket* Pending = nullptr;
+	while (PendingSockets.Dequeue(Pending))
+	{
+		ConnectedClients.Decrement();
+		if (Pending)
+		{
+			ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Pending);
+		}
+	}
+}
+
+void FStrandsSocketReceiver::Start()
+{
+	check(Thread == nullptr);
+	Thread = FRunnableThread::Create(this, TEXT("StrandsSocketReceiver"), 0, TPri_BelowNormal);
+}
+
+void FStrandsSocketReceiver::Stop()
+{
+	bStopRequested = true;
+}
+
+void FStrandsSocketReceiver::AddClient(FSocket* InSocket)
+{
+	// Counted before enqueueing so idle tick gating sees the connection the
+	// moment the accept callback runs.
+	ConnectedClients.Increment();
+	PendingSockets.Enqueue(InSocket);
+}
+
+bool FStrandsSocketReceiver::DequeueCommand(FStrandsParsedCommand& OutCommand)
+{
+	return Commands.Dequeue(OutCommand);
+}
+
+void FStrandsSocketReceiver::SetRecorder(const TSharedPtr<FStrandsSessionRecorder, ESPMode::ThreadSafe>& InRecorder)
+{
+	FScopeLock ScopedLock(&RecorderLock);
+	Recorder = InRecorder;
+}
+
+void FStrandsSocketReceiver::SendToClient(uint64 ClientId, TArray<uint8>&& Bytes)
+{
+	FOutboundPacket Packet;
+	Packet.ClientId = ClientId;
+	Packet.Bytes = MoveTemp(Bytes);
+	Outbound.Enqueue(MoveTemp(Packet));
+}
+
+void FStrandsSocketReceiver::FlushOutbound()
+{
+	FOutboundPacket Packet;
+	while (Outbound.Dequeue(Packet))
+	{
+		FSocket* Target = nullptr;
+		for (FStrandsClientState& Client : Clients)
+		{
+			if (Client.ClientId == Packet.ClientId)
+			{
+				Target = Client.Socket;
+				break;
+			}
+		}
+
+		if (!Target)
+		{
+			continue; // Client disconnected since the response was queued
+		}
+
+		// Sockets are non-blocking; retry briefly on a full send buffer
+		int32 Offset = 0;
+		while (Offset < Packet.Bytes.Num() && !bStopRequested)
+		{
+			int32 Sent = 0;
+			if (Target->Send(Packet.Bytes.GetData() + Offset, Packet.Bytes.Num() - Offset, Sent))
+			{
+				Offset += Sent;
+			}
+			else if (Target->GetConnectionState() != SCS_Connected)
+			{
+				break;
+			}
+			else
+			{
+				FPlatformProcess::SleepNoStats(0.0005f);
+			}
+		}
+	}
+}
+
+uint32 FStrandsSocketReceiver::Run()
+{
+	while (!bStopRequested)
+	{
+		// Adopt newly accepted sockets
+		FSocket* NewSocket = nullptr;
+		while (PendingSockets.Dequeue(NewSocket))
+		{
+			if (NewSocket)
+			{
+				FStrandsClientState NewClient;
+				NewClient.Socket = NewSocket;
+				NewClient.ClientId = NextClientId++;
+				Clients.Add(MoveTemp(NewClient));
+				UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Client connected."));
+			}
+			else
+			{
+				ConnectedClients.Decrement();
+			}
+		}
+
+		// Write any queued responses before draining new input
+		FlushOutbound();
+
+		// Drain every client; iterate backwards so we can remove disconnected clients
+		bool bAnyData = false;
+		for (int32 i = Clients.Num() - 1; i >= 0; --i)
+		{
+			FStrandsClientState& Client = Clients[i];
+			if (!Client.Socket)
+			{
+				Clients.RemoveAtSwap(i);
+				ConnectedClients.Decrement();
+				continue;
+			}
+
+			uint32 PendingSize = 0;
+			if (Client.Socket->HasPendingData(PendingSize) && PendingSize > 0)
+			{
+				bAnyData = true;
+				DrainClient(Client);
+			}
+
+			// Read all pending data FIRST, even if the peer closed after sending
+			ESocketConnectionState ConnState = Client.Socket->GetConnectionState();
+			if (ConnState != SCS_Connected)
+			{
+				Client.Socket->Close();
+				ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Client.Socket);
+				Client.Socket = nullptr;
+				Clients.RemoveAtSwap(i);
+				ConnectedClients.Decrement();
+				UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Client disconnected."));
+				continue;
+			}
+		}
+
+		// Back off slightly when idle; stay responsive when data is flowing
+		FPlatformProcess::SleepNoStats(bAnyData ? 0.0005f : 0.002f);
+	}
+
+	CloseAllClients();
+	return 0;
+}
+
+void FStrandsSocketReceiver::CloseAllClients()
+{
+	for (FStrandsClientState& C : Clients)
+	{
+		if (C.Socket)
+		{
+			C.Socket->Close();
+			ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(C.Socket);
+			C.Socket = nullptr;
+		}
+	}
+	ConnectedClients.Subtract(Clients.Num());
+	Clients.Empty();
+}
+
+void FStrandsSocketReceiver::DrainClient(FStrandsClientState& Client)
+{
+	if (!Client.Socket) return;
+
+	uint32 PendingSize = 0;
+	while (Client.Socket->HasPendingData(PendingSize) && PendingSize > 0)
+	{
+		const int32 ToRead = FMath::Min((int32)PendingSize, RecvBuffer.Num());
+
+		int32 ActuallyRead = 0;
+		if (Client.Socket->Recv(RecvBuffer.GetData(), ToRead, ActuallyRead, ESocketReceiveFlags::None) && ActuallyRead > 0)
+		{
+			ConsumeReceivedBytes(Client, RecvBuffer.GetData(), ActuallyRead);
+		}
+		else
+		{
+			break;
+		}
+	}
+}
+
+void FStrandsSocketReceiver::ConsumeReceivedBytes(FStrandsClientState& Client, const uint8* Data, int32 Num)
+{
+	// All bytes land in the accumulator; the parser consumes slices in place.
+	Client.Pending.Append(Data, Num);
+
+	// Protocol negotiation: the first 4 bytes on a connection select the mode.
+	// "SBF1" switches the client to binary frames; anything else is JSON lines.
+	if (!Client.bProtocolDecided)
+	{
+		if (Client.Pending.NumPending() < 4)
+		{
+			return;
+		}
+
+		static const uint8 BinaryMagic[4] = { 'S', 'B', 'F', '1' };
+		if (FMemory::Memcmp(Client.Pending.PeekData(), BinaryMagic, 4) == 0)
+		{
+			Client.bBinaryMode = true;
+			Client.Pending.Consume(4);
+			UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Client negotiated binary frame protocol."));
+		}
+		Client.bProtocolDecided = true;
+	}
+
+	if (Client.bBinaryMode)
+	{
+		ProcessBinaryFrames(Client);
+	}
+	else
+	{
+		ProcessPendingLines(Client);
+	}
+}
+
+void FStrandsSocketReceiver::ProcessPendingLines(FStrandsClientState& Client)
+{
+	// Scan the accumulator for complete lines and hand out string-view slices;
+	// no per-byte widening and no front-removal copies on the hot path.
+	for (;;)
+	{
+		const uint8* Data = Client.Pending.PeekData();
+		const int32 Num = Client.Pending.NumPending();
+
+		const uint8* Newline = (const uint8*)FMemory::Memchr(Data, '\n', Num);
+		if (!Newline)
+		{
+			break;
+		}
+
+		int32 LineLen = (int32)(Newline - Data);
+		const ANSICHAR* LineStart = (const ANSICHAR*)Data;
+
+		// Trim leading/trailing whitespace including an optional \r
+		while (LineLen > 0 && FChar::IsWhitespace(LineStart[LineLen - 1]))
+		{
+			--LineLen;
+		}
+		while (LineLen > 0 && FChar::IsWhitespace(*LineStart))
+		{
+			++LineStart;
+			--LineLen;
+		}
+
+		if (LineLen > 0)
+		{
+			ProcessLine(Client.ClientId, FAnsiStringView(LineStart, LineLen));
+		}
+
+		Client.Pending.Consume((int32)(Newline - Data) + 1);
+	}
+
+	Client.Pending.Compact();
+}
+
+void FStrandsSocketReceiver::ProcessBinaryFrames(FStrandsClientState& Client)
+{
+	// Frames are [uint8 Command][uint8 PayloadSize][payload]; consume as many
+	// complete frames as we have, leaving any partial trailing frame buffered.
+	const double ReceiveTime = FPlatformTime::Seconds();
+	int32 Offset = 0;
+	const uint8* Bytes = Client.Pending.PeekData();
+	const int32 Total = Client.Pending.NumPending();
+
+	while (Total - Offset >= 2)
+	{
+		const EStrandsBinaryCommand Command = (EStrandsBinaryCommand)Bytes[Offset];
+		const int32 PayloadSize = Bytes[Offset + 1];
+		if (Total - Offset - 2 < PayloadSize)
+		{
+			break; // Incomplete frame; wait for more bytes
+		}
+
+		const uint8* Payload = Bytes + Offset + 2;
+		switch (Command)
+		{
+		case EStrandsBinaryCommand::Move:
+			if (PayloadSize >= (int32)sizeof(FStrandsBinaryMovePayload))
+			{
+				FStrandsBinaryMovePayload Move;
+				FMemory::Memcpy(&Move, Payload, sizeof(Move));
+				FStrandsParsedCommand Parsed;
+				Parsed.ClientId = Client.ClientId;
+				Parsed.ReceiveTime = ReceiveTime;
+				Parsed.Type = EStrandsCommandType::Move;
+				Parsed.Axis = FVector2D(Move.Forward, Move.Right);
+				Parsed.Duration = Move.Duration > 0.f ? (double)Move.Duration : -1.0;
+				if (PayloadSize >= (int32)sizeof(FStrandsBinaryMovePayload) + 4)
+				{
+					FMemory::Memcpy(&Parsed.Seq, Payload + sizeof(FStrandsBinaryMovePayload), sizeof(uint32));
+				}
+				Commands.Enqueue(MoveTemp(Parsed));
+			}
+			break;
+
+		case EStrandsBinaryCommand::Look:
+			if (PayloadSize >= (int32)sizeof(FStrandsBinaryLookPayload))
+			{
+				FStrandsBinaryLookPayload Look;
+				FMemory::Memcpy(&Look, Payload, sizeof(Look));
+				FStrandsParsedCommand Parsed;
+				Parsed.ClientId = Client.ClientId;
+				Parsed.ReceiveTime = ReceiveTime;
+				Parsed.Type = EStrandsCommandType::Look;
+				Parsed.Axis = FVector2D(Look.YawRate, Look.PitchRate);
+				Parsed.Duration = Look.Duration > 0.f ? (double)Look.Duration : -1.0;
+				if (PayloadSize >= (int32)sizeof(FStrandsBinaryLookPayload) + 4)
+				{
+					FMemory::Memcpy(&Parsed.Seq, Payload + sizeof(FStrandsBinaryLookPayload), sizeof(uint32));
+				}
+				Commands.Enqueue(MoveTemp(Parsed));
+			}
+			break;
+
+		case EStrandsBinaryCommand::Jump:
+			{
+				FStrandsParsedCommand Parsed;
+				Parsed.ClientId = Client.ClientId;
+				Parsed.ReceiveTime = ReceiveTime;
+				Parsed.Type = EStrandsCommandType::Jump;
+				if (PayloadSize >= 4)
+				{
+					FMemory::Memcpy(&Parsed.Seq, Payload, sizeof(uint32));
+				}
+				Commands.Enqueue(MoveTemp(Parsed));
+			}
+			break;
+
+		case EStrandsBinaryCommand::Sprint:
+			if (PayloadSize >= (int32)sizeof(FStrandsBinarySprintPayload))
+			{
+				FStrandsParsedCommand Parsed;
+				Parsed.ClientId = Client.ClientId;
+				Parsed.ReceiveTime = ReceiveTime;
+				Parsed.Type = EStrandsCommandType::Sprint;
+				Parsed.bEnabled = Payload[0] != 0;
+				if (PayloadSize >= (int32)sizeof(FStrandsBinarySprintPayload) + 4)
+				{
+					FMemory::Memcpy(&Parsed.Seq, Payload + sizeof(FStrandsBinarySprintPayload), sizeof(uint32));
+				}
+				Commands.Enqueue(MoveTemp(Parsed));
+			}
+			break;
+
+		default:
+			UE_LOG(LogTemp, Warning, TEXT("StrandsInputServer: Unknown binary command %d"), (int32)Command);
+			break;
+		}
+
+		Offset += 2 + PayloadSize;
+	}
+
+	if (Offset > 0)
+	{
+		Client.Pending.Consume(Offset);
+	}
+	Client.Pending.Compact();
+}
+
+// Shared command dispatch used by both the TCP receiver thread and the
+// WebSocket transport on the game thread: one JSON object -> parsed commands.
+// Reads the optional keyframe track off a move/look command: "keys" is an array
+// of { "t": seconds, <XField>: ..., <YField>: ... } objects and "ease" selects
+// the interpolation profile. Keys are sorted by time on ingest so evaluation
+// can rely on a forward-only cursor.
+static void Strands_ParseTrackKeys(const TSharedPtr<FJsonObject>& Obj, const TCHAR* XField, const TCHAR* YField, FStrandsParsedCommand& Parsed)
+{
+	const TArray<TSharedPtr<FJsonValue>>* KeyValues = nullptr;
+	if (!Obj->TryGetArrayField(TEXT("keys"), KeyValues))
+	{
+		return;
+	}
+
+	for (const TSharedPtr<FJsonValue>& Value : *KeyValues)
+	{
+		const TSharedPtr<FJsonObject>* KeyObj = nullptr;
+		if (!Value.IsValid() || !Value->TryGetObject(KeyObj) || !KeyObj)
+		{
+			continue;
+		}
+
+		FStrandsTrackKey Key;
+		if ((*KeyObj)->HasTypedField<EJson::Number>(TEXT("t"))) Key.Time = (float)(*KeyObj)->GetNumberField(TEXT("t"));
+		if ((*KeyObj)->HasTypedField<EJson::Number>(XField)) Key.Value.X = (float)(*KeyObj)->GetNumberField(XField);
+		if ((*KeyObj)->HasTypedField<EJson::Number>(YField)) Key.Value.Y = (float)(*KeyObj)->GetNumberField(YField);
+		Parsed.Keys.Add(Key);
+	}
+
+	Algo::SortBy(Parsed.Keys, &FStrandsTrackKey::Time);
+
+	FString EaseName;
+	if (Obj->TryGetStringField(TEXT("ease"), EaseName))
+	{
+		if (EaseName.Equals(TEXT("hold"), ESearchCase::IgnoreCase))
+		{
+			Parsed.Ease = EStrandsTrackEase::Hold;
+		}
+		else if (EaseName.Equals(TEXT("smooth"), ESearchCase::IgnoreCase))
+		{
+			Parsed.Ease = EStrandsTrackEase::Smooth;
+		}
+	}
+}
+
+static void Strands_ParseCommandObject(uint64 ClientId, const TSharedPtr<FJsonObject>& Obj, TArray<FStrandsParsedCommand>& OutCommands)
+{
+	const FString Cmd = Obj->GetStringField(TEXT("cmd"));
+
+	if (CVarStrandsVerboseLog.GetValueOnAnyThread() != 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Received cmd '%s'"), *Cmd);
+	}
+
+	// Optional client sequence ID; echoed back as an ack when the command is applied
+	uint32 Seq = 0;
+	if (Obj->HasTypedField<EJson::Number>(TEXT("seq")))
+	{
+		Seq = (uint32)Obj->GetNumberField(TEXT("seq"));
+	}
+
+	// Optional routing target; empty addresses the first player's pawn
+	FName Target = NAME_None;
+	if (Obj->HasTypedField<EJson::String>(TEXT("target")))
+	{
+		Target = FName(*Obj->GetStringField(TEXT("target")));
+	}
+
+	if (Cmd.Equals(TEXT("move"), ESearchCase::IgnoreCase))
+	{
+		FStrandsParsedCommand Parsed;
+		Parsed.ClientId = ClientId;
+		Parsed.Seq = Seq;
+		Parsed.Target = Target;
+		Parsed.Type = EStrandsCommandType::Move;
+
+		double Forward = 0.0;
+		double Right = 0.0;
+		if (Obj->HasTypedField<EJson::Number>(TEXT("forward"))) Forward = Obj->GetNumberField(TEXT("forward"));
+		if (Obj->HasTypedField<EJson::Number>(TEXT("right"))) Right = Obj->GetNumberField(TEXT("right"));
+		if (Obj->HasTypedField<EJson::Number>(TEXT("duration"))) Parsed.Duration = Obj->GetNumberField(TEXT("duration"));
+
+		Parsed.Axis = FVector2D((float)Forward, (float)Right);
+		Strands_ParseTrackKeys(Obj, TEXT("forward"), TEXT("right"), Parsed);
+		OutCommands.Add(MoveTemp(Parsed));
+	}
+	else if (Cmd.Equals(TEXT("moveTo"), ESearchCase::IgnoreCase))
+	{
+		// High-level navigation: { "cmd": "moveTo", "x": ..., "y": ..., "z": ..., "acceptance": 50 }
+		FStrandsParsedCommand Parsed;
+		Parsed.ClientId = ClientId;
+		Parsed.Seq = Seq;
+		Parsed.Target = Target;
+		Parsed.Type = EStrandsCommandType::MoveTo;
+
+		if (Obj->HasTypedField<EJson::Number>(TEXT("x"))) Parsed.Location.X = Obj->GetNumberField(TEXT("x"));
+		if (Obj->HasTypedField<EJson::Number>(TEXT("y"))) Parsed.Location.Y = Obj->GetNumberField(TEXT("y"));
+		if (Obj->HasTypedField<EJson::Number>(TEXT("z"))) Parsed.Location.Z = Obj->GetNumberField(TEXT("z"));
+		if (Obj->HasTypedField<EJson::Number>(TEXT("acceptance")))
+		{
+			Parsed.AcceptanceRadius = FMath::Max(1.f, (float)Obj->GetNumberField(TEXT("acceptance")));
+		}
+		OutCommands.Add(MoveTemp(Parsed));
+	}
+	else if (Cmd.Equals(TEXT("look"), ESearchCase::IgnoreCase))
+	{
+		FStrandsParsedCommand Parsed;
+		Parsed.ClientId = ClientId;
+		Parsed.Seq = Seq;
+		Parsed.Target = Target;
+		Parsed.Type = EStrandsCommandType::Look;
+
+		double YawRate = 0.0;
+		double PitchRate = 0.0;
+		if (Obj->HasTypedField<EJson::Number>(TEXT("yawRate"))) YawRate = Obj->GetNumberField(TEXT("yawRate"));
+		if (Obj->HasTypedField<EJson::Number>(TEXT("pitchRate"))) PitchRate = Obj->GetNumberField(TEXT("pitchRate"));
+		if (Obj->HasTypedField<EJson::Number>(TEXT("duration"))) Parsed.Duration = Obj->GetNumberField(TEXT("duration"));
+
+		Parsed.Axis = FVector2D((float)YawRate, (float)PitchRate); // degrees/sec
+		Strands_ParseTrackKeys(Obj, TEXT("yawRate"), TEXT("pitchRate"), Parsed);
+		OutCommands.Add(MoveTemp(Parsed));
+	}
+	else if (Cmd.Equals(TEXT("jump"), ESearchCase::IgnoreCase))
+	{
+		FStrandsParsedCommand Parsed;
+		Parsed.ClientId = ClientId;
+		Parsed.Seq = Seq;
+		Parsed.Target = Target;
+		Parsed.Type = EStrandsCommandType::Jump;
+		OutCommands.Add(MoveTemp(Parsed));
+	}
+	else if (Cmd.Equals(TEXT("sprint"), ESearchCase::IgnoreCase))
+	{
+		bool bEnabled = false;
+		if (Obj->HasField(TEXT("enabled")))
+		{
+			if (Obj->TryGetBoolField(TEXT("enabled"), bEnabled))
+			{
+				FStrandsParsedCommand Parsed;
+				Parsed.ClientId = ClientId;
+				Parsed.Seq = Seq;
+				Parsed.Target = Target;
+				Parsed.Type = EStrandsCommandType::Sprint;
+				Parsed.bEnabled = bEnabled;
+				OutCommands.Add(MoveTemp(Parsed));
+			}
+		}
+	}
+	else if (Cmd.Equals(TEXT("screenshot"), ESearchCase::IgnoreCase))
+	{
+		FStrandsParsedCommand Parsed;
+		Parsed.ClientId = ClientId;
+		Parsed.Seq = Seq;
+		Parsed.Target = Target;
+		Parsed.Type = EStrandsCommandType::Screenshot;
+		if (Obj->HasTypedField<EJson::String>(TEXT("path")))
+		{
+			Parsed.Path = Obj->GetStringField(TEXT("path"));
+		}
+		if (Obj->HasTypedField<EJson::Boolean>(TEXT("showUI")))
+		{
+			Parsed.bShowUI = Obj->GetBoolField(TEXT("showUI"));
+		}
+		// Optional low-res vision capture: "width" (and "height") render the
+		// view through the dedicated scene capture instead of the backbuffer
+		if (Obj->HasTypedField<EJson::Number>(TEXT("width")))
+		{
+			Parsed.CaptureWidth = FMath::Clamp((int32)Obj->GetNumberField(TEXT("width")), 64, 2048);
+		}
+		if (Obj->HasTypedField<EJson::Number>(TEXT("height")))
+		{
+			Parsed.CaptureHeight = FMath::Clamp((int32)Obj->GetNumberField(TEXT("height")), 64, 2048);
+		}
+		OutCommands.Add(MoveTemp(Parsed));
+	}
+	else if (Cmd.Equals(TEXT("screenshot_stream"), ESearchCase::IgnoreCase))
+	{
+		FStrandsParsedCommand Parsed;
+		Parsed.ClientId = ClientId;
+		Parsed.Seq = Seq;
+		Parsed.Target = Target;
+		Parsed.Type = EStrandsCommandType::ScreenshotStream;
+		if (Obj->HasTypedField<EJson::Number>(TEXT("quality")))
+		{
+			Parsed.Quality = FMath::Clamp((int32)Obj->GetNumberField(TEXT("quality")), 1, 100);
+		}
+		if (Obj->HasTypedField<EJson::Number>(TEXT("width")))
+		{
+			Parsed.CaptureWidth = FMath::Clamp((int32)Obj->GetNumberField(TEXT("width")), 64, 2048);
+		}
+		if (Obj->HasTypedField<EJson::Number>(TEXT("height")))
+		{
+			Parsed.CaptureHeight = FMath::Clamp((int32)Obj->GetNumberField(TEXT("height")), 64, 2048);
+		}
+		OutCommands.Add(MoveTemp(Parsed));
+	}
+	else if (Cmd.Equals(TEXT("register"), ESearchCase::IgnoreCase))
+	{
+		FStrandsParsedCommand Parsed;
+		Parsed.ClientId = ClientId;
+		Parsed.Seq = Seq;
+		Parsed.Target = Target;
+		Parsed.Type = EStrandsCommandType::Register;
+		if (Obj->HasTypedField<EJson::String>(TEXT("actor")))
+		{
+			Parsed.TargetActor = Obj->GetStringField(TEXT("actor"));
+		}
+		OutCommands.Add(MoveTemp(Parsed));
+	}
+	else if (Cmd.Equals(TEXT("subscribe"), ESearchCase::IgnoreCase) || Cmd.Equals(TEXT("unsubscribe"), ESearchCase::IgnoreCase))
+	{
+		// Push subscription: { "cmd": "subscribe", "hz": 10 }. "unsubscribe" (or
+		// hz <= 0) cancels the client's subscription.
+		FStrandsParsedCommand Parsed;
+		Parsed.ClientId = ClientId;
+		Parsed.Seq = Seq;
+		Parsed.Target = Target;
+		Parsed.Type = EStrandsCommandType::Subscribe;
+		if (Cmd.Equals(TEXT("unsubscribe"), ESearchCase::IgnoreCase))
+		{
+			Parsed.Rate = 0.f;
+		}
+		else if (Obj->HasTypedField<EJson::Number>(TEXT("hz")))
+		{
+			Parsed.Rate = FMath::Clamp((float)Obj->GetNumberField(TEXT("hz")), 0.f, 60.f);
+		}
+		OutCommands.Add(MoveTemp(Parsed));
+	}
+	else if (Cmd.Equals(TEXT("stats"), ESearchCase::IgnoreCase))
+	{
+		FStrandsParsedCommand Parsed;
+		Parsed.ClientId = ClientId;
+		Parsed.Seq = Seq;
+		Parsed.Target = Target;
+		Parsed.Type = EStrandsCommandType::Stats;
+		OutCommands.Add(MoveTemp(Parsed));
+	}
+	else if (Cmd.Equals(TEXT("state"), ESearchCase::IgnoreCase))
+	{
+		FStrandsParsedCommand Parsed;
+		Parsed.ClientId = ClientId;
+		Parsed.Seq = Seq;
+		Parsed.Target = Target;
+		Parsed.Type = EStrandsCommandType::State;
+		if (Obj->HasTypedField<EJson::String>(TEXT("path")))
+		{
+			Parsed.Path = Obj->GetStringField(TEXT("path"));
+		}
+		OutCommands.Add(MoveTemp(Parsed));
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("StrandsInputServer: Unknown cmd '%s'"), *Cmd);
+	}
+}
+
+// Parses one text line/message: a single command object or an array batch.
+static void Strands_ParseTextCommands(uint64 ClientId, const FString& Line, TArray<FStrandsParsedCommand>& OutCommands)
+{
+	if (Line.Len() > 0 && Line[0] == TEXT('['))
+	{
+		// Batch: an array of command objects parsed in a single pass
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Line);
+		TArray<TSharedPtr<FJsonValue>> Values;
+		if (!FJsonSerializer::Deserialize(Reader, Values))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("StrandsInputServer: Failed to parse JSON batch: %s"), *Line);
+			return;
+		}
+
+		for (const TSharedPtr<FJsonValue>& Value : Values)
+		{
+			const TSharedPtr<FJsonObject>* BatchedObj = nullptr;
+			if (Value.IsValid() && Value->TryGetObject(BatchedObj) && BatchedObj)
+			{
+				Strands_ParseCommandObject(ClientId, *BatchedObj, OutCommands);
+			}
+		}
+		return;
+	}
+
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Line);
+	TSharedPtr<FJsonObject> Obj;
+	if (!FJsonSerializer::Deserialize(Reader, Obj) || !Obj.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("StrandsInputServer: Failed to parse JSON: %s"), *Line);
+		return;
+	}
+
+	Strands_ParseCommandObject(ClientId, Obj, OutCommands);
+}
+
+void FStrandsSocketReceiver::ProcessLine(uint64 ClientId, FAnsiStringView LineView)
+{
+	// Stamp before parsing so the latency stats cover parse time as well as the
+	// queue hand-off to the game thread.
+	const double ReceiveTime = FPlatformTime::Seconds();
+
+	// Record the raw line before parsing, so a replay reproduces exactly what
+	// arrived on the wire
+	{
+		TSharedPtr<FStrandsSessionRecorder, ESPMode::ThreadSafe> PinnedRecorder;
+		{
+			FScopeLock ScopedLock(&RecorderLock);
+			PinnedRecorder = Recorder;
+		}
+		if (PinnedRecorder.IsValid())
+		{
+			PinnedRecorder->RecordLine(LineView);
+		}
+	}
+
+	// One UTF-8 -> TCHAR conversion per complete line, for the JSON reader only
+	FUTF8ToTCHAR Converted(LineView.GetData(), LineView.Len());
+	const FString Line(Converted.Length(), Converted.Get());
+
+	LineScratch.Reset();
+	Strands_ParseTextCommands(ClientId, Line, LineScratch);
+	for (FStrandsParsedCommand& Parsed : LineScratch)
+	{
+		Parsed.ReceiveTime = ReceiveTime;
+		Commands.Enqueue(MoveTemp(Parsed));
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Game thread application
+
+void UStrandsInputServerSubsystem::ApplyParsedCommand(const FStrandsParsedCommand& Command)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	RecordCommandLatency(Command, Now);
+
+	switch (Command.Type)
+	{
+	case EStrandsCommandType::Move:
+		{
+			if (Command.Keys.Num() > 0)
+			{
+				FStrandsActionTrack Track;
+				Track.Keys = Command.Keys;
+				Track.StartTime = Now;
+				Track.Ease = Command.Ease;
+				Track.ClientId = Command.ClientId;
+				Track.Seq = Command.Seq;
+				Targets.FindOrAdd(Command.Target).MoveTracks.Add(MoveTemp(Track));
+				break;
+			}
+
+			FStrandsMoveAction Action;
+			Action.Axis = Command.Axis;
+			Action.EndTime = Now + FMath::Max(0.0, Command.Duration >= 0.0 ? Command.Duration : (double)DefaultMoveDuration);
+			Action.ClientId = Command.ClientId;
+			Action.Seq = Command.Seq;
+			Targets.FindOrAdd(Command.Target).MoveActions.Add(MoveTemp(Action));
+		}
+		break;
+
+	case EStrandsCommandType::MoveTo:
+		StartMoveTo(Command);
+		break;
+
+	case EStrandsCommandType::Look:
+		{
+			if (Command.Keys.Num() > 0)
+			{
+				FStrandsActionTrack Track;
+				Track.Keys = Command.Keys;
+				Track.StartTime = Now;
+				Track.Ease = Command.Ease;
+				Track.ClientId = Command.ClientId;
+				Track.Seq = Command.Seq;
+				Targets.FindOrAdd(Command.Target).LookTracks.Add(MoveTemp(Track));
+				break;
+			}
+
+			FStrandsLookAction Action;
+			Action.Rate = Command.Axis; // degrees/sec
+			Action.EndTime = Now + FMath::Max(0.0, Command.Duration >= 0.0 ? Command.Duration : (double)DefaultLookDuration);
+			Action.ClientId = Command.ClientId;
+			Action.Seq = Command.Seq;
+			Targets.FindOrAdd(Command.Target).LookActions.Add(MoveTemp(Action));
+		}
+		break;
+
+	case EStrandsCommandType::Jump:
+		{
+			FStrandsTargetActions& Target = Targets.FindOrAdd(Command.Target);
+			Target.PendingJumpCount += 1;
+			if (Command.Seq != 0)
+			{
+				Target.PendingJumpAcks.Emplace(Command.ClientId, Command.Seq);
+			}
+		}
+		break;
+
+	case EStrandsCommandType::Sprint:
+		{
+			FStrandsTargetActions& Target = Targets.FindOrAdd(Command.Target);
+			Target.PendingSprintEnabled = Command.bEnabled;
+			if (Command.Seq != 0)
+			{
+				Target.PendingSprintAcks.Emplace(Command.ClientId, Command.Seq);
+			}
+		}
+		break;
+
+	case EStrandsCommandType::Register:
+		{
+			// Bind the named target to a world pawn by actor name
+			APawn* Found = nullptr;
+			if (!Command.TargetActor.IsEmpty())
+			{
+				if (UWorld* World = GetWorld())
+				{
+					for (TActorIterator<APawn> It(World); It; ++It)
+					{
+						if (It->GetName() == Command.TargetActor)
+						{
+							Found = *It;
+							break;
+						}
+					}
+				}
+			}
+
+			if (Found)
+			{
+				RegisterPawn(Command.Target, Found);
+				SendAck(Command.ClientId, Command.Seq);
+			}
+			else
+			{
+				UE_LOG(LogTemp, Warning, TEXT("StrandsInputServer: register failed; no pawn named '%s'"), *Command.TargetActor);
+			}
+		}
+		break;
+
+	case EStrandsCommandType::Screenshot:
+		{
+			const FString OutPath = Command.Path.IsEmpty()
+				? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AutoScreenshot.png"))
+				: Command.Path;
+
+			if (Command.CaptureWidth > 0)
+			{
+				// Low-res vision capture: render, then encode and write off-thread
+				const int32 Height = Command.CaptureHeight > 0 ? Command.CaptureHeight : Command.CaptureWidth * 9 / 16;
+				TSharedRef<TArray<FColor>, ESPMode::ThreadSafe> Pixels = MakeShared<TArray<FColor>, ESPMode::ThreadSafe>();
+				if (CaptureAgentVision(Command.CaptureWidth, Height, *Pixels))
+				{
+					Async(EAsyncExecution::ThreadPool, [Pixels, Width = Command.CaptureWidth, Height, OutPath]()
+					{
+						IImageWrapperModule& ImageWrapperModule = FModuleManager::GetModuleChecked<IImageWrapperModule>("ImageWrapper");
+						TSharedPtr<IImageWrapper> Wrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::PNG);
+						if (Wrapper.IsValid() &&
+							Wrapper->SetRaw(Pixels->GetData(), Pixels->Num() * sizeof(FColor), Width, Height, ERGBFormat::BGRA, 8))
+						{
+							const TArray64<uint8> Png = Wrapper->GetCompressed();
+							FFileHelper::SaveArrayToFile(TArrayView64<const uint8>(Png.GetData(), Png.Num()), *OutPath);
+						}
+					});
+					UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Vision screenshot %dx%d -> %s"), Command.CaptureWidth, Height, *OutPath);
+				}
+			}
+			else
+			{
+				FScreenshotRequest::RequestScreenshot(OutPath, Command.bShowUI, /*bAddFilenameSuffix*/ false);
+				UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Requested screenshot -> %s (showUI=%s)"), *OutPath, Command.bShowUI ? TEXT("true") : TEXT("false"));
+			}
+			SendAck(Command.ClientId, Command.Seq);
+		}
+		break;
+
+	case EStrandsCommandType::ScreenshotStream:
+		if (Command.CaptureWidth > 0)
+		{
+			// Low-res vision capture straight into the JPEG reply path; no
+			// backbuffer round trip, so no waiting on the next frame either
+			const int32 Height = Command.CaptureHeight > 0 ? Command.CaptureHeight : Command.CaptureWidth * 9 / 16;
+			TSharedRef<TArray<FColor>, ESPMode::ThreadSafe> Pixels = MakeShared<TArray<FColor>, ESPMode::ThreadSafe>();
+			if (CaptureAgentVision(Command.CaptureWidth, Height, *Pixels))
+			{
+				TArray<FStrandsScreenshotStreamRequest> Requests;
+				FStrandsScreenshotStreamRequest& Request = Requests.AddDefaulted_GetRef();
+				Request.ClientId = Command.ClientId;
+				Request.Quality = Command.Quality;
+				CompressAndSendJpegAsync(Pixels, Command.CaptureWidth, Height, MoveTemp(Requests));
+			}
+		}
+		else
+		{
+			RequestScreenshotStream(Command.ClientId, Command.Quality);
+		}
+		SendAck(Command.ClientId, Command.Seq);
+		break;
+
+	case EStrandsCommandType::State:
+		{
+			const FString OutPath = Command.Path.IsEmpty()
+				? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("WorldState/agent_state.json"))
+				: Command.Path;
+			WriteWorldStateToFile(OutPath);
+			UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Wrote state -> %s"), *OutPath);
+			SendAck(Command.ClientId, Command.Seq);
+		}
+		break;
+
+	case EStrandsCommandType::Subscribe:
+		{
+			// Replayed commands (ClientId 0) have no transport to push to
+			if (Command.ClientId == 0)
+			{
+				break;
+			}
+
+			const int32 Existing = Subscriptions.IndexOfByPredicate(
+				[&Command](const FStrandsStateSubscription& Sub) { return Sub.ClientId == Command.ClientId; });
+
+			if (Command.Rate <= 0.f)
+			{
+				if (Existing != INDEX_NONE)
+				{
+					Subscriptions.RemoveAtSwap(Existing, 1, EAllowShrinking::No);
+				}
+			}
+			else
+			{
+				FStrandsStateSubscription& Sub = (Existing != INDEX_NONE)
+					? Subscriptions[Existing]
+					: Subscriptions.AddDefaulted_GetRef();
+				Sub.ClientId = Command.ClientId;
+				Sub.Interval = 1.0 / (double)Command.Rate;
+				Sub.NextPushTime = Now; // full snapshot goes out this tick
+				Sub.bHasPrevious = false;
+			}
+			SendAck(Command.ClientId, Command.Seq);
+		}
+		break;
+
+	case EStrandsCommandType::Stats:
+		{
+			// Reply with the latency stats as a single JSON line on the same channel
+			FString Json = BuildStatsJson();
+			Json.AppendChar(TEXT('\n'));
+			FTCHARToUTF8 Utf8(*Json);
+			TArray<uint8> Bytes((const uint8*)Utf8.Get(), Utf8.Length());
+			SendToClientTransport(Command.ClientId, MoveTemp(Bytes));
+			SendAck(Command.ClientId, Command.Seq);
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+void UStrandsInputServerSubsystem::RecordCommandLatency(const FStrandsParsedCommand& Command, double Now)
+{
+	if (Command.ReceiveTime <= 0.0)
+	{
+		return;
+	}
+
+	const int32 RingIndex = (int32)Command.Type;
+	if (RingIndex >= 0 && RingIndex < NumCommandLatencyRings)
+	{
+		CommandLatency[RingIndex].Record((float)((Now - Command.ReceiveTime) * 1000.0));
+	}
+}
+
+FString UStrandsInputServerSubsystem::BuildStatsJson() const
+{
+	// {"stats":{"move":{"count":...,"avgMs":...,"p50Ms":...,"p90Ms":...,"p99Ms":...,"maxMs":...,"window":...},...},"ts":...}
+	TSharedRef<FJsonObject> StatsObj = MakeShared<FJsonObject>();
+	for (int32 RingIndex = 0; RingIndex < NumCommandLatencyRings; ++RingIndex)
+	{
+		const FStrandsCommandLatencyRing& Ring = CommandLatency[RingIndex];
+		if (Ring.Count == 0)
+		{
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> TypeObj = MakeShared<FJsonObject>();
+		TypeObj->SetNumberField(TEXT("count"), (double)Ring.Count);
+		TypeObj->SetNumberField(TEXT("avgMs"), Ring.TotalMS / (double)Ring.Count);
+		TypeObj->SetNumberField(TEXT("p50Ms"), Strands_LatencyPercentile(Ring, 0.50f));
+		TypeObj->SetNumberField(TEXT("p90Ms"), Strands_LatencyPercentile(Ring, 0.90f));
+		TypeObj->SetNumberField(TEXT("p99Ms"), Strands_LatencyPercentile(Ring, 0.99f));
+		TypeObj->SetNumberField(TEXT("maxMs"), Ring.MaxMS);
+		TypeObj->SetNumberField(TEXT("window"), Ring.NumBuffered());
+		StatsObj->SetObjectField(Strands_CommandTypeName((EStrandsCommandType)RingIndex), TypeObj);
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetObjectField(TEXT("stats"), StatsObj);
+	Root->SetNumberField(TEXT("ts"), FPlatformTime::Seconds());
+
+	FString Json;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+	FJsonSerializer::Serialize(Root, Writer);
+	return Json;
+}
+
+void UStrandsInputServerSubsystem::DumpCommandLatencyStats() const
+{
+	UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Receive-to-apply latency (percentiles over the last %d samples per type):"), FStrandsCommandLatencyRing::Capacity);
+	bool bAnySamples = false;
+	for (int32 RingIndex = 0; RingIndex < NumCommandLatencyRings; ++RingIndex)
+	{
+		const FStrandsCommandLatencyRing& Ring = CommandLatency[RingIndex];
+		if (Ring.Count == 0)
+		{
+			continue;
+		}
+
+		bAnySamples = true;
+		UE_LOG(LogTemp, Log, TEXT("  %-17s count=%llu avg=%.3fms p50=%.3fms p90=%.3fms p99=%.3fms max=%.3fms"),
+			Strands_CommandTypeName((EStrandsCommandType)RingIndex),
+			Ring.Count,
+			Ring.TotalMS / (double)Ring.Count,
+			Strands_LatencyPercentile(Ring, 0.50f),
+			Strands_LatencyPercentile(Ring, 0.90f),
+			Strands_LatencyPercentile(Ring, 0.99f),
+			Ring.MaxMS);
+	}
+
+	if (!bAnySamples)
+	{
+		UE_LOG(LogTemp, Log, TEXT("  (no commands applied yet)"));
+	}
+}
+
+bool UStrandsInputServerSubsystem::StartRecording(const FString& InPath)
+{
+	if (SessionRecorder.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("StrandsInputServer: Already recording to %s"), *SessionRecorder->GetPath());
+		return false;
+	}
+
+	const FString Path = InPath.IsEmpty()
+		? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Strands"), FString::Printf(TEXT("Session-%s.srl"), *FDateTime::Now().ToString()))
+		: InPath;
+
+	TSharedPtr<FStrandsSessionRecorder, ESPMode::ThreadSafe> NewRecorder = MakeShared<FStrandsSessionRecorder, ESPMode::ThreadSafe>(Path);
+	if (!NewRecorder->IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("StrandsInputServer: Failed to create recording file %s"), *Path);
+		return false;
+	}
+
+	SessionRecorder = NewRecorder;
+	if (Receiver.IsValid())
+	{
+		Receiver->SetRecorder(SessionRecorder);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Recording commands -> %s"), *Path);
+	return true;
+}
+
+void UStrandsInputServerSubsystem::StopRecording()
+{
+	if (!SessionRecorder.IsValid())
+	{
+		return;
+	}
+
+	// Detach from the receiver before the final flush so no line lands after it
+	if (Receiver.IsValid())
+	{
+		Receiver->SetRecorder(nullptr);
+	}
+
+	SessionRecorder->Flush();
+	UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Stopped recording -> %s"), *SessionRecorder->GetPath());
+	SessionRecorder.Reset();
+}
+
+bool UStrandsInputServerSubsystem::StartReplay(const FString& Path, bool bAsFastAsPossible)
+{
+	if (bReplaying)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("StrandsInputServer: A replay is already in progress."));
+		return false;
+	}
+
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *Path))
+	{
+		UE_LOG(LogTemp, Error, TEXT("StrandsInputServer: Failed to load replay log %s"), *Path);
+		return false;
+	}
+
+	if (Data.Num() < (int32)sizeof(GStrandsRecordingMagic) ||
+		FMemory::Memcmp(Data.GetData(), GStrandsRecordingMagic, sizeof(GStrandsRecordingMagic)) != 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("StrandsInputServer: %s is not a Strands command recording."), *Path);
+		return false;
+	}
+
+	ReplayData = MoveTemp(Data);
+	ReplayOffset = sizeof(GStrandsRecordingMagic);
+	ReplayStartTime = FPlatformTime::Seconds();
+	bReplayAsFastAsPossible = bAsFastAsPossible;
+	bReplaying = true;
+
+	UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Replaying %s (%d bytes, %s)"),
+		*Path, ReplayData.Num(), bAsFastAsPossible ? TEXT("as fast as possible") : TEXT("original timing"));
+	return true;
+}
+
+void UStrandsInputServerSubsystem::TickReplay(double Now)
+{
+	const double ReplayTime = Now - ReplayStartTime;
+	TArray<FStrandsParsedCommand> Parsed;
+
+	while (ReplayOffset + (int32)(sizeof(double) + sizeof(uint32)) <= ReplayData.Num())
+	{
+		double Time = 0.0;
+		uint32 Length = 0;
+		FMemory::Memcpy(&Time, ReplayData.GetData() + ReplayOffset, sizeof(Time));
+		FMemory::Memcpy(&Length, ReplayData.GetData() + ReplayOffset + sizeof(Time), sizeof(Length));
+
+		if (!bReplayAsFastAsPossible && Time > ReplayTime)
+		{
+			// The next command is still in the future; resume next tick
+			return;
+		}
+
+		const int32 LineStart = ReplayOffset + (int32)(sizeof(Time) + sizeof(Length));
+		if (Length > (uint32)(ReplayData.Num() - LineStart))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("StrandsInputServer: Replay log is truncated; stopping."));
+			break;
+		}
+
+		FUTF8ToTCHAR Converted((const ANSICHAR*)ReplayData.GetData() + LineStart, (int32)Length);
+		const FString Line(Converted.Length(), Converted.Get());
+
+		// ClientId 0 means replayed commands never produce acks or responses
+		Parsed.Reset();
+		Strands_ParseTextCommands(/*ClientId*/ 0, Line, Parsed);
+		for (const FStrandsParsedCommand& Command : Parsed)
+		{
+			ApplyParsedCommand(Command);
+		}
+
+		ReplayOffset = LineStart + (int32)Length;
+	}
+
+	bReplaying = false;
+	ReplayData.Empty();
+	ReplayOffset = 0;
+	UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Replay finished."));
+}
+
+void UStrandsInputServerSubsystem::SendAck(uint64 ClientId, uint32 Seq)
+{
+	if (Seq == 0 || ClientId == 0 || !Receiver.IsValid())
+	{
+		return;
+	}
+
+	// Small JSON line on the response channel: {"ack":<seq>,"ts":<seconds>}
+	TAnsiStringBuilder<64> Builder;
+	Builder.Appendf("{\"ack\":%u,\"ts\":%.6f}\n", Seq, FPlatformTime::Seconds());
+
+	TArray<uint8> Bytes((const uint8*)Builder.GetData(), Builder.Len());
+	SendToClientTransport(ClientId, MoveTemp(Bytes));
+}
+
+void UStrandsInputServerSubsystem::RequestScreenshotStream(uint64 ClientId, int32 Quality)
+{
+	UWorld* World = GetWorld();
+	UGameViewportClient* Viewport = World ? World->GetGameViewport() : nullptr;
+	if (!Viewport)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("StrandsInputServer: screenshot_stream requested without a game viewport."));
+		return;
+	}
+
+	// Coalesce requests arriving in the same tick onto one backbuffer capture
+	FStrandsScreenshotStreamRequest Request;
+	Request.ClientId = ClientId;
+	Request.Quality = Quality;
+	PendingStreamRequests.Add(Request);
+
+	if (!ScreenshotCapturedHandle.IsValid())
+	{
+		ScreenshotCapturedHandle = Viewport->OnScreenshotCaptured().AddUObject(this, &UStrandsInputServerSubsystem::OnScreenshotCaptured);
+	}
+
+	// In-memory capture: no filename, delivered via OnScreenshotCaptured
+	FScreenshotRequest::RequestScreenshot(/*bInShowUI*/ false);
+}
+
+void UStrandsInputServerSubsystem::OnScreenshotCaptured(int32 Width, int32 Height, const TArray<FColor>& Colors)
+{
+	if (PendingStreamRequests.Num() == 0 || !Receiver.IsValid())
+	{
+		PendingStreamRequests.Reset();
+		return;
+	}
+
+	TArray<FStrandsScreenshotStreamRequest> Requests = MoveTemp(PendingStreamRequests);
+	PendingStreamRequests.Reset();
+
+	// Copy the pixels once, then compress and reply off the game thread
+	TSharedRef<TArray<FColor>, ESPMode::ThreadSafe> Pixels = MakeShared<TArray<FColor>, ESPMode::ThreadSafe>(Colors);
+	CompressAndSendJpegAsync(Pixels, Width, Height, MoveTemp(Requests));
+}
+
+void UStrandsInputServerSubsystem::CompressAndSendJpegAsync(TSharedRef<TArray<FColor>, ESPMode::ThreadSafe> Pixels, int32 Width, int32 Height, TArray<FStrandsScreenshotStreamRequest> Requests)
+{
+	TWeakPtr<FStrandsSocketReceiver, ESPMode::ThreadSafe> WeakReceiver = Receiver;
+	TWeakObjectPtr<UStrandsInputServerSubsystem> WeakThis(this);
+
+	Async(EAsyncExecution::ThreadPool, [Pixels, Width, Height, Requests = MoveTemp(Requests), WeakReceiver, WeakThis]()
+	{
+		IImageWrapperModule& ImageWrapperModule = FModuleManager::GetModuleChecked<IImageWrapperModule>("ImageWrapper");
+
+		for (const FStrandsScreenshotStreamRequest& Request : Requests)
+		{
+			TSharedPtr<IImageWrapper> Wrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::JPEG);
+			if (!Wrapper.IsValid() ||
+				!Wrapper->SetRaw(Pixels->GetData(), Pixels->Num() * sizeof(FColor), Width, Height, ERGBFormat::BGRA, 8))
+			{
+				continue;
+			}
+
+			const TArray64<uint8> Jpeg = Wrapper->GetCompressed(Request.Quality);
+			if (Jpeg.Num() <= 0 || Jpeg.Num() > MAX_int32)
+			{
+				continue;
+			}
+
+			// Response frame: "SSJ1" magic, uint32 LE payload length, JPEG bytes
+			TArray<uint8> Packet;
+			Packet.Reserve(8 + (int32)Jpeg.Num());
+			Packet.Append((const uint8*)"SSJ1", 4);
+			const uint32 PayloadLen = (uint32)Jpeg.Num();
+			Packet.Append((const uint8*)&PayloadLen, sizeof(PayloadLen));
+			Packet.Append(Jpeg.GetData(), (int32)Jpeg.Num());
+
+			if ((Request.ClientId & WebSocketClientIdBit) != 0)
+			{
+				// WebSocket sends must happen on the game thread
+				AsyncTask(ENamedThreads::GameThread, [WeakThis, ClientId = Request.ClientId, Packet = MoveTemp(Packet)]() mutable
+				{
+					if (UStrandsInputServerSubsystem* Self = WeakThis.Get())
+					{
+						Self->SendToClientTransport(ClientId, MoveTemp(Packet));
+					}
+				});
+			}
+			else if (TSharedPtr<FStrandsSocketReceiver, ESPMode::ThreadSafe> PinnedReceiver = WeakReceiver.Pin())
+			{
+				PinnedReceiver->SendToClient(Request.ClientId, MoveTemp(Packet));
+			}
+		}
+	});
+}
+
+bool UStrandsInputServerSubsystem::CaptureAgentVision(int32 Width, int32 Height, TArray<FColor>& OutPixels)
+{
+	UWorld* World = GetWorld();
+	APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+	if (!PC)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("StrandsInputServer: Vision capture requested without a player controller."));
+		return false;
+	}
+
+	// Spawn the pooled capture actor on first use; the reduced show flags stay
+	// set for its lifetime, so per-request cost is just the capture itself.
+	ASceneCapture2D* CaptureActor = AgentVisionActor.Get();
+	if (!CaptureActor)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags = RF_Transient;
+		CaptureActor = World->SpawnActor<ASceneCapture2D>(SpawnParams);
+		if (!CaptureActor)
+		{
+			return false;
+		}
+		AgentVisionActor = CaptureActor;
+
+		USceneCaptureComponent2D* Capture = CaptureActor->GetCaptureComponent2D();
+		Capture->bCaptureEveryFrame = false;
+		Capture->bCaptureOnMovement = false;
+		Capture->CaptureSource = SCS_FinalColorLDR;
+
+		// Vision models do not benefit from the expensive post effects
+		Capture->ShowFlags.SetBloom(false);
+		Capture->ShowFlags.SetDepthOfField(false);
+		Capture->ShowFlags.SetMotionBlur(false);
+		Capture->ShowFlags.SetLensFlares(false);
+	}
+
+	USceneCaptureComponent2D* Capture = CaptureActor->GetCaptureComponent2D();
+
+	// (Re)size the pooled render target when the requested resolution changes
+	UTextureRenderTarget2D* Target = Capture->TextureTarget;
+	if (!Target || Target->SizeX != Width || Target->SizeY != Height)
+	{
+		Target = NewObject<UTextureRenderTarget2D>(Capture);
+		Target->InitCustomFormat(Width, Height, PF_B8G8R8A8, /*bInForceLinearGamma*/ false);
+		Capture->TextureTarget = Target;
+	}
+
+	// Capture from the player's camera viewpoint
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+	CaptureActor->SetActorLocationAndRotation(ViewLocation, ViewRotation);
+	Capture->FOVAngle = PC->PlayerCameraManager ? PC->PlayerCameraManager->GetFOVAngle() : 90.f;
+	Capture->CaptureScene();
+
+	// Synchronous readback; acceptable at vision resolutions (512px is ~0.6 MB)
+	FTextureRenderTargetResource* Resource = Target->GameThread_GetRenderTargetResource();
+	if (!Resource || !Resource->ReadPixels(OutPixels))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("StrandsInputServer: Vision capture readback failed (%dx%d)."), Width, Height);
+		return false;
+	}
+
+	return true;
+}
+
+static ACharacter* Strands_GetControlledCharacter(UWorld* World)
+{
+	if (!World) return nullptr;
+	APlayerController* PC = World->GetFirstPlayerController();
+	if (!PC) return nullptr;
+	APawn* Pawn = PC->GetPawn();
+	return Pawn ? Cast<ACharacter>(Pawn) : nullptr;
+}
+
+static APawn* Strands_GetControlledPawn(UWorld* World)
+{
+	if (!World) return nullptr;
+	APlayerController* PC = World->GetFirstPlayerController();
+	if (!PC) return nullptr;
+	return PC->GetPawn();
+}
+
+void UStrandsInputServerSubsystem::RegisterPawn(FName TargetName, APawn* Pawn)
+{
+	if (TargetName.IsNone() || !Pawn)
+	{
+		return;
+	}
+
+	Targets.FindOrAdd(TargetName).Pawn = Pawn;
+	UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Registered pawn '%s' as target '%s'"), *Pawn->GetName(), *TargetName.ToString());
+}
+
+void UStrandsInputServerSubsystem::UnregisterPawn(FName TargetName)
+{
+	Targets.Remove(TargetName);
+}
+
+APawn* UStrandsInputServerSubsystem::ResolveTargetPawn(FName TargetName, const FStrandsTargetActions& Target) const
+{
+	// The default target follows the first player's current pawn; named targets
+	// resolve through the registry.
+	if (TargetName.IsNone())
+	{
+		return Strands_GetControlledPawn(GetWorld());
+	}
+	return Target.Pawn.Get();
+}
+
+bool UStrandsInputServerSubsystem::HasPendingTargetWork() const
+{
+	for (const TPair<FName, FStrandsTargetActions>& Pair : Targets)
+	{
+		const FStrandsTargetActions& Target = Pair.Value;
+		if (Target.MoveActions.Num() > 0 || Target.LookActions.Num() > 0 ||
+			Target.MoveTracks.Num() > 0 || Target.LookTracks.Num() > 0 ||
+			Target.MoveTo.IsSet() ||
+			Target.PendingJumpCount > 0 || Target.PendingSprintEnabled.IsSet())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void UStrandsInputServerSubsystem::ApplyScheduledActions(float DeltaSeconds)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	if (Targets.Num() == 0)
+	{
+		return;
+	}
+
+	for (TPair<FName, FStrandsTargetActions>& Pair : Targets)
+	{
+		ApplyTargetActions(Pair.Key, Pair.Value, DeltaSeconds, Now);
+	}
+}
+
+void UStrandsInputServerSubsystem::ApplyTargetActions(FName TargetName, FStrandsTargetActions& Target, float DeltaSeconds, double Now)
+{
+	// Sum active move actions, remove expired
+	FVector2D MoveAxis(0.f, 0.f);
+	for (int32 i = Target.MoveActions.Num() - 1; i >= 0; --i)
+	{
+		if (Target.MoveActions[i].EndTime <= Now)
+		{
+			Target.MoveActions.RemoveAtSwap(i);
+			continue;
+		}
+		MoveAxis += Target.MoveActions[i].Axis;
+
+		// Ack on the first tick the action contributes input
+		if (!Target.MoveActions[i].bAckSent && Target.MoveActions[i].Seq != 0)
+		{
+			SendAck(Target.MoveActions[i].ClientId, Target.MoveActions[i].Seq);
+			Target.MoveActions[i].bAckSent = true;
+		}
+	}
+	// Evaluate keyframed move tracks, remove finished
+	for (int32 i = Target.MoveTracks.Num() - 1; i >= 0; --i)
+	{
+		FStrandsActionTrack& Track = Target.MoveTracks[i];
+		if (Track.IsFinished(Now))
+		{
+			Target.MoveTracks.RemoveAtSwap(i);
+			continue;
+		}
+		MoveAxis += Track.Evaluate(Now);
+
+		if (!Track.bAckSent && Track.Seq != 0)
+		{
+			SendAck(Track.ClientId, Track.Seq);
+			Track.bAckSent = true;
+		}
+	}
+
+	MoveAxis.X = FMath::Clamp(MoveAxis.X, -1.f, 1.f);
+	MoveAxis.Y = FMath::Clamp(MoveAxis.Y, -1.f, 1.f);
+
+	// Sum active look actions, remove expired (rates are deg/sec)
+	FVector2D LookRate(0.f, 0.f);
+	for (int32 i = Target.LookActions.Num() - 1; i >= 0; --i)
+	{
+		if (Target.LookActions[i].EndTime <= Now)
+		{
+			Target.LookActions.RemoveAtSwap(i);
+			continue;
+		}
+		LookRate += Target.LookActions[i].Rate;
+
+		// Ack on the first tick the action contributes input
+		if (!Target.LookActions[i].bAckSent && Target.LookActions[i].Seq != 0)
+		{
+			SendAck(Target.LookActions[i].ClientId, Target.LookActions[i].Seq);
+			Target.LookActions[i].bAckSent = true;
+		}
+	}
+
+	// Evaluate keyframed look tracks, remove finished
+	for (int32 i = Target.LookTracks.Num() - 1; i >= 0; --i)
+	{
+		FStrandsActionTrack& Track = Target.LookTracks[i];
+		if (Track.IsFinished(Now))
+		{
+			Target.LookTracks.RemoveAtSwap(i);
+			continue;
+		}
+		LookRate += Track.Evaluate(Now);
+
+		if (!Track.bAckSent && Track.Seq != 0)
+		{
+			SendAck(Track.ClientId, Track.Seq);
+			Track.bAckSent = true;
+		}
+	}
+
+	APawn* Pawn = ResolveTargetPawn(TargetName, Target);
+	ACharacter* Character = Pawn ? Cast<ACharacter>(Pawn) : nullptr;
+	if (!Pawn)
+	{
+		// Registered pawn destroyed or player pawn missing; actions simply expire
+		return;
+	}
+
+	// Steer the active moveTo along its path. It contributes to MoveAxis like
+	// a scheduled action, so manual move commands can still blend in.
+	if (Target.MoveTo.IsSet() && Target.MoveTo->bPathReady)
+	{
+		FStrandsMoveToAction& MoveTo = Target.MoveTo.GetValue();
+		const FVector PawnLocation = Pawn->GetActorLocation();
+
+		// Advance past points already reached: intermediate points use a fixed
+		// radius, the final one the command's acceptance radius
+		constexpr float IntermediatePointRadius = 50.f;
+		while (MoveTo.NextPoint < MoveTo.PathPoints.Num())
+		{
+			const bool bFinalPoint = MoveTo.NextPoint == MoveTo.PathPoints.Num() - 1;
+			const float Radius = bFinalPoint ? MoveTo.AcceptanceRadius : IntermediatePointRadius;
+			if (FVector::DistSquaredXY(PawnLocation, MoveTo.PathPoints[MoveTo.NextPoint]) > FMath::Square(Radius))
+			{
+				break;
+			}
+			++MoveTo.NextPoint;
+		}
+
+		if (MoveTo.NextPoint >= MoveTo.PathPoints.Num())
+		{
+			// Arrived: report completion on the ack channel
+			SendAck(MoveTo.ClientId, MoveTo.Seq);
+			Target.MoveTo.Reset();
+		}
+		else
+		{
+			const FVector ToPoint = MoveTo.PathPoints[MoveTo.NextPoint] - PawnLocation;
+			const FVector Dir = FVector(ToPoint.X, ToPoint.Y, 0.0).GetSafeNormal();
+			MoveAxis.X = FMath::Clamp(MoveAxis.X + (float)FVector::DotProduct(Dir, Pawn->GetActorForwardVector()), -1.f, 1.f);
+			MoveAxis.Y = FMath::Clamp(MoveAxis.Y + (float)FVector::DotProduct(Dir, Pawn->GetActorRightVector()), -1.f, 1.f);
+		}
+	}
+
+	// Prefer handing the whole tick's input to a batch input receiver in one call; the
+	// events then flow through the controller's input stack with its normal buffering and
+	// consumption semantics. Controllers that cannot route the batch return false and the
+	// direct pawn input path below applies instead.
+	if (IStrandsBatchInputReceiver* BatchReceiver = Cast<IStrandsBatchInputReceiver>(Pawn->GetController()))
+	{
+		TArray<FStrandsSyntheticInputEvent> Batch;
+		if (!MoveAxis.IsNearlyZero())
+		{
+			FStrandsSyntheticInputEvent& Event = Batch.AddDefaulted_GetRef();
+			Event.Type = EStrandsSyntheticInputType::Move;
+			Event.Value = MoveAxis;
+			Event.ApplyTime = Now;
+		}
+		if (!LookRate.IsNearlyZero())
+		{
+			FStrandsSyntheticInputEvent& Event = Batch.AddDefaulted_GetRef();
+			Event.Type = EStrandsSyntheticInputType::Look;
+			Event.Value = LookRate * DeltaSeconds; // deg/sec to per-tick degrees
+			Event.ApplyTime = Now;
+		}
+		for (int32 i = 0; i < Target.PendingJumpCount; ++i)
+		{
+			FStrandsSyntheticInputEvent& Event = Batch.AddDefaulted_GetRef();
+			Event.Type = EStrandsSyntheticInputType::Jump;
+			Event.ApplyTime = Now;
+		}
+		if (Target.PendingSprintEnabled.IsSet())
+		{
+			FStrandsSyntheticInputEvent& Event = Batch.AddDefaulted_GetRef();
+			Event.Type = EStrandsSyntheticInputType::Sprint;
+			Event.Value.X = Target.PendingSprintEnabled.GetValue() ? 1.f : 0.f;
+			Event.ApplyTime = Now;
+		}
+
+		if (Batch.Num() == 0 || BatchReceiver->InjectStrandsInputBatch(Batch))
+		{
+			if (Target.PendingJumpCount > 0)
+			{
+				Target.PendingJumpCount = 0;
+				for (const TPair<uint64, uint32>& Ack : Target.PendingJumpAcks)
+				{
+					SendAck(Ack.Key, Ack.Value);
+				}
+				Target.PendingJumpAcks.Reset();
+			}
+
+			if (Target.PendingSprintEnabled.IsSet())
+			{
+				Target.PendingSprintEnabled.Reset();
+				for (const TPair<uint64, uint32>& Ack : Target.PendingSprintAcks)
+				{
+					SendAck(Ack.Key, Ack.Value);
+				}
+				Target.PendingSprintAcks.Reset();
+			}
+
+			return;
+		}
+	}
+
+	if (Character)
 	{
-		FStrandsClientState& Client = Clients[i];
-		if (!Client.Socket)
+		if (!MoveAxis.IsNearlyZero())
 		{
-			Clients.RemoveAtSwap(i);
-			continue;
+			Character->AddMovementInput(Character->GetActorForwardVector(), MoveAxis.X);
+			Character->AddMovementInput(Character->GetActorRightVector(), MoveAxis.Y);
 		}
 
-		// Read all pending data FIRST, even if the peer closed after sending
-		uint32 PendingSize = 0;
-		while (Client.Socket->HasPendingData(PendingSize) && PendingSize > 0)
+		if (Target.PendingJumpCount > 0)
 		{
-			const uint32 ToRead = FMath::Min(PendingSize, (uint32)65536);
-			TArray<uint8> Buffer;
-			Buffer.SetNumUninitialized(ToRead);
-
-			int32 ActuallyRead = 0;
-			if (Client.Socket->Recv(Buffer.GetData(), Buffer.Num(), ActuallyRead, ESocketReceiveFlags::None) && ActuallyRead > 0)
+			for (int32 i = 0; i < Target.PendingJumpCount; ++i)
 			{
-				// Assume ASCII/UTF-8 JSON lines; append bytes to string
-				FString Chunk;
-				Chunk.Reserve(ActuallyRead);
-				for (int32 b = 0; b < ActuallyRead; ++b)
-				{
-					Chunk.AppendChar((TCHAR)Buffer[b]);
-				}
+				Character->Jump();
+			}
+			Target.PendingJumpCount = 0;
 
-				Client.Pending += Chunk;
+			for (const TPair<uint64, uint32>& Ack : Target.PendingJumpAcks)
+			{
+				SendAck(Ack.Key, Ack.Value);
+			}
+			Target.PendingJumpAcks.Reset();
+		}
 
-				// Extract complete lines
-				TArray<FString> Lines;
-				Strands_SplitLines(Client.Pending, Lines);
-				for (FString& Line : Lines)
-				{
-					ProcessLine(Line);
-				}
+		if (Target.PendingSprintEnabled.IsSet())
+		{
+			if (UCharacterMovementComponent* MoveComp = Character->GetCharacterMovement())
+			{
+				MoveComp->MaxWalkSpeed = Target.PendingSprintEnabled.GetValue() ? SprintWalkSpeed : NormalWalkSpeed;
 			}
-			else
+			Target.PendingSprintEnabled.Reset();
+
+			for (const TPair<uint64, uint32>& Ack : Target.PendingSprintAcks)
 			{
-				break;
+				SendAck(Ack.Key, Ack.Value);
 			}
+			Target.PendingSprintAcks.Reset();
 		}
+	}
+	else if (!MoveAxis.IsNearlyZero())
+	{
+		// Plain pawns still receive movement input
+		Pawn->AddMovementInput(Pawn->GetActorForwardVector(), MoveAxis.X);
+		Pawn->AddMovementInput(Pawn->GetActorRightVector(), MoveAxis.Y);
+	}
 
-		// After attempting to drain any pending data, remove sockets that are no longer connected
-		ESocketConnectionState ConnState = Client.Socket->GetConnectionState();
-		if (ConnState != SCS_Connected)
+	if (!LookRate.IsNearlyZero())
+	{
+		// Convert deg/sec to per-tick input
+		const float YawDelta = LookRate.X * DeltaSeconds;
+		const float PitchDelta = LookRate.Y * DeltaSeconds;
+		if (Pawn->GetController())
 		{
-			Client.Socket->Close();
-			ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Client.Socket);
-			Client.Socket = nullptr;
-			Clients.RemoveAtSwap(i);
-			UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Client disconnected."));
-			continue;
+			Pawn->AddControllerYawInput(YawDelta);
+			Pawn->AddControllerPitchInput(PitchDelta);
+		}
+		else
+		{
+			// Possession-free targets rotate the actor directly
+			Pawn->AddActorWorldRotation(FRotator(0.f, YawDelta, 0.f));
 		}
 	}
 }
 
-void UStrandsInputServerSubsystem::ProcessLine(const FString& Line)
+void UStrandsInputServerSubsystem::StartMoveTo(const FStrandsParsedCommand& Command)
 {
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Line);
-	TSharedPtr<FJsonObject> Obj;
-	if (!FJsonSerializer::Deserialize(Reader, Obj) || !Obj.IsValid())
+	FStrandsTargetActions& Target = Targets.FindOrAdd(Command.Target);
+
+	// A new moveTo supersedes an in-flight one; complete the old one on the
+	// ack channel so its issuer is not left waiting
+	if (Target.MoveTo.IsSet())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("StrandsInputServer: Failed to parse JSON: %s"), *Line);
+		SendAck(Target.MoveTo->ClientId, Target.MoveTo->Seq);
+		Target.MoveTo.Reset();
+	}
+
+	UWorld* World = GetWorld();
+	APawn* Pawn = ResolveTargetPawn(Command.Target, Target);
+	UNavigationSystemV1* NavSys = World ? FNavigationSystem::GetCurrent<UNavigationSystemV1>(World) : nullptr;
+	const ANavigationData* NavData = (NavSys && Pawn) ? NavSys->GetNavDataForProps(Pawn->GetNavAgentPropertiesRef(), Pawn->GetActorLocation()) : nullptr;
+	if (!Pawn || !NavData)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("StrandsInputServer: moveTo failed; %s."), !Pawn ? TEXT("no pawn for target") : TEXT("no navigation data"));
+		SendAck(Command.ClientId, Command.Seq);
 		return;
 	}
 
-	const FString Cmd = Obj->GetStringField(TEXT("cmd"));
-	UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Received cmd '%s'"), *Cmd);
+	FPathFindingQuery Query(Pawn, *NavData, Pawn->GetActorLocation(), Command.Location);
+	Query.SetAllowPartialPaths(true);
 
-	const double Now = FPlatformTime::Seconds();
+	FStrandsMoveToAction MoveTo;
+	MoveTo.Goal = Command.Location;
+	MoveTo.AcceptanceRadius = Command.AcceptanceRadius;
+	MoveTo.ClientId = Command.ClientId;
+	MoveTo.Seq = Command.Seq;
 
-	if (Cmd.Equals(TEXT("move"), ESearchCase::IgnoreCase))
+	// The query runs on the navigation system's async task; the delegate fires
+	// back on the game thread, typically a frame or two later
+	TWeakObjectPtr<UStrandsInputServerSubsystem> WeakThis(this);
+	FNavPathQueryDelegate Delegate;
+	Delegate.BindLambda([WeakThis, TargetName = Command.Target](uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path)
 	{
-		double Forward = 0.0;
-		double Right = 0.0;
-		double Duration = DefaultMoveDuration;
+		if (UStrandsInputServerSubsystem* Self = WeakThis.Get())
+		{
+			Self->OnMoveToPathReady(TargetName, QueryId, Result, Path);
+		}
+	});
 
-		if (Obj->HasTypedField<EJson::Number>(TEXT("forward"))) Forward = Obj->GetNumberField(TEXT("forward"));
-		if (Obj->HasTypedField<EJson::Number>(TEXT("right"))) Right = Obj->GetNumberField(TEXT("right"));
-		if (Obj->HasTypedField<EJson::Number>(TEXT("duration"))) Duration = Obj->GetNumberField(TEXT("duration"));
+	MoveTo.AsyncQueryId = NavSys->FindPathAsync(Pawn->GetNavAgentPropertiesRef(), Query, Delegate);
+	Target.MoveTo = MoveTemp(MoveTo);
 
-		FStrandsMoveAction Action;
-		Action.Axis = FVector2D((float)Forward, (float)Right);
-		Action.EndTime = Now + FMath::Max(0.0, Duration);
-		MoveActions.Add(MoveTemp(Action));
-	}
-	else if (Cmd.Equals(TEXT("look"), ESearchCase::IgnoreCase))
+	if (CVarStrandsVerboseLog.GetValueOnGameThread() != 0)
 	{
-		double YawRate = 0.0;
-		double PitchRate = 0.0;
-		double Duration = DefaultLookDuration;
+		UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: moveTo (%.0f, %.0f, %.0f) queued as query %u"),
+			Command.Location.X, Command.Location.Y, Command.Location.Z, Target.MoveTo->AsyncQueryId);
+	}
+}
 
-		if (Obj->HasTypedField<EJson::Number>(TEXT("yawRate"))) YawRate = Obj->GetNumberField(TEXT("yawRate"));
-		if (Obj->HasTypedField<EJson::Number>(TEXT("pitchRate"))) PitchRate = Obj->GetNumberField(TEXT("pitchRate"));
-		if (Obj->HasTypedField<EJson::Number>(TEXT("duration"))) Duration = Obj->GetNumberField(TEXT("duration"));
+void UStrandsInputServerSubsystem::OnMoveToPathReady(FName TargetName, uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path)
+{
+	FStrandsTargetActions* Target = Targets.Find(TargetName);
+	if (!Target || !Target->MoveTo.IsSet() || Target->MoveTo->AsyncQueryId != QueryId)
+	{
+		return; // Superseded or the target was unregistered meanwhile
+	}
 
-		FStrandsLookAction Action;
-		Action.Rate = FVector2D((float)YawRate, (float)PitchRate); // degrees/sec
-		Action.EndTime = Now + FMath::Max(0.0, Duration);
-		LookActions.Add(MoveTemp(Action));
+	FStrandsMoveToAction& MoveTo = Target->MoveTo.GetValue();
+	if (Result != ENavigationQueryResult::Success || !Path.IsValid() || Path->GetPathPoints().Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("StrandsInputServer: moveTo pathfinding failed (result %d)."), (int32)Result);
+		SendAck(MoveTo.ClientId, MoveTo.Seq);
+		Target->MoveTo.Reset();
+		return;
 	}
-	else if (Cmd.Equals(TEXT("jump"), ESearchCase::IgnoreCase))
+
+	MoveTo.PathPoints.Reset(Path->GetPathPoints().Num());
+	for (const FNavPathPoint& Point : Path->GetPathPoints())
 	{
-		PendingJumpCount += 1;
+		MoveTo.PathPoints.Add(Point.Location);
 	}
-	else if (Cmd.Equals(TEXT("sprint"), ESearchCase::IgnoreCase))
+	MoveTo.NextPoint = 0;
+	MoveTo.bPathReady = true;
+}
+
+static const ANSICHAR* Strands_MovementModeName(EMovementMode Mode)
+{
+	switch (Mode)
 	{
-		bool bEnabled = false;
-		if (Obj->HasField(TEXT("enabled")))
-		{
-			if (Obj->TryGetBoolField(TEXT("enabled"), bEnabled))
-			{
-				PendingSprintEnabled = bEnabled;
-			}
-		}
+	case MOVE_Walking:    return "Walking";
+	case MOVE_NavWalking: return "NavWalking";
+	case MOVE_Falling:    return "Falling";
+	case MOVE_Swimming:   return "Swimming";
+	case MOVE_Flying:     return "Flying";
+	case MOVE_Custom:     return "Custom";
+	default:              return "None";
 	}
-	else if (Cmd.Equals(TEXT("screenshot"), ESearchCase::IgnoreCase))
+}
+
+// Minimal JSON string escaping for the streamed state writer. Names coming
+// out of the engine are ASCII in practice, but a quote or control character
+// must not be able to break the document.
+static void Strands_AppendJsonEscaped(FAnsiStringBuilderBase& Out, const FString& Value)
+{
+	FTCHARToUTF8 Utf8(*Value);
+	const ANSICHAR* Data = (const ANSICHAR*)Utf8.Get();
+	for (int32 Index = 0; Index < Utf8.Length(); ++Index)
 	{
-		FString OutPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AutoScreenshot.png"));
-		bool bShowUI = false;
-		if (Obj->HasTypedField<EJson::String>(TEXT("path")))
+		const ANSICHAR C = Data[Index];
+		if (C == '"' || C == '\\')
 		{
-			OutPath = Obj->GetStringField(TEXT("path"));
+			Out << '\\' << C;
 		}
-		if (Obj->HasTypedField<EJson::Boolean>(TEXT("showUI")))
+		else if ((uint8)C < 0x20)
 		{
-			bShowUI = Obj->GetBoolField(TEXT("showUI"));
+			Out.Appendf("\\u%04x", (uint8)C);
 		}
-
-		FScreenshotRequest::RequestScreenshot(OutPath, bShowUI, /*bAddFilenameSuffix*/ false);
-		UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Requested screenshot -> %s (showUI=%s)"), *OutPath, bShowUI ? TEXT("true") : TEXT("false"));
-	}
-	else if (Cmd.Equals(TEXT("state"), ESearchCase::IgnoreCase))
-	{
-		FString OutPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("WorldState/agent_state.json"));
-		if (Obj->HasTypedField<EJson::String>(TEXT("path")))
+		else
 		{
-			OutPath = Obj->GetStringField(TEXT("path"));
+			Out << C;
 		}
-		WriteWorldStateToFile(OutPath);
-		UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Wrote state -> %s"), *OutPath);
-	}
-	else
-	{
-		UE_LOG(LogTemp, Warning, TEXT("StrandsInputServer: Unknown cmd '%s'"), *Cmd);
 	}
 }
 
-static ACharacter* Strands_GetControlledCharacter(UWorld* World)
+void UStrandsInputServerSubsystem::BuildWorldState(FAnsiStringBuilderBase& Out, UWorld* World) const
 {
-	if (!World) return nullptr;
-	APlayerController* PC = World->GetFirstPlayerController();
-	if (!PC) return nullptr;
-	APawn* Pawn = PC->GetPawn();
-	return Pawn ? Cast<ACharacter>(Pawn) : nullptr;
-}
+	// Streams the state schema straight into the UTF-8 builder: no intermediate
+	// FJsonObject tree, no per-field shared pointers, no TCHAR round trip.
+	Out.Appendf("{\"ts\":%.6f", FPlatformTime::Seconds());
+	if (!World)
+	{
+		Out << "}";
+		return;
+	}
 
-static APawn* Strands_GetControlledPawn(UWorld* World)
-{
-	if (!World) return nullptr;
-	APlayerController* PC = World->GetFirstPlayerController();
-	if (!PC) return nullptr;
-	return PC->GetPawn();
-}
+	ACharacter* Character = Strands_GetControlledCharacter(World);
+	APawn* Pawn = Character ? static_cast<APawn*>(Character) : Strands_GetControlledPawn(World);
 
-void UStrandsInputServerSubsystem::ApplyScheduledActions(float DeltaSeconds)
-{
-	const double Now = FPlatformTime::Seconds();
+	// Pawn info
+	if (Pawn)
+	{
+		Out << ",\"pawn\":{\"name\":\"";
+		Strands_AppendJsonEscaped(Out, Pawn->GetName());
+		Out << "\",\"class\":\"";
+		Strands_AppendJsonEscaped(Out, Pawn->GetClass() ? Pawn->GetClass()->GetName() : TEXT("Unknown"));
+		Out << "\"}";
 
-	// Sum active move actions, remove expired
-	FVector2D MoveAxis(0.f, 0.f);
-	for (int32 i = MoveActions.Num() - 1; i >= 0; --i)
+		const FVector Loc = Pawn->GetActorLocation();
+		Out.Appendf(",\"pos\":[%.3f,%.3f,%.3f]", Loc.X, Loc.Y, Loc.Z);
+
+		const FRotator Rot = Pawn->GetActorRotation();
+		Out.Appendf(",\"rot\":{\"yaw\":%.3f,\"pitch\":%.3f,\"roll\":%.3f}", Rot.Yaw, Rot.Pitch, Rot.Roll);
+
+		const FVector Vel = Pawn->GetVelocity();
+		Out.Appendf(",\"vel\":[%.3f,%.3f,%.3f],\"speed\":%.3f", Vel.X, Vel.Y, Vel.Z, Vel.Length());
+	}
+	else
 	{
-		if (MoveActions[i].EndTime <= Now)
-		{
-			MoveActions.RemoveAtSwap(i);
-			continue;
-		}
-		MoveAxis += MoveActions[i].Axis;
+		Out << ",\"pawn\":{}";
 	}
-	MoveAxis.X = FMath::Clamp(MoveAxis.X, -1.f, 1.f);
-	MoveAxis.Y = FMath::Clamp(MoveAxis.Y, -1.f, 1.f);
 
-	// Sum active look actions, remove expired (rates are deg/sec)
-	FVector2D LookRate(0.f, 0.f);
-	for (int32 i = LookActions.Num() - 1; i >= 0; --i)
+	// Movement
+	Out << ",\"move\":{";
+	if (Character)
 	{
-		if (LookActions[i].EndTime <= Now)
+		if (UCharacterMovementComponent* MoveComp = Character->GetCharacterMovement())
 		{
-			LookActions.RemoveAtSwap(i);
-			continue;
+			Out.Appendf("\"mode\":\"%s\",\"isFalling\":%s,\"isCrouched\":%s",
+				Strands_MovementModeName(MoveComp->MovementMode),
+				MoveComp->IsFalling() ? "true" : "false",
+				Character->bIsCrouched ? "true" : "false");
 		}
-		LookRate += LookActions[i].Rate;
 	}
+	Out << "}";
 
-	// Apply to current controlled pawn/character
-	UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Axes Move=(%0.2f,%0.2f) LookRate=(%0.2f,%0.2f) PendingJump=%d"), MoveAxis.X, MoveAxis.Y, LookRate.X, LookRate.Y, PendingJumpCount);
-	ACharacter* Character = Strands_GetControlledCharacter(GetWorld());
-	APawn* Pawn = Character ? (APawn*)Character : Strands_GetControlledPawn(GetWorld());
-	if (!Character)
+	// Traces: read the latest async probe results (see KickStateTraces). These
+	// are at most one frame old, which is within the noise of agent polling.
+	const float ForwardWaist = LatestTraces[Trace_ForwardWaist];
+	Out.Appendf(",\"trace\":{\"forward\":{\"knee\":%.1f,\"waist\":%.1f,\"chest\":%.1f},\"left\":{\"waist\":%.1f},\"right\":{\"waist\":%.1f},\"down\":{\"dist\":%.1f}}",
+		LatestTraces[Trace_ForwardKnee], ForwardWaist, LatestTraces[Trace_ForwardChest],
+		LatestTraces[Trace_LeftWaist], LatestTraces[Trace_RightWaist], LatestTraces[Trace_Down]);
+
+	// Derived flags
+	Out.Appendf(",\"blocked\":{\"forward\":%s}", (ForwardWaist > 0.f && ForwardWaist < 100.f) ? "true" : "false");
+
+	// Nearby dynamic obstacles (vehicles and any crowd entities registered as
+	// traffic obstacles) from the per-frame obstacle grid - one cached spatial
+	// query, no per-request Mass entity iteration. Bearings are degrees
+	// relative to pawn facing, negative to the left.
+	if (Pawn)
 	{
-		UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: No ACharacter possessed."));
+		if (const UMassTrafficSubsystem* TrafficSubsystem = World->GetSubsystem<UMassTrafficSubsystem>())
+		{
+			const FMassTrafficObstacleGrid& Grid = TrafficSubsystem->GetObstacleGrid();
+			if (Grid.Num() > 0)
+			{
+				constexpr float NearbyRadius = 3000.f; // 30 m
+
+				const FVector PawnLocation = Pawn->GetActorLocation();
+				TArray<FMassTrafficObstacleGridEntry> Entries;
+				Grid.QueryLaneSegment(PawnLocation, PawnLocation, NearbyRadius, Entries);
+
+				const FVector Forward = Pawn->GetActorForwardVector();
+				int32 Count = 0;
+				int32 MovingCount = 0;
+				float NearestDist = NearbyRadius;
+				float NearestBearing = 0.f;
+				float NearestSpeed = 0.f;
+
+				for (const FMassTrafficObstacleGridEntry& Entry : Entries)
+				{
+					const FVector ToEntry = Entry.Location - PawnLocation;
+					const float Dist = (float)ToEntry.Size2D();
+					if (Dist > NearbyRadius || Dist < 1.f) // the grid may contain the player's own vehicle
+					{
+						continue;
+					}
+
+					++Count;
+					const float Speed = (float)Entry.Velocity.Size2D();
+					if (Speed > 10.f)
+					{
+						++MovingCount;
+					}
+
+					if (Dist < NearestDist)
+					{
+						NearestDist = Dist;
+						NearestSpeed = Speed;
+						const FVector Dir = ToEntry.GetSafeNormal2D();
+						NearestBearing = FMath::RadiansToDegrees(FMath::Atan2(
+							(float)FVector::CrossProduct(Forward, Dir).Z,
+							(float)FVector::DotProduct(Forward, Dir)));
+					}
+				}
+
+				Out.Appendf(",\"nearby\":{\"radius\":%.0f,\"count\":%d,\"moving\":%d", NearbyRadius, Count, MovingCount);
+				if (Count > 0)
+				{
+					Out.Appendf(",\"nearest\":{\"dist\":%.0f,\"bearing\":%.0f,\"speed\":%.0f}", NearestDist, NearestBearing, NearestSpeed);
+				}
+				Out << "}";
+			}
+		}
 	}
-	if (!Pawn)
+
+	Out << "}";
+}
+
+void UStrandsInputServerSubsystem::KickStateTraces(UWorld* World)
+{
+	ACharacter* Character = Strands_GetControlledCharacter(World);
+	APawn* Pawn = Character ? static_cast<APawn*>(Character) : Strands_GetControlledPawn(World);
+	if (!World || !Pawn)
 	{
-		UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: No Pawn/Controller."));
+		return;
 	}
 
+	const FVector BaseLoc = Pawn->GetActorLocation();
+	const FVector Fwd = Pawn->GetActorForwardVector();
+	const FVector Right = Pawn->GetActorRightVector();
+	const FVector Up = Pawn->GetActorUpVector();
+
+	float HalfHeight = 88.f;
 	if (Character)
 	{
-		if (!MoveAxis.IsNearlyZero())
+		if (const UCapsuleComponent* Capsule = Character->GetCapsuleComponent())
 		{
-			Character->AddMovementInput(Character->GetActorForwardVector(), MoveAxis.X);
-			Character->AddMovementInput(Character->GetActorRightVector(), MoveAxis.Y);
+			HalfHeight = Capsule->GetScaledCapsuleHalfHeight();
 		}
+	}
+
+	const float RangeFwd = 200.f;
+	const float RangeSide = 200.f;
+	const float RangeDown = 300.f;
+	const float Knee = 50.f;
+	const float Waist = 90.f;
+	const float Chest = 140.f;
 
-		if (PendingJumpCount > 0)
+	const FVector KneeStart = BaseLoc + Up * (Knee - HalfHeight);
+	const FVector WaistStart = BaseLoc + Up * (Waist - HalfHeight);
+	const FVector ChestStart = BaseLoc + Up * (Chest - HalfHeight);
+
+	TWeakObjectPtr<UStrandsInputServerSubsystem> WeakThis(this);
+	auto KickTrace = [World, Pawn, WeakThis](int32 Slot, const FVector& Start, const FVector& Dir, float Length)
+	{
+		FCollisionQueryParams Params(SCENE_QUERY_STAT(StrandsStateTrace), false, Pawn);
+		FTraceDelegate Delegate;
+		Delegate.BindLambda([WeakThis, Slot, Length](const FTraceHandle& Handle, FTraceDatum& Datum)
 		{
-			UE_LOG(LogTemp, Log, TEXT("StrandsInputServer: Jumping %d time(s)"), PendingJumpCount);
-			for (int32 i = 0; i < PendingJumpCount; ++i)
+			if (UStrandsInputServerSubsystem* Self = WeakThis.Get())
 			{
-				Character->Jump();
+				Self->LatestTraces[Slot] = Datum.OutHits.Num() > 0 ? Datum.OutHits[0].Distance : Length;
 			}
-			PendingJumpCount = 0;
-		}
-	}
+		});
+		World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Start, Start + Dir * Length, ECollisionChannel::ECC_Visibility, Params, FCollisionResponseParams::DefaultResponseParam, &Delegate);
+	};
+
+	KickTrace(Trace_ForwardKnee, KneeStart, Fwd, RangeFwd);
+	KickTrace(Trace_ForwardWaist, WaistStart, Fwd, RangeFwd);
+	KickTrace(Trace_ForwardChest, ChestStart, Fwd, RangeFwd);
+	KickTrace(Trace_LeftWaist, WaistStart, -Right, RangeSide);
+	KickTrace(Trace_RightWaist, WaistStart, Right, RangeSide);
+	KickTrace(Trace_Down, BaseLoc, -Up, RangeDown);
+}
 
-	if (Pawn)
+FAnsiStringView UStrandsInputServerSubsystem::GetOrBuildStateJson()
+{
+	// Build at most once per frame; the cache invalidates when the frame advances
+	if (CachedStateFrame == GFrameCounter && StateJsonBuilder.Len() > 0)
 	{
-		if (!LookRate.IsNearlyZero())
-		{
-			// Convert deg/sec to per-tick input
-			const float YawDelta = LookRate.X * DeltaSeconds;
-			const float PitchDelta = LookRate.Y * DeltaSeconds;
-			Pawn->AddControllerYawInput(YawDelta);
-			Pawn->AddControllerPitchInput(PitchDelta);
-		}
+		return StateJsonBuilder.ToView();
 	}
+
+	UWorld* World = GetWorld();
+	StateJsonBuilder.Reset();
+	BuildWorldState(StateJsonBuilder, World);
+	CachedStateFrame = GFrameCounter;
+
+	// Refresh the obstacle probes for the next snapshot
+	KickStateTraces(World);
+
+	return StateJsonBuilder.ToView();
 }
 
-void UStrandsInputServerSubsystem::ApplySprintIfPending()
+void UStrandsInputServerSubsystem::BuildStateSnapshot(FStrandsStateSnapshot& Out) const
 {
-	if (!PendingSprintEnabled.IsSet())
+	UWorld* World = GetWorld();
+	ACharacter* Character = Strands_GetControlledCharacter(World);
+	APawn* Pawn = Character ? static_cast<APawn*>(Character) : Strands_GetControlledPawn(World);
+
+	if (Pawn)
 	{
-		return;
+		Out.PawnName = Pawn->GetName();
+		Out.Position = Pawn->GetActorLocation();
+		Out.Rotation = Pawn->GetActorRotation();
+		Out.Velocity = Pawn->GetVelocity();
 	}
 
-	ACharacter* Character = Strands_GetControlledCharacter(GetWorld());
 	if (Character)
 	{
 		if (UCharacterMovementComponent* MoveComp = Character->GetCharacterMovement())
 		{
-			MoveComp->MaxWalkSpeed = PendingSprintEnabled.GetValue() ? SprintWalkSpeed : NormalWalkSpeed;
+			Out.MoveMode = FString(Strands_MovementModeName(MoveComp->MovementMode));
+			Out.bIsFalling = MoveComp->IsFalling();
+			Out.bIsCrouched = Character->bIsCrouched;
 		}
 	}
 
-	PendingSprintEnabled.Reset();
+	for (int32 Slot = 0; Slot < Trace_MAX; ++Slot)
+	{
+		Out.Traces[Slot] = LatestTraces[Slot];
+	}
 }
 
-void UStrandsInputServerSubsystem::BuildWorldState(TSharedRef<FJsonObject>& Out, UWorld* World) const
+// Writes the fields of Current that changed beyond their epsilon since
+// Previous into Out, using the same field names and nesting as the full state
+// snapshot. A null Previous writes everything (the first push after subscribe).
+static void Strands_AppendSnapshotDelta(const FStrandsStateSnapshot& Current, const FStrandsStateSnapshot* Previous, const TSharedRef<FJsonObject>& Out)
 {
-	if (!World) { return; }
+	// Per-field change thresholds; movement below these is noise to a 10Hz
+	// observer and does not ship.
+	constexpr double PositionEpsilon = 1.0;  // cm
+	constexpr double RotationEpsilon = 0.1;  // degrees
+	constexpr double VelocityEpsilon = 5.0;  // cm/s
+	constexpr float TraceEpsilon = 5.0f;     // cm
 
-	ACharacter* Character = Strands_GetControlledCharacter(World);
-	APawn* Pawn = Character ? static_cast<APawn*>(Character) : Strands_GetControlledPawn(World);
-
-	const double Now = FPlatformTime::Seconds();
-	Out->SetNumberField(TEXT("ts"), Now);
+	const bool bFull = (Previous == nullptr);
 
-	// Pawn info
-	TSharedPtr<FJsonObject> PawnObj = MakeShared<FJsonObject>();
-	if (Pawn)
+	if (bFull || Current.PawnName != Previous->PawnName)
 	{
-		PawnObj->SetStringField(TEXT("name"), Pawn->GetName());
-		PawnObj->SetStringField(TEXT("class"), Pawn->GetClass() ? Pawn->GetClass()->GetName() : TEXT("Unknown"));
+		TSharedPtr<FJsonObject> PawnObj = MakeShared<FJsonObject>();
+		PawnObj->SetStringField(TEXT("name"), Current.PawnName);
 		Out->SetObjectField(TEXT("pawn"), PawnObj);
+	}
 
-		const FVector Loc = Pawn->GetActorLocation();
+	if (bFull || !Current.Position.Equals(Previous->Position, PositionEpsilon))
+	{
 		TArray<TSharedPtr<FJsonValue>> PosArray;
-		PosArray.Add(MakeShared<FJsonValueNumber>(Loc.X));
-		PosArray.Add(MakeShared<FJsonValueNumber>(Loc.Y));
-		PosArray.Add(MakeShared<FJsonValueNumber>(Loc.Z));
+		PosArray.Add(MakeShared<FJsonValueNumber>(Current.Position.X));
+		PosArray.Add(MakeShared<FJsonValueNumber>(Current.Position.Y));
+		PosArray.Add(MakeShared<FJsonValueNumber>(Current.Position.Z));
 		Out->SetArrayField(TEXT("pos"), PosArray);
+	}
 
-		const FRotator Rot = Pawn->GetActorRotation();
+	if (bFull || !Current.Rotation.Equals(Previous->Rotation, RotationEpsilon))
+	{
 		TSharedPtr<FJsonObject> RotObj = MakeShared<FJsonObject>();
-		RotObj->SetNumberField(TEXT("yaw"), Rot.Yaw);
-		RotObj->SetNumberField(TEXT("pitch"), Rot.Pitch);
-		RotObj->SetNumberField(TEXT("roll"), Rot.Roll);
+		RotObj->SetNumberField(TEXT("yaw"), Current.Rotation.Yaw);
+		RotObj->SetNumberField(TEXT("pitch"), Current.Rotation.Pitch);
+		RotObj->SetNumberField(TEXT("roll"), Current.Rotation.Roll);
 		Out->SetObjectField(TEXT("rot"), RotObj);
+	}
 
-		const FVector Vel = Pawn->GetVelocity();
+	if (bFull || !Current.Velocity.Equals(Previous->Velocity, VelocityEpsilon))
+	{
 		TArray<TSharedPtr<FJsonValue>> VelArray;
-		VelArray.Add(MakeShared<FJsonValueNumber>(Vel.X));
-		VelArray.Add(MakeShared<FJsonValueNumber>(Vel.Y));
-		VelArray.Add(MakeShared<FJsonValueNumber>(Vel.Z));
+		VelArray.Add(MakeShared<FJsonValueNumber>(Current.Velocity.X));
+		VelArray.Add(MakeShared<FJsonValueNumber>(Current.Velocity.Y));
+		VelArray.Add(MakeShared<FJsonValueNumber>(Current.Velocity.Z));
 		Out->SetArrayField(TEXT("vel"), VelArray);
-		Out->SetNumberField(TEXT("speed"), Vel.Length());
+		Out->SetNumberField(TEXT("speed"), Current.Velocity.Length());
 	}
-	else
+
+	if (bFull
+		|| Current.MoveMode != Previous->MoveMode
+		|| Current.bIsFalling != Previous->bIsFalling
+		|| Current.bIsCrouched != Previous->bIsCrouched)
 	{
-		Out->SetObjectField(TEXT("pawn"), PawnObj);
+		TSharedPtr<FJsonObject> MoveObj = MakeShared<FJsonObject>();
+		MoveObj->SetStringField(TEXT("mode"), Current.MoveMode);
+		MoveObj->SetBoolField(TEXT("isFalling"), Current.bIsFalling);
+		MoveObj->SetBoolField(TEXT("isCrouched"), Current.bIsCrouched);
+		Out->SetObjectField(TEXT("move"), MoveObj);
 	}
 
-	// Movement
-	TSharedPtr<FJsonObject> MoveObj = MakeShared<FJsonObject>();
-	if (Character)
+	bool bTracesChanged = bFull;
+	for (int32 Slot = 0; !bTracesChanged && Slot < UE_ARRAY_COUNT(Current.Traces); ++Slot)
 	{
-		if (UCharacterMovementComponent* MoveComp = Character->GetCharacterMovement())
-		{
-			FString ModeStr = TEXT("None");
-			switch (MoveComp->MovementMode)
-			{
-			case MOVE_Walking: ModeStr = TEXT("Walking"); break;
-			case MOVE_NavWalking: ModeStr = TEXT("NavWalking"); break;
-			case MOVE_Falling: ModeStr = TEXT("Falling"); break;
-			case MOVE_Swimming: ModeStr = TEXT("Swimming"); break;
-			case MOVE_Flying: ModeStr = TEXT("Flying"); break;
-			case MOVE_Custom: ModeStr = TEXT("Custom"); break;
-			default: break;
-			}
-			MoveObj->SetStringField(TEXT("mode"), ModeStr);
-			MoveObj->SetBoolField(TEXT("isFalling"), MoveComp->IsFalling());
-			MoveObj->SetBoolField(TEXT("isCrouched"), Character->bIsCrouched);
-		}
+		bTracesChanged = FMath::Abs(Current.Traces[Slot] - Previous->Traces[Slot]) > TraceEpsilon;
 	}
-	Out->SetObjectField(TEXT("move"), MoveObj);
-
-	// Traces
-	TSharedPtr<FJsonObject> TraceObj = MakeShared<FJsonObject>();
-	float ForwardKnee = 0.f, ForwardWaist = 0.f, ForwardChest = 0.f;
-	float LeftWaist = 0.f, RightWaist = 0.f;
-	float DownDist = 0.f;
 
-	if (Pawn)
+	if (bTracesChanged)
 	{
-		const FVector BaseLoc = Pawn->GetActorLocation();
-		const FVector Fwd = Pawn->GetActorForwardVector();
-		const FVector Right = Pawn->GetActorRightVector();
-		const FVector Up = Pawn->GetActorUpVector();
+		TSharedPtr<FJsonObject> TraceObj = MakeShared<FJsonObject>();
 
-		float HalfHeight = 88.f;
-		if (Character)
-		{
-			if (const UCapsuleComponent* Capsule = Character->GetCapsuleComponent())
-			{
-				HalfHeight = Capsule->GetScaledCapsuleHalfHeight();
-			}
-		}
+		TSharedPtr<FJsonObject> ForwardObj = MakeShared<FJsonObject>();
+		ForwardObj->SetNumberField(TEXT("knee"), Current.Traces[0]);
+		ForwardObj->SetNumberField(TEXT("waist"), Current.Traces[1]);
+		ForwardObj->SetNumberField(TEXT("chest"), Current.Traces[2]);
+		TraceObj->SetObjectField(TEXT("forward"), ForwardObj);
 
-		auto TraceDist = [World](const FVector& Start, const FVector& Dir, float Length, const AActor* Ignore)->float
-		{
-			FHitResult Hit;
-			FCollisionQueryParams Params(SCENE_QUERY_STAT(StrandsStateTrace), false, Ignore);
-			const bool bHit = World->LineTraceSingleByChannel(Hit, Start, Start + Dir * Length, ECollisionChannel::ECC_Visibility, Params);
-			return bHit ? Hit.Distance : Length;
-		};
+		TSharedPtr<FJsonObject> LeftObj = MakeShared<FJsonObject>();
+		LeftObj->SetNumberField(TEXT("waist"), Current.Traces[3]);
+		TraceObj->SetObjectField(TEXT("left"), LeftObj);
 
-		const float RangeFwd = 200.f;
-		const float RangeSide = 200.f;
-		const float RangeDown = 300.f;
-		const float Knee = 50.f;
-		const float Waist = 90.f;
-		const float Chest = 140.f;
+		TSharedPtr<FJsonObject> RightObj = MakeShared<FJsonObject>();
+		RightObj->SetNumberField(TEXT("waist"), Current.Traces[4]);
+		TraceObj->SetObjectField(TEXT("right"), RightObj);
 
-		const FVector KneeStart = BaseLoc + Up * (Knee - HalfHeight);
-		const FVector WaistStart = BaseLoc + Up * (Waist - HalfHeight);
-		const FVector ChestStart = BaseLoc + Up * (Chest - HalfHeight);
+		TSharedPtr<FJsonObject> DownObj = MakeShared<FJsonObject>();
+		DownObj->SetNumberField(TEXT("dist"), Current.Traces[5]);
+		TraceObj->SetObjectField(TEXT("down"), DownObj);
 
-		ForwardKnee = TraceDist(KneeStart, Fwd, RangeFwd, Pawn);
-		ForwardWaist = TraceDist(WaistStart, Fwd, RangeFwd, Pawn);
-		ForwardChest = TraceDist(ChestStart, Fwd, RangeFwd, Pawn);
+		Out->SetObjectField(TEXT("trace"), TraceObj);
 
-		LeftWaist = TraceDist(WaistStart, -Right, RangeSide, Pawn);
-		RightWaist = TraceDist(WaistStart, Right, RangeSide, Pawn);
+		TSharedPtr<FJsonObject> BlockedObj = MakeShared<FJsonObject>();
+		BlockedObj->SetBoolField(TEXT("forward"), Current.Traces[1] > 0.f && Current.Traces[1] < 100.f);
+		Out->SetObjectField(TEXT("blocked"), BlockedObj);
+	}
+}
 
-		DownDist = TraceDist(BaseLoc, -Up, RangeDown, Pawn);
+void UStrandsInputServerSubsystem::TickSubscriptions(double Now)
+{
+	// Once every transport is empty there is no one left to push to; drop all
+	// subscriptions rather than serializing into the void. Pushes to a client
+	// that disconnected while others remain are silently dropped by the
+	// transports, and its slot is reclaimed here when the last client leaves.
+	const int32 NumTcpClients = Receiver.IsValid() ? Receiver->GetConnectedClientCount() : 0;
+	if (NumTcpClients == 0 && WebSocketClients.Num() == 0)
+	{
+		Subscriptions.Reset();
+		return;
 	}
 
-	TSharedPtr<FJsonObject> ForwardObj = MakeShared<FJsonObject>();
-	ForwardObj->SetNumberField(TEXT("knee"), ForwardKnee);
-	ForwardObj->SetNumberField(TEXT("waist"), ForwardWaist);
-	ForwardObj->SetNumberField(TEXT("chest"), ForwardChest);
-	TraceObj->SetObjectField(TEXT("forward"), ForwardObj);
+	// Gather the snapshot once no matter how many subscribers are due
+	bool bSnapshotBuilt = false;
+	FStrandsStateSnapshot Current;
+
+	for (FStrandsStateSubscription& Sub : Subscriptions)
+	{
+		if (Now < Sub.NextPushTime)
+		{
+			continue;
+		}
+		Sub.NextPushTime = Now + Sub.Interval;
 
-	TSharedPtr<FJsonObject> LeftObj = MakeShared<FJsonObject>();
-	LeftObj->SetNumberField(TEXT("waist"), LeftWaist);
-	TraceObj->SetObjectField(TEXT("left"), LeftObj);
+		if (!bSnapshotBuilt)
+		{
+			BuildStateSnapshot(Current);
+			bSnapshotBuilt = true;
+		}
 
-	TSharedPtr<FJsonObject> RightObj = MakeShared<FJsonObject>();
-	RightObj->SetNumberField(TEXT("waist"), RightWaist);
-	TraceObj->SetObjectField(TEXT("right"), RightObj);
+		TSharedRef<FJsonObject> Delta = MakeShared<FJsonObject>();
+		Strands_AppendSnapshotDelta(Current, Sub.bHasPrevious ? &Sub.Previous : nullptr, Delta);
 
-	TSharedPtr<FJsonObject> DownObj = MakeShared<FJsonObject>();
-	DownObj->SetNumberField(TEXT("dist"), DownDist);
-	TraceObj->SetObjectField(TEXT("down"), DownObj);
+		// Nothing crossed its epsilon since the last push: send nothing and keep
+		// the previous snapshot as the comparison baseline.
+		if (Delta->Values.Num() == 0)
+		{
+			continue;
+		}
 
-	Out->SetObjectField(TEXT("trace"), TraceObj);
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetObjectField(TEXT("state"), Delta);
+		Root->SetNumberField(TEXT("ts"), Now);
 
-	// Derived flags
-	TSharedPtr<FJsonObject> BlockedObj = MakeShared<FJsonObject>();
-	BlockedObj->SetBoolField(TEXT("forward"), ForwardWaist > 0.f && ForwardWaist < 100.f);
-	Out->SetObjectField(TEXT("blocked"), BlockedObj);
+		FString Json;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+		FJsonSerializer::Serialize(Root, Writer);
+		Json.AppendChar(TEXT('\n'));
+
+		FTCHARToUTF8 Utf8(*Json);
+		TArray<uint8> Bytes((const uint8*)Utf8.Get(), Utf8.Length());
+		SendToClientTransport(Sub.ClientId, MoveTemp(Bytes));
+
+		Sub.Previous = Current;
+		Sub.bHasPrevious = true;
+	}
+
+	// Refresh the obstacle probes so the next push compares fresh distances
+	if (bSnapshotBuilt)
+	{
+		KickStateTraces(GetWorld());
+	}
+}
+
+void UStrandsInputServerSubsystem::UpdateSharedMemoryState()
+{
+	// Seqlock header followed by UTF-8 JSON. The writer bumps the sequence to
+	// an odd value while writing and to the next even value when done; readers
+	// retry if they observe an odd or changed sequence.
+	struct FSharedStateHeader
+	{
+		volatile int32 Sequence;
+		int32 PayloadSize;
+	};
+
+	uint8* Base = (uint8*)StateSharedMemory->GetAddress();
+	FSharedStateHeader* Header = (FSharedStateHeader*)Base;
+
+	// The cached bytes are already UTF-8, so publishing is a straight memcpy
+	const FAnsiStringView Json = GetOrBuildStateJson();
+	const int32 MaxPayload = (int32)StateSharedMemorySize - (int32)sizeof(FSharedStateHeader);
+	const int32 PayloadSize = FMath::Min(Json.Len(), MaxPayload);
+
+	const int32 WriteSeq = Header->Sequence + 1; // odd: write in progress
+	FPlatformAtomics::InterlockedExchange(&Header->Sequence, WriteSeq);
+	FMemory::Memcpy(Base + sizeof(FSharedStateHeader), (const uint8*)Json.GetData(), PayloadSize);
+	Header->PayloadSize = PayloadSize;
+	FPlatformMisc::MemoryBarrier();
+	FPlatformAtomics::InterlockedExchange(&Header->Sequence, WriteSeq + 1);
 }
 
 void UStrandsInputServerSubsystem::WriteWorldStateToFile(const FString& OutPath)
 {
-	UWorld* World = GetWorld();
-	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
-	BuildWorldState(Root, World);
+	const FAnsiStringView Output = GetOrBuildStateJson();
 
 	const FString Dir = FPaths::GetPath(OutPath);
 	if (!Dir.IsEmpty())
@@ -641,9 +2933,10 @@ void UStrandsInputServerSubsystem::WriteWorldStateToFile(const FString& OutPath)
 		IFileManager::Get().MakeDirectory(*Dir, true);
 	}
 
-	FString Output;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
-	FJsonSerializer::Serialize(Root, Writer);
-
-	FFileHelper::SaveStringToFile(Output, *OutPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	// Already UTF-8: write the pooled builder's bytes without re-encoding
+	if (FArchive* Ar = IFileManager::Get().CreateFileWriter(*OutPath))
+	{
+		Ar->Serialize((void*)Output.GetData(), Output.Len());
+		delete Ar;
+	}
 }
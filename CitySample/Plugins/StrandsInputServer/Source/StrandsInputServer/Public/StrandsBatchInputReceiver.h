@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "StrandsBatchInputReceiver.generated.h"
+
+UENUM()
+enum class EStrandsSyntheticInputType : uint8
+{
+	Move,   // Value.X = forward axis, Value.Y = right axis
+	Look,   // Value.X = yaw delta (deg), Value.Y = pitch delta (deg)
+	Jump,   // Value unused
+	Sprint, // Value.X > 0 enables
+};
+
+/** One timestamped synthetic input event handed to a batch input receiver */
+USTRUCT(BlueprintType)
+struct FStrandsSyntheticInputEvent
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	EStrandsSyntheticInputType Type = EStrandsSyntheticInputType::Move;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FVector2D Value = FVector2D::ZeroVector;
+
+	/** FPlatformTime::Seconds timestamp when the event becomes due. <= 0 applies on the next input tick. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	double ApplyTime = 0.0;
+};
+
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UStrandsBatchInputReceiver : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Implemented by controllers that can route a whole batch of synthetic input events through
+ * their own input stack. The input server prefers this over per-command pawn pokes: events
+ * participate in the receiver's normal input buffering and consumption semantics, and the
+ * per-call overhead is paid once per batch instead of once per command.
+ */
+class STRANDSINPUTSERVER_API IStrandsBatchInputReceiver
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns false when the receiver cannot route the batch; callers should fall back to direct pawn input */
+	virtual bool InjectStrandsInputBatch(const TArray<FStrandsSyntheticInputEvent>& Events) = 0;
+};
@@ -22,6 +22,38 @@ public:
 	UPROPERTY(config, EditAnywhere, Category="Networking", meta=(ClampMin="1024", ClampMax="65535"))
 	int32 Port = 17777;
 
+	// If true, scan [Port, Port + PortRangeSize) and bind the first free port
+	// instead of failing when Port is taken, so several instances (PIE windows,
+	// headless agents) can run on one machine without per-instance config. The
+	// port actually bound is logged and written to a discovery file under
+	// Saved/Strands/Ports/.
+	UPROPERTY(config, EditAnywhere, Category="Networking")
+	bool bUsePortRange = false;
+
+	// Number of consecutive ports to try when the port range is enabled.
+	UPROPERTY(config, EditAnywhere, Category="Networking", meta=(ClampMin="1", ClampMax="64", EditCondition="bUsePortRange"))
+	int32 PortRangeSize = 8;
+
+	// If true, also listen for native WebSocket connections so browser and
+	// Python clients can connect without a relay process.
+	UPROPERTY(config, EditAnywhere, Category="Networking")
+	bool bEnableWebSocketServer = false;
+
+	// WebSocket port to listen on when the WebSocket server is enabled.
+	UPROPERTY(config, EditAnywhere, Category="Networking", meta=(ClampMin="1024", ClampMax="65535"))
+	int32 WebSocketPort = 17778;
+
+	// If true, the world state snapshot is also published to a named
+	// shared-memory region every tick, so local agents can read it without any
+	// file or socket round-trip.
+	UPROPERTY(config, EditAnywhere, Category="Networking")
+	bool bEnableSharedMemoryState = false;
+
+	// Name of the shared-memory region. Append a session ID here when running
+	// multiple instances on one machine.
+	UPROPERTY(config, EditAnywhere, Category="Networking")
+	FString SharedMemoryName = TEXT("StrandsAgentState");
+
 	// Default duration for move commands when not specified (seconds).
 	UPROPERTY(config, EditAnywhere, Category="Control", meta=(ClampMin="0.0"))
 	float DefaultMoveDuration = 0.25f;
@@ -4,10 +4,19 @@
 #include "Subsystems/WorldSubsystem.h"
 #include "Common/TcpListener.h"
 #include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "Containers/Queue.h"
+#include "Containers/StringBuilder.h"
+#include "HAL/Runnable.h"
+#include "AI/Navigation/NavigationTypes.h"
 #include "StrandsInputServerSubsystem.generated.h"
 
+class APawn;
+class ASceneCapture2D;
 class FSocket;
 class FJsonObject;
+class FRunnableThread;
+class IWebSocketServer;
+class INetworkingWebSocket;
 
 USTRUCT()
 struct FStrandsMoveAction
@@ -15,6 +24,12 @@ struct FStrandsMoveAction
 	GENERATED_BODY()
 	FVector2D Axis = FVector2D::ZeroVector; // X=Forward, Y=Right
 	double EndTime = 0.0;
+
+	// Acknowledgement bookkeeping: acked to ClientId the first tick the action
+	// is applied. Seq 0 means the client did not request an ack.
+	uint64 ClientId = 0;
+	uint32 Seq = 0;
+	bool bAckSent = false;
 };
 
 USTRUCT()
@@ -23,6 +38,220 @@ struct FStrandsLookAction
 	GENERATED_BODY()
 	FVector2D Rate = FVector2D::ZeroVector; // X=YawRate (deg/sec), Y=PitchRate (deg/sec)
 	double EndTime = 0.0;
+
+	// See FStrandsMoveAction
+	uint64 ClientId = 0;
+	uint32 Seq = 0;
+	bool bAckSent = false;
+};
+
+// Interpolation profile between consecutive track keys.
+enum class EStrandsTrackEase : uint8
+{
+	Hold,   // step: a key's value holds until the next key
+	Linear,
+	Smooth, // smoothstep between keys
+};
+
+USTRUCT()
+struct FStrandsTrackKey
+{
+	GENERATED_BODY()
+	float Time = 0.f;                        // seconds from track start
+	FVector2D Value = FVector2D::ZeroVector; // move axis or look rate at this key
+};
+
+/**
+ * Keyframed move/look track: a time-sorted list of keys evaluated through a
+ * monotonically advancing cursor, so one command can describe a whole maneuver
+ * (ramp up, cruise, ramp down) and per-tick evaluation stays O(1) amortized no
+ * matter how many keys the track has. The cursor replaces a per-tick binary
+ * search because evaluation time only moves forward.
+ */
+USTRUCT()
+struct FStrandsActionTrack
+{
+	GENERATED_BODY()
+
+	TArray<FStrandsTrackKey> Keys; // sorted by Time ascending
+	double StartTime = 0.0;
+	EStrandsTrackEase Ease = EStrandsTrackEase::Linear;
+	int32 Cursor = 0;
+
+	// See FStrandsMoveAction
+	uint64 ClientId = 0;
+	uint32 Seq = 0;
+	bool bAckSent = false;
+
+	bool IsFinished(double Now) const
+	{
+		return Keys.Num() == 0 || (Now - StartTime) >= Keys.Last().Time;
+	}
+
+	FVector2D Evaluate(double Now)
+	{
+		const float T = (float)(Now - StartTime);
+		while (Cursor + 1 < Keys.Num() && Keys[Cursor + 1].Time <= T)
+		{
+			++Cursor;
+		}
+
+		const FStrandsTrackKey& A = Keys[Cursor];
+		if (Cursor + 1 >= Keys.Num() || T <= A.Time || Ease == EStrandsTrackEase::Hold)
+		{
+			return A.Value;
+		}
+
+		const FStrandsTrackKey& B = Keys[Cursor + 1];
+		float Alpha = (T - A.Time) / FMath::Max(B.Time - A.Time, KINDA_SMALL_NUMBER);
+		if (Ease == EStrandsTrackEase::Smooth)
+		{
+			Alpha = FMath::SmoothStep(0.f, 1.f, Alpha);
+		}
+		return FMath::Lerp(A.Value, B.Value, Alpha);
+	}
+};
+
+/**
+ * Active high-level moveTo: a navmesh path followed point by point inside the
+ * scheduled action application, so one command replaces the dozens of short
+ * move/look commands a traversal used to take. The path comes from an async
+ * navigation query; until it lands, the action is pending and contributes no
+ * input. Completion (arrival, path failure, or being superseded) is reported
+ * on the ack channel.
+ */
+USTRUCT()
+struct FStrandsMoveToAction
+{
+	GENERATED_BODY()
+
+	TArray<FVector> PathPoints;
+	int32 NextPoint = 0;
+	FVector Goal = FVector::ZeroVector;
+	float AcceptanceRadius = 50.f;
+	uint32 AsyncQueryId = 0;
+	bool bPathReady = false;
+
+	// See FStrandsMoveAction
+	uint64 ClientId = 0;
+	uint32 Seq = 0;
+};
+
+/**
+ * Opt-in binary frame protocol. A client switches a connection to binary mode by
+ * sending the 4-byte magic "SBF1" as its very first bytes after connect; anything
+ * else keeps the connection on the newline-delimited JSON protocol, so debugging
+ * clients keep working unchanged.
+ *
+ * Binary frames are [uint8 Command][uint8 PayloadSize][payload], with the
+ * fixed-layout payload structs below (little-endian, packed). Jump has no payload.
+ */
+enum class EStrandsBinaryCommand : uint8
+{
+	Move = 1,
+	Look = 2,
+	Jump = 3,
+	Sprint = 4,
+};
+
+#pragma pack(push, 1)
+struct FStrandsBinaryMovePayload
+{
+	float Forward;
+	float Right;
+	float Duration; // <= 0 means use DefaultMoveDuration
+};
+
+struct FStrandsBinaryLookPayload
+{
+	float YawRate;   // deg/sec
+	float PitchRate; // deg/sec
+	float Duration;  // <= 0 means use DefaultLookDuration
+};
+
+struct FStrandsBinarySprintPayload
+{
+	uint8 bEnabled;
+};
+#pragma pack(pop)
+
+/**
+ * UTF-8 byte accumulator with an explicit consumed-head index. Bytes append at
+ * the tail; the parser reads contiguous slices from the head and marks them
+ * consumed without copying. The dead prefix is reclaimed with a single memmove
+ * once it grows past a threshold, so consuming N bytes of lines is O(N) rather
+ * than the O(N^2) of per-line RemoveAt(0, ...) front-removal.
+ */
+struct FStrandsByteAccumulator
+{
+	void Append(const uint8* Data, int32 Num)
+	{
+		// Reclaim the consumed prefix before growing the allocation
+		if (Head > 0 && (Head >= CompactThreshold || Head == Bytes.Num()))
+		{
+			Compact();
+		}
+		Bytes.Append(Data, Num);
+	}
+
+	const uint8* PeekData() const { return Bytes.GetData() + Head; }
+	int32 NumPending() const { return Bytes.Num() - Head; }
+
+	void Consume(int32 Num)
+	{
+		Head += Num;
+		checkSlow(Head <= Bytes.Num());
+	}
+
+	void Compact()
+	{
+		const int32 Remaining = Bytes.Num() - Head;
+		if (Head > 0)
+		{
+			if (Remaining > 0)
+			{
+				FMemory::Memmove(Bytes.GetData(), Bytes.GetData() + Head, Remaining);
+			}
+			Bytes.SetNum(Remaining, EAllowShrinking::No);
+			Head = 0;
+		}
+	}
+
+	void Reset()
+	{
+		Bytes.Reset();
+		Head = 0;
+	}
+
+	TArray<uint8> Bytes;
+	int32 Head = 0;
+
+	static constexpr int32 CompactThreshold = 4096;
+};
+
+/**
+ * Per-target command routing state. Each named target (registered pawn) owns its
+ * own scheduled action queues, so one server instance can drive many characters.
+ * The unnamed default target always resolves to the first player's pawn.
+ */
+USTRUCT()
+struct FStrandsTargetActions
+{
+	GENERATED_BODY()
+
+	TWeakObjectPtr<APawn> Pawn;
+
+	TArray<FStrandsMoveAction> MoveActions;
+	TArray<FStrandsLookAction> LookActions;
+	TArray<FStrandsActionTrack> MoveTracks;
+	TArray<FStrandsActionTrack> LookTracks;
+	TOptional<FStrandsMoveToAction> MoveTo;
+	int32 PendingJumpCount = 0;
+	TOptional<bool> PendingSprintEnabled;
+
+	// Acks owed once the pending jump/sprint state is actually consumed
+	TArray<TPair<uint64, uint32>> PendingJumpAcks;
+	TArray<TPair<uint64, uint32>> PendingSprintAcks;
 };
 
 USTRUCT()
@@ -30,7 +259,245 @@ struct FStrandsClientState
 {
 	GENERATED_BODY()
 	FSocket* Socket = nullptr;
-	FString Pending;
+
+	// Stable ID used to route responses back to the requesting connection
+	uint64 ClientId = 0;
+
+	// Raw received bytes for both protocols: pre-negotiation bytes, unconsumed
+	// JSON line fragments, and (in binary mode) any incomplete trailing frame.
+	FStrandsByteAccumulator Pending;
+	bool bProtocolDecided = false;
+	bool bBinaryMode = false;
+};
+
+/**
+ * Plain-struct world state snapshot used by the subscription pushes. Deltas
+ * are computed by comparing two of these with per-field epsilons, which is far
+ * cheaper than serializing the full JSON and diffing it.
+ */
+struct FStrandsStateSnapshot
+{
+	FString PawnName;
+	FVector Position = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+	FVector Velocity = FVector::ZeroVector;
+	FString MoveMode;
+	bool bIsFalling = false;
+	bool bIsCrouched = false;
+	float Traces[6] = { 0.f, 0.f, 0.f, 0.f, 0.f, 0.f }; // matches EStateTraceSlot order
+};
+
+/**
+ * One client's state subscription: pushed at the requested rate, sending only
+ * fields that changed beyond their epsilon since the last push. The first
+ * push after subscribing is always a full snapshot.
+ */
+struct FStrandsStateSubscription
+{
+	uint64 ClientId = 0;
+	double Interval = 0.1;
+	double NextPushTime = 0.0;
+	bool bHasPrevious = false;
+	FStrandsStateSnapshot Previous;
+};
+
+// Command type parsed off the receiver thread, applied on the game thread in Tick().
+enum class EStrandsCommandType : uint8
+{
+	Move,
+	MoveTo,
+	Look,
+	Jump,
+	Sprint,
+	Screenshot,
+	ScreenshotStream,
+	State,
+	Subscribe,
+	Register,
+	Stats,
+};
+
+struct FStrandsParsedCommand
+{
+	EStrandsCommandType Type = EStrandsCommandType::Jump;
+	uint64 ClientId = 0;                    // connection the command arrived on
+	FVector2D Axis = FVector2D::ZeroVector; // move axis, or look rate in deg/sec
+	double Duration = -1.0;                 // < 0 means use the configured default
+	bool bEnabled = false;                  // sprint
+	bool bShowUI = false;                   // screenshot
+	int32 Quality = 85;                     // screenshot_stream JPEG quality
+	int32 CaptureWidth = 0;                 // screenshot/stream: >0 renders through the low-res vision capture
+	int32 CaptureHeight = 0;                // 0 derives 16:9 from CaptureWidth
+	uint32 Seq = 0;                         // client sequence ID; 0 = no ack requested
+	FName Target;                           // routing target; NAME_None = player pawn
+	FString Path;                           // screenshot/state output path (empty = default)
+	FString TargetActor;                    // register: world actor name to bind to Target
+	FVector Location = FVector::ZeroVector; // moveTo goal (world space)
+	float AcceptanceRadius = 50.f;          // moveTo arrival distance
+	float Rate = 10.f;                      // subscribe push rate in Hz; <= 0 unsubscribes
+
+	// Keyframed variant of move/look: when Keys is non-empty the command
+	// schedules an FStrandsActionTrack instead of a constant action.
+	TArray<FStrandsTrackKey> Keys;
+	EStrandsTrackEase Ease = EStrandsTrackEase::Linear;
+
+	// Stamped when the command's bytes came off the wire; the game thread
+	// measures receive-to-apply latency against this. 0 means not stamped.
+	double ReceiveTime = 0.0;
+};
+
+/**
+ * Receive-to-apply latency samples for one command type. The ring is written
+ * only in ApplyParsedCommand and read only by the stats exports, all on the
+ * game thread, so it is race-free without any locking; Count keeps growing
+ * while the ring retains the newest Capacity samples for percentiles.
+ */
+struct FStrandsCommandLatencyRing
+{
+	static constexpr int32 Capacity = 256;
+
+	float SamplesMS[Capacity] = { 0.f };
+	uint64 Count = 0;
+	double TotalMS = 0.0;
+	float MaxMS = 0.f;
+
+	void Record(float LatencyMS)
+	{
+		SamplesMS[Count % Capacity] = LatencyMS;
+		++Count;
+		TotalMS += LatencyMS;
+		MaxMS = FMath::Max(MaxMS, LatencyMS);
+	}
+
+	int32 NumBuffered() const { return (int32)FMath::Min<uint64>(Count, Capacity); }
+};
+
+/**
+ * Session recorder: appends timestamped raw command lines to a memory buffer
+ * and flushes them to disk off-thread once the buffer passes a threshold, so
+ * the hot path pays a short lock and a memcpy. File format: 4-byte magic
+ * "SRL1", then repeated [double TimeSeconds][uint32 LineLength][UTF-8 bytes],
+ * with TimeSeconds relative to the start of the recording.
+ *
+ * Lines are recorded where they enter the server (receiver thread for TCP,
+ * game thread for WebSocket messages), so replaying a log through the normal
+ * parse-and-apply path reproduces the original command stream. Binary frame
+ * protocol clients are not recorded.
+ */
+class FStrandsSessionRecorder : public TSharedFromThis<FStrandsSessionRecorder, ESPMode::ThreadSafe>
+{
+public:
+	explicit FStrandsSessionRecorder(const FString& InPath);
+
+	// Any thread: append one timestamped line.
+	void RecordLine(FAnsiStringView Line);
+
+	// Game thread: write buffered bytes and wait out any in-flight flush.
+	void Flush();
+
+	bool IsValid() const { return bFileValid; }
+	const FString& GetPath() const { return Path; }
+
+private:
+	void KickAsyncFlush(); // Lock must be held
+
+	FCriticalSection Lock;
+	TArray<uint8> Buffer;
+	FString Path;
+	double StartTime = 0.0;
+	bool bFlushInFlight = false;
+	bool bFileValid = false;
+
+	static constexpr int32 FlushThresholdBytes = 64 * 1024;
+};
+
+/**
+ * Dedicated receiver thread for the input server. Owns the client sockets,
+ * drains them, performs protocol negotiation, line splitting and parsing, and
+ * pushes parsed commands into a lock-free SPSC queue that the subsystem
+ * consumes on the game thread. The game thread never touches a socket while
+ * the receiver is running, so per-tick cost on the game thread is just
+ * dequeueing and applying commands.
+ */
+class FStrandsSocketReceiver : public FRunnable
+{
+public:
+	FStrandsSocketReceiver(float InDefaultMoveDuration, float InDefaultLookDuration);
+	virtual ~FStrandsSocketReceiver() override;
+
+	void Start();
+
+	// FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+	// Any thread: hand off a newly accepted socket; the receiver adopts ownership.
+	void AddClient(FSocket* InSocket);
+
+	// Game thread: pop the next parsed command, if any.
+	bool DequeueCommand(FStrandsParsedCommand& OutCommand);
+
+	// Any thread: connection/queue state for the subsystem's idle tick gating.
+	int32 GetConnectedClientCount() const { return ConnectedClients.GetValue(); }
+	bool HasQueuedCommands() const { return !Commands.IsEmpty(); }
+
+	// Any thread: queue bytes for the given client's socket; dropped silently if
+	// the client has since disconnected.
+	void SendToClient(uint64 ClientId, TArray<uint8>&& Bytes);
+
+	// Game thread: attach/detach the session recorder; lines are recorded on
+	// the receiver thread as they are consumed.
+	void SetRecorder(const TSharedPtr<FStrandsSessionRecorder, ESPMode::ThreadSafe>& InRecorder);
+
+private:
+	void DrainClient(FStrandsClientState& Client);
+	void ConsumeReceivedBytes(FStrandsClientState& Client, const uint8* Data, int32 Num);
+	void ProcessBinaryFrames(FStrandsClientState& Client);
+	void ProcessPendingLines(FStrandsClientState& Client);
+	void ProcessLine(uint64 ClientId, FAnsiStringView Line);
+	void FlushOutbound();
+	void CloseAllClients();
+
+	// Receiver thread only
+	TArray<FStrandsClientState> Clients;
+	uint64 NextClientId = 1;
+
+	// Connected (plus pending-adoption) client count, maintained from AddClient
+	// and the disconnect paths so the game thread can test for idleness without
+	// touching receiver-owned state.
+	FThreadSafeCounter ConnectedClients;
+
+	// Optional session recorder; swapped from the game thread under the lock
+	TSharedPtr<FStrandsSessionRecorder, ESPMode::ThreadSafe> Recorder;
+	FCriticalSection RecorderLock;
+
+	// Fixed receive scratch shared by all clients; the receiver thread is the
+	// only reader of sockets, so steady-state draining performs no heap
+	// allocations (the per-client accumulators retain their slack too).
+	TArray<uint8> RecvBuffer;
+
+	// Parsed-command scratch reused across lines
+	TArray<FStrandsParsedCommand> LineScratch;
+
+	// Listener thread -> receiver thread
+	TQueue<FSocket*, EQueueMode::Mpsc> PendingSockets;
+
+	// Receiver thread -> game thread
+	TQueue<FStrandsParsedCommand, EQueueMode::Spsc> Commands;
+
+	// Any thread -> receiver thread (responses, e.g. streamed screenshots)
+	struct FOutboundPacket
+	{
+		uint64 ClientId = 0;
+		TArray<uint8> Bytes;
+	};
+	TQueue<FOutboundPacket, EQueueMode::Mpsc> Outbound;
+
+	FRunnableThread* Thread = nullptr;
+	FThreadSafeBool bStopRequested = false;
+
+	float DefaultMoveDuration = 0.25f;
+	float DefaultLookDuration = 0.2f;
 };
 
 /**
@@ -38,6 +505,9 @@ struct FStrandsClientState
  * JSON lines protocol:
  *  { "cmd": "move", "forward": 1.0, "right": 0.0, "duration": 0.25 }
  *  { "cmd": "look", "yawRate": 0.5, "pitchRate": 0.0, "duration": 0.2 }
+ *  { "cmd": "move", "ease": "smooth", "keys": [ { "t": 0.0, "forward": 0.0 }, { "t": 1.0, "forward": 1.0 }, { "t": 3.0, "forward": 0.0 } ] }
+ *  { "cmd": "moveTo", "x": 1000.0, "y": 2000.0, "z": 100.0, "acceptance": 50 }
+ *  { "cmd": "subscribe", "hz": 10 }  (hz 0 unsubscribes)
  *  { "cmd": "jump" }
  *  { "cmd": "sprint", "enabled": true }
  */
@@ -56,40 +526,203 @@ public:
 	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UStrandsInputServerSubsystem, STATGROUP_Tickables); }
 	virtual bool IsTickableWhenPaused() const override { return true; }
 
+	// Idle gating: false when there are no clients, no queued commands and no
+	// scheduled actions, so idle sessions skip Tick entirely. A new connection
+	// re-enables ticking via the receiver's client counter, which the accept
+	// callback bumps before this is polled again.
+	virtual bool IsTickable() const override;
+
 	// Control
 	bool StartServer();
 	void StopServer();
 	bool IsRunning() const { return bRunning; }
 
-private:
-	// Networking
-	bool HandleConnectionAccepted(FSocket* InSocket, const FIPv4Endpoint& InEndpoint);
-	void PollClients(float DeltaSeconds);
-	void ProcessLine(const FString& Line);
-	void DrainClient(FStrandsClientState& Client);
+	// Port the TCP listener actually bound (may differ from the configured port
+	// when the port-range scan is enabled). 0 while not running.
+	int32 GetBoundPort() const { return BoundPort; }
+
+	// Pawn routing registry. Registered pawns are addressed by the "target"
+	// field in the command schema; unregistering drops any queued actions.
+	UFUNCTION(BlueprintCallable, Category="Strands")
+	void RegisterPawn(FName TargetName, APawn* Pawn);
+
+	UFUNCTION(BlueprintCallable, Category="Strands")
+	void UnregisterPawn(FName TargetName);
+
+	// Logs per-command-type receive-to-apply latency; bound to strands.DumpStats.
+	void DumpCommandLatencyStats() const;
+
+	// Session recording/replay. Recording appends raw command lines to a binary
+	// log; replay feeds a log back through the parse-and-apply path, either at
+	// the original relative timing or as fast as possible.
+	bool StartRecording(const FString& Path);
+	void StopRecording();
+	bool StartReplay(const FString& Path, bool bAsFastAsPossible);
+	bool IsReplaying() const { return bReplaying; }
 
+private:
 	// Control
+	void ApplyParsedCommand(const FStrandsParsedCommand& Command);
 	void ApplyScheduledActions(float DeltaSeconds);
-	void ApplySprintIfPending();
+	void ApplyTargetActions(FName TargetName, FStrandsTargetActions& Target, float DeltaSeconds, double Now);
+	bool HasPendingTargetWork() const;
+
+	// moveTo: kicks the async navmesh query and receives its result
+	void StartMoveTo(const FStrandsParsedCommand& Command);
+	void OnMoveToPathReady(FName TargetName, uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path);
+	APawn* ResolveTargetPawn(FName TargetName, const FStrandsTargetActions& Target) const;
+
+	// Writes {"ack":Seq,"ts":...} back to the issuing client. No-op for Seq 0.
+	void SendAck(uint64 ClientId, uint32 Seq);
+
+	// Latency instrumentation
+	void RecordCommandLatency(const FStrandsParsedCommand& Command, double Now);
+	FString BuildStatsJson() const;
+
+	// Applies replayed commands whose timestamps have come due
+	void TickReplay(double Now);
+
+	// Screenshot stream requests waiting on the next backbuffer capture
+	struct FStrandsScreenshotStreamRequest
+	{
+		uint64 ClientId = 0;
+		int32 Quality = 85;
+	};
+
+	// Screenshot streaming
+	void RequestScreenshotStream(uint64 ClientId, int32 Quality);
+	void OnScreenshotCaptured(int32 Width, int32 Height, const TArray<FColor>& Colors);
+
+	// Low-res agent vision: renders the player view through a pooled scene
+	// capture at the requested resolution with bloom/DoF/motion blur disabled,
+	// so vision-model inputs skip the full-res backbuffer capture entirely.
+	bool CaptureAgentVision(int32 Width, int32 Height, TArray<FColor>& OutPixels);
+
+	// Shared JPEG compress-and-reply path for backbuffer and vision captures
+	void CompressAndSendJpegAsync(TSharedRef<TArray<FColor>, ESPMode::ThreadSafe> Pixels, int32 Width, int32 Height, TArray<FStrandsScreenshotStreamRequest> Requests);
+
+	// Transport-aware response routing: TCP clients go through the receiver's
+	// outbound queue, WebSocket clients send on the game thread.
+	void SendToClientTransport(uint64 ClientId, TArray<uint8>&& Bytes);
+
+	// WebSocket transport (optional)
+	bool StartWebSocketServer();
+	void OnWebSocketClientConnected(INetworkingWebSocket* Socket);
 
-	// State export
+	// State export. The state schema is streamed directly into a UTF-8 builder,
+	// so a state request performs no intermediate FJsonObject tree allocations.
+	void UpdateSharedMemoryState();
 	void WriteWorldStateToFile(const FString& OutPath);
-	void BuildWorldState(TSharedRef<FJsonObject>& Out, UWorld* World) const;
+	void BuildWorldState(FAnsiStringBuilderBase& Out, UWorld* World) const;
+
+	// Builds and serializes the state snapshot at most once per frame into the
+	// pooled builder; repeat state commands within the same frame reuse the
+	// cached bytes. The returned view is valid until the next rebuild.
+	FAnsiStringView GetOrBuildStateJson();
+
+	// Issues the obstacle probes as async traces; results land in LatestTraces
+	// before the next snapshot is built.
+	void KickStateTraces(UWorld* World);
+
+	// Push-based state subscriptions: per-subscriber delta pushes driven from
+	// Tick, using the cached previous snapshot instead of re-serializing the
+	// full state every interval.
+	void TickSubscriptions(double Now);
+	void BuildStateSnapshot(FStrandsStateSnapshot& Out) const;
 
 private:
 	TUniquePtr<FTcpListener> Listener;
-	TArray<FStrandsClientState> Clients;
+
+	// Listen socket owned by the subsystem (not the listener) so port binding
+	// can be probed across the configured range before the listener spins up.
+	FSocket* ListenSocket = nullptr;
+	int32 BoundPort = 0;
+	int32 BoundWebSocketPort = 0;
+
+	// Discovery file advertising the bound port(s); deleted on StopServer
+	FString PortDiscoveryFile;
+
+	// Shared so background compression tasks can hold a weak reference across
+	// server shutdown.
+	TSharedPtr<FStrandsSocketReceiver, ESPMode::ThreadSafe> Receiver;
 	FThreadSafeBool bRunning = false;
 
-	// Actions
-	TArray<FStrandsMoveAction> MoveActions;
-	TArray<FStrandsLookAction> LookActions;
-	int32 PendingJumpCount = 0;
-	TOptional<bool> PendingSprintEnabled;
+	// Optional WebSocket listener sharing the same command dispatch; lets the
+	// CloudFront frontend and Python agents connect without a relay process.
+	// WebSocket client IDs live in a separate space (high bit set).
+	TUniquePtr<IWebSocketServer> WebSocketServer;
+	TMap<uint64, INetworkingWebSocket*> WebSocketClients;
+	uint64 NextWebSocketClientId = 1;
+	static constexpr uint64 WebSocketClientIdBit = 1ull << 63;
+
+	TArray<FStrandsScreenshotStreamRequest> PendingStreamRequests;
+	FDelegateHandle ScreenshotCapturedHandle;
+
+	// Pooled scene capture actor for low-res agent vision; spawned on first
+	// use and kept alive (with its render target) across requests.
+	TWeakObjectPtr<ASceneCapture2D> AgentVisionActor;
+
+	// Obstacle probe slots filled by async traces
+	enum EStateTraceSlot : int32
+	{
+		Trace_ForwardKnee,
+		Trace_ForwardWaist,
+		Trace_ForwardChest,
+		Trace_LeftWaist,
+		Trace_RightWaist,
+		Trace_Down,
+		Trace_MAX
+	};
+	float LatestTraces[Trace_MAX] = { 0.f, 0.f, 0.f, 0.f, 0.f, 0.f };
+
+	// Per-frame snapshot cache: repeated state commands within one frame reuse
+	// the serialized bytes instead of re-tracing and re-serializing. The pooled
+	// builder keeps its allocation across frames, so steady-state state
+	// requests serialize with zero heap allocations.
+	TAnsiStringBuilder<4096> StateJsonBuilder;
+	uint64 CachedStateFrame = MAX_uint64;
+
+	// Optional shared-memory state channel, written in place each tick under a
+	// seqlock: readers retry while the sequence is odd or changes mid-read.
+	FPlatformMemory::FSharedMemoryRegion* StateSharedMemory = nullptr;
+	static constexpr SIZE_T StateSharedMemorySize = 64 * 1024;
+
+	// Per-target scheduled actions, keyed by routing target. NAME_None is the
+	// default target (first player pawn) and always exists once used.
+	TMap<FName, FStrandsTargetActions> Targets;
+
+	// Receive-to-apply latency rings, indexed by EStrandsCommandType
+	static constexpr int32 NumCommandLatencyRings = (int32)EStrandsCommandType::Stats + 1;
+	FStrandsCommandLatencyRing CommandLatency[NumCommandLatencyRings];
+
+	// True while a command backlog episode is in progress, so the backpressure
+	// notice goes out once per episode rather than every truncated tick.
+	bool bBackpressureNotified = false;
+
+	// Active state subscriptions, at most one per client; pruned wholesale once
+	// every transport is empty (pushes to a vanished client are dropped anyway).
+	TArray<FStrandsStateSubscription> Subscriptions;
+
+	// Active session recorder, shared with the receiver thread while attached
+	TSharedPtr<FStrandsSessionRecorder, ESPMode::ThreadSafe> SessionRecorder;
+
+	// Replay state: the loaded log is walked by offset as timestamps come due.
+	// Replayed commands use ClientId 0, so they never generate responses.
+	TArray<uint8> ReplayData;
+	int32 ReplayOffset = 0;
+	double ReplayStartTime = 0.0;
+	bool bReplaying = false;
+	bool bReplayAsFastAsPossible = false;
 
 	// Cached settings (snapshotted at Initialize)
 	bool bAutoStart = true;
 	int32 Port = 17777;
+	bool bUsePortRange = false;
+	int32 PortRangeSize = 8;
+	bool bEnableWebSocketServer = false;
+	int32 WebSocketPort = 17778;
+	bool bEnableSharedMemoryState = false;
+	FString SharedMemoryName = TEXT("StrandsAgentState");
 	float DefaultMoveDuration = 0.25f;
 	float DefaultLookDuration = 0.2f;
 	float NormalWalkSpeed = 600.0f;
@@ -19,7 +19,15 @@ public class StrandsInputServer : ModuleRules
             "Sockets",
             "Networking",
             "Json",
-            "JsonUtilities"
+            "JsonUtilities",
+            "ImageWrapper",
+            "WebSocketNetworking",
+            "NavigationSystem",
+
+            // Nearby-entity summaries in the agent state schema query the
+            // traffic obstacle grid
+            "MassEntity",
+            "MassTraffic"
         });
 
         // We are a runtime module
@@ -215,6 +215,54 @@ FAutoConsoleVariableRef CVarMassTrafficMaxDriverVisualizationLOD(
 	ECVF_Scalability
 	);
 
+float GMassTrafficDriverVisualizationMidUpdateDistance = 3000.0f;
+FAutoConsoleVariableRef CVarMassTrafficDriverVisualizationMidUpdateDistance(
+	TEXT("MassTraffic.DriverVisualizationMidUpdateDistance"),
+	GMassTrafficDriverVisualizationMidUpdateDistance,
+	TEXT("Drivers closer than this to the nearest viewer refresh their anim state every frame. Beyond it, updates are amortized at MassTraffic.DriverVisualizationMidUpdateInterval. (See all DRIVERBUCKET.)"),
+	ECVF_Scalability
+	);
+
+float GMassTrafficDriverVisualizationFarUpdateDistance = 8000.0f;
+FAutoConsoleVariableRef CVarMassTrafficDriverVisualizationFarUpdateDistance(
+	TEXT("MassTraffic.DriverVisualizationFarUpdateDistance"),
+	GMassTrafficDriverVisualizationFarUpdateDistance,
+	TEXT("Beyond this distance to the nearest viewer, driver anim state updates are amortized at MassTraffic.DriverVisualizationFarUpdateInterval. (See all DRIVERBUCKET.)"),
+	ECVF_Scalability
+	);
+
+int32 GMassTrafficDriverVisualizationMidUpdateInterval = 4;
+FAutoConsoleVariableRef CVarMassTrafficDriverVisualizationMidUpdateInterval(
+	TEXT("MassTraffic.DriverVisualizationMidUpdateInterval"),
+	GMassTrafficDriverVisualizationMidUpdateInterval,
+	TEXT("Refresh driver anim state every Nth frame in the mid distance band. 1 = every frame. (See all DRIVERBUCKET.)"),
+	ECVF_Scalability
+	);
+
+int32 GMassTrafficDriverVisualizationFarUpdateInterval = 16;
+FAutoConsoleVariableRef CVarMassTrafficDriverVisualizationFarUpdateInterval(
+	TEXT("MassTraffic.DriverVisualizationFarUpdateInterval"),
+	GMassTrafficDriverVisualizationFarUpdateInterval,
+	TEXT("Refresh driver anim state every Nth frame in the far distance band. 1 = every frame. (See all DRIVERBUCKET.)"),
+	ECVF_Scalability
+	);
+
+float GMassTrafficLightVisualizationFarUpdateDistance = 15000.0f;
+FAutoConsoleVariableRef CVarMassTrafficLightVisualizationFarUpdateDistance(
+	TEXT("MassTraffic.LightVisualizationFarUpdateDistance"),
+	GMassTrafficLightVisualizationFarUpdateDistance,
+	TEXT("Distance from the closest viewer beyond which intersection traffic light visuals refresh at MassTraffic.LightVisualizationFarUpdateInterval instead of every frame. (See all LIGHTVISLOD.)"),
+	ECVF_Scalability
+	);
+
+float GMassTrafficLightVisualizationFarUpdateInterval = 1.0f;
+FAutoConsoleVariableRef CVarMassTrafficLightVisualizationFarUpdateInterval(
+	TEXT("MassTraffic.LightVisualizationFarUpdateInterval"),
+	GMassTrafficLightVisualizationFarUpdateInterval,
+	TEXT("Seconds between traffic light visual refreshes for intersections in the far distance band. The frozen packed state keeps being submitted in between. (See all LIGHTVISLOD.)"),
+	ECVF_Scalability
+	);
+
 int32 GMassTrafficOverseer = 1;
 FAutoConsoleVariableRef CVarMassTrafficOverseer(
 	TEXT("MassTraffic.Overseer"),
@@ -233,6 +281,55 @@ FAutoConsoleVariableRef CVarMassTrafficRepairDamage(
 	ECVF_Cheat
 	);
 
+float GMassTrafficRepairDamageTimeBudget = 0.05f;
+FAutoConsoleVariableRef CVarMassTrafficRepairDamageTimeBudget(
+	TEXT("MassTraffic.RepairDamageTimeBudget"),
+	GMassTrafficRepairDamageTimeBudget,
+	TEXT("Per-frame time budget, in milliseconds, for processing the damaged vehicle queue. Vehicles left over when the budget runs out stay queued for the next frame. <= 0 = unlimited. (See all DAMAGEQUEUE.)"),
+	ECVF_Scalability
+	);
+
+int32 GMassTrafficVisualizationCommandBufferSize = 65536;
+FAutoConsoleVariableRef CVarMassTrafficVisualizationCommandBufferSize(
+	TEXT("MassTraffic.VisualizationCommandBufferSize"),
+	GMassTrafficVisualizationCommandBufferSize,
+	TEXT("Capacity of the deferred visualization command buffer the vehicle visualization processors fill each frame. Commands pushed past capacity are dropped for that frame with a warning. (See all VISBUFFER.)"),
+	ECVF_Scalability
+	);
+
+int32 GMassTrafficRecycleBudgetMicroseconds = 500;
+FAutoConsoleVariableRef CVarMassTrafficRecycleBudgetMicroseconds(
+	TEXT("MassTraffic.RecycleBudgetMicroseconds"),
+	GMassTrafficRecycleBudgetMicroseconds,
+	TEXT("Per-frame time budget, in microseconds, for recycling vehicles overlapping players. Candidates found by the overlap detection pass are validated and recycled across frames within this budget. <= 0 = unlimited. (See all RECYCLESTAGED.)"),
+	ECVF_Scalability
+	);
+
+float GMassTrafficReplicationKeyframeInterval = 2.0f;
+FAutoConsoleVariableRef CVarMassTrafficReplicationKeyframeInterval(
+	TEXT("MassTraffic.ReplicationKeyframeInterval"),
+	GMassTrafficReplicationKeyframeInterval,
+	TEXT("Seconds between full position + yaw keyframe updates per replicated traffic vehicle. Between keyframes only the compact quantized lane-space state is sent. (See all TRAFFICDELTA.)"),
+	ECVF_Default
+	);
+
+float GMassTrafficReplicationInterestRadius = 0.0f;
+FAutoConsoleVariableRef CVarMassTrafficReplicationInterestRadius(
+	TEXT("MassTraffic.ReplicationInterestRadius"),
+	GMassTrafficReplicationInterestRadius,
+	TEXT("When > 0, each client connection only receives traffic vehicle state updates for vehicles within this radius (in cm) of its view position, via a per-connection grid of interest cells. Vehicles outside a client's interest cells are still added/removed by replication LOD but stop receiving per-frame state. (See all TRAFFICINTEREST.)\n")
+	TEXT("0 = Replicate state to all connections regardless of distance (default.)"),
+	ECVF_Default
+	);
+
+float GMassTrafficReplicationInterestCellSize = 10000.0f;
+FAutoConsoleVariableRef CVarMassTrafficReplicationInterestCellSize(
+	TEXT("MassTraffic.ReplicationInterestCellSize"),
+	GMassTrafficReplicationInterestCellSize,
+	TEXT("Cell size, in cm, of the per-connection traffic replication interest grid. Coarser cells mean cheaper subscription rebuilds but a looser interest boundary. (See all TRAFFICINTEREST.)"),
+	ECVF_Default
+	);
+
 float GMassTrafficNumTrafficVehiclesScale = 1.0f;
 FAutoConsoleVariableRef CVarMassTrafficNumTrafficVehiclesScale(
 	TEXT("MassTraffic.NumTrafficVehiclesScale"),
@@ -289,6 +386,38 @@ FAutoConsoleVariableRef CVarMassTrafficControlInputWakeTolerance(
 	ECVF_Scalability
 	);
 
+float GMassTrafficIntersectionSleepUpdateInterval = 0.25f;
+FAutoConsoleVariableRef CVarMassTrafficIntersectionSleepUpdateInterval(
+	TEXT("MassTraffic.IntersectionSleepUpdateInterval"),
+	GMassTrafficIntersectionSleepUpdateInterval,
+	TEXT("How often in seconds intersections deep in a stable period are revisited by the update intersections processor. Intersections near a period transition always update every frame. 0 updates every intersection every frame. (See all INTERSLEEP.)\n"),
+	ECVF_Scalability
+	);
+
+int32 GMassTrafficCruiseSleepEnabled = 1;
+FAutoConsoleVariableRef CVarMassTrafficCruiseSleepEnabled(
+	TEXT("MassTraffic.CruiseSleepEnabled"),
+	GMassTrafficCruiseSleepEnabled,
+	TEXT("Whether physics vehicles cruising at a converged steady state can sleep their suspension & wheel integration and replay a cached kinematic solution instead. (See all CRUISESLEEP.)\n"),
+	ECVF_Scalability
+	);
+
+float GMassTrafficCruiseSleepSpeedTolerance = 20.0f;
+FAutoConsoleVariableRef CVarMassTrafficCruiseSleepSpeedTolerance(
+	TEXT("MassTraffic.CruiseSleepSpeedTolerance"),
+	GMassTrafficCruiseSleepSpeedTolerance,
+	TEXT("Maximum speed variation in cm/s a vehicle may show between frames and still be considered converged for cruise sleeping.\n"),
+	ECVF_Scalability
+	);
+
+float GMassTrafficCruiseSleepChassisTolerance = 2.0f;
+FAutoConsoleVariableRef CVarMassTrafficCruiseSleepChassisTolerance(
+	TEXT("MassTraffic.CruiseSleepChassisTolerance"),
+	GMassTrafficCruiseSleepChassisTolerance,
+	TEXT("Maximum lane-space chassis movement in cm between frames for the suspension to be considered settled for cruise sleeping.\n"),
+	ECVF_Scalability
+	);
+
 float GMassTrafficDebugForceScaling = 0.0006f;
 FAutoConsoleVariableRef CVarMassTrafficDebugForceScaling(
 	TEXT("MassTraffic.DebugForceScaling"),
@@ -337,6 +466,55 @@ FAutoConsoleVariableRef CVarMassTrafficValidation(
 	ECVF_Cheat
 	);
 
+float GMassTrafficNextVehicleRescanInterval = 0.0f;
+FAutoConsoleVariableRef CVarMassTrafficNextVehicleRescanInterval(
+	TEXT("MassTraffic.NextVehicleRescanInterval"),
+	GMassTrafficNextVehicleRescanInterval,
+	TEXT("NextVehicle chains are normally maintained incrementally as vehicles transition lanes. When > 0, the full find-next-vehicle scan is additionally re-run every N seconds as a repair fallback for chains corrupted by missed transitions.\n")
+	TEXT("0 = Incremental maintenance only (default.)\n")
+	TEXT("N = Rebuild all chains from scratch every N seconds"),
+	ECVF_Cheat
+	);
+
+int32 GMassTrafficValidationSampleInterval = 1;
+FAutoConsoleVariableRef CVarMassTrafficValidationSampleInterval(
+	TEXT("MassTraffic.ValidationSampleInterval"),
+	GMassTrafficValidationSampleInterval,
+	TEXT("When > 1, the validation processor checks a rotating 1/N slice of vehicles per frame, so every vehicle is still validated once every N frames. Use MassTraffic.ValidateAllNow to force a one-frame full check. (See all VALIDATIONSLICE.)\n")
+	TEXT("1 = Check every vehicle every frame (default.)\n")
+	TEXT("N = Check 1/N of vehicles per frame"),
+	ECVF_Cheat
+	);
+
+int32 GMassTrafficParallelVehicleControl = 0;
+FAutoConsoleVariableRef CVarMassTrafficParallelVehicleControl(
+	TEXT("MassTraffic.ParallelVehicleControl"),
+	GMassTrafficParallelVehicleControl,
+	TEXT("Whether vehicle control entity chunks may execute on worker threads.\n")
+	TEXT("0 = Off (default.)\n")
+	TEXT("1 = Process vehicle control chunks in parallel, deferring lane data writes to the end of the processor"),
+	ECVF_Scalability
+	);
+
+int32 GMassTrafficParallelVehicleControlGrainSize = 1024;
+FAutoConsoleVariableRef CVarMassTrafficParallelVehicleControlGrainSize(
+	TEXT("MassTraffic.ParallelVehicleControlGrainSize"),
+	GMassTrafficParallelVehicleControlGrainSize,
+	TEXT("Minimum number of matching vehicles before parallel vehicle control kicks in; below this the serial path is cheaper than the task spawn overhead."),
+	ECVF_Scalability
+	);
+
+int32 GMassTrafficOffLODCheapVehicleControl = 1;
+FAutoConsoleVariableRef CVarMassTrafficOffLODCheapVehicleControl(
+	TEXT("MassTraffic.OffLODCheapVehicleControl"),
+	GMassTrafficOffLODCheapVehicleControl,
+	TEXT("Whether off-LOD vehicles skip the Perlin noise evaluation used for lateral drift and speed limit\n")
+	TEXT("variance, and just drive their lanes timetable-style at their randomly varied speed limit.\n")
+	TEXT("0 = Off, off-LOD vehicles run full simple vehicle control.\n")
+	TEXT("1 = On (default.)"),
+	ECVF_Scalability
+	);
+
 float GMassTrafficSpeedLimitScale = 1.0f;
 FAutoConsoleVariableRef CVarMassTrafficSpeedLimitScale(
 	TEXT("MassTraffic.SpeedLimitScale"),
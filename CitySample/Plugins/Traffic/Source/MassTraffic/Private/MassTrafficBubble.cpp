@@ -5,6 +5,8 @@
 #include "MassSpawnerTypes.h"
 #include "MassExecutionContext.h"
 #include "AIHelpers.h"
+#include "ZoneGraphSubsystem.h"
+#include "ZoneGraphQuery.h"
 
 #if UE_REPLICATION_COMPILE_CLIENT_CODE
 void FTrafficClientBubbleHandler::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
@@ -50,10 +52,70 @@ void FTrafficClientBubbleHandler::PostReplicatedChange(const TArrayView<int32> C
 #if UE_REPLICATION_COMPILE_CLIENT_CODE
 void FTrafficClientBubbleHandler::PostReplicatedChangeEntity(const FMassEntityView& EntityView, const FReplicatedTrafficAgent& Item)
 {
+	// Prefer the compact lane-space state when it can be resolved against the local zone graph.
+	// Keyframes still arrive as full position + yaw and are applied below as before, which also
+	// covers clients whose zone graph data hasn't streamed in yet. (See all TRAFFICDELTA.)
+	const FReplicatedTrafficVehicleDeltaData& DeltaData = Item.GetDeltaData();
+	if (DeltaData.LaneHandle.IsValid())
+	{
+		if (const UZoneGraphSubsystem* ZoneGraphSubsystem = UWorld::GetSubsystem<UZoneGraphSubsystem>(Serializer->GetWorld()))
+		{
+			if (const FZoneGraphStorage* ZoneGraphStorage = ZoneGraphSubsystem->GetZoneGraphStorage(DeltaData.LaneHandle.DataHandle))
+			{
+				float LaneLength = 0.0f;
+				UE::ZoneGraph::Query::GetLaneLength(*ZoneGraphStorage, DeltaData.LaneHandle.Index, LaneLength);
+
+				FZoneGraphLaneLocation LaneLocation;
+				if (UE::ZoneGraph::Query::CalculateLocationAlongLane(*ZoneGraphStorage, DeltaData.LaneHandle.Index, DeltaData.GetDistanceAlongLane(LaneLength), LaneLocation))
+				{
+					FReplicatedAgentPositionYawData PositionYawData;
+					PositionYawData.SetPosition(LaneLocation.Position);
+					PositionYawData.SetYaw(static_cast<float>(FMath::Atan2(LaneLocation.Direction.Y, LaneLocation.Direction.X)));
+
+					TransformHandler.SetModifiedEntityData(EntityView, PositionYawData);
+					return;
+				}
+			}
+		}
+	}
+
 	TransformHandler.SetModifiedEntityData(EntityView, Item.GetReplicatedPositionYawData());
 }
 #endif // UE_REPLICATION_COMPILE_CLIENT_CODE
 
+#if UE_REPLICATION_COMPILE_SERVER_CODE
+bool FTrafficClientBubbleHandler::SetDeltaData(const FMassReplicatedAgentHandle Handle, const FReplicatedTrafficVehicleDeltaData& DeltaData)
+{
+	const FMassAgentLookupData& LookupData = AgentLookupArray[Handle.GetIndex()];
+	FTrafficFastArrayItem& Item = (*Agents)[LookupData.AgentsIdx];
+
+	// Dirty tracking - unchanged agents don't get their replication key bumped, so the fast
+	// array serializes nothing for them. (See all TRAFFICDELTA.)
+	if (Item.Agent.GetDeltaData() == DeltaData)
+	{
+		return false;
+	}
+
+	Item.Agent.GetDeltaDataMutable() = DeltaData;
+	Serializer->MarkItemDirty(Item);
+	return true;
+}
+
+bool FTrafficClientBubbleHandler::ShouldKeyframe(const FMassReplicatedAgentHandle Handle, const double Time, const double KeyframeInterval)
+{
+	const FMassAgentLookupData& LookupData = AgentLookupArray[Handle.GetIndex()];
+	FTrafficFastArrayItem& Item = (*Agents)[LookupData.AgentsIdx];
+
+	if (Time - Item.LastKeyframeTime < KeyframeInterval)
+	{
+		return false;
+	}
+
+	Item.LastKeyframeTime = Time;
+	return true;
+}
+#endif // UE_REPLICATION_COMPILE_SERVER_CODE
+
 #if UE_ALLOW_DEBUG_REPLICATION
 void FTrafficClientBubbleHandler::DebugValidateBubbleOnServer()
 {
@@ -253,7 +253,11 @@ void UMassTrafficChooseNextLaneProcessor::Execute(FMassEntityManager& EntityMana
 				VehicleControlFragment.NextLane = CurrentLane.NextLanes[0];
 				check(VehicleControlFragment.NextLane);
 				VehicleControlFragment.ChooseNextLanePreference = EMassTrafficChooseNextLanePreference::KeepCurrentNextLane;
-			
+
+				// A lane transition is coming up - wake any cruise-sleeping simple physics so the
+				// suspension is live for it. (See all CRUISESLEEP.)
+				VehicleControlFragment.bWakePhysicsFromCruiseSleep = true;
+
 				++VehicleControlFragment.NextLane->NumVehiclesApproachingLane;
 
 				VehicleLightsFragment.bLeftTurnSignalLights = VehicleControlFragment.NextLane->bTurnsLeft;
@@ -282,90 +286,64 @@ void UMassTrafficChooseNextLaneProcessor::Execute(FMassEntityManager& EntityMana
 			float BestNextLaneDensity = TNumericLimits<float>::Max();
 
 		
-			// This lane might be have intersection lanes as next lanes, so lets run through just those and asses the
-			// lane they are connected to.
-			for (FZoneGraphTrafficLaneData* NextLane : CurrentLane.NextLanes)
+			// Score the candidates from the flat per-lane successor table precomputed in
+			// BuildLaneData(), instead of chasing NextLanes pointers through zone graph storage.
+			// Intersection candidates have already had their single post-intersection exit lane
+			// resolved into the record's scored lane. (See all LANESUCCESSOR.)
+			const FMassTrafficZoneGraphData* TrafficZoneGraphData = MassTrafficSubsystem.GetTrafficZoneGraphData(LaneLocationFragment.LaneHandle.DataHandle);
+			check(TrafficZoneGraphData);
+			for (const FMassTrafficLaneSuccessor& Successor : TrafficZoneGraphData->GetLaneSuccessors(CurrentLane.LaneHandle.Index))
 			{
 				// Check trunk lane restrictions 
-				if (!UE::MassTraffic::TrunkVehicleLaneCheck(NextLane, VehicleControlFragment))
+				if (VehicleControlFragment.bRestrictedToTrunkLanesOnly && !Successor.bIsTrunkLane)
 				{
 					continue;
 				}
 
-				if (!NextLane->ConstData.bIsIntersectionLane)
+				// Malformed intersection candidates (not exactly one exit lane) have no scored lane.
+				// BuildLaneData() already warned about them.
+				if (Successor.ScoredLaneIndex == INDEX_NONE)
 				{
-					// This is not an intersection lane.
-				
-					// We want a different lane than this one.
-					if (VehicleControlFragment.ChooseNextLanePreference == EMassTrafficChooseNextLanePreference::ChooseDifferentNextLane &&
-						VehicleControlFragment.NextLane == NextLane)
-					{
-						continue;
-					}
-				
-					// Consider this lane if it has enough space -or- if it's too short (because if they're all too
-					// short, we still have to pick one.)
-					const bool bLaneHasEnoughSpaceForVehicle = (NextLane->SpaceAvailable >= SpaceTakenByVehicleOnLane);
-					const bool bLaneIsTooShortForVehicle = NextLane->Length < SpaceTakenByVehicleOnLane;
-					if (!bLaneHasEnoughSpaceForVehicle && !bLaneIsTooShortForVehicle)
-					{
-						continue;
-					}
-				
-					// Does this lane have more space than the others? If so, remember it.
-					const float NextLaneDensity =
-						DensityToUseForChoosingLane == ChooseLaneByDownstreamFlowDensity ?
-						NextLane->GetDownstreamFlowDensity() :
-						NextLane->FunctionalDensity();
-					if (NextLaneDensity <= BestNextLaneDensity)
-					{
-						BestNextLaneDensity = NextLaneDensity;
-						BestNextTrafficLaneData = NextLane;
-					}
+					continue;
 				}
-				else // This is an intersection lane.
+
+				// We want a different lane than this one.
+				if (VehicleControlFragment.ChooseNextLanePreference == EMassTrafficChooseNextLanePreference::ChooseDifferentNextLane &&
+					VehicleControlFragment.NextLane == Successor.NextLane)
 				{
-					// Intersection lanes must have exactly one next lane - at the intersection exit.
-					if (NextLane->NextLanes.Num() != 1)
-					{
-						UE_LOG(LogMassTraffic, Warning, TEXT("%s - Lane %s is an intersection lane, that should have only one next lane, but it has %d."),
-							ANSI_TO_TCHAR(__FUNCTION__), *NextLane->LaneHandle.ToString(), NextLane->NextLanes.Num());
+					continue;
+				}
 
-						continue;
-					}
-				
-					// So this is the lane *after* the intersection lane and are actually what we are interested in.
-					const FZoneGraphTrafficLaneData* PostIntersectionTrafficLaneData = NextLane->NextLanes[0];
+				// Score the scored lane (the post-intersection exit lane for intersection candidates,
+				// otherwise the candidate itself) with its frame-start snapshot when available, so the
+				// choice doesn't depend on which other lane writers have already run this frame.
+				// (See all LANESNAPSHOT.)
+				const FZoneGraphLaneHandle ScoredLaneHandle(Successor.ScoredLaneIndex, LaneLocationFragment.LaneHandle.DataHandle);
+				const FMassTrafficLaneStateSnapshot* ScoredLaneSnapshot = MassTrafficSubsystem.GetLaneStateSnapshot(ScoredLaneHandle);
+				const FZoneGraphTrafficLaneData* LiveScoredLane = TrafficZoneGraphData->GetTrafficLaneData(Successor.ScoredLaneIndex);
+
+				// Consider this lane if it has enough space -or- if it's too short (because if they're all too
+				// short, we still have to pick one.)
+				const float ScoredLaneSpaceAvailable = ScoredLaneSnapshot ? ScoredLaneSnapshot->SpaceAvailable : LiveScoredLane->SpaceAvailable;
+				const bool bLaneHasEnoughSpaceForVehicle = (ScoredLaneSpaceAvailable >= SpaceTakenByVehicleOnLane);
+				const bool bLaneIsTooShortForVehicle = Successor.ScoredLaneLength < SpaceTakenByVehicleOnLane;
+				if (!bLaneHasEnoughSpaceForVehicle && !bLaneIsTooShortForVehicle)
+				{
+					continue;
+				}
 
-					// We want a different lane than this one.
-					if (VehicleControlFragment.ChooseNextLanePreference == EMassTrafficChooseNextLanePreference::ChooseDifferentNextLane &&
-						VehicleControlFragment.NextLane == NextLane)
-					{
-						continue;
-					}
-				
-					// Consider this lane if it has enough space -or- if it's too short (because if they're all too
-					// short, we still have to pick one.)
-					const bool bLaneHasEnoughSpaceForVehicle = (PostIntersectionTrafficLaneData->SpaceAvailable >= SpaceTakenByVehicleOnLane);
-					const bool bLaneIsTooShortForVehicle = PostIntersectionTrafficLaneData->Length < SpaceTakenByVehicleOnLane;
-					if (!bLaneHasEnoughSpaceForVehicle && !bLaneIsTooShortForVehicle)
-					{
-						continue;
-					}
-				
-					// Does this lane have more space than the others? If so, remember it.
-					const float PostIntersectionLaneDensity =	
-						DensityToUseForChoosingLane == ChooseLaneByDownstreamFlowDensity ?
-						PostIntersectionTrafficLaneData->GetDownstreamFlowDensity() :
-						PostIntersectionTrafficLaneData->FunctionalDensity();					
-					if (PostIntersectionLaneDensity <= BestNextLaneDensity)
-					{
-						// We are searching the lanes after the intersection so we know which
-						// intersection lane to take. That's why NextLane is being set to
-						// IntersectionTrafficLaneData and not PostIntersectionTrafficLaneData.
-						BestNextLaneDensity = PostIntersectionLaneDensity;
-						BestNextTrafficLaneData = NextLane;
-					}
+				// Does this lane have more space than the others? If so, remember it.
+				// For intersection candidates we are scoring the lane *after* the intersection so we
+				// know which intersection lane to take. That's why the candidate lane is remembered
+				// and not the scored lane.
+				const float ScoredLaneDensity =
+					DensityToUseForChoosingLane == ChooseLaneByDownstreamFlowDensity ?
+					(ScoredLaneSnapshot ? ScoredLaneSnapshot->DownstreamFlowDensity : LiveScoredLane->GetDownstreamFlowDensity()) :
+					(ScoredLaneSnapshot ? ScoredLaneSnapshot->FunctionalDensity : LiveScoredLane->FunctionalDensity());
+				if (ScoredLaneDensity <= BestNextLaneDensity)
+				{
+					BestNextLaneDensity = ScoredLaneDensity;
+					BestNextTrafficLaneData = Successor.NextLane;
 				}
 			}
 
@@ -391,9 +369,13 @@ void UMassTrafficChooseNextLaneProcessor::Execute(FMassEntityManager& EntityMana
 		
 			// Did we pick a new lane?
 			if (VehicleControlFragment.NextLane)
-			{				
+			{
 				check(VehicleControlFragment.ChooseNextLanePreference == EMassTrafficChooseNextLanePreference::KeepCurrentNextLane);
-			
+
+				// A lane transition is coming up - wake any cruise-sleeping simple physics so the
+				// suspension is live for it. (See all CRUISESLEEP.)
+				VehicleControlFragment.bWakePhysicsFromCruiseSleep = true;
+
 				// Add ourselves to the number of cars waiting to get onto that lane.
 				++VehicleControlFragment.NextLane->NumVehiclesApproachingLane;
 
@@ -2,15 +2,18 @@
 
 #include "MassTrafficDamageRepairProcessor.h"
 #include "MassTraffic.h"
+#include "MassTrafficSubsystem.h"
 #include "MassTrafficVehicleInterface.h"
 #include "MassExecutionContext.h"
 #include "GameFramework/PlayerController.h"
 #include "DrawDebugHelpers.h"
 #include "MassActorSubsystem.h"
+#include "MassEntityView.h"
+#include "MassLODFragments.h"
+#include "MassRepresentationFragments.h"
 
 
 UMassTrafficDamageRepairProcessor::UMassTrafficDamageRepairProcessor()
-	: DamagedVehicleEntityQuery(*this)
 {
 	bAutoRegisterWithProcessingPhases = true;
 	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::Client | EProcessorExecutionFlags::Standalone);
@@ -20,15 +23,9 @@ UMassTrafficDamageRepairProcessor::UMassTrafficDamageRepairProcessor()
 
 void UMassTrafficDamageRepairProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
 {
-	DamagedVehicleEntityQuery.AddTagRequirement<FMassVisibilityCulledByDistanceTag>(EMassFragmentPresence::None);
-
-	// Traffic vehicles and parked cars that have been disturbed can be damages/repaired.
-	DamagedVehicleEntityQuery.AddTagRequirement<FMassTrafficVehicleTag>(EMassFragmentPresence::Any);
-	DamagedVehicleEntityQuery.AddTagRequirement<FMassTrafficDisturbedVehicleTag>(EMassFragmentPresence::Any);
-
-	DamagedVehicleEntityQuery.AddRequirement<FMassActorFragment>(EMassFragmentAccess::ReadWrite);
-	DamagedVehicleEntityQuery.AddRequirement<FMassTrafficVehicleDamageFragment>(EMassFragmentAccess::ReadWrite);
-	DamagedVehicleEntityQuery.AddRequirement<FMassRepresentationLODFragment>(EMassFragmentAccess::ReadWrite);
+	// No entity query - damaged vehicles are drained from the subsystem's queue, fed by the post
+	// physics actor sync processors. (See all DAMAGEQUEUE.)
+	ProcessorRequirements.AddSubsystemRequirement<UMassTrafficSubsystem>(EMassFragmentAccess::ReadWrite);
 }
 
 void UMassTrafficDamageRepairProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
@@ -38,118 +35,158 @@ void UMassTrafficDamageRepairProcessor::Execute(FMassEntityManager& EntityManage
 	{
 		return;
 	}
-	
-	// Block LOD changes to high LOD damaged vehicles, while we repair damage
-	DamagedVehicleEntityQuery.ForEachEntityChunk(Context, [](FMassExecutionContext& Context)
+
+	// Drain the damaged vehicle queue, fed by the post physics actor sync processors, instead of
+	// scanning every vehicle archetype for the rare vehicle with damage. When no damage has been
+	// reported, this processor does no entity iteration at all. Vehicles still repairing get
+	// re-reported each frame while their actor still has damage, which sustains the High LOD hold
+	// below. (See all DAMAGEQUEUE.)
+	UMassTrafficSubsystem& MassTrafficSubsystem = Context.GetMutableSubsystemChecked<UMassTrafficSubsystem>();
+	TArray<FMassEntityHandle>& DamagedVehicles = MassTrafficSubsystem.GetMutableDamagedVehiclesPendingRepair();
+	if (DamagedVehicles.IsEmpty())
 	{
-		const TArrayView<FMassActorFragment> ActorFragments = Context.GetMutableFragmentView<FMassActorFragment>();
-		const TArrayView<FMassTrafficVehicleDamageFragment> VehicleDamageFragments = Context.GetMutableFragmentView<FMassTrafficVehicleDamageFragment>();
-		const TArrayView<FMassRepresentationLODFragment> RepresentationLODFragments = Context.GetMutableFragmentView<FMassRepresentationLODFragment>();
+		return;
+	}
+
+	const double StartTimeSeconds = FPlatformTime::Seconds();
+	const double TimeBudgetSeconds = GMassTrafficRepairDamageTimeBudget * 0.001;
 
-		const bool bIsDisturbedVehicle = Context.DoesArchetypeHaveTag<FMassTrafficDisturbedVehicleTag>();
+	int32 NumConsumed = 0;
+	for (; NumConsumed < DamagedVehicles.Num(); ++NumConsumed)
+	{
+		// Always make progress on at least one vehicle per frame, however small the budget.
+		if (TimeBudgetSeconds > 0.0 && NumConsumed > 0 && FPlatformTime::Seconds() - StartTimeSeconds >= TimeBudgetSeconds)
+		{
+			break;
+		}
 
-		for (FMassExecutionContext::FEntityIterator EntityIt = Context.CreateEntityIterator(); EntityIt; ++EntityIt)
+		const FMassEntityHandle Entity = DamagedVehicles[NumConsumed];
+		if (!EntityManager.IsEntityValid(Entity))
 		{
-			// Has damage?
-			FMassTrafficVehicleDamageFragment& VehicleDamageFragment = VehicleDamageFragments[EntityIt];
-			if (VehicleDamageFragment.VehicleDamageState > EMassTrafficVehicleDamageState::None)
+			continue;
+		}
+
+		const FMassEntityView EntityView(EntityManager, Entity);
+
+		// Match the archetype filtering the old entity query performed - skip distance culled
+		// vehicles, and only consider traffic vehicles and parked cars that have been disturbed.
+		if (EntityView.HasTag<FMassVisibilityCulledByDistanceTag>())
+		{
+			continue;
+		}
+		const bool bIsDisturbedVehicle = EntityView.HasTag<FMassTrafficDisturbedVehicleTag>();
+		if (!bIsDisturbedVehicle && !EntityView.HasTag<FMassTrafficVehicleTag>())
+		{
+			continue;
+		}
+
+		FMassActorFragment* ActorFragment = EntityView.GetFragmentDataPtr<FMassActorFragment>();
+		FMassTrafficVehicleDamageFragment* VehicleDamageFragment = EntityView.GetFragmentDataPtr<FMassTrafficVehicleDamageFragment>();
+		FMassRepresentationLODFragment* RepresentationLODFragment = EntityView.GetFragmentDataPtr<FMassRepresentationLODFragment>();
+		if (!ActorFragment || !VehicleDamageFragment || !RepresentationLODFragment)
+		{
+			continue;
+		}
+
+		// Has damage? (May have changed since this vehicle was queued)
+		if (VehicleDamageFragment->VehicleDamageState > EMassTrafficVehicleDamageState::None)
+		{
+			if (AActor* Actor = ActorFragment->GetOwnedByMassMutable())
 			{
-				FMassActorFragment& ActorFragment = ActorFragments[EntityIt];
-				if (AActor* Actor = ActorFragment.GetOwnedByMassMutable())
+				// Trying to LOD change with damage?
+				if (RepresentationLODFragment->LOD != EMassLOD::High)
 				{
-					// Trying to LOD change with damage? 
-					FMassRepresentationLODFragment& RepresentationLODFragment = RepresentationLODFragments[EntityIt];
-					if (RepresentationLODFragment.LOD != EMassLOD::High)
+					// Start repairing damage?
+					if (VehicleDamageFragment->VehicleDamageState < EMassTrafficVehicleDamageState::Repairing)
 					{
-						// Start repairing damage?
-						if (VehicleDamageFragment.VehicleDamageState < EMassTrafficVehicleDamageState::Repairing)
+						// Try repairing
+						if (Actor->Implements<UMassTrafficVehicleInterface>())
 						{
-							// Try repairing
-							if (Actor->Implements<UMassTrafficVehicleInterface>())
+							Context.Defer().PushCommand<FMassDeferredSetCommand>([Actor](FMassEntityManager&)
 							{
-								Context.Defer().PushCommand<FMassDeferredSetCommand>([Actor](FMassEntityManager&)
-								{
-									// Ask Actor to attempt to repair the damage. It's expected to then return Repairing
-									// on the next call to IMassTrafficVehicleInterface::GetDamageState if this representation
-									// needs to be held, None if repairs succeeded and the switch can proceed, or Irreparable
-									// if the Actor couldn't be repaired and we can now release it. 
-									IMassTrafficVehicleInterface::Execute_RepairDamage(Actor);
-								});
-								
-								// Mark as repairing for below code to block representation switch 
-								VehicleDamageFragment.VehicleDamageState = EMassTrafficVehicleDamageState::Repairing;
-							}
-							else
-							{
-								// Actor can't repair, mark irreparable for below code to immediately release actor and recycle
-								// agent
-								VehicleDamageFragment.VehicleDamageState = EMassTrafficVehicleDamageState::Irreparable;
-							}
-						}
+								// Ask Actor to attempt to repair the damage. It's expected to then return Repairing
+								// on the next call to IMassTrafficVehicleInterface::GetDamageState if this representation
+								// needs to be held, None if repairs succeeded and the switch can proceed, or Irreparable
+								// if the Actor couldn't be repaired and we can now release it.
+								IMassTrafficVehicleInterface::Execute_RepairDamage(Actor);
+							});
 
-						// Repairing? (Note: May have just been set above)
-						if (VehicleDamageFragment.VehicleDamageState == EMassTrafficVehicleDamageState::Repairing)
+							// Mark as repairing for below code to block representation switch
+							VehicleDamageFragment->VehicleDamageState = EMassTrafficVehicleDamageState::Repairing;
+						}
+						else
 						{
-							// While repairing, force high LOD
-							RepresentationLODFragment.LOD = EMassLOD::High;
+							// Actor can't repair, mark irreparable for below code to immediately release actor and recycle
+							// agent
+							VehicleDamageFragment->VehicleDamageState = EMassTrafficVehicleDamageState::Irreparable;
 						}
 					}
 
-					// Irreparable?  (Note: May have just been set above)
-					if (VehicleDamageFragment.VehicleDamageState == EMassTrafficVehicleDamageState::Irreparable)
+					// Repairing? (Note: May have just been set above)
+					if (VehicleDamageFragment->VehicleDamageState == EMassTrafficVehicleDamageState::Repairing)
 					{
-						// Force LOD to None so the visualization processor releases this actor this frame
-						RepresentationLODFragment.LOD = EMassLOD::Off;
-						// If the entity is disturbed (a parked vehicle moved from it's spawn location)
-						// then we need to delete it. Otherwise we recycle the entity.
-						if (bIsDisturbedVehicle)
-						{
-							// Delete the entity.
-							Context.Defer().DestroyEntity(Context.GetEntity(EntityIt));
-						}
-						else
-						{
-							// Recycle the entity back into the system.
-							Context.Defer().SwapTags<FMassTrafficVehicleTag, FMassTrafficRecyclableVehicleTag>(Context.GetEntity(EntityIt));
-						}
+						// While repairing, force high LOD
+						RepresentationLODFragment->LOD = EMassLOD::High;
 					}
 				}
-				// No actor
-				else
+
+				// Irreparable?  (Note: May have just been set above)
+				if (VehicleDamageFragment->VehicleDamageState == EMassTrafficVehicleDamageState::Irreparable)
 				{
-					// Implicitly no damage
-					VehicleDamageFragment.VehicleDamageState = EMassTrafficVehicleDamageState::None;
+					// Force LOD to None so the visualization processor releases this actor this frame
+					RepresentationLODFragment->LOD = EMassLOD::Off;
+					// If the entity is disturbed (a parked vehicle moved from it's spawn location)
+					// then we need to delete it. Otherwise we recycle the entity.
+					if (bIsDisturbedVehicle)
+					{
+						// Delete the entity.
+						Context.Defer().DestroyEntity(Entity);
+					}
+					else
+					{
+						// Recycle the entity back into the system.
+						Context.Defer().SwapTags<FMassTrafficVehicleTag, FMassTrafficRecyclableVehicleTag>(Entity);
+					}
 				}
+			}
+			// No actor
+			else
+			{
+				// Implicitly no damage
+				VehicleDamageFragment->VehicleDamageState = EMassTrafficVehicleDamageState::None;
+			}
 
 #ifdef IF_MASSTRAFFIC_ENABLE_DEBUG
-				if (const AActor* Actor = ActorFragment.Get())
+			if (const AActor* Actor = ActorFragment->Get())
+			{
+				if (GMassTrafficDebugDestruction == 1)
 				{
-					if (GMassTrafficDebugDestruction == 1)
+					UWorld const * World = Actor->GetWorld();
+					const FVector Location = Actor->GetActorLocation() + FVector(-50.0f, 0.0f, 300.0f);
+					switch (VehicleDamageFragment->VehicleDamageState)
 					{
-						UWorld const * World = Actor->GetWorld();
-						const FVector Location = Actor->GetActorLocation() + FVector(-50.0f, 0.0f, 300.0f);
-						switch (VehicleDamageFragment.VehicleDamageState)
-						{
-							case EMassTrafficVehicleDamageState::Damaged:
-								DrawDebugCircle(World, Location, 40.0f, 16, FColor::Yellow);
-								break;
-							case EMassTrafficVehicleDamageState::Totaled:
-								DrawDebugCircle(World, Location, 40.0f, 16, FColor::Orange);
-								break;
-							case EMassTrafficVehicleDamageState::Repairing:
-								DrawDebugCircle(World, Location, 40.0f, 16, FColor::Blue);
-								break;
-							case EMassTrafficVehicleDamageState::Irreparable:
-								DrawDebugCircle(World, Location, 40.0f, 16, FColor::Red);
-								break;
-							default:
-								break;
-						}
+						case EMassTrafficVehicleDamageState::Damaged:
+							DrawDebugCircle(World, Location, 40.0f, 16, FColor::Yellow);
+							break;
+						case EMassTrafficVehicleDamageState::Totaled:
+							DrawDebugCircle(World, Location, 40.0f, 16, FColor::Orange);
+							break;
+						case EMassTrafficVehicleDamageState::Repairing:
+							DrawDebugCircle(World, Location, 40.0f, 16, FColor::Blue);
+							break;
+						case EMassTrafficVehicleDamageState::Irreparable:
+							DrawDebugCircle(World, Location, 40.0f, 16, FColor::Red);
+							break;
+						default:
+							break;
 					}
 				}
+			}
 #endif
 
-			}
 		}
-	});
-}
\ No newline at end of file
+	}
+
+	// Drop the consumed entries; anything past the budget stays queued for next frame.
+	DamagedVehicles.RemoveAt(0, NumConsumed);
+}
@@ -9,8 +9,10 @@
 
 #include "MassCommonFragments.h"
 #include "MassZoneGraphNavigationFragments.h"
+#include "Components/LineBatchComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Misc/ScopeLock.h"
 #include "VisualLogger/VisualLogger.h"
 #include "ZoneGraphTypes.h"
 #include "ZoneGraphQuery.h"
@@ -149,18 +151,127 @@ FVector GetPlayerViewLocation(const UWorld* World)
 
 	
 #if WITH_MASSTRAFFIC_DEBUG
-	
+
+// Caps the batched buffer so unflushed worlds (e.g. dedicated servers) and runaway debug modes
+// can't grow it unbounded. Extra primitives are dropped. (See all DEBUGBATCH.)
+constexpr int32 MaxDebugDrawPrimitivesPerFrame = 65536;
+
+FMassTrafficDebugDrawBuffer& GetDebugDrawBuffer()
+{
+	static FMassTrafficDebugDrawBuffer DebugDrawBuffer;
+	return DebugDrawBuffer;
+}
+
+void FMassTrafficDebugDrawBuffer::AddLine(const FVector& Start, const FVector& End, const FColor& Color, float Thickness)
+{
+	FScopeLock Lock(&Mutex);
+	if (Lines.Num() < MaxDebugDrawPrimitivesPerFrame)
+	{
+		Lines.Add({Start, End, Color, Thickness});
+	}
+}
+
+void FMassTrafficDebugDrawBuffer::AddDirectionalArrow(const FVector& Start, const FVector& End, float ArrowSize, const FColor& Color, float Thickness)
+{
+	const FVector Dir = (End - Start).GetSafeNormal();
+	FVector Up, Right;
+	Dir.FindBestAxisVectors(Up, Right);
+
+	AddLine(Start, End, Color, Thickness);
+	AddLine(End, End + ArrowSize * (Right - Dir), Color, Thickness);
+	AddLine(End, End - ArrowSize * (Right + Dir), Color, Thickness);
+}
+
+void FMassTrafficDebugDrawBuffer::AddPoint(const FVector& Location, float Size, const FColor& Color)
+{
+	FScopeLock Lock(&Mutex);
+	if (Points.Num() < MaxDebugDrawPrimitivesPerFrame)
+	{
+		Points.Add({Location, Size, Color});
+	}
+}
+
+void FMassTrafficDebugDrawBuffer::AddString(const FVector& Location, const FString& Text, const FColor& Color, float FontScale)
+{
+	FScopeLock Lock(&Mutex);
+	if (Strings.Num() < MaxDebugDrawPrimitivesPerFrame)
+	{
+		Strings.Add({Location, Text, Color, FontScale});
+	}
+}
+
+void FMassTrafficDebugDrawBuffer::Flush(UWorld* World)
+{
+	check(IsInGameThread());
+
+	TArray<FDebugLine> FrameLines;
+	TArray<FDebugPoint> FramePoints;
+	TArray<FDebugString> FrameStrings;
+	{
+		FScopeLock Lock(&Mutex);
+		FrameLines = MoveTemp(Lines);
+		FramePoints = MoveTemp(Points);
+		FrameStrings = MoveTemp(Strings);
+	}
+
+	if (!World || (FrameLines.IsEmpty() && FramePoints.IsEmpty() && FrameStrings.IsEmpty()))
+	{
+		return;
+	}
+
+#if ENABLE_DRAW_DEBUG
+	if (ULineBatchComponent* LineBatcher = World->GetLineBatcher(UWorld::ELineBatcherType::World))
+	{
+		// One render state update for the whole frame's lines, instead of one per DrawDebugLine
+		if (!FrameLines.IsEmpty())
+		{
+			TArray<FBatchedLine> BatchedLines;
+			BatchedLines.Reserve(FrameLines.Num());
+			for (const FDebugLine& Line : FrameLines)
+			{
+				BatchedLines.Emplace(Line.Start, Line.End, Line.Color.ReinterpretAsLinear(), /*LifeTime*/0.0f, Line.Thickness, SDPG_World);
+			}
+			LineBatcher->DrawLines(BatchedLines);
+		}
+
+		for (const FDebugPoint& Point : FramePoints)
+		{
+			LineBatcher->DrawPoint(Point.Location, Point.Color.ReinterpretAsLinear(), Point.Size, SDPG_World, /*LifeTime*/0.0f);
+		}
+	}
+
+	for (const FDebugString& String : FrameStrings)
+	{
+		DrawDebugString(World, String.Location, String.Text, nullptr, String.Color, /*Duration*/0.0f, /*bDrawShadow*/false, String.FontScale);
+	}
+#endif
+}
+
 void DrawDebugZLine(const UWorld* World, const FVector& Location, FColor Color, bool bPersist, float LifeTime, float Thickness, float Length)
 {
 	const FVector Z(0.0f, 0.0f, Length);
-	DrawDebugLine(World, Location, Location + Z, Color, bPersist, LifeTime, 0, Thickness);
+	if (bPersist || LifeTime > 0.0f)
+	{
+		DrawDebugLine(World, Location, Location + Z, Color, bPersist, LifeTime, 0, Thickness);
+	}
+	else
+	{
+		GetDebugDrawBuffer().AddLine(Location, Location + Z, Color, Thickness);
+	}
 }
 	
 void DrawDebugStringNearLocation(const UWorld* InWorld, FVector const& TextLocation, const FString& Text, class AActor* TestBaseActor, FColor const& TextColor, float Duration, bool bDrawShadow, float FontScale, const FVector Location, const float Distance)
 {
 	if (FVector::Distance(TextLocation, Location) <= Distance)
 	{
-		DrawDebugString(InWorld, TextLocation, Text, TestBaseActor, TextColor, Duration, bDrawShadow, FontScale);
+		if (Duration > 0.0f || TestBaseActor)
+		{
+			DrawDebugString(InWorld, TextLocation, Text, TestBaseActor, TextColor, Duration, bDrawShadow, FontScale);
+		}
+		else
+		{
+			GetDebugDrawBuffer().AddString(TextLocation, Text, TextColor, FontScale);
+		}
 	}
 }
 
@@ -233,14 +344,14 @@ void DrawDebugSpeed(UWorld* World, const FVector& Location, const float Speed, c
 		const FVector TextOffset(0.0f,0.0f,400.0f);
 
 		const FString Str = FString::Printf(TEXT("SPD:%.1f BRK?%d D%%:%.3f LOD:%d"), Speed, bBraking, (DistanceAlongLane/CurrentLaneLength), LOD);
-		DrawDebugString(World, Location + TextOffset, Str, nullptr, FColor::White, 0.0f);
-	
+		GetDebugDrawBuffer().AddString(Location + TextOffset, Str, FColor::White);
+
 		// Base line
-		DrawDebugLine(World, Location + LineOffset, Location + LineOffset + FVector(0.0f, 0.0f, Size), FColor::Black, false, -1, 0, Thickness);
+		GetDebugDrawBuffer().AddLine(Location + LineOffset, Location + LineOffset + FVector(0.0f, 0.0f, Size), FColor::Black, Thickness);
 
 		// Speed percentage line
 		const float SpeedLineSize = Speed / NormalizationSpeed * Size;
-		DrawDebugLine(World, Location + LineOffset, Location + LineOffset + FVector(0.0f, 0.0f, SpeedLineSize), bBraking ? FColor::Red : FColor::Green, false, -1, 1, Thickness);
+		GetDebugDrawBuffer().AddLine(Location + LineOffset, Location + LineOffset + FVector(0.0f, 0.0f, SpeedLineSize), bBraking ? FColor::Red : FColor::Green, Thickness);
 	}
 #endif
 
@@ -260,15 +371,15 @@ void DrawDebugChaosVehicleControl(UWorld* World, const FVector& Location, const
     #if ENABLE_VISUAL_LOG
     	if (GMassTrafficDebugSpeed)
     	{
-    		DrawDebugPoint(World, SpeedControlChaseTargetLocation, /*Size*/10.0f, FColor::Green);
-    		DrawDebugLine(World, Location + FVector(0,0,100), SpeedControlChaseTargetLocation, FColor::Green);
-    		
-    		DrawDebugPoint(World, SteeringControlChaseTargetLocation, /*Size*/10.0f, FColor::Turquoise);
-    		DrawDebugLine(World, Location + FVector(0,0,100), SteeringControlChaseTargetLocation, FColor::Turquoise);
+    		GetDebugDrawBuffer().AddPoint(SpeedControlChaseTargetLocation, /*Size*/10.0f, FColor::Green);
+    		GetDebugDrawBuffer().AddLine(Location + FVector(0,0,100), SpeedControlChaseTargetLocation, FColor::Green);
+
+    		GetDebugDrawBuffer().AddPoint(SteeringControlChaseTargetLocation, /*Size*/10.0f, FColor::Turquoise);
+    		GetDebugDrawBuffer().AddLine(Location + FVector(0,0,100), SteeringControlChaseTargetLocation, FColor::Turquoise);
 
     		const FVector TextOffset(0.0f,0.0f,450.0f);
 			const FString Str = FString::Printf(TEXT("TARG:%.1f THR:%.1f STR:%.2f"), TargetSpeed, Throttle, Steering);
-			DrawDebugString(World, Location + TextOffset, Str, nullptr, FColor::White, 0.0f);
+			GetDebugDrawBuffer().AddString(Location + TextOffset, Str, FColor::White);
     	}
     	if (bVisLog)
     	{
@@ -283,10 +394,10 @@ void DrawDebugLaneSegment(UWorld* World, const FMassTrafficLaneSegment& LaneSegm
 #if ENABLE_DRAW_DEBUG
 	if (GMassTrafficDebugInterpolation)
 	{
-		DrawDebugPoint(World, LaneSegment.StartPoint, 20.0f, FColor::Red);
-		DrawDebugPoint(World, LaneSegment.StartControlPoint, 20.0f, FColor::Green);
-		DrawDebugPoint(World, LaneSegment.EndControlPoint, 20.0f, FColor::Blue);
-		DrawDebugPoint(World, LaneSegment.EndPoint, 20.0f, FColor::Cyan);
+		GetDebugDrawBuffer().AddPoint(LaneSegment.StartPoint, 20.0f, FColor::Red);
+		GetDebugDrawBuffer().AddPoint(LaneSegment.StartControlPoint, 20.0f, FColor::Green);
+		GetDebugDrawBuffer().AddPoint(LaneSegment.EndControlPoint, 20.0f, FColor::Blue);
+		GetDebugDrawBuffer().AddPoint(LaneSegment.EndPoint, 20.0f, FColor::Cyan);
 	}
 #endif
 
@@ -306,8 +417,8 @@ void DrawDebugInterpolatedAxles(UWorld* World, const FVector& FrontAxleLocation,
 #if ENABLE_DRAW_DEBUG
 	if (GMassTrafficDebugInterpolation)
 	{
-		DrawDebugPoint(World, FrontAxleLocation, 20.0f, FColor::White);
-		DrawDebugPoint(World, RearAxleLocation, 20.0f, FColor::Black);
+		GetDebugDrawBuffer().AddPoint(FrontAxleLocation, 20.0f, FColor::White);
+		GetDebugDrawBuffer().AddPoint(RearAxleLocation, 20.0f, FColor::Black);
 	}
 #endif
 
@@ -336,8 +447,8 @@ void DrawDebugShouldStop(float DebugDrawSize, const FColor DebugDrawColor, const
 #if ENABLE_DRAW_DEBUG
 	if (GMassTrafficDebugShouldStop && FVector::Distance(GetPlayerViewLocation(VisLogOwner->GetWorld()), VisLogTransform->GetLocation()) <= ViewerDistance)
 	{
-		DrawDebugPoint(VisLogOwner->GetWorld(), DebugDrawDotLocation, DebugDrawSize, DebugDrawColor);
-		DrawDebugString(VisLogOwner->GetWorld(), DebugDrawTextLocation, DebugText, nullptr, FColor::White, 0.0f, true, 1.0f);
+		GetDebugDrawBuffer().AddPoint(DebugDrawDotLocation, DebugDrawSize, DebugDrawColor);
+		GetDebugDrawBuffer().AddString(DebugDrawTextLocation, DebugText, FColor::White);
 	}
 #endif
 	
@@ -365,7 +476,7 @@ void DrawDebugLaneChange(UWorld* World, const FTransform& Transform, bool bToLef
 #if ENABLE_DRAW_DEBUG
 	if (GMassTrafficDebugLaneChanging && World)
 	{
-		DrawDebugLine(World, LineStart, LineEnd, Color, false, 0.0f, 0, Thickness);
+		GetDebugDrawBuffer().AddLine(LineStart, LineEnd, Color, Thickness);
 	}
 #endif
 
@@ -387,8 +498,8 @@ void DrawDebugLaneChangeProgression(UWorld* World, const FVector& Location, cons
 #if ENABLE_DRAW_DEBUG
 	if (GMassTrafficDebugLaneChanging && World)
 	{
-		DrawDebugLine(World, Location, Location + Z, FColor::Emerald, false, 0.0f, 0, Thickness);
-		DrawDebugLine(World, Location, Location - Offset, FColor::White, false, 0.0f, 0, Thickness);
+		GetDebugDrawBuffer().AddLine(Location, Location + Z, FColor::Emerald, Thickness);
+		GetDebugDrawBuffer().AddLine(Location, Location - Offset, FColor::White, Thickness);
 	}
 #endif
 
@@ -449,8 +560,8 @@ void DrawDebugDistanceToNext(UWorld* World, const FVector& VehicleLocation, cons
 		(GMassTrafficDebugDistanceToNext == 11 && CombineDistanceToNextDrawType != EMassTrafficCombineDistanceToNextType::Next) ||
 		(GMassTrafficDebugDistanceToNext == 12 && CombineDistanceToNextDrawType != EMassTrafficCombineDistanceToNextType::Next))
 	{
-		DrawDebugLine(World, VehicleLocation + OffsetLow, VehicleLocation + OffsetHigh, FColor::Silver, false, -1.0f, 0, Thickness);
-		DrawDebugLine(World, VehicleLocation + OffsetHigh, NextVehicleLocation /*+ OffsetHigh*/, Color, false, -1.0f, 0, Thickness);
+		GetDebugDrawBuffer().AddLine(VehicleLocation + OffsetLow, VehicleLocation + OffsetHigh, FColor::Silver, Thickness);
+		GetDebugDrawBuffer().AddLine(VehicleLocation + OffsetHigh, NextVehicleLocation /*+ OffsetHigh*/, Color, Thickness);
 	}
 #endif
 
@@ -491,7 +602,7 @@ void DrawDebugDensityManagementRecyclableVehicle(UWorld* World, const FVector& R
 #if ENABLE_DRAW_DEBUG
 	if (GMassTrafficDebugOverseer)
 	{
-		DrawDebugPoint(World, RecyclableVehicleLocation + Offset, 10.0f, bTransferred ? FColor::Green : FColor::Red);
+		GetDebugDrawBuffer().AddPoint(RecyclableVehicleLocation + Offset, 10.0f, bTransferred ? FColor::Green : FColor::Red);
 	}
 #endif
 
@@ -517,7 +628,7 @@ void DrawDebugSleepState(UWorld* World, const FVector& VehicleLocation, bool bIs
 #if ENABLE_DRAW_DEBUG
 	if (GMassTrafficDebugSleep)
 	{
-		DrawDebugPoint(World, VehicleLocation + Offset, 10.0f, bIsSleeping ? FColor::Red : FColor::White);
+		GetDebugDrawBuffer().AddPoint(VehicleLocation + Offset, 10.0f, bIsSleeping ? FColor::Red : FColor::White);
 	}
 #endif
 
@@ -70,6 +70,10 @@ void UMassTrafficDriverVisualizationProcessor::Execute(FMassEntityManager& Entit
 	check(World);
 	const float GlobalTime = World->GetTimeSeconds();
 
+	// Most drivers on screen play the same few idle loops, so base anim states are resolved once
+	// per unique (asset, variation, state) this frame and copied between instances
+	AnimBaseStateCache.Reset();
+
 	// Grab player's spatial data (assume single player)
 	FVector PlayerMeshLocation = FVector::ZeroVector;
 	if (const ACharacter* PlayerChar = UGameplayStatics::GetPlayerCharacter(this, 0))
@@ -132,91 +136,119 @@ void UMassTrafficDriverVisualizationProcessor::Execute(FMassEntityManager& Entit
 
 				if (const UAnimToTextureDataAsset* AnimData = DriverType.AnimationData.Get())
 				{
-					// Explicit anim state variation from DriverType e.g: force bus variation? 
-					EDriverAnimStateVariation AnimStateVariation;
-					if (Params.AnimStateVariationOverride != EDriverAnimStateVariation::None)
+					// Assign this driver's round-robin update phase on first sight, staggering amortized
+					// anim state updates across frames. (See all DRIVERBUCKET.)
+					if (DriverVisualizationFragment.UpdatePhase == FMassTrafficDriverVisualizationFragment::InvalidUpdatePhase)
 					{
-						AnimStateVariation = Params.AnimStateVariationOverride;
+						DriverVisualizationFragment.UpdatePhase = static_cast<uint8>(RandomFractionFragment.RandomFraction * 255.0f);
 					}
-					else
+
+					// Drivers beyond the near band are visually static to players, so their anim state
+					// only needs refreshing every few frames - skipped frames re-submit the playback
+					// data cached in the fragment below. (See all DRIVERBUCKET.)
+					int32 UpdateInterval = 1;
+					if (ViewerInfoFragment.ClosestViewerDistanceSq > FMath::Square(GMassTrafficDriverVisualizationFarUpdateDistance))
 					{
-						// Otherwise randomly choose One or Two handed driving
-						AnimStateVariation = RandomFractionFragment.RandomFraction <= AlternateDrivingStanceRatio ? 
-								EDriverAnimStateVariation::OneHand : EDriverAnimStateVariation::TwoHands;
+						UpdateInterval = GMassTrafficDriverVisualizationFarUpdateInterval;
 					}
-							
-					const int32 AnimStateVariationIndex = static_cast<int32>(AnimStateVariation);
-					FMassTrafficInstancePlaybackData CustomData;
-					const float SteeringInput = PIDVehicleControlFragments.IsEmpty() ? 0.0f : PIDVehicleControlFragments[EntityIt].Steering;
-					if (SteeringInput >= -PlaybackSteeringThreshold && SteeringInput <= PlaybackSteeringThreshold)
+					else if (ViewerInfoFragment.ClosestViewerDistanceSq > FMath::Square(GMassTrafficDriverVisualizationMidUpdateDistance))
 					{
-						if (VehicleControlFragment.Speed > LowSpeedThreshold)
+						UpdateInterval = GMassTrafficDriverVisualizationMidUpdateInterval;
+					}
+					const bool bUpdateAnimState = !DriverVisualizationFragment.bHasCachedPlaybackData
+						|| UpdateInterval <= 1
+						|| (GFrameCounter + DriverVisualizationFragment.UpdatePhase) % static_cast<uint64>(UpdateInterval) == 0;
+
+					FMassTrafficInstancePlaybackData& CustomData = DriverVisualizationFragment.CachedPlaybackData;
+					if (bUpdateAnimState)
+					{
+						DriverVisualizationFragment.bHasCachedPlaybackData = true;
+
+						// Explicit anim state variation from DriverType e.g: force bus variation? 
+						EDriverAnimStateVariation AnimStateVariation;
+						if (Params.AnimStateVariationOverride != EDriverAnimStateVariation::None)
 						{
-							DriverVisualizationFragment.AnimState = ETrafficDriverAnimState::HighSpeedIdle;
-							DriverVisualizationFragment.AnimStateGlobalTime = -RandomFractionFragment.RandomFraction * 10.0f;
-							PopulateAnimPlaybackFromAnimState(
-								AnimData,
-								static_cast<int32>(DriverVisualizationFragment.AnimState),
-								AnimStateVariationIndex,
-								DriverVisualizationFragment.AnimStateGlobalTime,
-								CustomData);
+							AnimStateVariation = Params.AnimStateVariationOverride;
 						}
 						else
 						{
-							const FVector DriverToPlayer = PlayerMeshLocation - DriverTransform.GetLocation();
-							const float DriverToPlayerSizeSqrd = DriverToPlayer.SizeSquared();
-							bool bIsLookIdle = false;
-
-							if (DriverToPlayerSizeSqrd < LookIdleMinDistSqrd)
+							// Otherwise randomly choose One or Two handed driving
+							AnimStateVariation = RandomFractionFragment.RandomFraction <= AlternateDrivingStanceRatio ? 
+									EDriverAnimStateVariation::OneHand : EDriverAnimStateVariation::TwoHands;
+						}
+							
+						const int32 AnimStateVariationIndex = static_cast<int32>(AnimStateVariation);
+						const float SteeringInput = PIDVehicleControlFragments.IsEmpty() ? 0.0f : PIDVehicleControlFragments[EntityIt].Steering;
+						if (SteeringInput >= -PlaybackSteeringThreshold && SteeringInput <= PlaybackSteeringThreshold)
+						{
+							if (VehicleControlFragment.Speed > LowSpeedThreshold)
 							{
-								const FVector DriverToPlayerDir = DriverToPlayer.GetSafeNormal();
-								const FVector DriverLeftDir = DriverTransform.GetUnitAxis(EAxis::X);
-								const float LeftDirDotToPlayer = FVector::DotProduct(DriverLeftDir, DriverToPlayerDir);
-								if (FMath::Abs(LeftDirDotToPlayer) >= LookIdleMinDotToPlayer)
-								{
-									ETrafficDriverAnimState NewState =
-										LeftDirDotToPlayer >= 0.0f ?
-										ETrafficDriverAnimState::LookLeftIdle :
-										ETrafficDriverAnimState::LookRightIdle;
+								DriverVisualizationFragment.AnimState = ETrafficDriverAnimState::HighSpeedIdle;
+								DriverVisualizationFragment.AnimStateGlobalTime = -RandomFractionFragment.RandomFraction * 10.0f;
+								PopulateAnimPlaybackFromAnimState(
+									AnimData,
+									static_cast<int32>(DriverVisualizationFragment.AnimState),
+									AnimStateVariationIndex,
+									DriverVisualizationFragment.AnimStateGlobalTime,
+									CustomData);
+							}
+							else
+							{
+								const FVector DriverToPlayer = PlayerMeshLocation - DriverTransform.GetLocation();
+								const float DriverToPlayerSizeSqrd = DriverToPlayer.SizeSquared();
+								bool bIsLookIdle = false;
 
-									if (NewState != DriverVisualizationFragment.AnimState)
+								if (DriverToPlayerSizeSqrd < LookIdleMinDistSqrd)
+								{
+									const FVector DriverToPlayerDir = DriverToPlayer.GetSafeNormal();
+									const FVector DriverLeftDir = DriverTransform.GetUnitAxis(EAxis::X);
+									const float LeftDirDotToPlayer = FVector::DotProduct(DriverLeftDir, DriverToPlayerDir);
+									if (FMath::Abs(LeftDirDotToPlayer) >= LookIdleMinDotToPlayer)
 									{
-										DriverVisualizationFragment.AnimState = NewState;
-										DriverVisualizationFragment.AnimStateGlobalTime = GlobalTime;
+										ETrafficDriverAnimState NewState =
+											LeftDirDotToPlayer >= 0.0f ?
+											ETrafficDriverAnimState::LookLeftIdle :
+											ETrafficDriverAnimState::LookRightIdle;
+
+										if (NewState != DriverVisualizationFragment.AnimState)
+										{
+											DriverVisualizationFragment.AnimState = NewState;
+											DriverVisualizationFragment.AnimStateGlobalTime = GlobalTime;
+										}
+										PopulateAnimPlaybackFromAnimState(
+											AnimData,
+											static_cast<int32>(DriverVisualizationFragment.AnimState),
+											AnimStateVariationIndex,
+											DriverVisualizationFragment.AnimStateGlobalTime,
+											CustomData);
+										bIsLookIdle = true;
 									}
+								}
+
+								if (!bIsLookIdle)
+								{
+									DriverVisualizationFragment.AnimState = ETrafficDriverAnimState::LowSpeedIdle;
+									DriverVisualizationFragment.AnimStateGlobalTime = -RandomFractionFragment.RandomFraction * 10.0f;
 									PopulateAnimPlaybackFromAnimState(
 										AnimData,
 										static_cast<int32>(DriverVisualizationFragment.AnimState),
 										AnimStateVariationIndex,
 										DriverVisualizationFragment.AnimStateGlobalTime,
 										CustomData);
-									bIsLookIdle = true;
 								}
 							}
-
-							if (!bIsLookIdle)
-							{
-								DriverVisualizationFragment.AnimState = ETrafficDriverAnimState::LowSpeedIdle;
-								DriverVisualizationFragment.AnimStateGlobalTime = -RandomFractionFragment.RandomFraction * 10.0f;
-								PopulateAnimPlaybackFromAnimState(
-									AnimData,
-									static_cast<int32>(DriverVisualizationFragment.AnimState),
-									AnimStateVariationIndex,
-									DriverVisualizationFragment.AnimStateGlobalTime,
-									CustomData);
-							}
 						}
-					}
-					else
-					{
-						DriverVisualizationFragment.AnimState = ETrafficDriverAnimState::Steering;
-						PopulateAnimEvalFromAnimState(
-							AnimData,
-							static_cast<int32>(DriverVisualizationFragment.AnimState),
-							AnimStateVariationIndex,
-							SteeringInput,
-							FFloatInterval(-1.0f, 1.0f),
-							CustomData);
+						else
+						{
+							DriverVisualizationFragment.AnimState = ETrafficDriverAnimState::Steering;
+							PopulateAnimEvalFromAnimState(
+								AnimData,
+								static_cast<int32>(DriverVisualizationFragment.AnimState),
+								AnimStateVariationIndex,
+								SteeringInput,
+								FFloatInterval(-1.0f, 1.0f),
+								CustomData);
+						}
 					}
 
 					// Remove the driver if vehicle is damaged
@@ -297,15 +329,31 @@ bool UMassTrafficDriverVisualizationProcessor::PopulateAnimFromAnimState(
 	int32 VariationIndex,
 	FMassTrafficInstancePlaybackData& OutPlaybackData)
 {
+	if (!AnimData)
+	{
+		return false;
+	}
+
+	// Instances sharing this animation copy the base state cached by the first driver to resolve
+	// it this frame; callers personalize GlobalStartTime / eval frame on their copy afterwards
 	const int VariationAnimStateIndex = static_cast<int32>(ETrafficDriverAnimState::Count) * VariationIndex + StateIndex;
-	if (AnimData && AnimData->Animations.IsValidIndex(VariationAnimStateIndex))
+	const TPair<const UAnimToTextureDataAsset*, int32> CacheKey(AnimData, VariationAnimStateIndex);
+	if (const FMassTrafficAnimState* CachedState = AnimBaseStateCache.Find(CacheKey))
 	{
+		OutPlaybackData.CurrentState = *CachedState;
+		return true;
+	}
 
+	if (AnimData->Animations.IsValidIndex(VariationAnimStateIndex))
+	{
 		const FAnimToTextureAnimInfo& AnimInfo = AnimData->Animations[VariationAnimStateIndex];
-		OutPlaybackData.CurrentState.StartFrame = AnimInfo.StartFrame;
-		OutPlaybackData.CurrentState.NumFrames = AnimInfo.EndFrame - AnimInfo.StartFrame + 1; // AnimInfo.NumFrames;
-		OutPlaybackData.CurrentState.bLooping = true; // AnimInfo.bLooping;
+		FMassTrafficAnimState BaseState;
+		BaseState.StartFrame = AnimInfo.StartFrame;
+		BaseState.NumFrames = AnimInfo.EndFrame - AnimInfo.StartFrame + 1; // AnimInfo.NumFrames;
+		BaseState.bLooping = true; // AnimInfo.bLooping;
+		AnimBaseStateCache.Add(CacheKey, BaseState);
 
+		OutPlaybackData.CurrentState = BaseState;
 		return true;
 	}
 
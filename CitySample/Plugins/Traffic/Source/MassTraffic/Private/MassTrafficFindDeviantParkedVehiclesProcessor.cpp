@@ -8,6 +8,7 @@
 #include "MassCrowdFragments.h"
 #include "MassCommandBuffer.h"
 #include "MassCommonFragments.h"
+#include "MassEntityView.h"
 #include "MassExecutionContext.h"
 #include "MassLookAtFragments.h"
 #include "MassTrafficVehicleSimulationTrait.h"
@@ -21,6 +22,18 @@ UMassTrafficFindDeviantParkedVehiclesProcessor::UMassTrafficFindDeviantParkedVeh
 	ExecutionOrder.ExecuteInGroup = UE::MassTraffic::ProcessorGroupNames::ParkedVehicleBehavior;
 }
 
+void UMassTrafficFindDeviantParkedVehiclesProcessor::BeginDestroy()
+{
+	// Make sure the async deviance task isn't left reading the input array we're about to destroy.
+	// (See all ASYNCDEVIANT.)
+	if (DeviantCheckTask.IsValid())
+	{
+		DeviantCheckTask.Wait();
+	}
+
+	Super::BeginDestroy();
+}
+
 void UMassTrafficFindDeviantParkedVehiclesProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
 {
 	NominalParkedVehicleEntityQuery.AddTagRequirement<FMassTrafficParkedVehicleTag>(EMassFragmentPresence::All);
@@ -31,16 +44,71 @@ void UMassTrafficFindDeviantParkedVehiclesProcessor::ConfigureQueries(const TSha
 	NominalParkedVehicleEntityQuery.AddConstSharedRequirement<FMassTrafficVehicleSimulationParameters>();
 }
 
+void UMassTrafficFindDeviantParkedVehiclesProcessor::ApplyDeviantCheckResults(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	for (const FParkedVehicleCheckResult& Result : DeviantParkedVehicles)
+	{
+		// The deviance test ran a frame ago - skip entities that have since been destroyed or already
+		// marked disturbed. (See all ASYNCDEVIANT.)
+		if (!EntityManager.IsEntityValid(Result.Entity))
+		{
+			continue;
+		}
+		const FMassEntityView EntityView(EntityManager, Result.Entity);
+		if (EntityView.HasTag<FMassTrafficObstacleTag>() || EntityView.HasTag<FMassTrafficDisturbedVehicleTag>())
+		{
+			continue;
+		}
+
+		// Add an FTagFragment_MassTrafficObstacle tag to it so it's considered for obstacle avoidance.
+		Context.Defer().AddTag<FMassTrafficObstacleTag>(Result.Entity);
+		// Add a disturbed vehicle tag so we can update the entity with the actor transform if it's a complex LOD.
+		Context.Defer().AddTag<FMassTrafficDisturbedVehicleTag>(Result.Entity);
+
+		// Add fragments to allow both traffic and crowd systems to notice this vehicle as an obstacle.
+		Context.Defer().AddFragment<FMassLookAtTargetFragment>(Result.Entity);
+		Context.Defer().PushCommand<FMassCommandAddFragments<
+			FMassNavigationObstacleGridCellLocationFragment		// Needed to become a crowd avoidance obstacle
+			, FMassCrowdObstacleFragment						// Needed to be a zone graph dynamic obstacle
+			, FMassVelocityFragment								// Add velocity to make it a valid obstacle
+			, FMassTrafficVehicleDamageFragment>>					// So we can keep track of damage.
+			(Result.Entity);
+
+		// Add avoidance collider data for crowd system.
+		FMassPillCollider Pill(Result.HalfWidth, Result.HalfLength);
+		FMassAvoidanceColliderFragment ColliderFragment(Pill);
+		// Add the vehicle radius fragment for obstacle avoidance.
+		FAgentRadiusFragment RadiusFragment;
+		RadiusFragment.Radius = Result.HalfLength;
+		Context.Defer().PushCommand<FMassCommandAddFragmentInstances>(Result.Entity, ColliderFragment, RadiusFragment);
+
+		// Debug
+		UE_VLOG_LOCATION(LogOwner, TEXT("MassTraffic Deviants"), Log, Result.ActorLocation, 10.0f, FColor::Red, TEXT("%d Deviated by %f"), Result.Entity.Index, Result.Deviation);
+		UE_VLOG_SEGMENT_THICK(LogOwner, TEXT("MassTraffic Deviants"), Log, Result.ActorLocation, Result.EntityLocation, FColor::Red, 3.0f, TEXT(""));
+	}
+
+	DeviantParkedVehicles.Reset();
+}
+
 void UMassTrafficFindDeviantParkedVehiclesProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
-	// Look for deviant vehicles
+	// Apply last frame's async deviance results before gathering this frame's inputs. Disturbance
+	// detection tolerates a frame of latency. (See all ASYNCDEVIANT.)
+	if (DeviantCheckTask.IsValid())
+	{
+		DeviantCheckTask.Wait();
+		DeviantCheckTask = UE::Tasks::FTask();
+	}
+	ApplyDeviantCheckResults(EntityManager, Context);
+
+	// Snapshot parked vehicles to check for deviation
+	ParkedVehicleCheckInputs.Reset();
 	NominalParkedVehicleEntityQuery.ForEachEntityChunk(Context, [this](FMassExecutionContext& QueryContext)
 	{
 		const FMassTrafficVehicleSimulationParameters& SimulationParams = QueryContext.GetConstSharedFragment<FMassTrafficVehicleSimulationParameters>();
 		const TConstArrayView<FTransformFragment> TransformFragments = QueryContext.GetFragmentView<FTransformFragment>();
 		const TConstArrayView<FMassActorFragment> ActorFragments = QueryContext.GetFragmentView<FMassActorFragment>();
 
-		// Loop obstacles
 		for (FMassExecutionContext::FEntityIterator EntityIt = QueryContext.CreateEntityIterator(); EntityIt; ++EntityIt)
 		{
 			const FTransformFragment& TransformFragment = TransformFragments[EntityIt];
@@ -48,42 +116,40 @@ void UMassTrafficFindDeviantParkedVehiclesProcessor::Execute(FMassEntityManager&
 			const AActor* Actor = ActorFragment.Get();
 
 			if (Actor != nullptr)
+			{
+				FParkedVehicleCheckInput& Input = ParkedVehicleCheckInputs.AddDefaulted_GetRef();
+				Input.Entity = QueryContext.GetEntity(EntityIt);
+				Input.EntityLocation = TransformFragment.GetTransform().GetLocation();
+				Input.ActorLocation = Actor->GetActorLocation();
+				Input.HalfWidth = SimulationParams.HalfWidth;
+				Input.HalfLength = SimulationParams.HalfLength;
+			}
+		}
+	});
+
+	// Run the deviance tests on a worker thread, results are consumed next frame. The snapshots are
+	// self-contained value copies, so the task doesn't touch entity data. (See all ASYNCDEVIANT.)
+	if (!ParkedVehicleCheckInputs.IsEmpty())
+	{
+		const float ParkedVehicleDeviationTolerance = MassTrafficSettings->ParkedVehicleDeviationTolerance;
+		DeviantCheckTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, ParkedVehicleDeviationTolerance]()
+		{
+			for (const FParkedVehicleCheckInput& Input : ParkedVehicleCheckInputs)
 			{
 				// Has the entity transform and actual simulated actor transform deviated significantly and if so
 				// this parked vehicle is deviant
-				const FVector ActorLocation = Actor->GetActorLocation();
-				const float Deviation = FVector::Distance(TransformFragment.GetTransform().GetLocation(), ActorLocation);
-				if (Deviation > MassTrafficSettings->ParkedVehicleDeviationTolerance)
+				const float Deviation = FVector::Distance(Input.EntityLocation, Input.ActorLocation);
+				if (Deviation > ParkedVehicleDeviationTolerance)
 				{
-					const FMassEntityHandle ParkedVehicleEntity = QueryContext.GetEntity(EntityIt);
-
-					// Add an FTagFragment_MassTrafficObstacle tag to it so it's considered for obstacle avoidance.
-					QueryContext.Defer().AddTag<FMassTrafficObstacleTag>(ParkedVehicleEntity);
-					// Add a disturbed vehicle tag so we can update the entity with the actor transform if it's a complex LOD.
-					QueryContext.Defer().AddTag<FMassTrafficDisturbedVehicleTag>(ParkedVehicleEntity);
-
-					// Add fragments to allow both traffic and crowd systems to notice this vehicle as an obstacle. 
-					QueryContext.Defer().AddFragment<FMassLookAtTargetFragment>(ParkedVehicleEntity);
-					QueryContext.Defer().PushCommand<FMassCommandAddFragments<
-						FMassNavigationObstacleGridCellLocationFragment		// Needed to become a crowd avoidance obstacle
-						, FMassCrowdObstacleFragment						// Needed to be a zone graph dynamic obstacle
-						, FMassVelocityFragment								// Add velocity to make it a valid obstacle
-						, FMassTrafficVehicleDamageFragment>>					// So we can keep track of damage.
-						(ParkedVehicleEntity);
-
-					// Add avoidance collider data for crowd system.
-					FMassPillCollider Pill(SimulationParams.HalfWidth, SimulationParams.HalfLength);
-					FMassAvoidanceColliderFragment ColliderFragment(Pill);
-					// Add the vehicle radius fragment for obstacle avoidance.
-					FAgentRadiusFragment RadiusFragment;
-					RadiusFragment.Radius = SimulationParams.HalfLength;
-					QueryContext.Defer().PushCommand<FMassCommandAddFragmentInstances>(ParkedVehicleEntity, ColliderFragment, RadiusFragment);
-
-					// Debug
-					UE_VLOG_LOCATION(LogOwner, TEXT("MassTraffic Deviants"), Log, ActorLocation, 10.0f, FColor::Red, TEXT("%d Deviated by %f"), QueryContext.GetEntity(EntityIt).Index, Deviation);
-					UE_VLOG_SEGMENT_THICK(LogOwner, TEXT("MassTraffic Deviants"), Log, ActorLocation, TransformFragment.GetTransform().GetLocation(), FColor::Red, 3.0f, TEXT(""));
+					FParkedVehicleCheckResult& Result = DeviantParkedVehicles.AddDefaulted_GetRef();
+					Result.Entity = Input.Entity;
+					Result.EntityLocation = Input.EntityLocation;
+					Result.ActorLocation = Input.ActorLocation;
+					Result.Deviation = Deviation;
+					Result.HalfWidth = Input.HalfWidth;
+					Result.HalfLength = Input.HalfLength;
 				}
 			}
-		}
-	});
+		});
+	}
 }
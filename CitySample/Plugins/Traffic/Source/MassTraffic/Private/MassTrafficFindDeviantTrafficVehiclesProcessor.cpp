@@ -16,6 +16,7 @@
 #include "MassTrafficVehicleSimulationTrait.h"
 #include "MassCrowdFragments.h"
 #include "MassZoneGraphNavigationFragments.h"
+#include "Engine/World.h"
 #include "VisualLogger/VisualLogger.h"
 #include "ZoneGraphSubsystem.h"
 
@@ -33,6 +34,18 @@ UMassTrafficFindDeviantTrafficVehiclesProcessor::UMassTrafficFindDeviantTrafficV
 	ExecutionOrder.ExecuteAfter.Add(UMassTrafficUpdateVelocityProcessor::StaticClass()->GetFName());
 }
 
+void UMassTrafficFindDeviantTrafficVehiclesProcessor::BeginDestroy()
+{
+	// Make sure the async deviance task isn't left reading the input arrays we're about to destroy.
+	// (See all ASYNCDEVIANT.)
+	if (DeviantCheckTask.IsValid())
+	{
+		DeviantCheckTask.Wait();
+	}
+
+	Super::BeginDestroy();
+}
+
 void UMassTrafficFindDeviantTrafficVehiclesProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
 {
 	// High LOD physics vehicles which haven't been marked as deviant obstacles to check for deviation
@@ -73,21 +86,20 @@ void UMassTrafficFindDeviantTrafficVehiclesProcessor::ConfigureQueries(const TSh
 	CorrectedTrafficVehicleEntityQuery.AddSubsystemRequirement<UMassNavigationSubsystem>(EMassFragmentAccess::ReadWrite);
 }
 
-static void RemoveDeviantFragments(const FMassEntityManager& EntityManager, const FMassExecutionContext& Context, UMassNavigationSubsystem& MovementSubsystem, const int32 EntityIt)
+static void RemoveDeviantFragments(const FMassEntityManager& EntityManager, const FMassExecutionContext& Context, UMassNavigationSubsystem& MovementSubsystem, const FMassEntityHandle Entity)
 {
 	// This vehicle is no longer deviant, remove the FTagFragment_MassTrafficObstacle tag from it so it's
 	// no longer considered for obstacle avoidance.
-	const FMassEntityHandle Entity = Context.GetEntity(EntityIt);
 	Context.Defer().RemoveTag<FMassTrafficObstacleTag>(Entity);
 	Context.Defer().RemoveFragment<FMassLookAtTargetFragment>(Entity);
 
 	// Manually do the work of UMassAvoidanceObstacleRemoverFragmentDestructor because it's not called on fragment removal.
 	const FMassEntityView EntityView(EntityManager, Entity);
-	if (const FMassNavigationObstacleGridCellLocationFragment* GridCellLocationList = EntityView.GetFragmentDataPtr<FMassNavigationObstacleGridCellLocationFragment>())
+	if (const FMassNavigationObstacleGridCellLocationFragment* GridCellLocationFragment = EntityView.GetFragmentDataPtr<FMassNavigationObstacleGridCellLocationFragment>())
 	{
 		FMassNavigationObstacleItem ObstacleItem;
 		ObstacleItem.Entity = Entity;
-		MovementSubsystem.GetObstacleGridMutable().Remove(ObstacleItem, GridCellLocationList[EntityIt].CellLoc);
+		MovementSubsystem.GetObstacleGridMutable().Remove(ObstacleItem, GridCellLocationFragment->CellLoc);
 	}
 
 	Context.Defer().PushCommand<FMassCommandRemoveFragments<
@@ -97,9 +109,116 @@ static void RemoveDeviantFragments(const FMassEntityManager& EntityManager, cons
 		(Entity);
 }
 
+float UMassTrafficFindDeviantTrafficVehiclesProcessor::ComputeLaneDeviation(FDeviantVehicleCheckInput& Input, FTransform& OutLaneLocationTransform)
+{
+	// Get pure lane location
+	UE::MassTraffic::InterpolatePositionAndOrientationAlongLane(*Input.ZoneGraphStorage, Input.LaneIndex, Input.DistanceAlongLane, ETrafficVehicleMovementInterpolationMethod::Linear, Input.CachedLaneSegment, OutLaneLocationTransform);
+
+	// Apply lateral offset
+	OutLaneLocationTransform.AddToTranslation(OutLaneLocationTransform.GetRotation().GetRightVector() * Input.LateralOffset);
+
+	// Adjust lane location for lane changing
+	UE::MassTraffic::AdjustVehicleTransformDuringLaneChange(Input.LaneChangeFragment, Input.DistanceAlongLane, OutLaneLocationTransform);
+
+	// How far has the actual simulated actor transform deviated from the entity transform
+	return FVector::Distance(OutLaneLocationTransform.GetLocation(), Input.ActorLocation);
+}
+
+void UMassTrafficFindDeviantTrafficVehiclesProcessor::ApplyDeviantCheckResults(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	if (NewlyDeviantVehicles.IsEmpty() && CorrectedVehicles.IsEmpty())
+	{
+		return;
+	}
+
+	const UWorld* World = EntityManager.GetWorld();
+	UMassNavigationSubsystem* NavigationSubsystem = World ? World->GetSubsystem<UMassNavigationSubsystem>() : nullptr;
+
+	for (const FDeviantVehicleCheckResult& Result : NewlyDeviantVehicles)
+	{
+		// The deviance test ran a frame ago - skip entities that have since been destroyed or already
+		// marked deviant. (See all ASYNCDEVIANT.)
+		if (!EntityManager.IsEntityValid(Result.Entity))
+		{
+			continue;
+		}
+		const FMassEntityView EntityView(EntityManager, Result.Entity);
+		if (EntityView.HasTag<FMassTrafficObstacleTag>())
+		{
+			continue;
+		}
+
+		FMassTrafficVehicleLaneChangeFragment* LaneChangeFragment = EntityView.GetFragmentDataPtr<FMassTrafficVehicleLaneChangeFragment>();
+		FMassTrafficVehicleLightsFragment* VehicleLightsFragment = EntityView.GetFragmentDataPtr<FMassTrafficVehicleLightsFragment>();
+		FMassTrafficNextVehicleFragment* NextVehicleFragment = EntityView.GetFragmentDataPtr<FMassTrafficNextVehicleFragment>();
+		if (!LaneChangeFragment || !VehicleLightsFragment || !NextVehicleFragment)
+		{
+			continue;
+		}
+
+		// IMPORTANT!
+		// Make sure we reset the lane change fragment, so it -
+		//		(1) Stops changing the transform of the vehicle.
+		//		(2) Removes any of it's own next-vehicle fragments it might have put on entities.
+		LaneChangeFragment->EndLaneChangeProgression(*VehicleLightsFragment, *NextVehicleFragment, EntityManager);
+
+		// This vehicle is deviant, add an FTagFragment_MassTrafficObstacle tag to it so it's
+		// considered for obstacle avoidance.
+		Context.Defer().AddTag<FMassTrafficObstacleTag>(Result.Entity);
+		Context.Defer().AddFragment<FMassLookAtTargetFragment>(Result.Entity);
+
+		Context.Defer().PushCommand<FMassCommandAddFragments<
+			FMassNavigationObstacleGridCellLocationFragment		// Needed to become an avoidance obstacle
+			, FMassCrowdObstacleFragment>>						// Needed to be a zone graph dynamic obstacle
+			(Result.Entity);
+
+		FMassPillCollider Pill(Result.HalfWidth, Result.HalfLength);
+		FMassAvoidanceColliderFragment ColliderFragment(Pill);
+		Context.Defer().PushCommand<FMassCommandAddFragmentInstances>(Result.Entity, ColliderFragment);
+
+		// Debug
+		UE_VLOG_LOCATION(LogOwner, TEXT("MassTraffic Deviants"), Log, Result.ActorLocation, 10.0f, FColor::Red, TEXT("%d Deviated by %f"), Result.Entity.Index, Result.Deviation);
+	}
+
+	if (NavigationSubsystem)
+	{
+		for (const FMassEntityHandle Entity : CorrectedVehicles)
+		{
+			if (!EntityManager.IsEntityValid(Entity))
+			{
+				continue;
+			}
+			const FMassEntityView EntityView(EntityManager, Entity);
+			if (!EntityView.HasTag<FMassTrafficObstacleTag>())
+			{
+				continue;
+			}
+
+			// Debug
+			UE_VLOG(LogOwner, TEXT("MassTraffic Deviants"), Log, TEXT("%d Corrected"), Entity.Index);
+
+			RemoveDeviantFragments(EntityManager, Context, *NavigationSubsystem, Entity);
+		}
+	}
+
+	NewlyDeviantVehicles.Reset();
+	CorrectedVehicles.Reset();
+}
+
 void UMassTrafficFindDeviantTrafficVehiclesProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
-	// Look for deviant vehicles
+	// Apply last frame's async deviance results before gathering this frame's inputs. The transform
+	// comparisons tolerate a frame of latency, so the expensive lane interpolation runs on a worker
+	// thread between frames instead of here. (See all ASYNCDEVIANT.)
+	if (DeviantCheckTask.IsValid())
+	{
+		DeviantCheckTask.Wait();
+		DeviantCheckTask = UE::Tasks::FTask();
+	}
+	ApplyDeviantCheckResults(EntityManager, Context);
+
+	// Snapshot vehicles to check for deviation
+	NominalVehicleCheckInputs.Reset();
 	NominalTrafficVehicleEntityQuery.ForEachEntityChunk(Context, [&](FMassExecutionContext& QueryContext)
 	{
 		const UZoneGraphSubsystem& ZoneGraphSubsystem = QueryContext.GetSubsystemChecked<UZoneGraphSubsystem>();
@@ -110,78 +229,42 @@ void UMassTrafficFindDeviantTrafficVehiclesProcessor::Execute(FMassEntityManager
 		const TConstArrayView<FMassTrafficLaneOffsetFragment> LaneOffsetFragments = QueryContext.GetFragmentView<FMassTrafficLaneOffsetFragment>();
 		const TConstArrayView<FMassZoneGraphLaneLocationFragment> ZoneGraphLaneLocationFragments = QueryContext.GetFragmentView<FMassZoneGraphLaneLocationFragment>();
 		const TArrayView<FMassTrafficInterpolationFragment> VehicleMovementInterpolationFragments = QueryContext.GetMutableFragmentView<FMassTrafficInterpolationFragment>();
-		const TArrayView<FMassTrafficNextVehicleFragment> NextVehicleFragments = QueryContext.GetMutableFragmentView<FMassTrafficNextVehicleFragment>();
 		const TArrayView<FMassTrafficVehicleLaneChangeFragment> LaneChangeFragments = QueryContext.GetMutableFragmentView<FMassTrafficVehicleLaneChangeFragment>();
-		const TArrayView<FMassTrafficVehicleLightsFragment> VehicleLightsFragments = QueryContext.GetMutableFragmentView<FMassTrafficVehicleLightsFragment>();
 
-		// Loop obstacles
 		for (FMassExecutionContext::FEntityIterator EntityIt = QueryContext.CreateEntityIterator(); EntityIt; ++EntityIt)
 		{
 			const FMassRepresentationFragment& RepresentationFragment = RepresentationFragments[EntityIt];
 			const FMassActorFragment& ActorFragment = ActorFragments[EntityIt];
-			
+
 			const AActor* Actor = ActorFragment.Get();
 			if (Actor != nullptr && RepresentationFragment.CurrentRepresentation == EMassRepresentationType::HighResSpawnedActor)
 			{
-				FMassTrafficVehicleLightsFragment& VehicleLightsFragment = VehicleLightsFragments[EntityIt];
 				const FMassZoneGraphLaneLocationFragment& ZoneGraphLaneLocationFragment = ZoneGraphLaneLocationFragments[EntityIt];
-				const FMassTrafficLaneOffsetFragment& LaneOffsetFragment = LaneOffsetFragments[EntityIt];
-				FMassTrafficVehicleLaneChangeFragment& LaneChangeFragment = LaneChangeFragments[EntityIt];
-				FMassTrafficInterpolationFragment& VehicleMovementInterpolationFragment = VehicleMovementInterpolationFragments[EntityIt];
-				FMassTrafficNextVehicleFragment& NextVehicleFragment = NextVehicleFragments[EntityIt];
+				const FMassTrafficVehicleLaneChangeFragment& LaneChangeFragment = LaneChangeFragments[EntityIt];
 
 				const FZoneGraphStorage* ZoneGraphStorage = ZoneGraphSubsystem.GetZoneGraphStorage(ZoneGraphLaneLocationFragment.LaneHandle.DataHandle);
 				check(ZoneGraphStorage);
 
-				// Get simulated location 
-				const FVector ActorLocation = Actor->GetActorLocation();
-
-				// Get pure lane location
-				FTransform LaneLocationTransform;
-				UE::MassTraffic::InterpolatePositionAndOrientationAlongLane(*ZoneGraphStorage, ZoneGraphLaneLocationFragment.LaneHandle.Index, ZoneGraphLaneLocationFragment.DistanceAlongLane, ETrafficVehicleMovementInterpolationMethod::Linear, VehicleMovementInterpolationFragment.LaneLocationLaneSegment, LaneLocationTransform);
-				
-				// Apply lateral offset
-				LaneLocationTransform.AddToTranslation(LaneLocationTransform.GetRotation().GetRightVector() * LaneOffsetFragment.LateralOffset);
-				
-				// Adjust lane location for lane changing
-				UE::MassTraffic::AdjustVehicleTransformDuringLaneChange(LaneChangeFragment, ZoneGraphLaneLocationFragment.DistanceAlongLane, LaneLocationTransform);
-
-				// Has the entity transform and actual simulated actor transform deviated significantly
-				const float Deviation = FVector::Distance(LaneLocationTransform.GetLocation(), ActorLocation);
-				const float VehicleDeviationTolerance = MassTrafficSettings->VehicleDeviationTolerance *
+				FDeviantVehicleCheckInput& Input = NominalVehicleCheckInputs.AddDefaulted_GetRef();
+				Input.Entity = QueryContext.GetEntity(EntityIt);
+				Input.ZoneGraphStorage = ZoneGraphStorage;
+				Input.ActorLocation = Actor->GetActorLocation();
+				Input.LaneIndex = ZoneGraphLaneLocationFragment.LaneHandle.Index;
+				Input.DistanceAlongLane = ZoneGraphLaneLocationFragment.DistanceAlongLane;
+				Input.LateralOffset = LaneOffsetFragments[EntityIt].LateralOffset;
+				Input.DeviationTolerance = MassTrafficSettings->VehicleDeviationTolerance *
 					(LaneChangeFragment.IsLaneChangeInProgress() ? 1.25f : 1.0f); // ..give a little more tolerance for lane changes (See all LANECHANGEPHYSICS1.)
-				if (Deviation > VehicleDeviationTolerance)
-				{
-					// IMPORTANT!
-					// Make sure we reset the lane change fragment, so it -
-					//		(1) Stops changing the transform of the vehicle.
-					//		(2) Removes any of it's own next-vehicle fragments it might have put on entities.
-					LaneChangeFragment.EndLaneChangeProgression(VehicleLightsFragment, NextVehicleFragment, EntityManager);
-
-					// This vehicle is deviant, add an FTagFragment_MassTrafficObstacle tag to it so it's
-					// considered for obstacle avoidance.
-					const FMassEntityHandle Entity = QueryContext.GetEntity(EntityIt);
-					QueryContext.Defer().AddTag<FMassTrafficObstacleTag>(Entity);
-					QueryContext.Defer().AddFragment<FMassLookAtTargetFragment>(Entity);
-
-					QueryContext.Defer().PushCommand<FMassCommandAddFragments<
-						FMassNavigationObstacleGridCellLocationFragment		// Needed to become an avoidance obstacle
-						, FMassCrowdObstacleFragment>>						// Needed to be a zone graph dynamic obstacle
-						(Entity);
-
-					FMassPillCollider Pill(SimulationParams.HalfWidth, SimulationParams.HalfLength);
-					FMassAvoidanceColliderFragment ColliderFragment(Pill);
-					QueryContext.Defer().PushCommand<FMassCommandAddFragmentInstances>(Entity, ColliderFragment);
-
-					// Debug
-					UE_VLOG_LOCATION(LogOwner, TEXT("MassTraffic Deviants"), Log, ActorLocation, 10.0f, FColor::Red, TEXT("%d Deviated by %f"), QueryContext.GetEntity(EntityIt).Index, Deviation);
-					UE_VLOG_SEGMENT_THICK(LogOwner, TEXT("MassTraffic Deviants"), Log, ActorLocation, LaneLocationTransform.GetLocation(), FColor::Red, 3.0f, TEXT(""));
-				}
+				Input.HalfWidth = SimulationParams.HalfWidth;
+				Input.HalfLength = SimulationParams.HalfLength;
+				Input.LaneChangeFragment = LaneChangeFragment;
+				Input.CachedLaneSegment = VehicleMovementInterpolationFragments[EntityIt].LaneLocationLaneSegment;
 			}
 		}
 	});
 
-	// Check known deviant vehicles to see if they're still deviant
+	// Snapshot known deviant vehicles to check for correction. Vehicles that lost their actor or
+	// dropped below high LOD are trivially corrected right here, without the worker round trip.
+	DeviantVehicleCheckInputs.Reset();
 	DeviantTrafficVehicleEntityQuery.ForEachEntityChunk(Context, [&](FMassExecutionContext& QueryContext)
 	{
 		UMassNavigationSubsystem& NavigationSubsystem = QueryContext.GetMutableSubsystemChecked<UMassNavigationSubsystem>();
@@ -193,60 +276,37 @@ void UMassTrafficFindDeviantTrafficVehiclesProcessor::Execute(FMassEntityManager
 		const TConstArrayView<FMassActorFragment> ActorFragments = QueryContext.GetFragmentView<FMassActorFragment>();
 		const TConstArrayView<FMassTrafficVehicleLaneChangeFragment> LaneChangeFragments = QueryContext.GetFragmentView<FMassTrafficVehicleLaneChangeFragment>();
 		const TArrayView<FMassTrafficInterpolationFragment> VehicleMovementInterpolationFragments = QueryContext.GetMutableFragmentView<FMassTrafficInterpolationFragment>();
-				
-		// Loop obstacles
+
 		for (FMassExecutionContext::FEntityIterator EntityIt = QueryContext.CreateEntityIterator(); EntityIt; ++EntityIt)
 		{
 			const FMassRepresentationFragment& RepresentationFragment = RepresentationFragments[EntityIt];
 			const FMassActorFragment& ActorFragment = ActorFragments[EntityIt];
 
-			bool bDeviant = false;
-			
 			const AActor* Actor = ActorFragment.Get();
 			if (Actor != nullptr && RepresentationFragment.CurrentRepresentation == EMassRepresentationType::HighResSpawnedActor)
 			{
 				const FMassZoneGraphLaneLocationFragment& ZoneGraphLaneLocationFragment = ZoneGraphLaneLocationFragments[EntityIt];
-				const FMassTrafficLaneOffsetFragment& LaneOffsetFragment = LaneOffsetFragments[EntityIt];
-				const FMassTrafficVehicleLaneChangeFragment& LaneChangeFragment = LaneChangeFragments[EntityIt];
-				FMassTrafficInterpolationFragment& VehicleMovementInterpolationFragment = VehicleMovementInterpolationFragments[EntityIt];
 
 				const FZoneGraphStorage* ZoneGraphStorage = ZoneGraphSubsystem.GetZoneGraphStorage(ZoneGraphLaneLocationFragment.LaneHandle.DataHandle);
 				check(ZoneGraphStorage);
-				
-				// Get simulated location 
-				const FVector ActorLocation = Actor->GetActorLocation();
-
-				// Get pure lane location
-				FTransform LaneLocationTransform;
-				UE::MassTraffic::InterpolatePositionAndOrientationAlongLane(*ZoneGraphStorage, ZoneGraphLaneLocationFragment.LaneHandle.Index, ZoneGraphLaneLocationFragment.DistanceAlongLane, ETrafficVehicleMovementInterpolationMethod::Linear, VehicleMovementInterpolationFragment.LaneLocationLaneSegment, LaneLocationTransform);
-				
-				// Apply lateral offset
-				LaneLocationTransform.AddToTranslation(LaneLocationTransform.GetRotation().GetRightVector() * LaneOffsetFragment.LateralOffset);
-
-				// Adjust lane location for lane changing
-				UE::MassTraffic::AdjustVehicleTransformDuringLaneChange(LaneChangeFragment, ZoneGraphLaneLocationFragment.DistanceAlongLane, LaneLocationTransform);
-				
-				// Has the entity transform and actual simulated actor transform deviated significantly
-				const float Deviation = FVector::Distance(LaneLocationTransform.GetLocation(), ActorLocation);
-				if (Deviation > MassTrafficSettings->VehicleDeviationTolerance)
-				{
-					bDeviant = true;
-				}
-				else
-				{
-					// Debug
-					UE_VLOG_LOCATION(LogOwner, TEXT("MassTraffic Deviants"), Log, ActorLocation, 10.0f, FColor::Green, TEXT("%d Corrected"), QueryContext.GetEntity(EntityIt).Index);
-				}
+
+				FDeviantVehicleCheckInput& Input = DeviantVehicleCheckInputs.AddDefaulted_GetRef();
+				Input.Entity = QueryContext.GetEntity(EntityIt);
+				Input.ZoneGraphStorage = ZoneGraphStorage;
+				Input.ActorLocation = Actor->GetActorLocation();
+				Input.LaneIndex = ZoneGraphLaneLocationFragment.LaneHandle.Index;
+				Input.DistanceAlongLane = ZoneGraphLaneLocationFragment.DistanceAlongLane;
+				Input.LateralOffset = LaneOffsetFragments[EntityIt].LateralOffset;
+				Input.DeviationTolerance = MassTrafficSettings->VehicleDeviationTolerance;
+				Input.LaneChangeFragment = LaneChangeFragments[EntityIt];
+				Input.CachedLaneSegment = VehicleMovementInterpolationFragments[EntityIt].LaneLocationLaneSegment;
 			}
 			else
 			{
 				// Debug
 				UE_VLOG(LogOwner, TEXT("MassTraffic Deviants"), Log, TEXT("%d Corrected"), QueryContext.GetEntity(EntityIt).Index);
-			}
 
-			if (!bDeviant)
-			{
-				RemoveDeviantFragments(EntityManager, QueryContext, NavigationSubsystem, EntityIt);
+				RemoveDeviantFragments(EntityManager, QueryContext, NavigationSubsystem, QueryContext.GetEntity(EntityIt));
 			}
 		}
 	});
@@ -258,7 +318,41 @@ void UMassTrafficFindDeviantTrafficVehiclesProcessor::Execute(FMassEntityManager
 
 		for (FMassExecutionContext::FEntityIterator EntityIt = QueryContext.CreateEntityIterator(); EntityIt; ++EntityIt)
 		{
-			RemoveDeviantFragments(EntityManager, QueryContext, NavigationSubsystem, EntityIt);
+			RemoveDeviantFragments(EntityManager, QueryContext, NavigationSubsystem, QueryContext.GetEntity(EntityIt));
 		}
 	});
-}
\ No newline at end of file
+
+	// Run the deviance tests on a worker thread, results are consumed next frame. The snapshots are
+	// self-contained value copies, and the zone graph storage they point at is static after load, so
+	// the task doesn't touch entity data. (See all ASYNCDEVIANT.)
+	if (!NominalVehicleCheckInputs.IsEmpty() || !DeviantVehicleCheckInputs.IsEmpty())
+	{
+		DeviantCheckTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this]()
+		{
+			FTransform LaneLocationTransform;
+
+			for (FDeviantVehicleCheckInput& Input : NominalVehicleCheckInputs)
+			{
+				const float Deviation = ComputeLaneDeviation(Input, LaneLocationTransform);
+				if (Deviation > Input.DeviationTolerance)
+				{
+					FDeviantVehicleCheckResult& Result = NewlyDeviantVehicles.AddDefaulted_GetRef();
+					Result.Entity = Input.Entity;
+					Result.ActorLocation = Input.ActorLocation;
+					Result.Deviation = Deviation;
+					Result.HalfWidth = Input.HalfWidth;
+					Result.HalfLength = Input.HalfLength;
+				}
+			}
+
+			for (FDeviantVehicleCheckInput& Input : DeviantVehicleCheckInputs)
+			{
+				const float Deviation = ComputeLaneDeviation(Input, LaneLocationTransform);
+				if (Deviation <= Input.DeviationTolerance)
+				{
+					CorrectedVehicles.Add(Input.Entity);
+				}
+			}
+		});
+	}
+}
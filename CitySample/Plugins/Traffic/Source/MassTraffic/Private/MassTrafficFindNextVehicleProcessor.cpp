@@ -1,7 +1,9 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "MassTrafficFindNextVehicleProcessor.h"
+#include "MassTraffic.h"
 #include "MassTrafficFragments.h"
+#include "MassTrafficInitTrafficVehiclesProcessor.h"
 #include "MassEntityView.h"
 #include "MassExecutionContext.h"
 #include "MassZoneGraphNavigationFragments.h"
@@ -10,7 +12,14 @@
 UMassTrafficFindNextVehicleProcessor::UMassTrafficFindNextVehicleProcessor()
 	: EntityQuery(*this)
 {
-	bAutoRegisterWithProcessingPhases = false;
+	// Registered at frame end purely for the optional periodic chain rebuild
+	// behind MassTraffic.NextVehicleRescanInterval. With the CVar at its
+	// default of 0 the per-frame run early-outs; the full scan otherwise only
+	// runs as a post spawn processor, with incremental splicing at lane
+	// transitions (see MassTrafficMovement.cpp) maintaining the chains from
+	// then on.
+	bAutoRegisterWithProcessingPhases = true;
+	ProcessingPhase = EMassProcessingPhase::FrameEnd;
 }
 
 void UMassTrafficFindNextVehicleProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
@@ -24,6 +33,28 @@ void UMassTrafficFindNextVehicleProcessor::ConfigureQueries(const TSharedRef<FMa
 
 void UMassTrafficFindNextVehicleProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
+	// Post spawn passes (identified by the spawner handing us the vehicle spawn
+	// data as aux input) always run. The registered per-frame run is only the
+	// periodic validation fallback: lane transitions splice the chains
+	// incrementally, so a full rescan is only worthwhile to repair chains
+	// corrupted by missed transitions, at the interval set by the CVar.
+	if (!Context.GetAuxData().GetPtr<FMassTrafficVehiclesSpawnData>())
+	{
+		if (GMassTrafficNextVehicleRescanInterval <= 0.0f)
+		{
+			return;
+		}
+
+		const UWorld* World = EntityManager.GetWorld();
+		check(World);
+		const double Now = World->GetTimeSeconds();
+		if (TimeOfLastRescan >= 0.0 && Now - TimeOfLastRescan < GMassTrafficNextVehicleRescanInterval)
+		{
+			return;
+		}
+		TimeOfLastRescan = Now;
+	}
+
 	UMassTrafficSubsystem& MassTrafficSubsystem = Context.GetMutableSubsystemChecked<UMassTrafficSubsystem>();
 
 	// Gather all fragments
@@ -11,6 +11,7 @@
 #include "DrawDebugHelpers.h"
 #include "MassEntityView.h"
 #include "MassExecutionContext.h"
+#include "MassMovementFragments.h"
 #include "MassTrafficVehicleSimulationTrait.h"
 #include "ZoneGraphSubsystem.h"
 #include "VisualLogger/VisualLogger.h"
@@ -51,6 +52,7 @@ void UMassTrafficFindObstaclesProcessor::ConfigureQueries(const TSharedRef<FMass
 	ObstacleEntityQuery.AddTagRequirement<FMassTrafficObstacleTag>(EMassFragmentPresence::All);
 	ObstacleEntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
 	ObstacleEntityQuery.AddRequirement<FAgentRadiusFragment>(EMassFragmentAccess::ReadOnly);
+	ObstacleEntityQuery.AddRequirement<FMassVelocityFragment>(EMassFragmentAccess::ReadOnly, EMassFragmentPresence::Optional);
 	ObstacleEntityQuery.AddConstSharedRequirement<FMassTrafficVehicleSimulationParameters>(EMassFragmentPresence::Optional);
 	ObstacleEntityQuery.AddSubsystemRequirement<UZoneGraphSubsystem>(EMassFragmentAccess::ReadOnly);
 	ObstacleEntityQuery.AddSubsystemRequirement<UMassTrafficSubsystem>(EMassFragmentAccess::ReadOnly);
@@ -80,7 +82,14 @@ void UMassTrafficFindObstaclesProcessor::Execute(FMassEntityManager& EntityManag
 		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FindVehiclesForObstacles"))
 
 		TMap<FMassEntityHandle, TArray<FMassEntityHandle>> ObstacleListsToAdd;
-		
+
+		// Rebuild the per-frame obstacle grid as we visit each obstacle below, so downstream
+		// processors can look obstacles up spatially instead of scanning them all. (See all OBSTACLEGRID.)
+		UMassTrafficSubsystem* MutableMassTrafficSubsystem = UWorld::GetSubsystem<UMassTrafficSubsystem>(GetWorld());
+		check(MutableMassTrafficSubsystem);
+		FMassTrafficObstacleGrid& ObstacleGrid = MutableMassTrafficSubsystem->GetMutableObstacleGrid();
+		ObstacleGrid.Reset(MassTrafficSettings->ObstacleGridCellSize);
+
 		ObstacleEntityQuery.ForEachEntityChunk(Context, [&](FMassExecutionContext& QueryContext)
 		{
 			const UMassTrafficSubsystem& MassTrafficSubsystem = QueryContext.GetSubsystemChecked<UMassTrafficSubsystem>();
@@ -89,6 +98,7 @@ void UMassTrafficFindObstaclesProcessor::Execute(FMassEntityManager& EntityManag
 			const FMassTrafficVehicleSimulationParameters* VehicleSimulationParams = QueryContext.GetConstSharedFragmentPtr<FMassTrafficVehicleSimulationParameters>();
 			const TConstArrayView<FAgentRadiusFragment> AgentRadiusFragments = QueryContext.GetFragmentView<FAgentRadiusFragment>();
 			const TConstArrayView<FTransformFragment> TransformFragments = QueryContext.GetFragmentView<FTransformFragment>();
+			const TConstArrayView<FMassVelocityFragment> OptionalVelocityFragments = QueryContext.GetFragmentView<FMassVelocityFragment>();
 
 			// Loop obstacles and find affected vehicles
 			for (FMassExecutionContext::FEntityIterator EntityIt = QueryContext.CreateEntityIterator(); EntityIt; ++EntityIt)
@@ -99,6 +109,14 @@ void UMassTrafficFindObstaclesProcessor::Execute(FMassEntityManager& EntityManag
 
 				const float AgentWidth = VehicleSimulationParams ? VehicleSimulationParams->HalfWidth : AgentRadiusFragment.Radius;
 
+				// Add this obstacle to the grid. (See all OBSTACLEGRID.)
+				FMassTrafficObstacleGridEntry ObstacleGridEntry;
+				ObstacleGridEntry.Entity = ObstacleEntity;
+				ObstacleGridEntry.Location = TransformFragment.GetTransform().GetLocation();
+				ObstacleGridEntry.Velocity = OptionalVelocityFragments.IsEmpty() ? FVector::ZeroVector : OptionalVelocityFragments[EntityIt].Value;
+				ObstacleGridEntry.Radius = AgentRadiusFragment.Radius;
+				ObstacleGrid.Add(ObstacleGridEntry);
+
 				// Debug draw obstacle
 				#if WITH_MASSTRAFFIC_DEBUG
 					if (GMassTrafficDebugObstacleAvoidance)
@@ -121,7 +139,7 @@ void UMassTrafficFindObstaclesProcessor::Execute(FMassEntityManager& EntityManag
 				// Find nearby lanes for this obstacle
 				TArray<FZoneGraphLaneHandle> NearbyLanes;
 				FBox SearchBox = FBox::BuildAABB(TransformFragment.GetTransform().GetLocation(), FVector(FVector2D(MassTrafficSettings->ObstacleSearchRadius), MassTrafficSettings->ObstacleSearchHeight));
-				ZoneGraphSubsystem.FindOverlappingLanes(SearchBox, GetDefault<UMassTrafficSettings>()->TrafficLaneFilter, NearbyLanes);
+				ZoneGraphSubsystem.FindOverlappingLanes(SearchBox, MassTrafficSettings->TrafficLaneFilter, NearbyLanes);
 
 				// Loop over nearby lanes
 				for (const FZoneGraphLaneHandle NearbyLane : NearbyLanes)
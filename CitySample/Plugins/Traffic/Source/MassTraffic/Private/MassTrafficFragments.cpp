@@ -105,12 +105,8 @@ bool FMassTrafficLaneToTrafficLightMap::SetTrafficLightForLanes(const TArray<FZo
 
 int8 FMassTrafficLaneToTrafficLightMap::GetTrafficLightForLane(const FZoneGraphTrafficLaneData* VehicleTrafficLaneData) const
 {
-	if (!Map.Contains(VehicleTrafficLaneData))
-	{
-		return INDEX_NONE;
-	}
-		
-	return Map[VehicleTrafficLaneData];
+	const int8* TrafficLightIndex = Map.Find(VehicleTrafficLaneData);
+	return TrafficLightIndex ? *TrafficLightIndex : static_cast<int8>(INDEX_NONE);
 }
 
 
@@ -158,25 +154,18 @@ FMassTrafficLightControl* FMassTrafficPeriod::GetTrafficLightControl(const int8
 	return &TrafficLightControls[TrafficLightIndex];
 }
 
-bool FMassTrafficPeriod::VehicleLaneClosesInNextPeriod(FZoneGraphTrafficLaneData* VehicleLane) const
+bool FMassTrafficPeriod::VehicleLaneClosesInNextPeriod(const int32 VehicleLaneIndex) const
 {
-	// Not the most efficient code here.
-
-	const int32 RealIndex = VehicleLanes.Find(VehicleLane);
-	if (RealIndex == INDEX_NONE)
+	// Straight bit test against the mask built in FMassTrafficIntersectionFragment::Finalize. Callers already index
+	// 'open vehicle lanes', so there is no need to search it here.
+	if (VehicleLaneIndex < 0 || VehicleLaneIndex >= VehicleLaneClosedInNextPeriodMask.Num())
 	{
-		UE_LOG(LogMassTraffic, Error, TEXT("%s - For testing if 'open vehicle lane closes in next period', lane fragment was not found in 'open vehicle lanes'."),
-			ANSI_TO_TCHAR(__builtin_FUNCTION()), RealIndex);
-		return false;
-	}
-	if (RealIndex > 255)
-	{
-		UE_LOG(LogMassTraffic, Error, TEXT("%s - For testing if 'open vehicle lane closes in next period', index into 'open vehicle lanes' %d is bigger than max 255."),
-			ANSI_TO_TCHAR(__builtin_FUNCTION()), RealIndex);
+		UE_LOG(LogMassTraffic, Error, TEXT("%s - For testing if 'open vehicle lane closes in next period', index into 'open vehicle lanes' %d is out of range (mask has %d bits)."),
+			ANSI_TO_TCHAR(__builtin_FUNCTION()), VehicleLaneIndex, VehicleLaneClosedInNextPeriodMask.Num());
 		return false;
 	}
 
-	return VehicleLaneIndices_ClosedInNextPeriod.Contains(RealIndex);
+	return VehicleLaneClosedInNextPeriodMask[VehicleLaneIndex];
 }
 
 
@@ -220,7 +209,7 @@ void FMassTrafficIntersectionFragment::ApplyLanesActionToCurrentPeriod(
 			}
 			else if (VehicleLanesAction == EMassTrafficPeriodLanesAction::SoftClose)
 			{
-				VehicleTrafficLaneData->bIsOpen = !CurrentPeriod.VehicleLaneClosesInNextPeriod(VehicleTrafficLaneData);
+				VehicleTrafficLaneData->bIsOpen = !CurrentPeriod.VehicleLaneClosesInNextPeriod(I);
 				VehicleTrafficLaneData->bIsAboutToClose = false;
 			}
 			else if (VehicleLanesAction == EMassTrafficPeriodLanesAction::HardPrepareToClose)
@@ -229,7 +218,7 @@ void FMassTrafficIntersectionFragment::ApplyLanesActionToCurrentPeriod(
 			}
 			else if (VehicleLanesAction == EMassTrafficPeriodLanesAction::SoftPrepareToClose)
 			{
-				VehicleTrafficLaneData->bIsAboutToClose = CurrentPeriod.VehicleLaneClosesInNextPeriod(VehicleTrafficLaneData);
+				VehicleTrafficLaneData->bIsAboutToClose = CurrentPeriod.VehicleLaneClosesInNextPeriod(I);
 			}
 		}
 	
@@ -366,6 +355,8 @@ void FMassTrafficIntersectionFragment::Finalize(const FMassTrafficLaneToTrafficL
 		FMassTrafficPeriod& ThisPeriod = Periods[P];
 		FMassTrafficPeriod& NextPeriod = Periods[(P + 1) % NumPeriods];
 
+		ThisPeriod.VehicleLaneClosedInNextPeriodMask.Init(false, ThisPeriod.NumVehicleLanes(EMassTrafficIntersectionVehicleLaneType::VehicleLane));
+
 		for (int32 I = 0; I < ThisPeriod.NumVehicleLanes(EMassTrafficIntersectionVehicleLaneType::VehicleLane); I++)
 		{
 			const FZoneGraphTrafficLaneData* ThisTrafficLaneData = ThisPeriod.GetVehicleLane(I, EMassTrafficIntersectionVehicleLaneType::VehicleLane);
@@ -389,6 +380,7 @@ void FMassTrafficIntersectionFragment::Finalize(const FMassTrafficLaneToTrafficL
 				}
 				
 				ThisPeriod.VehicleLaneIndices_ClosedInNextPeriod.Add(I);
+				ThisPeriod.VehicleLaneClosedInNextPeriodMask[I] = true;
 			}
 		}
 	}
@@ -22,7 +22,11 @@ void UMassTrafficInitInterpolationProcessor::ConfigureQueries(const TSharedRef<F
 {
 	EntityQuery.AddRequirement<FMassZoneGraphLaneLocationFragment>(EMassFragmentAccess::ReadOnly);
 
-	EntityQuery.AddRequirement<FMassTrafficInterpolationFragment>(EMassFragmentAccess::ReadWrite);
+	// Presence only. The per-entity segment caches are deliberately left
+	// default-constructed here; InterpolatePositionAndOrientationAlongLane
+	// builds them on the first frame an interpolating LOD actually evaluates
+	// them, so vehicles that stay in low LOD never pay for (or dirty) them.
+	EntityQuery.AddRequirement<FMassTrafficInterpolationFragment>(EMassFragmentAccess::None, EMassFragmentPresence::All);
 	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadWrite);
 	EntityQuery.AddSubsystemRequirement<UZoneGraphSubsystem>(EMassFragmentAccess::ReadOnly);
 }
@@ -34,28 +38,32 @@ void UMassTrafficInitInterpolationProcessor::Execute(FMassEntityManager& EntityM
 		const UZoneGraphSubsystem& ZoneGraphSubsystem = QueryContext.GetSubsystemChecked<UZoneGraphSubsystem>();
 
 		const TConstArrayView<FMassZoneGraphLaneLocationFragment> LaneLocationFragments = QueryContext.GetFragmentView<FMassZoneGraphLaneLocationFragment>();
-		const TArrayView<FMassTrafficInterpolationFragment> VehicleMovementInterpolationFragments = QueryContext.GetMutableFragmentView<FMassTrafficInterpolationFragment>();
 		const TArrayView<FTransformFragment> TransformFragments = QueryContext.GetMutableFragmentView<FTransformFragment>();
-		
+
+		// Shared segment cursor for seeding the spawn transforms. Spawn points
+		// come in lane order, so consecutive vehicles on the same segment reuse
+		// it instead of each entity rebuilding a segment of its own from the
+		// lane start.
+		FMassTrafficLaneSegment LaneSegment;
+
 		for (FMassExecutionContext::FEntityIterator EntityIt = QueryContext.CreateEntityIterator(); EntityIt; ++EntityIt)
 		{
 			const FMassZoneGraphLaneLocationFragment& LaneLocationFragment = LaneLocationFragments[EntityIt];
-			FMassTrafficInterpolationFragment& VehicleMovementInterpolationFragment = VehicleMovementInterpolationFragments[EntityIt];
 			FTransformFragment& TransformFragment = TransformFragments[EntityIt];
 
 			const FZoneGraphStorage* ZoneGraphStorage = ZoneGraphSubsystem.GetZoneGraphStorage(LaneLocationFragment.LaneHandle.DataHandle);
 			check(ZoneGraphStorage);
-			
+
 			// Interpolate initial transform
-			UE::MassTraffic::InterpolatePositionAndOrientationAlongLane(*ZoneGraphStorage, LaneLocationFragment.LaneHandle.Index, LaneLocationFragment.DistanceAlongLane, ETrafficVehicleMovementInterpolationMethod::Linear, VehicleMovementInterpolationFragment.LaneLocationLaneSegment, TransformFragment.GetMutableTransform());
+			UE::MassTraffic::InterpolatePositionAndOrientationAlongLane(*ZoneGraphStorage, LaneLocationFragment.LaneHandle.Index, LaneLocationFragment.DistanceAlongLane, ETrafficVehicleMovementInterpolationMethod::Linear, LaneSegment, TransformFragment.GetMutableTransform());
 
 			// Debug
 			if (GMassTrafficDebugInterpolation)
 			{
-				DrawDebugPoint(World, VehicleMovementInterpolationFragment.LaneLocationLaneSegment.StartPoint, 20.0f, FColor::Red);
-				DrawDebugPoint(World, VehicleMovementInterpolationFragment.LaneLocationLaneSegment.StartControlPoint, 20.0f, FColor::Green);
-				DrawDebugPoint(World, VehicleMovementInterpolationFragment.LaneLocationLaneSegment.EndControlPoint, 20.0f, FColor::Blue);
-				DrawDebugPoint(World, VehicleMovementInterpolationFragment.LaneLocationLaneSegment.EndPoint, 20.0f, FColor::Cyan);
+				DrawDebugPoint(World, LaneSegment.StartPoint, 20.0f, FColor::Red);
+				DrawDebugPoint(World, LaneSegment.StartControlPoint, 20.0f, FColor::Green);
+				DrawDebugPoint(World, LaneSegment.EndControlPoint, 20.0f, FColor::Blue);
+				DrawDebugPoint(World, LaneSegment.EndPoint, 20.0f, FColor::Cyan);
 			}
 		}
 	});
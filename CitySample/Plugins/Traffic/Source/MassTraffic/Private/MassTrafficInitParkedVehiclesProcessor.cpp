@@ -34,10 +34,44 @@ void UMassTrafficInitParkedVehiclesProcessor::Execute(FMassEntityManager& Entity
 	// Reset random stream used to seed FDataFragment_RandomFraction::RandomFraction
 	RandomStream.Reset();
 
-	// Init dynamic vehicle data 
-	int32 VehicleIndex = 0;
+	// First pass (serial, cheap): record each chunk's base offset into the flat
+	// spawn data, keyed by the chunk's first entity so the parallel pass can
+	// find its slice regardless of dispatch order, and pre-draw the random
+	// fractions so the draw order matches the old serial initialization exactly.
+	int32 NumEntities = 0;
+	TMap<FMassEntityHandle, int32> ChunkBaseIndices;
 	EntityQuery.ForEachEntityChunk(Context, [&](FMassExecutionContext& Context)
 	{
+		if (Context.GetNumEntities() > 0)
+		{
+			ChunkBaseIndices.Add(Context.GetEntity(0), NumEntities);
+			NumEntities += Context.GetNumEntities();
+		}
+	});
+
+	TArray<float> RandomFractions;
+	RandomFractions.Reserve(NumEntities);
+	for (int32 Index = 0; Index < NumEntities; ++Index)
+	{
+		RandomFractions.Add(RandomStream.GetFraction());
+	}
+
+	// Second pass: init dynamic vehicle data in parallel across chunks; the
+	// thousands of transform copies dominate parked vehicle init time at load.
+	EntityQuery.ParallelForEachEntityChunk(Context, [&](FMassExecutionContext& Context)
+	{
+		if (Context.GetNumEntities() == 0)
+		{
+			return;
+		}
+
+		const int32* BaseIndex = ChunkBaseIndices.Find(Context.GetEntity(0));
+		if (!ensure(BaseIndex))
+		{
+			return;
+		}
+		int32 VehicleIndex = *BaseIndex;
+
 		TArrayView<FTransformFragment> TransformFragments = Context.GetMutableFragmentView<FTransformFragment>();
 		TArrayView<FMassRepresentationFragment> VisualizationFragments = Context.GetMutableFragmentView<FMassRepresentationFragment>();
 		TArrayView<FMassTrafficRandomFractionFragment> RandomFractionFragments = Context.GetMutableFragmentView<FMassTrafficRandomFractionFragment>();
@@ -45,16 +79,16 @@ void UMassTrafficInitParkedVehiclesProcessor::Execute(FMassEntityManager& Entity
 		for (FMassExecutionContext::FEntityIterator EntityIt = Context.CreateEntityIterator(); EntityIt; ++EntityIt)
 		{
 			check(VehiclesSpawnData.Transforms.IsValidIndex(VehicleIndex));
-			
+
 			// Init transform
 			TransformFragments[EntityIt].GetMutableTransform() = VehiclesSpawnData.Transforms[VehicleIndex];
 
 			// Init PrevTransform here too as we expect it to stay static, so we set it here initally once and don't
-			// need to update it after that  
+			// need to update it after that
 			VisualizationFragments[EntityIt].PrevTransform = VehiclesSpawnData.Transforms[VehicleIndex];
 
 			// Init random fraction
-			RandomFractionFragments[EntityIt].RandomFraction = RandomStream.GetFraction();
+			RandomFractionFragments[EntityIt].RandomFraction = RandomFractions[VehicleIndex];
 
 			// Advance through spawn data
 			++VehicleIndex;
@@ -3,67 +3,164 @@
 #include "MassTrafficInstancePlaybackHelpers.h"
 #include "AnimToTextureDataAsset.h"
 
-//void UAnimToTextureInstancePlaybackLibrary::SetupInstancedMeshComponent(UInstancedStaticMeshComponent* InstancedMeshComponent, FAnimToTextureInstanceData& InstanceData, int32 NumInstances)
-//{
-//	if (InstancedMeshComponent)
-//	{
-//		InstancedMeshComponent->NumCustomDataFloats = InstanceData.PlaybackData.GetTypeSize() / sizeof(float);
-//		InstancedMeshComponent->PerInstanceSMData.Reset();
-//		InstancedMeshComponent->PerInstanceSMData.AddDefaulted(NumInstances);
-//		InstancedMeshComponent->PreAllocateInstancesMemory(NumInstances);
-//		InstancedMeshComponent->PerInstanceSMCustomData.SetNumZeroed(NumInstances * InstancedMeshComponent->NumCustomDataFloats);
-//		AllocateInstanceData(InstanceData, NumInstances);
-//	}
-//}
-//
-//void UAnimToTextureInstancePlaybackLibrary::BatchUpdateInstancedMeshComponent(UInstancedStaticMeshComponent* InstancedMeshComponent, FAnimToTextureInstanceData& InstanceData)
-//{
-//	SIZE_T CustomDataSizeToCopy = FMath::Min(InstanceData.PlaybackData.Num() * InstanceData.PlaybackData.GetTypeSize(), InstancedMeshComponent->PerInstanceSMCustomData.Num() * InstancedMeshComponent->PerInstanceSMCustomData.GetTypeSize());
-//	FMemory::Memcpy(InstancedMeshComponent->PerInstanceSMCustomData.GetData(), InstanceData.PlaybackData.GetData(), CustomDataSizeToCopy);
-//
-//	int32 TransformsToCopy = FMath::Min(InstancedMeshComponent->GetNumRenderInstances(), InstanceData.StaticMeshInstanceData.Num());
-//	InstancedMeshComponent->BatchUpdateInstancesData(0, TransformsToCopy, InstanceData.StaticMeshInstanceData.GetData(), true, false);
-//}
-//
-//void UAnimToTextureInstancePlaybackLibrary::AllocateInstanceData(FAnimToTextureInstanceData& InstanceData, int32 Count)
-//{
-//	InstanceData.StaticMeshInstanceData.AddDefaulted(Count);
-//	InstanceData.PlaybackData.AddDefaulted(Count);
-//}
-//
-//bool UAnimToTextureInstancePlaybackLibrary::UpdateInstanceData(FAnimToTextureInstanceData& InstanceData, int32 InstanceIndex, const FAnimToTextureInstancePlaybackData& PlaybackData, const FTransform& Transform)
-//{
-//	if (InstanceData.PlaybackData.IsValidIndex(InstanceIndex) && InstanceData.StaticMeshInstanceData.IsValidIndex(InstanceIndex))
-//	{
-//		InstanceData.PlaybackData[InstanceIndex] = PlaybackData;
-//		InstanceData.StaticMeshInstanceData[InstanceIndex].Transform = Transform.ToMatrixWithScale();
-//		return true;
-//	}
-//
-//	return false;
-//}
-//
-//bool UAnimToTextureInstancePlaybackLibrary::GetInstancePlaybackData(const FAnimToTextureInstanceData& InstanceData, int32 InstanceIndex, FAnimToTextureInstancePlaybackData& InstancePlaybackData)
-//{
-//	if (InstanceData.PlaybackData.IsValidIndex(InstanceIndex))
-//	{
-//		InstancePlaybackData = InstanceData.PlaybackData[InstanceIndex];
-//		return true;
-//	}
-//	
-//	return false;
-//}
-//
-//bool UAnimToTextureInstancePlaybackLibrary::GetInstanceTransform(const FAnimToTextureInstanceData& InstanceData, int32 InstanceIndex, FTransform& InstanceTransform)
-//{
-//	if (InstanceData.StaticMeshInstanceData.IsValidIndex(InstanceIndex))
-//	{
-//		InstanceTransform = FTransform(InstanceData.StaticMeshInstanceData[InstanceIndex].Transform);
-//		return true;
-//	}
-//
-//	return false;
-//}
+void UMassTrafficInstancePlaybackLibrary::SetupInstancedMeshComponent(UInstancedStaticMeshComponent* InstancedMeshComponent, FMassTrafficInstanceData& InstanceData, int32 NumInstances)
+{
+	if (InstancedMeshComponent)
+	{
+		InstancedMeshComponent->NumCustomDataFloats = InstanceData.PlaybackData.GetTypeSize() / sizeof(float);
+		InstancedMeshComponent->PerInstanceSMData.Reset();
+		InstancedMeshComponent->PerInstanceSMData.AddDefaulted(NumInstances);
+		InstancedMeshComponent->PreAllocateInstancesMemory(NumInstances);
+		InstancedMeshComponent->PerInstanceSMCustomData.SetNumZeroed(NumInstances * InstancedMeshComponent->NumCustomDataFloats);
+
+		InstanceData.PlaybackData.Reset();
+		InstanceData.StaticMeshInstanceData.Reset();
+		InstanceData.FreeInstanceIndices.Reset();
+		InstanceData.ResetDirtyRange();
+		AllocateInstanceData(InstanceData, NumInstances);
+	}
+}
+
+void UMassTrafficInstancePlaybackLibrary::BatchUpdateInstancedMeshComponent(UInstancedStaticMeshComponent* InstancedMeshComponent, FMassTrafficInstanceData& InstanceData)
+{
+	if (!InstancedMeshComponent || InstanceData.FirstDirtyInstance == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Clamp the dirty range to what the component can actually hold, and upload only that range
+	// instead of memcpy'ing the full custom data array and re-sending every transform.
+	// (See all ISMDIRTYRANGE.)
+	const int32 NumCustomDataFloats = InstanceData.PlaybackData.GetTypeSize() / sizeof(float);
+	const int32 FirstInstance = InstanceData.FirstDirtyInstance;
+	const int32 LastInstance = FMath::Min3(InstanceData.LastDirtyInstance, InstanceData.StaticMeshInstanceData.Num() - 1, InstancedMeshComponent->GetInstanceCount() - 1);
+	if (LastInstance < FirstInstance)
+	{
+		InstanceData.ResetDirtyRange();
+		return;
+	}
+	const int32 NumDirtyInstances = LastInstance - FirstInstance + 1;
+
+	if (InstancedMeshComponent->NumCustomDataFloats == NumCustomDataFloats &&
+		InstancedMeshComponent->PerInstanceSMCustomData.Num() >= (LastInstance + 1) * NumCustomDataFloats)
+	{
+		FMemory::Memcpy(&InstancedMeshComponent->PerInstanceSMCustomData[FirstInstance * NumCustomDataFloats], &InstanceData.PlaybackData[FirstInstance], NumDirtyInstances * NumCustomDataFloats * sizeof(float));
+	}
+
+	InstancedMeshComponent->BatchUpdateInstancesData(FirstInstance, NumDirtyInstances, &InstanceData.StaticMeshInstanceData[FirstInstance], /*bMarkRenderStateDirty*/true, /*bForceFullUpdate*/false);
+
+	InstanceData.ResetDirtyRange();
+}
+
+void UMassTrafficInstancePlaybackLibrary::AllocateInstanceData(FMassTrafficInstanceData& InstanceData, int32 Count)
+{
+	InstanceData.StaticMeshInstanceData.AddDefaulted(Count);
+	InstanceData.PlaybackData.AddDefaulted(Count);
+}
+
+int32 UMassTrafficInstancePlaybackLibrary::AcquireInstance(FMassTrafficInstanceData& InstanceData)
+{
+	int32 InstanceIndex;
+	if (!InstanceData.FreeInstanceIndices.IsEmpty())
+	{
+		InstanceIndex = InstanceData.FreeInstanceIndices.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		InstanceIndex = InstanceData.PlaybackData.AddDefaulted();
+		InstanceData.StaticMeshInstanceData.AddDefaulted();
+	}
+
+	InstanceData.MarkInstanceDirty(InstanceIndex);
+	return InstanceIndex;
+}
+
+void UMassTrafficInstancePlaybackLibrary::ReleaseInstance(FMassTrafficInstanceData& InstanceData, int32 InstanceIndex)
+{
+	if (InstanceData.PlaybackData.IsValidIndex(InstanceIndex) && !InstanceData.FreeInstanceIndices.Contains(InstanceIndex))
+	{
+		// Collapse released instances to zero scale so they stop rendering until reused or
+		// compacted away. (See all ISMDIRTYRANGE.)
+		InstanceData.PlaybackData[InstanceIndex] = FMassTrafficInstancePlaybackData();
+		InstanceData.StaticMeshInstanceData[InstanceIndex].Transform = FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector).ToMatrixWithScale();
+		InstanceData.FreeInstanceIndices.Add(InstanceIndex);
+		InstanceData.MarkInstanceDirty(InstanceIndex);
+	}
+}
+
+bool UMassTrafficInstancePlaybackLibrary::UpdateInstanceData(FMassTrafficInstanceData& InstanceData, int32 InstanceIndex, const FMassTrafficInstancePlaybackData& PlaybackData, const FTransform& Transform)
+{
+	if (InstanceData.PlaybackData.IsValidIndex(InstanceIndex) && InstanceData.StaticMeshInstanceData.IsValidIndex(InstanceIndex))
+	{
+		InstanceData.PlaybackData[InstanceIndex] = PlaybackData;
+		InstanceData.StaticMeshInstanceData[InstanceIndex].Transform = Transform.ToMatrixWithScale();
+		InstanceData.MarkInstanceDirty(InstanceIndex);
+		return true;
+	}
+
+	return false;
+}
+
+bool UMassTrafficInstancePlaybackLibrary::GetInstancePlaybackData(const FMassTrafficInstanceData& InstanceData, int32 InstanceIndex, FMassTrafficInstancePlaybackData& InstancePlaybackData)
+{
+	if (InstanceData.PlaybackData.IsValidIndex(InstanceIndex))
+	{
+		InstancePlaybackData = InstanceData.PlaybackData[InstanceIndex];
+		return true;
+	}
+
+	return false;
+}
+
+bool UMassTrafficInstancePlaybackLibrary::GetInstanceTransform(const FMassTrafficInstanceData& InstanceData, int32 InstanceIndex, FTransform& InstanceTransform)
+{
+	if (InstanceData.StaticMeshInstanceData.IsValidIndex(InstanceIndex))
+	{
+		InstanceTransform = FTransform(InstanceData.StaticMeshInstanceData[InstanceIndex].Transform);
+		return true;
+	}
+
+	return false;
+}
+
+bool UMassTrafficInstancePlaybackLibrary::CompactInstances(UInstancedStaticMeshComponent* InstancedMeshComponent, FMassTrafficInstanceData& InstanceData, float FreeSlotRatioThreshold)
+{
+	if (!InstancedMeshComponent || InstanceData.FreeInstanceIndices.IsEmpty() || InstanceData.FreeSlotRatio() < FreeSlotRatioThreshold)
+	{
+		return false;
+	}
+
+	// Remove free slots highest-index-first with swap removal, so swaps at higher indices can't
+	// disturb pending removals at lower indices. (See all ISMDIRTYRANGE.)
+	InstanceData.FreeInstanceIndices.Sort(TGreater<int32>());
+	for (const int32 FreeInstanceIndex : InstanceData.FreeInstanceIndices)
+	{
+		InstanceData.PlaybackData.RemoveAtSwap(FreeInstanceIndex);
+		InstanceData.StaticMeshInstanceData.RemoveAtSwap(FreeInstanceIndex);
+	}
+	InstanceData.FreeInstanceIndices.Reset();
+
+	// Shrink the component to the compacted instance count and re-upload everything once.
+	const int32 NumInstances = InstanceData.StaticMeshInstanceData.Num();
+	const int32 NumCustomDataFloats = InstanceData.PlaybackData.GetTypeSize() / sizeof(float);
+	InstancedMeshComponent->PerInstanceSMData.SetNum(NumInstances);
+	InstancedMeshComponent->PerInstanceSMCustomData.SetNumZeroed(NumInstances * NumCustomDataFloats);
+	if (InstancedMeshComponent->NumCustomDataFloats == NumCustomDataFloats && NumInstances > 0)
+	{
+		FMemory::Memcpy(InstancedMeshComponent->PerInstanceSMCustomData.GetData(), InstanceData.PlaybackData.GetData(), NumInstances * NumCustomDataFloats * sizeof(float));
+	}
+	if (NumInstances > 0)
+	{
+		InstancedMeshComponent->BatchUpdateInstancesData(0, NumInstances, InstanceData.StaticMeshInstanceData.GetData(), /*bMarkRenderStateDirty*/true, /*bForceFullUpdate*/true);
+	}
+	else
+	{
+		InstancedMeshComponent->MarkRenderStateDirty();
+	}
+
+	InstanceData.ResetDirtyRange();
+	return true;
+}
 
 bool UMassTrafficInstancePlaybackLibrary::AnimStateFromDataAsset(const UAnimToTextureDataAsset* DataAsset, int32 StateIndex, FMassTrafficAnimState& AnimState)
 {
@@ -80,4 +177,3 @@ bool UMassTrafficInstancePlaybackLibrary::AnimStateFromDataAsset(const UAnimToTe
 	AnimState = FMassTrafficAnimState();
 	return false;
 }
-
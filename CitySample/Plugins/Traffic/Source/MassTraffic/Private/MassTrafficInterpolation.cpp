@@ -6,6 +6,7 @@
 #include "MassTraffic.h"
 
 #include "Curves/BezierUtilities.h"
+#include "ZoneGraphSubsystem.h"
 
 
 namespace UE
@@ -13,6 +14,36 @@ namespace UE
 namespace MassTraffic
 {
 
+FORCEINLINE VectorRegister4Double BezierLerp(const VectorRegister4Double& A, const VectorRegister4Double& B, const VectorRegister4Double& Alpha)
+{
+	return VectorMultiplyAdd(VectorSubtract(B, A), Alpha, A);
+}
+
+/** Evaluates the cached segment's cubic Bezier position and tangent at Alpha
+ * with a single De Casteljau sweep on vector registers, replacing the two
+ * scalar polynomial evaluations (Eval + EvalDerivate) per sample. Registers
+ * hold doubles since lane points are LWC world positions.
+ */
+FORCEINLINE void EvalCubicBezierPositionAndTangent(const FMassTrafficPositionOnlyLaneSegment& LaneSegment, const float Alpha, FVector& OutPosition, FVector& OutTangent)
+{
+	const VectorRegister4Double P0 = VectorLoadFloat3_W0(&LaneSegment.StartPoint);
+	const VectorRegister4Double P1 = VectorLoadFloat3_W0(&LaneSegment.StartControlPoint);
+	const VectorRegister4Double P2 = VectorLoadFloat3_W0(&LaneSegment.EndControlPoint);
+	const VectorRegister4Double P3 = VectorLoadFloat3_W0(&LaneSegment.EndPoint);
+	const VectorRegister4Double AlphaReg = MakeVectorRegisterDouble((double)Alpha, (double)Alpha, (double)Alpha, (double)Alpha);
+
+	const VectorRegister4Double A = BezierLerp(P0, P1, AlphaReg);
+	const VectorRegister4Double B = BezierLerp(P1, P2, AlphaReg);
+	const VectorRegister4Double C = BezierLerp(P2, P3, AlphaReg);
+	const VectorRegister4Double D = BezierLerp(A, B, AlphaReg);
+	const VectorRegister4Double E = BezierLerp(B, C, AlphaReg);
+
+	VectorStoreFloat3(BezierLerp(D, E, AlphaReg), &OutPosition);
+
+	// 1/3rd of the true derivative; callers only use the direction
+	VectorStoreFloat3(VectorSubtract(E, D), &OutTangent);
+}
+
 FORCEINLINE bool IsValidLaneSegmentForDistanceAlongLane(
 	const FMassTrafficPositionOnlyLaneSegment& LaneSegment,
 	const FZoneGraphStorage& ZoneGraphStorage,
@@ -155,8 +186,7 @@ void InterpolatePositionAndOrientationAlongLane(
 		// Cubic Centripetal Catmull-Rom interpolation from P1 to P2 for position and Slerp for orientation
 		case ETrafficVehicleMovementInterpolationMethod::CubicBezier:
 
-			InterpolatedLocation = UE::CubicBezier::Eval(InOutLaneSegment.StartPoint, InOutLaneSegment.StartControlPoint, InOutLaneSegment.EndControlPoint, InOutLaneSegment.EndPoint, Alpha);
-			InterpolatedForwardVector = UE::CubicBezier::EvalDerivate(InOutLaneSegment.StartPoint, InOutLaneSegment.StartControlPoint, InOutLaneSegment.EndControlPoint, InOutLaneSegment.EndPoint, Alpha);
+			EvalCubicBezierPositionAndTangent(InOutLaneSegment, Alpha, InterpolatedLocation, InterpolatedForwardVector);
 			
 			break;
 	}
@@ -242,6 +272,59 @@ void InterpolatePositionAndOrientationAlongContinuousLanes(
 		InterpolatePositionAndOrientationAlongLane(ZoneGraphStorage, CurrentLaneIndex, DistanceAlongCurrentLane, InterpolationMethod, InOutLaneSegment, OutPosition, OutOrientation);
 	}
 }
+
+void BatchInterpolateAxlePositionsAndOrientations(
+	const UZoneGraphSubsystem& ZoneGraphSubsystem,
+	float RearAxleX,
+	float FrontAxleX,
+	TConstArrayView<FMassTrafficVehicleControlFragment> VehicleControlFragments,
+	TConstArrayView<FMassZoneGraphLaneLocationFragment> LaneLocationFragments,
+	TArrayView<FMassTrafficInterpolationFragment> InterpolationFragments,
+	TArrayView<FVector> OutRearAxlePositions,
+	TArrayView<FQuat> OutRearAxleOrientations,
+	TArrayView<FVector> OutFrontAxlePositions,
+	TArrayView<FQuat> OutFrontAxleOrientations)
+{
+	for (int32 Index = 0; Index < LaneLocationFragments.Num(); ++Index)
+	{
+		const FMassTrafficVehicleControlFragment& VehicleControlFragment = VehicleControlFragments[Index];
+		const FMassZoneGraphLaneLocationFragment& LaneLocationFragment = LaneLocationFragments[Index];
+		FMassTrafficInterpolationFragment& InterpolationFragment = InterpolationFragments[Index];
+
+		const FZoneGraphStorage* ZoneGraphStorage = ZoneGraphSubsystem.GetZoneGraphStorage(LaneLocationFragment.LaneHandle.DataHandle);
+		check(ZoneGraphStorage);
+
+		const int32 NextLaneIndex = VehicleControlFragment.NextLane ? VehicleControlFragment.NextLane->LaneHandle.Index : INDEX_NONE;
+
+		// Rear axle
+		InterpolatePositionAndOrientationAlongContinuousLanes(
+			*ZoneGraphStorage,
+			VehicleControlFragment.PreviousLaneIndex,
+			VehicleControlFragment.PreviousLaneLength,
+			LaneLocationFragment.LaneHandle.Index,
+			LaneLocationFragment.LaneLength,
+			NextLaneIndex,
+			LaneLocationFragment.DistanceAlongLane + RearAxleX,
+			ETrafficVehicleMovementInterpolationMethod::CubicBezier,
+			InterpolationFragment.LaneLocationLaneSegment,
+			OutRearAxlePositions[Index],
+			OutRearAxleOrientations[Index]);
+
+		// Front axle, through its own segment cursor
+		InterpolatePositionAndOrientationAlongContinuousLanes(
+			*ZoneGraphStorage,
+			VehicleControlFragment.PreviousLaneIndex,
+			VehicleControlFragment.PreviousLaneLength,
+			LaneLocationFragment.LaneHandle.Index,
+			LaneLocationFragment.LaneLength,
+			NextLaneIndex,
+			LaneLocationFragment.DistanceAlongLane + FrontAxleX,
+			ETrafficVehicleMovementInterpolationMethod::CubicBezier,
+			InterpolationFragment.FrontAxleLaneSegment,
+			OutFrontAxlePositions[Index],
+			OutFrontAxleOrientations[Index]);
+	}
+}
 	
 }
 }
@@ -58,6 +58,12 @@ void UMassTrafficInterpolationProcessor::ConfigureQueries(const TSharedRef<FMass
 
 void UMassTrafficInterpolationProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
+	// Per-entity axle sample scratch, reused across chunks
+	TArray<FVector> RearAxlePositions;
+	TArray<FQuat> RearAxleOrientations;
+	TArray<FVector> FrontAxlePositions;
+	TArray<FQuat> FrontAxleOrientations;
+
 	EntityQueryNonOffLOD_Conditional.ForEachEntityChunk(Context, [&, World = EntityManager.GetWorld()](FMassExecutionContext& QueryContext)
 	{
 		const UZoneGraphSubsystem& ZoneGraphSubsystem = QueryContext.GetSubsystemChecked<UZoneGraphSubsystem>();
@@ -72,61 +78,50 @@ void UMassTrafficInterpolationProcessor::Execute(FMassEntityManager& EntityManag
 		const TArrayView<FMassTrafficInterpolationFragment> VehicleMovementInterpolationFragments = QueryContext.GetMutableFragmentView<FMassTrafficInterpolationFragment>();
 		const TArrayView<FTransformFragment> TransformFragments = QueryContext.GetMutableFragmentView<FTransformFragment>();
 
+		const int32 NumEntities = QueryContext.GetNumEntities();
+		RearAxlePositions.SetNumUninitialized(NumEntities, EAllowShrinking::No);
+		RearAxleOrientations.SetNumUninitialized(NumEntities, EAllowShrinking::No);
+		FrontAxlePositions.SetNumUninitialized(NumEntities, EAllowShrinking::No);
+		FrontAxleOrientations.SetNumUninitialized(NumEntities, EAllowShrinking::No);
+
+		// Interpolate both axle samples for the whole chunk in one sweep
+		UE::MassTraffic::BatchInterpolateAxlePositionsAndOrientations(
+			ZoneGraphSubsystem,
+			SimulationParams.RearAxleX,
+			SimulationParams.FrontAxleX,
+			VehicleControlFragments,
+			LaneLocationFragments,
+			VehicleMovementInterpolationFragments,
+			RearAxlePositions,
+			RearAxleOrientations,
+			FrontAxlePositions,
+			FrontAxleOrientations);
+
 		for (FMassExecutionContext::FEntityIterator EntityIt = QueryContext.CreateEntityIterator(); EntityIt; ++EntityIt)
 		{
 			const FMassTrafficVehicleControlFragment& VehicleControlFragment = VehicleControlFragments[EntityIt];
 			const FMassZoneGraphLaneLocationFragment& ZoneGraphLaneLocationFragment = LaneLocationFragments[EntityIt];
 			const FMassTrafficLaneOffsetFragment& LaneOffsetFragment = LaneOffsetFragments[EntityIt];
-			const FMassTrafficVehicleLaneChangeFragment& LaneChangeFragment = LaneChangeFragments[EntityIt]; 
+			const FMassTrafficVehicleLaneChangeFragment& LaneChangeFragment = LaneChangeFragments[EntityIt];
 			FMassTrafficInterpolationFragment& VehicleMovementInterpolationFragment = VehicleMovementInterpolationFragments[EntityIt];
 			FTransformFragment& TransformFragment = TransformFragments[EntityIt];
 
 			// Debug
 			const bool bVisLog = DebugFragments.IsEmpty() ? false : DebugFragments[EntityIt].bVisLog > 0;
 
-			// Get FZoneGraphStorage for lanes
 			check(!VehicleControlFragment.NextLane || VehicleControlFragment.NextLane->LaneHandle.DataHandle == ZoneGraphLaneLocationFragment.LaneHandle.DataHandle);
-			const FZoneGraphStorage* ZoneGraphStorage = ZoneGraphSubsystem.GetZoneGraphStorage(ZoneGraphLaneLocationFragment.LaneHandle.DataHandle);
-			check(ZoneGraphStorage);
-		
-			// Interpolate rear axle position
-			FTransform RearAxleTransform;
-			UE::MassTraffic::InterpolatePositionAndOrientationAlongContinuousLanes(
-				*ZoneGraphStorage,
-				VehicleControlFragment.PreviousLaneIndex,
-				VehicleControlFragment.PreviousLaneLength,
-				ZoneGraphLaneLocationFragment.LaneHandle.Index,
-				ZoneGraphLaneLocationFragment.LaneLength,
-				VehicleControlFragment.NextLane ? VehicleControlFragment.NextLane->LaneHandle.Index : INDEX_NONE,
-				ZoneGraphLaneLocationFragment.DistanceAlongLane + SimulationParams.RearAxleX,
-				ETrafficVehicleMovementInterpolationMethod::CubicBezier,
-				VehicleMovementInterpolationFragment.LaneLocationLaneSegment,
-				RearAxleTransform);
-
-			// Interpolate front axle position
-			FTransform FrontAxleTransform;
-			UE::MassTraffic::InterpolatePositionAndOrientationAlongContinuousLanes(
-				*ZoneGraphStorage,
-				VehicleControlFragment.PreviousLaneIndex,
-				VehicleControlFragment.PreviousLaneLength,
-				ZoneGraphLaneLocationFragment.LaneHandle.Index,
-				ZoneGraphLaneLocationFragment.LaneLength,
-				VehicleControlFragment.NextLane ? VehicleControlFragment.NextLane->LaneHandle.Index : INDEX_NONE,
-				ZoneGraphLaneLocationFragment.DistanceAlongLane + SimulationParams.FrontAxleX,
-				ETrafficVehicleMovementInterpolationMethod::CubicBezier,
-				VehicleMovementInterpolationFragment.LaneLocationLaneSegment,
-				FrontAxleTransform);
-
-			// @todo This will thrash VehicleMovementInterpolationFragment.LaneLocationLaneSegment
+
+			const FVector& RearAxlePosition = RearAxlePositions[EntityIt];
+			const FVector& FrontAxlePosition = FrontAxlePositions[EntityIt];
 
 			// Debug
-			UE::MassTraffic::DrawDebugInterpolatedAxles(World, FrontAxleTransform.GetLocation(), RearAxleTransform.GetLocation(), bVisLog, LogOwner);
+			UE::MassTraffic::DrawDebugInterpolatedAxles(World, FrontAxlePosition, RearAxlePosition, bVisLog, LogOwner);
 
 			// Find center point between
 			const float AxleInterpolationAlpha = -SimulationParams.RearAxleX / (SimulationParams.FrontAxleX - SimulationParams.RearAxleX);
-			const FVector InterpolatedLocation = FMath::Lerp(RearAxleTransform.GetLocation(), FrontAxleTransform.GetLocation(), AxleInterpolationAlpha);
-			const FVector InterpolatedForwardDirection = FrontAxleTransform.GetLocation() - RearAxleTransform.GetLocation();
-			const FVector InterpolatedUpVector = FMath::Lerp(RearAxleTransform.GetRotation().GetUpVector(), FrontAxleTransform.GetRotation().GetUpVector(), AxleInterpolationAlpha);
+			const FVector InterpolatedLocation = FMath::Lerp(RearAxlePosition, FrontAxlePosition, AxleInterpolationAlpha);
+			const FVector InterpolatedForwardDirection = FrontAxlePosition - RearAxlePosition;
+			const FVector InterpolatedUpVector = FMath::Lerp(RearAxleOrientations[EntityIt].GetUpVector(), FrontAxleOrientations[EntityIt].GetUpVector(), AxleInterpolationAlpha);
 			TransformFragment.GetMutableTransform().SetLocation(InterpolatedLocation);
 			TransformFragment.GetMutableTransform().SetRotation(FRotationMatrix::MakeFromXZ(InterpolatedForwardDirection, InterpolatedUpVector).ToQuat());
 			
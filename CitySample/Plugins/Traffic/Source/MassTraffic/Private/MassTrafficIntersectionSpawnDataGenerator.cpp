@@ -6,6 +6,7 @@
 #include "ZoneGraphQuery.h"
 #include "VisualLogger/VisualLogger.h"
 #include "MassTrafficUtils.h"
+#include "Async/ParallelFor.h"
 #if WITH_EDITOR
 #include "Misc/ScopedSlowTask.h"
 #endif
@@ -260,8 +261,13 @@ void UMassTrafficIntersectionSpawnDataGenerator::Generate(UObject& QueryOwner, T
 
 			
 			// Build each intersection.
-			for (FMassTrafficIntersectionFragment& IntersectionFragment : OutIntersectionsSpawnData.IntersectionFragments)
+			// Each Build() only writes to its own intersection detail, and reads the shared hash grids and
+			// zone graph storage - so the per-intersection geometric construction can run in parallel.
+			// (See all PARALLELINTER.)
+			ParallelFor(OutIntersectionsSpawnData.IntersectionFragments.Num(), [&](int32 IntersectionFragmentIndex)
 			{
+				FMassTrafficIntersectionFragment& IntersectionFragment = OutIntersectionsSpawnData.IntersectionFragments[IntersectionFragmentIndex];
+
 				FMassTrafficIntersectionDetail* IntersectionDetail = nullptr;
 				{
 					const int32 IntersectionZoneIndex = IntersectionFragment.ZoneIndex;
@@ -269,7 +275,7 @@ void UMassTrafficIntersectionSpawnDataGenerator::Generate(UObject& QueryOwner, T
 					IntersectionDetail = FindIntersectionDetails(IntersectionDetails, IntersectionIndex, "Intersection Build");
 					if (IntersectionDetail == nullptr)
 					{
-						continue;
+						return;
 					}
 				}
 
@@ -278,7 +284,7 @@ void UMassTrafficIntersectionSpawnDataGenerator::Generate(UObject& QueryOwner, T
 					CrosswalkLaneMidpoint_HGrid, IntersectionSideToCrosswalkSearchDistance,
 					IntersectionSideHGrid, TrafficLightInstanceData ? &TrafficLightInstanceData->TrafficLights : nullptr, TrafficLightSearchDistance,
 					*ZoneGraphStorage, World);
-			}			
+			});
 		}
 		
 
@@ -290,8 +296,17 @@ void UMassTrafficIntersectionSpawnDataGenerator::Generate(UObject& QueryOwner, T
 		// (See all INTERMAKE.)
 		// 
 
-		for (FMassTrafficIntersectionFragment& IntersectionFragment : OutIntersectionsSpawnData.IntersectionFragments)
+		// Period construction also only writes to its own intersection fragment, via local side-to-light
+		// and lane-to-light maps. Each intersection draws its traffic light types from its own random
+		// stream, deterministically seeded per intersection zone, so the parallel loop stays reproducible
+		// per seed. (See all PARALLELINTER.)
+		const int32 PeriodRandomSeedBase = RandomStream.GetInitialSeed();
+		ParallelFor(OutIntersectionsSpawnData.IntersectionFragments.Num(), [&](int32 IntersectionFragmentIndex)
 		{
+			FMassTrafficIntersectionFragment& IntersectionFragment = OutIntersectionsSpawnData.IntersectionFragments[IntersectionFragmentIndex];
+
+			const FRandomStream PeriodRandomStream(static_cast<int32>(HashCombine(static_cast<uint32>(PeriodRandomSeedBase), static_cast<uint32>(IntersectionFragment.ZoneIndex))));
+
 			FMassTrafficIntersectionDetail* IntersectionDetail = nullptr;
 			{
 				const int32 IntersectionZoneIndex = IntersectionFragment.ZoneIndex;
@@ -299,10 +314,10 @@ void UMassTrafficIntersectionSpawnDataGenerator::Generate(UObject& QueryOwner, T
 				IntersectionDetail = FindIntersectionDetails(IntersectionDetails, IntersectionIndex, "Period Maker");
 				if (IntersectionDetail == nullptr)
 				{
-					continue;
+					return;
 				}
 			}
-			
+
 
 			// Add traffic mass lights to the intersection.
 			// Make a mapping that tells which intersection side is controlled by which of the intersection's mass
@@ -356,7 +371,7 @@ void UMassTrafficIntersectionSpawnDataGenerator::Generate(UObject& QueryOwner, T
 							// Choose a random traffic light type
 							if (CompatibleTrafficLightTypes.Num())
 							{
-								TrafficLightTypeIndex = CompatibleTrafficLightTypes[RandomStream.RandHelper(CompatibleTrafficLightTypes.Num())];
+								TrafficLightTypeIndex = CompatibleTrafficLightTypes[PeriodRandomStream.RandHelper(CompatibleTrafficLightTypes.Num())];
 							}
 						}
 
@@ -719,9 +734,9 @@ void UMassTrafficIntersectionSpawnDataGenerator::Generate(UObject& QueryOwner, T
 
 
 			// Finalize this intersection fragment.
-			
+
 			IntersectionFragment.Finalize(LaneToTrafficLightMap);
-		}
+		});
 		//
 		// Remove intersection fragments that have 2 (or less) sides and handle no pedestrian crosswalk lanes getting blocked.
 		// We don't need traffic control on these intersections, because they're basically just roads with no pedestrians
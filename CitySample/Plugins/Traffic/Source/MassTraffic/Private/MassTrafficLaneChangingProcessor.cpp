@@ -96,25 +96,35 @@ static void TryStartingNewLaneChange(
 	{
 		return;
 	}
-	
-	const int32 LaneIndex_Current = ZoneGraphLaneLocationFragment_Current.LaneHandle.Index;
-	FZoneGraphTrafficLaneData* Lane_Current = MassTrafficSubsystem.GetMutableTrafficLaneData(ZoneGraphLaneLocationFragment_Current.LaneHandle);
-	check(Lane_Current->LaneHandle.DataHandle == ZoneGraphStorage.DataHandle);
+
+	// See (3) and (7) above, tested against the adjacency bitmask the vehicle inlined with the
+	// lane const data on lane entry - vehicles on lanes with no structurally legal lane change
+	// return here without ever touching the lane data. (See all LANECHANGEMASK.)
+	const EMassTrafficLaneChangeAdjacency LaneChangeAdjacencyMask = VehicleControlFragment_Current.CurrentLaneConstData.LaneChangeAdjacencyMask;
 
 	// See (3) above.
-	if (!Lane_Current->SplittingLanes.IsEmpty() ||
-		!Lane_Current->MergingLanes.IsEmpty())
+	if (EnumHasAnyFlags(LaneChangeAdjacencyMask, EMassTrafficLaneChangeAdjacency::Merging | EMassTrafficLaneChangeAdjacency::Splitting))
 	{
-		return;		
+		return;
+	}
+
+	// No adjacent lane to change onto at all.
+	if (!EnumHasAnyFlags(LaneChangeAdjacencyMask, EMassTrafficLaneChangeAdjacency::LeftLane | EMassTrafficLaneChangeAdjacency::RightLane | EMassTrafficLaneChangeAdjacency::Transverse))
+	{
+		return;
 	}
 
 	// See (7) above.
 	if (!LaneChangeFragment_Current.IsTimeToAttemptLaneChange() &&
-		!Lane_Current->bHasTransverseLaneAdjacency)
+		!EnumHasAnyFlags(LaneChangeAdjacencyMask, EMassTrafficLaneChangeAdjacency::Transverse))
 	{
 		return;
 	}
 
+	const int32 LaneIndex_Current = ZoneGraphLaneLocationFragment_Current.LaneHandle.Index;
+	FZoneGraphTrafficLaneData* Lane_Current = MassTrafficSubsystem.GetMutableTrafficLaneData(ZoneGraphLaneLocationFragment_Current.LaneHandle);
+	check(Lane_Current->LaneHandle.DataHandle == ZoneGraphStorage.DataHandle);
+
 	
 	// Choose which lane to change to (if any.)
 
@@ -0,0 +1,31 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MassTrafficLaneStateSnapshotProcessor.h"
+#include "MassTraffic.h"
+#include "MassTrafficFieldOperations.h"
+#include "MassTrafficLaneChangingProcessor.h"
+
+#include "MassExecutionContext.h"
+
+
+UMassTrafficLaneStateSnapshotProcessor::UMassTrafficLaneStateSnapshotProcessor()
+{
+	bAutoRegisterWithProcessingPhases = true;
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::Standalone | EProcessorExecutionFlags::Server);
+	ExecutionOrder.ExecuteInGroup = UE::MassTraffic::ProcessorGroupNames::FrameStart;
+
+	// Capture before anything else in FrameStart can mutate lane data.
+	ExecutionOrder.ExecuteBefore.Add(UMassTrafficFrameStartFieldOperationsProcessor::StaticClass()->GetFName());
+	ExecutionOrder.ExecuteBefore.Add(UMassTrafficLaneChangingProcessor::StaticClass()->GetFName());
+}
+
+void UMassTrafficLaneStateSnapshotProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	ProcessorRequirements.AddSubsystemRequirement<UMassTrafficSubsystem>(EMassFragmentAccess::ReadWrite);
+}
+
+void UMassTrafficLaneStateSnapshotProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	UMassTrafficSubsystem& MassTrafficSubsystem = Context.GetMutableSubsystemChecked<UMassTrafficSubsystem>();
+	MassTrafficSubsystem.CaptureLaneStateSnapshots();
+}
@@ -6,6 +6,7 @@
 #include "MassExecutionContext.h"
 #include "MassActorSubsystem.h"
 #include "MassLODCollectorProcessor.h"
+#include "MassLODFragments.h"
 #include "MassRepresentationSubsystem.h"
 #include "VisualLogger/VisualLogger.h"
 #include "Components/MeshComponent.h"
@@ -74,6 +75,8 @@ UMassTrafficLightUpdateCustomVisualizationProcessor::UMassTrafficLightUpdateCust
 void UMassTrafficLightUpdateCustomVisualizationProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
 {
 	EntityQuery.AddRequirement<FMassTrafficIntersectionFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FMassTrafficLightVisualizationFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddRequirement<FMassViewerInfoFragment>(EMassFragmentAccess::ReadOnly);
 
 	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
 	EntityQuery.AddRequirement<FMassRepresentationFragment>(EMassFragmentAccess::ReadWrite);
@@ -97,11 +100,14 @@ void UMassTrafficLightUpdateCustomVisualizationProcessor::Execute(FMassEntityMan
 		return;
 	}
 
+	const UWorld* CurrentWorld = EntityManager.GetWorld();
+	const float TimeSeconds = CurrentWorld ? CurrentWorld->GetTimeSeconds() : 0.0f;
+
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("Visual Updates")) 
+		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("Visual Updates"))
 
 		// Visualize entities
-		EntityQuery.ForEachEntityChunk(Context, [this](FMassExecutionContext& Context)
+		EntityQuery.ForEachEntityChunk(Context, [this, TimeSeconds](FMassExecutionContext& Context)
 		{
 			UMassRepresentationSubsystem* RepresentationSubsystem = Context.GetSharedFragment<FMassRepresentationSubsystemSharedFragment>().RepresentationSubsystem;
 			check(RepresentationSubsystem);
@@ -109,37 +115,67 @@ void UMassTrafficLightUpdateCustomVisualizationProcessor::Execute(FMassEntityMan
 
 			const FMassTrafficLightsParameters& TrafficLightsParams = Context.GetConstSharedFragment<FMassTrafficLightsParameters>();
 
-			const TConstArrayView<FMassTrafficIntersectionFragment> TrafficIntersectionFragments = Context.GetFragmentView<FMassTrafficIntersectionFragment>(); 
+			const TConstArrayView<FMassTrafficIntersectionFragment> TrafficIntersectionFragments = Context.GetFragmentView<FMassTrafficIntersectionFragment>();
+			const TArrayView<FMassTrafficLightVisualizationFragment> LightVisualizationFragments = Context.GetMutableFragmentView<FMassTrafficLightVisualizationFragment>();
+			const TConstArrayView<FMassViewerInfoFragment> ViewerInfoFragments = Context.GetFragmentView<FMassViewerInfoFragment>();
 			const TConstArrayView<FMassRepresentationLODFragment> VisualizationLODFragments = Context.GetFragmentView<FMassRepresentationLODFragment>();
-			const TArrayView<FMassRepresentationFragment> VisualizationFragments = Context.GetMutableFragmentView<FMassRepresentationFragment>(); 
+			const TArrayView<FMassRepresentationFragment> VisualizationFragments = Context.GetMutableFragmentView<FMassRepresentationFragment>();
 			const TArrayView<FMassActorFragment> ActorList = Context.GetMutableFragmentView<FMassActorFragment>();
 
 			for (FMassExecutionContext::FEntityIterator EntityIt = Context.CreateEntityIterator(); EntityIt; ++EntityIt)
 			{
-				const FMassTrafficIntersectionFragment& TrafficIntersectionFragment = TrafficIntersectionFragments[EntityIt]; 
+				const FMassTrafficIntersectionFragment& TrafficIntersectionFragment = TrafficIntersectionFragments[EntityIt];
+				FMassTrafficLightVisualizationFragment& LightVisualizationFragment = LightVisualizationFragments[EntityIt];
+				const FMassViewerInfoFragment& ViewerInfoFragment = ViewerInfoFragments[EntityIt];
 				const FMassRepresentationLODFragment& VisualizationLODFragment = VisualizationLODFragments[EntityIt];
 				const FMassRepresentationFragment& VisualizationFragment = VisualizationFragments[EntityIt];
 				FMassActorFragment& ActorInfo = ActorList[EntityIt];
 
 				AActor* Actor = ActorInfo.GetMutable();
 
+				// Far intersections only re-pack their light state at a fixed interval - nobody can
+				// resolve the lights out there, and the period timers keep simulating regardless.
+				// Skipped frames re-submit the frozen packed state cached in the fragment below.
+				// (See all LIGHTVISLOD.)
+				const bool bIsFar = ViewerInfoFragment.ClosestViewerDistanceSq > FMath::Square(GMassTrafficLightVisualizationFarUpdateDistance);
+				const bool bRefreshLightState = !bIsFar
+					|| LightVisualizationFragment.CachedPackedParam1.Num() != TrafficIntersectionFragment.TrafficLights.Num()
+					|| TimeSeconds - LightVisualizationFragment.LastStateRefreshTimeSeconds >= GMassTrafficLightVisualizationFarUpdateInterval;
+				if (bRefreshLightState)
+				{
+					LightVisualizationFragment.LastStateRefreshTimeSeconds = TimeSeconds;
+					LightVisualizationFragment.CachedPackedParam1.SetNum(TrafficIntersectionFragment.TrafficLights.Num());
+				}
+
 				// We only support StaticMeshInstances for traffic lights.
 				if(VisualizationFragment.CurrentRepresentation == EMassRepresentationType::StaticMeshInstance)
 				{
 					// Visualize lights
-					for (const FMassTrafficLight& TrafficLight : TrafficIntersectionFragment.TrafficLights)
+					for (int32 TrafficLightIndex = 0; TrafficLightIndex < TrafficIntersectionFragment.TrafficLights.Num(); ++TrafficLightIndex)
 					{
+						const FMassTrafficLight& TrafficLight = TrafficIntersectionFragment.TrafficLights[TrafficLightIndex];
+
 						check(TrafficLightsParams.TrafficLightTypesStaticMeshDescHandle.IsValidIndex(TrafficLight.TrafficLightTypeIndex));
 						const FStaticMeshInstanceVisualizationDescHandle TrafficLightTypesStaticMeshDescHandle = TrafficLightsParams.TrafficLightTypesStaticMeshDescHandle[TrafficLight.TrafficLightTypeIndex];
 						if (TrafficLightTypesStaticMeshDescHandle.ToIndex() != INDEX_NONE)
 						{
 							// Get world space transform
-							FTransform IntersectionLightTransform(FRotator(0.0, TrafficLight.ZRotation, 0.0f), TrafficLight.Position);  
-
-							// Prepare custom data
-							const FMassTrafficLightInstanceCustomData PackedCustomData(TrafficLight.TrafficLightStateFlags);
-
-							// Add instance with custom data 
+							FTransform IntersectionLightTransform(FRotator(0.0, TrafficLight.ZRotation, 0.0f), TrafficLight.Position);
+
+							// Prepare custom data - re-packed on refresh frames, otherwise the frozen
+							// cached value. (See all LIGHTVISLOD.)
+							FMassTrafficLightInstanceCustomData PackedCustomData;
+							if (bRefreshLightState)
+							{
+								PackedCustomData = FMassTrafficLightInstanceCustomData(TrafficLight.TrafficLightStateFlags);
+								LightVisualizationFragment.CachedPackedParam1[TrafficLightIndex] = PackedCustomData.PackedParam1;
+							}
+							else
+							{
+								PackedCustomData.PackedParam1 = LightVisualizationFragment.CachedPackedParam1[TrafficLightIndex];
+							}
+
+							// Add instance with custom data
 							ISMInfo[TrafficLightTypesStaticMeshDescHandle.ToIndex()].AddBatchedTransform(Context.GetEntity(EntityIt)
 								, IntersectionLightTransform, IntersectionLightTransform, VisualizationLODFragment.LODSignificance);
 							ISMInfo[TrafficLightTypesStaticMeshDescHandle.ToIndex()].AddBatchedCustomData(PackedCustomData, VisualizationLODFragment.LODSignificance);
@@ -154,8 +190,10 @@ void UMassTrafficLightUpdateCustomVisualizationProcessor::Execute(FMassEntityMan
 						}
 					}
 				}
-				else if (Actor)
+				else if (Actor && bRefreshLightState)
 				{
+					// Custom primitive data persists on the components, so far intersections can skip
+					// this entirely between refreshes. (See all LIGHTVISLOD.)
 					int32 LightIndex = 0;
 					Actor->ForEachComponent<UMeshComponent>(false, [&](UMeshComponent* TrafficLightMeshComponent)
 					{
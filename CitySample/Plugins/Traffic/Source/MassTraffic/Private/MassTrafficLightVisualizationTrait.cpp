@@ -83,6 +83,9 @@ void UMassTrafficLightVisualizationTrait::BuildTemplate(FMassEntityTemplateBuild
 	BuildContext.AddConstSharedFragment(TrafficLightsParamsFragment);
 
 	BuildContext.AddFragment<FMassActorFragment>();
+
+	// Far refresh throttling state for the light visualization update. (See all LIGHTVISLOD.)
+	BuildContext.AddFragment<FMassTrafficLightVisualizationFragment>();
 }
 
 void UMassTrafficLightVisualizationTrait::SanitizeParams(FMassRepresentationParameters& InOutParams, const bool bStaticMeshDeterminedInvalid) const
@@ -3,6 +3,42 @@
 #include "MassTrafficLightweightMontageInstance.h"
 #include "Animation/AnimMontage.h"
 #include "Animation/AnimSequence.h"
+#include "Misc/ScopeLock.h"
+
+TSharedPtr<const UE::VertexAnimation::FLightweightMontageMetadata> UE::VertexAnimation::FLightweightMontageMetadata::FindOrAdd(UAnimMontage& InMontage)
+{
+	// Process-wide cache, keyed weakly so unloaded montages don't pin entries. Guarded by a lock
+	// as montage starts can come from parallel crowd animation work.
+	static FCriticalSection CacheLock;
+	static TMap<TWeakObjectPtr<UAnimMontage>, TSharedPtr<const FLightweightMontageMetadata>> Cache;
+
+	FScopeLock Lock(&CacheLock);
+
+	if (const TSharedPtr<const FLightweightMontageMetadata>* Found = Cache.Find(&InMontage))
+	{
+		return *Found;
+	}
+
+	// Prune entries for unloaded montages before adding, so the cache can't grow unbounded
+	for (auto It = Cache.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TSharedRef<FLightweightMontageMetadata> Metadata = MakeShared<FLightweightMontageMetadata>();
+	Metadata->PlayLength = InMontage.GetPlayLength();
+	Metadata->NextSections.Reserve(InMontage.CompositeSections.Num());
+	for (const FCompositeSection& Section : InMontage.CompositeSections)
+	{
+		Metadata->NextSections.Add(InMontage.GetSectionIndex(Section.NextSectionName));
+	}
+
+	Cache.Add(&InMontage, Metadata);
+	return Metadata;
+}
 
 EMontageSubStepResult UE::VertexAnimation::FLightweightMontageSubstepper::Advance(float& InOut_P_Original, UAnimMontage* Montage)
 {
@@ -89,10 +125,12 @@ void UE::VertexAnimation::FLightweightMontageInstance::Initialize(UAnimMontage*
 	Montage = InMontage;
 	if (Montage)
 	{
-		CachedLength = InMontage->GetPlayLength();
+		// Shared per-montage evaluation metadata; only the first instance to play a given
+		// montage pays for deriving it
+		Metadata = FLightweightMontageMetadata::FindOrAdd(*InMontage);
+		CachedLength = Metadata->PlayLength;
 		bInitialized = true;
 		Position = StartTime;
-		RefreshNextPrevSections(Montage);
 		MontageSubStepper.Initialize(this);
 		MontageSubStepper.Advance(Position, Montage);
 		SetSequence(FindSequenceAtCurrentTime(SectionStartTimeTransient));
@@ -101,23 +139,6 @@ void UE::VertexAnimation::FLightweightMontageInstance::Initialize(UAnimMontage*
 	Montage = nullptr;
 }
 
-void UE::VertexAnimation::FLightweightMontageInstance::RefreshNextPrevSections(UAnimMontage* InMontage)
-{
-	// initialize next section
-	if (InMontage->CompositeSections.Num() > 0)
-	{
-		NextSections.Empty(InMontage->CompositeSections.Num());
-		NextSections.AddUninitialized(InMontage->CompositeSections.Num());
-
-		for (int32 I = 0; I < InMontage->CompositeSections.Num(); ++I)
-		{
-			FCompositeSection& Section = InMontage->CompositeSections[I];
-			int32 NextSectionIdx = InMontage->GetSectionIndex(Section.NextSectionName);
-			NextSections[I] = NextSectionIdx;
-		}
-	}
-}
-
 const UAnimSequence* UE::VertexAnimation::FLightweightMontageInstance::FindSequenceAtCurrentTime(float& SequenceStartTime)
 {
 	SequenceStartTime = 0.0f;
@@ -210,7 +231,7 @@ bool UE::VertexAnimation::FLightweightMontageInstance::Advance_Internal(float De
 			const int32 CurrentSectionIndex = MontageSubStepper.GetCurrentSectionIndex();
 
 			// Get recent NextSectionIndex in case it's been changed by previous events.
-			const int32 RecentNextSectionIndex = NextSections[CurrentSectionIndex];
+			const int32 RecentNextSectionIndex = Metadata->NextSections.IsValidIndex(CurrentSectionIndex) ? Metadata->NextSections[CurrentSectionIndex] : INDEX_NONE;
 			if (RecentNextSectionIndex != INDEX_NONE)
 			{
 				float LatestNextSectionStartTime;
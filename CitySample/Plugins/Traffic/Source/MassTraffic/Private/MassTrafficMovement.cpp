@@ -224,6 +224,105 @@ float TimeToCollision(
 	return (Tau < 0) ? TNumericLimits<float>::Max() : Tau;
 }
 
+float TimeToCollisionBatch(
+	const FVector& AgentLocation, const FVector& AgentVelocity, float AgentRadius,
+	TConstArrayView<float> ObstacleLocationsX, TConstArrayView<float> ObstacleLocationsY, TConstArrayView<float> ObstacleLocationsZ,
+	TConstArrayView<float> ObstacleVelocitiesX, TConstArrayView<float> ObstacleVelocitiesY, TConstArrayView<float> ObstacleVelocitiesZ,
+	TConstArrayView<float> ObstacleRadii,
+	int32& OutMinIndex)
+{
+	const int32 NumObstacles = ObstacleRadii.Num();
+	check(ObstacleLocationsX.Num() == NumObstacles && ObstacleLocationsY.Num() == NumObstacles && ObstacleLocationsZ.Num() == NumObstacles);
+	check(ObstacleVelocitiesX.Num() == NumObstacles && ObstacleVelocitiesY.Num() == NumObstacles && ObstacleVelocitiesZ.Num() == NumObstacles);
+
+	float MinTime = TNumericLimits<float>::Max();
+	OutMinIndex = INDEX_NONE;
+
+	// Hoist the agent terms, shared by every lane. (See all TTCBATCH.)
+	const VectorRegister4Float AgentX = VectorSetFloat1(AgentLocation.X);
+	const VectorRegister4Float AgentY = VectorSetFloat1(AgentLocation.Y);
+	const VectorRegister4Float AgentZ = VectorSetFloat1(AgentLocation.Z);
+	const VectorRegister4Float AgentVX = VectorSetFloat1(AgentVelocity.X);
+	const VectorRegister4Float AgentVY = VectorSetFloat1(AgentVelocity.Y);
+	const VectorRegister4Float AgentVZ = VectorSetFloat1(AgentVelocity.Z);
+	const VectorRegister4Float AgentRadiusRegister = VectorSetFloat1(AgentRadius);
+	const VectorRegister4Float Zero = VectorZero();
+	const VectorRegister4Float FloatMax = VectorSetFloat1(TNumericLimits<float>::Max());
+
+	VectorRegister4Float MinTimes = FloatMax;
+	VectorRegister4Float MinIndices = VectorSetFloat1(-1.0f);
+	VectorRegister4Float Indices = MakeVectorRegisterFloat(0.0f, 1.0f, 2.0f, 3.0f);
+	const VectorRegister4Float IndexStep = VectorSetFloat1(4.0f);
+
+	int32 Index = 0;
+	for (; Index + 4 <= NumObstacles; Index += 4)
+	{
+		// Mirrors scalar TimeToCollision above, 4 obstacles per iteration.
+		const VectorRegister4Float ToObstacleX = VectorSubtract(VectorLoad(&ObstacleLocationsX[Index]), AgentX);
+		const VectorRegister4Float ToObstacleY = VectorSubtract(VectorLoad(&ObstacleLocationsY[Index]), AgentY);
+		const VectorRegister4Float ToObstacleZ = VectorSubtract(VectorLoad(&ObstacleLocationsZ[Index]), AgentZ);
+		const VectorRegister4Float RadiusSum = VectorAdd(AgentRadiusRegister, VectorLoad(&ObstacleRadii[Index]));
+
+		const VectorRegister4Float C = VectorSubtract(
+			VectorMultiplyAdd(ToObstacleX, ToObstacleX, VectorMultiplyAdd(ToObstacleY, ToObstacleY, VectorMultiply(ToObstacleZ, ToObstacleZ))),
+			VectorMultiply(RadiusSum, RadiusSum));
+
+		const VectorRegister4Float VelocityDeltaX = VectorSubtract(AgentVX, VectorLoad(&ObstacleVelocitiesX[Index]));
+		const VectorRegister4Float VelocityDeltaY = VectorSubtract(AgentVY, VectorLoad(&ObstacleVelocitiesY[Index]));
+		const VectorRegister4Float VelocityDeltaZ = VectorSubtract(AgentVZ, VectorLoad(&ObstacleVelocitiesZ[Index]));
+
+		const VectorRegister4Float A = VectorMultiplyAdd(VelocityDeltaX, VelocityDeltaX, VectorMultiplyAdd(VelocityDeltaY, VelocityDeltaY, VectorMultiply(VelocityDeltaZ, VelocityDeltaZ)));
+		const VectorRegister4Float B = VectorMultiplyAdd(ToObstacleX, VelocityDeltaX, VectorMultiplyAdd(ToObstacleY, VelocityDeltaY, VectorMultiply(ToObstacleZ, VelocityDeltaZ)));
+		const VectorRegister4Float Discriminator = VectorSubtract(VectorMultiply(B, B), VectorMultiply(A, C));
+
+		// Tau is garbage in lanes with a non-positive discriminator but those lanes get selected
+		// away below, like the scalar early-outs.
+		const VectorRegister4Float Tau = VectorDivide(VectorSubtract(B, VectorSqrt(VectorMax(Discriminator, Zero))), A);
+
+		const VectorRegister4Float NoHitMask = VectorBitwiseOr(VectorCompareLE(Discriminator, Zero), VectorCompareLT(Tau, Zero));
+		const VectorRegister4Float CollidingMask = VectorCompareLT(C, Zero);
+		const VectorRegister4Float Time = VectorSelect(CollidingMask, Zero, VectorSelect(NoHitMask, FloatMax, Tau));
+
+		const VectorRegister4Float ImprovedMask = VectorCompareLT(Time, MinTimes);
+		MinTimes = VectorSelect(ImprovedMask, Time, MinTimes);
+		MinIndices = VectorSelect(ImprovedMask, Indices, MinIndices);
+
+		Indices = VectorAdd(Indices, IndexStep);
+	}
+
+	// Cross-lane reduction, preferring the lowest index on equal times.
+	alignas(16) float LaneMinTimes[4];
+	alignas(16) float LaneMinIndices[4];
+	VectorStoreAligned(MinTimes, LaneMinTimes);
+	VectorStoreAligned(MinIndices, LaneMinIndices);
+	for (int32 Lane = 0; Lane < 4; ++Lane)
+	{
+		if (LaneMinTimes[Lane] < MinTime ||
+			(LaneMinTimes[Lane] == MinTime && OutMinIndex != INDEX_NONE && static_cast<int32>(LaneMinIndices[Lane]) < OutMinIndex))
+		{
+			MinTime = LaneMinTimes[Lane];
+			OutMinIndex = static_cast<int32>(LaneMinIndices[Lane]);
+		}
+	}
+
+	// Scalar tail
+	for (; Index < NumObstacles; ++Index)
+	{
+		const float Time = TimeToCollision(
+			AgentLocation, AgentVelocity, AgentRadius,
+			FVector(ObstacleLocationsX[Index], ObstacleLocationsY[Index], ObstacleLocationsZ[Index]),
+			FVector(ObstacleVelocitiesX[Index], ObstacleVelocitiesY[Index], ObstacleVelocitiesZ[Index]),
+			ObstacleRadii[Index]);
+		if (Time < MinTime)
+		{
+			MinTime = Time;
+			OutMinIndex = Index;
+		}
+	}
+
+	return MinTime;
+}
+
 void MoveVehicleToNextLane(
 	FMassEntityManager& EntityManager,
 	UMassTrafficSubsystem& MassTrafficSubsystem,
@@ -241,7 +340,7 @@ void MoveVehicleToNextLane(
 	check(VehicleControlFragment.NextLane);
 	check(VehicleControlFragment.NextLane->LaneHandle != LaneLocationFragment.LaneHandle);
 
-	const UMassTrafficSettings* MassTrafficSettings = GetDefault<UMassTrafficSettings>();
+	const UMassTrafficSettings* MassTrafficSettings = &MassTrafficSubsystem.GetSettings();
 
 	FZoneGraphTrafficLaneData& CurrentLane = MassTrafficSubsystem.GetMutableTrafficLaneDataChecked(LaneLocationFragment.LaneHandle);
 
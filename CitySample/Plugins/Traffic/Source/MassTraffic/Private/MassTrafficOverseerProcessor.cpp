@@ -15,6 +15,7 @@
 #include "MassTrafficLaneChange.h"
 #include "MassTrafficVehicleSimulationTrait.h"
 #include "MassZoneGraphNavigationFragments.h"
+#include "MassLODSubsystem.h"
 #include "ZoneGraphSubsystem.h"
 #include "Algo/MinElement.h"
 #include "Kismet/GameplayStatics.h"
@@ -23,6 +24,31 @@
 DECLARE_DWORD_COUNTER_STAT(TEXT("Empty Lanes"), STAT_Traffic_EmptyLanes, STATGROUP_Traffic);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Occupied Lanes"), STAT_Traffic_OccupiedLanes, STATGROUP_Traffic);
 
+/** Squared distance from Location to the nearest viewer. Viewer positions are
+ * SoA arrays padded to the vector register width with far-away sentinels, so
+ * all viewers are tested four at a time with no lane masking.
+ */
+static FORCEINLINE float MinDistanceSquaredToViewers(const FVector& Location, TConstArrayView<double> ViewerX, TConstArrayView<double> ViewerY, TConstArrayView<double> ViewerZ)
+{
+	const VectorRegister4Double LocationX = MakeVectorRegisterDouble(Location.X, Location.X, Location.X, Location.X);
+	const VectorRegister4Double LocationY = MakeVectorRegisterDouble(Location.Y, Location.Y, Location.Y, Location.Y);
+	const VectorRegister4Double LocationZ = MakeVectorRegisterDouble(Location.Z, Location.Z, Location.Z, Location.Z);
+
+	VectorRegister4Double MinDistSq = MakeVectorRegisterDouble(TNumericLimits<double>::Max(), TNumericLimits<double>::Max(), TNumericLimits<double>::Max(), TNumericLimits<double>::Max());
+	for (int32 PackStart = 0; PackStart < ViewerX.Num(); PackStart += 4)
+	{
+		const VectorRegister4Double DeltaX = VectorSubtract(VectorLoad(&ViewerX[PackStart]), LocationX);
+		const VectorRegister4Double DeltaY = VectorSubtract(VectorLoad(&ViewerY[PackStart]), LocationY);
+		const VectorRegister4Double DeltaZ = VectorSubtract(VectorLoad(&ViewerZ[PackStart]), LocationZ);
+		const VectorRegister4Double DistSq = VectorMultiplyAdd(DeltaX, DeltaX, VectorMultiplyAdd(DeltaY, DeltaY, VectorMultiply(DeltaZ, DeltaZ)));
+		MinDistSq = VectorMin(MinDistSq, DistSq);
+	}
+
+	double MinDistSqLanes[4];
+	VectorStore(MinDistSq, MinDistSqLanes);
+	return (float)FMath::Min(FMath::Min(MinDistSqLanes[0], MinDistSqLanes[1]), FMath::Min(MinDistSqLanes[2], MinDistSqLanes[3]));
+}
+
 UMassTrafficOverseerProcessor::UMassTrafficOverseerProcessor()
 	: RecyclableTrafficVehicleEntityQuery(*this)
 {
@@ -53,6 +79,7 @@ void UMassTrafficOverseerProcessor::ConfigureQueries(const TSharedRef<FMassEntit
 
 	ProcessorRequirements.AddSubsystemRequirement<UMassTrafficSubsystem>(EMassFragmentAccess::ReadWrite);
 	ProcessorRequirements.AddSubsystemRequirement<UZoneGraphSubsystem>(EMassFragmentAccess::ReadOnly);
+	ProcessorRequirements.AddSubsystemRequirement<UMassLODSubsystem>(EMassFragmentAccess::ReadOnly);
 }
 
 void UMassTrafficOverseerProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
@@ -76,24 +103,37 @@ void UMassTrafficOverseerProcessor::Execute(FMassEntityManager& EntityManager, F
 		return;			   		 
 	}
 
-	// Get player view location. Note: This implementation only supports a single viewer.
-	APlayerController* LocalPlayerController = nullptr;
-	for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	// Gather all viewer positions once into SoA arrays for the vectorized
+	// min-distance classification below. This picks up every viewer registered
+	// with the LOD subsystem - all player viewpoints plus secondary viewers
+	// like spectating drone cameras on listen servers - so density is managed
+	// around each of them, not just the first local player.
+	const UMassLODSubsystem& LODSubsystem = Context.GetSubsystemChecked<UMassLODSubsystem>();
+	TArray<double, TInlineAllocator<8>> ViewerX;
+	TArray<double, TInlineAllocator<8>> ViewerY;
+	TArray<double, TInlineAllocator<8>> ViewerZ;
+	for (const FViewerInfo& Viewer : LODSubsystem.GetViewers())
 	{
-		APlayerController* PlayerController = Iterator->Get();
-		if (PlayerController && PlayerController->IsLocalController())
+		if (Viewer.Handle.IsValid())
 		{
-			LocalPlayerController = PlayerController;
-			break;
+			ViewerX.Add(Viewer.Location.X);
+			ViewerY.Add(Viewer.Location.Y);
+			ViewerZ.Add(Viewer.Location.Z);
 		}
 	}
-	if (!LocalPlayerController)
+	if (ViewerX.IsEmpty())
 	{
 		return;
 	}
-	FVector LocalPlayerViewLocation(ForceInitToZero);
-	FRotator LocalPlayerViewRotation(ForceInit);
-	LocalPlayerController->GetPlayerViewPoint(LocalPlayerViewLocation, LocalPlayerViewRotation);
+
+	// Pad to the register width with far-away sentinels so the spare lanes
+	// never win the min
+	while (ViewerX.Num() % 4 != 0)
+	{
+		ViewerX.Add(TNumericLimits<double>::Max());
+		ViewerY.Add(0.0);
+		ViewerZ.Add(0.0);
+	}
 
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FindTransferLanes"))
@@ -115,34 +155,64 @@ void UMassTrafficOverseerProcessor::Execute(FMassEntityManager& EntityManager, F
 			// Get partition of lanes to operate on this frame to amortise performance costs across several frames  
 			const int32 PartitionSize = FMath::DivideAndRoundUp(TrafficZoneGraphData->TrafficLaneDataArray.Num(), MassTrafficSettings->NumDensityManagementLanePartitions);
 			const int32 TrafficLanePartitionStart = PartitionSize * PartitionIndex;
-			const TArrayView<FZoneGraphTrafficLaneData> TrafficLanesPartition = MakeArrayView(TrafficZoneGraphData->TrafficLaneDataArray).Mid(TrafficLanePartitionStart, PartitionSize); 
-			for (FZoneGraphTrafficLaneData& TrafficLaneData : TrafficLanesPartition) 
+
+			// Scan the compact candidate table and lane state snapshots instead of striding through
+			// the full lane structs - densities come ready-made from the incrementally maintained
+			// occupancy counters captured in the snapshots. The full lane data is only touched to
+			// check the dynamic teleport disqualifiers, for the rare lane that would actually enter
+			// one of the transfer lists. (See all OVERSEERTABLE.)
+			const TConstArrayView<FMassTrafficLaneOverseerCandidate> OverseerCandidatesPartition = MakeArrayView(TrafficZoneGraphData->OverseerCandidates).Mid(TrafficLanePartitionStart, PartitionSize);
+			const TConstArrayView<FMassTrafficLaneStateSnapshot> LaneStateSnapshots = LocalMassTrafficSubsystem.GetLaneStateSnapshots(*TrafficZoneGraphData);
+
+			auto IsDynamicallyOKToTeleport = [](const FZoneGraphTrafficLaneData& TrafficLaneData)
 			{
-				// Make sure this lane is viable for teleporting cars, there are various reasons we can't:
-				const bool bOKToTeleport =
-					// Don't transfer from / to merging or splitting lanes
-					TrafficLaneData.MergingLanes.IsEmpty() && 
-					TrafficLaneData.SplittingLanes.IsEmpty() &&
+				return
 					// Don't transfer from / to lanes with in progress lane changes
 					TrafficLaneData.NumVehiclesLaneChangingOffOfLane == 0 &&
 					TrafficLaneData.NumVehiclesLaneChangingOntoLane == 0 &&
 					// Don't transfer from / to lanes that are downstream from active intersection lanes
-					!UE::MassTraffic::AreVehiclesCurrentlyApproachingLaneFromIntersection(TrafficLaneData); 
+					!UE::MassTraffic::AreVehiclesCurrentlyApproachingLaneFromIntersection(TrafficLaneData);
+			};
 
-				if (!bOKToTeleport)
+			for (int32 PartitionCandidateIndex = 0; PartitionCandidateIndex < OverseerCandidatesPartition.Num(); ++PartitionCandidateIndex) 
+			{
+				const FMassTrafficLaneOverseerCandidate& OverseerCandidate = OverseerCandidatesPartition[PartitionCandidateIndex];
+
+				// Don't transfer from / to merging or splitting lanes
+				if (!OverseerCandidate.bStaticTeleportEligible)
 				{
 					continue;
 				}
 
+				// Read lane densities from the snapshot, falling back to the live lane data before the
+				// first capture. Snapshots are at most a frame old, which is fine for this heuristic.
+				float SpaceAvailable;
+				float FunctionalLaneDensity;
+				bool bIsOpen;
+				if (LaneStateSnapshots.IsValidIndex(OverseerCandidate.LaneIndex))
+				{
+					const FMassTrafficLaneStateSnapshot& LaneStateSnapshot = LaneStateSnapshots[OverseerCandidate.LaneIndex];
+					SpaceAvailable = LaneStateSnapshot.SpaceAvailable;
+					FunctionalLaneDensity = LaneStateSnapshot.FunctionalDensity;
+					bIsOpen = LaneStateSnapshot.bIsOpen;
+				}
+				else
+				{
+					const FZoneGraphTrafficLaneData* LiveTrafficLaneData = TrafficZoneGraphData->GetTrafficLaneData(OverseerCandidate.LaneIndex);
+					check(LiveTrafficLaneData);
+					SpaceAvailable = LiveTrafficLaneData->SpaceAvailable;
+					FunctionalLaneDensity = LiveTrafficLaneData->FunctionalDensity();
+					bIsOpen = LiveTrafficLaneData->bIsOpen;
+				}
+
 				// Sort lanes based on how far above their max densities they are
-				const float BasicLaneDensity = TrafficLaneData.BasicDensity();
-				const float FunctionalLaneDensity = TrafficLaneData.FunctionalDensity();
-				const float LaneDensityExcess = BasicLaneDensity - TrafficLaneData.MaxDensity;
-
-				// Test distance to player
-				const float DistanceToPlayer = FMath::Max(FVector::Distance(TrafficLaneData.CenterLocation, LocalPlayerViewLocation) - TrafficLaneData.Radius, 0.0f);
-				const bool bIsInBusiestLaneDistanceRange = MassTrafficSettings->BusiestLaneDistanceToPlayerRange.Contains(DistanceToPlayer);
-				const bool bIsInLeastBusiestLaneDistanceRange = MassTrafficSettings->LeastBusiestLaneDistanceToPlayerRange.Contains(DistanceToPlayer);
+				const float BasicLaneDensity = (OverseerCandidate.Length - SpaceAvailable) / OverseerCandidate.Length;
+				const float LaneDensityExcess = BasicLaneDensity - OverseerCandidate.MaxDensity;
+
+				// Test distance to the nearest viewer, 4 viewers per register pack
+				const float DistanceToNearestViewer = FMath::Max(FMath::Sqrt(MinDistanceSquaredToViewers(OverseerCandidate.CenterLocation, ViewerX, ViewerY, ViewerZ)) - OverseerCandidate.Radius, 0.0f);
+				const bool bIsInBusiestLaneDistanceRange = MassTrafficSettings->BusiestLaneDistanceToPlayerRange.Contains(DistanceToNearestViewer);
+				const bool bIsInLeastBusiestLaneDistanceRange = MassTrafficSettings->LeastBusiestLaneDistanceToPlayerRange.Contains(DistanceToNearestViewer);
 				
 				// Collect NumBusiestLanesToTransferFrom of the busiest lanes
 				if (
@@ -153,34 +223,40 @@ void UMassTrafficOverseerProcessor::Execute(FMassEntityManager& EntityManager, F
 					// In the trunk lanes phase, only transfer from trunk lanes so we don't transfer trunk-lane-only
 					// vehicles onto non trunk lanes. Outside the trunk lanes phase, we still transfer vehicles off
 					// trunk lanes but make sure to skip restricted vehicles  
-					&& (!bTrunkLanesPhase || TrafficLaneData.ConstData.bIsTrunkLane)
+					&& (!bTrunkLanesPhase || OverseerCandidate.bIsTrunkLane)
+					// Would this lane actually make the list?
+					&& (BusiestLanes.Num() < MassTrafficSettings->NumBusiestLanesToTransferFrom || LaneDensityExcess > MinBusiestLaneDensityExcess)
 				)
 				{
-					if (BusiestLanes.Num() < MassTrafficSettings->NumBusiestLanesToTransferFrom)
+					FZoneGraphTrafficLaneData& TrafficLaneData = TrafficZoneGraphData->TrafficLaneDataArray[TrafficLanePartitionStart + PartitionCandidateIndex];
+					if (IsDynamicallyOKToTeleport(TrafficLaneData))
 					{
-						BusiestLanes.Add(&TrafficLaneData);
-						BusiestLaneDensityExcesses.Add(LaneDensityExcess);
-						if (LaneDensityExcess < MinBusiestLaneDensityExcess)
+						if (BusiestLanes.Num() < MassTrafficSettings->NumBusiestLanesToTransferFrom)
 						{
-							MinBusiestLaneDensityExcess = LaneDensityExcess;
-							MinBusiestLaneDensityExcessIndex = BusiestLanes.Num() - 1;
+							BusiestLanes.Add(&TrafficLaneData);
+							BusiestLaneDensityExcesses.Add(LaneDensityExcess);
+							if (LaneDensityExcess < MinBusiestLaneDensityExcess)
+							{
+								MinBusiestLaneDensityExcess = LaneDensityExcess;
+								MinBusiestLaneDensityExcessIndex = BusiestLanes.Num() - 1;
+							}
 						}
-					}
-					else if (LaneDensityExcess > MinBusiestLaneDensityExcess)
-					{
-						// Write over the current min, effectively popping it out of the list
-						BusiestLanes[MinBusiestLaneDensityExcessIndex] = &TrafficLaneData;
-						BusiestLaneDensityExcesses[MinBusiestLaneDensityExcessIndex] = LaneDensityExcess;
-
-						// Find the new min
-						MinBusiestLaneDensityExcess = TNumericLimits<float>::Max();
-						for (int32 BusiestLanesIndex = 0; BusiestLanesIndex < BusiestLanes.Num(); ++BusiestLanesIndex)
+						else
 						{
-							const float& BusiestLaneDensity = BusiestLaneDensityExcesses[BusiestLanesIndex];
-							if (BusiestLaneDensity < MinBusiestLaneDensityExcess)
+							// Write over the current min, effectively popping it out of the list
+							BusiestLanes[MinBusiestLaneDensityExcessIndex] = &TrafficLaneData;
+							BusiestLaneDensityExcesses[MinBusiestLaneDensityExcessIndex] = LaneDensityExcess;
+
+							// Find the new min
+							MinBusiestLaneDensityExcess = TNumericLimits<float>::Max();
+							for (int32 BusiestLanesIndex = 0; BusiestLanesIndex < BusiestLanes.Num(); ++BusiestLanesIndex)
 							{
-								MinBusiestLaneDensityExcess = BusiestLaneDensity;
-								MinBusiestLaneDensityExcessIndex = BusiestLanesIndex;
+								const float& BusiestLaneDensity = BusiestLaneDensityExcesses[BusiestLanesIndex];
+								if (BusiestLaneDensity < MinBusiestLaneDensityExcess)
+								{
+									MinBusiestLaneDensityExcess = BusiestLaneDensity;
+									MinBusiestLaneDensityExcessIndex = BusiestLanesIndex;
+								}
 							}
 						}
 					}
@@ -195,41 +271,47 @@ void UMassTrafficOverseerProcessor::Execute(FMassEntityManager& EntityManager, F
 					// Enough space to bother trying to transfer here?
 					&& FunctionalLaneDensity <= MassTrafficSettings->LeastBusiestLaneMaxDensity
 					// Only transfer onto open lanes
-					&& TrafficLaneData.bIsOpen
+					&& bIsOpen
 					// Never transfer onto intersection lanes
-					&& !TrafficLaneData.ConstData.bIsIntersectionLane
+					&& !OverseerCandidate.bIsIntersectionLane
 					// In the trunk lanes phase, only consider trunk lanes to transfer onto, so we don't put
 					// trunk-lane-only vehicles onto non-trunk lanes
-					&& (!bTrunkLanesPhase || TrafficLaneData.ConstData.bIsTrunkLane)
+					&& (!bTrunkLanesPhase || OverseerCandidate.bIsTrunkLane)
+					// Would this lane actually make the list?
+					&& (LeastBusiestLanes.Num() < MassTrafficSettings->NumLeastBusiestLanesToTransferTo || FunctionalLaneDensity < MaxLeastBusiestLaneDensity)
 				)
 				{
-					if (LeastBusiestLanes.Num() < MassTrafficSettings->NumLeastBusiestLanesToTransferTo)
+					FZoneGraphTrafficLaneData& TrafficLaneData = TrafficZoneGraphData->TrafficLaneDataArray[TrafficLanePartitionStart + PartitionCandidateIndex];
+					if (IsDynamicallyOKToTeleport(TrafficLaneData))
 					{
-						LeastBusiestLanes.Add(&TrafficLaneData);
-						LeastBusiestLaneDensities.Add(FunctionalLaneDensity);
-						LeastBusiestLaneLocations.Add(TrafficLaneData.CenterLocation);
-						if (FunctionalLaneDensity > MaxLeastBusiestLaneDensity)
+						if (LeastBusiestLanes.Num() < MassTrafficSettings->NumLeastBusiestLanesToTransferTo)
 						{
-							MaxLeastBusiestLaneDensity = FunctionalLaneDensity;
-							MaxLeastBusiestLaneDensityIndex = LeastBusiestLanes.Num() - 1;
+							LeastBusiestLanes.Add(&TrafficLaneData);
+							LeastBusiestLaneDensities.Add(FunctionalLaneDensity);
+							LeastBusiestLaneLocations.Add(OverseerCandidate.CenterLocation);
+							if (FunctionalLaneDensity > MaxLeastBusiestLaneDensity)
+							{
+								MaxLeastBusiestLaneDensity = FunctionalLaneDensity;
+								MaxLeastBusiestLaneDensityIndex = LeastBusiestLanes.Num() - 1;
+							}
 						}
-					}
-					else if (FunctionalLaneDensity < MaxLeastBusiestLaneDensity)
-					{
-						// Write over the current max, effectively popping it out of the list
-						LeastBusiestLanes[MaxLeastBusiestLaneDensityIndex] = &TrafficLaneData;
-						LeastBusiestLaneDensities[MaxLeastBusiestLaneDensityIndex] = FunctionalLaneDensity;
-						LeastBusiestLaneLocations[MaxLeastBusiestLaneDensityIndex] = TrafficLaneData.CenterLocation;
-
-						// Find the new min
-						MaxLeastBusiestLaneDensity = TNumericLimits<float>::Min();
-						for (int32 LeastBusiestLanesIndex = 0; LeastBusiestLanesIndex < LeastBusiestLanes.Num(); ++LeastBusiestLanesIndex)
+						else
 						{
-							const float& LeastBusiestLaneDensity = LeastBusiestLaneDensities[LeastBusiestLanesIndex];
-							if (LeastBusiestLaneDensity > MaxLeastBusiestLaneDensity)
+							// Write over the current max, effectively popping it out of the list
+							LeastBusiestLanes[MaxLeastBusiestLaneDensityIndex] = &TrafficLaneData;
+							LeastBusiestLaneDensities[MaxLeastBusiestLaneDensityIndex] = FunctionalLaneDensity;
+							LeastBusiestLaneLocations[MaxLeastBusiestLaneDensityIndex] = OverseerCandidate.CenterLocation;
+
+							// Find the new min
+							MaxLeastBusiestLaneDensity = TNumericLimits<float>::Min();
+							for (int32 LeastBusiestLanesIndex = 0; LeastBusiestLanesIndex < LeastBusiestLanes.Num(); ++LeastBusiestLanesIndex)
 							{
-								MaxLeastBusiestLaneDensity = LeastBusiestLaneDensity;
-								MaxLeastBusiestLaneDensityIndex = LeastBusiestLanesIndex;
+								const float& LeastBusiestLaneDensity = LeastBusiestLaneDensities[LeastBusiestLanesIndex];
+								if (LeastBusiestLaneDensity > MaxLeastBusiestLaneDensity)
+								{
+									MaxLeastBusiestLaneDensity = LeastBusiestLaneDensity;
+									MaxLeastBusiestLaneDensityIndex = LeastBusiestLanesIndex;
+								}
 							}
 						}
 					}
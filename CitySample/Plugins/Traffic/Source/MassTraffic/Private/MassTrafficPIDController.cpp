@@ -0,0 +1,78 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MassTrafficPIDController.h"
+
+
+void FMassTrafficPIDController::StepBatch(
+	TConstArrayView<float> Goals,
+	TConstArrayView<float> Actuals,
+	TConstArrayView<float> DeltaTimes,
+	const FMassTrafficPIDControllerParams& Params,
+	TArrayView<float> InOutErrorIntegrals,
+	TArrayView<float> InOutLastErrors,
+	TArrayView<float> OutValues)
+{
+	const int32 Num = Goals.Num();
+	check(Actuals.Num() == Num && DeltaTimes.Num() == Num);
+	check(InOutErrorIntegrals.Num() == Num && InOutLastErrors.Num() == Num && OutValues.Num() == Num);
+
+	const bool bUseIntegralWindow = Params.IntegralWindow > SMALL_NUMBER;
+
+	const VectorRegister4Float Proportional = VectorSetFloat1(Params.ProportionalFactor);
+	const VectorRegister4Float Integral = VectorSetFloat1(Params.IntegralFactor);
+	const VectorRegister4Float Derivative = VectorSetFloat1(Params.DerivativeFactor);
+	const VectorRegister4Float InvIntegralWindow = VectorSetFloat1(bUseIntegralWindow ? 1.0f / Params.IntegralWindow : 0.0f);
+	const VectorRegister4Float One = GlobalVectorConstants::FloatOne;
+
+	int32 Index = 0;
+	for (; Index + 4 <= Num; Index += 4)
+	{
+		const VectorRegister4Float Goal = VectorLoad(&Goals[Index]);
+		const VectorRegister4Float Actual = VectorLoad(&Actuals[Index]);
+		const VectorRegister4Float Error = VectorSubtract(Goal, Actual);
+
+		VectorRegister4Float ErrorIntegral = VectorLoad(&InOutErrorIntegrals[Index]);
+		if (bUseIntegralWindow)
+		{
+			const VectorRegister4Float WindowPortion = VectorMultiply(VectorLoad(&DeltaTimes[Index]), InvIntegralWindow);
+			ErrorIntegral = VectorMultiplyAdd(Error, WindowPortion, VectorMultiply(ErrorIntegral, VectorSubtract(One, WindowPortion)));
+		}
+		else
+		{
+			ErrorIntegral = Error;
+		}
+
+		const VectorRegister4Float LastError = VectorLoad(&InOutLastErrors[Index]);
+		const VectorRegister4Float Value = VectorMultiplyAdd(Proportional, Error,
+			VectorMultiplyAdd(Integral, ErrorIntegral,
+				VectorMultiply(Derivative, VectorSubtract(Error, LastError))));
+
+		VectorStore(ErrorIntegral, &InOutErrorIntegrals[Index]);
+		VectorStore(Error, &InOutLastErrors[Index]);
+		VectorStore(Value, &OutValues[Index]);
+	}
+
+	// Scalar tail, mirroring Tick.
+	for (; Index < Num; ++Index)
+	{
+		const float Error = Goals[Index] - Actuals[Index];
+
+		if (bUseIntegralWindow)
+		{
+			const float WindowPortion = DeltaTimes[Index] / Params.IntegralWindow;
+			InOutErrorIntegrals[Index] *= (1.0f - WindowPortion);
+			InOutErrorIntegrals[Index] += Error * WindowPortion;
+		}
+		else
+		{
+			InOutErrorIntegrals[Index] = Error;
+		}
+
+		OutValues[Index] =
+			Params.ProportionalFactor * Error +
+			Params.IntegralFactor * InOutErrorIntegrals[Index] +
+			Params.DerivativeFactor * (Error - InOutLastErrors[Index]);
+
+		InOutLastErrors[Index] = Error;
+	}
+}
@@ -7,6 +7,7 @@
 #include "MassTrafficParkedVehicles.h"
 #include "MassTrafficSubsystem.h"
 #include "Algo/Accumulate.h"
+#include "Async/ParallelFor.h"
 
 void UMassTrafficParkedVehicleSpawnDataGenerator::Generate(
 	UObject& QueryOwner,
@@ -152,34 +153,51 @@ void UMassTrafficParkedVehicleSpawnDataGenerator::Generate(
 			Result.SpawnData.InitializeAs<FMassTrafficParkedVehiclesSpawnData>();
 			FMassTrafficParkedVehiclesSpawnData& SpawnData = Result.SpawnData.GetMutable<FMassTrafficParkedVehiclesSpawnData>();
 
-			// Consume parking spaces
-			SpawnData.Transforms = AvailableParkingSpacesForType.Left(FMath::CeilToInt(AvailableParkingSpacesForType.Num() * SpawnedEntityType.Proportion));
-			AvailableParkingSpacesForType.RightChopInline(SpawnData.Transforms.Num());
+			// Consume parking spaces. The overlap filter runs against the source view
+			// so the spawn data array is written once, exactly sized, instead of
+			// copied full-size and then compacted with swap-removals.
+			const TConstArrayView<FTransform> SourceParkingSpaces = AvailableParkingSpacesForType.Left(FMath::CeilToInt(AvailableParkingSpacesForType.Num() * SpawnedEntityType.Proportion));
+			AvailableParkingSpacesForType.RightChopInline(SourceParkingSpaces.Num());
 
-			// Remove parking spaces overlapping obstacles
-			for (int32 ParkingSpaceIndex = 0; ParkingSpaceIndex < SpawnData.Transforms.Num(); )
+			// Remove parking spaces overlapping obstacles. The overlap tests are independent per
+			// space, so run them in parallel and gather the survivors afterwards.
+			if (!ObstacleLocationsToAvoid.IsEmpty())
 			{
-				const FVector ParkingSpacePosition = SpawnData.Transforms[ParkingSpaceIndex].GetLocation();
-
-				bool bOverlapsObstacle = false;
-				for(const FVector & ObstacleLocation : ObstacleLocationsToAvoid)
+				TArray<bool> ParkingSpaceOverlapsObstacle;
+				ParkingSpaceOverlapsObstacle.SetNumZeroed(SourceParkingSpaces.Num());
+				ParallelFor(SourceParkingSpaces.Num(), [&](int32 ParkingSpaceIndex)
 				{
-					if (FVector::DistSquared(ParkingSpacePosition, ObstacleLocation) < ObstacleRadiusSquared)
+					const FVector ParkingSpacePosition = SourceParkingSpaces[ParkingSpaceIndex].GetLocation();
+
+					for(const FVector & ObstacleLocation : ObstacleLocationsToAvoid)
 					{
-						bOverlapsObstacle = true;
-						break;
+						if (FVector::DistSquared(ParkingSpacePosition, ObstacleLocation) < ObstacleRadiusSquared)
+						{
+							ParkingSpaceOverlapsObstacle[ParkingSpaceIndex] = true;
+							break;
+						}
 					}
-				}
+				});
 
-				if (bOverlapsObstacle)
+				int32 NumSurvivors = 0;
+				for (const bool bOverlaps : ParkingSpaceOverlapsObstacle)
 				{
-					SpawnData.Transforms.RemoveAtSwap(ParkingSpaceIndex);
+					NumSurvivors += bOverlaps ? 0 : 1;
 				}
-				else
+
+				SpawnData.Transforms.Reserve(NumSurvivors);
+				for (int32 ParkingSpaceIndex = 0; ParkingSpaceIndex < SourceParkingSpaces.Num(); ++ParkingSpaceIndex)
 				{
-					++ParkingSpaceIndex;
+					if (!ParkingSpaceOverlapsObstacle[ParkingSpaceIndex])
+					{
+						SpawnData.Transforms.Add(SourceParkingSpaces[ParkingSpaceIndex]);
+					}
 				}
 			}
+			else
+			{
+				SpawnData.Transforms = TArray<FTransform>(SourceParkingSpaces);
+			}
 
 			// Spawn vehicles in remaining parking spaces
 			Result.NumEntities = SpawnData.Transforms.Num();
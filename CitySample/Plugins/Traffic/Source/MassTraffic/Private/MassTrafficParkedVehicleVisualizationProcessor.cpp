@@ -39,7 +39,10 @@ UMassTrafficParkedVehicleUpdateCustomVisualizationProcessor::UMassTrafficParkedV
 {
 	bAutoRegisterWithProcessingPhases = true;
 	ExecutionFlags = (int32)(EProcessorExecutionFlags::Client | EProcessorExecutionFlags::Standalone);
-	bRequiresGameThreadExecution = true;
+	// ISM instance updates are queued to the visualization command buffer rather than written
+	// directly, so this processor is free to run inside the parallel Mass execution.
+	// (See all VISBUFFER.)
+	bRequiresGameThreadExecution = false;
 	ExecutionOrder.ExecuteInGroup = UE::MassTraffic::ProcessorGroupNames::VehicleVisualization;
 	ExecutionOrder.ExecuteAfter.Add(UE::MassTraffic::ProcessorGroupNames::VehicleVisualizationLOD);
 	ExecutionOrder.ExecuteAfter.Add(UE::MassTraffic::ProcessorGroupNames::PreVehicleVisualization);
@@ -59,9 +62,7 @@ void UMassTrafficParkedVehicleUpdateCustomVisualizationProcessor::ConfigureQueri
 
 	EntityQuery.AddChunkRequirement<FMassVisualizationChunkFragment>(EMassFragmentAccess::ReadOnly);
 	EntityQuery.SetChunkFilter(&FMassVisualizationChunkFragment::AreAnyEntitiesVisibleInChunk);
-#if ENABLE_VISUAL_LOG
-	EntityQuery.AddSubsystemRequirement<UMassTrafficSubsystem>(EMassFragmentAccess::ReadOnly);
-#endif // ENABLE_VISUAL_LOG
+	EntityQuery.AddSubsystemRequirement<UMassTrafficSubsystem>(EMassFragmentAccess::ReadWrite);
 }
 
 void UMassTrafficParkedVehicleUpdateCustomVisualizationProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
@@ -73,9 +74,11 @@ void UMassTrafficParkedVehicleUpdateCustomVisualizationProcessor::Execute(FMassE
 	// total custom data count (e.g: 7 traffic + 0 parked)
 	EntityQuery.ForEachEntityChunk(Context, [this](FMassExecutionContext& Context)
 		{
+			// ISM instance updates are queued to the visualization command buffer for the
+			// end-of-group flush, rather than written directly here. (See all VISBUFFER.)
+			UMassTrafficSubsystem& MassTrafficSubsystem = Context.GetMutableSubsystemChecked<UMassTrafficSubsystem>();
 			UMassRepresentationSubsystem* RepresentationSubsystem = Context.GetMutableSharedFragment<FMassRepresentationSubsystemSharedFragment>().RepresentationSubsystem;
 			check(RepresentationSubsystem);
-			FMassInstancedStaticMeshInfoArrayView ISMInfo = RepresentationSubsystem->GetMutableInstancedStaticMeshInfos();
 
 			TConstArrayView<FTransformFragment> TransformList = Context.GetFragmentView<FTransformFragment>();
 			TConstArrayView<FMassTrafficRandomFractionFragment> RandomFractionFragments = Context.GetFragmentView<FMassTrafficRandomFractionFragment>();
@@ -90,11 +93,15 @@ void UMassTrafficParkedVehicleUpdateCustomVisualizationProcessor::Execute(FMassE
 				const FMassRepresentationLODFragment& VisualizationLODFragment = VisualizationLODFragments[EntityIt];
 				if (Visualization.CurrentRepresentation == EMassRepresentationType::StaticMeshInstance)
 				{
-					const FMassTrafficPackedVehicleInstanceCustomData PackedCustomData = FMassTrafficVehicleInstanceCustomData::MakeParkedVehicleCustomData(RandomFractionFragment);
-					
-					ISMInfo[Visualization.StaticMeshDescHandle.ToIndex()].AddBatchedTransform(Context.GetEntity(EntityIt)
-						, TransformFragment.GetTransform(), Visualization.PrevTransform, VisualizationLODFragment.LODSignificance);
-					ISMInfo[Visualization.StaticMeshDescHandle.ToIndex()].AddBatchedCustomData(PackedCustomData, VisualizationLODFragment.LODSignificance);
+					FMassTrafficVisualizationCommand VisualizationCommand;
+					VisualizationCommand.Entity = Context.GetEntity(EntityIt);
+					VisualizationCommand.RepresentationSubsystem = RepresentationSubsystem;
+					VisualizationCommand.StaticMeshDescIndex = Visualization.StaticMeshDescHandle.ToIndex();
+					VisualizationCommand.Transform = TransformFragment.GetTransform();
+					VisualizationCommand.PrevTransform = Visualization.PrevTransform;
+					VisualizationCommand.LODSignificance = VisualizationLODFragment.LODSignificance;
+					VisualizationCommand.PackedCustomData = FMassTrafficVehicleInstanceCustomData::MakeParkedVehicleCustomData(RandomFractionFragment);
+					MassTrafficSubsystem.GetMutableVisualizationCommandBuffer().Add(VisualizationCommand);
 				}
 				Visualization.PrevTransform = TransformFragment.GetTransform();
 			}
@@ -102,8 +109,9 @@ void UMassTrafficParkedVehicleUpdateCustomVisualizationProcessor::Execute(FMassE
 
 #if ENABLE_VISUAL_LOG
 	
-	// Debug draw current visualization
-	if (GMassTrafficDebugVisualization)
+	// Debug draw current visualization. Debug drawing is game thread only, so this is skipped when
+	// this processor was scheduled on a worker thread.
+	if (GMassTrafficDebugVisualization && IsInGameThread())
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("DebugDisplayVisualization")) 
 
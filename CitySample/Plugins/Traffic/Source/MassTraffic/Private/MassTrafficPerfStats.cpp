@@ -0,0 +1,75 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MassTrafficPerfStats.h"
+#include "HAL/IConsoleManager.h"
+
+CSV_DEFINE_CATEGORY_MODULE(MASSTRAFFIC_API, MassTrafficDetailed, false);
+
+namespace UE::MassTraffic
+{
+
+FPerfStatsRegistry& FPerfStatsRegistry::Get()
+{
+	static FPerfStatsRegistry Registry;
+	return Registry;
+}
+
+void FPerfStatsRegistry::RecordProcessor(const FName ProcessorName, const uint64 Cycles, const int64 NumEntities, const int32 NumChunks)
+{
+	{
+		FScopeLock Lock(&CriticalSection);
+
+		// First record of a new frame discards the previous frame's counters.
+		if (FrameNumber != GFrameCounter)
+		{
+			FrameNumber = GFrameCounter;
+			Stats.Reset();
+		}
+
+		FProcessorPerfStats& ProcessorStats = Stats.FindOrAdd(ProcessorName);
+		ProcessorStats.ExclusiveCycles += Cycles;
+		ProcessorStats.NumEntities += NumEntities;
+		ProcessorStats.NumChunks += NumChunks;
+	}
+
+#if CSV_PROFILER_STATS
+	FCsvProfiler::RecordCustomStat(ProcessorName, CSV_CATEGORY_INDEX(MassTrafficDetailed), static_cast<float>(FPlatformTime::ToMilliseconds64(Cycles)), ECsvCustomStatOp::Accumulate);
+#endif
+}
+
+void FPerfStatsRegistry::DumpSnapshot()
+{
+	FScopeLock Lock(&CriticalSection);
+
+	TArray<TPair<FName, FProcessorPerfStats>> SortedStats;
+	SortedStats.Reserve(Stats.Num());
+	for (const auto& StatsIt : Stats)
+	{
+		SortedStats.Add(StatsIt);
+	}
+	SortedStats.Sort([](const TPair<FName, FProcessorPerfStats>& A, const TPair<FName, FProcessorPerfStats>& B)
+	{
+		return A.Value.ExclusiveCycles > B.Value.ExclusiveCycles;
+	});
+
+	UE_LOG(LogMassTraffic, Log, TEXT("Traffic perf snapshot for frame %llu:"), FrameNumber);
+	UE_LOG(LogMassTraffic, Log, TEXT("%-60s %12s %10s %8s"), TEXT("Processor"), TEXT("Time (ms)"), TEXT("Entities"), TEXT("Chunks"));
+	for (const TPair<FName, FProcessorPerfStats>& SortedStatsIt : SortedStats)
+	{
+		UE_LOG(LogMassTraffic, Log, TEXT("%-60s %12.4f %10lld %8d"),
+			*SortedStatsIt.Key.ToString(),
+			FPlatformTime::ToMilliseconds64(SortedStatsIt.Value.ExclusiveCycles),
+			SortedStatsIt.Value.NumEntities,
+			SortedStatsIt.Value.NumChunks);
+	}
+}
+
+}
+
+static FAutoConsoleCommand GMassTrafficDumpPerfSnapshotCommand(
+	TEXT("masstraffic.DumpPerfSnapshot"),
+	TEXT("Logs a one-frame breakdown table of per-processor traffic times, entity counts and chunk counts. Only processors instrumented with FScopedProcessorPerfStats appear. (See all PERFSNAPSHOT.)"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		UE::MassTraffic::FPerfStatsRegistry::Get().DumpSnapshot();
+	}));
@@ -2,6 +2,7 @@
 
 #include "MassTrafficPostPhysicsUpdateDisturbedVehiclesProcessor.h"
 #include "MassTrafficMovement.h"
+#include "MassTrafficSubsystem.h"
 #include "MassTrafficVehicleInterface.h"
 #include "MassMovementFragments.h"
 #include "MassExecutionContext.h"
@@ -30,7 +31,7 @@ void UMassTrafficPostPhysicsUpdateDisturbedVehiclesProcessor::ConfigureQueries(c
 	DisturbedVehicleQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadWrite);
 	DisturbedVehicleQuery.AddRequirement<FMassVelocityFragment>(EMassFragmentAccess::ReadWrite);
 	DisturbedVehicleQuery.AddRequirement<FMassTrafficVehicleDamageFragment>(EMassFragmentAccess::ReadWrite);
-
+	DisturbedVehicleQuery.AddSubsystemRequirement<UMassTrafficSubsystem>(EMassFragmentAccess::ReadWrite);
 }
 
 void UMassTrafficPostPhysicsUpdateDisturbedVehiclesProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& ExecutionContext)
@@ -38,6 +39,8 @@ void UMassTrafficPostPhysicsUpdateDisturbedVehiclesProcessor::Execute(FMassEntit
 	// The main point of this processor is to update Mass with the location of the actor.
 	DisturbedVehicleQuery.ForEachEntityChunk(ExecutionContext, [&](FMassExecutionContext& Context)
 	{
+		UMassTrafficSubsystem& MassTrafficSubsystem = Context.GetMutableSubsystemChecked<UMassTrafficSubsystem>();
+
 		const TConstArrayView<FMassActorFragment> ActorFragments = Context.GetFragmentView<FMassActorFragment>();
 		const TArrayView<FMassRepresentationFragment> RepresentationFragments = Context.GetMutableFragmentView<FMassRepresentationFragment>();
 		const TArrayView<FTransformFragment> TransformFragments = Context.GetMutableFragmentView<FTransformFragment>();
@@ -74,6 +77,12 @@ void UMassTrafficPostPhysicsUpdateDisturbedVehiclesProcessor::Execute(FMassEntit
 					VehicleDamageFragment.VehicleDamageState = EMassTrafficVehicleDamageState::None;
 				}
 
+				// Queue damaged vehicles for the damage repair processor, so it only ever visits
+				// vehicles that actually reported damage. (See all DAMAGEQUEUE.)
+				if (VehicleDamageFragment.VehicleDamageState > EMassTrafficVehicleDamageState::None)
+				{
+					MassTrafficSubsystem.GetMutableDamagedVehiclesPendingRepair().Add(Context.GetEntity(EntityIt));
+				}
 			}
 		}
 	});
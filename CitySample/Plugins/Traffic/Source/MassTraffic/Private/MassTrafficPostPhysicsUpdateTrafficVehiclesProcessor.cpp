@@ -107,12 +107,19 @@ void UMassTrafficPostPhysicsUpdateTrafficVehiclesProcessor::Execute(FMassEntityM
 				// Update damage state
 				if (Actor->Implements<UMassTrafficVehicleInterface>())
 				{
-					VehicleDamageFragment.VehicleDamageState = IMassTrafficVehicleInterface::Execute_GetDamageState(Actor); 
+					VehicleDamageFragment.VehicleDamageState = IMassTrafficVehicleInterface::Execute_GetDamageState(Actor);
 				}
 				else
 				{
 					VehicleDamageFragment.VehicleDamageState = EMassTrafficVehicleDamageState::None;
 				}
+
+				// Queue damaged vehicles for the damage repair processor, so it only ever visits
+				// vehicles that actually reported damage. (See all DAMAGEQUEUE.)
+				if (VehicleDamageFragment.VehicleDamageState > EMassTrafficVehicleDamageState::None)
+				{
+					MassTrafficSubsystem.GetMutableDamagedVehiclesPendingRepair().Add(Context.GetEntity(EntityIt));
+				}
 			}
 			
 			// Get new distance along lane after simulation of both ChaosVehiclePhysics and SimpleVehiclePhysics
@@ -8,7 +8,9 @@
 #include "MassRepresentationFragments.h"
 #include "MassActorSubsystem.h"
 #include "MassTrafficPostPhysicsUpdateTrafficVehiclesProcessor.h"
+#include "PhysicsEngine/BodyInstance.h"
 #include "PhysicsEngine/PhysicsConstraintComponent.h"
+#include "Physics/PhysicsInterfaceCore.h"
 
 UMassTrafficPostPhysicsUpdateTrailersProcessor::UMassTrafficPostPhysicsUpdateTrailersProcessor(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -45,13 +47,21 @@ void UMassTrafficPostPhysicsUpdateTrailersProcessor::Execute(FMassEntityManager&
 		const TArrayView<FMassTrafficAngularVelocityFragment> TrailerAngularVelocityFragments = QueryContext.GetMutableFragmentView<FMassTrafficAngularVelocityFragment>();
 		const TArrayView<FMassTrafficConstrainedVehicleFragment> TrailerConstrainedVehicleFragments = QueryContext.GetMutableFragmentView<FMassTrafficConstrainedVehicleFragment>();
 
+		// Constrained trailers whose body velocities still need reading back, gathered so all the reads
+		// can happen under a single physics scene read lock below, instead of each GetPhysicsLinearVelocity /
+		// GetPhysicsAngularVelocityInRadians call acquiring the lock per trailer.
+		struct FConstrainedTrailerToSync
+		{
+			int32 EntityIndex = INDEX_NONE;
+			FBodyInstance* BodyInstance = nullptr;
+		};
+		TArray<FConstrainedTrailerToSync, TInlineAllocator<64>> TrailersToSync;
+
 		for (FMassExecutionContext::FEntityIterator EntityIt = QueryContext.CreateEntityIterator(); EntityIt; ++EntityIt)
 		{
 			FMassRepresentationFragment& TrailerRepresentationFragment = TrailerRepresentationFragments[EntityIt];
 			FTransformFragment& TrailerTransformFragment = TrailerTransformFragments[EntityIt];
-			FMassVelocityFragment& TrailerVelocityFragment = TrailerVelocityFragments[EntityIt];
-			FMassTrafficAngularVelocityFragment& TrailerAngularVelocityFragment = TrailerAngularVelocityFragments[EntityIt]; 
-			FMassTrafficConstrainedVehicleFragment& TrailerConstrainedVehicleFragment = TrailerConstrainedVehicleFragments[EntityIt]; 
+			FMassTrafficConstrainedVehicleFragment& TrailerConstrainedVehicleFragment = TrailerConstrainedVehicleFragments[EntityIt];
 
 			AActor* TrailerActor = TrailerActorFragments[EntityIt].GetMutable();
 			if (IsValid(TrailerActor) && TrailerRepresentationFragments[EntityIt].CurrentRepresentation == EMassRepresentationType::HighResSpawnedActor)
@@ -77,11 +87,11 @@ void UMassTrafficPostPhysicsUpdateTrailersProcessor::Execute(FMassEntityManager&
 					UPrimitiveComponent* RootComponent = Cast<UPrimitiveComponent>(TrailerActor->GetRootComponent());
 					if (ensure(RootComponent))
 					{
-						// Update velocity to current vehicle linear velocity
-						TrailerVelocityFragment.Value = RootComponent->GetPhysicsLinearVelocity();
-
-						// Update angular velocity
-						TrailerAngularVelocityFragment.AngularVelocity = RootComponent->GetPhysicsAngularVelocityInRadians();
+						// Queue velocity & angular velocity read-back for the batched locked read below
+						if (FBodyInstance* RootBodyInstance = RootComponent->GetBodyInstance())
+						{
+							TrailersToSync.Add({EntityIt, RootBodyInstance});
+						}
 					}
 
 					// Update PrevTransform for the next frame to use. RepresentationFragment has already run so this
@@ -97,5 +107,28 @@ void UMassTrafficPostPhysicsUpdateTrailersProcessor::Execute(FMassEntityManager&
 				}
 			}
 		}
+
+		// Read body velocities back in bulk for this chunk, under one scene read lock
+		if (!TrailersToSync.IsEmpty())
+		{
+			if (FPhysScene* PhysScene = TrailersToSync[0].BodyInstance->GetPhysicsScene())
+			{
+				FPhysicsCommand::ExecuteRead(PhysScene, [&]()
+				{
+					for (const FConstrainedTrailerToSync& TrailerToSync : TrailersToSync)
+					{
+						const FPhysicsActorHandle ActorHandle = TrailerToSync.BodyInstance->GetPhysicsActorHandle();
+						if (FPhysicsInterface::IsValid(ActorHandle))
+						{
+							// Update velocity to current vehicle linear velocity
+							TrailerVelocityFragments[TrailerToSync.EntityIndex].Value = FPhysicsInterface::GetLinearVelocity_AssumesLocked(ActorHandle);
+
+							// Update angular velocity
+							TrailerAngularVelocityFragments[TrailerToSync.EntityIndex].AngularVelocity = FPhysicsInterface::GetAngularVelocity_AssumesLocked(ActorHandle);
+						}
+					}
+				});
+			}
+		}
 	});
 }
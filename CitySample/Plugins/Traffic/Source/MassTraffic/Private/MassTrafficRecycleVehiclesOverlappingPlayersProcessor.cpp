@@ -4,6 +4,7 @@
 #include "MassTrafficRecycleVehiclesOverlappingPlayersProcessor.h"
 #include "MassActorSubsystem.h"
 #include "MassCommonFragments.h"
+#include "MassEntityView.h"
 #include "MassExecutionContext.h"
 #include "MassRepresentationProcessor.h"
 #include "MassSimulationLOD.h"
@@ -57,64 +58,116 @@ void UMassTrafficRecycleVehiclesOverlappingPlayersProcessor::Execute(FMassEntity
 		}
 	}
 
-	EntityQuery.ForEachEntityChunk(ExecutionContext,
-		[&PlayerLocations, &MassRepresentationSubsystem](FMassExecutionContext& Context)
+	// Stage 1 - detection. A cheap read-only distance pass that only collects candidates; the
+	// entity mutation that used to happen inline here is what caused the frame spike, so it now
+	// runs below, spread across frames under a time budget. (See all RECYCLESTAGED.)
+	if (bOverlapDetectionRequested)
 	{
-		const TConstArrayView<FAgentRadiusFragment> RadiusFragments = Context.GetFragmentView<FAgentRadiusFragment>();
-		const TConstArrayView<FTransformFragment> TransformFragments = Context.GetFragmentView<FTransformFragment>();
-		const TArrayView<FMassActorFragment> ActorFragments = Context.GetMutableFragmentView<FMassActorFragment>();
-		const TArrayView<FMassRepresentationLODFragment> RepresentationLODFragments = Context.GetMutableFragmentView<FMassRepresentationLODFragment>();
-		const TArrayView<FMassRepresentationFragment> VisualizationFragments = Context.GetMutableFragmentView<FMassRepresentationFragment>();
+		bOverlapDetectionRequested = false;
 
-		const bool bIsParkedVehicle = Context.DoesArchetypeHaveTag<FMassTrafficParkedVehicleTag>();
+		EntityQuery.ForEachEntityChunk(ExecutionContext,
+			[&PlayerLocations, this](FMassExecutionContext& Context)
+		{
+			const TConstArrayView<FAgentRadiusFragment> RadiusFragments = Context.GetFragmentView<FAgentRadiusFragment>();
+			const TConstArrayView<FTransformFragment> TransformFragments = Context.GetFragmentView<FTransformFragment>();
+
+			const bool bIsParkedVehicle = Context.DoesArchetypeHaveTag<FMassTrafficParkedVehicleTag>();
+
+			for (FMassExecutionContext::FEntityIterator EntityIt = Context.CreateEntityIterator(); EntityIt; ++EntityIt)
+			{
+				// Making the radius 2x to give us some room. Defaulted to 3m for parked cars which don't have radius fragments.
+				const float VehicleRadiusSquared = RadiusFragments.IsEmpty() ? FMath::Square(300.0f * 2) : FMath::Square(RadiusFragments[EntityIt].Radius * 2);
+
+				const FTransformFragment& TransformFragment = TransformFragments[EntityIt];
+				for(FVector PlayerLocation : PlayerLocations)
+				{
+					if (FVector::DistSquared(TransformFragment.GetTransform().GetLocation(), PlayerLocation) < VehicleRadiusSquared)
+					{
+						RecycleCandidates.Add({Context.GetEntity(EntityIt), VehicleRadiusSquared, bIsParkedVehicle});
+						break;
+					}
+				}
+			}
+		});
+	}
 
-		for (FMassExecutionContext::FEntityIterator EntityIt = Context.CreateEntityIterator(); EntityIt; ++EntityIt)
+	// Stage 2 - budgeted validation & recycle. Candidates are re-validated against the current
+	// transforms and player locations before mutation, since detection may have run frames ago.
+	// (See all RECYCLESTAGED.)
+	if (!RecycleCandidates.IsEmpty())
+	{
+		const double StartTimeSeconds = FPlatformTime::Seconds();
+		const double TimeBudgetSeconds = GMassTrafficRecycleBudgetMicroseconds * 0.000001;
+
+		int32 NumConsumed = 0;
+		for (; NumConsumed < RecycleCandidates.Num(); ++NumConsumed)
 		{
-			// Making the radius 2x to give us some room. Defaulted to 3m for parked cars which don't have radius fragments.
-			const float VehicleRadiusSquared = RadiusFragments.IsEmpty() ? FMath::Square(300.0f * 2) : FMath::Square(RadiusFragments[EntityIt].Radius * 2); 
+			// Always make progress on at least one vehicle per frame, however small the budget.
+			if (TimeBudgetSeconds > 0.0 && NumConsumed > 0 && FPlatformTime::Seconds() - StartTimeSeconds >= TimeBudgetSeconds)
+			{
+				break;
+			}
 
-			const FTransformFragment& TransformFragment = TransformFragments[EntityIt];
+			const FRecycleCandidate& Candidate = RecycleCandidates[NumConsumed];
+			if (!EntityManager.IsEntityValid(Candidate.Entity))
+			{
+				continue;
+			}
+
+			const FMassEntityView EntityView(EntityManager, Candidate.Entity);
+
+			// Skip vehicles already recycled (or queued for recycling) since detection ran
+			if (!Candidate.bIsParkedVehicle && !EntityView.HasTag<FMassTrafficVehicleTag>())
+			{
+				continue;
+			}
+
+			const FTransformFragment* TransformFragment = EntityView.GetFragmentDataPtr<FTransformFragment>();
+			FMassActorFragment* ActorFragment = EntityView.GetFragmentDataPtr<FMassActorFragment>();
+			FMassRepresentationFragment* RepresentationFragment = EntityView.GetFragmentDataPtr<FMassRepresentationFragment>();
+			FMassRepresentationLODFragment* RepresentationLODFragment = EntityView.GetFragmentDataPtr<FMassRepresentationLODFragment>();
+			if (!TransformFragment || !ActorFragment || !RepresentationFragment || !RepresentationLODFragment)
+			{
+				continue;
+			}
+
+			// Still overlapping a player?
 			bool bIsOverlappingPlayer = false;
-			for(FVector PlayerLocation : PlayerLocations)
+			for (FVector PlayerLocation : PlayerLocations)
 			{
-				if (FVector::DistSquared(TransformFragment.GetTransform().GetLocation(), PlayerLocation) < VehicleRadiusSquared)
+				if (FVector::DistSquared(TransformFragment->GetTransform().GetLocation(), PlayerLocation) < Candidate.RadiusSquared)
 				{
 					bIsOverlappingPlayer = true;
 					break;
 				}
 			}
-
-			// If we are overlapping the player, lets get rid of this vehicle.
-			if (bIsOverlappingPlayer)
+			if (!bIsOverlappingPlayer)
 			{
-				const FMassEntityHandle Entity = Context.GetEntity(EntityIt);
-				FMassActorFragment& ActorFragment = ActorFragments[EntityIt];
-				FMassRepresentationFragment& RepresentationFragment = VisualizationFragments[EntityIt];
-				FMassRepresentationLODFragment& RepresentationLODFragment = RepresentationLODFragments[EntityIt];
+				continue;
+			}
 
-				if (ActorFragment.IsValid())
-				{
-					const FMassEntityHandle MassAgent(Entity);
-					UMassRepresentationActorManagement::ReleaseAnyActorOrCancelAnySpawning(*MassRepresentationSubsystem, MassAgent, ActorFragment, RepresentationFragment);
-				}
+			if (ActorFragment->IsValid())
+			{
+				UMassRepresentationActorManagement::ReleaseAnyActorOrCancelAnySpawning(*MassRepresentationSubsystem, Candidate.Entity, *ActorFragment, *RepresentationFragment);
+			}
 
-				RepresentationLODFragment.LOD = EMassLOD::Off;
-				RepresentationFragment.CurrentRepresentation = EMassRepresentationType::None;
+			RepresentationLODFragment->LOD = EMassLOD::Off;
+			RepresentationFragment->CurrentRepresentation = EMassRepresentationType::None;
 
-				if (bIsParkedVehicle)
-				{
-					// We can safely destroy parked vehicles as they don't have references to other entities.
-					// Traffic vehicles do and destroying them will crash the game.
-					Context.Defer().DestroyEntity(Context.GetEntity(EntityIt));
-				}
-				else
-				{
-					// We recycle traffic vehicles back into the system instead of destroying them. This cleanly
-					// handles resetting them and clearing any pointers to other entities they may have.
-					Context.Defer().SwapTags<FMassTrafficVehicleTag, FMassTrafficRecyclableVehicleTag>(Entity);
-				}
+			if (Candidate.bIsParkedVehicle)
+			{
+				// We can safely destroy parked vehicles as they don't have references to other entities.
+				// Traffic vehicles do and destroying them will crash the game.
+				ExecutionContext.Defer().DestroyEntity(Candidate.Entity);
+			}
+			else
+			{
+				// We recycle traffic vehicles back into the system instead of destroying them. This cleanly
+				// handles resetting them and clearing any pointers to other entities they may have.
+				ExecutionContext.Defer().SwapTags<FMassTrafficVehicleTag, FMassTrafficRecyclableVehicleTag>(Candidate.Entity);
 			}
 		}
-	});
 
+		RecycleCandidates.RemoveAt(0, NumConsumed);
+	}
 }
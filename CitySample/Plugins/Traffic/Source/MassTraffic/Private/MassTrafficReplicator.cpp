@@ -1,7 +1,9 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "MassTrafficReplicator.h"
+#include "MassTraffic.h"
 #include "MassReplicationSubsystem.h"
+#include "GameFramework/PlayerController.h"
 #include "MassReplicationTypes.h"
 #include "MassClientBubbleHandler.h"
 #include "MassTrafficBubble.h"
@@ -9,8 +11,27 @@
 #include "MassLODSubsystem.h"
 #include "StructUtils/InstancedStruct.h"
 #include "MassTrafficFragments.h"
+#include "MassCommonFragments.h"
 #include "MassReplicationTransformHandlers.h"
 #include "MassExecutionContext.h"
+#include "MassZoneGraphNavigationFragments.h"
+
+#if UE_REPLICATION_COMPILE_SERVER_CODE
+
+/** Interest grid cell key for a world position, hashing X & Y only as traffic is largely planar.
+ * Same packing as FMassTrafficObstacleGrid::CellKey. (See all TRAFFICINTEREST.)
+ */
+static uint64 InterestCellKey(const int32 CellX, const int32 CellY)
+{
+	return (static_cast<uint64>(static_cast<uint32>(CellX)) << 32) | static_cast<uint32>(CellY);
+}
+
+static uint64 InterestCellKey(const FVector& Location, const float CellSize)
+{
+	return InterestCellKey(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+#endif // UE_REPLICATION_COMPILE_SERVER_CODE
 
 //----------------------------------------------------------------------//
 //  UMassTrafficReplicator
@@ -18,6 +39,8 @@
 void UMassTrafficReplicator::AddRequirements(FMassEntityQuery& EntityQuery)
 {
 	FMassReplicationProcessorPositionYawHandler::AddRequirements(EntityQuery);
+	EntityQuery.AddRequirement<FMassZoneGraphLaneLocationFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FMassTrafficVehicleControlFragment>(EMassFragmentAccess::ReadOnly);
 }
 
 void UMassTrafficReplicator::ProcessClientReplication(FMassExecutionContext& Context, FMassReplicationContext& ReplicationContext)
@@ -26,15 +49,72 @@ void UMassTrafficReplicator::ProcessClientReplication(FMassExecutionContext& Con
 
 	FMassReplicationProcessorPositionYawHandler PositionYawHandler;
 	TArrayView<FMassReplicatedAgentFragment> ReplicatedAgentList;
+	TConstArrayView<FMassZoneGraphLaneLocationFragment> LaneLocationList;
+	TConstArrayView<FMassTrafficVehicleControlFragment> VehicleControlList;
+	TConstArrayView<FTransformFragment> TransformList;
 	const FMassReplicationParameters* RepParams = nullptr;
 	FMassReplicationSharedFragment* RepSharedFrag = nullptr;
 
-	auto CacheViewsCallback = [&RepParams, &RepSharedFrag, &PositionYawHandler, &ReplicatedAgentList](FMassExecutionContext& Context)
+	// Per-connection interest cells, rebuilt once per replication pass from each client's current
+	// view position. An empty set means interest couldn't be established for that client (e.g. no
+	// controller yet) and fails open to full replication. (See all TRAFFICINTEREST.)
+	const float InterestRadius = GMassTrafficReplicationInterestRadius;
+	const float InterestCellSize = FMath::Max(GMassTrafficReplicationInterestCellSize, 1000.0f);
+	bool bInterestCellsBuilt = false;
+	TArray<TSet<uint64>> ClientInterestCells;
+
+	auto CacheViewsCallback = [&RepParams, &RepSharedFrag, &PositionYawHandler, &ReplicatedAgentList, &LaneLocationList, &VehicleControlList, &TransformList, &bInterestCellsBuilt, &ClientInterestCells, InterestRadius, InterestCellSize](FMassExecutionContext& Context)
 	{
 		PositionYawHandler.CacheFragmentViews(Context);
 		ReplicatedAgentList = Context.GetMutableFragmentView<FMassReplicatedAgentFragment>();
+		LaneLocationList = Context.GetFragmentView<FMassZoneGraphLaneLocationFragment>();
+		VehicleControlList = Context.GetFragmentView<FMassTrafficVehicleControlFragment>();
+		TransformList = Context.GetFragmentView<FTransformFragment>();
 		RepParams = &Context.GetConstSharedFragment<FMassReplicationParameters>();
 		RepSharedFrag = &Context.GetMutableSharedFragment<FMassReplicationSharedFragment>();
+
+		// Subscribe each connection to the square of cells covering its interest radius. Built
+		// here on the first chunk as the shared fragment's client list isn't available earlier.
+		if (InterestRadius > 0.0f && !bInterestCellsBuilt)
+		{
+			bInterestCellsBuilt = true;
+
+			const TArray<FMassClientHandle>& ClientHandles = RepSharedFrag->CachedClientHandles;
+			ClientInterestCells.SetNum(ClientHandles.Num());
+			for (int32 ClientIndex = 0; ClientIndex < ClientHandles.Num(); ++ClientIndex)
+			{
+				if (!ClientHandles[ClientIndex].IsValid())
+				{
+					continue;
+				}
+
+				// Bubble info actors are owned by their connection's player controller
+				ATrafficClientBubbleInfo& TrafficBubbleInfo = RepSharedFrag->GetTypedClientBubbleInfoChecked<ATrafficClientBubbleInfo>(ClientHandles[ClientIndex]);
+				const APlayerController* ClientController = Cast<APlayerController>(TrafficBubbleInfo.GetOwner());
+				if (!ClientController)
+				{
+					continue;
+				}
+
+				FVector ClientViewLocation(ForceInitToZero);
+				FRotator ClientViewRotation(ForceInit);
+				ClientController->GetPlayerViewPoint(ClientViewLocation, ClientViewRotation);
+
+				TSet<uint64>& InterestCells = ClientInterestCells[ClientIndex];
+				const int32 MinCellX = FMath::FloorToInt32((ClientViewLocation.X - InterestRadius) / InterestCellSize);
+				const int32 MaxCellX = FMath::FloorToInt32((ClientViewLocation.X + InterestRadius) / InterestCellSize);
+				const int32 MinCellY = FMath::FloorToInt32((ClientViewLocation.Y - InterestRadius) / InterestCellSize);
+				const int32 MaxCellY = FMath::FloorToInt32((ClientViewLocation.Y + InterestRadius) / InterestCellSize);
+				InterestCells.Reserve((MaxCellX - MinCellX + 1) * (MaxCellY - MinCellY + 1));
+				for (int32 CellX = MinCellX; CellX <= MaxCellX; ++CellX)
+				{
+					for (int32 CellY = MinCellY; CellY <= MaxCellY; ++CellY)
+					{
+						InterestCells.Add(InterestCellKey(CellX, CellY));
+					}
+				}
+			}
+		}
 	};
 
 	auto AddEntityCallback = [&RepSharedFrag, &PositionYawHandler](FMassExecutionContext& Context, const int32 EntityIdx, FReplicatedTrafficAgent& InReplicatedAgent, const FMassClientHandle ClientHandle)->FMassReplicatedAgentHandle
@@ -46,8 +126,21 @@ void UMassTrafficReplicator::ProcessClientReplication(FMassExecutionContext& Con
 		return TrafficBubbleInfo.GetTrafficSerializer().Bubble.AddAgent(Context.GetEntity(EntityIdx), InReplicatedAgent);
 	};
 
-	auto ModifyEntityCallback = [&ReplicationContext, &RepSharedFrag, &RepParams, &PositionYawHandler, &ReplicatedAgentList](FMassExecutionContext& Context, const int32 EntityIdx, const EMassLOD::Type LOD, const float Time, const FMassReplicatedAgentHandle Handle, const FMassClientHandle ClientHandle)
+	auto ModifyEntityCallback = [&ReplicationContext, &RepSharedFrag, &RepParams, &PositionYawHandler, &ReplicatedAgentList, &LaneLocationList, &VehicleControlList, &TransformList, &ClientInterestCells, InterestRadius, InterestCellSize](FMassExecutionContext& Context, const int32 EntityIdx, const EMassLOD::Type LOD, const float Time, const FMassReplicatedAgentHandle Handle, const FMassClientHandle ClientHandle)
 	{
+		// Outside this connection's interest cells? The agent stays tracked (and is still
+		// added/removed by replication LOD), it just stops receiving per-frame state updates
+		// for this client. (See all TRAFFICINTEREST.)
+		if (InterestRadius > 0.0f)
+		{
+			const int32 ClientIndex = ClientHandle.GetIndex();
+			if (ClientInterestCells.IsValidIndex(ClientIndex) && !ClientInterestCells[ClientIndex].IsEmpty()
+				&& !ClientInterestCells[ClientIndex].Contains(InterestCellKey(TransformList[EntityIdx].GetTransform().GetLocation(), InterestCellSize)))
+			{
+				return;
+			}
+		}
+
 		FMassReplicatedAgentFragment& AgentFragment = ReplicatedAgentList[EntityIdx];
 		FMassReplicatedAgentData& AgentData = AgentFragment.AgentData;
 
@@ -58,7 +151,21 @@ void UMassTrafficReplicator::ProcessClientReplication(FMassExecutionContext& Con
 			ATrafficClientBubbleInfo& TrafficBubbleInfo = RepSharedFrag->GetTypedClientBubbleInfoChecked<ATrafficClientBubbleInfo>(ClientHandle);
 			FTrafficClientBubbleHandler& Bubble = TrafficBubbleInfo.GetTrafficSerializer().Bubble;
 
-			PositionYawHandler.ModifyEntity<FTrafficFastArrayItem>(Handle, EntityIdx, Bubble.GetTransformHandlerMutable());
+			// Compact lane-space state - only dirties the fast array item when the quantized
+			// values actually changed, so stationary vehicles serialize nothing.
+			// (See all TRAFFICDELTA.)
+			const FMassZoneGraphLaneLocationFragment& LaneLocationFragment = LaneLocationList[EntityIdx];
+			FReplicatedTrafficVehicleDeltaData DeltaData;
+			DeltaData.SetLaneLocation(LaneLocationFragment.LaneHandle, LaneLocationFragment.DistanceAlongLane, LaneLocationFragment.LaneLength);
+			DeltaData.SetSpeed(VehicleControlList[EntityIdx].Speed);
+			Bubble.SetDeltaData(Handle, DeltaData);
+
+			// Periodic full position + yaw keyframe, both to bound quantization drift and for
+			// clients that can't resolve the lane against their local zone graph yet.
+			if (Bubble.ShouldKeyframe(Handle, Time, GMassTrafficReplicationKeyframeInterval))
+			{
+				PositionYawHandler.ModifyEntity<FTrafficFastArrayItem>(Handle, EntityIdx, Bubble.GetTransformHandlerMutable());
+			}
 
 			AgentData.LastUpdateTime = Time;
 		}
@@ -23,6 +23,27 @@
 #include "MassProcessingContext.h"
 
 
+#if WITH_EDITOR
+namespace UE::MassTraffic
+{
+	/**
+	 * Built lane data parked between PIE sessions, keyed by zone graph storage fingerprint. Entries
+	 * survive world teardown so a PIE start over an unchanged zone graph adopts the previous build
+	 * instead of running BuildLaneData again. Cleared whenever a zone graph build completes or the
+	 * lane settings change (both route through RebuildLaneData).
+	 */
+	static TMap<uint32, TUniquePtr<FMassTrafficZoneGraphData>> GPIELaneDataCache;
+
+	static uint32 ComputeZoneGraphStorageFingerprint(const FZoneGraphStorage& Storage)
+	{
+		uint32 Fingerprint = FCrc::MemCrc32(Storage.Lanes.GetData(), Storage.Lanes.Num() * Storage.Lanes.GetTypeSize());
+		Fingerprint = HashCombine(Fingerprint, GetTypeHash(Storage.LanePoints.Num()));
+		Fingerprint = HashCombine(Fingerprint, GetTypeHash(Storage.LaneLinks.Num()));
+		return Fingerprint;
+	}
+}
+#endif // WITH_EDITOR
+
 UMassTrafficSubsystem::UMassTrafficSubsystem()
 {
 	RemoveVehiclesOverlappingPlayersProcessor = CreateDefaultSubobject<UMassTrafficRecycleVehiclesOverlappingPlayersProcessor>(TEXT("RemoveVehiclesOverlappingPlayersProcessor"));
@@ -107,7 +128,22 @@ void UMassTrafficSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 {
 	Super::OnWorldBeginPlay(InWorld);
 
-	// Execute any field operations subclassing from UMassTrafficBeginPlayFieldOperationBase 
+	// Pre-extract simple vehicle physics templates for the configured template actors, so the
+	// extraction cost lands here during load instead of hitching the frame a vehicle type first
+	// appears.
+	for (const TSoftClassPtr<AWheeledVehiclePawn>& PhysicsVehicleTemplateActor : MassTrafficSettings->PhysicsVehicleTemplateActorsToWarm)
+	{
+		if (const TSubclassOf<AWheeledVehiclePawn> PhysicsVehicleTemplateActorClass = PhysicsVehicleTemplateActor.LoadSynchronous())
+		{
+			GetOrExtractVehiclePhysicsTemplate(PhysicsVehicleTemplateActorClass);
+		}
+	}
+
+	// Size the visualization command buffer up front, so no commands are dropped on the first
+	// frame. (See all VISBUFFER.)
+	VisualizationCommandBuffer.Reset(GMassTrafficVisualizationCommandBufferSize);
+
+	// Execute any field operations subclassing from UMassTrafficBeginPlayFieldOperationBase
 	PerformFieldOperation(UMassTrafficBeginPlayFieldOperationBase::StaticClass());
 }
 
@@ -134,6 +170,31 @@ void UMassTrafficSubsystem::Deinitialize()
 	UE::ZoneGraphDelegates::OnPostZoneGraphDataAdded.Remove(OnPostZoneGraphDataAddedHandle);
 	UE::ZoneGraphDelegates::OnPreZoneGraphDataRemoved.Remove(OnPreZoneGraphDataRemovedHandle);
 
+	if (RemoveVehiclesOverlappingPlayersTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(RemoveVehiclesOverlappingPlayersTickerHandle);
+		RemoveVehiclesOverlappingPlayersTickerHandle.Reset();
+	}
+
+#if WITH_EDITOR
+	// Park the built lane data so the next PIE session over an unchanged zone graph can adopt it
+	if (GIsEditor && GetDefault<UMassTrafficSettings>()->bCacheLaneDataAcrossPIESessions)
+	{
+		const UWorld* World = GetWorld();
+		if (World && World->IsGameWorld())
+		{
+			for (int32 Index = 0; Index < RegisteredTrafficZoneGraphData.Num(); ++Index)
+			{
+				FMassTrafficZoneGraphData& LaneData = RegisteredTrafficZoneGraphData[Index];
+				if (const uint32* StorageFingerprint = TrafficZoneGraphDataFingerprints.Find(Index); StorageFingerprint && !LaneData.TrafficLaneDataArray.IsEmpty())
+				{
+					UE::MassTraffic::GPIELaneDataCache.Add(*StorageFingerprint, MakeUnique<FMassTrafficZoneGraphData>(MoveTemp(LaneData)));
+				}
+			}
+		}
+	}
+#endif // WITH_EDITOR
+
 	EntityManager.Reset();
 
 	Super::Deinitialize();
@@ -194,8 +255,54 @@ void UMassTrafficSubsystem::RegisterZoneGraphData(const AZoneGraphData* ZoneGrap
 	FMassTrafficZoneGraphData& LaneData = RegisteredTrafficZoneGraphData[Index];
 	if (LaneData.DataHandle != Storage.DataHandle)
 	{
+#if WITH_EDITOR
+		const uint32 StorageFingerprint = UE::MassTraffic::ComputeZoneGraphStorageFingerprint(Storage);
+		TrafficZoneGraphDataFingerprints.Add(Index, StorageFingerprint);
+
+		TUniquePtr<FMassTrafficZoneGraphData> CachedLaneData;
+		if (GetDefault<UMassTrafficSettings>()->bCacheLaneDataAcrossPIESessions)
+		{
+			UE::MassTraffic::GPIELaneDataCache.RemoveAndCopyValue(StorageFingerprint, CachedLaneData);
+		}
+
+		if (CachedLaneData)
+		{
+			// Adopt the previous session's build. Moving the container keeps the lane array heap
+			// allocation in place, so the internal lane-to-lane pointers stay valid; only the data
+			// handles and per-lane runtime state need refreshing for the new session.
+			UE_VLOG_UELOG(this, LogMassTraffic, Log, TEXT("%s reusing cached lane data for %d/%d"), *WorldName, Storage.DataHandle.Index, Storage.DataHandle.Generation);
+
+			LaneData = MoveTemp(*CachedLaneData);
+			LaneData.DataHandle = Storage.DataHandle;
+
+			for (FZoneGraphTrafficLaneData& TrafficLaneData : LaneData.TrafficLaneDataArray)
+			{
+				TrafficLaneData.LaneHandle.DataHandle = Storage.DataHandle;
+				TrafficLaneData.ClearVehicles();
+				TrafficLaneData.bIsOpen = true;
+				TrafficLaneData.bIsAboutToClose = false;
+				TrafficLaneData.bIsStoppedVehicleInPreviousLaneOverlappingThisLane = false;
+				TrafficLaneData.bIsVehicleReadyToUseLane = false;
+				TrafficLaneData.FractionUntilClosed = 0.0f;
+			}
+
+			for (int32 Generation = 0; Generation < 2; ++Generation)
+			{
+				for (FMassTrafficLaneStateSnapshot& Snapshot : LaneData.LaneStateSnapshots[Generation])
+				{
+					Snapshot = FMassTrafficLaneStateSnapshot();
+				}
+			}
+		}
+		else
+		{
+			// Initialize lane data if here the first time.
+			BuildLaneData(LaneData, Storage);
+		}
+#else
 		// Initialize lane data if here the first time.
 		BuildLaneData(LaneData, Storage);
+#endif // WITH_EDITOR
 	}
 }
 
@@ -545,20 +652,132 @@ void UMassTrafficSubsystem::BuildLaneData(FMassTrafficZoneGraphData& TrafficZone
 		else
 		{
 			// If there turned out to be no next lanes (dead-end), use TrafficLane.ConstData.MinNextLaneSpeedLimit
-			// to have traffic come to a natural stop at the end of the lane. 
+			// to have traffic come to a natural stop at the end of the lane.
 			TrafficLaneData.ConstData.AverageNextLanesSpeedLimit = 0.0f;
 		}
+
+		// Precompute the lane change adjacency bitmask now that the left/right lane links (with
+		// overrides), merging lanes and splitting lanes are all resolved. Vehicles inline this
+		// with the rest of the lane const data on lane entry. (See all LANECHANGEMASK.)
+		EMassTrafficLaneChangeAdjacency LaneChangeAdjacencyMask = EMassTrafficLaneChangeAdjacency::None;
+		if (TrafficLaneData.LeftLane)
+		{
+			LaneChangeAdjacencyMask |= EMassTrafficLaneChangeAdjacency::LeftLane;
+		}
+		if (TrafficLaneData.RightLane)
+		{
+			LaneChangeAdjacencyMask |= EMassTrafficLaneChangeAdjacency::RightLane;
+		}
+		if (TrafficLaneData.bHasTransverseLaneAdjacency)
+		{
+			LaneChangeAdjacencyMask |= EMassTrafficLaneChangeAdjacency::Transverse;
+		}
+		if (!TrafficLaneData.MergingLanes.IsEmpty())
+		{
+			LaneChangeAdjacencyMask |= EMassTrafficLaneChangeAdjacency::Merging;
+		}
+		if (!TrafficLaneData.SplittingLanes.IsEmpty())
+		{
+			LaneChangeAdjacencyMask |= EMassTrafficLaneChangeAdjacency::Splitting;
+		}
+		TrafficLaneData.ConstData.LaneChangeAdjacencyMask = LaneChangeAdjacencyMask;
+	}
+
+	// Flatten each lane's successor candidates into a compact table, now that the NextLanes links
+	// are established, so ChooseNextLane can score candidates with flat array reads instead of
+	// chasing per-lane heap allocations. Intersection candidates are scored by their single
+	// post-intersection exit lane, so resolve that indirection here too. (See all LANESUCCESSOR.)
+	TrafficZoneGraphData.LaneSuccessorsBegin.SetNumUninitialized(ZoneGraphStorage.Lanes.Num() + 1);
+	TrafficZoneGraphData.LaneSuccessors.Reset();
+	for (int32 LaneIndex = 0; LaneIndex < ZoneGraphStorage.Lanes.Num(); LaneIndex++)
+	{
+		TrafficZoneGraphData.LaneSuccessorsBegin[LaneIndex] = TrafficZoneGraphData.LaneSuccessors.Num();
+
+		const FZoneGraphTrafficLaneData* TrafficLaneData = TrafficZoneGraphData.GetTrafficLaneData(LaneIndex);
+		if (!TrafficLaneData)
+		{
+			continue;
+		}
+
+		for (FZoneGraphTrafficLaneData* NextLane : TrafficLaneData->NextLanes)
+		{
+			FMassTrafficLaneSuccessor& Successor = TrafficZoneGraphData.LaneSuccessors.AddDefaulted_GetRef();
+			Successor.NextLane = NextLane;
+			Successor.bIsIntersectionLane = NextLane->ConstData.bIsIntersectionLane;
+			Successor.bIsTrunkLane = NextLane->ConstData.bIsTrunkLane;
+			Successor.bTurnsLeft = NextLane->bTurnsLeft;
+			Successor.bTurnsRight = NextLane->bTurnsRight;
+
+			const FZoneGraphTrafficLaneData* ScoredLane = NextLane;
+			if (NextLane->ConstData.bIsIntersectionLane)
+			{
+				// Intersection lanes must have exactly one next lane - at the intersection exit.
+				if (NextLane->NextLanes.Num() != 1)
+				{
+					UE_LOG(LogMassTraffic, Warning, TEXT("%s - Lane %s is an intersection lane, that should have only one next lane, but it has %d."),
+						ANSI_TO_TCHAR(__FUNCTION__), *NextLane->LaneHandle.ToString(), NextLane->NextLanes.Num());
+
+					// Leave ScoredLaneIndex at INDEX_NONE so scoring skips this candidate without
+					// re-checking the links.
+					continue;
+				}
+
+				ScoredLane = NextLane->NextLanes[0];
+			}
+
+			Successor.ScoredLaneIndex = ScoredLane->LaneHandle.Index;
+			Successor.ScoredLaneLength = ScoredLane->Length;
+			Successor.ScoredLaneSpeedLimit = ScoredLane->ConstData.SpeedLimit;
+		}
+	}
+	TrafficZoneGraphData.LaneSuccessorsBegin[ZoneGraphStorage.Lanes.Num()] = TrafficZoneGraphData.LaneSuccessors.Num();
+
+	// Build the overseer's compact candidate table, parallel to TrafficLaneDataArray, so the
+	// density management scan filters lanes with flat reads instead of striding through the full
+	// lane structs. (See all OVERSEERTABLE.)
+	TrafficZoneGraphData.OverseerCandidates.SetNum(TrafficZoneGraphData.TrafficLaneDataArray.Num());
+	for (int32 TrafficLaneDataIndex = 0; TrafficLaneDataIndex < TrafficZoneGraphData.TrafficLaneDataArray.Num(); ++TrafficLaneDataIndex)
+	{
+		const FZoneGraphTrafficLaneData& TrafficLaneData = TrafficZoneGraphData.TrafficLaneDataArray[TrafficLaneDataIndex];
+		FMassTrafficLaneOverseerCandidate& OverseerCandidate = TrafficZoneGraphData.OverseerCandidates[TrafficLaneDataIndex];
+		OverseerCandidate.LaneIndex = TrafficLaneData.LaneHandle.Index;
+		OverseerCandidate.CenterLocation = TrafficLaneData.CenterLocation;
+		OverseerCandidate.Radius = TrafficLaneData.Radius;
+		OverseerCandidate.Length = TrafficLaneData.Length;
+		OverseerCandidate.MaxDensity = TrafficLaneData.MaxDensity;
+		OverseerCandidate.bIsTrunkLane = TrafficLaneData.ConstData.bIsTrunkLane;
+		OverseerCandidate.bIsIntersectionLane = TrafficLaneData.ConstData.bIsIntersectionLane;
+		OverseerCandidate.bStaticTeleportEligible = TrafficLaneData.MergingLanes.IsEmpty() && TrafficLaneData.SplittingLanes.IsEmpty();
 	}
 }
 
 void UMassTrafficSubsystem::RegisterField(UMassTrafficFieldComponent* Field)
 {
 	Fields.AddUnique(Field);
+
+	// Index the field under each of its operations' classes so typed operation passes only visit
+	// fields that actually carry a matching operation
+	for (const UMassTrafficFieldOperationBase* Operation : Field->Operations)
+	{
+		if (Operation)
+		{
+			FieldsByOperationClass.FindOrAdd(Operation->GetClass()).AddUnique(Field);
+		}
+	}
 }
 
 void UMassTrafficSubsystem::UnregisterField(UMassTrafficFieldComponent* Field)
 {
 	Fields.Remove(Field);
+
+	for (auto It = FieldsByOperationClass.CreateIterator(); It; ++It)
+	{
+		It.Value().Remove(Field);
+		if (It.Value().IsEmpty())
+		{
+			It.RemoveCurrent();
+		}
+	}
 }
 
 const TMap<int32, FMassEntityHandle>& UMassTrafficSubsystem::GetTrafficIntersectionEntities() const
@@ -703,14 +922,31 @@ void UMassTrafficSubsystem::ClearAllTrafficLanes()
 void UMassTrafficSubsystem::PerformFieldOperation(TSubclassOf<UMassTrafficFieldOperationBase> OperationType)
 {
 	check(EntityManager);
+
+	// Gather the fields indexed under an operation class matching OperationType. Most operation
+	// passes match no field at all and return here without touching any field.
+	TSet<UMassTrafficFieldComponent*> MatchingFields;
+	for (const TPair<const UClass*, TArray<UMassTrafficFieldComponent*>>& OperationClassFields : FieldsByOperationClass)
+	{
+		if (OperationClassFields.Key->IsChildOf(OperationType))
+		{
+			MatchingFields.Append(OperationClassFields.Value);
+		}
+	}
+	if (MatchingFields.IsEmpty())
+	{
+		return;
+	}
+
 	FMassTrafficFieldOperationContextBase FieldOperationBaseContext(
 		*this,
 		*EntityManager,
 		*ZoneGraphSubsystem);
-					
+
+	// Iterate the main field list so execution keeps registration order
 	for (UMassTrafficFieldComponent* Field : Fields)
 	{
-		if (Field->bEnabled)
+		if (Field->bEnabled && MatchingFields.Contains(Field))
 		{
 			Field->PerformFieldOperation(OperationType, FieldOperationBaseContext);
 		}
@@ -735,6 +971,105 @@ void UMassTrafficSubsystem::GetAllObstacleLocations(TArray<FVector> & ObstacleLo
 	});
 }
 
+void FMassTrafficObstacleGrid::Reset(float InCellSize)
+{
+	CellSize = FMath::Max(InCellSize, 1.0f);
+	MaxEntryRadius = 0.0f;
+	NumEntries = 0;
+
+	// Keeps the map's hash allocation as obstacle counts are fairly stable frame to frame.
+	Cells.Reset();
+}
+
+void FMassTrafficObstacleGrid::Add(const FMassTrafficObstacleGridEntry& Entry)
+{
+	Cells.FindOrAdd(CellKey(CellCoord(Entry.Location.X), CellCoord(Entry.Location.Y))).Add(Entry);
+	MaxEntryRadius = FMath::Max(MaxEntryRadius, Entry.Radius);
+	++NumEntries;
+}
+
+void FMassTrafficObstacleGrid::QueryLaneSegment(const FVector& SegmentStart, const FVector& SegmentEnd, float QueryRadius, TArray<FMassTrafficObstacleGridEntry>& OutEntries) const
+{
+	if (NumEntries == 0)
+	{
+		return;
+	}
+
+	// Entries live in the cell containing their center, so the cell walk has to be padded by the
+	// largest entry radius in the grid to be sure no overlapping entry is missed.
+	const FVector::FReal Inflation = QueryRadius + MaxEntryRadius;
+	const int32 MinCellX = CellCoord(FMath::Min(SegmentStart.X, SegmentEnd.X) - Inflation);
+	const int32 MaxCellX = CellCoord(FMath::Max(SegmentStart.X, SegmentEnd.X) + Inflation);
+	const int32 MinCellY = CellCoord(FMath::Min(SegmentStart.Y, SegmentEnd.Y) - Inflation);
+	const int32 MaxCellY = CellCoord(FMath::Max(SegmentStart.Y, SegmentEnd.Y) + Inflation);
+
+	for (int32 CellX = MinCellX; CellX <= MaxCellX; ++CellX)
+	{
+		for (int32 CellY = MinCellY; CellY <= MaxCellY; ++CellY)
+		{
+			const TArray<FMassTrafficObstacleGridEntry>* Cell = Cells.Find(CellKey(CellX, CellY));
+			if (!Cell)
+			{
+				continue;
+			}
+
+			for (const FMassTrafficObstacleGridEntry& Entry : *Cell)
+			{
+				if (FMath::PointDistToSegmentSquared(Entry.Location, SegmentStart, SegmentEnd) <= FMath::Square(QueryRadius + Entry.Radius))
+				{
+					OutEntries.Add(Entry);
+				}
+			}
+		}
+	}
+}
+
+void UMassTrafficSubsystem::CaptureLaneStateSnapshots()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("CaptureLaneStateSnapshots"))
+
+	const int32 WriteIndex = LaneSnapshotReadIndex == INDEX_NONE ? 0 : 1 - LaneSnapshotReadIndex;
+	for (FMassTrafficZoneGraphData& TrafficZoneGraphData : RegisteredTrafficZoneGraphData)
+	{
+		TArray<FMassTrafficLaneStateSnapshot>& Snapshots = TrafficZoneGraphData.LaneStateSnapshots[WriteIndex];
+		Snapshots.Reset();
+		Snapshots.SetNum(TrafficZoneGraphData.TrafficLaneDataLookup.Num());
+
+		for (const FZoneGraphTrafficLaneData& TrafficLaneData : TrafficZoneGraphData.TrafficLaneDataArray)
+		{
+			FMassTrafficLaneStateSnapshot& Snapshot = Snapshots[TrafficLaneData.LaneHandle.Index];
+			Snapshot.SpaceAvailable = TrafficLaneData.SpaceAvailable;
+			Snapshot.FunctionalDensity = TrafficLaneData.FunctionalDensity();
+			Snapshot.DownstreamFlowDensity = TrafficLaneData.GetDownstreamFlowDensity();
+			Snapshot.NumVehiclesOnLane = TrafficLaneData.NumVehiclesOnLane;
+			Snapshot.NumVehiclesApproachingLane = TrafficLaneData.NumVehiclesApproachingLane;
+			Snapshot.NumReservedVehiclesOnLane = TrafficLaneData.NumReservedVehiclesOnLane;
+			Snapshot.bIsOpen = TrafficLaneData.bIsOpen;
+			Snapshot.bIsAboutToClose = TrafficLaneData.bIsAboutToClose;
+		}
+	}
+
+	// Publish the write generation as the new read generation.
+	LaneSnapshotReadIndex = WriteIndex;
+}
+
+const FMassTrafficLaneStateSnapshot* UMassTrafficSubsystem::GetLaneStateSnapshot(const FZoneGraphLaneHandle LaneHandle) const
+{
+	if (LaneSnapshotReadIndex == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	const FMassTrafficZoneGraphData* TrafficZoneGraphData = GetTrafficZoneGraphData(LaneHandle.DataHandle);
+	if (!TrafficZoneGraphData)
+	{
+		return nullptr;
+	}
+
+	const TArray<FMassTrafficLaneStateSnapshot>& Snapshots = TrafficZoneGraphData->LaneStateSnapshots[LaneSnapshotReadIndex];
+	return Snapshots.IsValidIndex(LaneHandle.Index) ? &Snapshots[LaneHandle.Index] : nullptr;
+}
+
 void UMassTrafficSubsystem::GetPlayerVehicleAgents(TArray<FMassEntityHandle>& OutPlayerVehicleAgents)
 {
 	check(EntityManager);
@@ -750,9 +1085,32 @@ void UMassTrafficSubsystem::GetPlayerVehicleAgents(TArray<FMassEntityHandle>& Ou
 void UMassTrafficSubsystem::RemoveVehiclesOverlappingPlayers()
 {
 	check(EntityManager);
+
+	// Kick off the staged recycle pipeline - the first run performs overlap detection and recycles
+	// as many candidates as the frame budget allows, then a ticker keeps draining the remainder
+	// across subsequent frames until the queue is empty. (See all RECYCLESTAGED.)
+	RemoveVehiclesOverlappingPlayersProcessor->RequestOverlapDetection();
+
 	TArray<UMassProcessor*> RemoveVehiclesOverlappingPlayersProcessors({RemoveVehiclesOverlappingPlayersProcessor.Get()});
 	FMassProcessingContext ProcessingContext(EntityManager);
 	UE::Mass::Executor::RunProcessorsView(RemoveVehiclesOverlappingPlayersProcessors, ProcessingContext);
+
+	if (RemoveVehiclesOverlappingPlayersProcessor->HasPendingRecycles() && !RemoveVehiclesOverlappingPlayersTickerHandle.IsValid())
+	{
+		RemoveVehiclesOverlappingPlayersTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float)
+		{
+			if (!EntityManager || !RemoveVehiclesOverlappingPlayersProcessor || !RemoveVehiclesOverlappingPlayersProcessor->HasPendingRecycles())
+			{
+				RemoveVehiclesOverlappingPlayersTickerHandle.Reset();
+				return false;
+			}
+
+			TArray<UMassProcessor*> ProcessorsView({RemoveVehiclesOverlappingPlayersProcessor.Get()});
+			FMassProcessingContext TickProcessingContext(EntityManager);
+			UE::Mass::Executor::RunProcessorsView(ProcessorsView, TickProcessingContext);
+			return true;
+		}));
+	}
 }
 
 const FMassTrafficSimpleVehiclePhysicsTemplate* UMassTrafficSubsystem::GetOrExtractVehiclePhysicsTemplate(TSubclassOf<AWheeledVehiclePawn> PhysicsVehicleTemplateActor)
@@ -813,6 +1171,9 @@ void UMassTrafficSubsystem::RebuildLaneData()
 		return;
 	}
 
+	// Lane data parked between PIE sessions was built with the old zone graph or settings
+	UE::MassTraffic::GPIELaneDataCache.Empty();
+
 	for (FMassTrafficZoneGraphData& LaneData : RegisteredTrafficZoneGraphData)
 	{
 		LaneData.Reset();
@@ -36,6 +36,7 @@ void FZoneGraphTrafficLaneData::ClearVehicles()
 	NumVehiclesLaneChangingOntoLane = 0;
 	NumVehiclesLaneChangingOffOfLane = 0;
 	NumReservedVehiclesOnLane = 0;
+	PackedFollowers.Reset();
 }
 
 void FZoneGraphTrafficLaneData::ForEachVehicleOnLane(const FMassEntityManager& EntityManager, FTrafficVehicleExecuteFunction Function) const
@@ -37,6 +37,7 @@ void UMassTrafficUpdateDistanceToNearestObstacleProcessor::ConfigureQueries(cons
 	EntityQuery_Conditional.AddRequirement<FMassTrafficVehicleLaneChangeFragment>(EMassFragmentAccess::ReadWrite, EMassFragmentPresence::Optional);
 	EntityQuery_Conditional.AddRequirement<FMassTrafficObstacleAvoidanceFragment>(EMassFragmentAccess::ReadWrite);
 	EntityQuery_Conditional.AddConstSharedRequirement<FMassTrafficVehicleSimulationParameters>();
+	EntityQuery_Conditional.AddSubsystemRequirement<UMassTrafficSubsystem>(EMassFragmentAccess::ReadOnly);
 	EntityQuery_Conditional.AddChunkRequirement<FMassSimulationVariableTickChunkFragment>(EMassFragmentAccess::ReadOnly);
 	EntityQuery_Conditional.SetChunkFilter(FMassSimulationVariableTickChunkFragment::ShouldTickChunkThisFrame);
 }
@@ -163,21 +164,20 @@ void UMassTrafficUpdateDistanceToNearestObstacleProcessor::Execute(FMassEntityMa
 					return true;
 				};
 
-				//TODO: The passed in enum also seems unnecessary now and could be easily refactored out  
+				//TODO: The passed in enum also seems unnecessary now and could be easily refactored out
 				auto CombineDistanceToNext = [this, &TransformFragment, &RadiusFragment, &AvoidanceFragment, &LaneChangeFragment, &bVisLog](
 					const EMassTrafficCombineDistanceToNextType CombineDistanceToNextType,
-					const FTransformFragment& NextTransformFragment,
-					const FAgentRadiusFragment& NextRadiusFragment) -> void
+					const FVector& NextLocation,
+					const float NextRadius) -> void
 				{
 					const FVector CurrentLocation = TransformFragment.GetTransform().GetLocation();
-					const FVector NextLocation = NextTransformFragment.GetTransform().GetLocation();
-				
+
 					// Here we use the current and other vehicle transforms & velocities, which won't have been updated this
 					// frame yet, so they'll be a frame off. This should be good enough though.
 
 					// Min distance apart - accounting for the edge (radius) of vehicles.
-					float MinDistanceToNext = FMath::Max(FVector::Distance(
-						TransformFragment.GetTransform().GetLocation(), NextTransformFragment.GetTransform().GetLocation()) - NextRadiusFragment.Radius - RadiusFragment.Radius,
+					float MinDistanceToNext = FMath::Max(
+						FVector::Distance(CurrentLocation, NextLocation) - NextRadius - RadiusFragment.Radius,
 						0.0f);
 
 					// Makes it so we can't pass by these next vehicles -
@@ -224,21 +224,56 @@ void UMassTrafficUpdateDistanceToNearestObstacleProcessor::Execute(FMassEntityMa
 
 				if (NextVehicleFragment.HasNextVehicle())
 				{
-					FMassEntityView NextView(EntityManager, NextVehicleFragment.GetNextVehicle());
-					const FTransformFragment& NextTransformFragment = NextView.GetFragmentData<FTransformFragment>();
-					const FAgentRadiusFragment& NextRadiusFragment = NextView.GetFragmentData<FAgentRadiusFragment>();
-					const FMassZoneGraphLaneLocationFragment& NextLaneLocationFragment = NextView.GetFragmentData<FMassZoneGraphLaneLocationFragment>();
+					const FMassEntityHandle NextVehicle = NextVehicleFragment.GetNextVehicle();
 
 					// (NOTE - Normal next vehicle references shouldn't be removed here, unlike the other code blocks like this.)
 
-					CombineDistanceToNext(EMassTrafficCombineDistanceToNextType::Next, NextTransformFragment, NextRadiusFragment);
+					// When the next vehicle is simply the car ahead on this lane, read it out of the
+					// lane's packed follower array - a neighbor read in a contiguous array - instead
+					// of dereferencing it through the entity manager. Cross-lane next vehicles fall
+					// back to the entity view below. (See all LANEFOLLOWERS.)
+					bool bCombinedFromPackedFollowers = false;
+					const UMassTrafficSubsystem& MassTrafficSubsystem = QueryContext.GetSubsystemChecked<UMassTrafficSubsystem>();
+					if (const FZoneGraphTrafficLaneData* TrafficLaneData = MassTrafficSubsystem.GetTrafficLaneData(LaneLocationFragment.LaneHandle))
+					{
+						const TArray<FMassTrafficLaneFollower>& PackedFollowers = TrafficLaneData->PackedFollowers;
+						const int32 SelfFollowerIndex = PackedFollowers.IndexOfByPredicate([&QueryContext, &EntityIt](const FMassTrafficLaneFollower& Follower)
+						{
+							return Follower.Entity == QueryContext.GetEntity(EntityIt);
+						});
+						if (SelfFollowerIndex != INDEX_NONE && PackedFollowers.IsValidIndex(SelfFollowerIndex + 1) && PackedFollowers[SelfFollowerIndex + 1].Entity == NextVehicle)
+						{
+							const FMassTrafficLaneFollower& NextFollower = PackedFollowers[SelfFollowerIndex + 1];
+							CombineDistanceToNext(EMassTrafficCombineDistanceToNextType::Next, NextFollower.Location, NextFollower.Radius);
 
-					// If the next vehicle is behind us, clamp the distance to 0.0f. Otherwise, with the distance being
-					// positive, vehicle control would assume there is space opening up *in front* of this vehicle and proceed
-					// to accelerate up to max speed and keep driving further ahead / away from the Next vehicle.
-					if (LaneLocationFragment.LaneHandle == NextLaneLocationFragment.LaneHandle && LaneLocationFragment.DistanceAlongLane > NextLaneLocationFragment.DistanceAlongLane)
+							// If the next vehicle is behind us, clamp the distance to 0.0f. Otherwise, with the distance being
+							// positive, vehicle control would assume there is space opening up *in front* of this vehicle and proceed
+							// to accelerate up to max speed and keep driving further ahead / away from the Next vehicle.
+							if (LaneLocationFragment.DistanceAlongLane > NextFollower.DistanceAlongLane)
+							{
+								AvoidanceFragment.DistanceToNext = 0.0f;
+							}
+
+							bCombinedFromPackedFollowers = true;
+						}
+					}
+
+					if (!bCombinedFromPackedFollowers)
 					{
-						AvoidanceFragment.DistanceToNext = 0.0f;
+						FMassEntityView NextView(EntityManager, NextVehicle);
+						const FTransformFragment& NextTransformFragment = NextView.GetFragmentData<FTransformFragment>();
+						const FAgentRadiusFragment& NextRadiusFragment = NextView.GetFragmentData<FAgentRadiusFragment>();
+						const FMassZoneGraphLaneLocationFragment& NextLaneLocationFragment = NextView.GetFragmentData<FMassZoneGraphLaneLocationFragment>();
+
+						CombineDistanceToNext(EMassTrafficCombineDistanceToNextType::Next, NextTransformFragment.GetTransform().GetLocation(), NextRadiusFragment.Radius);
+
+						// If the next vehicle is behind us, clamp the distance to 0.0f. Otherwise, with the distance being
+						// positive, vehicle control would assume there is space opening up *in front* of this vehicle and proceed
+						// to accelerate up to max speed and keep driving further ahead / away from the Next vehicle.
+						if (LaneLocationFragment.LaneHandle == NextLaneLocationFragment.LaneHandle && LaneLocationFragment.DistanceAlongLane > NextLaneLocationFragment.DistanceAlongLane)
+						{
+							AvoidanceFragment.DistanceToNext = 0.0f;
+						}
 					}
 				}
 
@@ -261,7 +296,7 @@ void UMassTrafficUpdateDistanceToNearestObstacleProcessor::Execute(FMassEntityMa
 					}
 					else
 					{
-						CombineDistanceToNext(EMassTrafficCombineDistanceToNextType::LaneChangeNext, NextTransformFragment, NextRadiusFragment);
+						CombineDistanceToNext(EMassTrafficCombineDistanceToNextType::LaneChangeNext, NextTransformFragment.GetTransform().GetLocation(), NextRadiusFragment.Radius);
 					}
 				}
 			
@@ -279,7 +314,7 @@ void UMassTrafficUpdateDistanceToNearestObstacleProcessor::Execute(FMassEntityMa
 					}
 					else
 					{
-						CombineDistanceToNext(EMassTrafficCombineDistanceToNextType::SpittingLaneGhostNext, NextTransformFragment, NextRadiusFragment);
+						CombineDistanceToNext(EMassTrafficCombineDistanceToNextType::SpittingLaneGhostNext, NextTransformFragment.GetTransform().GetLocation(), NextRadiusFragment.Radius);
 					}
 				}
 			
@@ -291,7 +326,7 @@ void UMassTrafficUpdateDistanceToNearestObstacleProcessor::Execute(FMassEntityMa
 
 					// (NOTE - Merging next vehicle references shouldn't be removed here, unlike the other code blocks like this.)
 
-					CombineDistanceToNext(EMassTrafficCombineDistanceToNextType::MergingLaneGhostNext, NextTransformFragment, NextRadiusFragment);
+					CombineDistanceToNext(EMassTrafficCombineDistanceToNextType::MergingLaneGhostNext, NextTransformFragment.GetTransform().GetLocation(), NextRadiusFragment.Radius);
 				}
 			}
 		
@@ -299,12 +334,23 @@ void UMassTrafficUpdateDistanceToNearestObstacleProcessor::Execute(FMassEntityMa
 			// Obstacle list?
 			if (!OptionalObstacleListFragments.IsEmpty())
 			{
+				// Obstacle grid, rebuilt this frame by UMassTrafficFindObstaclesProcessor. (See all OBSTACLEGRID.)
+				const UMassTrafficSubsystem& MassTrafficSubsystem = QueryContext.GetSubsystemChecked<UMassTrafficSubsystem>();
+				const FMassTrafficObstacleGrid& ObstacleGrid = MassTrafficSubsystem.GetObstacleGrid();
+
+				// Per-entity grid query results and SoA gather scratch, reused across entities.
+				// Gathering the queried obstacles into parallel position / velocity / radius arrays
+				// lets the min-reduction below run vectorized. (See all TTCBATCH.)
+				TArray<FMassTrafficObstacleGridEntry> NearbyObstacles;
+				TArray<float> ObstacleLocationsX, ObstacleLocationsY, ObstacleLocationsZ;
+				TArray<float> ObstacleVelocitiesX, ObstacleVelocitiesY, ObstacleVelocitiesZ;
+				TArray<float> ObstacleRadii;
+
 				for (FMassExecutionContext::FEntityIterator EntityIt = QueryContext.CreateEntityIterator(); EntityIt; ++EntityIt)
 				{
 					const FTransformFragment& TransformFragment = TransformFragments[EntityIt];
 					const FMassTrafficVehicleControlFragment& VehicleControlFragment = VehicleControlFragments[EntityIt];
 					const FAgentRadiusFragment& AgentRadiusFragment = RadiusFragments[EntityIt];
-					const FMassTrafficObstacleListFragment& OptionalObstacleListFragment = OptionalObstacleListFragments[EntityIt];
 					FMassTrafficObstacleAvoidanceFragment& AvoidanceFragment = AvoidanceFragments[EntityIt];
 
 					// Once this vehicle slows down to a stop to avoid an obstacle, it's velocity is 0 and thus a collision
@@ -317,54 +363,79 @@ void UMassTrafficUpdateDistanceToNearestObstacleProcessor::Execute(FMassEntityMa
 					AvoidanceFragment.TimeToCollidingObstacle = TNumericLimits<float>::Max();
 					AvoidanceFragment.DistanceToCollidingObstacle = TNumericLimits<float>::Max();
 
-					// Loop through obstacles
-					for (const FMassEntityHandle& Obstacle : OptionalObstacleListFragment.Obstacles) 
+					// Query the obstacle grid for obstacles along the stretch of lane this vehicle could
+					// cover before braking to a stop, instead of testing every obstacle this vehicle was
+					// bound to. (See all OBSTACLEGRID.)
+					const FVector CurrentLocation = TransformFragment.GetTransform().GetLocation();
+					NearbyObstacles.Reset();
+					ObstacleGrid.QueryLaneSegment(
+						CurrentLocation,
+						CurrentLocation + IdealVelocity * MassTrafficSettings->ObstacleAvoidanceBrakingTimeRange.Y,
+						AgentRadiusFragment.Radius,
+						NearbyObstacles);
+
+					// Gather the obstacles into the SoA scratch, skipping ourselves. (See all TTCBATCH.)
+					ObstacleLocationsX.Reset(NearbyObstacles.Num());
+					ObstacleLocationsY.Reset(NearbyObstacles.Num());
+					ObstacleLocationsZ.Reset(NearbyObstacles.Num());
+					ObstacleVelocitiesX.Reset(NearbyObstacles.Num());
+					ObstacleVelocitiesY.Reset(NearbyObstacles.Num());
+					ObstacleVelocitiesZ.Reset(NearbyObstacles.Num());
+					ObstacleRadii.Reset(NearbyObstacles.Num());
+					for (const FMassTrafficObstacleGridEntry& Obstacle : NearbyObstacles)
 					{
-						// Get distance to obstacle
-						if (EntityManager.IsEntityValid(Obstacle) && Obstacle.IsSet())
+						if (Obstacle.Entity == QueryContext.GetEntity(EntityIt))
 						{
-							FMassEntityView ObstacleView(EntityManager, Obstacle);
-							const FTransformFragment& ObstacleTransformFragment = ObstacleView.GetFragmentData<FTransformFragment>();
-							const FMassVelocityFragment* ObstacleVelocityFragment = ObstacleView.GetFragmentDataPtr<FMassVelocityFragment>();
-							const FAgentRadiusFragment& ObstacleAgentRadiusFragment = ObstacleView.GetFragmentData<FAgentRadiusFragment>();
-				
-							// Here we use the current and next vehicle transforms & velocities, which won't have been updated this
-							// frame yet, so they'll be a frame off. This should be good enough though.
-							float TimeToCollidingObstacle = UE::MassTraffic::TimeToCollision(
-									TransformFragment.GetTransform().GetLocation(),
-									IdealVelocity,
-									AgentRadiusFragment.Radius,
-									ObstacleTransformFragment.GetTransform().GetLocation(),
-									ObstacleVelocityFragment ? ObstacleVelocityFragment->Value : FVector::ZeroVector,
-									ObstacleAgentRadiusFragment.Radius);
-
-							if (TimeToCollidingObstacle < AvoidanceFragment.TimeToCollidingObstacle)
-							{
-								AvoidanceFragment.TimeToCollidingObstacle = TimeToCollidingObstacle;
-							
-								// Also compute distance to colliding obstacles
-								AvoidanceFragment.DistanceToCollidingObstacle = FMath::Max(FVector::Distance(TransformFragment.GetTransform().GetLocation(), ObstacleTransformFragment.GetTransform().GetLocation()) - ObstacleAgentRadiusFragment.Radius - AgentRadiusFragment.Radius, 0.0f);
-							}
+							continue;
+						}
 
-							// VisLog
-							#if WITH_MASSTRAFFIC_DEBUG
-							if (GMassTrafficDebugDistanceToNext)
-							{
-								DrawDebugDirectionalArrow(GetWorld(), TransformFragment.GetTransform().GetLocation(), ObstacleTransformFragment.GetTransform().GetLocation(), 100.0f, FColor::Orange);
+						ObstacleLocationsX.Add(Obstacle.Location.X);
+						ObstacleLocationsY.Add(Obstacle.Location.Y);
+						ObstacleLocationsZ.Add(Obstacle.Location.Z);
+						ObstacleVelocitiesX.Add(Obstacle.Velocity.X);
+						ObstacleVelocitiesY.Add(Obstacle.Velocity.Y);
+						ObstacleVelocitiesZ.Add(Obstacle.Velocity.Z);
+						ObstacleRadii.Add(Obstacle.Radius);
+
+						// VisLog
+						#if WITH_MASSTRAFFIC_DEBUG
+						if (GMassTrafficDebugDistanceToNext)
+						{
+							DrawDebugDirectionalArrow(GetWorld(), CurrentLocation, Obstacle.Location, 100.0f, FColor::Orange);
 
-								DrawDebugBox(GetWorld(),
-										TransformFragment.GetTransform().GetLocation(),
-										FVector(AgentRadiusFragment.Radius, SimulationParams.HalfWidth, SimulationParams.HalfWidth),
-										TransformFragment.GetTransform().GetRotation(),
-										FColor::Orange);
+							DrawDebugBox(GetWorld(),
+									CurrentLocation,
+									FVector(AgentRadiusFragment.Radius, SimulationParams.HalfWidth, SimulationParams.HalfWidth),
+									TransformFragment.GetTransform().GetRotation(),
+									FColor::Orange);
 
-							}
-							if (OptionalDebugFragments[EntityIt].bVisLog)
-							{
-								UE_VLOG_ARROW(LogOwner, LogMassTraffic, Display, TransformFragment.GetTransform().GetLocation(), ObstacleTransformFragment.GetTransform().GetLocation(), FColor::Yellow, TEXT(""));
-							}
-							#endif
 						}
+						if (OptionalDebugFragments[EntityIt].bVisLog)
+						{
+							UE_VLOG_ARROW(LogOwner, LogMassTraffic, Display, CurrentLocation, Obstacle.Location, FColor::Yellow, TEXT(""));
+						}
+						#endif
+					}
+
+					// Here we use the current and next vehicle transforms & velocities, which won't have been updated this
+					// frame yet, so they'll be a frame off. This should be good enough though.
+					// Vectorized min-reduction over the gathered obstacles. (See all TTCBATCH.)
+					int32 MinObstacleIndex = INDEX_NONE;
+					const float MinTimeToCollidingObstacle = UE::MassTraffic::TimeToCollisionBatch(
+						CurrentLocation,
+						IdealVelocity,
+						AgentRadiusFragment.Radius,
+						ObstacleLocationsX, ObstacleLocationsY, ObstacleLocationsZ,
+						ObstacleVelocitiesX, ObstacleVelocitiesY, ObstacleVelocitiesZ,
+						ObstacleRadii,
+						MinObstacleIndex);
+					if (MinObstacleIndex != INDEX_NONE)
+					{
+						AvoidanceFragment.TimeToCollidingObstacle = MinTimeToCollidingObstacle;
+
+						// Also compute distance to the colliding obstacle
+						const FVector MinObstacleLocation(ObstacleLocationsX[MinObstacleIndex], ObstacleLocationsY[MinObstacleIndex], ObstacleLocationsZ[MinObstacleIndex]);
+						AvoidanceFragment.DistanceToCollidingObstacle = FMath::Max(FVector::Distance(CurrentLocation, MinObstacleLocation) - ObstacleRadii[MinObstacleIndex] - AgentRadiusFragment.Radius, 0.0f);
 					}
 				}
 			}
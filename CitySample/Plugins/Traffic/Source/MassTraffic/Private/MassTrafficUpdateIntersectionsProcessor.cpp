@@ -543,6 +543,23 @@ void UMassTrafficUpdateIntersectionsProcessor::Execute(FMassEntityManager& Entit
 				continue;
 			}
 
+			// Traffic-light intersections deep in a stable period can't change lane state until
+			// their timers near the prepare-to-stop window, so they only need an occasional
+			// countdown visit - the time they were skipped for is applied in one step on the next
+			// full update. Intersections near a transition, waiting to clear or running a yellow
+			// light update every frame as before, as do stop-sign intersections, whose periods end
+			// in reaction to vehicles rather than timers. (See all INTERSLEEP.)
+			if (GMassTrafficIntersectionSleepUpdateInterval > 0.0f && IntersectionFragment.bHasTrafficLights && !GMassTrafficDebugIntersections)
+			{
+				const float PendingUpdateTime = IntersectionFragment.DeferredUpdateTime + DeltaTimeSeconds;
+				if (PendingUpdateTime < GMassTrafficIntersectionSleepUpdateInterval &&
+					IntersectionFragment.PeriodTimeRemaining - PendingUpdateTime > MassTrafficSettings->StandardTrafficPrepareToStopSeconds)
+				{
+					IntersectionFragment.DeferredUpdateTime = PendingUpdateTime;
+					continue;
+				}
+			}
+
 			#if WITH_MASSTRAFFIC_DEBUG
 				// Limit debug drawing to the High LOD of the intersections.
 				const FMassRepresentationLODFragment& RepresentationLODFragment = RepresentationLODFragments[EntityIt];
@@ -592,7 +609,10 @@ void UMassTrafficUpdateIntersectionsProcessor::Execute(FMassEntityManager& Entit
 			
 			if (IntersectionFragment.PeriodTimeRemaining > 0.0f)
 			{
-				const float CountDownSpeedSeconds = DeltaTimeSeconds;
+				// Count down by this frame's time plus any time accumulated while updates for this
+				// intersection were deferred. (See all INTERSLEEP.)
+				const float CountDownSpeedSeconds = DeltaTimeSeconds + IntersectionFragment.DeferredUpdateTime;
+				IntersectionFragment.DeferredUpdateTime = 0.0f;
 
 				
 				// Check if we can zoom by this period, or if we need to wait.
@@ -0,0 +1,81 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MassTrafficUpdateLaneFollowersProcessor.h"
+#include "MassTraffic.h"
+#include "MassTrafficFragments.h"
+#include "MassTrafficSubsystem.h"
+
+#include "MassCommonFragments.h"
+#include "MassExecutionContext.h"
+#include "MassZoneGraphNavigationFragments.h"
+
+
+UMassTrafficUpdateLaneFollowersProcessor::UMassTrafficUpdateLaneFollowersProcessor()
+	: EntityQuery(*this)
+{
+	bAutoRegisterWithProcessingPhases = true;
+	ProcessingPhase = EMassProcessingPhase::PostPhysics;
+	ExecutionOrder.ExecuteAfter.Add(UE::MassTraffic::ProcessorGroupNames::PostPhysicsUpdateTrafficVehicles);
+	ExecutionOrder.ExecuteBefore.Add(UE::MassTraffic::ProcessorGroupNames::PostPhysicsUpdateDistanceToNearestObstacle);
+}
+
+void UMassTrafficUpdateLaneFollowersProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	EntityQuery.AddTagRequirement<FMassTrafficVehicleTag>(EMassFragmentPresence::All);
+	EntityQuery.AddRequirement<FMassZoneGraphLaneLocationFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FAgentRadiusFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddSubsystemRequirement<UMassTrafficSubsystem>(EMassFragmentAccess::ReadWrite);
+
+	ProcessorRequirements.AddSubsystemRequirement<UMassTrafficSubsystem>(EMassFragmentAccess::ReadWrite);
+}
+
+void UMassTrafficUpdateLaneFollowersProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	UMassTrafficSubsystem& MassTrafficSubsystem = Context.GetMutableSubsystemChecked<UMassTrafficSubsystem>();
+
+	// Clear only the lanes that had followers last frame - the rest are already empty.
+	for (FZoneGraphTrafficLaneData* TrafficLaneData : LanesWithPackedFollowers)
+	{
+		TrafficLaneData->PackedFollowers.Reset();
+	}
+	LanesWithPackedFollowers.Reset();
+
+	// Gather every traffic vehicle into its lane's packed array.
+	EntityQuery.ForEachEntityChunk(Context, [&](FMassExecutionContext& QueryContext)
+	{
+		const TConstArrayView<FMassZoneGraphLaneLocationFragment> LaneLocationFragments = QueryContext.GetFragmentView<FMassZoneGraphLaneLocationFragment>();
+		const TConstArrayView<FTransformFragment> TransformFragments = QueryContext.GetFragmentView<FTransformFragment>();
+		const TConstArrayView<FAgentRadiusFragment> RadiusFragments = QueryContext.GetFragmentView<FAgentRadiusFragment>();
+
+		for (FMassExecutionContext::FEntityIterator EntityIt = QueryContext.CreateEntityIterator(); EntityIt; ++EntityIt)
+		{
+			const FMassZoneGraphLaneLocationFragment& LaneLocationFragment = LaneLocationFragments[EntityIt];
+			FZoneGraphTrafficLaneData* TrafficLaneData = MassTrafficSubsystem.GetMutableTrafficLaneData(LaneLocationFragment.LaneHandle);
+			if (!TrafficLaneData)
+			{
+				continue;
+			}
+
+			if (TrafficLaneData->PackedFollowers.IsEmpty())
+			{
+				LanesWithPackedFollowers.Add(TrafficLaneData);
+			}
+
+			FMassTrafficLaneFollower& Follower = TrafficLaneData->PackedFollowers.AddDefaulted_GetRef();
+			Follower.Entity = QueryContext.GetEntity(EntityIt);
+			Follower.DistanceAlongLane = LaneLocationFragment.DistanceAlongLane;
+			Follower.Radius = RadiusFragments[EntityIt].Radius;
+			Follower.Location = TransformFragments[EntityIt].GetTransform().GetLocation();
+		}
+	});
+
+	// Distance-sort each lane's followers. Lanes hold few vehicles, so these are tiny sorts.
+	for (FZoneGraphTrafficLaneData* TrafficLaneData : LanesWithPackedFollowers)
+	{
+		TrafficLaneData->PackedFollowers.Sort([](const FMassTrafficLaneFollower& FollowerA, const FMassTrafficLaneFollower& FollowerB)
+		{
+			return FollowerA.DistanceAlongLane < FollowerB.DistanceAlongLane;
+		});
+	}
+}
@@ -19,6 +19,20 @@
 
 using namespace UE::MassTraffic;
 
+/**
+ * Set by MassTraffic.ValidateAllNow and consumed by the next validation pass, which then checks every
+ * vehicle regardless of MassTraffic.ValidationSampleInterval. (See all VALIDATIONSLICE.)
+ */
+static bool GMassTrafficValidationFullCheckRequested = false;
+
+static FAutoConsoleCommand MassTrafficValidateAllNowCmd(
+	TEXT("MassTraffic.ValidateAllNow"),
+	TEXT("Forces the next validation pass to check every vehicle, regardless of MassTraffic.ValidationSampleInterval. (See all VALIDATIONSLICE.)"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		GMassTrafficValidationFullCheckRequested = true;
+	}));
+
 UMassTrafficValidationProcessor::UMassTrafficValidationProcessor()
 	: EntityQuery_Conditional(*this)
 {
@@ -234,7 +248,18 @@ void UMassTrafficValidationProcessor::Execute(FMassEntityManager& EntityManager,
 	}
 
 	// Vehicle validation
-	EntityQuery_Conditional.ForEachEntityChunk(ExecutionContext, [&](FMassExecutionContext& Context)
+	//
+	// Unless a full check has been requested, only check a rotating 1/N slice of vehicles per frame.
+	// The slice rotates with the frame counter so every vehicle is still validated once every N
+	// frames, at 1/N the per-frame cost. (See all VALIDATIONSLICE.)
+	const uint32 SampleInterval = static_cast<uint32>(FMath::Max(GMassTrafficValidationSampleInterval, 1));
+	const bool bFullCheck = SampleInterval <= 1 || GMassTrafficValidationFullCheckRequested;
+	GMassTrafficValidationFullCheckRequested = false;
+	const uint32 SamplePhase = static_cast<uint32>(GFrameCounter % SampleInterval);
+
+	// The per-vehicle checks only read fragment data (the optional debug fragment write is
+	// per-entity) so chunks are free to validate on worker threads. (See all VALIDATIONSLICE.)
+	EntityQuery_Conditional.ParallelForEachEntityChunk(ExecutionContext, [&](FMassExecutionContext& Context)
 		{
 			const UZoneGraphSubsystem& ZoneGraphSubsystem = Context.GetSubsystemChecked<UZoneGraphSubsystem>();
 
@@ -254,7 +279,19 @@ void UMassTrafficValidationProcessor::Execute(FMassEntityManager& EntityManager,
 			for (FMassExecutionContext::FEntityIterator EntityIt = Context.CreateEntityIterator(); EntityIt; ++EntityIt)
 			{
 				FMassEntityHandle VehicleEntity = Context.GetEntity(EntityIt);
-			
+
+				// Clear bVisLog for fields to re-enable for matching vehicles next frame. Cleared
+				// before the sample slice check so skipped vehicles don't keep a stale flag.
+				#if WITH_MASSTRAFFIC_DEBUG
+					DebugFragments[EntityIt].bVisLog = false;
+				#endif
+
+				// Skip vehicles outside this frame's sample slice. (See all VALIDATIONSLICE.)
+				if (!bFullCheck && static_cast<uint32>(VehicleEntity.Index) % SampleInterval != SamplePhase)
+				{
+					continue;
+				}
+
 				const FMassTrafficSimulationLODFragment& SimulationLODFragment = SimulationLODFragments[EntityIt];
 				const FMassActorFragment& ActorFragment = ActorFragments[EntityIt];
 				const FAgentRadiusFragment& RadiusFragment = RadiusFragments[EntityIt];
@@ -266,9 +303,6 @@ void UMassTrafficValidationProcessor::Execute(FMassEntityManager& EntityManager,
 				const FMassTrafficVehicleLaneChangeFragment& LaneChangeFragment = LaneChangeFragments[EntityIt];
 				const FMassRepresentationFragment& RepresentationFragment = VisualizationFragments[EntityIt];
 				const FMassTrafficNextVehicleFragment& NextVehicleFragment = NextVehicleFragments[EntityIt];
-				#if WITH_MASSTRAFFIC_DEBUG
-					FMassTrafficDebugFragment& DebugFragment = DebugFragments[EntityIt];
-				#endif
 
 				// Raw lane location
 				FZoneGraphLaneLocation RawLaneLocation;
@@ -372,11 +406,6 @@ void UMassTrafficValidationProcessor::Execute(FMassEntityManager& EntityManager,
 						CheckNextVehicle(VehicleEntity, NextVehicleFragment.GetNextVehicle(), EntityManager);
 					}
 				}
-
-				// Clear bVisLog for fields to re-enable for matching vehicles next frame 
-				#if WITH_MASSTRAFFIC_DEBUG
-					DebugFragment.bVisLog = false;
-				#endif
 			}
 		});
 }
@@ -8,6 +8,7 @@
 #include "MassTrafficInterpolation.h"
 #include "MassTrafficLaneChange.h"
 #include "MassTrafficMovement.h"
+#include "MassTrafficPerfStats.h"
 #include "MassExecutionContext.h"
 #include "MassClientBubbleHandler.h"
 #include "MassLODUtils.h"
@@ -25,7 +26,8 @@ namespace
 		const FAgentRadiusFragment& RadiusFragment,
 		const FMassTrafficRandomFractionFragment& RandomFractionFragment,
 		const FVector2D& StoppingDistanceRange,
-		const bool bVehicleHasNoRoom)
+		const bool bVehicleHasNoRoom,
+		FMassTrafficDeferredLaneMutations* DeferredLaneMutations)
 	{
 		if (!VehicleControlFragment.NextLane ||
 			!VehicleControlFragment.NextLane->ConstData.bIsIntersectionLane)
@@ -44,7 +46,15 @@ namespace
 			return;
 		}
 
-		VehicleControlFragment.NextLane->bIsVehicleReadyToUseLane = !bVehicleHasNoRoom; // (See all READYLANE.)
+		// (See all PARALLELCONTROL.)
+		if (DeferredLaneMutations)
+		{
+			DeferredLaneMutations->VehicleReadyToUseLane.Enqueue(TPair<FZoneGraphTrafficLaneData*, bool>(VehicleControlFragment.NextLane, !bVehicleHasNoRoom));
+		}
+		else
+		{
+			VehicleControlFragment.NextLane->bIsVehicleReadyToUseLane = !bVehicleHasNoRoom; // (See all READYLANE.)
+		}
 	}
 
 	
@@ -53,7 +63,8 @@ namespace
 		FMassTrafficVehicleControlFragment& VehicleControlFragment,
 		const FMassZoneGraphLaneLocationFragment& LaneLocationFragment,
 		const FMassTrafficNextVehicleFragment& NextVehicleFragment,
-		const FMassEntityManager& EntityManager)
+		const FMassEntityManager& EntityManager,
+		FMassTrafficDeferredLaneMutations* DeferredLaneMutations)
 	{
 		// Return if -
 		//		- This vehicle is already marked as being unable to stop at the lane exit.
@@ -84,11 +95,19 @@ namespace
 		}
 		
 		VehicleControlFragment.bCantStopAtLaneExit = true; // (See all CANTSTOPLANEEXIT.)		
-		++VehicleControlFragment.NextLane->NumReservedVehiclesOnLane;
+		// (See all PARALLELCONTROL.)
+		if (DeferredLaneMutations)
+		{
+			DeferredLaneMutations->AddReservedVehicleOnLane.Enqueue(VehicleControlFragment.NextLane);
+		}
+		else
+		{
+			++VehicleControlFragment.NextLane->NumReservedVehiclesOnLane;
+		}
 	}
 
 	// (See all CANTSTOPLANEEXIT.)
-	void UnsetVehicleCantStopAtLaneExit(FMassTrafficVehicleControlFragment& VehicleControlFragment)
+	void UnsetVehicleCantStopAtLaneExit(FMassTrafficVehicleControlFragment& VehicleControlFragment, FMassTrafficDeferredLaneMutations* DeferredLaneMutations)
 	{
 		// Return if -
 		//		- This vehicle is not marked as being unable to stop at the lane exit.
@@ -100,7 +119,15 @@ namespace
 		}
 
 		VehicleControlFragment.bCantStopAtLaneExit = false; // (See all CANTSTOPLANEEXIT.)
-		--VehicleControlFragment.NextLane->NumReservedVehiclesOnLane;
+		// (See all PARALLELCONTROL.)
+		if (DeferredLaneMutations)
+		{
+			DeferredLaneMutations->RemoveReservedVehicleOnLane.Enqueue(VehicleControlFragment.NextLane);
+		}
+		else
+		{
+			--VehicleControlFragment.NextLane->NumReservedVehiclesOnLane;
+		}
 	}
 }
 
@@ -159,9 +186,25 @@ void UMassTrafficVehicleControlProcessor::ConfigureQueries(const TSharedRef<FMas
 
 void UMassTrafficVehicleControlProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& ExecutionContext)
 {
+	UE::MassTraffic::FScopedProcessorPerfStats PerfStats(GetFName()); // (See all PERFSNAPSHOT.)
+
+	// With parallel execution enabled, chunks run on worker threads against a
+	// stable per-frame snapshot of the lane data; the lane writes they would
+	// have made are collected here and applied below, after the parallel
+	// sections complete. Below the grain size threshold the serial path is
+	// cheaper than the task spawn overhead. (See all PARALLELCONTROL.)
+	const bool bParallel = GMassTrafficParallelVehicleControl > 0 &&
+		SimpleVehicleControlEntityQuery_Conditional.GetNumMatchingEntities() +
+		PIDVehicleControlEntityQuery_Conditional.GetNumMatchingEntities() >= GMassTrafficParallelVehicleControlGrainSize;
+
+	FMassTrafficDeferredLaneMutations DeferredLaneMutations;
+	FMassTrafficDeferredLaneMutations* Deferred = bParallel ? &DeferredLaneMutations : nullptr;
+
 	// Advance simple agents
-	SimpleVehicleControlEntityQuery_Conditional.ForEachEntityChunk(ExecutionContext, [&](FMassExecutionContext& Context)
+	const auto SimpleVehicleControlFunction = [&](FMassExecutionContext& Context)
 		{
+			PerfStats.AddChunk(Context.GetNumEntities());
+
 			UMassTrafficSubsystem& MassTrafficSubsystem = Context.GetMutableSubsystemChecked<UMassTrafficSubsystem>();
 			const TConstArrayView<FMassSimulationVariableTickFragment> VariableTickFragments = Context.GetFragmentView<FMassSimulationVariableTickFragment>();
 			const TConstArrayView<FMassTrafficRandomFractionFragment> RandomFractionFragments = Context.GetFragmentView<FMassTrafficRandomFractionFragment>();
@@ -208,13 +251,24 @@ void UMassTrafficVehicleControlProcessor::Execute(FMassEntityManager& EntityMana
 					LaneLocationFragment,
 					LaneOffsetFragment,
 					AvoidanceFragment,
-					LaneChangeFragment, NextVehicleFragment, bVisLog);
+					LaneChangeFragment, NextVehicleFragment, Deferred, bVisLog);
 				}
-		});
+		};
+
+	if (bParallel)
+	{
+		SimpleVehicleControlEntityQuery_Conditional.ParallelForEachEntityChunk(ExecutionContext, SimpleVehicleControlFunction);
+	}
+	else
+	{
+		SimpleVehicleControlEntityQuery_Conditional.ForEachEntityChunk(ExecutionContext, SimpleVehicleControlFunction);
+	}
 
 	// Prepare physics inputs for PID vehicles
-	PIDVehicleControlEntityQuery_Conditional.ForEachEntityChunk(ExecutionContext, [&](FMassExecutionContext& Context)
+	const auto PIDVehicleControlFunction = [&](FMassExecutionContext& Context)
 		{
+			PerfStats.AddChunk(Context.GetNumEntities());
+
 			const UZoneGraphSubsystem& ZoneGraphSubsystem = Context.GetSubsystemChecked<UZoneGraphSubsystem>();
 
 			const TConstArrayView<FMassSimulationVariableTickFragment> VariableTickFragments = Context.GetFragmentView<FMassSimulationVariableTickFragment>();
@@ -231,6 +285,35 @@ void UMassTrafficVehicleControlProcessor::Execute(FMassEntityManager& EntityMana
 			const TArrayView<FMassTrafficVehicleLaneChangeFragment> LaneChangeFragments = Context.GetMutableFragmentView<FMassTrafficVehicleLaneChangeFragment>();
 			const TConstArrayView<FMassTrafficNextVehicleFragment> NextVehicleFragments = Context.GetFragmentView<FMassTrafficNextVehicleFragment>();
 
+			// Chunk-local SoA scratch for the batched PID step. (See all PIDBATCH.)
+			const int32 NumEntities = Context.GetNumEntities();
+			TArray<float> PIDDeltaTimes;
+			TArray<float> ThrottlePIDGoals;
+			TArray<float> ThrottlePIDActuals;
+			TArray<float> ThrottlePIDErrorIntegrals;
+			TArray<float> ThrottlePIDLastErrors;
+			TArray<float> ThrottlePIDValues;
+			TArray<float> SteeringPIDGoals;
+			TArray<float> SteeringPIDActuals;
+			TArray<float> SteeringPIDErrorIntegrals;
+			TArray<float> SteeringPIDLastErrors;
+			TArray<float> SteeringPIDValues;
+			TArray<FVector> SpeedControlChaseTargetLocations;
+			TArray<FVector> SteeringControlChaseTargetLocations;
+			PIDDeltaTimes.SetNumUninitialized(NumEntities);
+			ThrottlePIDGoals.SetNumUninitialized(NumEntities);
+			ThrottlePIDActuals.SetNumUninitialized(NumEntities);
+			ThrottlePIDErrorIntegrals.SetNumUninitialized(NumEntities);
+			ThrottlePIDLastErrors.SetNumUninitialized(NumEntities);
+			ThrottlePIDValues.SetNumUninitialized(NumEntities);
+			SteeringPIDGoals.SetNumZeroed(NumEntities);
+			SteeringPIDActuals.SetNumUninitialized(NumEntities);
+			SteeringPIDErrorIntegrals.SetNumUninitialized(NumEntities);
+			SteeringPIDLastErrors.SetNumUninitialized(NumEntities);
+			SteeringPIDValues.SetNumUninitialized(NumEntities);
+			SpeedControlChaseTargetLocations.SetNumUninitialized(NumEntities);
+			SteeringControlChaseTargetLocations.SetNumUninitialized(NumEntities);
+
 			for (FMassExecutionContext::FEntityIterator EntityIt = Context.CreateEntityIterator(); EntityIt; ++EntityIt)
 			{
 				const FMassSimulationVariableTickFragment& VariableTickFragment = VariableTickFragments[EntityIt];
@@ -251,6 +334,8 @@ void UMassTrafficVehicleControlProcessor::Execute(FMassEntityManager& EntityMana
 				// Debug
 				const bool bVisLog = DebugFragments.IsEmpty() ? false : DebugFragments[EntityIt].bVisLog > 0;
 
+				FMassTrafficPIDVehicleControlFragment& PIDVehicleControlFragment = PIDVehicleControlFragments[EntityIt];
+
 				PIDVehicleControl(
 					EntityManager,
 					Context,
@@ -265,11 +350,121 @@ void UMassTrafficVehicleControlProcessor::Execute(FMassEntityManager& EntityMana
 					VehicleControlFragment,
 					VehicleLightsFragment,
 					LaneLocationFragment,
-					PIDVehicleControlFragments[EntityIt],
+					PIDVehicleControlFragment,
 					VehiclePIDMovementInterpolationFragment,
-					NextVehicleFragment, bVisLog);
+					NextVehicleFragment, Deferred,
+					ThrottlePIDGoals[EntityIt],
+					SteeringPIDActuals[EntityIt],
+					SpeedControlChaseTargetLocations[EntityIt],
+					SteeringControlChaseTargetLocations[EntityIt],
+					bVisLog);
+
+				// Gather PID state & inputs into the SoA scratch. (See all PIDBATCH.)
+				PIDDeltaTimes[EntityIt] = VariableTickFragment.DeltaTime;
+				ThrottlePIDActuals[EntityIt] = VehicleControlFragment.Speed;
+				PIDVehicleControlFragment.ThrottleAndBrakeController.ExportState(ThrottlePIDErrorIntegrals[EntityIt], ThrottlePIDLastErrors[EntityIt]);
+				PIDVehicleControlFragment.SteeringController.ExportState(SteeringPIDErrorIntegrals[EntityIt], SteeringPIDLastErrors[EntityIt]);
 				}
-		});
+
+			// Step all throttle & steering PID controllers in the chunk at once. (See all PIDBATCH.)
+			{
+				TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("PIDStepBatch"))
+
+				FMassTrafficPIDController::StepBatch(ThrottlePIDGoals, ThrottlePIDActuals, PIDDeltaTimes, MassTrafficSettings->SpeedPIDControllerParams, ThrottlePIDErrorIntegrals, ThrottlePIDLastErrors, ThrottlePIDValues);
+				FMassTrafficPIDController::StepBatch(SteeringPIDGoals, SteeringPIDActuals, PIDDeltaTimes, MassTrafficSettings->SteeringPIDControllerParams, SteeringPIDErrorIntegrals, SteeringPIDLastErrors, SteeringPIDValues);
+			}
+
+			// Scatter the stepped state back & apply the outputs. (See all PIDBATCH.)
+			for (FMassExecutionContext::FEntityIterator EntityIt = Context.CreateEntityIterator(); EntityIt; ++EntityIt)
+			{
+				FMassTrafficPIDVehicleControlFragment& PIDVehicleControlFragment = PIDVehicleControlFragments[EntityIt];
+				PIDVehicleControlFragment.ThrottleAndBrakeController.ImportState(ThrottlePIDErrorIntegrals[EntityIt], ThrottlePIDLastErrors[EntityIt]);
+				PIDVehicleControlFragment.SteeringController.ImportState(SteeringPIDErrorIntegrals[EntityIt], SteeringPIDLastErrors[EntityIt]);
+
+				const bool bVisLog = DebugFragments.IsEmpty() ? false : DebugFragments[EntityIt].bVisLog > 0;
+
+				ApplyPIDVehicleControl(
+					Context,
+					EntityIt,
+					RandomFractionFragments[EntityIt],
+					VariableTickFragments[EntityIt],
+					ThrottlePIDGoals[EntityIt],
+					ThrottlePIDValues[EntityIt],
+					SteeringPIDValues[EntityIt],
+					SpeedControlChaseTargetLocations[EntityIt],
+					SteeringControlChaseTargetLocations[EntityIt],
+					VehicleControlFragments[EntityIt],
+					VehicleLightsFragments[EntityIt],
+					LaneLocationFragments[EntityIt],
+					PIDVehicleControlFragment,
+					bVisLog);
+			}
+		};
+
+	if (bParallel)
+	{
+		PIDVehicleControlEntityQuery_Conditional.ParallelForEachEntityChunk(ExecutionContext, PIDVehicleControlFunction);
+	}
+	else
+	{
+		PIDVehicleControlEntityQuery_Conditional.ForEachEntityChunk(ExecutionContext, PIDVehicleControlFunction);
+	}
+
+	if (bParallel)
+	{
+		// Apply the lane writes collected on worker threads. Order within each
+		// queue is arbitrary, matching the entity-order nondeterminism of the
+		// serial path. (See all PARALLELCONTROL.)
+		TPair<FZoneGraphTrafficLaneData*, bool> ReadyLane;
+		while (DeferredLaneMutations.VehicleReadyToUseLane.Dequeue(ReadyLane))
+		{
+			ReadyLane.Key->bIsVehicleReadyToUseLane = ReadyLane.Value; // (See all READYLANE.)
+		}
+
+		FZoneGraphTrafficLaneData* TrafficLaneData = nullptr;
+		while (DeferredLaneMutations.StoppedVehicleOverlappingLane.Dequeue(TrafficLaneData))
+		{
+			TrafficLaneData->bIsStoppedVehicleInPreviousLaneOverlappingThisLane = true; // (See all CROSSWALKOVERLAP.)
+		}
+		while (DeferredLaneMutations.AddReservedVehicleOnLane.Dequeue(TrafficLaneData))
+		{
+			++TrafficLaneData->NumReservedVehiclesOnLane; // (See all CANTSTOPLANEEXIT.)
+		}
+		while (DeferredLaneMutations.RemoveReservedVehicleOnLane.Dequeue(TrafficLaneData))
+		{
+			--TrafficLaneData->NumReservedVehiclesOnLane; // (See all CANTSTOPLANEEXIT.)
+		}
+
+		// Lane progression rewrites shared lane occupancy and tail vehicle
+		// links, so vehicles that ran off their lane end advance serially here.
+		UMassTrafficSubsystem* MassTrafficSubsystem = UWorld::GetSubsystem<UMassTrafficSubsystem>(GetWorld());
+		check(MassTrafficSubsystem);
+
+		FMassEntityHandle VehicleEntity;
+		while (DeferredLaneMutations.VehiclesToMoveToNextLane.Dequeue(VehicleEntity))
+		{
+			const FMassEntityView VehicleView(EntityManager, VehicleEntity);
+			FMassTrafficVehicleControlFragment& VehicleControlFragment = VehicleView.GetFragmentData<FMassTrafficVehicleControlFragment>();
+			if (!VehicleControlFragment.NextLane)
+			{
+				continue;
+			}
+
+			bool bIsVehicleStuck = false; // (See all RECYCLESTUCK.)
+			UE::MassTraffic::MoveVehicleToNextLane(
+				EntityManager,
+				*MassTrafficSubsystem,
+				VehicleEntity,
+				VehicleView.GetFragmentData<FAgentRadiusFragment>(),
+				VehicleView.GetFragmentData<FMassTrafficRandomFractionFragment>(),
+				VehicleControlFragment,
+				VehicleView.GetFragmentData<FMassTrafficVehicleLightsFragment>(),
+				VehicleView.GetFragmentData<FMassZoneGraphLaneLocationFragment>(),
+				VehicleView.GetFragmentData<FMassTrafficNextVehicleFragment>(),
+				VehicleView.GetFragmentDataPtr<FMassTrafficVehicleLaneChangeFragment>(),
+				bIsVehicleStuck/*out*/);
+		}
+	}
 }
 
 void UMassTrafficVehicleControlProcessor::SimpleVehicleControl(
@@ -287,11 +482,19 @@ void UMassTrafficVehicleControlProcessor::SimpleVehicleControl(
 	FMassTrafficLaneOffsetFragment& LaneOffsetFragment,
 	FMassTrafficObstacleAvoidanceFragment& AvoidanceFragment,
 	FMassTrafficVehicleLaneChangeFragment* LaneChangeFragment,
-	const FMassTrafficNextVehicleFragment& NextVehicleFragment, const bool bVisLog
+	const FMassTrafficNextVehicleFragment& NextVehicleFragment,
+	FMassTrafficDeferredLaneMutations* DeferredLaneMutations, const bool bVisLog
 ) const
 {
+	const bool bIsOffLOD = (UE::MassLOD::GetLODFromArchetype(Context) == EMassLOD::Off);
+	const bool bIsLowLOD = (UE::MassLOD::GetLODFromArchetype(Context) == EMassLOD::Low);
+
+	// Off-LOD vehicles are too far away for lateral drift or Perlin speed variance to be seen, so skip the
+	// noise evaluation and just drive them timetable-style at their randomly varied speed limit.
+	const bool bCheapOffLODControl = bIsOffLOD && GMassTrafficOffLODCheapVehicleControl;
+
 	// Compute stable distance based noise
-	const float NoiseValue = UE::MassTraffic::CalculateNoiseValue(VehicleControlFragment.NoiseInput, MassTrafficSettings->NoisePeriod);
+	const float NoiseValue = bCheapOffLODControl ? 0.0f : UE::MassTraffic::CalculateNoiseValue(VehicleControlFragment.NoiseInput, MassTrafficSettings->NoisePeriod);
 
 	// Noise based lateral offset
 	LaneOffsetFragment.LateralOffset = NoiseValue * MassTrafficSettings->LateralOffsetMax;
@@ -304,9 +507,6 @@ void UMassTrafficVehicleControlProcessor::SimpleVehicleControl(
 	);
 	const float VariedSpeedLimit = UE::MassTraffic::VarySpeedLimit(SpeedLimit, MassTrafficSettings->SpeedLimitVariancePct, MassTrafficSettings->SpeedVariancePct, RandomFractionFragment.RandomFraction, NoiseValue);
 
-	const bool bIsOffLOD = (UE::MassLOD::GetLODFromArchetype(Context) == EMassLOD::Off);
-	const bool bIsLowLOD = (UE::MassLOD::GetLODFromArchetype(Context) == EMassLOD::Low);
-	
 	// Should stop?
 	bool bRequestDifferentNextLane = false;
 	bool bVehicleCantStopAtLaneExit = VehicleControlFragment.bCantStopAtLaneExit; // (See all CANTSTOPLANEEXIT.)
@@ -345,7 +545,7 @@ void UMassTrafficVehicleControlProcessor::SimpleVehicleControl(
 	if (!bIsOffLOD /*EDGE CASE-ish - don't do this in off-LOD*/ && bVehicleCantStopAtLaneExit) 
 	{
 		// Vehicle can't stop before hitting the red light.
-		SetVehicleCantStopAtLaneExit(VehicleControlFragment, LaneLocationFragment, NextVehicleFragment, EntityManager);
+		SetVehicleCantStopAtLaneExit(VehicleControlFragment, LaneLocationFragment, NextVehicleFragment, EntityManager, DeferredLaneMutations);
 	}
 
 	// EDGE CASE. Happens when a vehicle has decided it can't stop at same point in the recent past, but then soon
@@ -353,7 +553,7 @@ void UMassTrafficVehicleControlProcessor::SimpleVehicleControl(
 	// (See all CANTSTOPLANEEXIT.)
 	if (bMustStopAtLaneExit && VehicleControlFragment.bCantStopAtLaneExit) 
 	{
-		UnsetVehicleCantStopAtLaneExit(VehicleControlFragment);
+		UnsetVehicleCantStopAtLaneExit(VehicleControlFragment, DeferredLaneMutations);
 		bVehicleCantStopAtLaneExit = false;
 	}
 	
@@ -363,7 +563,7 @@ void UMassTrafficVehicleControlProcessor::SimpleVehicleControl(
 	// (See all CANTSTOPLANEEXIT.)
 	if (bIsOffLOD && VehicleControlFragment.bCantStopAtLaneExit) 
 	{
-		UnsetVehicleCantStopAtLaneExit(VehicleControlFragment);
+		UnsetVehicleCantStopAtLaneExit(VehicleControlFragment, DeferredLaneMutations);
 		bVehicleCantStopAtLaneExit = false;
 	}
 
@@ -372,7 +572,7 @@ void UMassTrafficVehicleControlProcessor::SimpleVehicleControl(
 	// (See all CANTSTOPLANEEXIT.)
 	if (VehicleControlFragment.Speed < 0.1f && !bIsFrontOfVehicleBeyondEndOfLane && VehicleControlFragment.bCantStopAtLaneExit)
 	{
-		UnsetVehicleCantStopAtLaneExit(VehicleControlFragment);
+		UnsetVehicleCantStopAtLaneExit(VehicleControlFragment, DeferredLaneMutations);
 		bVehicleCantStopAtLaneExit = false;		
 	}
 
@@ -407,7 +607,7 @@ void UMassTrafficVehicleControlProcessor::SimpleVehicleControl(
 
 
 	// (See all READYLANE.)
-	SetIsVehicleReadyToUseNextIntersectionLane(VehicleControlFragment, LaneLocationFragment, AgentRadiusFragment, RandomFractionFragment, MassTrafficSettings->StoppingDistanceRange, bVehicleHasNoRoom);
+	SetIsVehicleReadyToUseNextIntersectionLane(VehicleControlFragment, LaneLocationFragment, AgentRadiusFragment, RandomFractionFragment, MassTrafficSettings->StoppingDistanceRange, bVehicleHasNoRoom, DeferredLaneMutations);
 
 	
 	// @todo Reduce speed on corners 
@@ -494,7 +694,15 @@ void UMassTrafficVehicleControlProcessor::SimpleVehicleControl(
 			// (See all CROSSWALKOVERLAP.)
 			if (VehicleControlFragment.NextLane)
 			{
-				VehicleControlFragment.NextLane->bIsStoppedVehicleInPreviousLaneOverlappingThisLane = true;			
+				// (See all PARALLELCONTROL.)
+				if (DeferredLaneMutations)
+				{
+					DeferredLaneMutations->StoppedVehicleOverlappingLane.Enqueue(VehicleControlFragment.NextLane);
+				}
+				else
+				{
+					VehicleControlFragment.NextLane->bIsStoppedVehicleInPreviousLaneOverlappingThisLane = true;			
+				}
 			}
 
 			// Whilst the above code will try to clamp us to the ideal MaxDistanceAlongLaneIfStopped, it may be that
@@ -514,19 +722,29 @@ void UMassTrafficVehicleControlProcessor::SimpleVehicleControl(
 		{
 			const FMassEntityHandle VehicleEntity = Context.GetEntity(EntityIndex); 
 			bool bIsVehicleStuck = false; // (See all RECYCLESTUCK.)
-			
-			UE::MassTraffic::MoveVehicleToNextLane(
-				EntityManager,
-				MassTrafficSubsystem,
-				VehicleEntity,
-				AgentRadiusFragment,
-				RandomFractionFragment,
-				VehicleControlFragment,
-				VehicleLightsFragment,
-				LaneLocationFragment,
-				Context.GetMutableFragmentView<FMassTrafficNextVehicleFragment>()[EntityIndex],
-				LaneChangeFragment,
-				bIsVehicleStuck/*out*/);
+
+			// (See all PARALLELCONTROL.) Lane progression rewrites shared lane
+			// state, so on worker threads it's queued and run after the
+			// parallel section instead.
+			if (DeferredLaneMutations)
+			{
+				DeferredLaneMutations->VehiclesToMoveToNextLane.Enqueue(VehicleEntity);
+			}
+			else
+			{
+				UE::MassTraffic::MoveVehicleToNextLane(
+					EntityManager,
+					MassTrafficSubsystem,
+					VehicleEntity,
+					AgentRadiusFragment,
+					RandomFractionFragment,
+					VehicleControlFragment,
+					VehicleLightsFragment,
+					LaneLocationFragment,
+					Context.GetMutableFragmentView<FMassTrafficNextVehicleFragment>()[EntityIndex],
+					LaneChangeFragment,
+					bIsVehicleStuck/*out*/);
+			}
 		}
 		// No next lane yet, at least clamp to current lane length
 		else
@@ -535,16 +753,18 @@ void UMassTrafficVehicleControlProcessor::SimpleVehicleControl(
 		}
 	}
 	
-	// Debug speed
-	UE::MassTraffic::DrawDebugSpeed(
-		GetWorld(),
-		Context.GetFragmentView<FTransformFragment>()[EntityIndex].GetTransform().GetLocation(),
-		VehicleControlFragment.Speed,
-		VehicleLightsFragment.bBrakeLights,
-		LaneLocationFragment.DistanceAlongLane,
-		LaneLocationFragment.LaneLength,
-		UE::MassLOD::GetLODFromArchetype(Context),
-		bVisLog, LogOwner);
+	// Debug speed. Wrapped so the argument evaluation (fragment view fetch, LOD lookup) compiles
+	// out of stripped builds along with the draw itself.
+	IF_MASSTRAFFIC_ENABLE_DEBUG(
+		UE::MassTraffic::DrawDebugSpeed(
+			GetWorld(),
+			Context.GetFragmentView<FTransformFragment>()[EntityIndex].GetTransform().GetLocation(),
+			VehicleControlFragment.Speed,
+			VehicleLightsFragment.bBrakeLights,
+			LaneLocationFragment.DistanceAlongLane,
+			LaneLocationFragment.LaneLength,
+			UE::MassLOD::GetLODFromArchetype(Context),
+			bVisLog, LogOwner) );
 }
 
 void UMassTrafficVehicleControlProcessor::PIDVehicleControl(
@@ -564,6 +784,11 @@ void UMassTrafficVehicleControlProcessor::PIDVehicleControl(
 	FMassTrafficPIDVehicleControlFragment& PIDVehicleControlFragment,
 	FMassTrafficPIDControlInterpolationFragment& VehiclePIDMovementInterpolationFragment,
 	const FMassTrafficNextVehicleFragment& NextVehicleFragment,
+	FMassTrafficDeferredLaneMutations* DeferredLaneMutations,
+	float& OutThrottlePIDGoal,
+	float& OutSteeringPIDActual,
+	FVector& OutSpeedControlChaseTargetLocation,
+	FVector& OutSteeringControlChaseTargetLocation,
 	const bool bVisLog
 ) const
 {
@@ -665,7 +890,7 @@ void UMassTrafficVehicleControlProcessor::PIDVehicleControl(
 	if (bVehicleCantStopAtLaneExit) // (See all CANTSTOPLANEEXIT.)
 	{
 		// Vehicle can't stop before hitting the red light.
-		SetVehicleCantStopAtLaneExit(VehicleControlFragment, LaneLocationFragment, NextVehicleFragment, EntityManager);
+		SetVehicleCantStopAtLaneExit(VehicleControlFragment, LaneLocationFragment, NextVehicleFragment, EntityManager, DeferredLaneMutations);
 	}
 
 	// EDGE CASE. Happens when a vehicle has decided it can't stop at same point in the recent past, but then soon
@@ -673,7 +898,7 @@ void UMassTrafficVehicleControlProcessor::PIDVehicleControl(
 	// (See all CANTSTOPLANEEXIT.)
 	if (bMustStopAtLaneExit && VehicleControlFragment.bCantStopAtLaneExit)
 	{
-		UnsetVehicleCantStopAtLaneExit(VehicleControlFragment);
+		UnsetVehicleCantStopAtLaneExit(VehicleControlFragment, DeferredLaneMutations);
 		bVehicleCantStopAtLaneExit = false;
 	}
 	
@@ -682,7 +907,7 @@ void UMassTrafficVehicleControlProcessor::PIDVehicleControl(
 	// (See all CANTSTOPLANEEXIT.)
 	if (VehicleControlFragment.Speed < 0.1f && !bIsFrontOfVehicleBeyondEndOfLane && VehicleControlFragment.bCantStopAtLaneExit)
 	{
-		UnsetVehicleCantStopAtLaneExit(VehicleControlFragment);
+		UnsetVehicleCantStopAtLaneExit(VehicleControlFragment, DeferredLaneMutations);
 		bVehicleCantStopAtLaneExit = false;
 	}
 
@@ -691,7 +916,15 @@ void UMassTrafficVehicleControlProcessor::PIDVehicleControl(
 	if ((bMustStopAtLaneExit && bIsFrontOfVehicleBeyondEndOfLane) &&
 		VehicleControlFragment.NextLane)
 	{
-		VehicleControlFragment.NextLane->bIsStoppedVehicleInPreviousLaneOverlappingThisLane = true;
+		// (See all PARALLELCONTROL.)
+		if (DeferredLaneMutations)
+		{
+			DeferredLaneMutations->StoppedVehicleOverlappingLane.Enqueue(VehicleControlFragment.NextLane);
+		}
+		else
+		{
+			VehicleControlFragment.NextLane->bIsStoppedVehicleInPreviousLaneOverlappingThisLane = true;
+		}
 	}
 
 	// Calculate target speed
@@ -723,20 +956,46 @@ void UMassTrafficVehicleControlProcessor::PIDVehicleControl(
 	);
 
 	// (See all READYLANE.)
-	SetIsVehicleReadyToUseNextIntersectionLane(VehicleControlFragment, LaneLocationFragment, AgentRadiusFragment, RandomFractionFragment, MassTrafficSettings->StoppingDistanceRange, bVehicleHasNoRoom);
+	SetIsVehicleReadyToUseNextIntersectionLane(VehicleControlFragment, LaneLocationFragment, AgentRadiusFragment, RandomFractionFragment, MassTrafficSettings->StoppingDistanceRange, bVehicleHasNoRoom, DeferredLaneMutations);
 
 	// Reduce speed while cornering
 	const float TurnAngle = TransformFragment.GetTransform().InverseTransformVectorNoScale(SpeedControlChaseTargetOrientation.GetForwardVector()).HeadingAngle();
 	const float TurnSpeedFactor = FMath::GetMappedRangeValueClamped<>(TRange<float>(0.0f, HALF_PI), TRange<float>(1.0f, MassTrafficSettings->TurnSpeedScale), FMath::Abs(TurnAngle));
 	TargetSpeed *= TurnSpeedFactor; 
 
-	// Tick the throttle and brake control PID. Feed throttle & brake PID controller with current speed delta. If returned 
-	// value is positive, it's applied as throttle - negative values are applied as brake.
-	float ThrottleOrBrake = PIDVehicleControlFragment.ThrottleAndBrakeController.Tick(TargetSpeed,
-		VehicleControlFragment.Speed,
-		VariableTickFragment.DeltaTime,
-		MassTrafficSettings->SpeedPIDControllerParams);
-	ThrottleOrBrake = FMath::Clamp(ThrottleOrBrake, -1.0f, 1.0f);
+	// Feed steering PID controller with current angle delta
+	const FVector ToSteeringControlChaseTargetLocal = TransformFragment.GetTransform().InverseTransformPositionNoScale(SteeringControlChaseTargetLocation);
+	const float NormalizedDeltaAngle = ToSteeringControlChaseTargetLocal.HeadingAngle() / PIDVehicleControlFragment.MaxSteeringAngle;
+
+	// The throttle & steering PID controllers are stepped for the whole chunk in one vectorized
+	// batch by the caller, which then applies the outputs via ApplyPIDVehicleControl.
+	// (See all PIDBATCH.)
+	OutThrottlePIDGoal = TargetSpeed;
+	OutSteeringPIDActual = -NormalizedDeltaAngle;
+	OutSpeedControlChaseTargetLocation = SpeedControlChaseTargetLocation;
+	OutSteeringControlChaseTargetLocation = SteeringControlChaseTargetLocation;
+}
+
+void UMassTrafficVehicleControlProcessor::ApplyPIDVehicleControl(
+	const FMassExecutionContext& Context,
+	const int32 EntityIndex,
+	const FMassTrafficRandomFractionFragment& RandomFractionFragment,
+	const FMassSimulationVariableTickFragment& VariableTickFragment,
+	const float TargetSpeed,
+	const float ThrottleAndBrakePIDValue,
+	const float SteeringPIDValue,
+	const FVector& SpeedControlChaseTargetLocation,
+	const FVector& SteeringControlChaseTargetLocation,
+	FMassTrafficVehicleControlFragment& VehicleControlFragment,
+	FMassTrafficVehicleLightsFragment& VehicleLightsFragment,
+	const FMassZoneGraphLaneLocationFragment& LaneLocationFragment,
+	FMassTrafficPIDVehicleControlFragment& PIDVehicleControlFragment,
+	const bool bVisLog
+) const
+{
+	// If the throttle & brake PID value is positive, it's applied as throttle - negative values are
+	// applied as brake.
+	const float ThrottleOrBrake = FMath::Clamp(ThrottleAndBrakePIDValue, -1.0f, 1.0f);
 
 	// Handbrake shouldn't be on unless we are a parked vehicle.
 	PIDVehicleControlFragment.bHandbrake = false;
@@ -797,10 +1056,8 @@ void UMassTrafficVehicleControlProcessor::PIDVehicleControl(
 		VehicleControlFragment.BrakeLightHysteresis = 0.0f;
 	}
 
-	// Feed steering PID controller with current angle delta 
-	const FVector ToSteeringControlChaseTargetLocal = TransformFragment.GetTransform().InverseTransformPositionNoScale(SteeringControlChaseTargetLocation);
-	const float NormalizedDeltaAngle = ToSteeringControlChaseTargetLocal.HeadingAngle() / PIDVehicleControlFragment.MaxSteeringAngle;
-	PIDVehicleControlFragment.Steering = FMath::Clamp(PIDVehicleControlFragment.SteeringController.Tick(0.0f, -NormalizedDeltaAngle, VariableTickFragment.DeltaTime, MassTrafficSettings->SteeringPIDControllerParams), -1.0f, 1.0f);
+	// Apply the batch-stepped steering PID value. (See all PIDBATCH.)
+	PIDVehicleControlFragment.Steering = FMath::Clamp(SteeringPIDValue, -1.0f, 1.0f);
 
 	// Debug speed
 	#if WITH_MASSTRAFFIC_DEBUG
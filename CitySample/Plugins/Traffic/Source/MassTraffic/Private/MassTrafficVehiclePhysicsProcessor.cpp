@@ -8,6 +8,7 @@
 #include "MassTrafficInterpolation.h"
 #include "MassTrafficLaneChange.h"
 #include "MassTrafficParkedVehicleVisualizationProcessor.h"
+#include "MassTrafficPerfStats.h"
 #include "MassTrafficTrailerSimulationTrait.h"
 #include "MassTrafficVehicleControlProcessor.h"
 #include "MassExecutionContext.h"
@@ -94,6 +95,8 @@ void UMassTrafficVehiclePhysicsProcessor::Execute(FMassEntityManager& EntityMana
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("SimplePhysicsVehicle"))
 
+	UE::MassTraffic::FScopedProcessorPerfStats PerfStats(GetFName()); // (See all PERFSNAPSHOT.)
+
 	// Get Chaos solver settings
 	const int32 NumChaosConstraintSolverIterations = UPhysicsSettingsCore::Get()->SolverOptions.PositionIterations;
 	const float MinDeltaTime = UPhysicsSettings::Get()->MinPhysicsDeltaTime;
@@ -114,6 +117,8 @@ void UMassTrafficVehiclePhysicsProcessor::Execute(FMassEntityManager& EntityMana
 		
 		SimplePhysicsVehiclesQuery.ForEachEntityChunk(Context, [&](FMassExecutionContext& QueryContext)
 		{
+			PerfStats.AddChunk(QueryContext.GetNumEntities());
+
 			const UZoneGraphSubsystem& ZoneGraphSubsystem = QueryContext.GetSubsystemChecked<UZoneGraphSubsystem>();
 
 			const TConstArrayView<FMassTrafficPIDVehicleControlFragment> PIDVehicleControlFragments = QueryContext.GetFragmentView<FMassTrafficPIDVehicleControlFragment>();
@@ -168,6 +173,32 @@ void UMassTrafficVehiclePhysicsProcessor::Execute(FMassEntityManager& EntityMana
 				RawLaneLocationTransform.AddToTranslation(RawLaneLocationTransform.GetRotation().GetRightVector() * LaneOffsetFragment.LateralOffset);
 				UE::MassTraffic::AdjustVehicleTransformDuringLaneChange(LaneChangeFragment, LaneLocationFragment.DistanceAlongLane, RawLaneLocationTransform, nullptr/*TrafficCoordinator->GetWorld()*/);
 
+				// Cruise sleep converged steady-state vehicles, replaying their cached kinematic
+				// solution along the lane instead of integrating suspension & wheels.
+				// (See all CRUISESLEEP.)
+				const bool bHasTrailerConstraint = !TrailerConstraintFragments.IsEmpty() && TrailerConstraintFragments[EntityIt].Trailer.IsSet();
+				const bool bIsCruiseSleeping = ProcessCruiseSleeping(
+					DeltaTime,
+					*ZoneGraphStorage,
+					VehicleControlFragment,
+					PIDVehicleControlFragment,
+					LaneChangeFragment,
+					bHasTrailerConstraint,
+					SimplePhysicsVehicleFragment,
+					LaneLocationFragment,
+					LaneOffsetFragment,
+					InterpolationFragment,
+					RawLaneLocationTransform,
+					TransformFragment,
+					VelocityFragment,
+					AngularVelocityFragment,
+					VehicleWorldTransform,
+					bVisLog);
+				if (bIsCruiseSleeping)
+				{
+					continue;
+				}
+
 				// Perform suspension traces
 				TArray<FHitResult, TFixedAllocator<FMassTrafficSimpleVehiclePhysicsSim::MaxWheels>> SuspensionTraceHitResults;
 				TArray<FVector, TFixedAllocator<FMassTrafficSimpleVehiclePhysicsSim::MaxWheels>> SuspensionTargets;
@@ -401,10 +432,113 @@ bool UMassTrafficVehiclePhysicsProcessor::ProcessSleeping(
 #if WITH_MASSTRAFFIC_DEBUG
 	UE::MassTraffic::DrawDebugSleepState(GetWorld(), VehicleWorldTransform.GetLocation(), bIsSleeping, bVisLog, LogOwner);
 #endif
-	
+
 	return bIsSleeping;
 }
 
+bool UMassTrafficVehiclePhysicsProcessor::ProcessCruiseSleeping(
+	const float DeltaTime,
+	const FZoneGraphStorage& ZoneGraphStorage,
+	FMassTrafficVehicleControlFragment& VehicleControlFragment,
+	const FMassTrafficPIDVehicleControlFragment& PIDVehicleControlFragment,
+	const FMassTrafficVehicleLaneChangeFragment& LaneChangeFragment,
+	const bool bHasTrailerConstraint,
+	FMassTrafficVehiclePhysicsFragment& SimplePhysicsVehicleFragment,
+	const FMassZoneGraphLaneLocationFragment& LaneLocationFragment,
+	const FMassTrafficLaneOffsetFragment& LaneOffsetFragment,
+	FMassTrafficInterpolationFragment& InterpolationFragment,
+	const FTransform& RawLaneLocationTransform,
+	FTransformFragment& TransformFragment,
+	FMassVelocityFragment& VelocityFragment,
+	FMassTrafficAngularVelocityFragment& AngularVelocityFragment,
+	const FTransform& VehicleWorldTransform,
+	bool bVisLog
+)
+{
+	// Cruise sleep disabled?
+	if (!GMassTrafficCruiseSleepEnabled)
+	{
+		SimplePhysicsVehicleFragment.VehicleSim.WakeFromCruiseSleep();
+		return false;
+	}
+
+	// Wake events - an upcoming lane transition (flagged by the choose next lane processor), a lane
+	// change in progress or a trailer constraint that needs live suspension to solve against.
+	const bool bWakeEventRaised = VehicleControlFragment.bWakePhysicsFromCruiseSleep;
+	VehicleControlFragment.bWakePhysicsFromCruiseSleep = false;
+	if (bWakeEventRaised || bHasTrailerConstraint || LaneChangeFragment.IsLaneChangeInProgress())
+	{
+		SimplePhysicsVehicleFragment.VehicleSim.WakeFromCruiseSleep();
+		return false;
+	}
+
+	// Control inputs stable? Brake, steering or handbrake input means the control processor is
+	// reacting to something (an obstacle closing in, a light about to change) and the throttle
+	// should only be drifting slightly to hold the cruise speed.
+	const bool bControlInputsStable =
+		!PIDVehicleControlFragment.bHandbrake &&
+		PIDVehicleControlFragment.Brake < GMassTrafficControlInputWakeTolerance &&
+		FMath::Abs(PIDVehicleControlFragment.Steering) < GMassTrafficControlInputWakeTolerance &&
+		FMath::Abs(PIDVehicleControlFragment.Throttle - SimplePhysicsVehicleFragment.VehicleSim.CruiseThrottle) < GMassTrafficControlInputWakeTolerance;
+
+	// Chassis converged? Speed steady and the chassis settled to a stable lane-space transform,
+	// implying a straight enough lane & flat enough ground to hold the cached solution.
+	const FTransform LaneSpaceTransform = TransformFragment.GetTransform().GetRelativeTransform(RawLaneLocationTransform);
+	const bool bChassisConverged =
+		FMath::Abs(VehicleControlFragment.Speed - SimplePhysicsVehicleFragment.VehicleSim.CruiseSpeed) < GMassTrafficCruiseSleepSpeedTolerance &&
+		FVector::Distance(LaneSpaceTransform.GetLocation(), SimplePhysicsVehicleFragment.VehicleSim.CruiseLaneSpaceTransform.GetLocation()) < GMassTrafficCruiseSleepChassisTolerance &&
+		LaneSpaceTransform.GetRotation().AngularDistance(SimplePhysicsVehicleFragment.VehicleSim.CruiseLaneSpaceTransform.GetRotation()) < 0.01f/*~0.6deg*/;
+
+	bool bIsCruiseSleeping = false;
+	if (bControlInputsStable && bChassisConverged && VehicleControlFragment.Speed > GMassTrafficLinearSpeedSleepThreshold)
+	{
+		// Add to cruise sleep counter and see if we're now actually cruise sleeping
+		bIsCruiseSleeping = SimplePhysicsVehicleFragment.VehicleSim.IncrementCruiseSleepCounter();
+	}
+	else
+	{
+		// Reset cruise sleep counter
+		SimplePhysicsVehicleFragment.VehicleSim.WakeFromCruiseSleep();
+	}
+
+	if (!bIsCruiseSleeping)
+	{
+		// Still integrating - refresh the cached kinematic solution for when we do fall asleep
+		SimplePhysicsVehicleFragment.VehicleSim.CruiseSpeed = VehicleControlFragment.Speed;
+		SimplePhysicsVehicleFragment.VehicleSim.CruiseThrottle = PIDVehicleControlFragment.Throttle;
+		SimplePhysicsVehicleFragment.VehicleSim.CruiseLaneSpaceTransform = LaneSpaceTransform;
+		return false;
+	}
+
+	// Replay the cached kinematic solution - advance the cached lane-space chassis transform along
+	// the lane at the cached cruise speed. Wake at the lane end so live physics handles the
+	// transition onto the next lane.
+	const float NewDistanceAlongLane = LaneLocationFragment.DistanceAlongLane + SimplePhysicsVehicleFragment.VehicleSim.CruiseSpeed * DeltaTime;
+	if (NewDistanceAlongLane >= LaneLocationFragment.LaneLength)
+	{
+		SimplePhysicsVehicleFragment.VehicleSim.WakeFromCruiseSleep();
+		return false;
+	}
+
+	FTransform NewRawLaneLocationTransform;
+	UE::MassTraffic::InterpolatePositionAndOrientationAlongLane(ZoneGraphStorage, LaneLocationFragment.LaneHandle.Index, NewDistanceAlongLane, ETrafficVehicleMovementInterpolationMethod::CubicBezier, InterpolationFragment.LaneLocationLaneSegment, NewRawLaneLocationTransform);
+	NewRawLaneLocationTransform.AddToTranslation(NewRawLaneLocationTransform.GetRotation().GetRightVector() * LaneOffsetFragment.LateralOffset);
+
+	TransformFragment.GetMutableTransform() = SimplePhysicsVehicleFragment.VehicleSim.CruiseLaneSpaceTransform * NewRawLaneLocationTransform;
+
+	// Update speed & velocity from the replayed movement, same as the integrated path does
+	// @see FPerParticlePBDUpdateFromDeltaPosition
+	VelocityFragment.Value = Chaos::FVec3::CalculateVelocity(VehicleWorldTransform.GetLocation(), TransformFragment.GetTransform().GetLocation(), DeltaTime);
+	AngularVelocityFragment.AngularVelocity = Chaos::FRotation3::CalculateAngularVelocity(VehicleWorldTransform.GetRotation(), TransformFragment.GetTransform().GetRotation(), DeltaTime);
+	VehicleControlFragment.Speed = VelocityFragment.Value.Size();
+
+#if WITH_MASSTRAFFIC_DEBUG
+	UE::MassTraffic::DrawDebugSleepState(GetWorld(), TransformFragment.GetTransform().GetLocation(), true, bVisLog, LogOwner);
+#endif
+
+	return true;
+}
+
 void UMassTrafficVehiclePhysicsProcessor::PerformSuspensionTraces(
 	FMassTrafficVehiclePhysicsFragment& SimplePhysicsVehicleFragment,
 	const FTransform& VehicleWorldTransform,
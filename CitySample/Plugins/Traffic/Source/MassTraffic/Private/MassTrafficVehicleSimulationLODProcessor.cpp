@@ -22,10 +22,13 @@ UMassTrafficVehicleSimulationLODProcessor::UMassTrafficVehicleSimulationLODProce
 	, EntityQueryVariableTick(*this)
 	, EntityQueryLODChange(*this)
 {
+	// Base distances apply to vehicles outside the view frustum. Keep those much tighter than the
+	// visible distances so off-screen vehicles demote to the cheap simple control tiers (and drop
+	// their PID & simple physics fragments) well before on-screen vehicles at the same range do.
 	BaseLODDistance[EMassLOD::High] = 0.0f;
-	BaseLODDistance[EMassLOD::Medium] = 20000.0f;
-	BaseLODDistance[EMassLOD::Low] = 20000.0f;
-	BaseLODDistance[EMassLOD::Off] = 50000.0f;
+	BaseLODDistance[EMassLOD::Medium] = 10000.0f;
+	BaseLODDistance[EMassLOD::Low] = 10000.0f;
+	BaseLODDistance[EMassLOD::Off] = 30000.0f;
 	VisibleLODDistance[EMassLOD::High] = 0.0f;
 	VisibleLODDistance[EMassLOD::Medium] = 20000.0f;
 	VisibleLODDistance[EMassLOD::Low] = 20000.0f;
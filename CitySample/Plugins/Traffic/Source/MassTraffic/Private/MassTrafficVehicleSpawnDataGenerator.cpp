@@ -18,6 +18,8 @@
 #include "ZoneGraphSubsystem.h"
 #include "ZoneGraphQuery.h"
 
+#include "Async/ParallelFor.h"
+
 void UMassTrafficVehicleSpawnDataGenerator::Generate(UObject& QueryOwner,
 	TConstArrayView<FMassSpawnedEntityType> EntityTypes, int32 Count,
 	FFinishedGeneratingSpawnDataSignature& FinishedGeneratingSpawnPointsDelegate) const
@@ -318,11 +320,22 @@ bool UMassTrafficVehicleSpawnDataGenerator::FindNonOverlappingLanePoints(
 		// Prepare discrete random stream to pull spacing choices from.
 		const UE::MassTraffic::TDiscreteRandomStream VehicleTypeSpacingDiscreteRandomStream(SpacingProportions);
 
-		// Go through all lanes we have chosen to work on.
-		for (int32 LaneIndexIndex = 0; LaneIndexIndex < LaneIndices.Num(); ++LaneIndexIndex)
+		// Sample lanes in parallel. Lanes are independent of one another, so each lane samples into
+		// its own scratch arrays, drawing from a lane-local random stream deterministically seeded
+		// from the master seed and the lane index. Results are therefore reproducible for a given
+		// seed regardless of worker thread scheduling.
+		TArray<TArray<TArray<FZoneGraphLaneLocation>>> SpawnPointsPerLanePerSpacing;
+		SpawnPointsPerLanePerSpacing.SetNum(LaneIndices.Num());
+
+		ParallelFor(LaneIndices.Num(), [&](int32 LaneIndexIndex)
 		{
 			const int32 LaneIndex = LaneIndices[LaneIndexIndex];
 
+			TArray<TArray<FZoneGraphLaneLocation>>& LaneSpawnPointsPerSpacing = SpawnPointsPerLanePerSpacing[LaneIndexIndex];
+			LaneSpawnPointsPerSpacing.SetNum(Spacings.Num());
+
+			const FRandomStream LaneRandomStream(static_cast<int32>(HashCombine(static_cast<uint32>(RandomStream.GetInitialSeed()), static_cast<uint32>(LaneIndex))));
+
 			float LaneLength = 0.0f;
 			UE::ZoneGraph::Query::GetLaneLength(ZoneGraphStorage, LaneIndex, LaneLength);
 			
@@ -345,8 +358,8 @@ bool UMassTrafficVehicleSpawnDataGenerator::FindNonOverlappingLanePoints(
 				// Check for 0 density (skip lane)
 				if (DensityMultiplier <= 0.0f)
 				{
-					// Continue to next lane, no spaces generated on this lane
-					continue;  
+					// Skip this lane, no spaces generated on this lane
+					return;
 				}
 
 				SpacingScale = 1.0f / DensityMultiplier;
@@ -356,7 +369,7 @@ bool UMassTrafficVehicleSpawnDataGenerator::FindNonOverlappingLanePoints(
 			auto ChooseVehicleTypeSpacingIndex = [&]() -> int32
 			{
 				// Pick a unique vehicle spacing index.
-				int32 VehicleTypeSpacingIndex = VehicleTypeSpacingDiscreteRandomStream.RandChoice(RandomStream);
+				int32 VehicleTypeSpacingIndex = VehicleTypeSpacingDiscreteRandomStream.RandChoice(LaneRandomStream);
 
 				const int32 NumSpacings = Spacings.Num();
 				for (int32 I = 0; I < NumSpacings; I++)
@@ -384,7 +397,7 @@ bool UMassTrafficVehicleSpawnDataGenerator::FindNonOverlappingLanePoints(
 
 			
 			// Allocate points along the lane, starting at 0
-			for (float Distance = RandomStream.FRandRange(MinGapBetweenSpaces, MaxGapBetweenSpaces); Distance < LaneLength; /*see end of block*/)
+			for (float Distance = LaneRandomStream.FRandRange(MinGapBetweenSpaces, MaxGapBetweenSpaces); Distance < LaneLength; /*see end of block*/)
 			{
 				const int32 VehicleTypeSpacingIndex = ChooseVehicleTypeSpacingIndex();
 				if (VehicleTypeSpacingIndex == INDEX_NONE)
@@ -403,12 +416,21 @@ bool UMassTrafficVehicleSpawnDataGenerator::FindNonOverlappingLanePoints(
 					if (!LaneLocationFilterFunction || LaneLocationFilterFunction(LaneLocation))
 					{
 						// Passed filter, add location
-						OutSpawnPointsPerSpacing[VehicleTypeSpacingIndex].Add(LaneLocation);
+						LaneSpawnPointsPerSpacing[VehicleTypeSpacingIndex].Add(LaneLocation);
 					}
 				}
 				
 				// Advance ahead past the space we just consumed, plus a random gap.
-				Distance += VehicleTypeSpacing.Space * SpacingScale + RandomStream.FRandRange(MinGapBetweenSpaces, MaxGapBetweenSpaces);
+				Distance += VehicleTypeSpacing.Space * SpacingScale + LaneRandomStream.FRandRange(MinGapBetweenSpaces, MaxGapBetweenSpaces);
+			}
+		});
+
+		// Append per-lane points, in lane order, into the output arrays.
+		for (TArray<TArray<FZoneGraphLaneLocation>>& LaneSpawnPointsPerSpacing : SpawnPointsPerLanePerSpacing)
+		{
+			for (int32 I = 0; I < Spacings.Num(); I++)
+			{
+				OutSpawnPointsPerSpacing[I].Append(MoveTemp(LaneSpawnPointsPerSpacing[I]));
 			}
 		}
 	}
@@ -5,6 +5,7 @@
 #include "MassTrafficSubsystem.h"
 #include "MassTrafficDamageRepairProcessor.h"
 #include "MassTrafficParkedVehicleVisualizationProcessor.h"
+#include "MassTrafficPerfStats.h"
 #include "MassRepresentationSubsystem.h"
 #include "MassEntityManager.h"
 #include "MassExecutionContext.h"
@@ -210,6 +211,7 @@ void UMassTrafficVehicleUpdateCustomVisualizationProcessor::ConfigureQueries(con
 	EntityQuery.AddRequirement<FMassTrafficRandomFractionFragment>(EMassFragmentAccess::ReadOnly);
 	EntityQuery.AddRequirement<FMassTrafficVehicleLightsFragment>(EMassFragmentAccess::ReadOnly);
 	EntityQuery.AddRequirement<FMassTrafficVehiclePhysicsFragment>(EMassFragmentAccess::ReadOnly, EMassFragmentPresence::Optional);
+	EntityQuery.AddSubsystemRequirement<UMassTrafficSubsystem>(EMassFragmentAccess::ReadWrite);
 
 #if WITH_MASSTRAFFIC_DEBUG
 	DebugEntityQuery = EntityQuery;
@@ -221,12 +223,17 @@ void UMassTrafficVehicleUpdateCustomVisualizationProcessor::ConfigureQueries(con
 
 void UMassTrafficVehicleUpdateCustomVisualizationProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& ExecutionContext)
 {
-	EntityQuery.ForEachEntityChunk(ExecutionContext, [this](FMassExecutionContext& Context)
+	UE::MassTraffic::FScopedProcessorPerfStats PerfStats(GetFName()); // (See all PERFSNAPSHOT.)
+
+	EntityQuery.ForEachEntityChunk(ExecutionContext, [this, &PerfStats](FMassExecutionContext& Context)
 	{
-		// Get mutable ISMInfos to append instances & custom data to
+		PerfStats.AddChunk(Context.GetNumEntities());
+
+		// ISM instance updates are queued to the visualization command buffer for the end-of-group
+		// flush, rather than written directly here. (See all VISBUFFER.)
+		UMassTrafficSubsystem& MassTrafficSubsystem = Context.GetMutableSubsystemChecked<UMassTrafficSubsystem>();
 		UMassRepresentationSubsystem* RepresentationSubsystem = Context.GetMutableSharedFragment<FMassRepresentationSubsystemSharedFragment>().RepresentationSubsystem;
 		check(RepresentationSubsystem);
-		const FMassInstancedStaticMeshInfoArrayView ISMInfo = RepresentationSubsystem->GetMutableInstancedStaticMeshInfos();
 
 		const TConstArrayView<FMassTrafficRandomFractionFragment> RandomFractionFragments = Context.GetFragmentView<FMassTrafficRandomFractionFragment>();
 		const TConstArrayView<FMassTrafficVehiclePhysicsFragment> SimpleVehiclePhysicsFragments = Context.GetFragmentView<FMassTrafficVehiclePhysicsFragment>();
@@ -256,14 +263,18 @@ void UMassTrafficVehicleUpdateCustomVisualizationProcessor::Execute(FMassEntityM
 				{
 					case EMassRepresentationType::StaticMeshInstance:
 					{
-						// Add ISMC instance with custom data
+						// Queue ISMC instance with custom data for the end-of-group flush
 						if (RepresentationFragment.StaticMeshDescHandle.IsValid())
 						{
-							ISMInfo[RepresentationFragment.StaticMeshDescHandle.ToIndex()].AddBatchedTransform(Entity
-								, TransformFragment.GetTransform(), RepresentationFragment.PrevTransform, RepresentationLODFragment.LODSignificance);
-
-							const FMassTrafficPackedVehicleInstanceCustomData PackedCustomData = FMassTrafficVehicleInstanceCustomData::MakeTrafficVehicleCustomData(VehicleStateFragment, RandomFractionFragment);
-							ISMInfo[RepresentationFragment.StaticMeshDescHandle.ToIndex()].AddBatchedCustomData(PackedCustomData, RepresentationLODFragment.LODSignificance);
+							FMassTrafficVisualizationCommand VisualizationCommand;
+							VisualizationCommand.Entity = Entity;
+							VisualizationCommand.RepresentationSubsystem = RepresentationSubsystem;
+							VisualizationCommand.StaticMeshDescIndex = RepresentationFragment.StaticMeshDescHandle.ToIndex();
+							VisualizationCommand.Transform = TransformFragment.GetTransform();
+							VisualizationCommand.PrevTransform = RepresentationFragment.PrevTransform;
+							VisualizationCommand.LODSignificance = RepresentationLODFragment.LODSignificance;
+							VisualizationCommand.PackedCustomData = FMassTrafficVehicleInstanceCustomData::MakeTrafficVehicleCustomData(VehicleStateFragment, RandomFractionFragment);
+							MassTrafficSubsystem.GetMutableVisualizationCommandBuffer().Add(VisualizationCommand);
 						}
 						break;
 					}
@@ -0,0 +1,66 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MassTrafficVisualizationCommandBuffer.h"
+#include "MassTraffic.h"
+#include "MassRepresentationSubsystem.h"
+
+
+void FMassTrafficVisualizationCommandBuffer::Reset(int32 InCapacity)
+{
+	check(IsInGameThread());
+
+	Commands.SetNum(FMath::Max(InCapacity, 0));
+	NumPushed.store(0, std::memory_order_relaxed);
+}
+
+void FMassTrafficVisualizationCommandBuffer::Add(const FMassTrafficVisualizationCommand& Command)
+{
+	// Each pushed command claims a unique slot, so concurrent producers never write the same
+	// element. The flush on the game thread is ordered after all producers by the Mass processor
+	// dependency graph. (See all VISBUFFER.)
+	const int32 Index = NumPushed.fetch_add(1, std::memory_order_relaxed);
+	if (Index < Commands.Num())
+	{
+		Commands[Index] = Command;
+	}
+}
+
+void FMassTrafficVisualizationCommandBuffer::Flush()
+{
+	check(IsInGameThread());
+
+	const int32 NumToFlush = FMath::Min(NumPushed.load(std::memory_order_relaxed), Commands.Num());
+	const int32 NumDropped = NumPushed.load(std::memory_order_relaxed) - NumToFlush;
+	if (NumDropped > 0)
+	{
+		UE_LOG(LogMassTraffic, Warning, TEXT("Visualization command buffer overflowed, dropping %d instance updates this frame. Raise MassTraffic.VisualizationCommandBufferSize (currently %d)."), NumDropped, Commands.Num());
+	}
+
+	// Cache the ISM info view across consecutive commands from the same representation subsystem.
+	// In practice all traffic vehicles share the world's representation subsystem, so this resolves
+	// once.
+	UMassRepresentationSubsystem* CachedRepresentationSubsystem = nullptr;
+	FMassInstancedStaticMeshInfoArrayView ISMInfo;
+
+	for (int32 Index = 0; Index < NumToFlush; ++Index)
+	{
+		const FMassTrafficVisualizationCommand& Command = Commands[Index];
+		if (Command.RepresentationSubsystem != CachedRepresentationSubsystem)
+		{
+			CachedRepresentationSubsystem = Command.RepresentationSubsystem;
+			check(CachedRepresentationSubsystem);
+			ISMInfo = CachedRepresentationSubsystem->GetMutableInstancedStaticMeshInfos();
+		}
+
+		ISMInfo[Command.StaticMeshDescIndex].AddBatchedTransform(Command.Entity, Command.Transform, Command.PrevTransform, Command.LODSignificance);
+		ISMInfo[Command.StaticMeshDescIndex].AddBatchedCustomData(Command.PackedCustomData, Command.LODSignificance);
+	}
+
+	NumPushed.store(0, std::memory_order_relaxed);
+
+	// Track the capacity CVar so it can be tuned at runtime
+	if (Commands.Num() != GMassTrafficVisualizationCommandBufferSize)
+	{
+		Reset(GMassTrafficVisualizationCommandBufferSize);
+	}
+}
@@ -0,0 +1,37 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MassTrafficVisualizationCommandFlushProcessor.h"
+#include "MassTrafficDebugHelpers.h"
+#include "MassTrafficParkedVehicleVisualizationProcessor.h"
+#include "MassTrafficSubsystem.h"
+#include "MassTrafficVehicleVisualizationProcessor.h"
+#include "MassExecutionContext.h"
+
+
+UMassTrafficVisualizationCommandFlushProcessor::UMassTrafficVisualizationCommandFlushProcessor()
+{
+	bAutoRegisterWithProcessingPhases = true;
+	bRequiresGameThreadExecution = true;
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::Client | EProcessorExecutionFlags::Standalone);
+	ExecutionOrder.ExecuteInGroup = UE::MassTraffic::ProcessorGroupNames::VehicleVisualization;
+	ExecutionOrder.ExecuteAfter.Add(UMassTrafficVehicleUpdateCustomVisualizationProcessor::StaticClass()->GetFName());
+	ExecutionOrder.ExecuteAfter.Add(UMassTrafficParkedVehicleUpdateCustomVisualizationProcessor::StaticClass()->GetFName());
+}
+
+void UMassTrafficVisualizationCommandFlushProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	// No entity query - this processor just drains the subsystem's visualization command buffer,
+	// filled by the vehicle visualization processors ordered above. (See all VISBUFFER.)
+	ProcessorRequirements.AddSubsystemRequirement<UMassTrafficSubsystem>(EMassFragmentAccess::ReadWrite);
+}
+
+void UMassTrafficVisualizationCommandFlushProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	UMassTrafficSubsystem& MassTrafficSubsystem = Context.GetMutableSubsystemChecked<UMassTrafficSubsystem>();
+	MassTrafficSubsystem.GetMutableVisualizationCommandBuffer().Flush();
+
+#if WITH_MASSTRAFFIC_DEBUG
+	// Submit this frame's batched traffic debug primitives in one go. (See all DEBUGBATCH.)
+	UE::MassTraffic::GetDebugDrawBuffer().Flush(EntityManager.GetWorld());
+#endif
+}
@@ -54,14 +54,28 @@ extern int32 GMassTrafficDebugNextOrderValidation;
 extern int32 GMassTrafficDebugDestruction;
 extern int32 GMassTrafficDebugSleep;
 extern int32 GMassTrafficValidation;
+extern int32 GMassTrafficValidationSampleInterval;
+extern float GMassTrafficNextVehicleRescanInterval;
 extern int32 GMassTrafficLaneChange;
 extern int32 GMassTrafficVehicleTypeVariety;
 extern int32 GMassTrafficTrafficLights;
 extern int32 GMassTrafficDrivers;
 extern float GMassTrafficMaxDriverVisualizationDistance;
 extern int32 GMassTrafficMaxDriverVisualizationLOD;
+extern float GMassTrafficDriverVisualizationMidUpdateDistance;
+extern float GMassTrafficDriverVisualizationFarUpdateDistance;
+extern int32 GMassTrafficDriverVisualizationMidUpdateInterval;
+extern int32 GMassTrafficDriverVisualizationFarUpdateInterval;
+extern float GMassTrafficLightVisualizationFarUpdateDistance;
+extern float GMassTrafficLightVisualizationFarUpdateInterval;
 extern int32 GMassTrafficOverseer;
 extern int32 GMassTrafficRepairDamage;
+extern float GMassTrafficRepairDamageTimeBudget;
+extern int32 GMassTrafficVisualizationCommandBufferSize;
+extern int32 GMassTrafficRecycleBudgetMicroseconds;
+extern float GMassTrafficReplicationKeyframeInterval;
+extern float GMassTrafficReplicationInterestRadius;
+extern float GMassTrafficReplicationInterestCellSize;
 extern float GMassTrafficNumTrafficVehiclesScale;
 extern float GMassTrafficNumParkedVehiclesScale;
 extern float GMassTrafficLODPlayerVehicleDistanceScale;
@@ -69,7 +83,14 @@ extern int32 GMassTrafficSleepEnabled;
 extern int32 GMassTrafficSleepCounterThreshold;
 extern float GMassTrafficLinearSpeedSleepThreshold;
 extern float GMassTrafficControlInputWakeTolerance;
+extern float GMassTrafficIntersectionSleepUpdateInterval;
+extern int32 GMassTrafficCruiseSleepEnabled;
+extern float GMassTrafficCruiseSleepSpeedTolerance;
+extern float GMassTrafficCruiseSleepChassisTolerance;
 
+extern int32 GMassTrafficParallelVehicleControl;
+extern int32 GMassTrafficParallelVehicleControlGrainSize;
+extern int32 GMassTrafficOffLODCheapVehicleControl;
 extern float GMassTrafficSpeedLimitScale;
 
 namespace UE::MassTraffic::ProcessorGroupNames
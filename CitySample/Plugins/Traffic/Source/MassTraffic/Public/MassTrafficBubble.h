@@ -21,6 +21,19 @@ public:
 #if UE_REPLICATION_COMPILE_SERVER_CODE
 	const FMassClientBubbleTransformHandler& GetTransformHandler() const { return TransformHandler; }
 	FMassClientBubbleTransformHandler& GetTransformHandlerMutable() { return TransformHandler; }
+
+	/**
+	 * Writes the compact lane-space state for an agent, marking the fast array item dirty only
+	 * when the quantized state actually changed, so vehicles that haven't moved a quantization
+	 * step serialize nothing. Returns whether the item was dirtied. (See all TRAFFICDELTA.)
+	 */
+	bool SetDeltaData(const FMassReplicatedAgentHandle Handle, const FReplicatedTrafficVehicleDeltaData& DeltaData);
+
+	/**
+	 * Returns whether the full position + yaw keyframe state for an agent is due for a refresh,
+	 * and stamps the keyframe time when it is. (See all TRAFFICDELTA.)
+	 */
+	bool ShouldKeyframe(const FMassReplicatedAgentHandle Handle, const double Time, const double KeyframeInterval);
 #endif //UE_REPLICATION_COMPILE_SERVER_CODE
 
 protected:
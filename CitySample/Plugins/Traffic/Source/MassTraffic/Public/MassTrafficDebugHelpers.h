@@ -34,6 +34,60 @@ FVector GetPlayerViewLocation(const UWorld* World);
 
 #if WITH_MASSTRAFFIC_DEBUG
 
+/**
+ * Thread-safe per-frame buffer of traffic debug primitives. The per-frame draw helpers below
+ * append to this instead of calling immediate-mode DrawDebug* - which updates the line batcher's
+ * render state once per primitive - and UMassTrafficVisualizationCommandFlushProcessor submits
+ * the whole frame's primitives in a single batch on the game thread. Persistent / timed debug
+ * draws (parking spaces, traffic lights etc.) stay immediate as they outlive the frame.
+ * (See all DEBUGBATCH.)
+ */
+struct MASSTRAFFIC_API FMassTrafficDebugDrawBuffer
+{
+	void AddLine(const FVector& Start, const FVector& End, const FColor& Color, float Thickness = 0.0f);
+	void AddDirectionalArrow(const FVector& Start, const FVector& End, float ArrowSize, const FColor& Color, float Thickness = 0.0f);
+	void AddPoint(const FVector& Location, float Size, const FColor& Color);
+	void AddString(const FVector& Location, const FString& Text, const FColor& Color, float FontScale = 1.0f);
+
+	/** Submits and clears all buffered primitives. Must be called on the game thread. */
+	void Flush(UWorld* World);
+
+private:
+
+	struct FDebugLine
+	{
+		FVector Start;
+		FVector End;
+		FColor Color;
+		float Thickness;
+	};
+
+	struct FDebugPoint
+	{
+		FVector Location;
+		float Size;
+		FColor Color;
+	};
+
+	struct FDebugString
+	{
+		FVector Location;
+		FString Text;
+		FColor Color;
+		float FontScale;
+	};
+
+	/** Guards the arrays below as the draw helpers are called from parallel processor work */
+	FCriticalSection Mutex;
+
+	TArray<FDebugLine> Lines;
+	TArray<FDebugPoint> Points;
+	TArray<FDebugString> Strings;
+};
+
+/** Returns the process-wide debug draw buffer the per-frame draw helpers append to. (See all DEBUGBATCH.) */
+MASSTRAFFIC_API FMassTrafficDebugDrawBuffer& GetDebugDrawBuffer();
+
 void DrawDebugZLine(const UWorld* World, const FVector& Location, FColor Color = FColor::White, bool bPersist = false, float LifeTime = 0.0f, float Thickness= 10.0f, float Length = 750.0f);
 void DrawDebugStringNearLocation(const UWorld* InWorld, FVector const& TextLocation, const FString& Text, class AActor* TestBaseActor, FColor const& TextColor, float Duration, bool bDrawShadow, float FontScale, const FVector Location = FVector::ZeroVector, const float Distance = 5000.0f);
 void DrawDebugStringNearPlayerLocation(const UWorld* InWorld, FVector const& TextLocation, const FString& Text, class AActor* TestBaseActor = nullptr, FColor const& TextColor = FColor::White, float Duration = 0.0f, bool bDrawShadow = false, float FontScale = 1.0f);
@@ -48,11 +48,19 @@ private:
 		FMassTrafficInstancePlaybackData& OutPlaybackData);
 
 	bool PopulateAnimFromAnimState(
-		const UAnimToTextureDataAsset* AnimData, 
-		int32 StateIndex, 
+		const UAnimToTextureDataAsset* AnimData,
+		int32 StateIndex,
 		int32 VariationIndex,
 		FMassTrafficInstancePlaybackData& OutPlaybackData);
 
+	/**
+	 * Per-frame cache of base anim states per unique (anim-to-texture asset, variation, state)
+	 * combination. The dozens of drivers playing the same idle loop each frame resolve the asset's
+	 * animation table once between them and copy the cached state, only personalizing their start
+	 * time or eval frame afterwards. Reset at the start of each Execute.
+	 */
+	TMap<TPair<const UAnimToTextureDataAsset*, int32>, FMassTrafficAnimState> AnimBaseStateCache;
+
 public:
 
 	UPROPERTY(EditDefaultsOnly, config)
@@ -1,9 +1,10 @@
-﻿// Copyright Epic Games, Inc. All Rights Reserved.
+// Copyright Epic Games, Inc. All Rights Reserved.
 
 #pragma once
 
 #include "MassTrafficProcessorBase.h"
 #include "MassTrafficFragments.h"
+#include "Tasks/Task.h"
 #if UE_ENABLE_INCLUDE_ORDER_DEPRECATED_IN_5_6
 #include "MassActorSubsystem.h"
 #include "MassCommonFragments.h"
@@ -20,9 +21,39 @@ class MASSTRAFFIC_API UMassTrafficFindDeviantParkedVehiclesProcessor : public UM
 public:
 	UMassTrafficFindDeviantParkedVehiclesProcessor();
 
+	virtual void BeginDestroy() override;
+
 protected:
 	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
 	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
 
+	/** Game-thread snapshot of one parked vehicle's inputs for the async deviance test. (See all ASYNCDEVIANT.) */
+	struct FParkedVehicleCheckInput
+	{
+		FMassEntityHandle Entity;
+		FVector EntityLocation = FVector::ZeroVector;
+		FVector ActorLocation = FVector::ZeroVector;
+		float HalfWidth = 0.0f;
+		float HalfLength = 0.0f;
+	};
+
+	/** One parked vehicle the async test found disturbed, applied next frame. (See all ASYNCDEVIANT.) */
+	struct FParkedVehicleCheckResult
+	{
+		FMassEntityHandle Entity;
+		FVector EntityLocation = FVector::ZeroVector;
+		FVector ActorLocation = FVector::ZeroVector;
+		float Deviation = 0.0f;
+		float HalfWidth = 0.0f;
+		float HalfLength = 0.0f;
+	};
+
+	void ApplyDeviantCheckResults(FMassEntityManager& EntityManager, FMassExecutionContext& Context);
+
 	FMassEntityQuery NominalParkedVehicleEntityQuery;
+
+	/** Double-buffered async deviance detection state, same scheme as the traffic vehicle deviance processor. (See all ASYNCDEVIANT.) */
+	TArray<FParkedVehicleCheckInput> ParkedVehicleCheckInputs;
+	TArray<FParkedVehicleCheckResult> DeviantParkedVehicles;
+	UE::Tasks::FTask DeviantCheckTask;
 };
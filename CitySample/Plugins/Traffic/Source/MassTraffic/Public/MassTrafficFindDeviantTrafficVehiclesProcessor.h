@@ -4,6 +4,7 @@
 
 #include "MassTrafficProcessorBase.h"
 #include "MassTrafficFragments.h"
+#include "Tasks/Task.h"
 #if UE_ENABLE_INCLUDE_ORDER_DEPRECATED_IN_5_6
 #include "MassActorSubsystem.h"
 #include "MassCommonFragments.h"
@@ -21,13 +22,62 @@ class MASSTRAFFIC_API UMassTrafficFindDeviantTrafficVehiclesProcessor : public U
 public:
 	UMassTrafficFindDeviantTrafficVehiclesProcessor();
 
+	virtual void BeginDestroy() override;
+
 protected:
 	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
 	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
 
+	/**
+	 * Game-thread snapshot of one vehicle's inputs for the async deviance test. Everything the
+	 * worker task reads is copied by value here, except the zone graph storage which is static
+	 * after load. (See all ASYNCDEVIANT.)
+	 */
+	struct FDeviantVehicleCheckInput
+	{
+		FMassEntityHandle Entity;
+		const FZoneGraphStorage* ZoneGraphStorage = nullptr;
+		FVector ActorLocation = FVector::ZeroVector;
+		int32 LaneIndex = INDEX_NONE;
+		float DistanceAlongLane = 0.0f;
+		float LateralOffset = 0.0f;
+		float DeviationTolerance = 0.0f;
+		float HalfWidth = 0.0f;
+		float HalfLength = 0.0f;
+		FMassTrafficVehicleLaneChangeFragment LaneChangeFragment;
+		FMassTrafficLaneSegment CachedLaneSegment;
+	};
+
+	/** One vehicle the async test found newly deviant, applied next frame. (See all ASYNCDEVIANT.) */
+	struct FDeviantVehicleCheckResult
+	{
+		FMassEntityHandle Entity;
+		FVector ActorLocation = FVector::ZeroVector;
+		float Deviation = 0.0f;
+		float HalfWidth = 0.0f;
+		float HalfLength = 0.0f;
+	};
+
+	/** Lane-relative transform math shared by both halves of the async deviance test. Safe to call from the worker task. (See all ASYNCDEVIANT.) */
+	static float ComputeLaneDeviation(FDeviantVehicleCheckInput& Input, FTransform& OutLaneLocationTransform);
+
+	void ApplyDeviantCheckResults(FMassEntityManager& EntityManager, FMassExecutionContext& Context);
+
 	FMassEntityQuery NominalTrafficVehicleEntityQuery;
-	
+
 	FMassEntityQuery DeviantTrafficVehicleEntityQuery;
-	
+
 	FMassEntityQuery CorrectedTrafficVehicleEntityQuery;
+
+	/**
+	 * Double-buffered async deviance detection state: inputs are gathered on the game thread each
+	 * frame and handed to a worker task, whose results are consumed at the start of the next
+	 * frame's Execute. Only the task touches the result arrays between launch and the wait.
+	 * (See all ASYNCDEVIANT.)
+	 */
+	TArray<FDeviantVehicleCheckInput> NominalVehicleCheckInputs;
+	TArray<FDeviantVehicleCheckInput> DeviantVehicleCheckInputs;
+	TArray<FDeviantVehicleCheckResult> NewlyDeviantVehicles;
+	TArray<FMassEntityHandle> CorrectedVehicles;
+	UE::Tasks::FTask DeviantCheckTask;
 };
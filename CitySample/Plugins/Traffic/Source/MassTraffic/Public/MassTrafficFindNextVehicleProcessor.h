@@ -22,4 +22,7 @@ protected:
 	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
 
 	FMassEntityQuery EntityQuery;
+
+	/** World time of the last CVar-driven periodic rescan (see MassTraffic.NextVehicleRescanInterval) */
+	double TimeOfLastRescan = -1.0;
 };
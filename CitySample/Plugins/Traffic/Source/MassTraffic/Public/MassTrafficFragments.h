@@ -10,6 +10,7 @@
 #endif // UE_ENABLE_INCLUDE_ORDER_DEPRECATED_IN_5_6
 #include "MassTrafficDamage.h"
 #include "MassTrafficDebugHelpers.h"
+#include "MassTrafficInstancePlaybackHelpers.h"
 #include "MassTrafficPIDController.h"
 #include "MassTrafficTypes.h"
 #include "MassTrafficPhysics.h"
@@ -286,9 +287,14 @@ struct FMassTrafficPeriod
 	// lane in the next period, to see if it closes. Also, storing uint8 indices instead of redundantly storing lane pointers
 	// (1) Saves a lot of memory (2) Gives a big perf improvement by saving the cache, even though some of the code to
 	// support this uses more cycles and is a bit more complex.
-	TArray<uint8, TInlineAllocator<MASSTRAFFIC_NUM_INLINE_PERIOD_VEHICLE_TRAFFIC_LANES>> VehicleLaneIndices_ClosedInNextPeriod; 
+	TArray<uint8, TInlineAllocator<MASSTRAFFIC_NUM_INLINE_PERIOD_VEHICLE_TRAFFIC_LANES>> VehicleLaneIndices_ClosedInNextPeriod;
+
+	// Optimization. One bit per entry in 'open vehicle lanes', set if that lane closes in the next period. Built once
+	// (see Finalize) so period application can test a lane by its index directly, instead of searching the two arrays
+	// above per lane per period change - which happened across all 600+ intersections.
+	TBitArray<> VehicleLaneClosedInNextPeriodMask;
+
 
-	
 	// Pedestrian crosswalk lanes this period controls (opens.)
 
 	TArray<int32, TInlineAllocator<MASSTRAFFIC_NUM_INLINE_PERIOD_PEDESTRIAN_CROSSWALK_LANES>> CrosswalkLanes;
@@ -361,7 +367,7 @@ struct FMassTrafficPeriod
 		return nullptr;
 	}
 	
-	MASSTRAFFIC_API bool VehicleLaneClosesInNextPeriod(FZoneGraphTrafficLaneData* VehicleLane) const;
+	MASSTRAFFIC_API bool VehicleLaneClosesInNextPeriod(const int32 VehicleLaneIndex) const;
 };
 
 
@@ -395,6 +401,11 @@ struct MASSTRAFFIC_API FMassTrafficIntersectionFragment : public FMassFragment
 	
 	FFloat16 PeriodTimeRemaining = 0.0f;
 
+	// Time accumulated while per-frame period updates were deferred because this intersection was
+	// deep in a stable period. Applied to the period countdown in one step on the next full update.
+	// (See all INTERSLEEP.)
+	float DeferredUpdateTime = 0.0f;
+
 	TArray<FMassTrafficPeriod, TInlineAllocator<MASSTRAFFIC_NUM_INLINE_PERIODS>> Periods;
 
 	TArray<FMassTrafficLight, TInlineAllocator<MASSTRAFFIC_NUM_INLINE_INTERSECTION_TRAFFIC_LIGHTS>> TrafficLights;
@@ -462,6 +473,25 @@ struct MASSTRAFFIC_API FMassTrafficIntersectionFragment : public FMassFragment
 };
 
 
+/**
+ * Per-intersection state for throttling traffic light visualization refreshes by viewer distance.
+ * Far intersections re-pack their light state at a fixed interval and re-submit the frozen packed
+ * custom data in between, while the intersection period timers keep simulating normally.
+ * (See all LIGHTVISLOD.)
+ */
+USTRUCT()
+struct MASSTRAFFIC_API FMassTrafficLightVisualizationFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	/** World seconds when the packed light custom data was last refreshed. */
+	float LastStateRefreshTimeSeconds = -1.0f;
+
+	/** Packed custom data per traffic light, frozen between far refreshes. */
+	TArray<float, TInlineAllocator<MASSTRAFFIC_NUM_INLINE_INTERSECTION_TRAFFIC_LIGHTS>> CachedPackedParam1;
+};
+
+
 /** Simulation LOD Fragment */
 USTRUCT()
 struct MASSTRAFFIC_API FMassTrafficSimulationLODFragment : public FMassFragment
@@ -501,10 +531,21 @@ struct MASSTRAFFIC_API FMassTrafficDriverVisualizationFragment : public FMassFra
 	GENERATED_BODY()
 
 	static constexpr uint32 InvalidDriverTypeIndex = TNumericLimits<uint8>::Max();
+	static constexpr uint8 InvalidUpdatePhase = TNumericLimits<uint8>::Max();
 
 	uint8 DriverTypeIndex = InvalidDriverTypeIndex;
 	ETrafficDriverAnimState AnimState = ETrafficDriverAnimState::Invalid;
 	float AnimStateGlobalTime = 0.0f;
+
+	/**
+	 * Round-robin phase offset staggering amortized anim state updates across frames, assigned
+	 * from the vehicle's random fraction on first update. (See all DRIVERBUCKET.)
+	 */
+	uint8 UpdatePhase = InvalidUpdatePhase;
+
+	/** Playback data from the last anim state update, re-submitted on skipped frames. (See all DRIVERBUCKET.) */
+	FMassTrafficInstancePlaybackData CachedPlaybackData;
+	bool bHasCachedPlaybackData = false;
 };
 
 
@@ -663,14 +704,16 @@ struct MASSTRAFFIC_API FMassTrafficVehicleControlFragment : public FMassFragment
 	FMassTrafficVehicleControlFragment() :
 		bRestrictedToTrunkLanesOnly(false),
 		ChooseNextLanePreference(EMassTrafficChooseNextLanePreference::ChooseAnyNextLane),
-		bCantStopAtLaneExit(false)
+		bCantStopAtLaneExit(false),
+		bWakePhysicsFromCruiseSleep(false)
 	{
 	}
 
 	// Flags.
-	bool bRestrictedToTrunkLanesOnly : 1; // Whether this vehicle is only allowed to drive on trunk lanes // @todo Replace usage with FMassTrafficVehicleSimulationParameters::bRestrictedToTrunkLanesOnly 
+	bool bRestrictedToTrunkLanesOnly : 1; // Whether this vehicle is only allowed to drive on trunk lanes // @todo Replace usage with FMassTrafficVehicleSimulationParameters::bRestrictedToTrunkLanesOnly
 	EMassTrafficChooseNextLanePreference ChooseNextLanePreference : 2; // (See all CHOOSENEWLANEOPEN.)
 	bool bCantStopAtLaneExit : 1; // (See all CANTSTOPLANEEXIT.)
+	bool bWakePhysicsFromCruiseSleep : 1; // (See all CRUISESLEEP.)
 
 	// Inline copy of CurrentTrafficLaneData->ConstData constant lane data, copied on lane entry
 	FZoneGraphTrafficLaneConstData CurrentLaneConstData;
@@ -883,6 +926,11 @@ struct MASSTRAFFIC_API FMassTrafficInterpolationFragment : public FMassFragment
 	GENERATED_BODY()
 
 	FMassTrafficLaneSegment LaneLocationLaneSegment;
+
+	// Separate cursor for the front axle sample; interleaving rear & front
+	// axle evaluations through one cached segment thrashes it whenever the
+	// axles straddle a segment boundary.
+	FMassTrafficLaneSegment FrontAxleLaneSegment;
 };
 
 
@@ -63,6 +63,38 @@ struct FMassTrafficInstanceData
 
 	UPROPERTY()
 	TArray<FInstancedStaticMeshInstanceData> StaticMeshInstanceData;
+
+	/**
+	 * Dirty-range and free-slot tracking, so BatchUpdateInstancedMeshComponent only uploads the
+	 * contiguous range of instances touched since the last flush instead of the full arrays, and
+	 * so CompactInstances knows when fragmentation from released slots is worth repacking.
+	 * (See all ISMDIRTYRANGE.)
+	 */
+	UPROPERTY()
+	int32 FirstDirtyInstance = INDEX_NONE;
+
+	UPROPERTY()
+	int32 LastDirtyInstance = INDEX_NONE;
+
+	UPROPERTY()
+	TArray<int32> FreeInstanceIndices;
+
+	void MarkInstanceDirty(const int32 InstanceIndex)
+	{
+		FirstDirtyInstance = (FirstDirtyInstance == INDEX_NONE) ? InstanceIndex : FMath::Min(FirstDirtyInstance, InstanceIndex);
+		LastDirtyInstance = FMath::Max(LastDirtyInstance, InstanceIndex);
+	}
+
+	void ResetDirtyRange()
+	{
+		FirstDirtyInstance = INDEX_NONE;
+		LastDirtyInstance = INDEX_NONE;
+	}
+
+	float FreeSlotRatio() const
+	{
+		return PlaybackData.Num() > 0 ? static_cast<float>(FreeInstanceIndices.Num()) / static_cast<float>(PlaybackData.Num()) : 0.0f;
+	}
 };
 
 // class UMassTrafficDataAsset;
@@ -74,23 +106,44 @@ class MASSTRAFFIC_API UMassTrafficInstancePlaybackLibrary : public UBlueprintFun
 
 public:
 
-	//UFUNCTION(BlueprintCallable, Category = "MassTraffic|Playback")
-	//static void SetupInstancedMeshComponent(UInstancedStaticMeshComponent* InstancedMeshComponent, UPARAM(ref) FMassTrafficInstanceData& InstanceData, int32 NumInstances);
+	UFUNCTION(BlueprintCallable, Category = "MassTraffic|Playback")
+	static void SetupInstancedMeshComponent(UInstancedStaticMeshComponent* InstancedMeshComponent, UPARAM(ref) FMassTrafficInstanceData& InstanceData, int32 NumInstances);
+
+	/**
+	 * Uploads only the dirty instance range accumulated in InstanceData since the last call, via a
+	 * partial BatchUpdateInstancesData, instead of re-uploading the full instance & custom data
+	 * arrays every time. (See all ISMDIRTYRANGE.)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MassTraffic|Playback")
+	static void BatchUpdateInstancedMeshComponent(UInstancedStaticMeshComponent* InstancedMeshComponent, UPARAM(ref) FMassTrafficInstanceData& InstanceData);
+
+	UFUNCTION(BlueprintCallable, Category = "MassTraffic|Playback")
+	static void AllocateInstanceData(UPARAM(ref) FMassTrafficInstanceData& InstanceData, int32 Count);
+
+	/** Returns a free instance slot, reusing a previously released slot if one is available. (See all ISMDIRTYRANGE.) */
+	UFUNCTION(BlueprintCallable, Category = "MassTraffic|Playback")
+	static int32 AcquireInstance(UPARAM(ref) FMassTrafficInstanceData& InstanceData);
 
-	//UFUNCTION(BlueprintCallable, Category = "MassTraffic|Playback")
-	//static void BatchUpdateInstancedMeshComponent(UInstancedStaticMeshComponent* InstancedMeshComponent, UPARAM(ref) FMassTrafficInstanceData& InstanceData);
+	/** Releases an instance slot for reuse, collapsing it to zero scale so it no longer renders. (See all ISMDIRTYRANGE.) */
+	UFUNCTION(BlueprintCallable, Category = "MassTraffic|Playback")
+	static void ReleaseInstance(UPARAM(ref) FMassTrafficInstanceData& InstanceData, int32 InstanceIndex);
 
-	//UFUNCTION(BlueprintCallable, Category = "MassTraffic|Playback")
-	//static void AllocateInstanceData(UPARAM(ref) FMassTrafficInstanceData& InstanceData, int32 Count);
+	UFUNCTION(BlueprintCallable, Category = "MassTraffic|Playback")
+	static bool UpdateInstanceData(UPARAM(ref) FMassTrafficInstanceData& InstanceData, int32 InstanceIndex, const FMassTrafficInstancePlaybackData& PlaybackData, const FTransform& Transform);
 
-	//UFUNCTION(BlueprintCallable, Category = "MassTraffic|Playback")
-	//static bool UpdateInstanceData(UPARAM(ref) FMassTrafficInstanceData& InstanceData, int32 InstanceIndex, const FMassTrafficInstancePlaybackData& PlaybackData, const FTransform& Transform);
+	UFUNCTION(BlueprintCallable, Category = "MassTraffic|Playback")
+	static bool GetInstancePlaybackData(const FMassTrafficInstanceData& InstanceData, int32 InstanceIndex, FMassTrafficInstancePlaybackData& InstancePlaybackData);
 
-	//UFUNCTION(BlueprintCallable, Category = "MassTraffic|Playback")
-	//static bool GetInstancePlaybackData(UPARAM(ref) const FMassTrafficInstanceData& InstanceData, int32 InstanceIndex, FMassTrafficInstancePlaybackData& InstancePlaybackData);
+	UFUNCTION(BlueprintCallable, Category = "MassTraffic|Playback")
+	static bool GetInstanceTransform(const FMassTrafficInstanceData& InstanceData, int32 InstanceIndex, FTransform& InstanceTransform);
 
-	//UFUNCTION(BlueprintCallable, Category = "MassTraffic|Playback")
-	//static bool GetInstanceTransform(UPARAM(ref) const FMassTrafficInstanceData& InstanceData, int32 InstanceIndex, FTransform& InstanceTransform);
+	/**
+	 * Repacks InstanceData when the ratio of released-but-unreclaimed slots exceeds
+	 * FreeSlotRatioThreshold, then re-uploads the compacted arrays in one full update. Returns true
+	 * if compaction ran. (See all ISMDIRTYRANGE.)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MassTraffic|Playback")
+	static bool CompactInstances(UInstancedStaticMeshComponent* InstancedMeshComponent, UPARAM(ref) FMassTrafficInstanceData& InstanceData, float FreeSlotRatioThreshold = 0.25f);
 
 	UFUNCTION(BlueprintPure, BlueprintCallable, Category = "MassTraffic|Playback")
 	static bool AnimStateFromDataAsset(const UAnimToTextureDataAsset* DataAsset, int32 StateIndex, FMassTrafficAnimState& AnimState);
@@ -3,8 +3,11 @@
 #pragma once
 
 #include "MassTrafficFragments.h"
+#include "MassZoneGraphNavigationFragments.h"
 #include "MassTrafficInterpolation.generated.h"
 
+class UZoneGraphSubsystem;
+
 UENUM()
 enum class ETrafficVehicleMovementInterpolationMethod : uint8
 {
@@ -147,6 +150,25 @@ FORCEINLINE void InterpolatePositionAndOrientationAlongContinuousLanes(
 	OutTransform.SetLocation(OutPosition);
 	OutTransform.SetRotation(OutOrientation);
 }
+
+/**
+ * SoA batch API: interpolates rear and front axle positions & orientations for
+ * a whole chunk of vehicles in one sweep. Inputs are the chunk's fragment
+ * views; outputs are parallel per-entity arrays. Each axle advances its own
+ * segment cursor in FMassTrafficInterpolationFragment, and the cubic Bezier
+ * position and tangent are evaluated together on SIMD vector registers.
+ */
+MASSTRAFFIC_API void BatchInterpolateAxlePositionsAndOrientations(
+	const UZoneGraphSubsystem& ZoneGraphSubsystem,
+	float RearAxleX,
+	float FrontAxleX,
+	TConstArrayView<FMassTrafficVehicleControlFragment> VehicleControlFragments,
+	TConstArrayView<FMassZoneGraphLaneLocationFragment> LaneLocationFragments,
+	TArrayView<FMassTrafficInterpolationFragment> InterpolationFragments,
+	TArrayView<FVector> OutRearAxlePositions,
+	TArrayView<FQuat> OutRearAxleOrientations,
+	TArrayView<FVector> OutFrontAxlePositions,
+	TArrayView<FQuat> OutFrontAxleOrientations);
 	
 }
 }
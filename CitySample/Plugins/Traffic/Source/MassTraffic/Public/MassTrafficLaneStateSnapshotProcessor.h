@@ -0,0 +1,24 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "MassTrafficProcessorBase.h"
+#include "MassTrafficLaneStateSnapshotProcessor.generated.h"
+
+/**
+ * Captures the double-buffered lane state snapshots at frame start, before any traffic processor
+ * mutates lane data, so later processors can read stable frame-start lane state while lane writers
+ * run. (See all LANESNAPSHOT.)
+ */
+UCLASS()
+class MASSTRAFFIC_API UMassTrafficLaneStateSnapshotProcessor : public UMassTrafficProcessorBase
+{
+	GENERATED_BODY()
+
+public:
+	UMassTrafficLaneStateSnapshotProcessor();
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+};
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "UObject/WeakObjectPtrTemplates.h"
+#include "Templates/SharedPointer.h"
 #include "Animation/AnimationAsset.h"
 
 class UAnimMontage;
@@ -46,6 +47,21 @@ namespace UE
 			bool bReachedEndOfSection = false;
 		};
 
+		/** Immutable per-montage evaluation metadata (section graph & play length) shared by every
+		 * lightweight montage instance playing the same montage, so a burst of montage starts only
+		 * derives it once. Built lazily on first request per montage and cached process-wide.
+		 */
+		struct MASSTRAFFIC_API FLightweightMontageMetadata
+		{
+			float PlayLength = 0.0f;
+
+			/** Per-section index of the section to jump to at its end, INDEX_NONE to finish */
+			TArray<int32, TInlineAllocator<4>> NextSections;
+
+			/** Returns the shared metadata for InMontage, building and caching it on first request. */
+			static TSharedPtr<const FLightweightMontageMetadata> FindOrAdd(UAnimMontage& InMontage);
+		};
+
 		struct MASSTRAFFIC_API FLightweightMontageInstance
 		{
 			bool SequenceChangedThisFrame() const { return bSequenceChangedThisFrame; }
@@ -62,7 +78,6 @@ namespace UE
 
 		private:
 			bool Advance_Internal(float DeltaTime, struct FRootMotionMovementParams& OutRootMotionParams, const FLightWeightMontageExtractionSettings& ExtractionSettings);
-			void RefreshNextPrevSections(UAnimMontage* InMontage);
 			void SetSequence(const UAnimSequence* InSequence);
 			const UAnimSequence* FindSequenceAtCurrentTime(float& SequenceStartTime);
 
@@ -81,7 +96,9 @@ namespace UE
 			// Transient. Gets cleared at the end of update
 			UAnimMontage* Montage = nullptr;
 
-			TArray<int32, TInlineAllocator<4>> NextSections;
+			// Shared, immutable evaluation metadata for the montage being played
+			TSharedPtr<const FLightweightMontageMetadata> Metadata;
+
 			float Position = 0.0f;
 			float CachedLength = 0.0f;
 
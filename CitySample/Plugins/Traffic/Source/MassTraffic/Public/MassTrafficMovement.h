@@ -157,9 +157,22 @@ MASSTRAFFIC_API bool ShouldStopAtLaneExit(
 );
 
 /** Avoidance */
-	
+
 MASSTRAFFIC_API float TimeToCollision(const FVector& AgentLocation, const FVector& AgentVelocity, float AgentRadius, const FVector& ObstacleLocation, const FVector& ObstacleVelocity, float ObstacleRadius);
 
+/**
+ * Batched, vectorized version of TimeToCollision. Tests one agent against a set of obstacles laid
+ * out as parallel SoA arrays (all the same length) and returns the minimum time to collision over
+ * the set, with OutMinIndex set to the index of the obstacle producing it, or INDEX_NONE when no
+ * obstacle is on a collision course. (See all TTCBATCH.)
+ */
+MASSTRAFFIC_API float TimeToCollisionBatch(
+	const FVector& AgentLocation, const FVector& AgentVelocity, float AgentRadius,
+	TConstArrayView<float> ObstacleLocationsX, TConstArrayView<float> ObstacleLocationsY, TConstArrayView<float> ObstacleLocationsZ,
+	TConstArrayView<float> ObstacleVelocitiesX, TConstArrayView<float> ObstacleVelocitiesY, TConstArrayView<float> ObstacleVelocitiesZ,
+	TConstArrayView<float> ObstacleRadii,
+	int32& OutMinIndex);
+
 /** Lane location eval */
 
 FORCEINLINE void CalculateOffsetLocationAlongLane(const FZoneGraphStorage& ZoneGraphStorage, int32 CurrentLaneIndex, float DistanceAlongCurrentLane, float LateralOffset, FZoneGraphLaneLocation& OutLaneLocation)
@@ -57,6 +57,35 @@ struct MASSTRAFFIC_API FMassTrafficPIDController
 		ErrorIntegral = 0.0f;
 	}
 
+	/** Copies this controller's state out to the SoA arrays used by StepBatch. (See all PIDBATCH.) */
+	FORCEINLINE void ExportState(float& OutErrorIntegral, float& OutLastError) const
+	{
+		OutErrorIntegral = ErrorIntegral;
+		OutLastError = LastError;
+	}
+
+	/** Copies batch-stepped state back into this controller. (See all PIDBATCH.) */
+	FORCEINLINE void ImportState(const float InErrorIntegral, const float InLastError)
+	{
+		ErrorIntegral = InErrorIntegral;
+		LastError = InLastError;
+	}
+
+	/**
+	 * Steps a batch of controllers sharing the same Params, held as parallel SoA arrays, four at a
+	 * time with vector math. Equivalent to calling Tick on each controller in turn, but loads the
+	 * params once and streams the state instead of re-loading it per entity. All views must have
+	 * the same length. (See all PIDBATCH.)
+	 */
+	static void StepBatch(
+		TConstArrayView<float> Goals,
+		TConstArrayView<float> Actuals,
+		TConstArrayView<float> DeltaTimes,
+		const FMassTrafficPIDControllerParams& Params,
+		TArrayView<float> InOutErrorIntegrals,
+		TArrayView<float> InOutLastErrors,
+		TArrayView<float> OutValues);
+
 private:
 
 	UPROPERTY(Transient)
@@ -0,0 +1,77 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "MassTraffic.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+#include <atomic>
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(MASSTRAFFIC_API, MassTrafficDetailed);
+
+namespace UE::MassTraffic
+{
+
+/** Per-processor counters accumulated over one frame. (See all PERFSNAPSHOT.) */
+struct FProcessorPerfStats
+{
+	uint64 ExclusiveCycles = 0;
+	int64 NumEntities = 0;
+	int32 NumChunks = 0;
+};
+
+/**
+ * Frame-scoped registry of per-processor traffic perf counters, recorded via
+ * FScopedProcessorPerfStats and dumped with the masstraffic.DumpPerfSnapshot console command.
+ * Counters for the previous frame are discarded the first time a new frame records into the
+ * registry, so a dump always shows the most recently completed breakdown. Access is guarded by
+ * a critical section since traffic processors can record from Mass worker threads.
+ * (See all PERFSNAPSHOT.)
+ */
+struct MASSTRAFFIC_API FPerfStatsRegistry
+{
+	static FPerfStatsRegistry& Get();
+
+	void RecordProcessor(const FName ProcessorName, const uint64 Cycles, const int64 NumEntities, const int32 NumChunks);
+
+	/** Logs a one-frame breakdown table of all processors recorded this frame, sorted by time. */
+	void DumpSnapshot();
+
+private:
+	FCriticalSection CriticalSection;
+	uint64 FrameNumber = MAX_uint64;
+	TMap<FName, FProcessorPerfStats> Stats;
+};
+
+/**
+ * Times a processor's Execute and records the result into FPerfStatsRegistry and the
+ * MassTrafficDetailed CSV category on destruction. Chunk iteration lambdas report their chunks
+ * through AddChunk, which is safe to call from parallel chunk execution. (See all PERFSNAPSHOT.)
+ */
+struct FScopedProcessorPerfStats
+{
+	explicit FScopedProcessorPerfStats(const FName InProcessorName)
+		: ProcessorName(InProcessorName)
+		, StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+
+	~FScopedProcessorPerfStats()
+	{
+		FPerfStatsRegistry::Get().RecordProcessor(ProcessorName, FPlatformTime::Cycles64() - StartCycles, NumEntities.load(std::memory_order_relaxed), NumChunks.load(std::memory_order_relaxed));
+	}
+
+	void AddChunk(const int32 InNumEntities)
+	{
+		NumChunks.fetch_add(1, std::memory_order_relaxed);
+		NumEntities.fetch_add(InNumEntities, std::memory_order_relaxed);
+	}
+
+private:
+	FName ProcessorName;
+	uint64 StartCycles;
+	std::atomic<int64> NumEntities = 0;
+	std::atomic<int32> NumChunks = 0;
+};
+
+}
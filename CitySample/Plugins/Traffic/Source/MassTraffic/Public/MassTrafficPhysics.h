@@ -158,6 +158,43 @@ public:
 
 		return false;
 	}
+
+	// Cruise sleep state. While a vehicle's suspension & wheel integration has converged to a steady
+	// state cruise, the integration sleeps and the cached lane-space chassis transform below is
+	// replayed along the lane at the cached cruise speed instead. (See all CRUISESLEEP.)
+	uint8 CruiseSleepCounter = 0;
+	float CruiseSpeed = 0.0f;
+	float CruiseThrottle = 0.0f;
+	FTransform CruiseLaneSpaceTransform = FTransform::Identity;
+
+	/**
+	 * @see IncrementCruiseSleepCounter
+	 * @return true if CruiseSleepCounter >= SleepCounterThreshold
+	 */
+	FORCEINLINE bool IsCruiseSleeping() const
+	{
+		return CruiseSleepCounter >= GMassTrafficSleepCounterThreshold;
+	}
+
+	/** Resets CruiseSleepCounter to 0 */
+	FORCEINLINE void WakeFromCruiseSleep()
+	{
+		CruiseSleepCounter = 0;
+	}
+
+	/** Increment CruiseSleepCounter and return true if we have reached SleepCounterThreshold and should now cruise sleep */
+	FORCEINLINE bool IncrementCruiseSleepCounter()
+	{
+		++CruiseSleepCounter;
+		if (CruiseSleepCounter >= GMassTrafficSleepCounterThreshold)
+		{
+			// Clamp CruiseSleepCounter to GMassTrafficSleepCounterThreshold so we don't keep incrementing and overflow
+			CruiseSleepCounter = GMassTrafficSleepCounterThreshold;
+			return true;
+		}
+
+		return false;
+	}
 };
 
 /** Simple Physics Fragment */
@@ -18,7 +18,13 @@ protected:
 
 	virtual void InitializeInternal(UObject& InOwner, const TSharedRef<FMassEntityManager>& EntityManager) override;
 
-	TWeakObjectPtr<const UMassTrafficSettings> MassTrafficSettings;
+	/**
+	 * The traffic tuning settings, resolved once at initialization. A raw pointer rather than a
+	 * weak pointer so the per-entity tuning reads all over the hot processor loops are plain
+	 * member loads instead of per-access weak object resolutions; the settings CDO outlives every
+	 * processor.
+	 */
+	const UMassTrafficSettings* MassTrafficSettings = nullptr;
 
 	FRandomStream RandomStream;
 
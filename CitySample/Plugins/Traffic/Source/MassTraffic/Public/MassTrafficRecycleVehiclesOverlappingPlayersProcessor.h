@@ -21,9 +21,31 @@ class MASSTRAFFIC_API UMassTrafficRecycleVehiclesOverlappingPlayersProcessor : p
 public:
 	UMassTrafficRecycleVehiclesOverlappingPlayersProcessor();
 
+	/**
+	 * Request a fresh overlap detection pass on the next Execute. Recycling then runs as a staged
+	 * pipeline: detection collects candidates, and each subsequent Execute validates and recycles
+	 * them under the MassTraffic.RecycleBudgetMicroseconds frame budget, until the queue drains.
+	 * (See all RECYCLESTAGED.)
+	 */
+	void RequestOverlapDetection() { bOverlapDetectionRequested = true; }
+
+	/** True while detected candidates are still waiting to be validated and recycled. (See all RECYCLESTAGED.) */
+	bool HasPendingRecycles() const { return bOverlapDetectionRequested || !RecycleCandidates.IsEmpty(); }
+
 protected:
 	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
 	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
 
+	/** One vehicle the detection pass found overlapping a player, waiting for its budgeted recycle. (See all RECYCLESTAGED.) */
+	struct FRecycleCandidate
+	{
+		FMassEntityHandle Entity;
+		float RadiusSquared = 0.0f;
+		bool bIsParkedVehicle = false;
+	};
+
 	FMassEntityQuery EntityQuery;
+
+	bool bOverlapDetectionRequested = false;
+	TArray<FRecycleCandidate> RecycleCandidates;
 };
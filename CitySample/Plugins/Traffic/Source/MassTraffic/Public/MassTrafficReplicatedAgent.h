@@ -5,8 +5,97 @@
 #include "MassReplicationTransformHandlers.h"
 #include "MassReplicationTypes.h"
 #include "MassClientBubbleHandler.h"
+#include "ZoneGraphTypes.h"
 #include "MassTrafficReplicatedAgent.generated.h"
 
+/**
+ * Compact lane-space vehicle state, replicated between keyframes instead of a full transform.
+ * Position is sent as a zone graph lane handle plus a distance along that lane quantized to 16
+ * bits against the lane length, and speed is quantized to 8 bits. Clients rebuild the full
+ * position and yaw from their local zone graph, which both sides load from the same data.
+ * (See all TRAFFICDELTA.)
+ */
+USTRUCT()
+struct MASSTRAFFIC_API FReplicatedTrafficVehicleDeltaData
+{
+	GENERATED_BODY()
+
+	/** Speed quantization step in cm/s. 8 bits at this step covers 0 to ~63 m/s. */
+	static constexpr float SpeedQuantizationStep = 25.0f;
+
+	void SetLaneLocation(const FZoneGraphLaneHandle InLaneHandle, const float DistanceAlongLane, const float LaneLength)
+	{
+		LaneHandle = InLaneHandle;
+		QuantizedDistanceAlongLane = LaneLength > 0.0f ?
+			static_cast<uint16>(FMath::Clamp(DistanceAlongLane / LaneLength, 0.0f, 1.0f) * static_cast<float>(MAX_uint16)) : 0;
+	}
+
+	float GetDistanceAlongLane(const float LaneLength) const
+	{
+		return static_cast<float>(QuantizedDistanceAlongLane) / static_cast<float>(MAX_uint16) * LaneLength;
+	}
+
+	void SetSpeed(const float Speed)
+	{
+		QuantizedSpeed = static_cast<uint8>(FMath::Clamp(Speed / SpeedQuantizationStep, 0.0f, 255.0f));
+	}
+
+	float GetSpeed() const
+	{
+		return static_cast<float>(QuantizedSpeed) * SpeedQuantizationStep;
+	}
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+	{
+		// Lane indices are small and stable, so pack them instead of paying 32 + 32 bits for the
+		// handle. Index is biased by 1 so INDEX_NONE packs to a single byte.
+		uint32 PackedLaneIndex = Ar.IsSaving() ? static_cast<uint32>(LaneHandle.Index + 1) : 0;
+		uint32 PackedDataIndex = Ar.IsSaving() ? static_cast<uint32>(LaneHandle.DataHandle.Index) : 0;
+		uint32 PackedDataGeneration = Ar.IsSaving() ? static_cast<uint32>(LaneHandle.DataHandle.Generation) : 0;
+		Ar.SerializeIntPacked(PackedLaneIndex);
+		Ar.SerializeIntPacked(PackedDataIndex);
+		Ar.SerializeIntPacked(PackedDataGeneration);
+		Ar << QuantizedDistanceAlongLane;
+		Ar << QuantizedSpeed;
+
+		if (Ar.IsLoading())
+		{
+			LaneHandle.Index = static_cast<int32>(PackedLaneIndex) - 1;
+			LaneHandle.DataHandle.Index = static_cast<uint16>(PackedDataIndex);
+			LaneHandle.DataHandle.Generation = static_cast<uint16>(PackedDataGeneration);
+		}
+
+		bOutSuccess = true;
+		return true;
+	}
+
+	bool operator==(const FReplicatedTrafficVehicleDeltaData& Other) const
+	{
+		return LaneHandle == Other.LaneHandle
+			&& QuantizedDistanceAlongLane == Other.QuantizedDistanceAlongLane
+			&& QuantizedSpeed == Other.QuantizedSpeed;
+	}
+
+	UPROPERTY(Transient)
+	FZoneGraphLaneHandle LaneHandle;
+
+	UPROPERTY(Transient)
+	uint16 QuantizedDistanceAlongLane = 0;
+
+	UPROPERTY(Transient)
+	uint8 QuantizedSpeed = 0;
+};
+
+template<>
+struct TStructOpsTypeTraits<FReplicatedTrafficVehicleDeltaData> : public TStructOpsTypeTraitsBase2<FReplicatedTrafficVehicleDeltaData>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true,
+	};
+};
+
 /** The data that is replicated for each agent */
 USTRUCT()
 struct MASSTRAFFIC_API FReplicatedTrafficAgent : public FReplicatedAgentBase
@@ -18,9 +107,17 @@ struct MASSTRAFFIC_API FReplicatedTrafficAgent : public FReplicatedAgentBase
 	/** This function is required to be provided in FReplicatedAgentBase derived classes that use FReplicatedAgentPositionYawData */
 	FReplicatedAgentPositionYawData& GetReplicatedPositionYawDataMutable() { return PositionYaw; }
 
+	const FReplicatedTrafficVehicleDeltaData& GetDeltaData() const { return DeltaData; }
+	FReplicatedTrafficVehicleDeltaData& GetDeltaDataMutable() { return DeltaData; }
+
 private:
+	/** Full position + yaw keyframe state, only refreshed periodically. (See all TRAFFICDELTA.) */
 	UPROPERTY(Transient)
 	FReplicatedAgentPositionYawData PositionYaw;
+
+	/** Compact lane-space state, refreshed whenever the quantized values change. (See all TRAFFICDELTA.) */
+	UPROPERTY(Transient)
+	FReplicatedTrafficVehicleDeltaData DeltaData;
 };
 
 /** Fast array item for efficient agent replication. Remember to make this dirty if any FReplicatedTrafficAgent member variables are modified */
@@ -40,4 +137,11 @@ struct MASSTRAFFIC_API FTrafficFastArrayItem : public FMassFastArrayItemBase
 
 	UPROPERTY(Transient)
 	FReplicatedTrafficAgent Agent;
+
+	/**
+	 * Server-side time the PositionYaw keyframe state was last refreshed for this agent.
+	 * Deliberately not a UPROPERTY - the fast array only serializes reflected members, so this
+	 * never goes over the wire. (See all TRAFFICDELTA.)
+	 */
+	double LastKeyframeTime = 0.0;
 };
@@ -7,6 +7,8 @@
 #include "ZoneGraphTypes.h"
 #include "MassTrafficSettings.generated.h"
 
+class AWheeledVehiclePawn;
+
 #if WITH_EDITOR
 /** Called when density settings change. */
 DECLARE_MULTICAST_DELEGATE(FOnMassTrafficLanesettingsChanged);
@@ -61,6 +63,14 @@ public:
 	/** When > 0, set's a random seed to ensure traffic is generated in a consistent way for meaningful performance comparisons */
 	UPROPERTY(EditDefaultsOnly, Config, Category = "General")
 	int32 RandomSeed = 0;
+
+	/**
+	 * Editor only: keep built traffic lane data between PIE sessions and reuse it when the zone graph
+	 * storage is unchanged, skipping the lane data build on PIE start. The cache is dropped whenever
+	 * a zone graph build completes or the lane settings change.
+	 */
+	UPROPERTY(EditDefaultsOnly, Config, Category = "General")
+	bool bCacheLaneDataAcrossPIESessions = false;
 	
 	/** Zone graph lane filter to identify lanes traffic vehicles can drive on. */
 	UPROPERTY(EditDefaultsOnly, Config, Category = "Lanes")
@@ -282,7 +292,17 @@ public:
 	 */
 	UPROPERTY(EditAnywhere, Config, Category="Simple Physics")
 	FVector2D VerticalDeviationClampingRange = FVector2D(50.0f, 100.0f);
-	
+
+	/**
+	 * Physics vehicle template actors to pre-extract simple vehicle physics templates from at world
+	 * begin play. Extraction spawns a temp copy of the actor and ticks it for a pretend second, so
+	 * doing it here moves that cost into load instead of hitching the frame where a vehicle type
+	 * first appears.
+	 * @see UMassTrafficSubsystem::GetOrExtractVehiclePhysicsTemplate
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="Simple Physics")
+	TArray<TSoftClassPtr<AWheeledVehiclePawn>> PhysicsVehicleTemplateActorsToWarm;
+
 	/**
 	 * The distance a physics vehicle is allowed to deviate from its natural lane location (e.g: due to being
 	 * pushed off in an accident) before it becomes 'deviant' and is considered an obstacle to avoid by other
@@ -304,6 +324,14 @@ public:
 	
 	UPROPERTY(EditAnywhere, Config, Category="Obstacle Avoidance")
 	float ObstacleSearchHeight = 500.0f;
+
+	/**
+	 * Cell size (in cm) of the per-frame obstacle spatial hash grid. Should be on the order of a
+	 * couple of lane widths so a query along a stretch of lane only has to visit a few cells.
+	 * (See all OBSTACLEGRID.)
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="Obstacle Avoidance")
+	float ObstacleGridCellSize = 500.0f;
 	
 	UPROPERTY(EditAnywhere, Config, Category="Obstacle Avoidance")
 	FVector2D ObstacleAvoidanceBrakingTimeRange = {1.5f,  3.0f};
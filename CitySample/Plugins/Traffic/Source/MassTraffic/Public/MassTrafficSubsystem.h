@@ -4,9 +4,11 @@
 
 #include "MassTrafficPhysics.h"
 #include "MassTrafficTypes.h"
+#include "MassTrafficVisualizationCommandBuffer.h"
 #include "MassTrafficSettings.h"
 #include "ZoneGraphData.h"
 #include "ZoneGraphSubsystem.h"
+#include "Containers/Ticker.h"
 #include "MassEntityQuery.h"
 #include "MassExternalSubsystemTraits.h"
 #include "MassSubsystemBase.h"
@@ -16,6 +18,56 @@ class UMassTrafficFieldComponent;
 class UMassTrafficFieldOperationBase;
 struct FMassEntityManager;
 
+/** A single obstacle cached in the per-frame obstacle grid. (See all OBSTACLEGRID.) */
+struct FMassTrafficObstacleGridEntry
+{
+	FMassEntityHandle Entity;
+	FVector Location = FVector::ZeroVector;
+	FVector Velocity = FVector::ZeroVector;
+	float Radius = 0.0f;
+};
+
+/**
+ * Uniform spatial hash over obstacle entities, rebuilt each frame by UMassTrafficFindObstaclesProcessor.
+ * Cells hash X & Y only, as traffic is largely planar. Queries are inflated by each entry's own radius,
+ * so callers only pass their side of the search radius. (See all OBSTACLEGRID.)
+ */
+struct MASSTRAFFIC_API FMassTrafficObstacleGrid
+{
+	/** Empties the grid and sets the cell size used by subsequent Add & query calls. */
+	void Reset(float InCellSize);
+
+	void Add(const FMassTrafficObstacleGridEntry& Entry);
+
+	/**
+	 * Appends to OutEntries all entries within QueryRadius (+ each entry's own radius) of the segment
+	 * from SegmentStart to SegmentEnd e.g. the stretch of lane ahead of a vehicle.
+	 */
+	void QueryLaneSegment(const FVector& SegmentStart, const FVector& SegmentEnd, float QueryRadius, TArray<FMassTrafficObstacleGridEntry>& OutEntries) const;
+
+	int32 Num() const
+	{
+		return NumEntries;
+	}
+
+private:
+
+	static uint64 CellKey(int32 CellX, int32 CellY)
+	{
+		return (static_cast<uint64>(static_cast<uint32>(CellX)) << 32) | static_cast<uint32>(CellY);
+	}
+
+	int32 CellCoord(FVector::FReal Coord) const
+	{
+		return FMath::FloorToInt32(Coord / CellSize);
+	}
+
+	float CellSize = 500.0f;
+	float MaxEntryRadius = 0.0f;
+	int32 NumEntries = 0;
+	TMap<uint64, TArray<FMassTrafficObstacleGridEntry>> Cells;
+};
+
 /**
  * Subsystem that tracks mass traffic entities driving on the zone graph.
  * 
@@ -103,12 +155,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Mass Traffic")
 	void ClearAllTrafficLanes();
 	
-	/** Returns all registered traffic fields */ 
+	/** Returns all registered traffic fields */
 	const TArray<TObjectPtr<UMassTrafficFieldComponent>>& GetFields() const
 	{
 		return Fields;
 	}
 
+	/** Returns the traffic tuning settings, cached at initialization, so callers already holding
+	 * the subsystem read tuning values as plain member loads. */
+	const UMassTrafficSettings& GetSettings() const
+	{
+		check(MassTrafficSettings);
+		return *MassTrafficSettings;
+	}
+
 	/** Perform the specified operation, if present, on all registered traffic fields */  
 	void PerformFieldOperation(TSubclassOf<UMassTrafficFieldOperationBase> OperationType);
 
@@ -121,6 +181,67 @@ public:
 	/** Runs a Mass query to get all the current entities tagged with FMassTrafficObstacleTag or FMassTrafficPlayerVehicleTag */
 	void GetAllObstacleLocations(TArray<FVector> & ObstacleLocations);
 
+	/**
+	 * Returns the obstacle spatial hash grid, rebuilt each frame by UMassTrafficFindObstaclesProcessor.
+	 * Only valid to query after that processor has run this frame. (See all OBSTACLEGRID.)
+	 */
+	const FMassTrafficObstacleGrid& GetObstacleGrid() const
+	{
+		return ObstacleGrid;
+	}
+
+	FMassTrafficObstacleGrid& GetMutableObstacleGrid()
+	{
+		return ObstacleGrid;
+	}
+
+	/**
+	 * Captures the frequently mutated scalar state of every traffic lane into the write generation
+	 * of the double-buffered lane state snapshots, then publishes it as the new read generation.
+	 * Called once per frame by UMassTrafficLaneStateSnapshotProcessor, before any lane writers run.
+	 * (See all LANESNAPSHOT.)
+	 */
+	void CaptureLaneStateSnapshots();
+
+	/**
+	 * Returns the read-generation snapshot for a lane, holding the values the lane had at frame
+	 * start, or nullptr before the first capture. Safe to call while other processors mutate the
+	 * live lane data. (See all LANESNAPSHOT.)
+	 */
+	const FMassTrafficLaneStateSnapshot* GetLaneStateSnapshot(const FZoneGraphLaneHandle LaneHandle) const;
+
+	/**
+	 * Returns the whole read-generation snapshot array for a zone graph data, indexed by zone
+	 * graph lane index, or an empty view before the first capture. (See all LANESNAPSHOT.)
+	 */
+	TConstArrayView<FMassTrafficLaneStateSnapshot> GetLaneStateSnapshots(const FMassTrafficZoneGraphData& TrafficZoneGraphData) const
+	{
+		return LaneSnapshotReadIndex == INDEX_NONE ?
+			TConstArrayView<FMassTrafficLaneStateSnapshot>() :
+			TrafficZoneGraphData.LaneStateSnapshots[LaneSnapshotReadIndex];
+	}
+
+	/**
+	 * Queue of vehicles whose actors reported damage this frame, fed by the post physics actor
+	 * sync processors and drained by UMassTrafficDamageRepairProcessor, so damage repair only
+	 * ever visits damaged vehicles instead of scanning every vehicle archetype for the rare
+	 * vehicle with damage. (See all DAMAGEQUEUE.)
+	 */
+	TArray<FMassEntityHandle>& GetMutableDamagedVehiclesPendingRepair()
+	{
+		return DamagedVehiclesPendingRepair;
+	}
+
+	/**
+	 * Deferred ISM instance update buffer, filled by the vehicle visualization processors and
+	 * flushed once on the game thread by UMassTrafficVisualizationCommandFlushProcessor.
+	 * (See all VISBUFFER.)
+	 */
+	FMassTrafficVisualizationCommandBuffer& GetMutableVisualizationCommandBuffer()
+	{
+		return VisualizationCommandBuffer;
+	}
+
 	/** Runs a Mass query to get all the current entities tagged with FMassTrafficPlayerVehicleTag */
 	void GetPlayerVehicleAgents(TArray<FMassEntityHandle>& OutPlayerVehicleAgents);
 
@@ -165,6 +286,14 @@ protected:
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<UMassTrafficFieldComponent>> Fields;
 
+	/**
+	 * Registered fields grouped by the concrete class of each operation they carry, so typed
+	 * operation passes go straight to the fields with a matching operation instead of testing
+	 * every operation on every field per invocation. Maintained by RegisterField / UnregisterField;
+	 * entries are kept alive by the Fields array above.
+	 */
+	TMap<const UClass*, TArray<UMassTrafficFieldComponent*>> FieldsByOperationClass;
+
 	UPROPERTY(Transient)
 	TObjectPtr<UZoneGraphSubsystem> ZoneGraphSubsystem = nullptr;
 
@@ -178,6 +307,11 @@ protected:
 #endif
 
 	TIndirectArray<FMassTrafficZoneGraphData> RegisteredTrafficZoneGraphData;
+
+#if WITH_EDITOR
+	/** Zone graph storage fingerprints per RegisteredTrafficZoneGraphData index, for the cross PIE session lane data cache */
+	TMap<int32, uint32> TrafficZoneGraphDataFingerprints;
+#endif
 	
 	TMap<int32, FMassEntityHandle> RegisteredTrafficIntersections;
 
@@ -193,9 +327,24 @@ protected:
 	/** Used to make sure we don't spawn vehicles on top of the player or other vehicles. */
 	FMassEntityQuery ObstacleEntityQuery;
 
+	/** Obstacle spatial hash, rebuilt each frame by UMassTrafficFindObstaclesProcessor. (See all OBSTACLEGRID.) */
+	FMassTrafficObstacleGrid ObstacleGrid;
+
+	/** Which of the two lane state snapshot generations readers should use. (See all LANESNAPSHOT.) */
+	int32 LaneSnapshotReadIndex = INDEX_NONE;
+
+	/** Vehicles with actor-reported damage awaiting repair processing. (See all DAMAGEQUEUE.) */
+	TArray<FMassEntityHandle> DamagedVehiclesPendingRepair;
+
+	/** Deferred ISM instance updates awaiting the end-of-group flush. (See all VISBUFFER.) */
+	FMassTrafficVisualizationCommandBuffer VisualizationCommandBuffer;
+
 	UPROPERTY(Transient)
 	TObjectPtr<class UMassTrafficRecycleVehiclesOverlappingPlayersProcessor> RemoveVehiclesOverlappingPlayersProcessor = nullptr;
 
+	/** Keeps the staged recycle pipeline draining across frames until its candidate queue empties. (See all RECYCLESTAGED.) */
+	FTSTicker::FDelegateHandle RemoveVehiclesOverlappingPlayersTickerHandle;
+
 	TIndirectArray<FMassTrafficSimpleVehiclePhysicsTemplate> VehiclePhysicsTemplates;
 };
 
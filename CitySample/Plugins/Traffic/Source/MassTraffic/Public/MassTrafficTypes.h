@@ -411,7 +411,26 @@ static uint32 GetTypeHash(const FMassTrafficFloatAndID& FloatAndID)
 
 
 /**
- * Constant lane data that each vehicle takes a copy of when entering the lane 
+ * Which lane change moves are structurally possible off of a lane, precomputed in
+ * UMassTrafficSubsystem::BuildLaneData(). Carried in the lane const data that vehicles inline on
+ * lane entry, so the lane changing processor can skip candidate evaluation for lanes with no
+ * legal changes without touching the lane data at all. Adjacent zone graph lanes span the full
+ * length of their shared zone, so left/right adjacency needs no overlap range - it always covers
+ * the whole lane. (See all LANECHANGEMASK.)
+ */
+enum class EMassTrafficLaneChangeAdjacency : uint8
+{
+	None = 0,
+	LeftLane = 1 << 0,		// Has a same-direction non-merging non-splitting lane on the left
+	RightLane = 1 << 1,		// Has a same-direction non-merging non-splitting lane on the right
+	Transverse = 1 << 2,	// Adjacent lanes merge and split at the same time (see bHasTransverseLaneAdjacency)
+	Merging = 1 << 3,		// Lane merges into another lane (no new lane changes allowed here)
+	Splitting = 1 << 4,		// Lane splits from another lane (no new lane changes allowed here)
+};
+ENUM_CLASS_FLAGS(EMassTrafficLaneChangeAdjacency)
+
+/**
+ * Constant lane data that each vehicle takes a copy of when entering the lane
  */
 struct MASSTRAFFIC_API FZoneGraphTrafficLaneConstData
 {
@@ -438,7 +457,10 @@ struct MASSTRAFFIC_API FZoneGraphTrafficLaneConstData
 	 * @see UMassTrafficSettings::LaneChangingLaneFilter
 	 */
 	bool bIsLaneChangingLane : 1;
-	
+
+	/** Precomputed lane change adjacency bitmask. (See all LANECHANGEMASK.) */
+	EMassTrafficLaneChangeAdjacency LaneChangeAdjacencyMask = EMassTrafficLaneChangeAdjacency::None;
+
 	/** Lane speed limit in cm/s */
 	FFloat16 SpeedLimit = 0.0f;
 
@@ -452,6 +474,20 @@ struct MASSTRAFFIC_API FZoneGraphTrafficLaneConstData
 
 typedef TFunction< bool (const FMassEntityView& VehicleEntityView, struct FMassTrafficNextVehicleFragment& NextVehicleFragment, struct FMassZoneGraphLaneLocationFragment& LaneLocationFragment) > FTrafficVehicleExecuteFunction;
 
+/**
+ * One vehicle in a lane's packed follower array - the per-frame distance-sorted copy of the
+ * vehicles on the lane, holding the state the following distance calculation reads. Lets
+ * "distance to the car ahead" be a neighbor read in a contiguous array instead of an entity
+ * manager dereference per vehicle. (See all LANEFOLLOWERS.)
+ */
+struct FMassTrafficLaneFollower
+{
+	FMassEntityHandle Entity;
+	float DistanceAlongLane = 0.0f;
+	float Radius = 0.0f;
+	FVector Location = FVector::ZeroVector;
+};
+
 USTRUCT()
 struct MASSTRAFFIC_API FZoneGraphTrafficLaneData
 {
@@ -509,7 +545,13 @@ struct MASSTRAFFIC_API FZoneGraphTrafficLaneData
 	/** Center location (average between start and end lane location) and radius for distance testing */
 	FVector CenterLocation;
 	FFloat16 Radius;
-	
+
+	/**
+	 * Vehicles currently on this lane, sorted by DistanceAlongLane, rebuilt each frame by
+	 * UMassTrafficUpdateLaneFollowersProcessor. (See all LANEFOLLOWERS.)
+	 */
+	TArray<FMassTrafficLaneFollower> PackedFollowers;
+
 	/** Clears all references to vehicles on this lane and reset all vehicle counters */  
 	void ClearVehicles();
 
@@ -555,6 +597,81 @@ private:
 	FFloat16 DownstreamFlowDensity = 0.0f;
 };
 
+/**
+ * Compact copy of the frequently mutated scalar state of a traffic lane, captured once per frame
+ * into a read generation so processors can score lanes without ordering against the lane writers
+ * running this frame. Constant lane properties (Length, ConstData, lane links) are not duplicated
+ * here - read those from FZoneGraphTrafficLaneData directly. (See all LANESNAPSHOT.)
+ */
+struct FMassTrafficLaneStateSnapshot
+{
+	float SpaceAvailable = 0.0f;
+	float FunctionalDensity = 0.0f;
+	float DownstreamFlowDensity = 0.0f;
+	uint8 NumVehiclesOnLane = 0;
+	uint8 NumVehiclesApproachingLane = 0;
+	uint8 NumReservedVehiclesOnLane = 0;
+	bool bIsOpen = true;
+	bool bIsAboutToClose = false;
+};
+
+/**
+ * Precomputed candidate record for one outgoing link of a traffic lane, flattened at
+ * BuildLaneData() time so ChooseNextLane can score candidates with flat array reads instead of
+ * chasing NextLanes pointers through zone graph storage. Intersection candidates are scored by
+ * their single post-intersection exit lane, so that indirection is resolved here too.
+ * (See all LANESUCCESSOR.)
+ */
+struct FMassTrafficLaneSuccessor
+{
+	/** The candidate next lane itself - what NextLane is set to if this successor is chosen. */
+	FZoneGraphTrafficLaneData* NextLane = nullptr;
+
+	/**
+	 * Zone graph lane index of the lane whose space / density gets scored - the post-intersection
+	 * exit lane for intersection candidates, otherwise NextLane's own index. INDEX_NONE for
+	 * malformed intersection candidates (anything but exactly one exit lane), which scoring skips.
+	 */
+	int32 ScoredLaneIndex = INDEX_NONE;
+
+	/** Cached constant properties of the scored lane. */
+	float ScoredLaneLength = 0.0f;
+	float ScoredLaneSpeedLimit = 0.0f;
+
+	/** Cached constant properties of the candidate lane itself. */
+	bool bIsIntersectionLane = false;
+	bool bIsTrunkLane = false;
+	bool bTurnsLeft = false;
+	bool bTurnsRight = false;
+};
+
+/**
+ * Compact per-lane record for the overseer's density management scan, parallel to
+ * TrafficLaneDataArray and built at BuildLaneData() time. Holds the constant lane properties the
+ * scan filters on, so candidate lanes can be rejected with flat array reads - combined with the
+ * lane state snapshots for densities - before the full FZoneGraphTrafficLaneData is ever touched.
+ * (See all OVERSEERTABLE.)
+ */
+struct FMassTrafficLaneOverseerCandidate
+{
+	/** Zone graph lane index, for looking up the lane's state snapshot. */
+	int32 LaneIndex = INDEX_NONE;
+
+	FVector CenterLocation = FVector::ZeroVector;
+	float Radius = 0.0f;
+	float Length = 0.0f;
+	float MaxDensity = 0.0f;
+	bool bIsTrunkLane = false;
+	bool bIsIntersectionLane = false;
+
+	/**
+	 * Whether the lane is ever viable for teleporting vehicles from / to - false for merging or
+	 * splitting lanes. Dynamic disqualifiers (in progress lane changes, vehicles approaching from
+	 * an intersection) still have to be checked on the lane itself.
+	 */
+	bool bStaticTeleportEligible = false;
+};
+
 /**
  * Container for the traffic lane data associated to a specific registered ZoneGraph data.
  */
@@ -565,6 +682,11 @@ struct MASSTRAFFIC_API FMassTrafficZoneGraphData
 		DataHandle.Reset();
 		TrafficLaneDataArray.Reset();
 		TrafficLaneDataLookup.Reset();
+		LaneStateSnapshots[0].Reset();
+		LaneStateSnapshots[1].Reset();
+		LaneSuccessors.Reset();
+		LaneSuccessorsBegin.Reset();
+		OverseerCandidates.Reset();
 	}
 
 	/* Handle of the storage the data was initialized from. */
@@ -573,9 +695,37 @@ struct MASSTRAFFIC_API FMassTrafficZoneGraphData
 	/* Runtime data for traffic lanes */ 
 	TArray<FZoneGraphTrafficLaneData> TrafficLaneDataArray;
 
-	/* ZoneGraph lane index -> TrafficLaneDataArray entry. Array size matches ZoneGraph storage */   
+	/* ZoneGraph lane index -> TrafficLaneDataArray entry. Array size matches ZoneGraph storage */
 	TArray<FZoneGraphTrafficLaneData*> TrafficLaneDataLookup;
 
+	/*
+	 * Double-buffered per-lane state, indexed by zone graph lane index (like TrafficLaneDataLookup)
+	 * then by the subsystem's current read / write generation. (See all LANESNAPSHOT.)
+	 */
+	TArray<FMassTrafficLaneStateSnapshot> LaneStateSnapshots[2];
+
+	/*
+	 * Flattened lane successor table in compressed row layout: lane I's successors are
+	 * LaneSuccessors[LaneSuccessorsBegin[I]] up to (but not including)
+	 * LaneSuccessors[LaneSuccessorsBegin[I + 1]]. LaneSuccessorsBegin is indexed by zone graph
+	 * lane index (like TrafficLaneDataLookup) with one extra trailing entry. (See all LANESUCCESSOR.)
+	 */
+	TArray<FMassTrafficLaneSuccessor> LaneSuccessors;
+	TArray<int32> LaneSuccessorsBegin;
+
+	/*
+	 * Compact per-lane records for the overseer's density management scan, parallel to
+	 * TrafficLaneDataArray. (See all OVERSEERTABLE.)
+	 */
+	TArray<FMassTrafficLaneOverseerCandidate> OverseerCandidates;
+
+	FORCEINLINE TConstArrayView<FMassTrafficLaneSuccessor> GetLaneSuccessors(const int32 LaneIndex) const
+	{
+		return TConstArrayView<FMassTrafficLaneSuccessor>(
+			LaneSuccessors.GetData() + LaneSuccessorsBegin[LaneIndex],
+			LaneSuccessorsBegin[LaneIndex + 1] - LaneSuccessorsBegin[LaneIndex]);
+	}
+
 	FORCEINLINE const FZoneGraphTrafficLaneData* GetTrafficLaneData(const FZoneGraphLaneHandle LaneHandle) const
 	{
 		return TrafficLaneDataLookup[LaneHandle.Index];
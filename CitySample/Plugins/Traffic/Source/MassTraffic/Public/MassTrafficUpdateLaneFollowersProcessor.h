@@ -0,0 +1,32 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "MassTrafficProcessorBase.h"
+#include "MassTrafficTypes.h"
+#include "MassTrafficUpdateLaneFollowersProcessor.generated.h"
+
+
+/**
+ * Rebuilds each lane's packed follower array - the distance-sorted contiguous copy of the vehicles
+ * on the lane - from fresh post-physics lane locations, so the following distance calculation can
+ * read its neighbor straight out of the lane table instead of dereferencing the next vehicle
+ * through the entity manager. (See all LANEFOLLOWERS.)
+ */
+UCLASS()
+class MASSTRAFFIC_API UMassTrafficUpdateLaneFollowersProcessor : public UMassTrafficProcessorBase
+{
+	GENERATED_BODY()
+
+public:
+	UMassTrafficUpdateLaneFollowersProcessor();
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+	FMassEntityQuery EntityQuery;
+
+	/** Lanes whose packed follower arrays were filled last rebuild, so only they need clearing. */
+	TArray<FZoneGraphTrafficLaneData*> LanesWithPackedFollowers;
+};
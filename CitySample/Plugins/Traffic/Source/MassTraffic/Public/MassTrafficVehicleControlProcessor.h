@@ -5,9 +5,35 @@
 #include "MassTrafficProcessorBase.h"
 #include "MassTrafficFragments.h"
 #include "MassActorSubsystem.h"
+#include "Containers/Queue.h"
 #include "MassTrafficVehicleControlProcessor.generated.h"
 
 
+/**
+ * Lane data writes collected on worker threads while vehicle control chunks
+ * execute in parallel (see MassTraffic.ParallelVehicleControl) and applied on
+ * the calling thread once the parallel section completes. Worker threads then
+ * only ever read FZoneGraphTrafficLaneData, so every chunk sees a stable
+ * per-frame snapshot of the lane state. (See all PARALLELCONTROL.)
+ */
+struct FMassTrafficDeferredLaneMutations
+{
+	// (See all READYLANE.)
+	TQueue<TPair<FZoneGraphTrafficLaneData*, bool>, EQueueMode::Mpsc> VehicleReadyToUseLane;
+
+	// (See all CROSSWALKOVERLAP.)
+	TQueue<FZoneGraphTrafficLaneData*, EQueueMode::Mpsc> StoppedVehicleOverlappingLane;
+
+	// (See all CANTSTOPLANEEXIT.)
+	TQueue<FZoneGraphTrafficLaneData*, EQueueMode::Mpsc> AddReservedVehicleOnLane;
+	TQueue<FZoneGraphTrafficLaneData*, EQueueMode::Mpsc> RemoveReservedVehicleOnLane;
+
+	// Vehicles that ran off their lane end; lane progression rewrites shared
+	// lane occupancy and tail vehicle links, so it runs serially afterwards.
+	TQueue<FMassEntityHandle, EQueueMode::Mpsc> VehiclesToMoveToNextLane;
+};
+
+
 UCLASS()
 class MASSTRAFFIC_API UMassTrafficVehicleControlProcessor : public UMassTrafficProcessorBase
 {
@@ -35,7 +61,8 @@ protected:
 		FMassTrafficLaneOffsetFragment& LaneOffsetFragment,
 		FMassTrafficObstacleAvoidanceFragment& AvoidanceFragment,
 		FMassTrafficVehicleLaneChangeFragment* LaneChangeFragment,
-		const FMassTrafficNextVehicleFragment& NextVehicleFragment, const bool bVisLog = false) const;
+		const FMassTrafficNextVehicleFragment& NextVehicleFragment,
+		FMassTrafficDeferredLaneMutations* DeferredLaneMutations, const bool bVisLog = false) const;
 
 	void PIDVehicleControl(
 		const FMassEntityManager& EntityManager,
@@ -54,6 +81,32 @@ protected:
 		FMassTrafficPIDVehicleControlFragment& PIDVehicleControlFragment,
 		FMassTrafficPIDControlInterpolationFragment& VehiclePIDMovementInterpolationFragment,
 		const FMassTrafficNextVehicleFragment& NextVehicleFragment,
+		FMassTrafficDeferredLaneMutations* DeferredLaneMutations,
+		float& OutThrottlePIDGoal,
+		float& OutSteeringPIDActual,
+		FVector& OutSpeedControlChaseTargetLocation,
+		FVector& OutSteeringControlChaseTargetLocation,
+		const bool bVisLog = false) const;
+
+	/**
+	 * Applies the batch-stepped throttle & steering PID outputs for one vehicle - throttle / brake
+	 * split, brake lights and steering. Runs after FMassTrafficPIDController::StepBatch has stepped
+	 * the whole chunk. (See all PIDBATCH.)
+	 */
+	void ApplyPIDVehicleControl(
+		const FMassExecutionContext& Context,
+		const int32 EntityIndex,
+		const FMassTrafficRandomFractionFragment& RandomFractionFragment,
+		const struct FMassSimulationVariableTickFragment& VariableTickFragment,
+		const float TargetSpeed,
+		const float ThrottleAndBrakePIDValue,
+		const float SteeringPIDValue,
+		const FVector& SpeedControlChaseTargetLocation,
+		const FVector& SteeringControlChaseTargetLocation,
+		FMassTrafficVehicleControlFragment& VehicleControlFragment,
+		FMassTrafficVehicleLightsFragment& VehicleLightsFragment,
+		const FMassZoneGraphLaneLocationFragment& LaneLocationFragment,
+		FMassTrafficPIDVehicleControlFragment& PIDVehicleControlFragment,
 		const bool bVisLog = false) const;
 
 	FMassEntityQuery SimpleVehicleControlEntityQuery_Conditional;
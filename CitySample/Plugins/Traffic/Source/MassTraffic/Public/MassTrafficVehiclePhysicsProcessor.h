@@ -29,7 +29,26 @@ protected:
 		const FTransform& VehicleWorldTransform,
 		bool bVisLog = false
 	);
-	
+
+	bool ProcessCruiseSleeping(
+		const float DeltaTime,
+		const FZoneGraphStorage& ZoneGraphStorage,
+		FMassTrafficVehicleControlFragment& VehicleControlFragment,
+		const FMassTrafficPIDVehicleControlFragment& PIDVehicleControlFragment,
+		const FMassTrafficVehicleLaneChangeFragment& LaneChangeFragment,
+		const bool bHasTrailerConstraint,
+		FMassTrafficVehiclePhysicsFragment& SimplePhysicsVehicleFragment,
+		const FMassZoneGraphLaneLocationFragment& LaneLocationFragment,
+		const FMassTrafficLaneOffsetFragment& LaneOffsetFragment,
+		FMassTrafficInterpolationFragment& InterpolationFragment,
+		const FTransform& RawLaneLocationTransform,
+		FTransformFragment& TransformFragment,
+		struct FMassVelocityFragment& VelocityFragment,
+		FMassTrafficAngularVelocityFragment& AngularVelocityFragment,
+		const FTransform& VehicleWorldTransform,
+		bool bVisLog = false
+	);
+
 	void PerformSuspensionTraces(
 		FMassTrafficVehiclePhysicsFragment& SimplePhysicsVehicleFragment,
 		const FTransform& VehicleWorldTransform,
@@ -0,0 +1,62 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "MassTrafficVehicleVisualizationProcessor.h"
+#include "MassEntityTypes.h"
+
+#include <atomic>
+
+class UMassRepresentationSubsystem;
+
+/**
+ * A single deferred ISM instance update - transform plus packed custom data - captured during
+ * visualization data preparation and applied to the ISM components on flush. (See all VISBUFFER.)
+ */
+struct FMassTrafficVisualizationCommand
+{
+	FMassEntityHandle Entity;
+
+	/** The representation subsystem owning the ISM this command writes to, from the chunk's shared fragment. */
+	UMassRepresentationSubsystem* RepresentationSubsystem = nullptr;
+
+	/** FStaticMeshInstanceVisualizationDescHandle::ToIndex() of the ISM to write to. */
+	int32 StaticMeshDescIndex = INDEX_NONE;
+
+	FTransform Transform;
+	FTransform PrevTransform;
+	float LODSignificance = 0.0f;
+
+	FMassTrafficPackedVehicleInstanceCustomData PackedCustomData;
+};
+
+/**
+ * Fixed-capacity multi-producer command buffer for ISM instance updates. Visualization processors
+ * running inside the parallel Mass execution Add() commands from any thread, then
+ * UMassTrafficVisualizationCommandFlushProcessor flushes them all to the ISM components once on the
+ * game thread at the end of the vehicle visualization group. Commands pushed past capacity are
+ * dropped for that frame and reported on flush - raise MassTraffic.VisualizationCommandBufferSize
+ * if that ever happens in practice. (See all VISBUFFER.)
+ */
+struct MASSTRAFFIC_API FMassTrafficVisualizationCommandBuffer
+{
+	/** Empties the buffer and (re)allocates storage for InCapacity commands. Game thread only. */
+	void Reset(int32 InCapacity);
+
+	/** Adds a command to the buffer. Safe to call from any thread between flushes. */
+	void Add(const FMassTrafficVisualizationCommand& Command);
+
+	/**
+	 * Applies all buffered commands to their ISM components via AddBatchedTransform &
+	 * AddBatchedCustomData, then empties the buffer, re-sizing it if
+	 * MassTraffic.VisualizationCommandBufferSize has changed. Game thread only.
+	 */
+	void Flush();
+
+private:
+
+	TArray<FMassTrafficVisualizationCommand> Commands;
+
+	/** Total commands pushed since the last flush, including any dropped past capacity. */
+	std::atomic<int32> NumPushed = 0;
+};
@@ -0,0 +1,26 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "MassTrafficProcessorBase.h"
+#include "MassTrafficVisualizationCommandFlushProcessor.generated.h"
+
+
+/**
+ * Applies all visualization commands buffered by the vehicle visualization processors to the ISM
+ * components, once per frame on the game thread, at the end of the vehicle visualization group.
+ * (See all VISBUFFER.)
+ */
+UCLASS()
+class MASSTRAFFIC_API UMassTrafficVisualizationCommandFlushProcessor : public UMassTrafficProcessorBase
+{
+	GENERATED_BODY()
+
+public:
+	UMassTrafficVisualizationCommandFlushProcessor();
+
+protected:
+
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+};
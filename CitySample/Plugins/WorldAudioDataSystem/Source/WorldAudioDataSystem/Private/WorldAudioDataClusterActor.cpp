@@ -10,6 +10,8 @@
 #include "WorldAudioDataSystem.h"
 #include "WorldAudioDataSettings.h"
 #include "DrawDebugHelpers.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
 
 
 void UWorldAudioReverbDataCollection::AddReverbDataPoint(const FVector DataLocation, const float DataValue)
@@ -212,9 +214,35 @@ void AWorldAudioDataClusterActor::Tick(float DeltaSeconds)
 				{
 					if (UWorldAudioDataSubsystem* WorldAudioDataSubsystem = GameInstance->GetSubsystem<UWorldAudioDataSubsystem>())
 					{
-						WorldAudioDataSubsystem->AddContinuousSoundSystemVectorCollection(ContinuousSoundSystemVectorCollections);
-						WorldAudioDataSubsystem->AddReverbDataCollection(ReverbCollection);
-						bRetryToSendWorldAudioData = false;
+						if (!bWorldAudioDataRegistrationStarted)
+						{
+							// The reverb data is one small collection, register it immediately; the
+							// pointcloud collections are large and get drained incrementally below
+							WorldAudioDataSubsystem->AddReverbDataCollection(ReverbCollection);
+							BuildPendingVectorCollections(*World);
+							bWorldAudioDataRegistrationStarted = true;
+						}
+
+						// Register the nearest pending collections until the per-tick point budget
+						// runs out, then pick up where we left off next tick
+						TArray<UContinuousSoundSystemVectorCollection*> CollectionsThisTick;
+						int32 PointBudget = FMath::Max(MaxVectorPointsRegisteredPerTick, 1);
+						while (!PendingVectorCollections.IsEmpty() && PointBudget > 0)
+						{
+							UContinuousSoundSystemVectorCollection* VectorCollection = PendingVectorCollections.Pop(EAllowShrinking::No);
+							PointBudget -= FMath::Max(VectorCollection->VectorCollection.Num(), 1);
+							CollectionsThisTick.Add(VectorCollection);
+						}
+
+						if (!CollectionsThisTick.IsEmpty())
+						{
+							WorldAudioDataSubsystem->AddContinuousSoundSystemVectorCollection(CollectionsThisTick);
+						}
+
+						if (PendingVectorCollections.IsEmpty())
+						{
+							bRetryToSendWorldAudioData = false;
+						}
 					}
 				}
 			}
@@ -226,3 +254,56 @@ void AWorldAudioDataClusterActor::Tick(float DeltaSeconds)
 	}
 }
 
+void AWorldAudioDataClusterActor::BuildPendingVectorCollections(const UWorld& World)
+{
+	// Prioritize against the current camera; fall back to the actor itself when there is no
+	// local player yet (e.g. dedicated-style startup)
+	FVector ViewLocation = GetActorLocation();
+	if (const APlayerController* PlayerController = World.GetFirstPlayerController())
+	{
+		if (PlayerController->PlayerCameraManager)
+		{
+			ViewLocation = PlayerController->PlayerCameraManager->GetCameraLocation();
+		}
+	}
+
+	struct FPendingVectorCollection
+	{
+		UContinuousSoundSystemVectorCollection* VectorCollection;
+		float ClosestPointDistanceSq;
+	};
+
+	TArray<FPendingVectorCollection> SortedCollections;
+	SortedCollections.Reserve(ContinuousSoundSystemVectorCollections.Num());
+
+	for (UContinuousSoundSystemVectorCollection* VectorCollection : ContinuousSoundSystemVectorCollections)
+	{
+		if (VectorCollection == nullptr)
+		{
+			continue;
+		}
+
+		// One pass over the points to find how close this collection gets to the view; empty
+		// collections sort last
+		float ClosestPointDistanceSq = MAX_flt;
+		for (const FVector& DataLocation : VectorCollection->VectorCollection)
+		{
+			ClosestPointDistanceSq = FMath::Min(ClosestPointDistanceSq, static_cast<float>(FVector::DistSquared(DataLocation, ViewLocation)));
+		}
+
+		SortedCollections.Add({ VectorCollection, ClosestPointDistanceSq });
+	}
+
+	// Farthest first, so Pop() from the end of the pending array drains nearest first
+	SortedCollections.Sort([](const FPendingVectorCollection& LHS, const FPendingVectorCollection& RHS)
+	{
+		return LHS.ClosestPointDistanceSq > RHS.ClosestPointDistanceSq;
+	});
+
+	PendingVectorCollections.Reset(SortedCollections.Num());
+	for (const FPendingVectorCollection& SortedCollection : SortedCollections)
+	{
+		PendingVectorCollections.Add(SortedCollection.VectorCollection);
+	}
+}
+
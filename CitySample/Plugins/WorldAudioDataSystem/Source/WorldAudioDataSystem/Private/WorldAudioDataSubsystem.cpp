@@ -2,6 +2,7 @@
 
 
 #include "WorldAudioDataSubsystem.h"
+#include "Async/Async.h"
 #include "WorldAudioDataSettings.h"
 #include "WorldAudioDataVehAudioController.h"
 #include "WorldAudioDataVehAudioPreset.h"
@@ -16,6 +17,22 @@
 #include "AudioMixerBlueprintLibrary.h"
 #include "Sound/SoundSubmix.h"
 
+static int32 GWorldAudioDataFullRateVehicleCount = 12;
+static FAutoConsoleVariableRef CVarWorldAudioDataFullRateVehicleCount(
+	TEXT("CitySample.worldaudio.FullRateVehicleCount"),
+	GWorldAudioDataFullRateVehicleCount,
+	TEXT("Number of vehicles nearest the listener that receive full parameter updates every tick. When <= 0 every vehicle updates at full rate."),
+	ECVF_Default
+);
+
+static int32 GWorldAudioDataDistantVehicleUpdatePeriod = 4;
+static FAutoConsoleVariableRef CVarWorldAudioDataDistantVehicleUpdatePeriod(
+	TEXT("CitySample.worldaudio.DistantVehicleUpdatePeriod"),
+	GWorldAudioDataDistantVehicleUpdatePeriod,
+	TEXT("Number of ticks between positional-only updates for the vehicles outside the full rate set, staggered round-robin across the vehicles."),
+	ECVF_Default
+);
+
 
 void UContinuousSound::InitializeContinuousSound(const UObject* WorldContext, FString InDataKey, USoundBase* Sound)
 {
@@ -28,19 +45,19 @@ void UContinuousSound::InitializeContinuousSound(const UObject* WorldContext, FS
 	}
 }
 
-void UContinuousSound::UpdateAudioComponent(const TArray<FVector>& DataLocations, const FVector ListenerLocation)
+void UContinuousSound::UpdateAudioComponent(TConstArrayView<float> DataLocationsX, TConstArrayView<float> DataLocationsY, TConstArrayView<float> DataLocationsZ, const FVector ListenerLocation)
 {
-	FVector CurrentDistance = ListenerLocation + FVector(1000000.0f);
-	FVector LastDistance = CurrentDistance;
+	float LastDistanceSq = UE_MAX_FLT;
 	FVector LastLocation = FVector::ZeroVector;
 
-	for(auto DataLocation : DataLocations)
+	for(int32 DataIt = 0; DataIt < DataLocationsX.Num(); ++DataIt)
 	{
-		CurrentDistance = DataLocation - ListenerLocation;
+		const FVector DataLocation(DataLocationsX[DataIt], DataLocationsY[DataIt], DataLocationsZ[DataIt]);
+		const float CurrentDistanceSq = (float)FVector::DistSquared(DataLocation, ListenerLocation);
 
-		if(LastDistance.Length() >= CurrentDistance.Length())
+		if(LastDistanceSq >= CurrentDistanceSq)
 		{
-			LastDistance = CurrentDistance;
+			LastDistanceSq = CurrentDistanceSq;
 			LastLocation = DataLocation;
 		}
 	}
@@ -101,6 +118,12 @@ void UWorldAudioDataSubsystem::Deinitialize()
 {
 	UE_LOG(LogWorldAudioDataSystem, Verbose, TEXT("Subsystem deinitializing"));
 
+	// Let any in-flight reverb query finish before the collections it reads can be collected
+	if (PendingReverbValueFuture.IsValid())
+	{
+		PendingReverbValueFuture.Wait();
+	}
+
 	bIsTickable = false;
 }
 
@@ -150,6 +173,26 @@ void UWorldAudioDataSubsystem::UpdateWorldAudioDataVehAudioControllers(const TAr
 		return;
 	}
 
+	// Find the distance below which vehicles are close enough to the listener to warrant full
+	// parameter updates every tick
+	float FullRateDistanceSqThreshold = UE_MAX_FLT;
+	if(GWorldAudioDataFullRateVehicleCount > 0 && WorldAudioDataVehicleInfo.Num() > GWorldAudioDataFullRateVehicleCount)
+	{
+		TArray<float> VehicleDistancesSq;
+		VehicleDistancesSq.Reserve(WorldAudioDataVehicleInfo.Num());
+
+		for(auto It = WorldAudioDataVehicleInfo.CreateConstIterator(); It; ++It)
+		{
+			VehicleDistancesSq.Add(FVector::DistSquared(It->Location, CurrentPawnLocation));
+		}
+
+		VehicleDistancesSq.Sort();
+		FullRateDistanceSqThreshold = VehicleDistancesSq[GWorldAudioDataFullRateVehicleCount - 1];
+	}
+
+	const uint32 DistantUpdatePeriod = (uint32)FMath::Max(GWorldAudioDataDistantVehicleUpdatePeriod, 1);
+	VehAudioControllerUpdateFrame++;
+
 	// Construct new and current map
 	for(auto It = WorldAudioDataVehicleInfo.CreateConstIterator(); It; ++It)
 	{
@@ -160,7 +203,18 @@ void UWorldAudioDataSubsystem::UpdateWorldAudioDataVehAudioControllers(const TAr
 				// Update Vehicle Audio Controller's location and linear velocity
 				VehAudioControllerPtr->SetWorldLocation(It->Location);
 				VehAudioControllerPtr->SetVelocity(It->LinearVelocity.Size());
-				VehAudioControllerPtr->ManualUpdate(World->DeltaTimeSeconds, CurrentPawnLocation);
+
+				if(FVector::DistSquared(It->Location, CurrentPawnLocation) <= FullRateDistanceSqThreshold)
+				{
+					VehAudioControllerPtr->ManualUpdate(World->DeltaTimeSeconds, CurrentPawnLocation);
+				}
+				else if((((uint32)It->Id) + VehAudioControllerUpdateFrame) % DistantUpdatePeriod == 0)
+				{
+					// Distant vehicles take turns receiving positional-only updates, staggered
+					// on the vehicle id so the cost spreads evenly across ticks
+					VehAudioControllerPtr->ManualUpdatePositionOnly(World->DeltaTimeSeconds * DistantUpdatePeriod, CurrentPawnLocation);
+				}
+
 				CurrentVehAudioControllers.Add(It->Id, VehAudioControllerPtr);
 				VehAudioControllers.Remove(It->Id);
 				// {
@@ -256,7 +310,30 @@ void UWorldAudioDataSubsystem::Tick(float DeltaTime)
 				}
 			}
 
-			const uint8 CurrentReverbValue = DetermineReverbValueAtLocation(ListenerLocation);
+			// Consume the reverb query kicked off last tick, then relaunch it for the current
+			// listener location. The collections are immutable once registered (the actors only
+			// add to the list), so the task only ever reads, and the UPROPERTY array keeps the
+			// collections alive while a query is in flight.
+			if (PendingReverbValueFuture.IsValid() && PendingReverbValueFuture.IsReady())
+			{
+				LastSampledReverbValue = PendingReverbValueFuture.Get();
+				PendingReverbValueFuture = TFuture<uint8>();
+			}
+
+			if (!PendingReverbValueFuture.IsValid())
+			{
+				PendingReverbValueFuture = Async(EAsyncExecution::TaskGraph,
+					[ReverbDataCollections = WorldAudioReverbDataCollections, QueryLocation = ListenerLocation]()
+					{
+						return DetermineReverbValueAtLocation(ReverbDataCollections, QueryLocation);
+					});
+			}
+
+			// Smooth toward the sampled value so the one tick of latency and cell-border spikes
+			// don't flip the effect chain; the submix overrides themselves still crossfade
+			const float SmoothingAlpha = FMath::Clamp(DeltaTime / 0.25f, 0.0f, 1.0f);
+			SmoothedReverbValue = FMath::Lerp(SmoothedReverbValue, static_cast<float>(LastSampledReverbValue), SmoothingAlpha);
+			const uint8 CurrentReverbValue = static_cast<uint8>(FMath::RoundToInt(SmoothedReverbValue));
 
 			if(CurrentReverbValue > 0 && bReverbEffectActive == false && ListenerLocation.Z < WorldAudioDataSettings->MaxEffectAltitude)
 			{
@@ -315,57 +392,32 @@ void UWorldAudioDataSubsystem::Tick(float DeltaTime)
 				}
 			}
 
-			// Update continuous pawn sounds
-			for(const auto ContinuousPawnSoundCollection : ContinuousPawnSoundCollections)
+			// Update continuous pawn sounds - rewrite the dynamic tail of the pawn-following sets
+			for(FContinuousSoundVectorSet& VectorSet : ContinuousSoundVectorSets)
 			{
-				if(ContinuousPawnSoundCollection)
-				{
-					ContinuousPawnSoundCollection->VectorCollection.Empty(1);
-					ContinuousPawnSoundCollection->VectorCollection.Add(ListenerLocation);
-				}
-				else
+				if(VectorSet.bFollowsPawn == false)
 				{
-					UE_LOG(LogWorldAudioDataSystem, Verbose, TEXT("ContinuousPawnSoundCollection invalid."));
+					continue;
 				}
-			}
 
-			// begin evaluation of continuous sounds
-			TArray<UContinuousSoundSystemVectorCollection*> ContinuousSoundSystemVectorCollectionsToRemove;
-			TMap<FString, TArray<FVector>> ActiveContinuousSoundVectorsMap;
+				VectorSet.LocationsX.SetNum(VectorSet.PersistentCount, EAllowShrinking::No);
+				VectorSet.LocationsY.SetNum(VectorSet.PersistentCount, EAllowShrinking::No);
+				VectorSet.LocationsZ.SetNum(VectorSet.PersistentCount, EAllowShrinking::No);
 
-			// crawl through current collection
-			for (auto ContinuousSoundSystemVectorCollection : ContinuousSoundSystemVectorCollections)
-			{
-				// if collection is valid
-				if (ContinuousSoundSystemVectorCollection && bContinuousSoundSystemActive)
-				{
-					// attempt to get collection's vector array
-					if (TArray<FVector>* VectorArray = ActiveContinuousSoundVectorsMap.Find(ContinuousSoundSystemVectorCollection->PointcloudDataKey))
-					{
-						// if vector array is valid/current, append new collection's pointcloud data
-						VectorArray->Append(ContinuousSoundSystemVectorCollection->VectorCollection);
-					}
-					else
-					{
-						// if vector array is not valid, add new entry
-						ActiveContinuousSoundVectorsMap.Add(ContinuousSoundSystemVectorCollection->PointcloudDataKey, ContinuousSoundSystemVectorCollection->VectorCollection);
-					}
-				}
-				else
-				{
-					// populate remove list for old pointers
-					ContinuousSoundSystemVectorCollectionsToRemove.Add(ContinuousSoundSystemVectorCollection);
-				}
+				VectorSet.LocationsX.Add((float)ListenerLocation.X);
+				VectorSet.LocationsY.Add((float)ListenerLocation.Y);
+				VectorSet.LocationsZ.Add((float)ListenerLocation.Z);
 			}
 
-			// remove old pointers
-			for (auto ContinuousSoundSystemVectorCollectionToRemove : ContinuousSoundSystemVectorCollectionsToRemove)
+			if (bContinuousSoundSystemActive == false)
 			{
-				ContinuousSoundSystemVectorCollections.Remove(ContinuousSoundSystemVectorCollectionToRemove);
+				// data registered while the system is inactive is discarded, matching the old
+				// behavior of dropping inactive collections
+				ContinuousSoundVectorSets.Reset();
 			}
 
 			// Update active continuous sounds
-			for (auto ActiveContinuousSoundVector : ActiveContinuousSoundVectorsMap)
+			for (const FContinuousSoundVectorSet& VectorSet : ContinuousSoundVectorSets)
 			{
 				bool bNewActiveContinuousSoundNeeded = true;
 
@@ -373,13 +425,13 @@ void UWorldAudioDataSubsystem::Tick(float DeltaTime)
 				{
 					if (ActiveContinuousSound)
 					{
-						if (ActiveContinuousSound->GetDataKey() == ActiveContinuousSoundVector.Key)
+						if (ActiveContinuousSound->GetDataKey() == VectorSet.DataKey)
 						{
 							if(ActiveContinuousSound->NeedsNewAudioComponent() == false)
 							{
 								bNewActiveContinuousSoundNeeded = false;
 
-								ActiveContinuousSound->UpdateAudioComponent(ActiveContinuousSoundVector.Value, ListenerLocation);
+								ActiveContinuousSound->UpdateAudioComponent(VectorSet.LocationsX, VectorSet.LocationsY, VectorSet.LocationsZ, ListenerLocation);
 							}
 						}
 					}
@@ -388,15 +440,15 @@ void UWorldAudioDataSubsystem::Tick(float DeltaTime)
 				// No matching continuous sound found, add a new one project settings permitting
 				if (bNewActiveContinuousSoundNeeded && bContinuousSoundSystemActive)
 				{
-					if(const FSoftObjectPath* ObjectPathPtr = WorldAudioDataSettings->ContinuousSoundMap.Find(ActiveContinuousSoundVector.Key))
+					if(const FSoftObjectPath* ObjectPathPtr = WorldAudioDataSettings->ContinuousSoundMap.Find(VectorSet.DataKey))
 					{
 						if(UObject* Object = ObjectPathPtr->TryLoad())
 						{
 							if(USoundBase* SoundBase = Cast<USoundBase>(Object))
 							{
 								UContinuousSound* NewContinuousSound = NewObject<UContinuousSound>(World);
-								NewContinuousSound->InitializeContinuousSound(World, ActiveContinuousSoundVector.Key, SoundBase);
-								NewContinuousSound->UpdateAudioComponent(ActiveContinuousSoundVector.Value, ListenerLocation);
+								NewContinuousSound->InitializeContinuousSound(World, VectorSet.DataKey, SoundBase);
+								NewContinuousSound->UpdateAudioComponent(VectorSet.LocationsX, VectorSet.LocationsY, VectorSet.LocationsZ, ListenerLocation);
 
 								ActiveContinuousSounds.Add(NewContinuousSound);
 							}
@@ -412,7 +464,7 @@ void UWorldAudioDataSubsystem::Tick(float DeltaTime)
 			{
 				if (ActiveContinuousSound)
 				{
-					if(ActiveContinuousSoundVectorsMap.Find(ActiveContinuousSound->GetDataKey()))
+					if(ContinuousSoundVectorSets.FindByPredicate([&ActiveContinuousSound](const FContinuousSoundVectorSet& VectorSet) { return VectorSet.DataKey == ActiveContinuousSound->GetDataKey(); }))
 					{
 						ContinuousSoundsToKeep.Add(ActiveContinuousSound);
 					}
@@ -468,38 +520,71 @@ TStatId UWorldAudioDataSubsystem::GetStatId() const
 	return TStatId();
 }
 
+UWorldAudioDataSubsystem::FContinuousSoundVectorSet& UWorldAudioDataSubsystem::FindOrAddContinuousSoundVectorSet(const FString& DataKey)
+{
+	for (FContinuousSoundVectorSet& VectorSet : ContinuousSoundVectorSets)
+	{
+		if (VectorSet.DataKey == DataKey)
+		{
+			return VectorSet;
+		}
+	}
+
+	FContinuousSoundVectorSet& NewVectorSet = ContinuousSoundVectorSets.AddDefaulted_GetRef();
+	NewVectorSet.DataKey = DataKey;
+	return NewVectorSet;
+}
+
 void UWorldAudioDataSubsystem::AddContinuousSoundSystemVectorCollection(
 	const TArray<UContinuousSoundSystemVectorCollection*>& ContinuousSoundSystemVectorCollectionsIn)
 {
-	if(ContinuousSoundSystemVectorCollectionsIn.Num())
+	// Fold the collections into the pooled SoA storage up front, so the per-tick path neither
+	// touches the source objects again nor copies their vectors
+	for (const UContinuousSoundSystemVectorCollection* ContinuousSoundSystemVectorCollection : ContinuousSoundSystemVectorCollectionsIn)
 	{
-		ContinuousSoundSystemVectorCollections.Append(ContinuousSoundSystemVectorCollectionsIn);
+		if (ContinuousSoundSystemVectorCollection == nullptr)
+		{
+			continue;
+		}
+
+		FContinuousSoundVectorSet& VectorSet = FindOrAddContinuousSoundVectorSet(ContinuousSoundSystemVectorCollection->PointcloudDataKey);
+
+		// append after the data already registered, dropping any dynamic tail - it gets
+		// rebuilt on the next tick
+		const int32 NewPersistentCount = VectorSet.PersistentCount + ContinuousSoundSystemVectorCollection->VectorCollection.Num();
+
+		VectorSet.LocationsX.SetNum(VectorSet.PersistentCount, EAllowShrinking::No);
+		VectorSet.LocationsY.SetNum(VectorSet.PersistentCount, EAllowShrinking::No);
+		VectorSet.LocationsZ.SetNum(VectorSet.PersistentCount, EAllowShrinking::No);
+
+		VectorSet.LocationsX.Reserve(NewPersistentCount);
+		VectorSet.LocationsY.Reserve(NewPersistentCount);
+		VectorSet.LocationsZ.Reserve(NewPersistentCount);
+
+		for (const FVector& DataLocation : ContinuousSoundSystemVectorCollection->VectorCollection)
+		{
+			VectorSet.LocationsX.Add((float)DataLocation.X);
+			VectorSet.LocationsY.Add((float)DataLocation.Y);
+			VectorSet.LocationsZ.Add((float)DataLocation.Z);
+		}
+
+		VectorSet.PersistentCount = NewPersistentCount;
 	}
 }
 
 void UWorldAudioDataSubsystem::ActivateContinuousSoundSystem()
 {
-	UWorld* World = GetWorld();
-
-	if(bContinuousSoundSystemActive == false && World)
+	if(bContinuousSoundSystemActive == false)
 	{
 		for(auto ContinuousSoundTag : ContinuousPawnSoundTags)
 		{
 			if(ContinuousSoundTag != "" && ContinuousSoundTag != "None")
 			{
-				UContinuousSoundSystemVectorCollection* ContinuousPawnVectorCollection = NewObject<UContinuousSoundSystemVectorCollection>(World);
-
-				ContinuousPawnVectorCollection->PointcloudDataKey = ContinuousSoundTag;
-				ContinuousPawnVectorCollection->VectorCollection.Add(ListenerLocation);
-
-				ContinuousPawnSoundCollections.Add(ContinuousPawnVectorCollection);
+				FindOrAddContinuousSoundVectorSet(ContinuousSoundTag).bFollowsPawn = true;
 			}
 		}
-
-		ContinuousSoundSystemVectorCollections.Append(ContinuousPawnSoundCollections);
 	}
 
-
 	bContinuousSoundSystemActive = true;
 }
 
@@ -507,7 +592,10 @@ void UWorldAudioDataSubsystem::DeactivateContinuousSoundSystem()
 {
 	if(bContinuousSoundSystemActive)
 	{
-		ContinuousPawnSoundCollections.Empty();
+		for(FContinuousSoundVectorSet& VectorSet : ContinuousSoundVectorSets)
+		{
+			VectorSet.bFollowsPawn = false;
+		}
 	}
 
 	bContinuousSoundSystemActive = false;
@@ -545,12 +633,12 @@ void UWorldAudioDataSubsystem::AddReverbDataCollection(UWorldAudioReverbDataColl
 	WorldAudioReverbDataCollections.Add(ReverbDataCollection);
 }
 
-uint8 UWorldAudioDataSubsystem::DetermineReverbValueAtLocation(FVector InLocation)
+uint8 UWorldAudioDataSubsystem::DetermineReverbValueAtLocation(const TArray<UWorldAudioReverbDataCollection*>& ReverbDataCollections, FVector InLocation)
 {
 	uint8 TotalWeighting = 0;
 	uint8 TotalValue = 0;
 
-	for(const auto WorldAudioReverbDataCollection : WorldAudioReverbDataCollections)
+	for(const auto WorldAudioReverbDataCollection : ReverbDataCollections)
 	{
 		if(WorldAudioReverbDataCollection)
 		{
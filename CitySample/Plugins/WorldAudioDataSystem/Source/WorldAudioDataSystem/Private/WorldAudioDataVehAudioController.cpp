@@ -89,6 +89,16 @@ void UWorldAudioDataVehAudioController::SetPreset(UWADVehAudioPreset* VehicleAud
 		MainEngineAudioComponent->FadeIn(2.0f, 1.0f, 0.0f);
 	}
 
+	// The seed and pitch offset inputs never change after setup, so push them once here; the
+	// per-update path only sends velocity
+	MainEngineAudioComponent->SetParameters(
+	{
+		{ VehicleAudioPreset->RandomSeedInputName, RandomSeed },
+		{ VehicleAudioPreset->MinEnginePitchOffsetName, MinEnginePitchOffset },
+		{ VehicleAudioPreset->MaxEnginePitchOffsetName, MaxEnginePitchOffset }
+	});
+	LastSentSpeed = -MAX_flt;
+
 	// Call update calculations to set up existing parameters
 	UpdateCalculations(0.066, PlayerPawnLocation);
 
@@ -152,6 +162,16 @@ void UWorldAudioDataVehAudioController::ManualUpdate(const float DeltaTime, cons
 	// HonkHorn();
 }
 
+void UWorldAudioDataVehAudioController::ManualUpdatePositionOnly(const float DeltaTime, const FVector PlayerPawnLocation)
+{
+	// Keep the distance tracking current so the doppler calculation doesn't spike when this
+	// vehicle is promoted back to full rate updates
+	UpdateCalculations(DeltaTime, PlayerPawnLocation);
+
+	// Only update the location of the ACs, skipping the metasound parameter and pitch pushes
+	UpdateAudioComponentLocations();
+}
+
 void UWorldAudioDataVehAudioController::UpdateCalculations(float DeltaTime, const FVector PawnLocation)
 {
 	// Setup Location Vectors
@@ -195,14 +215,19 @@ void UWorldAudioDataVehAudioController::UpdateEngineMetaSound()
 		return;
 	}
 
-	// Batch update parameters on the sound
+	// The constant inputs were pushed in SetPreset; velocity is the only per-update parameter,
+	// and it's only worth sending when it actually changed
+	if (CurrentSpeed == LastSentSpeed)
+	{
+		return;
+	}
+
 	MainEngineAudioComponent->SetParameters(
 	{
-		{ WADVehicleAudioPreset->VelocityInputName, CurrentSpeed },
-		{ WADVehicleAudioPreset->RandomSeedInputName, RandomSeed },
-		{ WADVehicleAudioPreset->MinEnginePitchOffsetName, MinEnginePitchOffset },
-		{ WADVehicleAudioPreset->MaxEnginePitchOffsetName, MaxEnginePitchOffset }
+		{ WADVehicleAudioPreset->VelocityInputName, CurrentSpeed }
 	});
+
+	LastSentSpeed = CurrentSpeed;
 }
 
 void UWorldAudioDataVehAudioController::UpdateAudioComponentPitchMods()
@@ -107,20 +107,27 @@ void UWorldAudioMassProcessor::Execute(FMassEntityManager& EntityManager, FMassE
 		SoundscapeSubsystem->AddColorPointHashMapCollection(ColorPointHashMapCollection);
 	}
 
-	// Reset scratch buffers
+	// Reset scratch buffers; the number of matching vehicles is known up front so every buffer is
+	// sized before the gather and the chunks never grow an array mid-walk
+	const int32 NumNearbyVehicles = NearbyTrafficVehicleEntityQuery.GetNumMatchingEntities();
 	MovingVehicleColorPointLocations.Reset();
+	MovingVehicleColorPointLocations.Reserve(NumNearbyVehicles);
 	StoppedVehicleColorPointLocations.Reset();
+	StoppedVehicleColorPointLocations.Reserve(NumNearbyVehicles);
 	MovingPedestrianColorPointLocations.Reset();
 	StoppedPedestrianColorPointLocations.Reset();
 	IndividuallyAudibleVehicles.Reset();
+	VehicleGather.Reset(NumNearbyVehicles);
 
-	// Find traffic vehicle agents
+	// Find traffic vehicle agents. Chunks gather in parallel into per-chunk SoA buffers and append
+	// them under the lock once per chunk; the color point classification and the audible-vehicle
+	// selection below run on the merged arrays
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("Vehicles"))
 
-		NearbyTrafficVehicleEntityQuery.ForEachEntityChunk(Context, [this](FMassExecutionContext& QueryContext)
+		NearbyTrafficVehicleEntityQuery.ParallelForEachEntityChunk(Context, [this](FMassExecutionContext& QueryContext)
 		{
-			const FWorldAudioDataAudioControllerParameters& AudioControllerSharedFragment = QueryContext.GetConstSharedFragment<FWorldAudioDataAudioControllerParameters>();  
+			const FWorldAudioDataAudioControllerParameters& AudioControllerSharedFragment = QueryContext.GetConstSharedFragment<FWorldAudioDataAudioControllerParameters>();
 			const TConstArrayView<FTransformFragment> TransformFragments = QueryContext.GetFragmentView<FTransformFragment>();
 			const TConstArrayView<FMassTrafficVehicleControlFragment> VehicleControlFragments = QueryContext.GetFragmentView<FMassTrafficVehicleControlFragment>();
 			const TConstArrayView<FMassTrafficVehicleDamageFragment> VehicleDamageFragments = QueryContext.GetFragmentView<FMassTrafficVehicleDamageFragment>();
@@ -128,39 +135,37 @@ void UWorldAudioMassProcessor::Execute(FMassEntityManager& EntityManager, FMassE
 			const TConstArrayView<FMassRepresentationLODFragment> RepresentationLODFragments = QueryContext.GetFragmentView<FMassRepresentationLODFragment>();
 			const TConstArrayView<FMassVelocityFragment> LinearVelocityFragments = QueryContext.GetFragmentView<FMassVelocityFragment>();
 
+			FVehicleGatherBuffers ChunkGather;
+			ChunkGather.Reset(QueryContext.GetNumEntities());
+
 			for (FMassExecutionContext::FEntityIterator EntityIt = QueryContext.CreateEntityIterator(); EntityIt; ++EntityIt)
 			{
-				const FTransformFragment& TransformFragment = TransformFragments[EntityIt];
-				const FMassTrafficVehicleControlFragment& VehicleControlFragment = VehicleControlFragments[EntityIt];
-				const FMassTrafficVehicleDamageFragment& VehicleDamageFragment = VehicleDamageFragments[EntityIt];
-				const FMassViewerInfoFragment& ViewerInfoFragment = ViewerInfoFragments[EntityIt];
-				const FMassRepresentationLODFragment& RepresentationLODFragment = RepresentationLODFragments[EntityIt];
-				const FMassVelocityFragment& LinearVelocityFragment = LinearVelocityFragments[EntityIt];
+				ChunkGather.Ids.Add(QueryContext.GetEntity(EntityIt).Index);
+				ChunkGather.Speeds.Add(VehicleControlFragments[EntityIt].Speed);
+				ChunkGather.ClosestViewerDistancesSq.Add(ViewerInfoFragments[EntityIt].ClosestViewerDistanceSq);
+				ChunkGather.LODSignificances.Add(RepresentationLODFragments[EntityIt].LODSignificance);
+				ChunkGather.AudioControllers.Add(AudioControllerSharedFragment.AudioController);
+				ChunkGather.Locations.Add(TransformFragments[EntityIt].GetTransform().GetLocation());
+				ChunkGather.LinearVelocities.Add(LinearVelocityFragments[EntityIt].Value);
+				ChunkGather.DamageStates.Add(static_cast<uint8>(VehicleDamageFragments[EntityIt].VehicleDamageState));
+			}
 
-				// Add moving or stopped traffic vehicle color point location
-				FVector Location = TransformFragment.GetTransform().GetLocation();
-				if (VehicleControlFragment.Speed >= VehicleMovingSpeedThreshold)
-				{
-					MovingVehicleColorPointLocations.Add(Location);
-				}
-				else
-				{
-					StoppedVehicleColorPointLocations.Add(Location);
-				}
+			FScopeLock Lock(&VehicleGatherLock);
+			VehicleGather.Append(ChunkGather);
+		});
 
-				// Capture vehicle info for higher fidelity sound on the nearest vehicles. This list is later sorted and
-				// culled 
-				IndividuallyAudibleVehicles.Add({
-					/*Id*/ QueryContext.GetEntity(EntityIt).Index,
-					/*ClosestViewerDistanceSq*/ ViewerInfoFragment.ClosestViewerDistanceSq,
-					/*LODSignificance*/RepresentationLODFragment.LODSignificance,
-					/*AudioController*/ AudioControllerSharedFragment.AudioController,
-					/*Location*/ Location,
-					/*LinearVelocity*/ LinearVelocityFragment.Value,
-					/*VehicleDamageState*/ static_cast<uint8>(VehicleDamageFragment.VehicleDamageState)
-				});
+		// Classify moving vs stopped color points in one pass over the merged arrays
+		for (int32 VehicleIndex = 0; VehicleIndex < VehicleGather.Num(); ++VehicleIndex)
+		{
+			if (VehicleGather.Speeds[VehicleIndex] >= VehicleMovingSpeedThreshold)
+			{
+				MovingVehicleColorPointLocations.Add(VehicleGather.Locations[VehicleIndex]);
 			}
-		});
+			else
+			{
+				StoppedVehicleColorPointLocations.Add(VehicleGather.Locations[VehicleIndex]);
+			}
+		}
 	}
 
 	if (bUpdateColorPointHashMapCollection)
@@ -207,56 +212,32 @@ void UWorldAudioMassProcessor::Execute(FMassEntityManager& EntityManager, FMassE
 		}
 	}
 
-	// Temp Array
-	TArray<FWorldAudioDataVehicleInfo> IndividuallyAudibleVehiclesTemp;
-
-	// Remove totalled vehicles from the running
-	for(const FWorldAudioDataVehicleInfo& IndividuallyAudibleVehicle : IndividuallyAudibleVehicles)
-	{
-		if(IndividuallyAudibleVehicle.VehicleDamageState != static_cast<uint8>(EMassTrafficVehicleDamageState::Totaled))
-		{
-			IndividuallyAudibleVehiclesTemp.Add(IndividuallyAudibleVehicle);
-		}
-	}
-
-	// Sort NearestVehicles by ClosestViewerDistanceSq and limit to MaxIndividuallyAudibleVehicles
-	IndividuallyAudibleVehiclesTemp.Sort([](const FWorldAudioDataVehicleInfo& LHS, const FWorldAudioDataVehicleInfo& RHS)
-	{
-		return LHS.LODSignificance < RHS.LODSignificance;
-	});
-	if (IndividuallyAudibleVehiclesTemp.Num() > (MaxIndividuallyAudibleVehicles * 0.5f))
+	// Sort an index array by ClosestViewerDistanceSq, only touching that one gather array, then
+	// materialize at most MaxIndividuallyAudibleVehicles full infos for the audio controller update
+	VehiclesByDistance.Reset();
+	VehiclesByDistance.Reserve(VehicleGather.Num());
+	for (int32 VehicleIndex = 0; VehicleIndex < VehicleGather.Num(); ++VehicleIndex)
 	{
-		IndividuallyAudibleVehiclesTemp.SetNum(MaxIndividuallyAudibleVehicles * 0.5f);
+		VehiclesByDistance.Add(VehicleIndex);
 	}
-
-	// Sort NearestVehicles by ClosestViewerDistanceSq and limit to MaxIndividuallyAudibleVehicles
-	IndividuallyAudibleVehicles.Sort([](const FWorldAudioDataVehicleInfo& LHS, const FWorldAudioDataVehicleInfo& RHS)
+	VehiclesByDistance.Sort([this](const int32 LHS, const int32 RHS)
 	{
-		return LHS.ClosestViewerDistanceSq < RHS.ClosestViewerDistanceSq;
+		return VehicleGather.ClosestViewerDistancesSq[LHS] < VehicleGather.ClosestViewerDistancesSq[RHS];
 	});
 
-	for(auto It = IndividuallyAudibleVehiclesTemp.CreateConstIterator(); It; ++It)
-	{
-		bool bAddElement = true;
-
-		for (auto Jt = IndividuallyAudibleVehicles.CreateConstIterator(); Jt; ++Jt)
-		{
-			if (It->Id == Jt->Id)
-			{
-				bAddElement = false;
-				break;
-			}
-		}
-
-		if(bAddElement)
-		{
-			IndividuallyAudibleVehicles.Add(*It);
-		}
-	}
-
-	if (IndividuallyAudibleVehicles.Num() > MaxIndividuallyAudibleVehicles)
+	const int32 NumAudibleVehicles = FMath::Min(VehiclesByDistance.Num(), MaxIndividuallyAudibleVehicles);
+	for (int32 SortedIndex = 0; SortedIndex < NumAudibleVehicles; ++SortedIndex)
 	{
-		IndividuallyAudibleVehicles.SetNum(MaxIndividuallyAudibleVehicles);
+		const int32 VehicleIndex = VehiclesByDistance[SortedIndex];
+		IndividuallyAudibleVehicles.Add({
+			/*Id*/ VehicleGather.Ids[VehicleIndex],
+			/*ClosestViewerDistanceSq*/ VehicleGather.ClosestViewerDistancesSq[VehicleIndex],
+			/*LODSignificance*/ VehicleGather.LODSignificances[VehicleIndex],
+			/*AudioController*/ VehicleGather.AudioControllers[VehicleIndex],
+			/*Location*/ VehicleGather.Locations[VehicleIndex],
+			/*LinearVelocity*/ VehicleGather.LinearVelocities[VehicleIndex],
+			/*VehicleDamageState*/ VehicleGather.DamageStates[VehicleIndex]
+		});
 	}
 
 	if (UWorldAudioDataSubsystem* WorldAudioDataSubsystem = Context.GetMutableSubsystem<UWorldAudioDataSubsystem>())
@@ -264,3 +245,27 @@ void UWorldAudioMassProcessor::Execute(FMassEntityManager& EntityManager, FMassE
 		WorldAudioDataSubsystem->UpdateWorldAudioDataVehAudioControllers(IndividuallyAudibleVehicles);
 	}
 }
+
+void UWorldAudioMassProcessor::FVehicleGatherBuffers::Reset(const int32 ExpectedNum)
+{
+	Ids.Reset(ExpectedNum);
+	Speeds.Reset(ExpectedNum);
+	ClosestViewerDistancesSq.Reset(ExpectedNum);
+	LODSignificances.Reset(ExpectedNum);
+	AudioControllers.Reset(ExpectedNum);
+	Locations.Reset(ExpectedNum);
+	LinearVelocities.Reset(ExpectedNum);
+	DamageStates.Reset(ExpectedNum);
+}
+
+void UWorldAudioMassProcessor::FVehicleGatherBuffers::Append(const FVehicleGatherBuffers& Other)
+{
+	Ids.Append(Other.Ids);
+	Speeds.Append(Other.Speeds);
+	ClosestViewerDistancesSq.Append(Other.ClosestViewerDistancesSq);
+	LODSignificances.Append(Other.LODSignificances);
+	AudioControllers.Append(Other.AudioControllers);
+	Locations.Append(Other.Locations);
+	LinearVelocities.Append(Other.LinearVelocities);
+	DamageStates.Append(Other.DamageStates);
+}
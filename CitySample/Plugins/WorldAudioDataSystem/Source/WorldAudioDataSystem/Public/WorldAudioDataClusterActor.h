@@ -117,6 +117,13 @@ public:
 	FWorldAudioDataClusterActorDataSummary ClusterActorDataSummary;
 #endif
 
+	// Budget of pointcloud vectors registered with the subsystem per tick. The collections are
+	// handed over nearest-first in chunks of this size, so the sounds around the listener are
+	// correct within a tick or two of the actor streaming in instead of waiting on the whole
+	// cluster to be folded in at once.
+	UPROPERTY(EditAnywhere, Category = "Streaming")
+	int32 MaxVectorPointsRegisteredPerTick = 4096;
+
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
@@ -134,6 +141,17 @@ private:
 	// Flag for attempting to submit data on tick
 	bool bRetryToSendWorldAudioData = false;
 
+	// Set once the subsystem has been found and the reverb data and the pending list are in place
+	bool bWorldAudioDataRegistrationStarted = false;
+
+	// Sorts the vector collections farthest-first, so draining from the end of the array hands
+	// the collections nearest the current view to the subsystem first
+	void BuildPendingVectorCollections(const UWorld& World);
+
+	// Collections still to be registered, drained from the end. Plain pointers are safe here:
+	// ContinuousSoundSystemVectorCollections keeps them alive for the lifetime of the actor.
+	TArray<UContinuousSoundSystemVectorCollection*> PendingVectorCollections;
+
 public:
 	UPROPERTY(VisibleAnywhere)
 	UWorldAudioReverbDataCollection* ReverbCollection;
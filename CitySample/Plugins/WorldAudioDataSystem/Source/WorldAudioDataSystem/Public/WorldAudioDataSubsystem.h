@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "Async/Future.h"
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "WorldAudioDataGameplayScript.h"
@@ -41,7 +42,9 @@ public:
 
 	void InitializeContinuousSound(const UObject* WorldContext, FString InDataKey, USoundBase* Sound);
 
-	void UpdateAudioComponent(const TArray<FVector>& DataLocations, const FVector ListenerLocation);
+	// Moves the audio component to the data location nearest the listener. The locations are
+	// provided as views over the subsystem's pooled SoA storage to avoid per-tick copies.
+	void UpdateAudioComponent(TConstArrayView<float> DataLocationsX, TConstArrayView<float> DataLocationsY, TConstArrayView<float> DataLocationsZ, const FVector ListenerLocation);
 
 	const FString& GetDataKey() const;
 
@@ -115,6 +118,9 @@ public:
 private:
 	bool bVehAudioControllersActive = false;
 
+	// tick counter used to stagger the round-robin updates of distant vehicles
+	uint32 VehAudioControllerUpdateFrame = 0;
+
 	UPROPERTY()
 	const UWorldAudioDataSettings* WorldAudioDataSettings;
 
@@ -158,9 +164,29 @@ private:
 	FVector ListenerForward = FVector::ZeroVector;
 	FVector ListenerUp = FVector::ZeroVector;
 
-	// Cached continuous sound data collection
-	UPROPERTY(Transient)
-	TArray<UContinuousSoundSystemVectorCollection*> ContinuousSoundSystemVectorCollections;
+	// Pooled, non-UObject storage for the continuous sound data, SoA so the per-tick nearest
+	// point scans stay cache friendly. Registered collections are folded in once on arrival
+	// and the arrays are reused across frames.
+	struct FContinuousSoundVectorSet
+	{
+		// Pointcloud data key
+		FString DataKey;
+
+		TArray<float> LocationsX;
+		TArray<float> LocationsY;
+		TArray<float> LocationsZ;
+
+		// Leading portion of the arrays holding the data registered from cluster actors;
+		// anything past it is rewritten each tick (pawn-following sounds)
+		int32 PersistentCount = 0;
+
+		bool bFollowsPawn = false;
+	};
+
+	FContinuousSoundVectorSet& FindOrAddContinuousSoundVectorSet(const FString& DataKey);
+
+	// Cached continuous sound data, reused across frames
+	TArray<FContinuousSoundVectorSet> ContinuousSoundVectorSets;
 
 	// Active continuous sound players
 	UPROPERTY(Transient)
@@ -169,10 +195,6 @@ private:
 	// String tags for continuous sounds that follow the pawn location
 	TSet<FString> ContinuousPawnSoundTags;
 
-	// Cached continuous sound data collection
-	UPROPERTY(Transient)
-	TArray<UContinuousSoundSystemVectorCollection*> ContinuousPawnSoundCollections;
-
 public:
 
 	void AddReverbDataCollection(UWorldAudioReverbDataCollection* ReverbDataCollection);
@@ -183,7 +205,20 @@ private:
 	UPROPERTY(Transient)
 	TArray< UWorldAudioReverbDataCollection*> WorldAudioReverbDataCollections;
 
-	uint8 DetermineReverbValueAtLocation(FVector InLocation);
+	// Weighted average of the collections at a location. Static so the async reverb query can run
+	// it off the game thread against a snapshot of the collection pointers.
+	static uint8 DetermineReverbValueAtLocation(const TArray<UWorldAudioReverbDataCollection*>& ReverbDataCollections, FVector InLocation);
+
+	// In-flight reverb query for the previous tick's listener location; consumed at the top of
+	// Tick and relaunched, so the sampling never blocks the game thread
+	TFuture<uint8> PendingReverbValueFuture;
+
+	// Most recent value produced by the async query
+	uint8 LastSampledReverbValue = 0;
+
+	// Sampled value smoothed over a short window; the effect chain thresholds are evaluated
+	// against this so single-tick spikes at hash cell borders don't toggle the submix overrides
+	float SmoothedReverbValue = 0.0f;
 
 	bool bReverbEffectActive = false;
 };
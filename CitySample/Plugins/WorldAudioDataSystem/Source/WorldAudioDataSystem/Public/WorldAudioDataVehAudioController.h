@@ -47,9 +47,14 @@ protected:
 	// Called when the game ends
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;;
 
-public:	
+public:
 	void ManualUpdate(const float DeltaTime, const FVector PlayerPawnLocation);
 
+	// Reduced cost update for vehicles the player is unlikely to hear - keeps the audio component
+	// locations and the doppler bookkeeping current without pushing metasound parameters or pitch
+	// changes. DeltaTime should cover the full period since the controller was last updated.
+	void ManualUpdatePositionOnly(const float DeltaTime, const FVector PlayerPawnLocation);
+
 private:
 
 	void UpdateCalculations(float DeltaTime, const FVector PawnLocation);
@@ -69,6 +74,9 @@ private:
 	// Cached world location
 	FVector PreviousLocation = FVector::ZeroVector;
 
+	// Last velocity pushed to the metasound, so unchanged speeds skip the parameter send entirely
+	float LastSentSpeed = -MAX_flt;
+
 	// Calculated values
 	float CurrentSpeed = 0.0f;
 	float PreviousDistanceFromPawn = 0.0f;
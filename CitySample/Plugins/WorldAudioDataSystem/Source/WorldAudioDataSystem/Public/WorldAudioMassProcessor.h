@@ -72,7 +72,37 @@ protected:
 	TArray<FVector> StoppedVehicleColorPointLocations;
 	TArray<FVector> MovingPedestrianColorPointLocations;
 	TArray<FVector> StoppedPedestrianColorPointLocations;
-	
+
+	/**
+	 * Scratch SoA buffers the parallel vehicle gather writes into, one entry per gathered vehicle
+	 * across all chunks. Parallel arrays keep the selection pass touching only the fields it sorts
+	 * on, and the buffers are reused between ticks so steady-state gathering doesn't allocate.
+	 */
+	struct FVehicleGatherBuffers
+	{
+		TArray<int32> Ids;
+		TArray<float> Speeds;
+		TArray<float> ClosestViewerDistancesSq;
+		TArray<float> LODSignificances;
+		TArray<FName> AudioControllers;
+		TArray<FVector> Locations;
+		TArray<FVector> LinearVelocities;
+		TArray<uint8> DamageStates;
+
+		int32 Num() const { return Ids.Num(); }
+		void Reset(const int32 ExpectedNum);
+		void Append(const FVehicleGatherBuffers& Other);
+	};
+
+	FVehicleGatherBuffers VehicleGather;
+
+	/** Guards appends of per-chunk gather buffers into VehicleGather during the parallel gather */
+	FCriticalSection VehicleGatherLock;
+
+	/** Reused output list handed to UpdateWorldAudioDataVehAudioControllers; at most MaxIndividuallyAudibleVehicles entries */
 	TArray<FWorldAudioDataVehicleInfo> IndividuallyAudibleVehicles;
+
+	/** Index scratch for sorting the gathered vehicles by viewer distance */
+	TArray<int32> VehiclesByDistance;
 };
 
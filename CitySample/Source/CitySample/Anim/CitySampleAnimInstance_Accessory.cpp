@@ -1,12 +1,18 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "CitySampleAnimInstance_Accessory.h"
+#include "Components/SkeletalMeshComponent.h"
 
 UCitySampleAnimInstance_Accessory::UCitySampleAnimInstance_Accessory(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
 	GaitCurveName = FName(TEXT("MoveData_Gait"));
 	BlockReactCurveName = FName(TEXT("LayerData_BlockReact"));
+	FreezePoseLODThreshold = 2;
+	FreezePoseScreenSizeThreshold = 0.05f;
+	FrozenPoseRefreshInterval = 0.5f;
+	bPoseFrozen = false;
+	TimeUntilFrozenPoseRefresh = 0.f;
 }
 
 void UCitySampleAnimInstance_Accessory::NativeUpdateAnimation(float DeltaSeconds)
@@ -15,7 +21,34 @@ void UCitySampleAnimInstance_Accessory::NativeUpdateAnimation(float DeltaSeconds
 
 	QUICK_SCOPE_CYCLE_COUNTER(STAT_UCitySampleAnimInstance_Accessory_NativeUpdateAnimation);
 
+	// Accessories are invisible at distance; once the owning mesh is past the LOD or screen size
+	// threshold, hold the cached pose and only let an update through at the refresh interval.
+	// MaxDistanceFactor is zero while the mesh is offscreen, so hidden characters freeze as well
+	const USkeletalMeshComponent* OwningComponent = GetOwningComponent();
+	const bool bBeyondThreshold = OwningComponent &&
+		(OwningComponent->GetPredictedLODLevel() >= FreezePoseLODThreshold ||
+		 OwningComponent->MaxDistanceFactor < FreezePoseScreenSizeThreshold);
+
+	if (bBeyondThreshold)
+	{
+		TimeUntilFrozenPoseRefresh -= DeltaSeconds;
+
+		if (TimeUntilFrozenPoseRefresh > 0.f)
+		{
+			bPoseFrozen = true;
+			return;
+		}
+
+		TimeUntilFrozenPoseRefresh = FrozenPoseRefreshInterval;
+	}
+	else
+	{
+		TimeUntilFrozenPoseRefresh = 0.f;
+	}
+
+	bPoseFrozen = false;
+
 	Gait = GetCurveValue(GaitCurveName);
 	BlockReact = GetCurveValue(BlockReactCurveName);
 	GaitLayerOverride = Gait * -1.f;
-}
\ No newline at end of file
+}
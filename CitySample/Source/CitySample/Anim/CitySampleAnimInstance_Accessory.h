@@ -27,9 +27,28 @@ public:
 	UPROPERTY(Transient, EditAnywhere, BlueprintReadWrite, Category = "Defaults")
 	float BlockReact;
 
+	/** Owning mesh LOD at or beyond which the accessory pose is frozen between refreshes */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD")
+	int32 FreezePoseLODThreshold;
+
+	/** Accessory pose is also frozen when the owning mesh's screen size factor drops below this */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD")
+	float FreezePoseScreenSizeThreshold;
+
+	/** How often, in seconds, a frozen accessory pose is refreshed */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD")
+	float FrozenPoseRefreshInterval;
+
+	/** True while the accessory layer should hold its cached pose; the anim graph branches on this */
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "LOD")
+	bool bPoseFrozen;
+
 	UCitySampleAnimInstance_Accessory(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 	virtual void NativeUpdateAnimation(float DeltaSeconds) override;
 
+private:
+
+	float TimeUntilFrozenPoseRefresh;
 };
 
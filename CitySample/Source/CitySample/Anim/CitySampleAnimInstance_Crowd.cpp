@@ -75,7 +75,13 @@ void UCitySampleAnimInstance_Crowd::NativeUpdateAnimation(float DeltaSeconds)
 
 	QUICK_SCOPE_CYCLE_COUNTER(STAT_UCitySampleAnimInstance_Crowd_NativeUpdateAnimation);
 
-	if(Character && MovementComponent)
+	// Only snapshot the data that has to be read on the game thread here; everything derived from
+	// it is computed in NativeThreadSafeUpdateAnimation so high-LOD crowd members update in
+	// parallel with the rest of the anim system
+
+	bCharacterDataValid = (Character && MovementComponent);
+
+	if(bCharacterDataValid)
 	{
 		// Set Essential Data
 
@@ -87,7 +93,22 @@ void UCitySampleAnimInstance_Crowd::NativeUpdateAnimation(float DeltaSeconds)
 
 		CharacterRotation = Character->GetActorRotation();
 
-		if (!Character->IsPlayerControlled())
+		bHasRootMotion = Character->HasAnyRootMotion();
+		bIsPlayerControlled = Character->IsPlayerControlled();
+	}
+
+	OwningComponentScale = GetOwningComponent()->GetComponentScale().X;
+}
+
+void UCitySampleAnimInstance_Crowd::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_UCitySampleAnimInstance_Crowd_NativeThreadSafeUpdateAnimation);
+
+	if(bCharacterDataValid)
+	{
+		if (!bIsPlayerControlled)
 		{
 			const FRotator Rotator = MassCrowdAnimInstanceData.LookAtDirection.ToOrientationRotator();
 
@@ -100,7 +121,7 @@ void UCitySampleAnimInstance_Crowd::NativeUpdateAnimation(float DeltaSeconds)
 
 		ECitySampleLocomotionState LastLocomotionState = LocomotionState;
 
-		if (Character->HasAnyRootMotion())
+		if (bHasRootMotion)
 		{
 			LocomotionState = ECitySampleLocomotionState::Idle;
 		}
@@ -122,7 +143,7 @@ void UCitySampleAnimInstance_Crowd::NativeUpdateAnimation(float DeltaSeconds)
 			}
 		}
 
-		if((LastLocomotionState != ECitySampleLocomotionState::Idle && LocomotionState == ECitySampleLocomotionState::Idle) || 
+		if((LastLocomotionState != ECitySampleLocomotionState::Idle && LocomotionState == ECitySampleLocomotionState::Idle) ||
 		   (LastLocomotionState != ECitySampleLocomotionState::Walk && LocomotionState == ECitySampleLocomotionState::Walk))
 		{
 			TimeInLocomotionState = 0.f;
@@ -155,7 +176,8 @@ float UCitySampleAnimInstance_Crowd::CalculatePlayRate() const
 	static const FName CurveName = FName(TEXT("MoveData_Speed"));
 	const float CurveValue = FMath::Clamp(GetCurveValue(CurveName), 20.f, 1000.f);
 	const float A = (CurveValue != 0.f) ? (Speed / CurveValue) : 0.f;
-	const float B = GetOwningComponent()->GetComponentScale().X;
+	// Uses the scale snapshotted on the game thread so this stays callable from the thread safe update
+	const float B = OwningComponentScale;
 	return FMath::Clamp(((B != 0.f) ? (A / B) : 0.f), 0.8f, 2.0f);
 }
 
@@ -180,7 +202,7 @@ void UCitySampleAnimInstance_Crowd::GetMassMoveState(EMassMovementAction& OutCur
 	OutCurrentMovementAction = EMassMovementAction::Stand;
 	OutPreviousMovementAction = EMassMovementAction::Stand;
 
-	if(Character && Character->IsPlayerControlled())
+	if(bCharacterDataValid && bIsPlayerControlled)
 	{
 		if(Speed > WalkSpeedThreshold)
 		{
@@ -30,6 +30,7 @@ public:
 	virtual void NativeInitializeAnimation() override;
 	virtual void NativeUninitializeAnimation() override;
 	virtual void NativeUpdateAnimation(float DeltaSeconds) override;
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
 	virtual void NativePostEvaluateAnimation() override;
 
 protected:
@@ -140,5 +141,12 @@ protected:
 	void LinkAccessoryLayer();
 
 	FTimerHandle LinkAccessoryLayerCallback;
+
+	// Snapshotted in NativeUpdateAnimation so the locomotion state and curve-derived values can be
+	// computed in NativeThreadSafeUpdateAnimation without touching the character or its components
+	bool bCharacterDataValid = false;
+	bool bHasRootMotion = false;
+	bool bIsPlayerControlled = false;
+	float OwningComponentScale = 1.f;
 };
 
@@ -6,6 +6,9 @@
 
 UCitySampleAnimInstance_Crowd_Head::UCitySampleAnimInstance_Crowd_Head(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, SharedPoseLODThreshold(1)
+	, SharedPoseScreenSizeThreshold(0.1f)
+	, bUseSharedPose(false)
 {
 
 }
@@ -18,6 +21,14 @@ void UCitySampleAnimInstance_Crowd_Head::NativeInitializeAnimation()
 
 	CrowdCharacter = Cast<ACitySampleCrowdCharacter>(GetOwningActor());
 	SourceMeshComponent = CrowdCharacter ? CrowdCharacter->GetMesh() : nullptr;
+	AppliedBodyTypeMorphs.Reset();
+}
+
+int32 UCitySampleAnimInstance_Crowd_Head::GetSharedPoseBucket() const
+{
+	// Body type is the only expression state that differs between distant heads; heads in the same
+	// bucket play the same representative pose and therefore stay visually indistinguishable
+	return CrowdCharacter ? static_cast<int32>(CrowdCharacter->CharacterOptions.BodyType) : 0;
 }
 
 void UCitySampleAnimInstance_Crowd_Head::NativeUpdateAnimation(float DeltaSeconds)
@@ -26,6 +37,13 @@ void UCitySampleAnimInstance_Crowd_Head::NativeUpdateAnimation(float DeltaSecond
 
 	QUICK_SCOPE_CYCLE_COUNTER(STAT_UCitySampleAnimInstance_Crowd_Head_NativeUpdateAnimation);
 
+	// Beyond the thresholds the graph plays the shared bucket pose (see GetSharedPoseBucket)
+	// instead of per-instance expression evaluation; near-field heads keep the full graph
+	const USkeletalMeshComponent* OwningComponent = GetOwningComponent();
+	bUseSharedPose = OwningComponent
+		&& (OwningComponent->GetPredictedLODLevel() >= SharedPoseLODThreshold
+			|| OwningComponent->MaxDistanceFactor < SharedPoseScreenSizeThreshold);
+
 	//Workaround for bug when copying from a leader pose that has a leader pose with a different bone hierarchy
 	if(SourceMeshComponent && SourceMeshComponent->LeaderPoseComponent.IsValid())
 	{
@@ -39,17 +57,29 @@ void UCitySampleAnimInstance_Crowd_Head::NativeUpdateAnimation(float DeltaSecond
 	if(CrowdCharacter)
 	{
 		//This needs to be in Update. Because in InitializeAnimation might have the wrong value.
+		// The morph weights only depend on the body type, so they're applied once and again only
+		// if the character is rebuilt with a different body type
 		const ECitySampleCrowdBodyType BodyType = CrowdCharacter->CharacterOptions.BodyType;
 
-		if (BodyType == ECitySampleCrowdBodyType::OverWeight)
+		if (!AppliedBodyTypeMorphs.IsSet() || AppliedBodyTypeMorphs.GetValue() != static_cast<uint8>(BodyType))
 		{
-			SetMorphTarget(CurveName_Overweight, 1.f);
-			SetMorphTarget(CurveName_Underweight, 0.f);
-		}
-		else if (BodyType == ECitySampleCrowdBodyType::UnderWeight)
-		{
-			SetMorphTarget(CurveName_Overweight, 0.f);
-			SetMorphTarget(CurveName_Underweight, 1.f);
+			if (BodyType == ECitySampleCrowdBodyType::OverWeight)
+			{
+				SetMorphTarget(CurveName_Overweight, 1.f);
+				SetMorphTarget(CurveName_Underweight, 0.f);
+			}
+			else if (BodyType == ECitySampleCrowdBodyType::UnderWeight)
+			{
+				SetMorphTarget(CurveName_Overweight, 0.f);
+				SetMorphTarget(CurveName_Underweight, 1.f);
+			}
+			else
+			{
+				SetMorphTarget(CurveName_Overweight, 0.f);
+				SetMorphTarget(CurveName_Underweight, 0.f);
+			}
+
+			AppliedBodyTypeMorphs = static_cast<uint8>(BodyType);
 		}
 	}
-}
\ No newline at end of file
+}
@@ -20,6 +20,12 @@ public:
 	virtual void NativeInitializeAnimation() override;
 	virtual void NativeUpdateAnimation(float DeltaSeconds) override;
 
+	/** Which representative head pose this instance should play while bUseSharedPose is set. The
+	* anim graph maps each bucket to one of a small set of shared expression poses so distant heads
+	* with the same state stay in sync instead of evaluating their own expression logic. */
+	UFUNCTION(BlueprintPure, Category = "LOD")
+	int32 GetSharedPoseBucket() const;
+
 protected:
 
 	UPROPERTY(Transient, BlueprintReadWrite, Category = Defaults)
@@ -33,5 +39,21 @@ protected:
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Defaults)
 	FName CurveName_Underweight;
-};
 
+	/** Owning mesh LOD at or beyond which the head plays the shared bucket pose instead of per-instance expression evaluation */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD")
+	int32 SharedPoseLODThreshold;
+
+	/** The shared pose is also used when the owning mesh's screen size factor drops below this */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD")
+	float SharedPoseScreenSizeThreshold;
+
+	/** True while the head should play the shared bucket pose; the anim graph branches on this */
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "LOD")
+	bool bUseSharedPose;
+
+private:
+
+	/** Body type the morph targets were last applied for, so they're set once instead of every update */
+	TOptional<uint8> AppliedBodyTypeMorphs;
+};
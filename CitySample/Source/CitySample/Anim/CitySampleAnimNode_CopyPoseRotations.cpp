@@ -178,58 +178,57 @@ void FCitySampleAnimNode_CopyPoseRotations::Evaluate_AnyThread(FPoseContext& Out
 	OutPose.CopyBonesFrom(InputPose.Pose);
 
 
-	// Copy the rotations from the SourceMeshPose to the Output Pose. 
-	//TODO - Continue from here
+	// Copy the rotations from the SourceMeshPose to the Output Pose.
 
 	USkeletalMesh* CurrentMesh = CurrentlyUsedMesh.IsValid() ? CurrentlyUsedMesh.Get() : nullptr;
 	if (SourceMeshTransformArray.Num() > 0 && CurrentMesh)
 	{
 		const FBoneContainer& RequiredBones = OutPose.GetBoneContainer();
 
-		for (FCompactPoseBoneIndex PoseBoneIndex : OutPose.ForEachBoneIndex())
+		// The mesh-to-compact remap and source parent lookups only change with the bone container
+		// (LOD switches) or the bone mapping, so resolve them once here rather than per bone per eval
+		if (RequiredBones.GetSerialNumber() != CachedBoneContainerSerialNumber
+			|| BoneMappingVersion != CachedBoneMappingVersion
+			|| CompactSettingsSourceMesh != CurrentlyUsedMesh)
 		{
-			const int32 SkeletonBoneIndex = RequiredBones.GetSkeletonIndex(PoseBoneIndex);
-			const int32 MeshBoneIndex = RequiredBones.GetMeshPoseIndexFromSkeletonPoseIndex(FSkeletonPoseBoneIndex(SkeletonBoneIndex)).GetInt();
-			const FCitySample_BoneSourceSettings* Value = BoneMapToSourceSettings.Find(MeshBoneIndex);
-			if (Value)
-			{
-				FTransform DesiredTargetTransform = FTransform::Identity;
+			RebuildCompactBoneSettings(RequiredBones, *CurrentMesh);
+		}
 
-				if (Value->bIncludeInputPose)
-				{
-					DesiredTargetTransform = OutPose[PoseBoneIndex];
-				}
+		for (const FCitySample_CompactBoneSourceSettings& Settings : CompactBoneSourceSettings)
+		{
+			// Only the rotation survives to the output pose, so accumulate pure quaternions
+			// (vectorized quaternion multiplies) instead of building full relative transforms
+			FQuat DesiredRotation = Settings.bIncludeInputPose ? OutPose[Settings.PoseBoneIndex].GetRotation() : FQuat::Identity;
 
-				for(int32 SourceIdx = 0; SourceIdx < Value->SourceBoneIndices.Num(); ++SourceIdx)
+			for (int32 SourceIdx = 0; SourceIdx < Settings.SourceBoneIndices.Num(); ++SourceIdx)
+			{
+				const int32 SourceBoneIndex = Settings.SourceBoneIndices[SourceIdx];
+
+				if (SourceMeshTransformArray.IsValidIndex(SourceBoneIndex))
 				{
-					int32 SourceBoneIndex = Value->SourceBoneIndices[SourceIdx];
-					
-					if(SourceMeshTransformArray.IsValidIndex(SourceBoneIndex))
+					const int32 ParentIndex = Settings.SourceParentBoneIndices[SourceIdx];
+					// only apply if I also have parent, otherwise, it should apply the space bases
+					if (Settings.bHasCompactParent && SourceMeshTransformArray.IsValidIndex(ParentIndex))
+					{
+						// Rotation part of ChildTransform.GetRelativeTransform(ParentTransform);
+						// component space transforms have positive scales so no flip handling needed
+						const FQuat RelativeRotation = SourceMeshTransformArray[ParentIndex].GetRotation().Inverse() * SourceMeshTransformArray[SourceBoneIndex].GetRotation();
+						DesiredRotation = RelativeRotation * DesiredRotation;
+					}
+					else
 					{
-						const int32 ParentIndex = CurrentMesh->GetRefSkeleton().GetParentIndex(SourceBoneIndex);
-						const FCompactPoseBoneIndex MyParentIndex = RequiredBones.GetParentBoneIndex(PoseBoneIndex);
-						// only apply if I also have parent, otherwise, it should apply the space bases
-						if (SourceMeshTransformArray.IsValidIndex(ParentIndex) && MyParentIndex != INDEX_NONE)
-						{
-							const FTransform ParentTransform = SourceMeshTransformArray[ParentIndex];
-							const FTransform ChildTransform = SourceMeshTransformArray[SourceBoneIndex];
-							DesiredTargetTransform.Accumulate(ChildTransform.GetRelativeTransform(ParentTransform));
-						}
-						else
-						{
-							DesiredTargetTransform.Accumulate(SourceMeshTransformArray[SourceBoneIndex]);
-						}
+						DesiredRotation = SourceMeshTransformArray[SourceBoneIndex].GetRotation() * DesiredRotation;
 					}
 				}
+			}
 
-				if (Value->bIncludeFullTransform)
-				{
-					OutPose[PoseBoneIndex] = FTransform(DesiredTargetTransform.GetRotation());
-				}
-				else
-				{
-					OutPose[PoseBoneIndex].SetRotation(DesiredTargetTransform.GetRotation());
-				}
+			if (Settings.bIncludeFullTransform)
+			{
+				OutPose[Settings.PoseBoneIndex] = FTransform(DesiredRotation);
+			}
+			else
+			{
+				OutPose[Settings.PoseBoneIndex].SetRotation(DesiredRotation);
 			}
 		}
 	}
@@ -260,6 +259,9 @@ void FCitySampleAnimNode_CopyPoseRotations::ReinitializeMeshComponent(USkeletalM
 	BoneMapToSourceSettings.Reset();
 	CurveNameToUIDMap.Reset();
 
+	// Invalidate any compact settings resolved from the previous mapping
+	BoneMappingVersion++;
+
 	if (TargetMeshComponent && IsValid(NewSourceMeshComponent) && NewSourceMeshComponent->GetSkeletalMeshAsset())
 	{
 		USkeletalMesh* SourceSkelMesh = NewSourceMeshComponent->GetSkeletalMeshAsset();
@@ -299,4 +301,45 @@ void FCitySampleAnimNode_CopyPoseRotations::ReinitializeMeshComponent(USkeletalM
 	}
 }
 
+void FCitySampleAnimNode_CopyPoseRotations::RebuildCompactBoneSettings(const FBoneContainer& RequiredBones, USkeletalMesh& SourceMesh)
+{
+	CompactBoneSourceSettings.Reset();
+	CompactBoneSourceSettings.Reserve(BoneMapToSourceSettings.Num());
+
+	const FReferenceSkeleton& SourceRefSkeleton = SourceMesh.GetRefSkeleton();
+
+	for (const TPair<int32, FCitySample_BoneSourceSettings>& Pair : BoneMapToSourceSettings)
+	{
+		const FSkeletonPoseBoneIndex SkeletonBoneIndex = RequiredBones.GetSkeletonPoseIndexFromMeshPoseIndex(FMeshPoseBoneIndex(Pair.Key));
+		const FCompactPoseBoneIndex PoseBoneIndex = RequiredBones.GetCompactPoseIndexFromSkeletonPoseIndex(SkeletonBoneIndex);
+		if (PoseBoneIndex == INDEX_NONE)
+		{
+			// Bone is not present at this LOD
+			continue;
+		}
+
+		FCitySample_CompactBoneSourceSettings& CompactSettings = CompactBoneSourceSettings.AddDefaulted_GetRef();
+		CompactSettings.PoseBoneIndex = PoseBoneIndex;
+		CompactSettings.SourceBoneIndices = Pair.Value.SourceBoneIndices;
+		CompactSettings.SourceParentBoneIndices.Reset(Pair.Value.SourceBoneIndices.Num());
+		for (const int32 SourceBoneIndex : Pair.Value.SourceBoneIndices)
+		{
+			CompactSettings.SourceParentBoneIndices.Add(SourceRefSkeleton.GetParentIndex(SourceBoneIndex));
+		}
+		CompactSettings.bIncludeFullTransform = Pair.Value.bIncludeFullTransform;
+		CompactSettings.bIncludeInputPose = Pair.Value.bIncludeInputPose;
+		CompactSettings.bHasCompactParent = RequiredBones.GetParentBoneIndex(PoseBoneIndex) != INDEX_NONE;
+	}
+
+	// Sort by pose index so the evaluation loop touches the output pose in order
+	CompactBoneSourceSettings.Sort([](const FCitySample_CompactBoneSourceSettings& A, const FCitySample_CompactBoneSourceSettings& B)
+	{
+		return A.PoseBoneIndex.GetInt() < B.PoseBoneIndex.GetInt();
+	});
+
+	CompactSettingsSourceMesh = &SourceMesh;
+	CachedBoneContainerSerialNumber = RequiredBones.GetSerialNumber();
+	CachedBoneMappingVersion = BoneMappingVersion;
+}
+
 #undef LOCTEXT_NAMESPACE // CitySampleAnimNode_CopyPoseRotations
\ No newline at end of file
@@ -35,6 +35,19 @@ struct FCitySample_BoneSourceSettings
 	bool bIncludeInputPose;
 };
 
+// Source settings resolved against a specific bone container, so evaluation can iterate a flat
+// array of compact pose indices instead of remapping and looking up every pose bone per eval
+struct FCitySample_CompactBoneSourceSettings
+{
+	FCompactPoseBoneIndex PoseBoneIndex = FCompactPoseBoneIndex(INDEX_NONE);
+	TArray<int32, TInlineAllocator<2>> SourceBoneIndices;
+	// Parent indices in the source ref skeleton, parallel to SourceBoneIndices
+	TArray<int32, TInlineAllocator<2>> SourceParentBoneIndices;
+	bool bIncludeFullTransform = false;
+	bool bIncludeInputPose = false;
+	bool bHasCompactParent = false;
+};
+
 /**
  *	Simple controller to copy a bone's rotation to another one.
  */
@@ -99,7 +112,16 @@ private:
 	// Cached attributes, copied on the game thread
 	UE::Anim::FHeapAttributeContainer SourceCustomAttributes;
 
-	// reinitialize mesh component 
+	// Source settings resolved to compact pose indices, sorted by pose index for coherent access.
+	// Rebuilt lazily during evaluation whenever the bone container or the bone mapping changes.
+	TArray<FCitySample_CompactBoneSourceSettings> CompactBoneSourceSettings;
+	TWeakObjectPtr<USkeletalMesh> CompactSettingsSourceMesh;
+	uint16 CachedBoneContainerSerialNumber = 0;
+	uint32 BoneMappingVersion = 0;
+	uint32 CachedBoneMappingVersion = MAX_uint32;
+
+	// reinitialize mesh component
 	void ReinitializeMeshComponent(USkeletalMeshComponent* NewSkeletalMeshComponent, USkeletalMeshComponent* TargetMeshComponent);
 	void RefreshMeshComponent(USkeletalMeshComponent* TargetMeshComponent);
+	void RebuildCompactBoneSettings(const FBoneContainer& RequiredBones, USkeletalMesh& SourceMesh);
 };
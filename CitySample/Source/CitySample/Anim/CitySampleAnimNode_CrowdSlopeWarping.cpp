@@ -3,18 +3,129 @@
 
 #include "Animation/AnimInstanceProxy.h"
 #include "Engine/SkeletalMesh.h"
+#include "Misc/ScopeLock.h"
 #include "ReferenceSkeleton.h"
 
+#include <atomic>
+
 #define LOCTEXT_NAMESPACE "CitySampleAnimNode_CrowdSlopeWarping"
 
 DECLARE_CYCLE_STAT(TEXT("CITYSAMPLE_CrowdSlopeWarping_Eval"), STAT_CrowdSlopeWarping_Eval, STATGROUP_CITYSAMPLEANIM);
 DECLARE_DWORD_COUNTER_STAT(TEXT("CITYSAMPLE_CrowdSlopeWarping_DidTrace"), STAT_MassCrowdAnim_DidTrace, STATGROUP_CITYSAMPLEANIM);
 DECLARE_DWORD_COUNTER_STAT(TEXT("CITYSAMPLE_CrowdSlopeWarping_TotalTraces"), STAT_MassCrowdAnim_TotalTraces, STATGROUP_CITYSAMPLEANIM);
+DECLARE_DWORD_COUNTER_STAT(TEXT("CITYSAMPLE_CrowdSlopeWarping_BudgetedOutTraces"), STAT_MassCrowdAnim_BudgetedOutTraces, STATGROUP_CITYSAMPLEANIM);
 
 TAutoConsoleVariable<bool> CVarCrowdSlopeWarpingEnable(TEXT("a.AnimNode.CrowdSlopeWarping.Enable"), true, TEXT("Toggle Crowd Slope Warping"));
 #if ENABLE_ANIM_DEBUG
 TAutoConsoleVariable<bool> CVarCrowdSlopeWarpingDebug(TEXT("a.AnimNode.CrowdSlopeWarping.Debug"), false, TEXT("Toggle Crowd Slope Warping debugging"));
 #endif
+TAutoConsoleVariable<int32> CVarCrowdSlopeWarpingMaxTracesPerFrame(TEXT("a.AnimNode.CrowdSlopeWarping.MaxTracesPerFrame"), 128, TEXT("Global budget of ground sweeps all crowd slope warping nodes may issue per frame. Once exhausted, feet fall back to the shared ground height cache. Negative values disable the budget"));
+TAutoConsoleVariable<float> CVarCrowdSlopeWarpingGroundCacheCellSize(TEXT("a.AnimNode.CrowdSlopeWarping.GroundCacheCellSize"), 100.0f, TEXT("World space cell size in cm of the shared ground height cache used when the trace budget is exhausted"));
+TAutoConsoleVariable<float> CVarCrowdSlopeWarpingGroundCacheMaxAgeSeconds(TEXT("a.AnimNode.CrowdSlopeWarping.GroundCacheMaxAgeSeconds"), 2.0f, TEXT("Seconds before a shared ground height cache cell expires. Keeps stale heights from surviving streaming changes"));
+
+namespace CitySampleCrowdSlopeWarping
+{
+	/**
+	 * Coarse world space grid of the last ground hit in each XY cell, shared by every crowd slope
+	 * warping instance. Cells are populated opportunistically by the budgeted sweeps instances
+	 * already perform and expire after a short age, so heights refresh naturally as geometry streams
+	 * in and out.
+	 */
+	struct FGroundHeightCache
+	{
+		struct FCell
+		{
+			float GroundZ = 0.0f;
+			FVector GroundNormal = FVector::UpVector;
+			double Timestamp = 0.0;
+		};
+
+		static uint64 MakeCellKey(const FVector& WorldLocation, const float CellSize)
+		{
+			const int32 CellX = FMath::FloorToInt32(WorldLocation.X / CellSize);
+			const int32 CellY = FMath::FloorToInt32(WorldLocation.Y / CellSize);
+			return (static_cast<uint64>(static_cast<uint32>(CellX)) << 32) | static_cast<uint64>(static_cast<uint32>(CellY));
+		}
+
+		void Store(const FVector& WorldHitLocation, const FVector& WorldHitNormal)
+		{
+			const float CellSize = FMath::Max(CVarCrowdSlopeWarpingGroundCacheCellSize.GetValueOnAnyThread(), 1.0f);
+			const uint64 CellKey = MakeCellKey(WorldHitLocation, CellSize);
+			const double Now = FPlatformTime::Seconds();
+
+			FScopeLock ScopeLock(&Lock);
+
+			// Crowds only exist around the player so the cache stays small; purge expired cells if it grows anyway
+			if (Cells.Num() > MaxCells)
+			{
+				const double MaxAge = CVarCrowdSlopeWarpingGroundCacheMaxAgeSeconds.GetValueOnAnyThread();
+				for (auto It = Cells.CreateIterator(); It; ++It)
+				{
+					if (Now - It.Value().Timestamp > MaxAge)
+					{
+						It.RemoveCurrent();
+					}
+				}
+			}
+
+			FCell& Cell = Cells.FindOrAdd(CellKey);
+			Cell.GroundZ = WorldHitLocation.Z;
+			Cell.GroundNormal = WorldHitNormal;
+			Cell.Timestamp = Now;
+		}
+
+		bool Find(const FVector& WorldLocation, FCell& OutCell)
+		{
+			const float CellSize = FMath::Max(CVarCrowdSlopeWarpingGroundCacheCellSize.GetValueOnAnyThread(), 1.0f);
+			const uint64 CellKey = MakeCellKey(WorldLocation, CellSize);
+
+			FScopeLock ScopeLock(&Lock);
+			const FCell* Cell = Cells.Find(CellKey);
+			if (Cell && FPlatformTime::Seconds() - Cell->Timestamp <= CVarCrowdSlopeWarpingGroundCacheMaxAgeSeconds.GetValueOnAnyThread())
+			{
+				OutCell = *Cell;
+				return true;
+			}
+			return false;
+		}
+
+	private:
+		static constexpr int32 MaxCells = 4096;
+
+		FCriticalSection Lock;
+		TMap<uint64, FCell> Cells;
+	};
+
+	static FGroundHeightCache GGroundHeightCache;
+
+	static std::atomic<uint64> GTraceBudgetFrame{ 0 };
+	static std::atomic<int32> GTracesThisFrame{ 0 };
+
+	/** Claims one sweep from the global per frame budget. Evaluation runs on worker threads, hence the atomics */
+	static bool TryClaimTrace()
+	{
+		const int32 MaxTracesPerFrame = CVarCrowdSlopeWarpingMaxTracesPerFrame.GetValueOnAnyThread();
+		if (MaxTracesPerFrame < 0)
+		{
+			return true;
+		}
+
+		const uint64 CurrentFrame = GFrameCounter;
+		uint64 StoredFrame = GTraceBudgetFrame.load(std::memory_order_relaxed);
+		if (StoredFrame != CurrentFrame && GTraceBudgetFrame.compare_exchange_strong(StoredFrame, CurrentFrame))
+		{
+			GTracesThisFrame.store(0, std::memory_order_relaxed);
+		}
+
+		if (GTracesThisFrame.fetch_add(1, std::memory_order_relaxed) < MaxTracesPerFrame)
+		{
+			return true;
+		}
+
+		INC_DWORD_STAT(STAT_MassCrowdAnim_BudgetedOutTraces);
+		return false;
+	}
+}
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// FCitySampleAnimNode_CrowdSlopeWarping
@@ -86,8 +197,8 @@ void FCitySampleAnimNode_CrowdSlopeWarping::EvaluateSkeletalControl_AnyThread(FC
 	if(bDoTraces)
 	{
 		INC_DWORD_STAT(STAT_MassCrowdAnim_DidTrace);
-		UpdateFootTrace(CrowdSlopeWarpingContext, LeftFootData);
-		UpdateFootTrace(CrowdSlopeWarpingContext, RightFootData);
+		UpdateFootTrace(CrowdSlopeWarpingContext, LeftFootData, InstantDeltaZ);
+		UpdateFootTrace(CrowdSlopeWarpingContext, RightFootData, InstantDeltaZ);
 	}
 	else
 	{
@@ -184,7 +295,7 @@ void FCitySampleAnimNode_CrowdSlopeWarping::InitializeBoneReferences(const FBone
 	IKFootRootBoneIndex = IKFootRootBone.GetCompactPoseIndex(RequiredBones);
 }
 
-void FCitySampleAnimNode_CrowdSlopeWarping::UpdateFootTrace(FCrowdSlopeWarpingEvaluationContext& CrowdSlopeWarpingContext, FCitySample_CrowdSlopeWarpingFootData& FootData) const
+void FCitySampleAnimNode_CrowdSlopeWarping::UpdateFootTrace(FCrowdSlopeWarpingEvaluationContext& CrowdSlopeWarpingContext, FCitySample_CrowdSlopeWarpingFootData& FootData, const float ComponentZDelta)
 {
 	QUICK_SCOPE_CYCLE_COUNTER(STAT_CrowdSlopeWarping_ProcessFootTrace);
 
@@ -203,6 +314,33 @@ void FCitySampleAnimNode_CrowdSlopeWarping::UpdateFootTrace(FCrowdSlopeWarpingEv
 	// Do the trace in world space
 	Start = ComponentToWorld.TransformPosition(Start);
 	End = ComponentToWorld.TransformPosition(End);
+
+	if (!CitySampleCrowdSlopeWarping::TryClaimTrace())
+	{
+		// Out of global trace budget this frame: reuse the ground height another instance found in
+		// this cell, provided it lies within our own trace window; otherwise treat as a skipped trace
+		CitySampleCrowdSlopeWarping::FGroundHeightCache::FCell CachedGround;
+		if (CitySampleCrowdSlopeWarping::GGroundHeightCache.Find(Start, CachedGround)
+			&& CachedGround.GroundZ <= Start.Z && CachedGround.GroundZ >= Start.Z - 2.0f * TraceLength)
+		{
+			const FVector HitLocation = ComponentToWorld.InverseTransformPosition(FVector(Start.X, Start.Y, CachedGround.GroundZ));
+			FVector HitNormal = ComponentToWorld.InverseTransformVector(CachedGround.GroundNormal);
+			if (HitNormal.Z < WalkableFloorZ)
+			{
+				HitNormal = FVector::UpVector;
+			}
+
+			FootData.DesiredOffset.Z = HitLocation.Z + GroundOffset;
+			FootData.DesiredNormal = HitNormal;
+			FootData.bCachedHit = true;
+		}
+		else
+		{
+			CorrectFootOnSkippedTrace(CrowdSlopeWarpingContext, FootData, ComponentZDelta);
+		}
+		return;
+	}
+
 	FVector HitLocation = FVector::ZeroVector;
 	FVector HitNormal = FVector::UpVector;
 	FHitResult HitResult;
@@ -214,6 +352,9 @@ void FCitySampleAnimNode_CrowdSlopeWarping::UpdateFootTrace(FCrowdSlopeWarpingEv
 		HitNormal = HitResult.ImpactNormal;
 		HitLocation = HitResult.ImpactPoint;
 
+		// Share the world space result with other instances in this cell
+		CitySampleCrowdSlopeWarping::GGroundHeightCache.Store(HitLocation, HitNormal);
+
 		HitLocation = ComponentToWorld.InverseTransformPosition(HitLocation);
 		HitNormal = ComponentToWorld.InverseTransformVector(HitNormal);
 
@@ -444,8 +585,9 @@ void FCitySampleAnimNode_CrowdSlopeWarping::UpdateFeetStepAdjustment(FCrowdSlope
 	FVector HitLocation = FVector::ZeroVector;
 	FVector HitNormal = FVector::UpVector;
 
+	// Step adjustment is purely cosmetic, so when the global budget runs out simply leave the feet unadjusted
 	FHitResult HitResult;
-	bool bHit = DoSphereTrace(CrowdSlopeWarpingContext, Start, End, HitResult, QueryParams);
+	bool bHit = CitySampleCrowdSlopeWarping::TryClaimTrace() && DoSphereTrace(CrowdSlopeWarpingContext, Start, End, HitResult, QueryParams);
 
 #if ENABLE_ANIM_DEBUG
 	const bool bShowDebug = (CVarCrowdSlopeWarpingDebug.GetValueOnAnyThread() == true);
@@ -501,7 +643,7 @@ void FCitySampleAnimNode_CrowdSlopeWarping::UpdateFeetStepAdjustment(FCrowdSlope
 				CrowdSlopeWarpingContext.CSPContext.AnimInstanceProxy->AnimDrawDebugLine(Start, End, FColor::Green, false, -1.0f, 0.2f, SDPG_Foreground);
 			}
 #endif
-			bHit = DoSphereTrace(CrowdSlopeWarpingContext, Start, End, HitResult, QueryParams);
+			bHit = CitySampleCrowdSlopeWarping::TryClaimTrace() && DoSphereTrace(CrowdSlopeWarpingContext, Start, End, HitResult, QueryParams);
 
 			if(bHit)
 			{
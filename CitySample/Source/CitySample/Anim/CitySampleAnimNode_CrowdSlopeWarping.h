@@ -222,7 +222,7 @@ public: // FAnimNode_Base
 private:
 	
 	virtual void InitializeBoneReferences(const FBoneContainer& RequiredBones) override;
-	void UpdateFootTrace(FCrowdSlopeWarpingEvaluationContext& CrowdSlopeWarpingEvaluationContext, FCitySample_CrowdSlopeWarpingFootData& FootData) const;
+	void UpdateFootTrace(FCrowdSlopeWarpingEvaluationContext& CrowdSlopeWarpingEvaluationContext, FCitySample_CrowdSlopeWarpingFootData& FootData, const float ComponentZDelta);
 	void UpdateFootOffset(FCrowdSlopeWarpingEvaluationContext& CrowdSlopeWarpingEvaluationContext, FCitySample_CrowdSlopeWarpingFootData& FootData, const FTransform& IKRootTransform) const;
 	void UpdateFootPinning(FCrowdSlopeWarpingEvaluationContext& CrowdSlopeWarpingContext, FCitySample_CrowdSlopeWarpingFootData& FootData) const;
 	bool DoSphereTrace(FCrowdSlopeWarpingEvaluationContext& CrowdSlopeWarpingEvaluationContext, const FVector& Start, const FVector& End, FHitResult& HitResult, const FCollisionQueryParams& QueryParams) const;
@@ -42,14 +42,15 @@ void FCitySampleAnimNode_RequestInertialization::Update_AnyThread(const FAnimati
 	{
 		switch (GetCondition())
 		{
-		case ERequestInertializationCondition::OnChange: 
-			bLastInput = bInput; 
+		case ERequestInertializationCondition::OnChange:
+			bLastInput = bInput;
 			break;
 		case ERequestInertializationCondition::OnTrue:
-			bLastInput = false; 
+			bLastInput = false;
 			break;
 		default: break;
 		}
+		TimeSinceLastRequest = BIG_NUMBER;
 	}
 	bReinitialized = false;
 
@@ -70,22 +71,38 @@ void FCitySampleAnimNode_RequestInertialization::Update_AnyThread(const FAnimati
 
 	bLastInput = bInput;
 
-	const bool bSkipForBecomingRelevant =
-		GetSkipOnBecomingRelevant() &&
+	const bool bJustBecameRelevant =
 		UpdateCounter.HasEverBeenUpdated() &&
 		!UpdateCounter.WasSynchronizedCounter(Context.AnimInstanceProxy->GetUpdateCounter());
+	const bool bSkipForBecomingRelevant = GetSkipOnBecomingRelevant() && bJustBecameRelevant;
 	UpdateCounter.SynchronizeWith(Context.AnimInstanceProxy->GetUpdateCounter());
 
 	bRequestInertialization = bRequestInertialization && !bSkipForBecomingRelevant;
 
+	// The coalescing timer only advances while the node is relevant, so treat becoming relevant as
+	// an expired window rather than trusting a stale timestamp
+	TimeSinceLastRequest = bJustBecameRelevant ? BIG_NUMBER : TimeSinceLastRequest + Context.GetDeltaTime();
+
+	// Fast path: if we asked for the same or a shorter blend within the coalescing window, the
+	// pending request already covers this one; skip the graph walk for the inertialization node.
+	// Sharper blends (smaller BlendTime) always go through since they tighten the pending request.
+	if (bRequestInertialization && RequestCoalescingWindow > 0.0f
+		&& TimeSinceLastRequest < RequestCoalescingWindow && BlendTime >= LastRequestBlendTime)
+	{
+		bRequestInertialization = false;
+	}
+
 	if (bRequestInertialization)
 	{
-		UE::Anim::IInertializationRequester* InertializationRequester = 
+		UE::Anim::IInertializationRequester* InertializationRequester =
 			Context.GetMessage<UE::Anim::IInertializationRequester>();
 		if (InertializationRequester)
 		{
 			InertializationRequester->RequestInertialization(BlendTime);
 			InertializationRequester->AddDebugRecord(*Context.AnimInstanceProxy, Context.GetCurrentNodeId());
+
+			TimeSinceLastRequest = 0.0f;
+			LastRequestBlendTime = BlendTime;
 		}
 		else
 		{
@@ -176,6 +193,7 @@ void FCitySampleAnimNode_RequestInertializationOnAssetChange::Update_AnyThread(c
 		if (bReinitialized)
 		{
 			CachedAnimationAsset = AssetPlayerNode->GetAnimAsset();
+			TimeSinceLastRequest = BIG_NUMBER;
 		}
 		bReinitialized = false;
 
@@ -186,9 +204,22 @@ void FCitySampleAnimNode_RequestInertializationOnAssetChange::Update_AnyThread(c
 			!UpdateCounter.WasSynchronizedCounter(Context.AnimInstanceProxy->GetUpdateCounter());
 		UpdateCounter.SynchronizeWith(Context.AnimInstanceProxy->GetUpdateCounter());
 
+		// The coalescing timer only advances while the node is relevant, so treat becoming relevant
+		// as an expired window rather than trusting a stale timestamp
+		TimeSinceLastRequest = bSkipForBecomingRelevant ? BIG_NUMBER : TimeSinceLastRequest + Context.GetDeltaTime();
+
 		if (!bSkipForBecomingRelevant)
 		{
 			bRequestInertialization = CachedAnimationAsset != CurrentAnimationAsset && CurrentAnimationAsset;
+
+			// Fast path: a request with the same or a shorter blend inside the coalescing window is
+			// already covered by the pending one; skip the graph walk for the inertialization node
+			if (bRequestInertialization && RequestCoalescingWindow > 0.0f
+				&& TimeSinceLastRequest < RequestCoalescingWindow && BlendTime >= LastRequestBlendTime)
+			{
+				bRequestInertialization = false;
+			}
+
 			if (bRequestInertialization)
 			{
 				UE::Anim::IInertializationRequester* InertializationRequester =
@@ -197,6 +228,9 @@ void FCitySampleAnimNode_RequestInertializationOnAssetChange::Update_AnyThread(c
 				{
 					InertializationRequester->RequestInertialization(BlendTime);
 					InertializationRequester->AddDebugRecord(*Context.AnimInstanceProxy, Context.GetCurrentNodeId());
+
+					TimeSinceLastRequest = 0.0f;
+					LastRequestBlendTime = BlendTime;
 				}
 				else
 				{
@@ -35,6 +35,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Settings, meta = (PinHiddenByDefault))
 	float BlendTime = 0.2f;
 
+	// Requests within this window of a previous request with the same or shorter blend time are
+	// dropped before walking the graph for the inertialization node, since the pending request
+	// already covers them. Set to 0 to issue every request.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Settings, meta = (PinHiddenByDefault, ClampMin = 0.0f))
+	float RequestCoalescingWindow = 0.1f;
+
 private:
 #if WITH_EDITORONLY_DATA
 	// If OnTrue, request when bInput is true; if OnChanged, request when bInput changes.
@@ -61,6 +67,10 @@ protected:
 	bool bLastInput = false;
 	bool bReinitialized = false;
 
+	// Time since this node last issued a request, and the blend time it asked for
+	float TimeSinceLastRequest = BIG_NUMBER;
+	float LastRequestBlendTime = 0.0f;
+
 	// Used to check if the node just became relevant.
 	FGraphTraversalCounter UpdateCounter;
 };
@@ -81,6 +91,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Settings, meta = (PinHiddenByDefault))
 	float BlendTime = 0.2f;
 
+	// Requests within this window of a previous request with the same or shorter blend time are
+	// dropped before walking the graph for the inertialization node, since the pending request
+	// already covers them. Set to 0 to issue every request.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Settings, meta = (PinHiddenByDefault, ClampMin = 0.0f))
+	float RequestCoalescingWindow = 0.1f;
+
 public: // FAnimNode_Base
 	virtual void Initialize_AnyThread(const FAnimationInitializeContext& Context) override;
 	virtual void CacheBones_AnyThread(const FAnimationCacheBonesContext& Context) override;
@@ -93,6 +109,10 @@ protected:
 	const UAnimationAsset* CachedAnimationAsset = nullptr;
 	bool bReinitialized = false;
 
+	// Time since this node last issued a request, and the blend time it asked for
+	float TimeSinceLastRequest = BIG_NUMBER;
+	float LastRequestBlendTime = 0.0f;
+
 	// Used to check if the node just became relevant.
 	FGraphTraversalCounter UpdateCounter;
 };
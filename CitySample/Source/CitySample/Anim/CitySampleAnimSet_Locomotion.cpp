@@ -1,8 +1,46 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "CitySampleAnimSet_Locomotion.h"
+#include "Animation/AnimSequence.h"
 
 UCitySampleAnimSet_Locomotion::UCitySampleAnimSet_Locomotion(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
-}
\ No newline at end of file
+}
+
+void UCitySampleAnimSet_Locomotion::PostLoad()
+{
+	Super::PostLoad();
+
+	CompileSelectionTable();
+}
+
+#if WITH_EDITOR
+void UCitySampleAnimSet_Locomotion::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	CompileSelectionTable();
+}
+#endif
+
+UAnimSequence* UCitySampleAnimSet_Locomotion::GetCycleForSpeed(const float Speed) const
+{
+	constexpr float BucketsPerUnitSpeed = NumSpeedBuckets / MaxTableSpeed;
+	const int32 Bucket = FMath::Clamp(FMath::TruncToInt32(Speed * BucketsPerUnitSpeed), 0, NumSpeedBuckets - 1);
+	return SpeedBucketTable[Bucket];
+}
+
+void UCitySampleAnimSet_Locomotion::CompileSelectionTable()
+{
+	constexpr float BucketWidth = MaxTableSpeed / NumSpeedBuckets;
+
+	for (int32 Bucket = 0; Bucket < NumSpeedBuckets; ++Bucket)
+	{
+		const float BucketCenterSpeed = (Bucket + 0.5f) * BucketWidth;
+		UAnimSequence* Cycle = BucketCenterSpeed >= QuickWalkSpeedThreshold ? WalkFwdQuicklyCycle : WalkFwdCycle;
+
+		// Fall back to whichever cycle is assigned if the preferred one is missing
+		SpeedBucketTable[Bucket] = Cycle ? Cycle : (WalkFwdCycle ? WalkFwdCycle.Get() : WalkFwdQuicklyCycle.Get());
+	}
+}
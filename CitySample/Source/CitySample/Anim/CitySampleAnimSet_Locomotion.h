@@ -21,5 +21,31 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Core Locomotion")
 	TObjectPtr<UAnimSequence> WalkFwdQuicklyCycle;
-};
 
+	// Speed in cm/s at and above which WalkFwdQuicklyCycle is selected
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Core Locomotion")
+	float QuickWalkSpeedThreshold = 200.0f;
+
+	// Resolves the locomotion cycle for a movement speed with a single index into the speed bucket
+	// table compiled at load, so per-agent selection carries no branching
+	UFUNCTION(BlueprintPure, Category = "Core Locomotion")
+	UAnimSequence* GetCycleForSpeed(const float Speed) const;
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+
+	// Covers walking speeds; anything above the last bucket clamps to it
+	static constexpr int32 NumSpeedBuckets = 16;
+	static constexpr float MaxTableSpeed = 800.0f;
+
+	// Dense speed bucket to cycle table, compiled once in PostLoad (and on edit in the editor)
+	UPROPERTY(Transient)
+	TObjectPtr<UAnimSequence> SpeedBucketTable[NumSpeedBuckets];
+
+	void CompileSelectionTable();
+};
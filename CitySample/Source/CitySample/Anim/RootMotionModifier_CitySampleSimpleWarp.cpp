@@ -18,10 +18,61 @@ void URootMotionModifier_CitySampleSimpleWarp::OnTargetTransformChanged()
 	{
 		ActualStartTime = PreviousPosition;
 		StartTransform = CharacterOwner->GetActorTransform();
-		CachedRootMotion = UMotionWarpingUtilities::ExtractRootMotionFromAnimation(Animation.Get(), StartTime, EndTime);
+		BuildWarpWindowSamples();
+		CachedRootMotion = (WarpWindowSamples.Num() > 0) ? WarpWindowSamples.Last() : FTransform::Identity;
 	}
 }
 
+void URootMotionModifier_CitySampleSimpleWarp::BuildWarpWindowSamples()
+{
+	WarpWindowSamples.Reset();
+
+	const UAnimSequenceBase* AnimSequence = Animation.Get();
+	const float WindowLength = EndTime - StartTime;
+
+	if (AnimSequence == nullptr || WindowLength <= 0.f)
+	{
+		return;
+	}
+
+	// Sample densely enough to stay within a frame of the exact extraction, capped for long windows
+	static constexpr int32 SamplesPerSecond = 60;
+	static constexpr int32 MaxSegments = 255;
+	const int32 NumSegments = FMath::Clamp(FMath::CeilToInt(WindowLength * SamplesPerSecond), 1, MaxSegments);
+
+	WarpWindowSamples.Reserve(NumSegments + 1);
+	WarpWindowSamples.Add(FTransform::Identity);
+
+	for (int32 SegmentIndex = 1; SegmentIndex <= NumSegments; ++SegmentIndex)
+	{
+		const float SampleTime = StartTime + WindowLength * (static_cast<float>(SegmentIndex) / NumSegments);
+		WarpWindowSamples.Add(UMotionWarpingUtilities::ExtractRootMotionFromAnimation(AnimSequence, StartTime, SampleTime));
+	}
+}
+
+FTransform URootMotionModifier_CitySampleSimpleWarp::SampleCumulativeRootMotion(float Time) const
+{
+	if (WarpWindowSamples.Num() == 0)
+	{
+		return FTransform::Identity;
+	}
+
+	const float WindowLength = EndTime - StartTime;
+
+	if (WarpWindowSamples.Num() == 1 || WindowLength <= 0.f)
+	{
+		return WarpWindowSamples.Last();
+	}
+
+	const float SamplePosition = FMath::Clamp((Time - StartTime) / WindowLength, 0.f, 1.f) * (WarpWindowSamples.Num() - 1);
+	const int32 SampleIndex = FMath::Min(FMath::FloorToInt(SamplePosition), WarpWindowSamples.Num() - 2);
+	const float SampleFraction = SamplePosition - SampleIndex;
+
+	FTransform Result;
+	Result.Blend(WarpWindowSamples[SampleIndex], WarpWindowSamples[SampleIndex + 1], SampleFraction);
+	return Result;
+}
+
 FTransform URootMotionModifier_CitySampleSimpleWarp::ProcessRootMotion(const FTransform& InRootMotion, float DeltaSeconds)
 {
 	const ACharacter* CharacterOwner = Cast<ACharacter>(GetActorOwner());
@@ -34,7 +85,16 @@ FTransform URootMotionModifier_CitySampleSimpleWarp::ProcessRootMotion(const FTr
 
 	FTransform FinalRootMotion = InRootMotion;
 
-	const FTransform RootMotionTotal = UMotionWarpingUtilities::ExtractRootMotionFromAnimation(Animation.Get(), PreviousPosition, EndTime);
+	// Built by OnTargetTransformChanged; also covers warps whose target never changes after creation
+	if (WarpWindowSamples.Num() == 0)
+	{
+		BuildWarpWindowSamples();
+	}
+
+	// The cumulative table satisfies Extract(A, B) = Cumulative(B) relative to Cumulative(A), so both
+	// transforms below are blends of precomputed samples rather than fresh root motion extractions
+	const FTransform CumulativeToPrevious = SampleCumulativeRootMotion(PreviousPosition);
+	const FTransform RootMotionTotal = SampleCumulativeRootMotion(EndTime).GetRelativeTransform(CumulativeToPrevious);
 
 	if(bLerpTranslation)
 	{
@@ -51,7 +111,7 @@ FTransform URootMotionModifier_CitySampleSimpleWarp::ProcessRootMotion(const FTr
 	{
 		FVector DeltaTranslation = InRootMotion.GetTranslation();
 
-		const FTransform RootMotionDelta = UMotionWarpingUtilities::ExtractRootMotionFromAnimation(Animation.Get(), PreviousPosition, FMath::Min(CurrentPosition, EndTime));
+		const FTransform RootMotionDelta = SampleCumulativeRootMotion(FMath::Min(CurrentPosition, EndTime)).GetRelativeTransform(CumulativeToPrevious);
 
 		const float HorizontalDelta = RootMotionDelta.GetTranslation().Size2D();
 		const float HorizontalTarget = FVector::Dist2D(CharacterTransform.GetLocation(), GetTargetLocation());
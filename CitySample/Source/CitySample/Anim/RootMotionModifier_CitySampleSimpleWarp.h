@@ -46,6 +46,17 @@ protected:
 	UPROPERTY()
 	FTransform CachedRootMotion;
 
+	/** Builds the cumulative root motion table for the current warp window */
+	void BuildWarpWindowSamples();
+
+	/** Returns the root motion accumulated from StartTime to the given time, blended from the precomputed table */
+	FTransform SampleCumulativeRootMotion(float Time) const;
+
+	/** Cumulative root motion from StartTime, sampled evenly across the warp window. Built once when
+	* the warp window or target changes so ProcessRootMotion is a table lookup and blend per tick
+	* instead of two root motion extractions per warping character */
+	TArray<FTransform> WarpWindowSamples;
+
 public:
 
 	/** Wrapper function to add warping targets to reduce friction during merges while using the old motion warping API */
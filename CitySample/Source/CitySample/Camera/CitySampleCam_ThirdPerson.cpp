@@ -236,7 +236,7 @@ void UCitySampleCam_ThirdPerson::UpdateCamera(class AActor* ViewTarget, UCineCam
 		// Smooth the pivot transform to feel good
 		FTransform SmoothedPivotToWorld = PivotToWorld;
 		{
-			// smooth rotation	
+			// smooth rotation
 			FRotator const SmoothedPivotRot = ComputeSmoothPivotRotation(PivotToWorld.Rotator(), DeltaTime);
 			SmoothedPivotToWorld.SetRotation(SmoothedPivotRot.Quaternion());
 
@@ -246,14 +246,20 @@ void UCitySampleCam_ThirdPerson::UpdateCamera(class AActor* ViewTarget, UCineCam
 				PivotLocInterpolator.Reset();
 			}
 
-			FVector const SmoothedPivotLoc = PivotLocInterpolator.Eval(PivotToWorld.GetLocation(), DeltaTime);
+			// step the translation interpolators together in one SoA batch eval,
+			// including the camera to pivot interpolation used after this
+			InterpolatorBatch.Reset();
+			const FIIRInterpolatorBatch::FChannelHandle PivotLocChannels = PivotLocInterpolator.AddToBatch(InterpolatorBatch, PivotToWorld.GetLocation());
+			const FIIRInterpolatorBatch::FChannelHandle CameraToPivotChannels = CameraToPivotTranslationInterpolator.AddToBatch(InterpolatorBatch, GetBaseCameraToPivot(ViewTarget).GetTranslation());
+			InterpolatorBatch.Eval(DeltaTime);
+
+			FVector const SmoothedPivotLoc = PivotLocInterpolator.ReadFromBatch(InterpolatorBatch, PivotLocChannels);
 			SmoothedPivotToWorld.SetLocation(SmoothedPivotLoc);
+
+			CameraToPivotTranslationInterpolator.ReadFromBatch(InterpolatorBatch, CameraToPivotChannels);
 		}
 		LastPivotToWorld = SmoothedPivotToWorld;
 
-		// update camera to pivot interpolation, which will be used after this
-		CameraToPivotTranslationInterpolator.Eval(GetBaseCameraToPivot(ViewTarget).GetTranslation(), DeltaTime);
-
 		// Get final ideal camera location
 		FTransform const CameraToWorld = ComputeCameraToWorld(ViewTarget, SmoothedPivotToWorld);
 		FVector const CameraGoalLoc = CameraToWorld.GetLocation();
@@ -412,9 +418,6 @@ void UCitySampleCam_ThirdPerson::PreventCameraPenetration(AActor* Target, TArray
 	BaseRayMatrix.GetScaledAxes(BaseRayLocalFwd, BaseRayLocalRight, BaseRayLocalUp);
 	float DistBlockedPctThisFrame = 1.f;
 
-	FCollisionQueryParams SphereParams(SCENE_QUERY_STAT(CameraPenetration), false, Target);
-	FCollisionShape SphereShape = FCollisionShape::MakeSphere(0.f);
-	
 	BlockingActors.Empty();
 
 	for (auto& Ray : Rays)
@@ -436,13 +439,13 @@ void UCitySampleCam_ThirdPerson::PreventCameraPenetration(AActor* Target, TArray
 					RayTarget = SafeLoc + RotatedRay;
 				}
 
-				SphereShape.Sphere.Radius = Ray.Radius;
-				ECollisionChannel TraceChannel = ECC_Camera;
-
 				FHitResult Hit;
 				const FVector TraceStart = SafeLoc;
 				const FVector TraceEnd = RayTarget;
-				bool bHit = World->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity, TraceChannel, SphereShape, SphereParams);
+
+				// sweep through the camera manager, which shares results between modes tracing
+				// nearly identical rays while blending
+				bool bHit = PlayerCamera->SweepPenetrationRay(TraceStart, TraceEnd, Ray.Radius, Target, Hit);
 				Ray.FramesUntilNextTrace = Ray.TraceInterval;
 
 #if ENABLE_DRAW_DEBUG
@@ -315,6 +315,9 @@ protected:
 	virtual FRotator ComputeSmoothPivotRotation(const FRotator IdealPivotToWorldRot, float DeltaTime);
 
 
+	/** Batches this mode's translation interpolators into one SoA eval per update */
+	FIIRInterpolatorBatch InterpolatorBatch;
+
 	/** Cache of previous pivot to world transform post-smoothing */
 	FTransform LastPivotToWorld;
 
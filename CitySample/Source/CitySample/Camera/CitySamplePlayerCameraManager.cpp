@@ -5,13 +5,21 @@
 #include "Camera/CameraActor.h"
 #include "Camera/CameraComponent.h"
 #include "CineCameraComponent.h"
+#include "CollisionQueryParams.h"
 #include "Components/CapsuleComponent.h"
 #include "Engine/Canvas.h"
+#include "Engine/World.h"
 #include "Game/CitySamplePlayerController.h"
 #include "GameFramework/Character.h"
 #include "Kismet/GameplayStatics.h"
 #include "PhysicsEngine/PhysicsSettings.h"
 
+static float CameraMinEvalBlendWeight = 0.05f;
+FAutoConsoleVariableRef CVar_CameraMinEvalBlendWeight(TEXT("CitySample.CameraMinEvalBlendWeight"), CameraMinEvalBlendWeight, TEXT("Outgoing cameras whose normalized blend weight is below this hold their last POV instead of running a full evaluation."), ECVF_Default);
+
+static float CameraSharedSweepTolerance = 10.f;
+FAutoConsoleVariableRef CVar_CameraSharedSweepTolerance(TEXT("CitySample.CameraSharedSweepTolerance"), CameraSharedSweepTolerance, TEXT("Distance in cm within which penetration avoidance sweeps from different camera modes are considered identical and share one result. 0 disables sharing."), ECVF_Default);
+
 ACitySamplePlayerCameraManager::ACitySamplePlayerCameraManager(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -116,6 +124,40 @@ void ACitySamplePlayerCameraManager::UpdateCameraInStack(int32 StackIdx, float D
 	}
 }
 
+bool ACitySamplePlayerCameraManager::SweepPenetrationRay(const FVector& Start, const FVector& End, float SphereRadius, AActor* IgnoreTarget, FHitResult& OutHit)
+{
+	if (CameraSharedSweepTolerance > 0.f)
+	{
+		for (const FCitySampleCachedPenetrationSweep& CachedSweep : CachedPenetrationSweeps)
+		{
+			// only reuse sweeps that ignored the same target, e.g. modes viewing the character
+			// cannot share with modes viewing the vehicle it is entering
+			if ((CachedSweep.IgnoredTarget == IgnoreTarget) &&
+				(CachedSweep.Radius == SphereRadius) &&
+				CachedSweep.Start.Equals(Start, CameraSharedSweepTolerance) &&
+				CachedSweep.End.Equals(End, CameraSharedSweepTolerance))
+			{
+				OutHit = CachedSweep.Hit;
+				return CachedSweep.bHit;
+			}
+		}
+	}
+
+	FCollisionQueryParams SphereParams(SCENE_QUERY_STAT(CameraPenetration), false, IgnoreTarget);
+	const FCollisionShape SphereShape = FCollisionShape::MakeSphere(SphereRadius);
+	const bool bHit = GetWorld()->SweepSingleByChannel(OutHit, Start, End, FQuat::Identity, ECC_Camera, SphereShape, SphereParams);
+
+	FCitySampleCachedPenetrationSweep& NewSweep = CachedPenetrationSweeps.AddDefaulted_GetRef();
+	NewSweep.Start = Start;
+	NewSweep.End = End;
+	NewSweep.Radius = SphereRadius;
+	NewSweep.IgnoredTarget = IgnoreTarget;
+	NewSweep.bHit = bHit;
+	NewSweep.Hit = OutHit;
+
+	return bHit;
+}
+
 ACitySamplePlayerController* ACitySamplePlayerCameraManager::GetOwningCitySamplePC() const
 {
 	return Cast<ACitySamplePlayerController>(PCOwner);
@@ -197,6 +239,9 @@ void ACitySamplePlayerCameraManager::UpdateViewTarget(struct FTViewTarget& OutVT
 		return;
 	}
 
+	// Penetration sweeps are only shareable within a single update
+	CachedPenetrationSweeps.Reset();
+
 	// If our viewtarget is simulating using physics, we may need to clamp deltatime
 	{
 		const USceneComponent* const TargetRoot = OutVT.Target->GetRootComponent();
@@ -393,10 +438,20 @@ void ACitySamplePlayerCameraManager::UpdateViewTarget(struct FTViewTarget& OutVT
 		{
 			FActiveCitySampleCamera& CamEntry = CameraBlendStack[StackIdx];
 
-			UpdateCameraInStack(StackIdx, DeltaTime, OutVT);
-
 			CamEntry.BlendWeight /= TotalWeight;
 
+			// Outgoing cameras that barely contribute to the blend aren't worth a full evaluation
+			// (and the penetration traces that come with it), so hold their last POV, same as the
+			// bLockOutgoingPOV path
+			if (CamEntry.BlendWeight < CameraMinEvalBlendWeight)
+			{
+				OutVT.POV = CamEntry.LastPOV;
+			}
+			else
+			{
+				UpdateCameraInStack(StackIdx, DeltaTime, OutVT);
+			}
+
 			BlendedPOV.AddWeightedViewInfo(OutVT.POV, CamEntry.BlendWeight);
 
 			BlendedPOV.PostProcessSettings.bOverride_DepthOfFieldFstop |= OutVT.POV.PostProcessSettings.bOverride_DepthOfFieldFstop;
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Camera/PlayerCameraManager.h"
 #include "Camera/CitySampleCameraMode.h"
+#include "Engine/HitResult.h"
 
 #include "CitySamplePlayerCameraManager.generated.h"
 
@@ -62,6 +63,21 @@ public:
 	bool bLockOutgoingPOV = false;
 };
 
+/**
+ * One camera penetration avoidance sweep performed this frame. The camera manager caches
+ * these so camera modes blending against the same view target can reuse each other's
+ * results instead of re-sweeping nearly identical rays.
+ */
+struct FCitySampleCachedPenetrationSweep
+{
+	FVector Start = FVector::ZeroVector;
+	FVector End = FVector::ZeroVector;
+	float Radius = 0.f;
+	AActor* IgnoredTarget = nullptr;
+	bool bHit = false;
+	FHitResult Hit;
+};
+
 /** Instances of camera modes that can be used/reused to support active cameras */
 USTRUCT(BlueprintType)
 struct FCitySampleCameraModeInstance
@@ -120,6 +136,13 @@ public:
 		return TransitionGoalPOV;
 	}
 
+	/**
+	 * Sweeps a penetration avoidance ray on the camera channel, reusing a matching sweep already
+	 * performed this frame when one exists. Blending camera modes trace nearly identical rays, so
+	 * sharing results here keeps transitions from doubling the penetration trace cost.
+	 */
+	bool SweepPenetrationRay(const FVector& Start, const FVector& End, float SphereRadius, AActor* IgnoreTarget, FHitResult& OutHit);
+
 	/** Applies a premade camera style for debugging purposes */
 	UFUNCTION(BlueprintCallable, Category = Camera)
 	void SetDebugCameraStyle(EDebugCameraStyle NewDebugCameraStyle);
@@ -222,6 +245,9 @@ private:
 	/** Removes any existing camera mode instances that don't currently have a view target set */
 	void CleanUpOutdatedCameraModeInstances();
 
+	/** Penetration avoidance sweeps performed so far this update, reusable by other camera modes */
+	TArray<FCitySampleCachedPenetrationSweep> CachedPenetrationSweeps;
+
 	/** The destination POV of an active transition */
 	FMinimalViewInfo TransitionGoalPOV;
 
@@ -2,9 +2,16 @@
 
 #include "Camera/PhotoModeComponent.h"
 
+#include "Async/Async.h"
+#include "Engine/GameViewportClient.h"
 #include "EnhancedInputSubsystems.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
 #include "InputAction.h"
 #include "InputMappingContext.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UnrealClient.h"
 
 #include "HoverDroneMovementComponent.h"
 
@@ -35,6 +42,104 @@ void UPhotoModeComponent::OnComponentCreated()
 	SaveCurrentSettingsAsDefault();
 }
 
+void UPhotoModeComponent::OnComponentDestroyed(bool bDestroyingHierarchy)
+{
+	if (PhotoCapturedHandle.IsValid())
+	{
+		if (const UWorld* World = GetWorld())
+		{
+			if (UGameViewportClient* Viewport = World->GetGameViewport())
+			{
+				Viewport->OnScreenshotCaptured().Remove(PhotoCapturedHandle);
+			}
+		}
+
+		PhotoCapturedHandle.Reset();
+	}
+
+	if (IsValid(CameraPawn))
+	{
+		CameraPawn->Destroy();
+	}
+	CameraPawn = nullptr;
+	HoverDroneMovementComp = nullptr;
+
+	Super::OnComponentDestroyed(bDestroyingHierarchy);
+}
+
+bool UPhotoModeComponent::TakePhoto(int32 ResolutionMultiplier)
+{
+	const UWorld* World = GetWorld();
+	UGameViewportClient* Viewport = World ? World->GetGameViewport() : nullptr;
+	if (Viewport == nullptr || bPhotoCapturePending)
+	{
+		return false;
+	}
+
+	// Make sure the encoder module is loaded here on the game thread before the worker needs it
+	FModuleManager::Get().LoadModuleChecked<IImageWrapperModule>("ImageWrapper");
+
+	// Resolve through the screenshot delegate rather than the blocking high-res screenshot file path
+	if (!PhotoCapturedHandle.IsValid())
+	{
+		PhotoCapturedHandle = Viewport->OnScreenshotCaptured().AddUObject(this, &UPhotoModeComponent::OnPhotoCaptured);
+	}
+
+	if (ResolutionMultiplier > 1 && Viewport->Viewport != nullptr)
+	{
+		const FIntPoint ViewportSize = Viewport->Viewport->GetSizeXY();
+		GScreenshotResolutionX = ViewportSize.X * ResolutionMultiplier;
+		GScreenshotResolutionY = ViewportSize.Y * ResolutionMultiplier;
+	}
+
+	bPhotoCapturePending = true;
+	FScreenshotRequest::RequestScreenshot(/*bInShowUI=*/false);
+
+	return true;
+}
+
+void UPhotoModeComponent::OnPhotoCaptured(int32 Width, int32 Height, const TArray<FColor>& Colors)
+{
+	if (!bPhotoCapturePending)
+	{
+		return;
+	}
+	bPhotoCapturePending = false;
+
+	const FString FilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Photos"), FString::Printf(TEXT("Photo_%s.png"), *FDateTime::Now().ToString()));
+
+	// The delegate's pixel array belongs to the viewport, so take a copy for the worker
+	TArray<FColor> Pixels = Colors;
+	TWeakObjectPtr<UPhotoModeComponent> WeakThis(this);
+
+	Async(EAsyncExecution::ThreadPool, [Pixels = MoveTemp(Pixels), Width, Height, FilePath, WeakThis]()
+	{
+		IImageWrapperModule& ImageWrapperModule = FModuleManager::GetModuleChecked<IImageWrapperModule>("ImageWrapper");
+		TSharedPtr<IImageWrapper> Wrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::PNG);
+
+		bool bSaved = false;
+		if (Wrapper.IsValid() && Wrapper->SetRaw(Pixels.GetData(), Pixels.Num() * sizeof(FColor), Width, Height, ERGBFormat::BGRA, 8))
+		{
+			const TArray64<uint8> PngBytes = Wrapper->GetCompressed();
+			bSaved = FFileHelper::SaveArrayToFile(PngBytes, *FilePath);
+		}
+
+		if (!bSaved)
+		{
+			UE_LOG(LogCitySamplePhotoMode, Warning, TEXT("Failed to encode or save photo to %s"), *FilePath);
+			return;
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, FilePath]()
+		{
+			if (UPhotoModeComponent* PhotoModeComponent = WeakThis.Get())
+			{
+				PhotoModeComponent->OnPhotoSaved.Broadcast(FilePath);
+			}
+		});
+	});
+}
+
 void UPhotoModeComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
@@ -128,23 +233,43 @@ bool UPhotoModeComponent::ActivatePhotoMode()
 	}
 
 	const FMinimalViewInfo POV = CitySamplePlayerCameraManager->ViewTarget.POV;
-	CameraPawn = Cast<ACitySampleHoverDrone>(GetWorld()->SpawnActor(PhotomodePawnClass.Get(), &POV.Location, &POV.Rotation));
-	HoverDroneMovementComp = CameraPawn->FindComponentByClass<UHoverDroneMovementComponent>();
+	if (IsValid(CameraPawn))
+	{
+		// Reuse the pawn parked by the previous deactivation. The teleport routes through
+		// UHoverDroneMovementComponent::OnTeleported/Init, which re-anchors the movement
+		// component's rotation goals to the new transform.
+		CameraPawn->SetActorHiddenInGame(false);
+		CameraPawn->SetActorEnableCollision(true);
+		CameraPawn->SetActorTickEnabled(true);
 
-	StartingLocation = CameraPawn->GetActorLocation();
-	StartingRotation = CameraPawn->GetActorRotation();
+		if (HoverDroneMovementComp != nullptr)
+		{
+			HoverDroneMovementComp->SetComponentTickEnabled(true);
+			HoverDroneMovementComp->StopMovementImmediately();
+		}
 
-	//Make it so that our new pawn doesn't create physics interactions with physics simulating entities
-	if (USphereComponent* const CollisionComp = CameraPawn->GetCollisionComponent())
-	{
-		CollisionComp->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+		CameraPawn->TeleportTo(POV.Location, POV.Rotation, /*bIsATest=*/false, /*bNoCheck=*/true);
 	}
-
-	if (UMeshComponent* const MeshComp = CameraPawn->GetMeshComponent())
+	else
 	{
-		MeshComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		CameraPawn = Cast<ACitySampleHoverDrone>(GetWorld()->SpawnActor(PhotomodePawnClass.Get(), &POV.Location, &POV.Rotation));
+		HoverDroneMovementComp = CameraPawn->FindComponentByClass<UHoverDroneMovementComponent>();
+
+		//Make it so that our new pawn doesn't create physics interactions with physics simulating entities
+		if (USphereComponent* const CollisionComp = CameraPawn->GetCollisionComponent())
+		{
+			CollisionComp->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+		}
+
+		if (UMeshComponent* const MeshComp = CameraPawn->GetMeshComponent())
+		{
+			MeshComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		}
 	}
 
+	StartingLocation = CameraPawn->GetActorLocation();
+	StartingRotation = CameraPawn->GetActorRotation();
+
 	ACitySampleGameState* const CitySampleGameState = UCitySampleBlueprintLibrary::GetCitySampleGameState(GetWorld());
 	if (CitySampleGameState != nullptr)
 	{
@@ -203,9 +328,17 @@ void UPhotoModeComponent::DeactivatePhotoMode()
 		EndingLocation = CameraPawn->GetActorLocation();
 		EndingRotation = CameraPawn->GetActorRotation();
 
-		CameraPawn->Destroy();
-		CameraPawn = nullptr;
-		HoverDroneMovementComp = nullptr;
+		// Park the pawn for the next activation instead of destroying it, so toggling
+		// photo mode doesn't pay the spawn and initialization cost every time
+		CameraPawn->SetActorHiddenInGame(true);
+		CameraPawn->SetActorEnableCollision(false);
+		CameraPawn->SetActorTickEnabled(false);
+
+		if (HoverDroneMovementComp != nullptr)
+		{
+			HoverDroneMovementComp->StopMovementImmediately();
+			HoverDroneMovementComp->SetComponentTickEnabled(false);
+		}
 	}
 
 	bool bValidOldPawn = OldPawn != nullptr;
@@ -225,16 +358,26 @@ void UPhotoModeComponent::DeactivatePhotoMode()
 	if (bValidOldPawn)
 	{
 		/**If our old pawn was an instance of CitySamplePC's drone pawn class, it's safe to assume we're returning back to drone mode.
-		   We spawn a new drone actor instead of reusing the previous one because the current CitySampleHoverDrone implementation does some
-		   movement work under the hood that undos any direct rotation changes to the actor or control rotation. Spawning a fresh instance ensures we get the correct behavior.*/
+		   Teleporting routes through UHoverDroneMovementComponent::OnTeleported/Init, which re-anchors the rotation goals the
+		   movement component would otherwise interpolate back toward, so the previous drone can be reused at the new transform
+		   instead of being destroyed and respawned.*/
 		UClass* const DroneClass = RequestingPlayer->GetDronePawnClass();
 		if (OldPawn->IsA(DroneClass))
 		{
-			OldPawn->Destroy();
-
-			OldPawn = Cast<APawn>(GetWorld()->SpawnActor(DroneClass, &EndingLocation, &EndingRotation));
+			OldPawn->TeleportTo(EndingLocation, EndingRotation, /*bIsATest=*/false, /*bNoCheck=*/true);
 			bWasOldPawnADrone = true;
 		}
+		else
+		{
+			// Returning to a pawn left far behind while in photo mode: start streaming its
+			// surroundings before the possession so the long distance transition below
+			// overlaps the load with the fade-out instead of serializing them
+			const float ReturnDistance = (OldPawn->GetActorLocation() - EndingLocation).Size2D();
+			if (ReturnDistance > RequestingPlayer->GetCameraTransitionLevelStreamDistance2D())
+			{
+				RequestingPlayer->PrefetchLongDistanceCameraTransition(OldPawn->GetActorLocation());
+			}
+		}
 
 		RequestingPlayer->Possess(OldPawn);
 	}
@@ -13,6 +13,7 @@ class ACitySampleHoverDrone;
 DECLARE_LOG_CATEGORY_EXTERN(LogCitySamplePhotoMode, Log, All);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnPhotoModeActivated);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPhotoSaved, const FString&, FilePath);
 
 /**
  * Enum to help manage Photo Mode states
@@ -66,8 +67,22 @@ public:
 
 	//~ Begin ActorComponent Interface
 	virtual void OnComponentCreated() override;
+	virtual void OnComponentDestroyed(bool bDestroyingHierarchy) override;
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
 	//~ End ActorComponent Interface
+
+	/**
+	 * Captures a photo without blocking the game thread. The capture resolves through the viewport
+	 * screenshot delegate, PNG encoding runs on the thread pool, and the file write happens off the
+	 * game thread; OnPhotoSaved broadcasts once the photo is on disk. Returns false if a capture is
+	 * already pending.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Capture")
+	bool TakePhoto(int32 ResolutionMultiplier = 1);
+
+	/** Broadcast on the game thread once a captured photo has been encoded and written to disk */
+	UPROPERTY(BlueprintAssignable, Category = "Capture")
+	FOnPhotoSaved OnPhotoSaved;
 	
 	UFUNCTION(BlueprintPure)
 	EPhotoModeState GetPhotoModeState() const
@@ -231,6 +246,15 @@ private:
 	UFUNCTION()
 	void OnVehicleDriverExit(class UDrivableVehicleComponent* const DrivableComponent, class ACitySampleVehicleBase* const Vehicle, APawn* const Driver);
 
+	/** Receives the pixels for a pending TakePhoto capture and kicks off the background encode and file write */
+	void OnPhotoCaptured(int32 Width, int32 Height, const TArray<FColor>& Colors);
+
+	/** Handle for the viewport screenshot delegate used by TakePhoto */
+	FDelegateHandle PhotoCapturedHandle;
+
+	/** True while a TakePhoto capture is waiting on the viewport */
+	bool bPhotoCapturePending = false;
+
 	/** Camera Mode to use for Photo Mode */
 	UPROPERTY(EditDefaultsOnly)
 	TSubclassOf<UCitySampleCamera_PhotoMode> PhotoModeClass;
@@ -239,7 +263,7 @@ private:
 	UPROPERTY(EditDefaultsOnly)
 	FPhotoModeSettings Settings;
 
-	/** Reference to pawn that is spawned and possessed when activating PhotoMode */
+	/** Pawn possessed while in Photo Mode. Spawned on first activation, then parked hidden and reused by later activations. */
 	UPROPERTY(Transient)
 	class ACitySampleHoverDrone* CameraPawn = nullptr;
 
@@ -13,6 +13,7 @@
 #include "MotionWarpingComponent.h"
 
 #include "Character/CitySampleCharacterMovementComponent.h"
+#include "Character/CitySampleCharacterQueryComponent.h"
 #include "CitySample.h"
 #include "Game/CitySamplePlayerController.h"
 #include "Util/CitySampleBlueprintLibrary.h"
@@ -58,6 +59,8 @@ ACitySampleCharacter::ACitySampleCharacter(const FObjectInitializer& ObjectIniti
 
 	MotionWarpingComponent = CreateDefaultSubobject<UMotionWarpingComponent>(TEXT("MotionWarpingComponent"));
 	MotionWarpingComponent->bSearchForWindowsInAnimsWithinMontages = true;
+
+	CharacterQueryComponent = CreateDefaultSubobject<UCitySampleCharacterQueryComponent>(TEXT("CharacterQueryComponent"));
 }
 
 void ACitySampleCharacter::SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent)
@@ -12,6 +12,7 @@
 
 #include "CitySampleCharacter.generated.h"
 
+class UCitySampleCharacterQueryComponent;
 class UMotionWarpingComponent;
 
 UCLASS()
@@ -89,6 +90,13 @@ public:
 	UFUNCTION(BlueprintCallable)
 	bool IsDriving() const;
 
+	/** Returns the consolidated query component this character's systems should route their recurring scene queries through */
+	UFUNCTION(BlueprintPure)
+	UCitySampleCharacterQueryComponent* GetCharacterQueryComponent() const
+	{
+		return CharacterQueryComponent;
+	}
+
 protected:
 
 	//~ Begin APawn interface
@@ -124,6 +132,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics")
 	UMotionWarpingComponent* MotionWarpingComponent;
 
+	/** Batches the recurring trace/overlap needs of this character's systems into one async submission per frame */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Physics")
+	UCitySampleCharacterQueryComponent* CharacterQueryComponent;
+
 	/** Mapping of pawn relevant InputActions to their string description for the controls overlay UI. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Controls Overlay")
 	TMap<UInputAction*, FText> InputActionDescriptions;
@@ -24,6 +24,113 @@ namespace CitySampleCharacterMovementStatics
 		TEXT("0: Disable, 1: Enable"),
 		ECVF_Cheat);
 #endif
+
+	static float AgentFloorCheckInterval = 0.2f;
+	FAutoConsoleVariableRef CVarAgentFloorCheckInterval(
+		TEXT("CitySample.AgentMovement.FloorCheckInterval"),
+		AgentFloorCheckInterval,
+		TEXT("Seconds between full floor sweeps for pawns using the agent movement fast path.\n")
+		TEXT("Cached results are reused in between. 0 runs the sweep every query."),
+		ECVF_Default);
+
+	static float AgentFloorCacheDrift = 25.0f;
+	FAutoConsoleVariableRef CVarAgentFloorCacheDrift(
+		TEXT("CitySample.AgentMovement.FloorCacheDrift"),
+		AgentFloorCacheDrift,
+		TEXT("How far (cm) a fast path pawn may move from where its floor was last swept before the cached result is discarded."),
+		ECVF_Default);
+}
+
+void UCitySampleCharacterMovementComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Apply the side effects here as well so the flag can be set on archetypes
+	if (bAgentMovementFastPath)
+	{
+		ApplyAgentMovementFastPath(true);
+	}
+}
+
+void UCitySampleCharacterMovementComponent::SetAgentMovementFastPath(bool bEnabled)
+{
+	if (bAgentMovementFastPath != bEnabled)
+	{
+		bAgentMovementFastPath = bEnabled;
+		ApplyAgentMovementFastPath(bEnabled);
+	}
+}
+
+void UCitySampleCharacterMovementComponent::ApplyAgentMovementFastPath(bool bEnabled)
+{
+	if (bEnabled)
+	{
+		bSavedEnablePhysicsInteraction = bEnablePhysicsInteraction;
+		bSavedUseRVOAvoidance = bUseRVOAvoidance;
+		bSavedAlwaysCheckFloor = bAlwaysCheckFloor;
+
+		SetAvoidanceEnabled(false);
+		bEnablePhysicsInteraction = false;
+		bAlwaysCheckFloor = false;
+	}
+	else
+	{
+		SetAvoidanceEnabled(bSavedUseRVOAvoidance);
+		bEnablePhysicsInteraction = bSavedEnablePhysicsInteraction;
+		bAlwaysCheckFloor = bSavedAlwaysCheckFloor;
+	}
+
+	CachedAgentFloorTime = -1.0f;
+	bForceNextFloorCheck = true;
+}
+
+void UCitySampleCharacterMovementComponent::FindFloor(const FVector& CapsuleLocation, FFindFloorResult& OutFloorResult, bool bCanUseCachedLocation, const FHitResult* DownwardSweepResult) const
+{
+	using namespace CitySampleCharacterMovementStatics;
+
+	if (bAgentMovementFastPath && bCanUseCachedLocation && !bForceNextFloorCheck && DownwardSweepResult == nullptr &&
+		MovementMode == MOVE_Walking && AgentFloorCheckInterval > 0.0f)
+	{
+		const UWorld* const World = GetWorld();
+		if (World && CachedAgentFloor.bWalkableFloor && World->TimeSince(CachedAgentFloorTime) < AgentFloorCheckInterval)
+		{
+			const FVector Drift = CapsuleLocation - CachedAgentFloorLocation;
+			if (Drift.SizeSquared2D() <= FMath::Square(AgentFloorCacheDrift) && FMath::Abs(Drift.Z) <= AgentFloorCacheDrift)
+			{
+				// Reuse the last sweep, shifted by however far the capsule has moved vertically.
+				// The cached hit (movement base, physical material) can go slightly stale between
+				// sweeps, which is acceptable for agent-driven pawns.
+				OutFloorResult = CachedAgentFloor;
+				OutFloorResult.FloorDist = CachedAgentFloor.FloorDist + Drift.Z;
+				if (CachedAgentFloor.bLineTrace)
+				{
+					OutFloorResult.LineDist = CachedAgentFloor.LineDist + Drift.Z;
+				}
+				return;
+			}
+		}
+	}
+
+	Super::FindFloor(CapsuleLocation, OutFloorResult, bCanUseCachedLocation, DownwardSweepResult);
+
+	if (bAgentMovementFastPath)
+	{
+		CachedAgentFloor = OutFloorResult;
+		CachedAgentFloorLocation = CapsuleLocation;
+		CachedAgentFloorTime = GetWorld() ? GetWorld()->GetTimeSeconds() : -1.0f;
+	}
+}
+
+bool UCitySampleCharacterMovementComponent::StepUp(const FVector& GravDir, const FVector& Delta, const FHitResult& Hit, FStepDownResult* OutStepDownResult)
+{
+	if (bAgentMovementFastPath)
+	{
+		// Skip the post-step floor sweep; the cached floor path in FindFloor resolves the
+		// new floor on the next query instead
+		return Super::StepUp(GravDir, Delta, Hit, nullptr);
+	}
+
+	return Super::StepUp(GravDir, Delta, Hit, OutStepDownResult);
 }
 
 void UCitySampleCharacterMovementComponent::PhysicsRotation(float DeltaTime)
@@ -14,13 +14,20 @@ class CITYSAMPLE_API UCitySampleCharacterMovementComponent : public UCharacterMo
 {
 	GENERATED_BODY()
 
+	//~ Begin UActorComponent Interface
+public:
+	virtual void BeginPlay() override;
+	//~ End UActorComponent Interface
+
 	//~ Begin UCharacterMovementComponent Interface
 public:
 	virtual void PhysicsRotation(float DeltaTime) override;
+	virtual void FindFloor(const FVector& CapsuleLocation, FFindFloorResult& OutFloorResult, bool bCanUseCachedLocation, const FHitResult* DownwardSweepResult = NULL) const override;
 
 protected:
 	virtual FVector ConstrainInputAcceleration(const FVector& InputAcceleration) const override;
 	virtual float SlideAlongSurface(const FVector& Delta, float Time, const FVector& Normal, FHitResult& Hit, bool bHandleImpact) override;
+	virtual bool StepUp(const FVector& GravDir, const FVector& Delta, const FHitResult& Hit, FStepDownResult* OutStepDownResult = NULL) override;
 	//~ End UCharacterMovementComponent Interface
 
 
@@ -28,6 +35,21 @@ public:
 	UFUNCTION(BlueprintPure)
 	bool WasSlideAlongSurfaceBlockedRecently(float Tolerance = 0.01f) const;
 
+	/**
+	 * Toggles the reduced-fidelity movement path for agent-driven pawns. While enabled, floor
+	 * sweeps run on an interval (CitySample.AgentMovement.FloorCheckInterval) with cached results
+	 * reused in between, avoidance and physics interaction are disabled, and step-up skips its
+	 * post-step floor sweep. Player-possessed pawns should leave this off.
+	 */
+	UFUNCTION(BlueprintCallable)
+	void SetAgentMovementFastPath(bool bEnabled);
+
+	UFUNCTION(BlueprintPure)
+	bool IsAgentMovementFastPathEnabled() const
+	{
+		return bAgentMovementFastPath;
+	}
+
 protected:
 	// ConstraintInputAcceleration will interpolate the input size to go from this value to 1.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
@@ -44,7 +66,23 @@ protected:
 	UPROPERTY(Transient, BlueprintReadOnly)
 	bool bLastSurfaceWasCharacter = false;
 
+	// Reduced-fidelity path for agent-driven pawns, see SetAgentMovementFastPath
+	UPROPERTY(EditAnywhere, Category = "Agent Movement")
+	bool bAgentMovementFastPath = false;
+
 private:
+	void ApplyAgentMovementFastPath(bool bEnabled);
+
+	// Floor sweep result reused between interval checks while the fast path is active
+	mutable FFindFloorResult CachedAgentFloor;
+	mutable FVector CachedAgentFloorLocation = FVector::ZeroVector;
+	mutable float CachedAgentFloorTime = -1.0f;
+
+	// Captured when the fast path is enabled so disabling it restores the configured behavior
+	bool bSavedEnablePhysicsInteraction = true;
+	bool bSavedUseRVOAvoidance = false;
+	bool bSavedAlwaysCheckFloor = true;
+
 	UPROPERTY(EditDefaultsOnly)
 	bool bUseAnimAuthoritativeRotation = true;
 
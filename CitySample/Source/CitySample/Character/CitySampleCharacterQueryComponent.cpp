@@ -0,0 +1,139 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CitySampleCharacterQueryComponent.h"
+
+#include "CollisionQueryParams.h"
+#include "Engine/HitResult.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+UCitySampleCharacterQueryComponent::UCitySampleCharacterQueryComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	TraceDelegate.BindUObject(this, &UCitySampleCharacterQueryComponent::HandleTraceComplete);
+	OverlapDelegate.BindUObject(this, &UCitySampleCharacterQueryComponent::HandleOverlapComplete);
+}
+
+int32 UCitySampleCharacterQueryComponent::RegisterQuery(const FCitySampleCharacterQueryDef& QueryDef, const FCitySampleCharacterQueryResult& OnResult)
+{
+	FRegisteredQuery& Query = RegisteredQueries.AddDefaulted_GetRef();
+	Query.Def = QueryDef;
+	Query.OnResult = OnResult;
+	Query.Handle = NextHandle++;
+
+	SetComponentTickEnabled(true);
+
+	return Query.Handle;
+}
+
+void UCitySampleCharacterQueryComponent::UnregisterQuery(int32 QueryHandle)
+{
+	RegisteredQueries.RemoveAll([QueryHandle](const FRegisteredQuery& Query)
+	{
+		return Query.Handle == QueryHandle;
+	});
+
+	if (RegisteredQueries.Num() == 0)
+	{
+		SetComponentTickEnabled(false);
+	}
+}
+
+void UCitySampleCharacterQueryComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	UWorld* World = GetWorld();
+	AActor* Owner = GetOwner();
+	if (World == nullptr || Owner == nullptr)
+	{
+		return;
+	}
+
+	const FTransform OwnerTransform = Owner->GetActorTransform();
+
+	for (FRegisteredQuery& Query : RegisteredQueries)
+	{
+		if (Query.FramesUntilNextSubmit > 0)
+		{
+			--Query.FramesUntilNextSubmit;
+			continue;
+		}
+
+		// Leave the previous submission in flight rather than stacking another behind it
+		if (Query.QueryHandle.IsValid())
+		{
+			continue;
+		}
+
+		Query.FramesUntilNextSubmit = Query.Def.FrameInterval;
+		SubmitQuery(World, OwnerTransform, Query);
+	}
+}
+
+void UCitySampleCharacterQueryComponent::SubmitQuery(UWorld* World, const FTransform& OwnerTransform, FRegisteredQuery& Query)
+{
+	static FName NAME_CharacterQuery(TEXT("CitySampleCharacterQuery"));
+	FCollisionQueryParams QueryParams(NAME_CharacterQuery, false);
+	QueryParams.AddIgnoredActor(GetOwner());
+
+	const FVector Start = OwnerTransform.TransformPosition(Query.Def.StartOffset);
+	const FVector End = OwnerTransform.TransformPosition(Query.Def.EndOffset);
+
+	switch (Query.Def.Shape)
+	{
+	case ECitySampleCharacterQueryShape::LineTrace:
+		Query.QueryHandle = World->AsyncLineTraceByChannel(EAsyncTraceType::Multi, Start, End, Query.Def.CollisionChannel, QueryParams, FCollisionResponseParams::DefaultResponseParam, &TraceDelegate);
+		break;
+
+	case ECitySampleCharacterQueryShape::SphereSweep:
+		Query.QueryHandle = World->AsyncSweepByChannel(EAsyncTraceType::Multi, Start, End, FQuat::Identity, Query.Def.CollisionChannel, FCollisionShape::MakeSphere(Query.Def.Radius), QueryParams, FCollisionResponseParams::DefaultResponseParam, &TraceDelegate);
+		break;
+
+	case ECitySampleCharacterQueryShape::SphereOverlap:
+		Query.QueryHandle = World->AsyncOverlapByChannel(Start, FQuat::Identity, Query.Def.CollisionChannel, FCollisionShape::MakeSphere(Query.Def.Radius), QueryParams, FCollisionResponseParams::DefaultResponseParam, &OverlapDelegate);
+		break;
+	}
+}
+
+void UCitySampleCharacterQueryComponent::HandleTraceComplete(const FTraceHandle& InTraceHandle, FTraceDatum& InTraceDatum)
+{
+	for (FRegisteredQuery& Query : RegisteredQueries)
+	{
+		if (Query.QueryHandle == InTraceHandle)
+		{
+			Query.QueryHandle = FTraceHandle();
+
+			const bool bBlockingHit = FHitResult::GetFirstBlockingHit(InTraceDatum.OutHits) != nullptr;
+			Query.OnResult.ExecuteIfBound(bBlockingHit, InTraceDatum.OutHits, TArray<AActor*>());
+			break;
+		}
+	}
+}
+
+void UCitySampleCharacterQueryComponent::HandleOverlapComplete(const FTraceHandle& InTraceHandle, FOverlapDatum& InOverlapDatum)
+{
+	for (FRegisteredQuery& Query : RegisteredQueries)
+	{
+		if (Query.QueryHandle == InTraceHandle)
+		{
+			Query.QueryHandle = FTraceHandle();
+
+			TArray<AActor*> OverlappedActors;
+			OverlappedActors.Reserve(InOverlapDatum.OutOverlaps.Num());
+			for (const FOverlapResult& Overlap : InOverlapDatum.OutOverlaps)
+			{
+				if (AActor* OverlapActor = Overlap.GetActor())
+				{
+					OverlappedActors.AddUnique(OverlapActor);
+				}
+			}
+
+			Query.OnResult.ExecuteIfBound(OverlappedActors.Num() > 0, TArray<FHitResult>(), OverlappedActors);
+			break;
+		}
+	}
+}
@@ -0,0 +1,94 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "WorldCollision.h"
+
+#include "CitySampleCharacterQueryComponent.generated.h"
+
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FCitySampleCharacterQueryResult, bool, bBlockingHit, const TArray<FHitResult>&, Hits, const TArray<AActor*>&, OverlappedActors);
+
+UENUM(BlueprintType)
+enum class ECitySampleCharacterQueryShape : uint8
+{
+	LineTrace,
+	SphereSweep,
+	SphereOverlap
+};
+
+/** A recurring scene query registered with UCitySampleCharacterQueryComponent */
+USTRUCT(BlueprintType)
+struct FCitySampleCharacterQueryDef
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	ECitySampleCharacterQueryShape Shape = ECitySampleCharacterQueryShape::LineTrace;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TEnumAsByte<ECollisionChannel> CollisionChannel = ECC_Visibility;
+
+	/** Query start, in actor space */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FVector StartOffset = FVector::ZeroVector;
+
+	/** Query end, in actor space. Unused for overlaps. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FVector EndOffset = FVector::ZeroVector;
+
+	/** Sphere radius for sweeps and overlaps */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float Radius = 0.0f;
+
+	/** Frames between submissions. 0 submits every frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	int32 FrameInterval = 0;
+};
+
+/**
+ * Single submission point for a character's recurring scene queries. Systems register their
+ * trace/overlap needs here instead of querying the world from their own ticks; the component
+ * pushes everything that is due into the world's async scene-query batch in one pass per frame,
+ * so the physics scene is hit once per character rather than once per querying system. Results
+ * are distributed through the registered delegates when the batch resolves, typically the next
+ * frame, so consumers must tolerate one frame of latency.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class CITYSAMPLE_API UCitySampleCharacterQueryComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UCitySampleCharacterQueryComponent();
+
+	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	/** Registers a recurring query and returns a handle for UnregisterQuery */
+	UFUNCTION(BlueprintCallable)
+	int32 RegisterQuery(const FCitySampleCharacterQueryDef& QueryDef, const FCitySampleCharacterQueryResult& OnResult);
+
+	UFUNCTION(BlueprintCallable)
+	void UnregisterQuery(int32 QueryHandle);
+
+private:
+	struct FRegisteredQuery
+	{
+		FCitySampleCharacterQueryDef Def;
+		FCitySampleCharacterQueryResult OnResult;
+		FTraceHandle QueryHandle;
+		int32 Handle = INDEX_NONE;
+		int32 FramesUntilNextSubmit = 0;
+	};
+
+	void SubmitQuery(UWorld* World, const FTransform& OwnerTransform, FRegisteredQuery& Query);
+	void HandleTraceComplete(const FTraceHandle& InTraceHandle, FTraceDatum& InTraceDatum);
+	void HandleOverlapComplete(const FTraceHandle& InTraceHandle, FOverlapDatum& InOverlapDatum);
+
+	FTraceDelegate TraceDelegate;
+	FOverlapDelegate OverlapDelegate;
+
+	TArray<FRegisteredQuery> RegisteredQueries;
+	int32 NextHandle = 0;
+};
@@ -34,6 +34,7 @@ public class CitySample : ModuleRules
 			"Gauntlet",
 			"MassTraffic",
 			"MassZoneGraphNavigation",
+			"StrandsInputServer",
 		});
 
 		PrivateDependencyModuleNames.AddRange(new string[]
@@ -53,6 +54,7 @@ public class CitySample : ModuleRules
 			"AnimGraphRuntime",
 			"CitySampleMassCrowd",
 			"DeveloperSettings",
+			"ImageWrapper",
 			"RenderCore",
 			"MoviePlayer",
 			"StreamingPauseRendering",
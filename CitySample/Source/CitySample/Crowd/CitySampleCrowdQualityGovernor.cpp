@@ -0,0 +1,178 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CitySampleCrowdQualityGovernor.h"
+
+#include "EngineUtils.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "MassSpawner.h"
+#include "RenderCore.h"
+
+#include "CitySample.h"
+#include "Crowd/CitySampleCrowdSettings.h"
+
+extern TAutoConsoleVariable<int32> CVarCrowdMinLOD;
+
+static TAutoConsoleVariable<int32> CVarCrowdGovernorEnable(
+	TEXT("Crowd.Governor.Enable"),
+	0,
+	TEXT("Enable the crowd quality governor, which walks the quality ladder configured on the crowd settings based on measured game and render thread times"),
+	ECVF_Scalability);
+
+static TAutoConsoleVariable<float> CVarCrowdGovernorTargetFrameTimeMs(
+	TEXT("Crowd.Governor.TargetFrameTimeMs"),
+	33.3f,
+	TEXT("Frame time budget in milliseconds the governor steers the slower of the game and render threads towards"),
+	ECVF_Scalability);
+
+static TAutoConsoleVariable<float> CVarCrowdGovernorHysteresisMs(
+	TEXT("Crowd.Governor.HysteresisMs"),
+	2.0f,
+	TEXT("Band in milliseconds around the target frame time within which the governor holds the current step"));
+
+static TAutoConsoleVariable<float> CVarCrowdGovernorReactionSeconds(
+	TEXT("Crowd.Governor.ReactionSeconds"),
+	2.0f,
+	TEXT("Seconds the smoothed frame time must stay outside the hysteresis band before the governor changes step"));
+
+static TAutoConsoleVariable<float> CVarCrowdGovernorCooldownSeconds(
+	TEXT("Crowd.Governor.CooldownSeconds"),
+	5.0f,
+	TEXT("Minimum seconds between governor step changes"));
+
+static TAutoConsoleVariable<int32> CVarCrowdGovernorAdjustDensity(
+	TEXT("Crowd.Governor.AdjustDensity"),
+	0,
+	TEXT("Allow the governor to apply the per-step crowd density scale through the mass spawners. Off by default because applying it despawns and respawns agents"));
+
+static TAutoConsoleVariable<int32> CVarCrowdGovernorDebug(
+	TEXT("Crowd.Governor.Debug"),
+	0,
+	TEXT("Display the crowd quality governor state on screen"));
+
+bool UCitySampleCrowdQualityGovernorSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCitySampleCrowdQualityGovernorSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!CVarCrowdGovernorEnable.GetValueOnGameThread())
+	{
+		// Hand control back to the static settings when disabled mid-session
+		if (CurrentStepIndex != 0)
+		{
+			ApplyStep(0);
+		}
+		return;
+	}
+
+	// Smooth the thread times over roughly half a second so single-frame spikes don't drive steps
+	const float SmoothingAlpha = FMath::Clamp(DeltaTime / 0.5f, 0.0f, 1.0f);
+	SmoothedGameThreadMs = FMath::Lerp(SmoothedGameThreadMs, FPlatformTime::ToMilliseconds(GGameThreadTime), SmoothingAlpha);
+	SmoothedRenderThreadMs = FMath::Lerp(SmoothedRenderThreadMs, FPlatformTime::ToMilliseconds(GRenderThreadTime), SmoothingAlpha);
+
+	const UCitySampleCrowdSettings* CrowdSettings = UCitySampleCrowdSettings::Get();
+	const int32 NumSteps = CrowdSettings ? CrowdSettings->GovernorQualitySteps.Num() : 0;
+
+	if (NumSteps == 0)
+	{
+		return;
+	}
+
+	const float WorstThreadMs = FMath::Max(SmoothedGameThreadMs, SmoothedRenderThreadMs);
+	const float TargetMs = CVarCrowdGovernorTargetFrameTimeMs.GetValueOnGameThread();
+	const float HysteresisMs = CVarCrowdGovernorHysteresisMs.GetValueOnGameThread();
+
+	if (WorstThreadMs > TargetMs + HysteresisMs)
+	{
+		TimeOverBudget += DeltaTime;
+		TimeUnderBudget = 0.0f;
+	}
+	else if (WorstThreadMs < TargetMs - HysteresisMs)
+	{
+		TimeUnderBudget += DeltaTime;
+		TimeOverBudget = 0.0f;
+	}
+	else
+	{
+		TimeOverBudget = 0.0f;
+		TimeUnderBudget = 0.0f;
+	}
+
+	const float ReactionSeconds = CVarCrowdGovernorReactionSeconds.GetValueOnGameThread();
+	const bool bCooldownElapsed = FPlatformTime::Seconds() - LastStepChangeTime >= CVarCrowdGovernorCooldownSeconds.GetValueOnGameThread();
+
+	if (bCooldownElapsed)
+	{
+		if (TimeOverBudget >= ReactionSeconds && CurrentStepIndex < NumSteps - 1)
+		{
+			ApplyStep(CurrentStepIndex + 1);
+		}
+		else if (TimeUnderBudget >= ReactionSeconds && CurrentStepIndex > 0)
+		{
+			ApplyStep(CurrentStepIndex - 1);
+		}
+	}
+
+	if (CVarCrowdGovernorDebug.GetValueOnGameThread() && GEngine)
+	{
+		const FString DebugString = FString::Printf(TEXT("Crowd governor: step %d/%d | game %.1fms render %.1fms | target %.1fms +/- %.1fms | %s"),
+			CurrentStepIndex, NumSteps - 1, SmoothedGameThreadMs, SmoothedRenderThreadMs, TargetMs, HysteresisMs,
+			TimeOverBudget > 0.0f ? TEXT("over budget") : (TimeUnderBudget > 0.0f ? TEXT("headroom") : TEXT("holding")));
+		GEngine->AddOnScreenDebugMessage(reinterpret_cast<uint64>(this), 0.0f, WorstThreadMs > TargetMs + HysteresisMs ? FColor::Orange : FColor::Green, DebugString);
+	}
+}
+
+void UCitySampleCrowdQualityGovernorSubsystem::ApplyStep(const int32 NewStepIndex)
+{
+	UCitySampleCrowdSettings* CrowdSettings = UCitySampleCrowdSettings::GetMutable();
+
+	if (CrowdSettings == nullptr || !CrowdSettings->GovernorQualitySteps.IsValidIndex(NewStepIndex))
+	{
+		return;
+	}
+
+	const FCitySampleCrowdQualityStep& Step = CrowdSettings->GovernorQualitySteps[NewStepIndex];
+
+	UE_LOG(LogCitySample, Log, TEXT("Crowd governor stepping %d -> %d (MinLOD %d, far ISM threshold %.2f, density scale %.2f) game %.1fms render %.1fms"),
+		CurrentStepIndex, NewStepIndex, Step.MinLOD, Step.ISMFarLodSignificanceThreshold, Step.CrowdDensityScale, SmoothedGameThreadMs, SmoothedRenderThreadMs);
+
+	CVarCrowdMinLOD.AsVariable()->Set(Step.MinLOD, ECVF_SetByCode);
+
+	// Consumed when crowd visualization fragments are initialized, so it affects newly spawned or
+	// re-randomized agents; already-built ISM descriptors keep their threshold
+	CrowdSettings->ISMFarLodSignificanceThreshold = Step.ISMFarLodSignificanceThreshold;
+
+	// Same path as the ScaleCrowdCount cheat: rescale the spawners and respawn. Opt-in because the
+	// respawn is visible, and skipped when the scale doesn't actually change
+	if (CVarCrowdGovernorAdjustDensity.GetValueOnGameThread() && Step.CrowdDensityScale != AppliedDensityScale)
+	{
+		if (UWorld* World = GetWorld())
+		{
+			for (TActorIterator<AActor> It(World, AMassSpawner::StaticClass()); It; ++It)
+			{
+				if (AMassSpawner* Spawner = Cast<AMassSpawner>(*It))
+				{
+					Spawner->ScaleSpawningCount(Step.CrowdDensityScale);
+					Spawner->DoDespawning();
+					Spawner->DoSpawning();
+				}
+			}
+		}
+
+		AppliedDensityScale = Step.CrowdDensityScale;
+	}
+
+	CurrentStepIndex = NewStepIndex;
+	TimeOverBudget = 0.0f;
+	TimeUnderBudget = 0.0f;
+	LastStepChangeTime = FPlatformTime::Seconds();
+}
+
+TStatId UCitySampleCrowdQualityGovernorSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCitySampleCrowdQualityGovernorSubsystem, STATGROUP_Tickables);
+}
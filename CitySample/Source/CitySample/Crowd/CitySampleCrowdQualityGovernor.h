@@ -0,0 +1,53 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+
+#include "CitySampleCrowdQualityGovernor.generated.h"
+
+/**
+* Closed-loop crowd scalability governor. Watches smoothed game and render thread times and walks
+* the quality ladder configured on UCitySampleCrowdSettings: when the slower thread stays over the
+* target frame time it steps the crowd down (higher forced minimum LOD, earlier far-ISM collapse
+* and optionally lower spawn density), and steps back up once enough headroom returns. A
+* hysteresis band around the target and a cooldown between steps keep it from oscillating.
+* Disabled by default; see Crowd.Governor.Enable and Crowd.Governor.Debug for an on-screen readout.
+*/
+UCLASS()
+class CITYSAMPLE_API UCitySampleCrowdQualityGovernorSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	//~ Begin UTickableWorldSubsystem Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End UTickableWorldSubsystem Interface
+
+protected:
+
+	/** Applies the given ladder step through Crowd.MinLOD, the far-ISM significance threshold on
+	* the crowd settings and, when Crowd.Governor.AdjustDensity is enabled, the mass spawner count scale */
+	void ApplyStep(const int32 NewStepIndex);
+
+	/** Index into UCitySampleCrowdSettings::GovernorQualitySteps currently applied */
+	int32 CurrentStepIndex = 0;
+
+	/** Exponentially smoothed thread times in milliseconds */
+	float SmoothedGameThreadMs = 0.0f;
+	float SmoothedRenderThreadMs = 0.0f;
+
+	/** Seconds the smoothed frame time has spent outside the hysteresis band, driving step changes */
+	float TimeOverBudget = 0.0f;
+	float TimeUnderBudget = 0.0f;
+
+	/** Platform time of the last step change, for the cooldown between steps */
+	double LastStepChangeTime = 0.0;
+
+	/** Density scale last pushed to the mass spawners, to avoid redundant respawns */
+	float AppliedDensityScale = 1.0f;
+};
@@ -9,7 +9,28 @@ TAutoConsoleVariable<int32> CVarCrowdMinLOD(
 	TEXT("Set the Minimum LOD for Crowd Characters. Enforced via a LOD Sync Component"),
 	ECVF_Scalability);
 
-void UCitySampleCrowdSettings::PostInitProperties() 
+UCitySampleCrowdSettings::UCitySampleCrowdSettings()
+{
+	// Default governor ladder: full quality, then progressively forced-down LODs and an earlier
+	// far-ISM collapse. Density only drops on the last step since applying it respawns agents.
+	FCitySampleCrowdQualityStep& FullQuality = GovernorQualitySteps.AddDefaulted_GetRef();
+	FullQuality.ISMFarLodSignificanceThreshold = ISMFarLodSignificanceThreshold;
+
+	FCitySampleCrowdQualityStep& Reduced = GovernorQualitySteps.AddDefaulted_GetRef();
+	Reduced.MinLOD = 1;
+	Reduced.ISMFarLodSignificanceThreshold = 2.5f;
+
+	FCitySampleCrowdQualityStep& Low = GovernorQualitySteps.AddDefaulted_GetRef();
+	Low.MinLOD = 2;
+	Low.ISMFarLodSignificanceThreshold = 2.0f;
+
+	FCitySampleCrowdQualityStep& Cheapest = GovernorQualitySteps.AddDefaulted_GetRef();
+	Cheapest.MinLOD = 3;
+	Cheapest.ISMFarLodSignificanceThreshold = 1.5f;
+	Cheapest.CrowdDensityScale = 0.5f;
+}
+
+void UCitySampleCrowdSettings::PostInitProperties()
 {
 	Super::PostInitProperties();
 
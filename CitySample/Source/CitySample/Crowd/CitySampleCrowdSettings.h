@@ -11,12 +11,34 @@
 
 class UMassEntityConfigAsset;
 
+/** One rung of the crowd quality governor ladder. Step 0 should be full quality, later steps progressively cheaper. */
+USTRUCT()
+struct FCitySampleCrowdQualityStep
+{
+	GENERATED_BODY()
+
+	/* Minimum LOD enforced on crowd characters at this step, applied through Crowd.MinLOD */
+	UPROPERTY(config, EditAnywhere, Category = "Governor", meta = (ClampMin = "0", ClampMax = "3"))
+	int32 MinLOD = 0;
+
+	/* Mass LOD significance at which crowd characters collapse to the single far ISM at this step */
+	UPROPERTY(config, EditAnywhere, Category = "Governor", meta = (ClampMin = "0.0001", ClampMax = "4.0"))
+	float ISMFarLodSignificanceThreshold = 3.0f;
+
+	/* Spawning count scale pushed to the mass spawners at this step. Only applied when
+	 * Crowd.Governor.AdjustDensity is enabled, since changing it despawns and respawns agents. */
+	UPROPERTY(config, EditAnywhere, Category = "Governor", meta = (ClampMin = "0.1", ClampMax = "1.0"))
+	float CrowdDensityScale = 1.0f;
+};
+
 UCLASS(config=Mass, defaultconfig, meta=(DisplayName="Crowd"))
 class CITYSAMPLE_API UCitySampleCrowdSettings : public UDeveloperSettings
 {
 	GENERATED_BODY()
 
 public:
+	UCitySampleCrowdSettings();
+
 	virtual void PostInitProperties() override;
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
@@ -54,6 +76,11 @@ public:
 	UPROPERTY(config, EditAnywhere, Category = "Crowd")
 	TSoftObjectPtr<UMassEntityConfigAsset> AgentConfigAsset;
 
+	/* Quality ladder walked by the crowd quality governor, from full quality at step 0 to the
+	 * cheapest step last. See UCitySampleCrowdQualityGovernorSubsystem and Crowd.Governor.Enable. */
+	UPROPERTY(config, EditAnywhere, Category = "Governor")
+	TArray<FCitySampleCrowdQualityStep> GovernorQualitySteps;
+
 private:
 	UPROPERTY()
 	UMassEntityConfigAsset* AgentConfig;
@@ -55,17 +55,19 @@ EStateTreeRunStatus FCitySampleMassContextualAnimTask::EnterState(FStateTreeExec
 
 	InstanceData.ComputedDuration = InstanceData.Duration;
 
-	const FMassCrowdContextualAnimDescription* AnimDesc = CrowdAnimAsset ? CrowdAnimAsset->AnimsMap.Find(ContextualAnimName) : nullptr;
+	// The cached description was resolved when the data asset loaded, so nothing here traverses
+	// montages even when a full busload of agents starts interactions on the same frame
+	const FMassCrowdContextualAnimCachedDescription* AnimDesc = CrowdAnimAsset ? CrowdAnimAsset->FindCachedAnimDescription(ContextualAnimName) : nullptr;
 	if (AnimDesc)
 	{
-		const int32 NumAnims = AnimDesc->Anims.Num();
+		const int32 NumAnims = AnimDesc->ValidAnims.Num();
 		if (NumAnims > 0)
 		{
 			const int32 SelectedAnimIndex = FMath::RandRange(0, NumAnims - 1);
 			UE::CrowdInteractionAnim::FRequest AnimRequest;
 
-			UContextualAnimSceneAsset* ContextualAnimAsset = AnimDesc->Anims[SelectedAnimIndex].ContextualAnimAsset;
-			UAnimMontage* FallbackMontage = AnimDesc->Anims[SelectedAnimIndex].FallbackMontage;
+			const FMassCrowdContextualAnimCachedEntry& SelectedAnim = AnimDesc->ValidAnims[SelectedAnimIndex];
+			UContextualAnimSceneAsset* ContextualAnimAsset = SelectedAnim.ContextualAnimAsset;
 			const FName InteractorRole = AnimDesc->InteractorRole;
 			const FName AlignmentTrack = AnimDesc->AlignmentTrack;
 
@@ -97,15 +99,18 @@ EStateTreeRunStatus FCitySampleMassContextualAnimTask::EnterState(FStateTreeExec
 			}
 
 			// If we didn't find a proper contextual anim, or it was not set, use a simple montage instead
+			bool bUsingFallbackMontage = false;
 			if (!ContextualAnimQueryResult.Animation.IsValid())
 			{
-				ContextualAnimQueryResult.Animation = FallbackMontage;
+				ContextualAnimQueryResult.Animation = SelectedAnim.FallbackMontage;
+				bUsingFallbackMontage = true;
 			}
 
 			if (const UAnimMontage* Montage = ContextualAnimQueryResult.Animation.Get())
 			{
-				// Only override movement mode if we have root motion
-				if (Montage->HasRootMotion())
+				// Only override movement mode if we have root motion; the fallback montage's flag was cached at load
+				const bool bHasRootMotion = bUsingFallbackMontage ? SelectedAnim.bFallbackMontageHasRootMotion : Montage->HasRootMotion();
+				if (bHasRootMotion)
 				{
 					const UWorld* World = Context.GetWorld();
 					checkf(World != nullptr, TEXT("A valid world is expected from the execution context"));
@@ -119,7 +124,7 @@ EStateTreeRunStatus FCitySampleMassContextualAnimTask::EnterState(FStateTreeExec
 				}
 
 				// Grab the task duration from the montage.
-				InstanceData.ComputedDuration = Montage->GetPlayLength();
+				InstanceData.ComputedDuration = bUsingFallbackMontage ? SelectedAnim.FallbackMontageLength : Montage->GetPlayLength();
 				// Use existing fragment or push one
 				FMassMontageFragment* MontageFragment = MassStateTreeContext.GetExternalDataPtr(MontageRequestHandle);
 				if (MontageFragment != nullptr)
@@ -365,6 +365,141 @@ void UCitySampleCrowdFunctionLibrary::GenerateCharacterDefinitionFromOptions(con
 	CharacterOptions.GenerateCharacterDefinition(DataAsset, CharacterDefinition);
 }
 
+void UCitySampleCrowdFunctionLibrary::BuildRandomOptionTables(const UCrowdCharacterDataAsset& DataAsset, FCrowdRandomOptionTables& OutTables)
+{
+	OutTables.NumHairColors = DataAsset.HairColors.Num();
+
+	for (int32 SkeletonIndex = 0; SkeletonIndex < 2; ++SkeletonIndex)
+	{
+		const FCrowdGenderDefinition& GenderDefinition = SkeletonIndex == 0 ? DataAsset.SkeletonA : DataAsset.SkeletonB;
+		FCrowdRandomOptionTables::FSkeletonTable& SkeletonTable = OutTables.Skeletons[SkeletonIndex];
+
+		SkeletonTable.NumOutfitMaterials = GenderDefinition.OutfitMaterials.Num();
+		SkeletonTable.NumSkinMaterials = GenderDefinition.SkinMaterials.Num();
+
+		SkeletonTable.NumTextureModifiersPerSkinMaterial.Reset(GenderDefinition.SkinMaterials.Num());
+		for (const FCrowdSkinMaterialDefinition& SkinMaterial : GenderDefinition.SkinMaterials)
+		{
+			SkeletonTable.NumTextureModifiersPerSkinMaterial.Add(SkinMaterial.TextureModifiers.Num());
+		}
+
+		SkeletonTable.NumPatternColorsPerOutfitMaterial.Reset(GenderDefinition.OutfitMaterials.Num());
+		SkeletonTable.NumPatternOptionsPerOutfitMaterial.Reset(GenderDefinition.OutfitMaterials.Num());
+		for (const FCrowdOutfitMaterialDefinition& OutfitMaterial : GenderDefinition.OutfitMaterials)
+		{
+			SkeletonTable.NumPatternColorsPerOutfitMaterial.Add(OutfitMaterial.GetMaxPatternColors());
+			SkeletonTable.NumPatternOptionsPerOutfitMaterial.Add(OutfitMaterial.GetMaxPatternOptions());
+		}
+
+		SkeletonTable.NumHairPerSlot.Reset(GenderDefinition.HairSlots.Num());
+		for (const FCrowdHairSlot& HairSlot : GenderDefinition.HairSlots)
+		{
+			SkeletonTable.NumHairPerSlot.Add(HairSlot.HairDefinitions.Num());
+		}
+
+		for (int32 BodyTypeIndex = 0; BodyTypeIndex < 3; ++BodyTypeIndex)
+		{
+			const FCrowdBodyOutfitDefinition& BodyOutfitDefinition = BodyTypeIndex == 0 ? GenderDefinition.NormalWeight
+				: BodyTypeIndex == 1 ? GenderDefinition.OverWeight : GenderDefinition.UnderWeight;
+			FCrowdRandomOptionTables::FBodyTypeTable& BodyTypeTable = SkeletonTable.BodyTypes[BodyTypeIndex];
+
+			BodyTypeTable.NumHeads = BodyOutfitDefinition.HeadsData.Num();
+			BodyTypeTable.NumOutfits = BodyOutfitDefinition.Outfits.Num();
+			BodyTypeTable.NumScaleFactors = BodyOutfitDefinition.ScaleFactors.Num();
+			BodyTypeTable.NumAnimSets = BodyOutfitDefinition.LocomotionAnimSets.Num();
+
+			BodyTypeTable.AccessoryWeightThresholds.Reset(BodyOutfitDefinition.Accessories.Num());
+			BodyTypeTable.AccessoryTotalWeight = 0;
+			for (const FCrowdAccessoryDefinition& Accessory : BodyOutfitDefinition.Accessories)
+			{
+				// Ensure we don't go negative, matching FCrowdCharacterOptions::Randomize
+				BodyTypeTable.AccessoryTotalWeight += FMath::Max(0, Accessory.RandomWeight);
+				BodyTypeTable.AccessoryWeightThresholds.Add(BodyTypeTable.AccessoryTotalWeight);
+			}
+		}
+	}
+}
+
+void UCitySampleCrowdFunctionLibrary::GenerateRandomOptionsFromTables(const FCrowdRandomOptionTables& Tables, const FRandomStream& RandomStream,
+	int32 Count, TArray<FCrowdCharacterOptions>& OutOptions)
+{
+	const auto RandIndex = [&RandomStream](const int32 Num) -> uint8
+	{
+		return Num > 0 ? static_cast<uint8>(RandomStream.RandRange(0, Num - 1)) : 0;
+	};
+
+	OutOptions.Reserve(OutOptions.Num() + Count);
+	for (int32 DrawIndex = 0; DrawIndex < Count; ++DrawIndex)
+	{
+		FCrowdCharacterOptions& Options = OutOptions.AddDefaulted_GetRef();
+
+		// Draws follow the same ordering as FCrowdCharacterOptions::Randomize: options which don't
+		// depend on other options first, then gender-dependent options, then body-type-dependent ones
+		Options.Skeleton = static_cast<ECitySampleCrowdGender>(RandomStream.RandRange(0, 1));
+		Options.BodyType = static_cast<ECitySampleCrowdBodyType>(RandomStream.RandRange(0, 2));
+		Options.HairColorIndex = RandIndex(Tables.NumHairColors);
+
+		const FCrowdRandomOptionTables::FSkeletonTable& SkeletonTable = Tables.Skeletons[static_cast<int32>(Options.Skeleton)];
+
+		Options.OutfitMaterialIndex = RandIndex(SkeletonTable.NumOutfitMaterials);
+		Options.SkinTextureIndex = RandIndex(SkeletonTable.NumSkinMaterials);
+
+		uint8* HairOptions[] = { &Options.HairIndex, &Options.EyebrowsIndex, &Options.FuzzIndex, &Options.EyelashesIndex, &Options.MustacheIndex, &Options.BeardIndex };
+		const int32 NumHairSlots = FMath::Min<int32>(UE_ARRAY_COUNT(HairOptions), SkeletonTable.NumHairPerSlot.Num());
+		for (int32 HairSlotIdx = 0; HairSlotIdx < NumHairSlots; ++HairSlotIdx)
+		{
+			*HairOptions[HairSlotIdx] = RandIndex(SkeletonTable.NumHairPerSlot[HairSlotIdx]);
+		}
+
+		const FCrowdRandomOptionTables::FBodyTypeTable& BodyTypeTable = SkeletonTable.BodyTypes[static_cast<int32>(Options.BodyType)];
+
+		Options.HeadIndex = RandIndex(BodyTypeTable.NumHeads);
+		Options.OutfitIndex = RandIndex(BodyTypeTable.NumOutfits);
+		Options.ScaleFactorIndex = RandIndex(BodyTypeTable.NumScaleFactors);
+		Options.AnimSetIndex = RandIndex(BodyTypeTable.NumAnimSets);
+
+		if (BodyTypeTable.AccessoryTotalWeight > 0)
+		{
+			const int32 RandomValue = RandomStream.RandRange(0, BodyTypeTable.AccessoryTotalWeight - 1);
+
+			// Find the first entry in the thresholds array that encloses our random value from above
+			Options.AccessoryIndex = static_cast<uint8>(BodyTypeTable.AccessoryWeightThresholds.IndexOfByPredicate([RandomValue](const int32 RandomThreshold)
+			{
+				return RandomThreshold > RandomValue;
+			}));
+		}
+
+		if (SkeletonTable.NumOutfitMaterials > 0)
+		{
+			Options.PatternColorIndex = RandIndex(SkeletonTable.NumPatternColorsPerOutfitMaterial[Options.OutfitMaterialIndex]);
+			Options.PatternOptionIndex = RandIndex(SkeletonTable.NumPatternOptionsPerOutfitMaterial[Options.OutfitMaterialIndex]);
+		}
+
+		if (SkeletonTable.NumSkinMaterials > 0)
+		{
+			Options.SkinTextureModifierIndex = RandIndex(SkeletonTable.NumTextureModifiersPerSkinMaterial[Options.SkinTextureIndex]);
+		}
+	}
+}
+
+TArray<FCrowdCharacterOptions> UCitySampleCrowdFunctionLibrary::GenerateRandomCharacterOptionsBatch(const UCrowdCharacterDataAsset* DataAsset, int32 Count, int32 Seed)
+{
+	TArray<FCrowdCharacterOptions> OutOptions;
+
+	if (!DataAsset || Count <= 0)
+	{
+		return OutOptions;
+	}
+
+	FCrowdRandomOptionTables Tables;
+	BuildRandomOptionTables(*DataAsset, Tables);
+
+	const FRandomStream RandomStream(Seed);
+	GenerateRandomOptionsFromTables(Tables, RandomStream, Count, OutOptions);
+
+	return OutOptions;
+}
+
 #if WITH_EDITOR
 void UCitySampleCrowdFunctionLibrary::SetLODSettings(USkeletalMesh* Mesh, USkeletalMeshLODSettings* LODSettings)
 {
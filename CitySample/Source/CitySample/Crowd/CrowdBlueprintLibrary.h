@@ -11,6 +11,45 @@
 #include "Components/StaticMeshComponent.h"
 #include "CrowdBlueprintLibrary.generated.h"
 
+/**
+ * Flattened option counts extracted from a UCrowdCharacterDataAsset so character options can be
+ * randomized in bulk with plain index math instead of walking the data asset for every draw.
+ * Build once with UCitySampleCrowdFunctionLibrary::BuildRandomOptionTables, then draw any number
+ * of option sets with GenerateRandomOptionsFromTables.
+ */
+struct FCrowdRandomOptionTables
+{
+	struct FBodyTypeTable
+	{
+		int32 NumHeads = 0;
+		int32 NumOutfits = 0;
+		int32 NumScaleFactors = 0;
+		int32 NumAnimSets = 0;
+
+		// Cumulative accessory random weights so a weighted draw is an upper-bound search
+		TArray<int32> AccessoryWeightThresholds;
+		int32 AccessoryTotalWeight = 0;
+	};
+
+	struct FSkeletonTable
+	{
+		int32 NumOutfitMaterials = 0;
+		int32 NumSkinMaterials = 0;
+		TArray<int32> NumTextureModifiersPerSkinMaterial;
+		TArray<int32> NumPatternColorsPerOutfitMaterial;
+		TArray<int32> NumPatternOptionsPerOutfitMaterial;
+		TArray<int32> NumHairPerSlot;
+
+		// Indexed by ECitySampleCrowdBodyType
+		FBodyTypeTable BodyTypes[3];
+	};
+
+	int32 NumHairColors = 0;
+
+	// Indexed by ECitySampleCrowdGender
+	FSkeletonTable Skeletons[2];
+};
+
 /**
 	Set of utilities for dealing with the Crowd Definition Objects.
 */
@@ -187,6 +226,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Character")
     static void GenerateCharacterDefinitionFromOptions(const FCrowdCharacterOptions& CharacterOptions, const UCrowdCharacterDataAsset* DataAsset, FCrowdCharacterDefinition& CharacterDefinition);
 
+	// Precomputes the flattened option tables for a data asset, walking it exactly once
+	static void BuildRandomOptionTables(const UCrowdCharacterDataAsset& DataAsset, FCrowdRandomOptionTables& OutTables);
+
+	// Appends Count random option sets drawn from previously built tables to OutOptions.
+	// Matches the sampling of FCrowdCharacterOptions::Randomize without the per-draw asset traversal;
+	// the CitySample.Crowd.Forced* cheats and fixed properties are not applied here.
+	static void GenerateRandomOptionsFromTables(const FCrowdRandomOptionTables& Tables, const FRandomStream& RandomStream, int32 Count, TArray<FCrowdCharacterOptions>& OutOptions);
+
+	// Batch randomization for lineups and bulk spawns: builds the option tables once and then
+	// draws Count option sets with indexed sampling
+	UFUNCTION(BlueprintCallable, Category="Character")
+	static TArray<FCrowdCharacterOptions> GenerateRandomCharacterOptionsBatch(const UCrowdCharacterDataAsset* DataAsset, int32 Count, int32 Seed);
+
 	/* Utility for creating and setting Colors with Dynamic Material Instance */
 	static UMaterialInstanceDynamic* CreateDynamicMaterialInstance(UMeshComponent* Component, const FName MaterialSlotName);
 private:
@@ -16,6 +16,7 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/AssetManager.h"
 #include "Engine/StreamableManager.h"
+#include "Util/CitySampleAssetManager.h"
 #include "MassMovementFragments.h"
 #include "Animation/MassCrowdContextualAnimTypes.h"
 #include "MassCommonFragments.h"
@@ -150,7 +151,10 @@ void ACitySampleCrowdCharacter::PreSave(FObjectPreSaveContext ObjectSaveContext)
 	{
 		AccessoryMeshComponent->SetStaticMesh(nullptr);
 	}
-	
+
+	// The components no longer match any built definition
+	LastBuiltVisualizationID.Reset();
+
 	Super::PreSave(ObjectSaveContext);
 }
 
@@ -163,6 +167,12 @@ void ACitySampleCrowdCharacter::BuildCharacter()
 
 void ACitySampleCrowdCharacter::BuildCharacterFromDefinition(const FCrowdCharacterDefinition& InCharacterDefinition)
 {
+	// First spawn request for variety assets, kicks off any preload the active profile deferred at startup
+	UCitySampleAssetManager::Get().EnsureVarietyAssetsLoaded();
+
+	// Arbitrary definition, we can no longer assume the built character matches a known ID
+	LastBuiltVisualizationID.Reset();
+
 	const TArray<FSoftObjectPath> AssetsToLoad = InCharacterDefinition.GetSoftPathsToLoad();
 	FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
 
@@ -203,9 +213,9 @@ void ACitySampleCrowdCharacter::BuildCharacterFromDefinition_Internal(const FCro
     LoadAnimToTextureDataAssets(InCharacterDefinition);
 
     UpdateMeshes(InCharacterDefinition);
-    UpdateGrooms(InCharacterDefinition.HairDefinitions);
+    ScheduleGroomUpdate();
     UpdateMaterials(InCharacterDefinition);
-    
+
     UpdateContextualAnimData(InCharacterDefinition);
     UpdateLODSync();
 
@@ -225,11 +235,19 @@ void ACitySampleCrowdCharacter::BuildCharacterFromDefinition_Internal(const FCro
 
 void ACitySampleCrowdCharacter::BuildCharacterFromID(const FCrowdVisualizationID& InVisualizationID)
 {
+	// Pooled actors are frequently reused with the definition they were last built with; the packed
+	// ID fully determines the definition so an unchanged ID means the built character is still valid.
+	if (LastBuiltVisualizationID.IsSet() && LastBuiltVisualizationID.GetValue() == InVisualizationID.PackedData)
+	{
+		return;
+	}
+
 	CharacterOptions = InVisualizationID.ToCharacterOptions();
 	if (CrowdCharacterData)
 	{
 		CharacterOptions.GenerateCharacterDefinition(CrowdCharacterData, PrivateCharacterDefinition);
 		BuildCharacterFromDefinition(PrivateCharacterDefinition);
+		LastBuiltVisualizationID = InVisualizationID.PackedData;
 	}
 }
 
@@ -391,7 +409,7 @@ void ACitySampleCrowdCharacter::AnimToTextureDataAssetLoaded(TSoftObjectPtr<UAni
 	bLoadingAnimToTextureDataAssets = false;
 
 	UpdateMeshes(PrivateCharacterDefinition);
-	UpdateGrooms(PrivateCharacterDefinition.HairDefinitions);
+	ScheduleGroomUpdate();
 	UpdateMaterials(PrivateCharacterDefinition);
 }
 
@@ -536,6 +554,33 @@ void ACitySampleCrowdCharacter::UpdateGrooms(const TArray<FCrowdHairDefinition>&
 	}
 }
 
+void ACitySampleCrowdCharacter::ApplyGrooms()
+{
+	UpdateGrooms(PrivateCharacterDefinition.HairDefinitions);
+	UpdateHairMaterials();
+}
+
+void ACitySampleCrowdCharacter::ScheduleGroomUpdate()
+{
+	UWorld* World = GetWorld();
+	if (bDeferGroomUpdate && World && World->IsGameWorld())
+	{
+		// Assigning groom assets kicks off the groom binding build, which is the most expensive part
+		// of the character build; push it to the next frame so promotion to actor LOD only pays for
+		// meshes and materials
+		FTimerManager& TimerManager = World->GetTimerManager();
+		if (GroomUpdateTimerHandle.IsValid())
+		{
+			TimerManager.ClearTimer(GroomUpdateTimerHandle);
+		}
+		GroomUpdateTimerHandle = TimerManager.SetTimerForNextTick(this, &ACitySampleCrowdCharacter::ApplyGrooms);
+	}
+	else
+	{
+		ApplyGrooms();
+	}
+}
+
 void ACitySampleCrowdCharacter::ReattachGrooms(const TArray<FCrowdHairDefinition>& HairDefinitions)
 {
 	bool bFailedToAttachGroom = false;
@@ -565,7 +610,7 @@ void ACitySampleCrowdCharacter::ReattachGrooms(const TArray<FCrowdHairDefinition
 
 void ACitySampleCrowdCharacter::UpdateMaterials(const FCrowdCharacterDefinition& CharacterDefinition)
 {
-	UpdateHairMaterials();
+	// Hair materials are applied by ApplyGrooms alongside the groom assets they depend on
 	UpdateOutfitMaterials();
 	UpdateBodyMaterials();
 	UpdateHeadMaterials();
@@ -841,12 +886,12 @@ void ACitySampleCrowdCharacter::OnGetOrSpawn(FMassEntityManager* EntitySubsystem
 		SpawnAnimData.FarLODPlaybackStartTime = 0.0f;
 		if (FCrowdAnimationFragment* AnimFragment = EntitySubsystem->GetFragmentDataPtr<FCrowdAnimationFragment>(MassAgent))
 		{
-			if (AnimFragment->AnimToTextureData.IsValid() && AnimFragment->AnimToTextureData->Animations.IsValidIndex(AnimFragment->AnimationStateIndex))
+			if (AnimFragment->AnimToTextureData.IsValid() && AnimFragment->AnimToTextureData->Animations.IsValidIndex(AnimFragment->GetAnimationStateIndex()))
 			{
-				SpawnAnimData.FarLODAnimSequence = AnimFragment->AnimToTextureData->AnimSequences[AnimFragment->AnimationStateIndex].AnimSequence;
+				SpawnAnimData.FarLODAnimSequence = AnimFragment->AnimToTextureData->AnimSequences[AnimFragment->GetAnimationStateIndex()].AnimSequence;
 				if (SpawnAnimData.FarLODAnimSequence)
 				{
-					SpawnAnimData.FarLODAnimSequence = AnimFragment->AnimToTextureData->AnimSequences[AnimFragment->AnimationStateIndex].AnimSequence;
+					SpawnAnimData.FarLODAnimSequence = AnimFragment->AnimToTextureData->AnimSequences[AnimFragment->GetAnimationStateIndex()].AnimSequence;
 
 					if (UWorld* World = GetWorld())
 					{
@@ -861,7 +906,7 @@ void ACitySampleCrowdCharacter::OnGetOrSpawn(FMassEntityManager* EntitySubsystem
 					}
 				}
 			}
-			SpawnAnimData.bSwappedThisFrame = AnimFragment->bSwappedThisFrame;
+			SpawnAnimData.bSwappedThisFrame = AnimFragment->IsSwappedThisFrame();
 		}
 
 		if (FMassRepresentationLODFragment* RepresentationFragment = EntitySubsystem->GetFragmentDataPtr<FMassRepresentationLODFragment>(MassAgent))
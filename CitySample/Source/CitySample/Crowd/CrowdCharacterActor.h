@@ -80,6 +80,11 @@ public:
 	UPROPERTY(EditAnywhere, Category="Character", Interp)
 	bool bShouldAsyncLoad = true;
 
+	// Whether to apply groom assets and bindings a frame after the rest of the character, keeping
+	// the groom binding cost off the frame where the character is promoted to actor LOD
+	UPROPERTY(EditAnywhere, Category="Character")
+	bool bDeferGroomUpdate = true;
+
 	UPROPERTY(EditAnywhere, Category="Character", meta=(DisplayName="Build Character on Contruction"))
 	bool bShouldBuildOnConstruct = true;
 
@@ -149,6 +154,11 @@ private:
 
 	void UpdateGrooms(const TArray<FCrowdHairDefinition>& HairDefinitions);
 	void ReattachGrooms(const TArray<FCrowdHairDefinition>& HairDefinitions);
+
+	// Applies groom assets, bindings and hair materials for the cached definition, either
+	// immediately or on the next tick depending on bDeferGroomUpdate
+	void ApplyGrooms();
+	void ScheduleGroomUpdate();
 	
 	void UpdateMeshes(const FCrowdCharacterDefinition& CharacterDefinition);
 	void UpdateContextualAnimData(const FCrowdCharacterDefinition& CharacterDefinition);
@@ -207,6 +217,12 @@ private:
 	bool bLoadingAnimToTextureDataAssets = false;
 	bool bGroomComponentAttachmentDelayed = false;
 
+	FTimerHandle GroomUpdateTimerHandle;
+
+	// Packed visualization ID of the definition this actor was last built from, used to skip the
+	// whole rebuild when a pooled actor is reused with an unchanged definition
+	TOptional<int64> LastBuiltVisualizationID;
+
 	UPROPERTY(Transient)
 	UAnimToTextureDataAsset* AnimToTextureDataAssets[EAnimToTextureDataAssetSlots::ATTDAS_MAX];
 
@@ -5,7 +5,9 @@
 #include "CrowdBlueprintLibrary.h"
 #include "Components/TextRenderComponent.h"
 #include "CrowdCharacterDataAsset.h"
+#include "Engine/AssetManager.h"
 #include "Engine/StaticMeshActor.h"
+#include "Engine/StreamableManager.h"
 #include "Misc/ScopedSlowTask.h"
 
 
@@ -80,30 +82,37 @@ void ACrowdCharacterLineup::ClearLineup()
 
 void ACrowdCharacterLineup::UpdateLineup()
 {
+	// Resolve every member's definition first so the shared assets can be loaded as one batch
+	TArray<FCrowdCharacterDefinition> InstanceDefinitions;
+	InstanceDefinitions.Reserve(LineupInstances.Num());
 	for (FCrowdLineupInstance& LineupInstance : LineupInstances)
 	{
+		FCrowdCharacterDefinition& CharacterDefinition = InstanceDefinitions.AddDefaulted_GetRef();
 		if (LineupInstance.LineupActor)
 		{
-			FCrowdCharacterDefinition CharacterDefinition;
 			PopulateCharacterDefinition(LineupInstance.InstanceOptions, CharacterDefinition);
+		}
+	}
 
-			{
-				FEditorScriptExecutionGuard ScriptGuard;
+	const TSharedPtr<FStreamableHandle> PreloadHandle = PreloadLineupAssets(InstanceDefinitions);
 
-				UpdateLineupActor(LineupInstance.LineupActor, LineupInstance.LineupCoordinates, CharacterDefinition);
-			}
+	for (int32 InstanceIndex = 0; InstanceIndex < LineupInstances.Num(); ++InstanceIndex)
+	{
+		FCrowdLineupInstance& LineupInstance = LineupInstances[InstanceIndex];
+		if (LineupInstance.LineupActor)
+		{
+			FEditorScriptExecutionGuard ScriptGuard;
+
+			UpdateLineupActor(LineupInstance.LineupActor, LineupInstance.LineupCoordinates, InstanceDefinitions[InstanceIndex]);
 		}
-	}	
+	}
 	UpdateInstanceTransforms();
 }
 
-void ACrowdCharacterLineup::SpawnCharacterFromOptions(const FString VariantLabel, const FIntVector LineupCoordinates, const FCrowdCharacterOptions& CharacterOptions)
+void ACrowdCharacterLineup::SpawnCharacterFromOptions(const FString VariantLabel, const FIntVector LineupCoordinates, const FCrowdCharacterOptions& CharacterOptions, const FCrowdCharacterDefinition& CharacterDefinition)
 {
 	if (UWorld* TargetWorld = GetWorld())
 	{
-		FCrowdCharacterDefinition CharacterDefinition;
-		PopulateCharacterDefinition(CharacterOptions, CharacterDefinition);
-
 		FVector SpawnLocation = LocationOffset + (FVector(LineupCoordinates) * Spacing);
 		AActor* NewActor = SpawnLineupActor(LineupCoordinates, VariantLabel, SpawnLocation, RotationOffset, CharacterDefinition, CharacterOptions);
 		if (NewActor)
@@ -118,6 +127,33 @@ void ACrowdCharacterLineup::SpawnCharacterFromOptions(const FString VariantLabel
 	}
 }
 
+TSharedPtr<FStreamableHandle> ACrowdCharacterLineup::PreloadLineupAssets(TConstArrayView<FCrowdCharacterDefinition> CharacterDefinitions) const
+{
+	TSet<FSoftObjectPath> UniqueAssetPaths;
+	for (const FCrowdCharacterDefinition& CharacterDefinition : CharacterDefinitions)
+	{
+		UniqueAssetPaths.Append(CharacterDefinition.GetSoftPathsToLoad());
+	}
+
+	// Only request what isn't already resident
+	TArray<FSoftObjectPath> AssetsToLoad;
+	AssetsToLoad.Reserve(UniqueAssetPaths.Num());
+	for (const FSoftObjectPath& AssetPath : UniqueAssetPaths)
+	{
+		if (AssetPath.ResolveObject() == nullptr)
+		{
+			AssetsToLoad.Add(AssetPath);
+		}
+	}
+
+	if (AssetsToLoad.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	return UAssetManager::GetStreamableManager().RequestSyncLoad(AssetsToLoad);
+}
+
 void ACrowdCharacterLineup::ResolveVariationDependencies(FCrowdVariationSpecifier& FirstVariation, FCrowdVariationSpecifier& SecondVariation, FCrowdVariationSpecifier& ThirdVariation)
 {
 	const bool& bX = VariationOptions.bX;
@@ -199,6 +235,18 @@ void ACrowdCharacterLineup::BuildLineup()
 
 	ClearLineup();
 
+	// Members are gathered first, then spawned after one batched load of the union of their soft
+	// references. Members mostly share outfits, grooms, and textures, so loading per member mostly
+	// issues redundant requests for assets another member already pulled in.
+	struct FPendingLineupSpawn
+	{
+		FString VariantLabel;
+		FIntVector LineupCoordinates = FIntVector::ZeroValue;
+		FCrowdCharacterOptions Options;
+	};
+	TArray<FPendingLineupSpawn> PendingSpawns;
+	TArray<FCrowdCharacterDefinition> PendingDefinitions;
+
 	if (LineupType == ECrowdLineupType::Variation)
 	{
 		// The properties we are vary could be dependent on each other such as the number of outfits changing based on gender
@@ -254,7 +302,11 @@ void ACrowdCharacterLineup::BuildLineup()
 						SecondVariation.GetOffsetDirection(SecondIndex) +
 						ThirdVariation.GetOffsetDirection(ThirdIndex);
 
-					SpawnCharacterFromOptions(VariantLabel, LineupCoordinates, CurrentCharacterOptions);
+					FPendingLineupSpawn& PendingSpawn = PendingSpawns.AddDefaulted_GetRef();
+					PendingSpawn.VariantLabel = VariantLabel;
+					PendingSpawn.LineupCoordinates = LineupCoordinates;
+					PendingSpawn.Options = CurrentCharacterOptions;
+					PopulateCharacterDefinition(CurrentCharacterOptions, PendingDefinitions.AddDefaulted_GetRef());
 				}
 			}
 		}
@@ -276,11 +328,24 @@ void ACrowdCharacterLineup::BuildLineup()
 					FIntVector LineupCoordinates(X_Index, Y_Index, Z_Index);
 					FString VariantLabel = LineupCoordinates.ToString();
 
-					SpawnCharacterFromOptions(VariantLabel, LineupCoordinates, RandomCharacterOptions);
+					FPendingLineupSpawn& PendingSpawn = PendingSpawns.AddDefaulted_GetRef();
+					PendingSpawn.VariantLabel = VariantLabel;
+					PendingSpawn.LineupCoordinates = LineupCoordinates;
+					PendingSpawn.Options = RandomCharacterOptions;
+					PopulateCharacterDefinition(RandomCharacterOptions, PendingDefinitions.AddDefaulted_GetRef());
 				}
 			}
 		}
 	}
+
+	// The handle keeps the batch resident until every member has taken its own references
+	const TSharedPtr<FStreamableHandle> PreloadHandle = PreloadLineupAssets(PendingDefinitions);
+
+	for (int32 PendingIndex = 0; PendingIndex < PendingSpawns.Num(); ++PendingIndex)
+	{
+		const FPendingLineupSpawn& PendingSpawn = PendingSpawns[PendingIndex];
+		SpawnCharacterFromOptions(PendingSpawn.VariantLabel, PendingSpawn.LineupCoordinates, PendingSpawn.Options, PendingDefinitions[PendingIndex]);
+	}
 }
 
 bool ACrowdCharacterLineup::GetParentVariation(ECrowdLineupVariation ChildVariation, ECrowdLineupVariation& ParentVariation)
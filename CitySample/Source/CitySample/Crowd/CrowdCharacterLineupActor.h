@@ -9,6 +9,7 @@
 
 #include "CrowdCharacterLineupActor.generated.h"
 
+class FStreamableHandle;
 class UCrowdCharacterDataAsset;
 class UTextRenderComponent;
 
@@ -193,7 +194,10 @@ public:
 	FCrowdCharacterOptions BaseOptions;
 
 private:
-	void SpawnCharacterFromOptions(const FString VariantLabel, const FIntVector LineupCoordinates, const FCrowdCharacterOptions& CharacterOptions);
+	void SpawnCharacterFromOptions(const FString VariantLabel, const FIntVector LineupCoordinates, const FCrowdCharacterOptions& CharacterOptions, const FCrowdCharacterDefinition& CharacterDefinition);
+
+	/** Loads the union of soft references across the given definitions in one batch, so members built afterwards find their shared assets resident. */
+	TSharedPtr<FStreamableHandle> PreloadLineupAssets(TConstArrayView<FCrowdCharacterDefinition> CharacterDefinitions) const;
 
 	UPROPERTY()
 	TArray<TObjectPtr<UTextRenderComponent>> RowLabels;
@@ -0,0 +1,62 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UE::CitySampleCrowd::CustomData
+{
+	/**
+	 * Compile-time layout of the per-instance custom data floats written for the crowd ISMs by
+	 * UMassProcessor_CrowdVisualizationCustomData. This is the authoritative description of the
+	 * float indices the crowd materials read back - keep it in sync with the material functions
+	 * sampling PerInstanceCustomData.
+	 *
+	 * Every crowd character is rendered as five ISM components, one per mesh part, and each
+	 * instance carries NumCustomFloatsPerISM floats:
+	 *   [0..4] anim-to-texture playback state (FMassTrafficAnimState: start frame, num frames,
+	 *          play rate, looping flag, global start time)
+	 *   [5]    packed color variation (RGB565) on the clothing parts (Top/Bottom/Shoes)
+	 *   [5]    skin atlas index on the skin parts (Head/Body)
+	 *
+	 * The color float holds the RGB565 word as an exact integer value (0..65535), so the material
+	 * function unpacks it with:
+	 *   R = floor(x / 2048) / 31
+	 *   G = floor(fmod(x, 2048) / 32) / 63
+	 *   B = fmod(x, 32) / 31
+	 */
+
+	// Mesh part order within a character's ISM description
+	inline constexpr int32 HeadMeshIndex = 0;
+	inline constexpr int32 BodyMeshIndex = 1;
+	inline constexpr int32 TopMeshIndex = 2;
+	inline constexpr int32 BottomMeshIndex = 3;
+	inline constexpr int32 ShoesMeshIndex = 4;
+
+	inline constexpr int32 NumCustomFloatsPerISM = 6;
+
+	// Anim-to-texture playback state occupies the first floats of every part
+	inline constexpr int32 AnimStateStartIndex = 0;
+	inline constexpr int32 NumAnimStateFloats = 5;
+	inline constexpr int32 NumAnimStatePaddingFloats = NumCustomFloatsPerISM - NumAnimStateFloats;
+
+	// Clothing parts: packed RGB565 color variation. Skin parts: atlas index
+	inline constexpr int32 ColorVariationIndex = 5;
+	inline constexpr int32 NumColorVariationFloats = 1;
+	inline constexpr int32 AtlasVariationIndex = 5;
+
+	/** Quantizes an 0xRRGGBBAA color override to the RGB565 word uploaded per instance */
+	constexpr uint16 PackColorVariation(const uint32 PackedRGBA)
+	{
+		const uint32 R = (PackedRGBA >> 27) & 0x1f;
+		const uint32 G = (PackedRGBA >> 18) & 0x3f;
+		const uint32 B = (PackedRGBA >> 11) & 0x1f;
+		return static_cast<uint16>((R << 11) | (G << 5) | B);
+	}
+
+	/** An RGB565 word as a custom data float; integers up to 2^16 are exactly representable */
+	constexpr float ColorVariationToFloat(const uint16 PackedColor565)
+	{
+		return static_cast<float>(PackedColor565);
+	}
+} // namespace UE::CitySampleCrowd::CustomData
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "CrowdVisualizationCustomDataProcessor.h"
+#include "CrowdVisualizationCustomData.h"
 #include "MassCrowdRepresentationSubsystem.h"
 #include "MassRepresentationFragments.h"
 #include "MassVisualizationComponent.h"
@@ -76,24 +77,11 @@ void UMassProcessor_CrowdVisualizationCustomData::UpdateCrowdCustomData(FMassExe
 	TConstArrayView<FCitySampleCrowdVisualizationFragment> CitySampleCrowdVisualizationList = Context.GetFragmentView<FCitySampleCrowdVisualizationFragment>();
 	TArrayView<FCrowdAnimationFragment> AnimationDataList = Context.GetMutableFragmentView<FCrowdAnimationFragment>();
 
-	// 0-4 are anim data
-	// 5-7 are color varations on clothing
-	// 5 is an atlas index on skin
-	const int NumCustomFloatsPerISM = 8;
-	const int ColorVariationIndex = 5;
-	const int AtlasVariationIndex = 5;
-
-	const int HeadIdx = 0;
-	const int BodyIdx = 1;
-	const int TopIdx = 2;
-	const int BottomIdx = 3;
-	const int ShoesIdx = 4;
-
-	TArray<float, TInlineAllocator<3>> CustomFloats;
-	CustomFloats.AddZeroed(3);
-	float& R = CustomFloats[0];
-	float& G = CustomFloats[1];
-	float& B = CustomFloats[2];
+	// The custom data float layout shared with the crowd materials lives in CrowdVisualizationCustomData.h
+	using namespace UE::CitySampleCrowd::CustomData;
+
+	TArray<float, TInlineAllocator<NumColorVariationFloats>> CustomFloats;
+	CustomFloats.AddZeroed(NumColorVariationFloats);
 
 	for (FMassExecutionContext::FEntityIterator EntityIt = Context.CreateEntityIterator(); EntityIt; ++EntityIt)
 	{
@@ -122,31 +110,23 @@ void UMassProcessor_CrowdVisualizationCustomData::UpdateCrowdCustomData(FMassExe
 				UMassUpdateISMProcessor::UpdateISMTransform(Context.GetEntity(EntityIt), ISMInfo, TransformFragment.GetTransform()
 					, Representation.PrevTransform, RepresentationLOD.LODSignificance, PrevLODSignificance);
 
-				// Custom data layout is 0-4 are anim data, 5-7 are color variations, 5 is an atlas index on some meshes
-				// Need 3 floats of padding after anim data
-				const int32 CustomDataPaddingAmount = 3;
-
 				// Add Vertex animation custom floats
-				UMassCrowdUpdateISMVertexAnimationProcessor::UpdateISMVertexAnimation(ISMInfo, AnimationData, RepresentationLOD.LODSignificance, PrevLODSignificance, CustomDataPaddingAmount);
+				UMassCrowdUpdateISMVertexAnimationProcessor::UpdateISMVertexAnimation(ISMInfo, AnimationData, RepresentationLOD.LODSignificance, PrevLODSignificance, NumAnimStatePaddingFloats);
 
 				// Add color custom floats
-				R = (CitySampleCrowdVisualization.TopColor >> 24) / 255.0f;
-				G = ((CitySampleCrowdVisualization.TopColor >> 16) & 0xff) / 255.0f;
-				B = ((CitySampleCrowdVisualization.TopColor >> 8) & 0xff) / 255.0f;
-				ISMInfo.WriteCustomDataFloatsAtStartIndex(TopIdx, CustomFloats, RepresentationLOD.LODSignificance, NumCustomFloatsPerISM, ColorVariationIndex, PrevLODSignificance);
-				R = (CitySampleCrowdVisualization.BottomColor >> 24) / 255.0f;
-				G = ((CitySampleCrowdVisualization.BottomColor >> 16) & 0xff) / 255.0f;
-				B = ((CitySampleCrowdVisualization.BottomColor >> 8) & 0xff) / 255.0f;
-				ISMInfo.WriteCustomDataFloatsAtStartIndex(BottomIdx, CustomFloats, RepresentationLOD.LODSignificance, NumCustomFloatsPerISM, ColorVariationIndex, PrevLODSignificance);
-				R = (CitySampleCrowdVisualization.ShoesColor >> 24) / 255.0f;
-				G = ((CitySampleCrowdVisualization.ShoesColor >> 16) & 0xff) / 255.0f;
-				B = ((CitySampleCrowdVisualization.ShoesColor >> 8) & 0xff) / 255.0f;
-				ISMInfo.WriteCustomDataFloatsAtStartIndex(ShoesIdx, CustomFloats, RepresentationLOD.LODSignificance, NumCustomFloatsPerISM, ColorVariationIndex, PrevLODSignificance);
+				auto WriteColorVariation = [&ISMInfo, &CustomFloats, &RepresentationLOD, PrevLODSignificance](const int32 MeshIndex, const uint16 PackedColor565)
+				{
+					CustomFloats[0] = ColorVariationToFloat(PackedColor565);
+					ISMInfo.WriteCustomDataFloatsAtStartIndex(MeshIndex, CustomFloats, RepresentationLOD.LODSignificance, NumCustomFloatsPerISM, ColorVariationIndex, PrevLODSignificance);
+				};
+				WriteColorVariation(TopMeshIndex, CitySampleCrowdVisualization.GetTopColor565());
+				WriteColorVariation(BottomMeshIndex, CitySampleCrowdVisualization.GetBottomColor565());
+				WriteColorVariation(ShoesMeshIndex, CitySampleCrowdVisualization.GetShoesColor565());
 
 				// Add skin atlas custom floats
-				TArray<float, TInlineAllocator<1>> SkinAtlasIndex({ float(CitySampleCrowdVisualization.SkinAtlasIndex) });
-				ISMInfo.WriteCustomDataFloatsAtStartIndex(HeadIdx, SkinAtlasIndex, RepresentationLOD.LODSignificance, NumCustomFloatsPerISM, AtlasVariationIndex, PrevLODSignificance);
-				ISMInfo.WriteCustomDataFloatsAtStartIndex(BodyIdx, SkinAtlasIndex, RepresentationLOD.LODSignificance, NumCustomFloatsPerISM, AtlasVariationIndex, PrevLODSignificance);
+				TArray<float, TInlineAllocator<1>> SkinAtlasIndex({ float(CitySampleCrowdVisualization.GetSkinAtlasIndex()) });
+				ISMInfo.WriteCustomDataFloatsAtStartIndex(HeadMeshIndex, SkinAtlasIndex, RepresentationLOD.LODSignificance, NumCustomFloatsPerISM, AtlasVariationIndex, PrevLODSignificance);
+				ISMInfo.WriteCustomDataFloatsAtStartIndex(BodyMeshIndex, SkinAtlasIndex, RepresentationLOD.LODSignificance, NumCustomFloatsPerISM, AtlasVariationIndex, PrevLODSignificance);
 			}
 		}
 		Representation.PrevTransform = TransformFragment.GetTransform();
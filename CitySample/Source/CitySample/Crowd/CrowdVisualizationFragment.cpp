@@ -375,6 +375,14 @@ void UCitySampleCrowdVisualizationFragmentInitializer::Execute(FMassEntityManage
 					CrowdCharacterDataAsset = CitySampleCrowdCharacterCDO->CrowdCharacterData.Get();
 				}
 			}
+
+			// Preresolve every anim-to-texture reference of a newly seen data asset in one pass, so
+			// the per-entity lookups below hit the handle table even on the first bulk spawn
+			if (CrowdCharacterDataAsset && !IndexedDataAssets.Contains(CrowdCharacterDataAsset))
+			{
+				BuildAnimToTextureHandleTable(*CrowdCharacterDataAsset);
+				IndexedDataAssets.Add(CrowdCharacterDataAsset);
+			}
 			
 			// Grab the settings class
 			const UCitySampleCrowdSettings* CrowdSettings = UCitySampleCrowdSettings::Get();
@@ -406,7 +414,7 @@ void UCitySampleCrowdVisualizationFragmentInitializer::Execute(FMassEntityManage
 
 					FCrowdCharacterDefinition CharacterDefinition;
 
-					VisualizationList[i].SkinAtlasIndex = CharacterOptions.SkinTextureIndex;
+					VisualizationList[i].SetSkinAtlasIndex(CharacterOptions.SkinTextureIndex);
 
 					// If we found the data asset then we should have a valid set of Character Options already
 					// from when we randomized
@@ -456,7 +464,7 @@ void UCitySampleCrowdVisualizationFragmentInitializer::Execute(FMassEntityManage
 						StaticMeshDesc.Mesh = ATTDA->GetStaticMesh();
 						StaticMeshInstanceDesc.Meshes.Add(StaticMeshDesc);
 
-						VisualizationList[i].TopColor = FindColorOverride(CharacterDefinition, ATTDA->GetSkeletalMesh());
+						VisualizationList[i].SetTopColor(FindColorOverride(CharacterDefinition, ATTDA->GetSkeletalMesh()));
 					}
 
 					if (UAnimToTextureDataAsset* ATTDA = GetAnimToTextureDataAsset(CharacterDefinition.OutfitDefinition.BottomData))
@@ -467,7 +475,7 @@ void UCitySampleCrowdVisualizationFragmentInitializer::Execute(FMassEntityManage
 						StaticMeshDesc.Mesh = ATTDA->GetStaticMesh();
 						StaticMeshInstanceDesc.Meshes.Add(StaticMeshDesc);
 
-						VisualizationList[i].BottomColor = FindColorOverride(CharacterDefinition, ATTDA->GetSkeletalMesh());
+						VisualizationList[i].SetBottomColor(FindColorOverride(CharacterDefinition, ATTDA->GetSkeletalMesh()));
 					}
 
 					if (UAnimToTextureDataAsset* ATTDA = GetAnimToTextureDataAsset(CharacterDefinition.OutfitDefinition.ShoesData))
@@ -478,7 +486,7 @@ void UCitySampleCrowdVisualizationFragmentInitializer::Execute(FMassEntityManage
 						StaticMeshDesc.Mesh = ATTDA->GetStaticMesh();
 						StaticMeshInstanceDesc.Meshes.Add(StaticMeshDesc);
 
-						VisualizationList[i].ShoesColor = FindColorOverride(CharacterDefinition, ATTDA->GetSkeletalMesh());
+						VisualizationList[i].SetShoesColor(FindColorOverride(CharacterDefinition, ATTDA->GetSkeletalMesh()));
 					}
 
 					const FCrowdHairDefinition& HairDefinition = CharacterDefinition.GetHairDefinitionForSlot(ECrowdHairSlots::Hair);
@@ -543,20 +551,62 @@ void UCitySampleCrowdVisualizationFragmentInitializer::Execute(FMassEntityManage
 };
 
 
-UAnimToTextureDataAsset* UCitySampleCrowdVisualizationFragmentInitializer::GetAnimToTextureDataAsset(TSoftObjectPtr<UAnimToTextureDataAsset> SoftPtr)
+UAnimToTextureDataAsset* UCitySampleCrowdVisualizationFragmentInitializer::GetAnimToTextureDataAsset(const TSoftObjectPtr<UAnimToTextureDataAsset>& SoftPtr)
 {
 	if (SoftPtr.IsNull())
 	{
 		return nullptr;
 	}
 
-	if (SoftPtr.IsValid())
-	{ 
-		return SoftPtr.Get();
+	// Each unique soft reference is resolved once into the handle table; per-entity initialization
+	// only pays the path-to-object resolution the first time an asset is seen
+	if (const TObjectPtr<UAnimToTextureDataAsset>* Resolved = AnimToTextureHandleTable.Find(SoftPtr.ToSoftObjectPath()))
+	{
+		return *Resolved;
 	}
 
+	UAnimToTextureDataAsset* LoadedAsset = nullptr;
+	if (SoftPtr.IsValid())
+	{
+		LoadedAsset = SoftPtr.Get();
+	}
+	else
 	{
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_CitySampleCrowdVisualizationFragmentInitializer_GetAnimToTextureDataAsset_LoadSync);
-		return SoftPtr.LoadSynchronous();
+		LoadedAsset = SoftPtr.LoadSynchronous();
+	}
+
+	AnimToTextureHandleTable.Add(SoftPtr.ToSoftObjectPath(), LoadedAsset);
+	return LoadedAsset;
+}
+
+void UCitySampleCrowdVisualizationFragmentInitializer::BuildAnimToTextureHandleTable(const UCrowdCharacterDataAsset& DataAsset)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_CitySampleCrowdVisualizationFragmentInitializer_BuildAnimToTextureHandleTable);
+
+	const FCrowdGenderDefinition* Genders[] = { &DataAsset.SkeletonA, &DataAsset.SkeletonB };
+
+	for (const FCrowdGenderDefinition* Gender : Genders)
+	{
+		const FCrowdBodyOutfitDefinition* BodyTypes[] = { &Gender->NormalWeight, &Gender->OverWeight, &Gender->UnderWeight };
+
+		for (const FCrowdBodyOutfitDefinition* BodyType : BodyTypes)
+		{
+			GetAnimToTextureDataAsset(BodyType->Body.BodyData);
+
+			for (const TSoftObjectPtr<UAnimToTextureDataAsset>& HeadData : BodyType->HeadsData)
+			{
+				GetAnimToTextureDataAsset(HeadData);
+			}
+
+			for (const FCrowdOutfitDefinition& Outfit : BodyType->Outfits)
+			{
+				GetAnimToTextureDataAsset(Outfit.TopData);
+				GetAnimToTextureDataAsset(Outfit.BottomData);
+				GetAnimToTextureDataAsset(Outfit.ShoesData);
+			}
+		}
+
+		GetAnimToTextureDataAsset(Gender->FarLodMeshData);
 	}
 }
\ No newline at end of file
@@ -5,12 +5,14 @@
 #include "CoreMinimal.h"
 
 #include "CrowdCharacterDefinition.h"
+#include "CrowdVisualizationCustomData.h"
 #include "MassEntityTypes.h"
 #include "MassObserverProcessor.h"
 
 #include "CrowdVisualizationFragment.generated.h"
 
 struct FMassEntityQuery;
+class UCrowdCharacterDataAsset;
 
 USTRUCT()
 struct CITYSAMPLE_API FCitySampleCrowdVisualizationFragment : public FMassFragment
@@ -20,17 +22,24 @@ struct CITYSAMPLE_API FCitySampleCrowdVisualizationFragment : public FMassFragme
 	UPROPERTY(EditAnywhere, Category = "")
 	FCrowdVisualizationID VisualizationID;
 
-	UPROPERTY(EditAnywhere, Category = "")
-	uint32 TopColor = 0;
+	/** Color overrides quantize to the RGB565 word uploaded to the ISMs; setters take the 0xRRGGBBAA color from FindColorOverride */
+	void SetTopColor(const uint32 PackedRGBA) { PackedTopBottomColors = (PackedTopBottomColors & 0x0000ffff) | (static_cast<uint32>(UE::CitySampleCrowd::CustomData::PackColorVariation(PackedRGBA)) << 16); }
+	void SetBottomColor(const uint32 PackedRGBA) { PackedTopBottomColors = (PackedTopBottomColors & 0xffff0000) | UE::CitySampleCrowd::CustomData::PackColorVariation(PackedRGBA); }
+	void SetShoesColor(const uint32 PackedRGBA) { PackedShoesColorAndAtlas = (PackedShoesColorAndAtlas & 0x0000ffff) | (static_cast<uint32>(UE::CitySampleCrowd::CustomData::PackColorVariation(PackedRGBA)) << 16); }
 
-	UPROPERTY(EditAnywhere, Category = "")
-	uint32 BottomColor = 0;
+	uint16 GetTopColor565() const { return static_cast<uint16>(PackedTopBottomColors >> 16); }
+	uint16 GetBottomColor565() const { return static_cast<uint16>(PackedTopBottomColors & 0xffff); }
+	uint16 GetShoesColor565() const { return static_cast<uint16>(PackedShoesColorAndAtlas >> 16); }
 
-	UPROPERTY(EditAnywhere, Category = "")
-	uint32 ShoesColor = 0;
+	void SetSkinAtlasIndex(const uint8 InSkinAtlasIndex) { PackedShoesColorAndAtlas = (PackedShoesColorAndAtlas & 0xffff00ff) | (static_cast<uint32>(InSkinAtlasIndex) << 8); }
+	uint8 GetSkinAtlasIndex() const { return static_cast<uint8>((PackedShoesColorAndAtlas >> 8) & 0xff); }
 
-	UPROPERTY(EditAnywhere, Category = "")
-	uint8 SkinAtlasIndex = 0;
+private:
+	// Packed bit layout, see CrowdVisualizationCustomData.h for the GPU side:
+	//   PackedTopBottomColors     [31..16] top RGB565      [15..0] bottom RGB565
+	//   PackedShoesColorAndAtlas  [31..16] shoes RGB565    [15..8] skin atlas index  [7..0] unused
+	uint32 PackedTopBottomColors = 0;
+	uint32 PackedShoesColorAndAtlas = 0;
 };
 
 UCLASS()
@@ -50,5 +59,17 @@ protected:
 
 
 	uint32 FindColorOverride(FCrowdCharacterDefinition& CharacterDefinition, USkeletalMesh* SkelMesh);
-	UAnimToTextureDataAsset* GetAnimToTextureDataAsset(TSoftObjectPtr<UAnimToTextureDataAsset> SoftPtr);
+	UAnimToTextureDataAsset* GetAnimToTextureDataAsset(const TSoftObjectPtr<UAnimToTextureDataAsset>& SoftPtr);
+
+	/** Resolves every anim-to-texture soft reference of the data asset into the handle table in one
+	* pass, so bulk spawns reduce per-entity fragment initialization to plain table lookups */
+	void BuildAnimToTextureHandleTable(const UCrowdCharacterDataAsset& DataAsset);
+
+	/** Soft path to resolved asset; the hard references keep resolved assets alive with the initializer */
+	UPROPERTY(Transient)
+	TMap<FSoftObjectPath, TObjectPtr<UAnimToTextureDataAsset>> AnimToTextureHandleTable;
+
+	/** Data assets already folded into the handle table */
+	UPROPERTY(Transient)
+	TSet<TObjectPtr<const UCrowdCharacterDataAsset>> IndexedDataAssets;
 };
\ No newline at end of file
@@ -0,0 +1,39 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CitySampleActorDetectionSubsystem.h"
+
+#include "Game/CitySampleAsyncActorDetectionComponent.h"
+
+void UCitySampleActorDetectionSubsystem::RegisterComponent(UCitySampleAsyncActorDetectionComponent* Component)
+{
+	RegisteredComponents.AddUnique(Component);
+}
+
+void UCitySampleActorDetectionSubsystem::UnregisterComponent(UCitySampleAsyncActorDetectionComponent* Component)
+{
+	RegisteredComponents.RemoveSingleSwap(Component, EAllowShrinking::No);
+}
+
+void UCitySampleActorDetectionSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// One pass over every registered component, so all detection traces for the frame go to the
+	// physics scene as a single batch of async requests
+	for (int32 i = RegisteredComponents.Num() - 1; i >= 0; --i)
+	{
+		if (UCitySampleAsyncActorDetectionComponent* Component = RegisteredComponents[i].Get())
+		{
+			Component->UpdateDetection(DeltaTime);
+		}
+		else
+		{
+			RegisteredComponents.RemoveAtSwap(i, 1, EAllowShrinking::No);
+		}
+	}
+}
+
+TStatId UCitySampleActorDetectionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCitySampleActorDetectionSubsystem, STATGROUP_Tickables);
+}
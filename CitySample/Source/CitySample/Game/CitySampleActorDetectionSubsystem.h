@@ -0,0 +1,33 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "CitySampleActorDetectionSubsystem.generated.h"
+
+class UCitySampleAsyncActorDetectionComponent;
+
+/**
+ * Central manager for async actor detection. Active detection components register here and the
+ * subsystem submits all of their trace requests together in a single pass per frame, instead of
+ * every component paying for its own tick and scene-query dispatch.
+ */
+UCLASS()
+class UCitySampleActorDetectionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	void RegisterComponent(UCitySampleAsyncActorDetectionComponent* Component);
+	void UnregisterComponent(UCitySampleAsyncActorDetectionComponent* Component);
+
+	// UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	/** Active detection components whose trace requests are batched into this subsystem's tick */
+	TArray<TWeakObjectPtr<UCitySampleAsyncActorDetectionComponent>> RegisteredComponents;
+};
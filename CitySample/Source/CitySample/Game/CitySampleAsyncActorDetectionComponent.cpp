@@ -4,6 +4,7 @@
 
 #include "CitySample.h"
 #include "CollisionQueryParams.h"
+#include "Game/CitySampleActorDetectionSubsystem.h"
 #include "DrawDebugHelpers.h"
 #include "Engine/Engine.h"
 #include "Engine/HitResult.h"
@@ -30,10 +31,41 @@ UCitySampleAsyncActorDetectionComponent::UCitySampleAsyncActorDetectionComponent
 	ActorDetectionTraceDelegate.BindUObject(this, &UCitySampleAsyncActorDetectionComponent::HandleAsyncActorDetectionTrace);
 }
 
-void UCitySampleAsyncActorDetectionComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UCitySampleAsyncActorDetectionComponent::Activate(bool bReset)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	
+	Super::Activate(bReset);
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UCitySampleActorDetectionSubsystem* DetectionSubsystem = World->GetSubsystem<UCitySampleActorDetectionSubsystem>())
+		{
+			DetectionSubsystem->RegisterComponent(this);
+		}
+	}
+}
+
+void UCitySampleAsyncActorDetectionComponent::Deactivate()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UCitySampleActorDetectionSubsystem* DetectionSubsystem = World->GetSubsystem<UCitySampleActorDetectionSubsystem>())
+		{
+			DetectionSubsystem->UnregisterComponent(this);
+		}
+	}
+
+	Super::Deactivate();
+}
+
+void UCitySampleAsyncActorDetectionComponent::UpdateDetection(float DeltaTime)
+{
+	TimeUntilNextTrace -= DeltaTime;
+	if (TimeUntilNextTrace > 0.0f)
+	{
+		return;
+	}
+	TimeUntilNextTrace = TraceInterval;
+
 	UWorld* World = GetWorld();
 	if (World == nullptr)
 	{
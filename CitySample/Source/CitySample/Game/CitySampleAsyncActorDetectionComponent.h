@@ -55,11 +55,25 @@ public:
 	UPROPERTY(EditAnywhere)
 	TArray<FCitySampleAsyncTraceDef> TraceDefinitions;
 
+	/** Seconds between trace submissions for this component. 0 submits every frame. */
+	UPROPERTY(EditAnywhere)
+	float TraceInterval = 0.0f;
+
 	FTraceDelegate ActorDetectionTraceDelegate;
 
 	bool IsValidHitClass(UClass* HitClass);
 
 	void HandleAsyncActorDetectionTrace(const FTraceHandle& InTraceHandle, FTraceDatum& InTraceDatum);
 
-	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	// UActorComponent interface. Active components register with the detection subsystem, which
+	// batches all trace submissions into one pass per frame.
+	virtual void Activate(bool bReset = false) override;
+	virtual void Deactivate() override;
+
+	/** Called by the detection subsystem. Submits this component's traces when its cadence allows. */
+	void UpdateDetection(float DeltaTime);
+
+private:
+	/** Time left until this component submits traces again */
+	float TimeUntilNextTrace = 0.0f;
 };
\ No newline at end of file
@@ -24,9 +24,24 @@ UCitySampleGameInstanceBase::UCitySampleGameInstanceBase()
 
 void UCitySampleGameInstanceBase::OnSaveGameComplete(const FString& SaveFile, const int32 UserIndex, bool bSuccess)
 {
+	bSaveInFlight = false;
+
 	if (!bSuccess)
 	{
 		UE_LOG(LogCitySample, Warning, TEXT("Game was not successfully saved!"), *GetName());
+
+		// Re-dirty so the next save trigger retries the write
+		if (SaveGame)
+		{
+			SaveGame->MarkSectionDirty(ECitySampleSaveGameSection::Settings);
+		}
+	}
+
+	// Run the one save coalesced from triggers that came in while the write was in flight
+	if (bPendingSaveRequested)
+	{
+		bPendingSaveRequested = false;
+		SaveCitySampleGameData(true);
 	}
 }
 
@@ -34,11 +49,19 @@ void UCitySampleGameInstanceBase::Init()
 {
 	Super::Init();
 
+	// Kick the variety asset preload first, so the streaming threads work while the
+	// game thread reads the save file synchronously below
+	UCitySampleAssetManager* CitySampleAssetManager = CastChecked<UCitySampleAssetManager>(&UAssetManager::Get());
+	StartupPreloadHandle = CitySampleAssetManager->PreloadItemDefinitions();
+
 	// Loads a save game from disk, if it exists, or creates a new save game.
 	LoadCitySampleSaveGame(&bSaveGameLoaded);
+}
 
-	UCitySampleAssetManager* CitySampleAssetManager = CastChecked<UCitySampleAssetManager>(&UAssetManager::Get());
-	CitySampleAssetManager->PreloadItemDefinitions();
+bool UCitySampleGameInstanceBase::IsStartupWarmupComplete() const
+{
+	// A null handle means nothing was preloaded, e.g. the active preload profile deferred it
+	return !StartupPreloadHandle.IsValid() || StartupPreloadHandle->HasLoadCompleted() || StartupPreloadHandle->WasCanceled();
 }
 
 void UCitySampleGameInstanceBase::Shutdown()
@@ -118,20 +141,49 @@ UCitySampleSaveGame* UCitySampleGameInstanceBase::LoadCitySampleSaveGame(bool* c
 
 void UCitySampleGameInstanceBase::SaveCitySampleGameData(bool bAsync/*=true*/)
 {
-	if (SaveGame) 
+	if (SaveGame)
 	{
-		bool bX, bZ;
-		GetInvertedAxes(bX, SaveGame->bVerticalAxisInverted, bZ);
-		SaveGame->LookSensivity = GetLookSensitivity();
+		bool bX, bY, bZ;
+		GetInvertedAxes(bX, bY, bZ);
+		const FVector NewLookSensitivity = GetLookSensitivity();
 
 		// PlayerController may be null, so we can't always update rumble
+		bool bNewForceFeedbackEnabled = SaveGame->bForceFeedbackEnabled;
 		if (const APlayerController* const PC = UGameplayStatics::GetPlayerController(GetWorld(), 0))
 		{
-			SaveGame->bForceFeedbackEnabled = PC->bForceFeedbackEnabled;
+			bNewForceFeedbackEnabled = PC->bForceFeedbackEnabled;
+		}
+
+		// Only dirty the settings section when something actually changed since the last write
+		if ((SaveGame->bVerticalAxisInverted != bY)
+			|| (SaveGame->LookSensivity != NewLookSensitivity)
+			|| (SaveGame->bForceFeedbackEnabled != bNewForceFeedbackEnabled))
+		{
+			SaveGame->bVerticalAxisInverted = bY;
+			SaveGame->LookSensivity = NewLookSensitivity;
+			SaveGame->bForceFeedbackEnabled = bNewForceFeedbackEnabled;
+			SaveGame->MarkSectionDirty(ECitySampleSaveGameSection::Settings);
+		}
+
+		// Skip the serialization and write entirely when no section changed since the last save
+		if (!SaveGame->HasDirtySections() && UGameplayStatics::DoesSaveGameExist(SaveFileName, 0))
+		{
+			return;
 		}
 
 		if (bAsync)
-		{ 
+		{
+			// Coalesce rapid save triggers: one write in flight at a time, with one follow-up
+			// carrying whatever changed in the meantime
+			if (bSaveInFlight)
+			{
+				bPendingSaveRequested = true;
+				return;
+			}
+
+			bSaveInFlight = true;
+			SaveGame->ClearDirtySections();
+
 			// Start saving game data asynchronously...
 			FAsyncSaveGameToSlotDelegate AsyncSaveGameDelegate;
 			AsyncSaveGameDelegate.BindUObject(this, &UCitySampleGameInstanceBase::OnSaveGameComplete);
@@ -139,6 +191,8 @@ void UCitySampleGameInstanceBase::SaveCitySampleGameData(bool bAsync/*=true*/)
 		}
 		else
 		{
+			SaveGame->ClearDirtySections();
+
 			// Immediately save game data
 			OnSaveGameComplete(SaveFileName, 0, UGameplayStatics::SaveGameToSlot(SaveGame, SaveFileName, 0));
 		}
@@ -180,9 +234,10 @@ void UCitySampleGameInstanceBase::SetInvertedAxes(const bool bX, const bool bY,
 	UCitySampleInputModifierInvertAxis::bY = bY;
 	UCitySampleInputModifierInvertAxis::bZ = bZ;
 
-	if (SaveGame)
+	if (SaveGame && (SaveGame->bVerticalAxisInverted != bY))
 	{
 		SaveGame->bVerticalAxisInverted = bY;
+		SaveGame->MarkSectionDirty(ECitySampleSaveGameSection::Settings);
 	}
 }
 
@@ -195,9 +250,10 @@ void UCitySampleGameInstanceBase::SetLookSensitivity(const FVector Scalar)
 {
 	UCitySampleInputModifierLookSensitivity::Scalar = Scalar;
 
-	if (SaveGame)
+	if (SaveGame && (SaveGame->LookSensivity != Scalar))
 	{
 		SaveGame->LookSensivity = Scalar;
+		SaveGame->MarkSectionDirty(ECitySampleSaveGameSection::Settings);
 	}
 }
 
@@ -217,9 +273,10 @@ void UCitySampleGameInstanceBase::SetRumbleEnabled(const bool bEnabled)
 	{
 		PC->bForceFeedbackEnabled = bEnabled;
 
-		if (SaveGame)
+		if (SaveGame && (SaveGame->bForceFeedbackEnabled != bEnabled))
 		{
 			SaveGame->bForceFeedbackEnabled = bEnabled;
+			SaveGame->MarkSectionDirty(ECitySampleSaveGameSection::Settings);
 		}
 	}
 }
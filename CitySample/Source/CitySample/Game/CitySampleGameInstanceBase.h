@@ -10,6 +10,8 @@
 #include "CitySampleGameInstanceBase.generated.h"
 
 
+class FStreamableHandle;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCitySampleOnSaveGameLoaded, const UCitySampleSaveGame* const, LoadedSaveGame);
 
 UCLASS(Blueprintable)
@@ -108,6 +110,9 @@ public:
 		return BaseFollicleMaskTexture.LoadSynchronous();
 	}
 
+	/** Whether the startup variety asset preload kicked off during Init has finished. Used as a readiness gate before match start. */
+	bool IsStartupWarmupComplete() const;
+
 private:
 
 	/** Delegate providing default functionality for beginning streaming pause. */
@@ -119,6 +124,9 @@ private:
 	UPROPERTY()
 	UCitySampleSaveGame* SaveGame = nullptr;
 
+	/** Handle for the startup variety asset preload, which also keeps the preloaded assets resident. */
+	TSharedPtr<FStreamableHandle> StartupPreloadHandle;
+
 	// Callback for logging whether the game was successfully saved or not
 	void OnSaveGameComplete(const FString& SaveFile, const int32 UserIndex, bool bSuccess);
 
@@ -128,6 +136,12 @@ private:
 	/** Whether saved data has been loaded. */
 	bool bSaveGameLoaded = false;
 
+	/** Whether an async save is currently being written. */
+	bool bSaveInFlight = false;
+
+	/** Whether a save was requested while one was in flight, coalescing rapid save triggers into one follow-up write. */
+	bool bPendingSaveRequested = false;
+
 	// CVar sink handles and handlers to enable the default CVar values to be reset when set externally
 	FConsoleVariableSinkHandle NaniteVisualizationSinkHandle;
 	FConsoleVariableSinkHandle TemporalAASamplesSinkHandle;
@@ -3,6 +3,7 @@
 #include "Game/CitySampleGameMode.h"
 
 #include "CitySample.h"
+#include "Game/CitySampleGameInstanceBase.h"
 #include "Game/CitySampleGameState.h"
 #include "Game/CitySamplePlayerController.h"
 #include "Misc/CommandLine.h"
@@ -27,6 +28,12 @@ static TAutoConsoleVariable<bool> CVarUseSandboxIntro(
 	ECVF_Cheat
 );
 
+static TAutoConsoleVariable<bool> CVarGateMatchStartOnWarmup(
+	TEXT("CitySample.GateMatchStartOnWarmup"),
+	true,
+	TEXT("When true, match start (and player spawn) waits for the startup variety asset preload to finish, so first frames don't race the streaming"),
+	ECVF_Default);
+
 ACitySampleGameMode::ACitySampleGameMode()
 {
 	GameStateClass = ACitySampleGameState::StaticClass();
@@ -64,6 +71,23 @@ void ACitySampleGameMode::BeginPlay()
 	}
 }
 
+bool ACitySampleGameMode::ReadyToStartMatch_Implementation()
+{
+	// Readiness gate: hold match start until the startup warmup kicked off by the game instance completes
+	if (CVarGateMatchStartOnWarmup.GetValueOnGameThread())
+	{
+		if (const UCitySampleGameInstanceBase* const CitySampleGameInstance = GetGameInstance<UCitySampleGameInstanceBase>())
+		{
+			if (!CitySampleGameInstance->IsStartupWarmupComplete())
+			{
+				return false;
+			}
+		}
+	}
+
+	return Super::ReadyToStartMatch_Implementation();
+}
+
 void ACitySampleGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
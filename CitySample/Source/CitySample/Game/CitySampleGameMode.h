@@ -22,6 +22,10 @@ public:
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	//~ End AActor Interface
 
+	//~ Begin AGameMode Interface
+	virtual bool ReadyToStartMatch_Implementation() override;
+	//~ End AGameMode Interface
+
 	/** Checks several variables to determine whether or not to use the fly-in city intro when beginning play */
 	UFUNCTION(BlueprintPure, Category = "Sandbox")
 	bool UseSandboxIntro() const;
@@ -8,6 +8,10 @@
 #include "Util/CitySampleTypes.h"
 
 
+// Interaction components are sparse (vehicle doors and a handful of world interactions), so
+// interactors scan this flat list instead of paying for physics overlap queries every tick.
+static TArray<UCitySampleInteractionComponent*> RegisteredInteractionComponents;
+
 // Sets default values for this component's properties
 UCitySampleInteractionComponent::UCitySampleInteractionComponent(const class FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -19,6 +23,25 @@ UCitySampleInteractionComponent::UCitySampleInteractionComponent(const class FOb
 	BodyInstance.SetCollisionProfileNameDeferred(CitySampleColisionProfile_Interaction);
 }
 
+void UCitySampleInteractionComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	RegisteredInteractionComponents.Add(this);
+}
+
+void UCitySampleInteractionComponent::OnUnregister()
+{
+	RegisteredInteractionComponents.RemoveSingleSwap(this, EAllowShrinking::No);
+
+	Super::OnUnregister();
+}
+
+const TArray<UCitySampleInteractionComponent*>& UCitySampleInteractionComponent::GetRegisteredInteractionComponents()
+{
+	return RegisteredInteractionComponents;
+}
+
 void UCitySampleInteractionComponent::FinishInteraction()
 {
 	if (CurrentInteractor != nullptr)
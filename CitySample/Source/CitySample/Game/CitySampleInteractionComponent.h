@@ -21,10 +21,19 @@ class CITYSAMPLE_API UCitySampleInteractionComponent : public USphereComponent
 {
 	GENERATED_BODY()
 
-public:	
+public:
 	// Sets default values for this component's properties
 	UCitySampleInteractionComponent(const class FObjectInitializer& ObjectInitializer);
 
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+
+	/**
+	 * All currently registered interaction components, maintained by OnRegister/OnUnregister.
+	 * Lets interactors find nearby candidates without running overlap queries. Game thread only.
+	 */
+	static const TArray<UCitySampleInteractionComponent*>& GetRegisteredInteractionComponents();
+
 	bool TryToLockInteraction(const TScriptInterface<ICitySampleInteractorInterface>& Interactor);
 	bool TryToReleaseInteraction(const TScriptInterface<ICitySampleInteractorInterface>& Interactor);
 
@@ -5,6 +5,7 @@
 #include "Algo/Sort.h"
 #include "WorldPartition/DataLayer/DataLayerManager.h"
 #include "WorldPartition/WorldPartitionRuntimeCell.h"
+#include "WorldPartition/WorldPartitionStreamingSource.h"
 #include "WorldPartition/WorldPartitionSubsystem.h"
 
 #include "Engine/OverlapResult.h"
@@ -15,6 +16,7 @@
 
 #include "Camera/CitySamplePlayerCameraManager.h"
 #include "Camera/PhotoModeComponent.h"
+#include "Character/CitySampleCharacter.h"
 #include "CitySample.h"
 #include "Game/CitySampleCheatManager.h"
 #include "Game/CitySampleGameInstanceBase.h"
@@ -128,6 +130,7 @@ ACitySamplePlayerController::ACitySamplePlayerController()
 
 	bScaleInteractionRadius = true;
 	InteractionRadius = 128.f;
+	InteractionCandidateRefreshInterval = 0.25f;
 
 	CheatClass = UCitySampleCheatManager::StaticClass();
 
@@ -203,6 +206,104 @@ void ACitySamplePlayerController::SetupInputComponent()
 	}
 }
 
+void ACitySamplePlayerController::PreProcessInput(const float DeltaTime, const bool bGamePaused)
+{
+	Super::PreProcessInput(DeltaTime, bGamePaused);
+
+	if (PendingSyntheticInput.Num() == 0)
+	{
+		return;
+	}
+
+	// Apply all due events in one pass ahead of input processing, so injected values take part
+	// in this tick's Enhanced Input evaluation alongside real device input
+	const double Now = FPlatformTime::Seconds();
+	for (int32 i = 0; i < PendingSyntheticInput.Num(); ++i)
+	{
+		if (PendingSyntheticInput[i].ApplyTime <= Now)
+		{
+			ApplySyntheticInputEvent(PendingSyntheticInput[i]);
+			PendingSyntheticInput.RemoveAtSwap(i--, 1, EAllowShrinking::No);
+		}
+	}
+}
+
+bool ACitySamplePlayerController::InjectStrandsInputBatch(const TArray<FStrandsSyntheticInputEvent>& Events)
+{
+	if (!IsLocalController())
+	{
+		return false;
+	}
+
+	PendingSyntheticInput.Append(Events);
+	return true;
+}
+
+void ACitySamplePlayerController::QueueSyntheticInputEvents(const TArray<FStrandsSyntheticInputEvent>& Events)
+{
+	InjectStrandsInputBatch(Events);
+}
+
+void ACitySamplePlayerController::ApplySyntheticInputEvent(const FStrandsSyntheticInputEvent& Event)
+{
+	UEnhancedInputLocalPlayerSubsystem* InputSubsystem = nullptr;
+	if (ULocalPlayer* LocalPlayer = GetLocalPlayer())
+	{
+		InputSubsystem = LocalPlayer->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>();
+	}
+
+	APawn* CurrentPawn = GetPawn();
+
+	switch (Event.Type)
+	{
+	case EStrandsSyntheticInputType::Move:
+		if (InputSubsystem && SyntheticMoveAction)
+		{
+			InputSubsystem->InjectInputForAction(SyntheticMoveAction, FInputActionValue(FVector2D(Event.Value)), {}, {});
+		}
+		else if (CurrentPawn)
+		{
+			CurrentPawn->AddMovementInput(CurrentPawn->GetActorForwardVector(), Event.Value.X);
+			CurrentPawn->AddMovementInput(CurrentPawn->GetActorRightVector(), Event.Value.Y);
+		}
+		break;
+
+	case EStrandsSyntheticInputType::Look:
+		if (InputSubsystem && SyntheticLookAction)
+		{
+			InputSubsystem->InjectInputForAction(SyntheticLookAction, FInputActionValue(FVector2D(Event.Value)), {}, {});
+		}
+		else
+		{
+			AddYawInput(Event.Value.X);
+			AddPitchInput(Event.Value.Y);
+		}
+		break;
+
+	case EStrandsSyntheticInputType::Jump:
+		if (InputSubsystem && SyntheticJumpAction)
+		{
+			InputSubsystem->InjectInputForAction(SyntheticJumpAction, FInputActionValue(true), {}, {});
+		}
+		else if (ACharacter* Character = Cast<ACharacter>(CurrentPawn))
+		{
+			Character->Jump();
+		}
+		break;
+
+	case EStrandsSyntheticInputType::Sprint:
+		if (InputSubsystem && SyntheticSprintAction)
+		{
+			InputSubsystem->InjectInputForAction(SyntheticSprintAction, FInputActionValue(Event.Value.X > 0.f), {}, {});
+		}
+		else if (ACitySampleCharacter* CitySampleCharacter = Cast<ACitySampleCharacter>(CurrentPawn))
+		{
+			CitySampleCharacter->SetIsSprinting(Event.Value.X > 0.f);
+		}
+		break;
+	}
+}
+
 void ACitySamplePlayerController::SetPawn(APawn* InPawn)
 {
 	TScriptInterface<IEnhancedInputSubsystemInterface> EnhancedInputInterface;
@@ -501,27 +602,38 @@ void ACitySamplePlayerController::UpdateInteractionPrompt()
 		{
 			const FTransform RootComponentTransform = GetRootComponent()->GetComponentToWorld();
 			const FVector RootComponentLocation = RootComponentTransform.GetLocation();
+			const float ScaledInteractionRadius = (bScaleInteractionRadius ? RootComponentTransform.GetMinimumAxisScale() : 1.f) * InteractionRadius;
 
-			TArray<struct FOverlapResult> OutOverlaps;
-
-			FCollisionShape CollisionShape;
-			CollisionShape.SetSphere((bScaleInteractionRadius ? RootComponentTransform.GetMinimumAxisScale() : 1.f) * InteractionRadius);
+			// Refresh the candidate list at a low rate. The padding keeps candidates valid while the
+			// player moves between refreshes, so ticks in between only rerank the current candidates.
+			const float InteractionCandidatePadding = 1000.f;
+			TimeUntilInteractionCandidateRefresh -= GetWorld()->GetDeltaSeconds();
+			if (TimeUntilInteractionCandidateRefresh <= 0.f)
+			{
+				TimeUntilInteractionCandidateRefresh = InteractionCandidateRefreshInterval;
+				RefreshInteractionCandidates(RootComponentLocation, ScaledInteractionRadius + InteractionCandidatePadding);
+			}
 
-			if (GetWorld()->OverlapMultiByChannel(OutOverlaps, RootComponentLocation, RootComponentTransform.GetRotation(), CitySampleECC_InteractionsTrace, CollisionShape))
+			if (CandidateInteractions.Num() > 0)
 			{
 				using FRankType = TPair<UCitySampleInteractionComponent*, float>;
 				TArray<FRankType> FoundComponents;
-				for (int32 i = OutOverlaps.Num() - 1; i >= 0; --i)
+				for (int32 i = CandidateInteractions.Num() - 1; i >= 0; --i)
 				{
-					if (UCitySampleInteractionComponent* PotentialOveraction = Cast<UCitySampleInteractionComponent>(OutOverlaps[i].GetComponent()))
+					UCitySampleInteractionComponent* PotentialOveraction = CandidateInteractions[i].Get();
+					if (PotentialOveraction == nullptr)
 					{
-						if (PotentialOveraction->CanInteractWith(Interactor))
-						{
-							const float DistanceSquared = (PotentialOveraction->GetComponentToWorld().GetLocation() - RootComponentLocation).SizeSquared();
-							
-							OverlappingInteractions.Add(PotentialOveraction);
-							FoundComponents.Emplace(PotentialOveraction, DistanceSquared);
-						}
+						CandidateInteractions.RemoveAtSwap(i, 1, EAllowShrinking::No);
+						continue;
+					}
+
+					const float DistanceSquared = (PotentialOveraction->GetComponentToWorld().GetLocation() - RootComponentLocation).SizeSquared();
+					const float InRangeDistance = ScaledInteractionRadius + PotentialOveraction->GetScaledSphereRadius();
+
+					if (DistanceSquared <= FMath::Square(InRangeDistance) && PotentialOveraction->CanInteractWith(Interactor))
+					{
+						OverlappingInteractions.Add(PotentialOveraction);
+						FoundComponents.Emplace(PotentialOveraction, DistanceSquared);
 					}
 				}
 
@@ -552,6 +664,27 @@ void ACitySamplePlayerController::UpdateInteractionPrompt()
 	}
 }
 
+void ACitySamplePlayerController::RefreshInteractionCandidates(const FVector& InteractorLocation, float BroadRadius)
+{
+	CandidateInteractions.Reset();
+
+	const UWorld* World = GetWorld();
+	for (UCitySampleInteractionComponent* InteractionComponent : UCitySampleInteractionComponent::GetRegisteredInteractionComponents())
+	{
+		// The registry spans all worlds, e.g. editor preview scenes
+		if (InteractionComponent->GetWorld() != World)
+		{
+			continue;
+		}
+
+		const float BroadDistance = BroadRadius + InteractionComponent->GetScaledSphereRadius();
+		if (FVector::DistSquared(InteractionComponent->GetComponentToWorld().GetLocation(), InteractorLocation) <= FMath::Square(BroadDistance))
+		{
+			CandidateInteractions.Add(InteractionComponent);
+		}
+	}
+}
+
 // End Interactions
 //////////////////////////////////////////////////////////////////////////
 
@@ -863,6 +996,9 @@ void ACitySamplePlayerController::UpdateSpawnTransformForLeavingDrone()
 	const float TravelDistance = (DroneLocation - DroneToggleSpawnTransform.GetTranslation()).Size2D();
 	if (TravelDistance > CameraTransitionLevelStreamDistance2D)
 	{
+		// The spawn transform is final at this point but the pawn swap hasn't happened yet,
+		// so start streaming the destination now and let it overlap the fade-out
+		PrefetchLongDistanceCameraTransition(DroneToggleSpawnTransform.GetTranslation());
 		HandleLongDistanceCameraTransition();
 	}
 	else
@@ -934,43 +1070,53 @@ void ACitySamplePlayerController::HandleLongDistanceCameraTransition()
 	}
 }
 
+bool ACitySamplePlayerController::IsStreamingCompletedAtLocation(const FVector& Location, const FRotator& Rotation) const
+{
+	const UWorld* World = GetWorld();
+	UWorldPartitionSubsystem* WorldPartitionSubsystem = World ? World->GetSubsystem<UWorldPartitionSubsystem>() : nullptr;
+	UDataLayerManager* DataLayerManager = UDataLayerManager::GetDataLayerManager(World);
+	if (!WorldPartitionSubsystem || !DataLayerManager)
+	{
+		// With no world partition there is nothing to wait on
+		return true;
+	}
+
+	// Build a query source
+	TArray<FWorldPartitionStreamingQuerySource> QuerySources;
+	FWorldPartitionStreamingQuerySource& QuerySource = QuerySources.Emplace_GetRef();
+	QuerySource.bSpatialQuery = true;
+	QuerySource.Location = Location;
+	QuerySource.Rotation = Rotation;
+	QuerySource.bUseGridLoadingRange = false;
+	QuerySource.Radius = CameraTransitionWPQueryDistance;
+	QuerySource.bDataLayersOnly = false;
+	QuerySource.DataLayers = DataLayerManager->GetEffectiveLoadedDataLayerNames().Array();
+
+	// Execute query
+	const EWorldPartitionRuntimeCellState QueryState = EWorldPartitionRuntimeCellState::Loaded;
+	return WorldPartitionSubsystem->IsStreamingCompleted(QueryState, QuerySources, /*bExactState*/ false);
+}
+
 void ACitySamplePlayerController::CheckIfSafeToEndCameraTransition()
 {
 	if (UWorld* World = GetWorld())
 	{
 		// Wait for the world partition bubble to be loaded
-		UWorldPartitionSubsystem* WorldPartitionSubsystem = World->GetSubsystem<UWorldPartitionSubsystem>();
-		UDataLayerManager* DataLayerManager = UDataLayerManager::GetDataLayerManager(World);
-		if (WorldPartitionSubsystem && DataLayerManager)
-		{
-			FVector VPLocation;
-			FRotator VPRotation;
-			GetActorEyesViewPoint(VPLocation, VPRotation);
-
-			// Build a query source
-			TArray<FWorldPartitionStreamingQuerySource> QuerySources;
-			FWorldPartitionStreamingQuerySource& QuerySource = QuerySources.Emplace_GetRef();
-			QuerySource.bSpatialQuery = true;
-			QuerySource.Location = VPLocation;
-			QuerySource.Rotation = VPRotation;
-			QuerySource.bUseGridLoadingRange = false;
-			QuerySource.Radius = CameraTransitionWPQueryDistance;
-			QuerySource.bDataLayersOnly = false;
-			QuerySource.DataLayers = DataLayerManager->GetEffectiveLoadedDataLayerNames().Array();
-
-			// Execute query
-			const EWorldPartitionRuntimeCellState QueryState = EWorldPartitionRuntimeCellState::Loaded;
-			const bool bStreamingCompleted = WorldPartitionSubsystem->IsStreamingCompleted(QueryState, QuerySources, /*bExactState*/ false);
-
-			if (!bStreamingCompleted)
-			{
-				return;
-			}
+		FVector VPLocation;
+		FRotator VPRotation;
+		GetActorEyesViewPoint(VPLocation, VPRotation);
 
-			World->GetTimerManager().ClearTimer(CameraTransitionWaitingForLevelStreamingHandle);
+		if (!IsStreamingCompletedAtLocation(VPLocation, VPRotation))
+		{
+			return;
 		}
+
+		World->GetTimerManager().ClearTimer(CameraTransitionWaitingForLevelStreamingHandle);
 	}
 
+	// The destination is streamed in, so the prefetch source has done its job
+	ClearLongDistanceCameraTransitionPrefetch();
+
 	// Don't fade from black, if fading wasn't done before
 	if (PlayerCameraManager && PlayerCameraManager->bEnableFading)
 	{
@@ -981,4 +1127,83 @@ void ACitySamplePlayerController::CheckIfSafeToEndCameraTransition()
 	{
 		GEngine->EndStreamingPauseDelegate->Execute();
 	}
+}
+
+bool ACitySamplePlayerController::GetStreamingSources(TArray<FWorldPartitionStreamingSource>& OutStreamingSources) const
+{
+	const bool bHasSources = Super::GetStreamingSources(OutStreamingSources);
+
+	if (!bCameraTransitionPrefetchActive)
+	{
+		return bHasSources;
+	}
+
+	// Report an extra source at the pending teleport destination so world partition starts
+	// loading it while the fade-out and pawn swap are still in flight
+	FWorldPartitionStreamingSource& PrefetchSource = OutStreamingSources.Emplace_GetRef();
+	PrefetchSource.Name = TEXT("CameraTransitionPrefetch");
+	PrefetchSource.Location = CameraTransitionPrefetchLocation;
+	PrefetchSource.Rotation = FRotator::ZeroRotator;
+	PrefetchSource.TargetState = EStreamingSourceTargetState::Activated;
+	PrefetchSource.Priority = EStreamingSourcePriority::High;
+	PrefetchSource.bBlockOnSlowLoading = false;
+
+	return true;
+}
+
+void ACitySamplePlayerController::PrefetchLongDistanceCameraTransition(FVector Destination)
+{
+	bCameraTransitionPrefetchActive = true;
+	bCameraTransitionPrefetchReady = false;
+	CameraTransitionPrefetchLocation = Destination;
+
+	if (UWorld* World = GetWorld())
+	{
+		CameraTransitionPrefetchStartTime = World->GetTimeSeconds();
+		World->GetTimerManager().SetTimer(CameraTransitionPrefetchHandle, this, &ThisClass::CheckCameraTransitionPrefetch, 0.25f, true);
+	}
+}
+
+void ACitySamplePlayerController::ClearLongDistanceCameraTransitionPrefetch()
+{
+	if (!bCameraTransitionPrefetchActive)
+	{
+		return;
+	}
+
+	bCameraTransitionPrefetchActive = false;
+	bCameraTransitionPrefetchReady = false;
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(CameraTransitionPrefetchHandle);
+	}
+}
+
+void ACitySamplePlayerController::CheckCameraTransitionPrefetch()
+{
+	UWorld* World = GetWorld();
+	if (!World || !bCameraTransitionPrefetchActive || bCameraTransitionPrefetchReady)
+	{
+		return;
+	}
+
+	const bool bStreamingCompleted = IsStreamingCompletedAtLocation(CameraTransitionPrefetchLocation, FRotator::ZeroRotator);
+	const bool bTimedOut = (World->GetTimeSeconds() - CameraTransitionPrefetchStartTime) > CameraTransitionPrefetchTimeout;
+
+	if (!bStreamingCompleted && !bTimedOut)
+	{
+		return;
+	}
+
+	if (bTimedOut && !bStreamingCompleted)
+	{
+		UE_LOG(LogCitySample, Warning, TEXT("ACitySamplePlayerController::CheckCameraTransitionPrefetch timed out waiting for streaming at %s"), *CameraTransitionPrefetchLocation.ToCompactString());
+	}
+
+	// Stop polling but keep the streaming source registered until the transition completes,
+	// so the destination cells stay requested while the teleport lands
+	World->GetTimerManager().ClearTimer(CameraTransitionPrefetchHandle);
+	bCameraTransitionPrefetchReady = true;
+	OnCameraTransitionPrefetchReady.Broadcast();
 }
\ No newline at end of file
@@ -12,6 +12,7 @@
 #endif // UE_ENABLE_INCLUDE_ORDER_DEPRECATED_IN_5_6
 #include "MassEntityHandle.h"
 #include "Game/CitySampleInteractorInterface.h"
+#include "StrandsBatchInputReceiver.h"
 #include "UI/CitySampleControlsOverlayInterface.h"
 #include "Util/CitySampleTypes.h"
 
@@ -23,16 +24,19 @@ class UCitySampleUIComponent;
 class UInputAction;
 class UInputMappingContext;
 class UPhotoModeComponent;
+struct FWorldPartitionStreamingSource;
 
 DECLARE_MULTICAST_DELEGATE_ThreeParams(FNotifyPawnChanged, AController*, APawn*, APawn*);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnCameraTransitionPrefetchReady);
 
 /**
  * Player Controller implementation specialized for City Sample needs
  */
 UCLASS()
-class CITYSAMPLE_API ACitySamplePlayerController : public APlayerController, 
-										   public ICitySampleControlsOverlayInterface, 
-										   public ICitySampleInteractorInterface
+class CITYSAMPLE_API ACitySamplePlayerController : public APlayerController,
+										   public ICitySampleControlsOverlayInterface,
+										   public ICitySampleInteractorInterface,
+										   public IStrandsBatchInputReceiver
 {
 	GENERATED_BODY()
 	
@@ -49,7 +53,22 @@ public:
 	virtual void PostInitializeComponents() override;
 	virtual void UpdateRotation(float DeltaTime) override;
 	virtual void SetupInputComponent() override;
+	virtual void PreProcessInput(const float DeltaTime, const bool bGamePaused) override;
+	virtual bool GetStreamingSources(TArray<FWorldPartitionStreamingSource>& OutStreamingSources) const override;
 	//~ End APlayerController Interface
+
+	//~ Begin IStrandsBatchInputReceiver Interface
+	virtual bool InjectStrandsInputBatch(const TArray<FStrandsSyntheticInputEvent>& Events) override;
+	//~ End IStrandsBatchInputReceiver Interface
+
+	/**
+	 * Queues timestamped synthetic input events. Due events are applied in one pass per tick
+	 * ahead of input processing, routed through Enhanced Input injection when the matching
+	 * synthetic input action is configured, so they follow the same buffering and consumption
+	 * semantics as player input. Events with a future ApplyTime stay queued until due.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Input")
+	void QueueSyntheticInputEvents(const TArray<FStrandsSyntheticInputEvent>& Events);
 	
 	//~ Begin AController Interface
 	virtual void SetPawn(APawn* InPawn) override;
@@ -161,6 +180,30 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void HandleLongDistanceCameraTransition();
 
+	/**
+	 * Registers an extra world partition streaming source at a teleport destination before the move happens,
+	 * so loading overlaps the fade-out instead of starting once the pawn arrives. OnCameraTransitionPrefetchReady
+	 * fires when the destination cell set is loaded. The source stays registered until the following long
+	 * distance transition completes, or until ClearLongDistanceCameraTransitionPrefetch is called.
+	 */
+	UFUNCTION(BlueprintCallable)
+	void PrefetchLongDistanceCameraTransition(FVector Destination);
+
+	/** Drops the prefetch streaming source; call if a prefetched teleport is abandoned */
+	UFUNCTION(BlueprintCallable)
+	void ClearLongDistanceCameraTransitionPrefetch();
+
+	/** Returns true when the most recent prefetch destination has finished streaming */
+	UFUNCTION(BlueprintPure)
+	bool IsCameraTransitionPrefetchReady() const
+	{
+		return bCameraTransitionPrefetchReady;
+	}
+
+	/** Broadcast when a prefetched teleport destination has finished streaming (or the prefetch timed out) */
+	UPROPERTY(BlueprintAssignable)
+	FOnCameraTransitionPrefetchReady OnCameraTransitionPrefetchReady;
+
 	/** Attempts to interact with the current visible interaction component */
 	UFUNCTION(BlueprintCallable)
 	void TryToInteractWithRelevantInteraction();
@@ -210,6 +253,23 @@ protected:
 	UPROPERTY(EditDefaultsOnly)
 	bool bScaleInteractionRadius;
 
+	/** Seconds between refreshes of the nearby interaction candidate list. Ticks in between only rerank the current candidates. */
+	UPROPERTY(EditDefaultsOnly)
+	float InteractionCandidateRefreshInterval;
+
+	/** Input actions that synthetic input events inject through. Unset entries fall back to direct pawn input. */
+	UPROPERTY(EditDefaultsOnly, Category = "Input|Synthetic")
+	UInputAction* SyntheticMoveAction = nullptr;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Input|Synthetic")
+	UInputAction* SyntheticLookAction = nullptr;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Input|Synthetic")
+	UInputAction* SyntheticJumpAction = nullptr;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Input|Synthetic")
+	UInputAction* SyntheticSprintAction = nullptr;
+
 	/** Mapping of player controller relevant InputActions to their string description for the controls overlay UI. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Controls Overlay")
 	TMap<UInputAction*, FText> InputActionDescriptions;
@@ -235,6 +295,12 @@ private:
 	/** Mass Entity Handle for the vehicle the player is currently driving */
 	FMassEntityHandle CurrentPlayerVehicleMassHandle;
 
+	/** Applies a single due synthetic input event, through Enhanced Input injection when configured */
+	void ApplySyntheticInputEvent(const FStrandsSyntheticInputEvent& Event);
+
+	/** Queued synthetic input events waiting to be applied ahead of input processing */
+	TArray<FStrandsSyntheticInputEvent> PendingSyntheticInput;
+
 	/** Processes the validity of an interaction component's state. Used when attempting to start or finish an interaction */
 	void TryToUpdateInteraction(UCitySampleInteractionComponent* Interaction, uint8 InteractionState);
 
@@ -256,6 +322,15 @@ private:
 	/** Set of possible interactions that the player is within range to interact with */
 	TSet<UCitySampleInteractionComponent*> OverlappingInteractions;
 
+	/** Rebuilds the interaction candidate list from the registered interaction components within the given radius */
+	void RefreshInteractionCandidates(const FVector& InteractorLocation, float BroadRadius);
+
+	/** Nearby interaction components considered for the prompt, refreshed at a low rate and reranked per tick */
+	TArray<TWeakObjectPtr<UCitySampleInteractionComponent>> CandidateInteractions;
+
+	/** Time left until the next interaction candidate list refresh */
+	float TimeUntilInteractionCandidateRefresh = 0.0f;
+
 	/** Struct for storing sets of interaction components along with their current state */
 	struct FInteractionItem
 	{
@@ -270,6 +345,13 @@ private:
 	UFUNCTION()
 	void CheckIfSafeToEndCameraTransition();
 
+	/** Check if the prefetch destination has finished streaming so the ready delegate can fire */
+	UFUNCTION()
+	void CheckCameraTransitionPrefetch();
+
+	/** Returns true when the world partition bubble around the given viewpoint has finished loading */
+	bool IsStreamingCompletedAtLocation(const FVector& Location, const FRotator& Rotation) const;
+
 	/** Requests that the camera manager begin a fade to black, and sets up a timer to follow up with EndPenetratingCameraTransition */
 	void HandlePenetratingCameraTransition();
 
@@ -302,6 +384,25 @@ private:
 	UPROPERTY(Config)
 	float CameraTransitionWPQueryDistance = 10000.0f;
 
+	/** Maximum time to poll a prefetch destination before broadcasting the ready delegate regardless, so callers are never stuck waiting */
+	UPROPERTY(Config)
+	float CameraTransitionPrefetchTimeout = 10.0f;
+
+	/** Handle for looped timer that polls streaming status at the prefetch destination */
+	FTimerHandle CameraTransitionPrefetchHandle;
+
+	/** Destination the prefetch streaming source is currently parked at */
+	FVector CameraTransitionPrefetchLocation = FVector::ZeroVector;
+
+	/** World time when the current prefetch was requested, for timeout tracking */
+	float CameraTransitionPrefetchStartTime = 0.0f;
+
+	/** True while the prefetch streaming source should be reported from GetStreamingSources */
+	bool bCameraTransitionPrefetchActive = false;
+
+	/** True once the prefetch destination has finished streaming */
+	bool bCameraTransitionPrefetchReady = false;
+
 	/** Stores last player rotation input to be used with RotationInputWasZero()*/
 	FRotator LastRotationInput;
 
@@ -6,6 +6,14 @@
 #include "GameFramework/SaveGame.h"
 #include "CitySampleSaveGame.generated.h"
 
+/** Sections of the save game that are dirtied independently, so clean saves can be skipped entirely. */
+UENUM()
+enum class ECitySampleSaveGameSection : uint8
+{
+	Settings = 1 << 0,
+};
+ENUM_CLASS_FLAGS(ECitySampleSaveGameSection);
+
 /**
  * Save game class for CitySample
  */
@@ -18,10 +26,33 @@ public:
 
 	UPROPERTY(BlueprintReadOnly, Category="Settings")
 	bool bVerticalAxisInverted = false;
-	
+
 	UPROPERTY(BlueprintReadOnly, Category="Settings")
 	FVector LookSensivity = { 1.0f, 1.0f, 1.0f };
 
 	UPROPERTY(BlueprintReadOnly, Category="Settings")
 	bool bForceFeedbackEnabled = true;
+
+	/** Marks a section's data as changed, so the next save triggers a write. */
+	void MarkSectionDirty(const ECitySampleSaveGameSection Section)
+	{
+		DirtySections |= Section;
+	}
+
+	/** Whether any section has changed since the last write was dispatched. */
+	bool HasDirtySections() const
+	{
+		return DirtySections != ECitySampleSaveGameSection(0);
+	}
+
+	/** Called when a write is dispatched. Changes made while the write is in flight dirty the sections again. */
+	void ClearDirtySections()
+	{
+		DirtySections = ECitySampleSaveGameSection(0);
+	}
+
+private:
+
+	/** Sections changed since the last write. Transient bookkeeping, not serialized. */
+	ECitySampleSaveGameSection DirtySections = ECitySampleSaveGameSection(0);
 };
@@ -0,0 +1,230 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CitySampleFrameMetricsCollector.h"
+
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "MassEntitySubsystem.h"
+#include "Misc/App.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "RenderCore.h"
+
+#include "CitySampleTestControllerBase.h"
+
+namespace CitySampleTest
+{
+	static TAutoConsoleVariable<float> CVarFrameMetricsDumpInterval(
+		TEXT("CitySampleTest.FrameMetrics.DumpInterval"),
+		60.0f,
+		TEXT("Duration in seconds between percentile histogram dumps of the frame metrics window. 0 or less disables periodic dumps."),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<float> CVarFrameMetricsHitchThresholdMS(
+		TEXT("CitySampleTest.FrameMetrics.HitchThresholdMS"),
+		100.0f,
+		TEXT("Frame time in milliseconds above which the recent frame breakdowns are snapshotted to the hitch CSV. 0 or less disables hitch capture."),
+		ECVF_Default);
+
+	/** Minimum time between hitch captures, so a sustained stall does not flood the hitch CSV with overlapping snapshots. */
+	static constexpr double HitchCaptureCooldownSeconds = 5.0;
+
+	static FString GetFrameMetricsDirectory()
+	{
+		return FPaths::ProfilingDir() / TEXT("CitySampleFrameMetrics");
+	}
+
+	static void AppendCsvLine(const FString& FilePath, const FString& Line)
+	{
+		FFileHelper::SaveStringToFile(Line + LINE_TERMINATOR, *FilePath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+	}
+
+	/** Returns the value at the given percentile of an unsorted sample set. Sorts in place. */
+	static float GetPercentile(TArray<float>& Values, const float Percentile)
+	{
+		if (Values.IsEmpty())
+		{
+			return 0.0f;
+		}
+
+		Values.Sort();
+		const int32 Index = FMath::Clamp(FMath::RoundToInt32(Percentile * (Values.Num() - 1)), 0, Values.Num() - 1);
+		return Values[Index];
+	}
+}
+
+FCitySampleFrameMetricsCollector::~FCitySampleFrameMetricsCollector()
+{
+	if (bStarted)
+	{
+		FCoreDelegates::OnEndFrame.RemoveAll(this);
+		bStarted = false;
+	}
+}
+
+void FCitySampleFrameMetricsCollector::Start()
+{
+	if (bStarted)
+	{
+		return;
+	}
+
+	SessionTimestamp = FDateTime::Now().ToString(TEXT("%Y.%m.%d-%H.%M.%S"));
+	FrameCount = 0;
+	HitchCaptureCount = 0;
+	LastDumpTime = FPlatformTime::Seconds();
+	LastHitchCaptureTime = 0.0;
+	bWroteHistogramHeader = false;
+	bWroteHitchHeader = false;
+
+	FCoreDelegates::OnEndFrame.AddRaw(this, &FCitySampleFrameMetricsCollector::OnEndFrame);
+	bStarted = true;
+
+	UE_LOG(LogCitySampleTest, Display, TEXT("%s: frame metrics collection started, dumping to '%s'."), ANSI_TO_TCHAR(__func__), *CitySampleTest::GetFrameMetricsDirectory());
+}
+
+void FCitySampleFrameMetricsCollector::Stop()
+{
+	if (!bStarted)
+	{
+		return;
+	}
+
+	FCoreDelegates::OnEndFrame.RemoveAll(this);
+	bStarted = false;
+
+	// Final dump so the tail of the run is covered even when it is shorter than the dump interval
+	if (FrameCount > 0)
+	{
+		DumpHistogram();
+	}
+}
+
+void FCitySampleFrameMetricsCollector::OnEndFrame()
+{
+	FCitySampleFrameSample& Sample = Samples[FrameCount % WindowSize];
+	Sample.FrameMS = static_cast<float>(FApp::GetDeltaTime() * 1000.0);
+	Sample.GameThreadMS = FPlatformTime::ToMilliseconds(GGameThreadTime);
+	Sample.RenderThreadMS = FPlatformTime::ToMilliseconds(GRenderThreadTime);
+	Sample.RHIThreadMS = FPlatformTime::ToMilliseconds(GRHIThreadTime);
+	Sample.MassEntityCount = 0;
+
+#if WITH_MASSENTITY_DEBUG
+	if (const UWorld* const World = WeakWorld.Get())
+	{
+		if (const UMassEntitySubsystem* const EntitySubsystem = World->GetSubsystem<UMassEntitySubsystem>())
+		{
+			Sample.MassEntityCount = EntitySubsystem->GetEntityManager().DebugGetEntityCount();
+		}
+	}
+#endif
+
+	++FrameCount;
+
+	const double Now = FPlatformTime::Seconds();
+
+	const float HitchThresholdMS = CitySampleTest::CVarFrameMetricsHitchThresholdMS.GetValueOnGameThread();
+	if ((HitchThresholdMS > 0.0f) && (Sample.FrameMS > HitchThresholdMS) && (Now - LastHitchCaptureTime >= CitySampleTest::HitchCaptureCooldownSeconds))
+	{
+		LastHitchCaptureTime = Now;
+		CaptureHitch(Sample.FrameMS);
+	}
+
+	const float DumpInterval = CitySampleTest::CVarFrameMetricsDumpInterval.GetValueOnGameThread();
+	if ((DumpInterval > 0.0f) && (Now - LastDumpTime >= DumpInterval))
+	{
+		LastDumpTime = Now;
+		DumpHistogram();
+	}
+}
+
+void FCitySampleFrameMetricsCollector::DumpHistogram()
+{
+	const int32 NumSamples = static_cast<int32>(FMath::Min<uint64>(FrameCount, WindowSize));
+	if (NumSamples <= 0)
+	{
+		return;
+	}
+
+	const FString FilePath = CitySampleTest::GetFrameMetricsDirectory() / FString::Printf(TEXT("FrameMetrics_%s.csv"), *SessionTimestamp);
+
+	if (!bWroteHistogramHeader)
+	{
+		FString Header = TEXT("Time,Frames");
+		for (const TCHAR* const Stat : { TEXT("FrameMS"), TEXT("GameMS"), TEXT("RenderMS"), TEXT("RHIMS") })
+		{
+			Header += FString::Printf(TEXT(",%s_Avg,%s_P50,%s_P90,%s_P95,%s_P99,%s_Max"), Stat, Stat, Stat, Stat, Stat, Stat);
+		}
+		Header += TEXT(",MassEntities_Avg,MassEntities_Max");
+		CitySampleTest::AppendCsvLine(FilePath, Header);
+		bWroteHistogramHeader = true;
+	}
+
+	FString Row = FString::Printf(TEXT("%.2f,%d"), FApp::GetCurrentTime() - GStartTime, NumSamples);
+
+	TArray<float> Values;
+	Values.Reserve(NumSamples);
+	for (int32 StatIndex = 0; StatIndex < 4; ++StatIndex)
+	{
+		Values.Reset();
+		float Sum = 0.0f;
+		float Max = 0.0f;
+		for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+		{
+			const FCitySampleFrameSample& Sample = Samples[SampleIndex];
+			const float Value = (StatIndex == 0) ? Sample.FrameMS
+							  : (StatIndex == 1) ? Sample.GameThreadMS
+							  : (StatIndex == 2) ? Sample.RenderThreadMS
+							  : Sample.RHIThreadMS;
+			Values.Add(Value);
+			Sum += Value;
+			Max = FMath::Max(Max, Value);
+		}
+
+		Row += FString::Printf(TEXT(",%.3f,%.3f,%.3f,%.3f,%.3f,%.3f"),
+			Sum / NumSamples,
+			CitySampleTest::GetPercentile(Values, 0.50f),
+			CitySampleTest::GetPercentile(Values, 0.90f),
+			CitySampleTest::GetPercentile(Values, 0.95f),
+			CitySampleTest::GetPercentile(Values, 0.99f),
+			Max);
+	}
+
+	uint64 EntitySum = 0;
+	int32 EntityMax = 0;
+	for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+	{
+		EntitySum += Samples[SampleIndex].MassEntityCount;
+		EntityMax = FMath::Max(EntityMax, Samples[SampleIndex].MassEntityCount);
+	}
+	Row += FString::Printf(TEXT(",%.1f,%d"), static_cast<double>(EntitySum) / NumSamples, EntityMax);
+
+	CitySampleTest::AppendCsvLine(FilePath, Row);
+}
+
+void FCitySampleFrameMetricsCollector::CaptureHitch(const float FrameMS)
+{
+	const FString FilePath = CitySampleTest::GetFrameMetricsDirectory() / FString::Printf(TEXT("Hitches_%s.csv"), *SessionTimestamp);
+
+	if (!bWroteHitchHeader)
+	{
+		CitySampleTest::AppendCsvLine(FilePath, TEXT("Capture,Time,FramesAgo,FrameMS,GameMS,RenderMS,RHIMS,MassEntities"));
+		bWroteHitchHeader = true;
+	}
+
+	++HitchCaptureCount;
+	const double Time = FApp::GetCurrentTime() - GStartTime;
+
+	// Walk the trailing frames oldest to newest; FrameCount already includes the hitching frame
+	const int32 NumFrames = static_cast<int32>(FMath::Min<uint64>(FrameCount, HitchBacktraceSize));
+	for (int32 FramesAgo = NumFrames - 1; FramesAgo >= 0; --FramesAgo)
+	{
+		const FCitySampleFrameSample& Sample = Samples[(FrameCount - 1 - FramesAgo) % WindowSize];
+		CitySampleTest::AppendCsvLine(FilePath, FString::Printf(TEXT("%d,%.2f,%d,%.3f,%.3f,%.3f,%.3f,%d"),
+			HitchCaptureCount, Time, FramesAgo, Sample.FrameMS, Sample.GameThreadMS, Sample.RenderThreadMS, Sample.RHIThreadMS, Sample.MassEntityCount));
+	}
+
+	UE_LOG(LogCitySampleTest, Warning, TEXT("%s: %.1fms hitch detected, snapshotted last %d frame breakdowns (capture %d)."), ANSI_TO_TCHAR(__func__), FrameMS, NumFrames, HitchCaptureCount);
+}
@@ -0,0 +1,90 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UWorld;
+
+/** Per-frame timing breakdown captured by the frame metrics collector. */
+struct FCitySampleFrameSample
+{
+	/** Total frame time in milliseconds. */
+	float FrameMS = 0.0f;
+
+	/** Game thread time in milliseconds. */
+	float GameThreadMS = 0.0f;
+
+	/** Render thread time in milliseconds. */
+	float RenderThreadMS = 0.0f;
+
+	/** RHI thread time in milliseconds. */
+	float RHIThreadMS = 0.0f;
+
+	/** Number of Mass entities alive this frame, when Mass debug info is compiled in. */
+	int32 MassEntityCount = 0;
+};
+
+/**
+ * Lightweight always-on frame metrics collector for automated test runs.
+ *
+ * Samples frame time, game/render/RHI thread breakdowns, and Mass entity counts into a fixed-size
+ * ring buffer every frame. The buffer has a single writer on the game thread and no readers on
+ * other threads, so no locking is needed. Periodically dumps percentile summaries of the window to
+ * a CSV under the profiling directory, and snapshots the most recent frame breakdowns to a hitch
+ * CSV whenever a frame exceeds the hitch threshold, giving soak runs per-frame forensics instead
+ * of run-wide averages.
+ */
+class FCitySampleFrameMetricsCollector
+{
+public:
+	~FCitySampleFrameMetricsCollector();
+
+	/** Begins sampling frames. Safe to call when already started. */
+	void Start();
+
+	/** Stops sampling and writes a final percentile dump for the current window. */
+	void Stop();
+
+	/** Sets the world used to sample Mass entity counts. */
+	void SetWorld(UWorld* const World)
+	{
+		WeakWorld = World;
+	}
+
+private:
+	/** Number of frames retained in the sampling window. */
+	static constexpr int32 WindowSize = 2048;
+
+	/** Number of trailing frames written out when a hitch is captured. */
+	static constexpr int32 HitchBacktraceSize = 64;
+
+	void OnEndFrame();
+
+	void DumpHistogram();
+	void CaptureHitch(const float FrameMS);
+
+	/** Ring buffer of recent frame samples, written on the game thread only. */
+	TStaticArray<FCitySampleFrameSample, WindowSize> Samples;
+
+	/** Total number of frames sampled; Samples[FrameCount % WindowSize] is the next write slot. */
+	uint64 FrameCount = 0;
+
+	/** World used to look up the Mass entity subsystem. */
+	TWeakObjectPtr<UWorld> WeakWorld;
+
+	/** Timestamp string identifying this collector session in output file names. */
+	FString SessionTimestamp;
+
+	double LastDumpTime = 0.0;
+	double LastHitchCaptureTime = 0.0;
+
+	/** Running count of hitch captures, used to group rows in the hitch CSV. */
+	int32 HitchCaptureCount = 0;
+
+	bool bStarted = false;
+	bool bWroteHistogramHeader = false;
+	bool bWroteHitchHeader = false;
+};
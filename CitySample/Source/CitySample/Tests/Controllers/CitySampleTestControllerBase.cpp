@@ -92,6 +92,9 @@ void UCitySampleTestControllerBase::OnInit()
 	MemReportIntervalSink = IConsoleManager::Get().RegisterConsoleVariableSink_Handle(MemReportIntervalDelegate);
 
 	FWorldDelegates::OnPreWorldInitialization.AddUObject(this, &ThisClass::OnPreWorldInitializeInternal);
+
+	FrameMetricsCollector = MakeUnique<FCitySampleFrameMetricsCollector>();
+	FrameMetricsCollector->Start();
 }
 
 void UCitySampleTestControllerBase::OnTick(float TimeDelta)
@@ -113,6 +116,11 @@ void UCitySampleTestControllerBase::OnStateChange(FName OldState, FName NewState
 
 	check(GetWorld());
 	CurrentGameState = GetWorld()->GetGameState<ACitySampleGameState>();
+
+	if (FrameMetricsCollector.IsValid())
+	{
+		FrameMetricsCollector->SetWorld(GetWorld());
+	}
 }
 
 void UCitySampleTestControllerBase::BeginDestroy()
@@ -131,6 +139,12 @@ void UCitySampleTestControllerBase::EndCitySampleTest(const int32 ExitCode/*=0*/
 
 void UCitySampleTestControllerBase::UnbindAllDelegates()
 {
+	if (FrameMetricsCollector.IsValid())
+	{
+		FrameMetricsCollector->Stop();
+		FrameMetricsCollector.Reset();
+	}
+
 	ClearMemReportTimer();
 	MemReportTimerDelegate.Unbind();
 	IConsoleManager::Get().UnregisterConsoleVariableSink_Handle(MemReportIntervalSink);
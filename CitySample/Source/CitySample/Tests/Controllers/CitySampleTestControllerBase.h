@@ -7,6 +7,7 @@
 
 #include "GauntletTestController.h"
 #include "Game/CitySampleGameState.h"
+#include "Tests/CitySampleFrameMetricsCollector.h"
 #include "CitySampleTestControllerBase.generated.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogCitySampleTest, Log, All)
@@ -63,6 +64,9 @@ public:
 private:
 	TWeakObjectPtr<ACitySampleGameState> CurrentGameState;
 
+	/** Always-on frame metrics collector providing percentile histograms and hitch captures for test runs. */
+	TUniquePtr<FCitySampleFrameMetricsCollector> FrameMetricsCollector;
+
 	float WarnStuckTime;
 	float NextWarnStuckTime;
 
@@ -68,6 +68,8 @@ public:
 		bPendingControlsUpdate = true;
 		// Skip one frame before updating to ensure input is rebuilt
 		bControlsUpdateSkipNextFrame = true;
+		// Make sure the panel itself gets an update pass, even if it does not update every frame
+		MarkPanelDirty();
 	}
 
 	/**
@@ -16,6 +16,14 @@
 #include "Game/CitySampleWorldInfo.h"
 
 
+static float MapUpdateQuantum = 0.25f;
+FAutoConsoleVariableRef CVar_MapUpdateQuantum(
+	TEXT("CitySample.MapUpdateQuantum"),
+	MapUpdateQuantum,
+	TEXT("Minimum change in player map position (render target units) or rotation (degrees) before the map widget pushes a player marker update to the UI. 0 pushes every update."),
+	ECVF_Default);
+
+
 UCitySampleMapWidget::UCitySampleMapWidget()
 {
 	MapImage = nullptr;
@@ -201,6 +209,8 @@ void UCitySampleMapWidget::UpdateMap(const bool bCaptureScene /*= false*/)
 	
 	OnHidePlayer(!TrackedPC || bHidePlayer);
 
+	UpdateTrackedPOIs();
+
 	if (MapImage)
 	{
 		MapImage->SetOpacity(MapTextureOpacity);
@@ -223,6 +233,16 @@ void UCitySampleMapWidget::SetPlayerMapPosition(const FVector2D& MapPosition)
 {
 	PlayerMapPosition = MapPosition;
 
+	// Skip the UI update when the marker has not moved at least a quantum on the map
+	if (bHasPushedPlayerMapPosition && (MapUpdateQuantum > 0.0f) && ((PlayerMapPosition - PushedPlayerMapPosition).GetAbsMax() < MapUpdateQuantum))
+	{
+		return;
+	}
+
+	PushedPlayerMapPosition = PlayerMapPosition;
+	bHasPushedPlayerMapPosition = true;
+	MarkPanelDirty();
+
 	// Let BP handle updates for the new player map position, adjusted for scaling and panning offset
 	OnSetPlayerMapPosition(PlayerMapPosition);
 }
@@ -230,7 +250,17 @@ void UCitySampleMapWidget::SetPlayerMapPosition(const FVector2D& MapPosition)
 void UCitySampleMapWidget::SetPlayerMapRotation(const float MapRotation)
 {
 	PlayerMapRotation = MapRotation;
-	
+
+	// Skip the UI update when the marker has not turned at least a quantum
+	if (bHasPushedPlayerMapRotation && (MapUpdateQuantum > 0.0f) && (FMath::Abs(FMath::FindDeltaAngleDegrees(PushedPlayerMapRotation, PlayerMapRotation)) < MapUpdateQuantum))
+	{
+		return;
+	}
+
+	PushedPlayerMapRotation = PlayerMapRotation;
+	bHasPushedPlayerMapRotation = true;
+	MarkPanelDirty();
+
 	// Let BP handle updates for the new player map position, adjusted for scaling and panning offset
 	OnSetPlayerMapRotation(PlayerMapRotation);
 }
@@ -238,10 +268,84 @@ void UCitySampleMapWidget::SetPlayerMapRotation(const float MapRotation)
 void UCitySampleMapWidget::SetPlayerMapPositionFromWorld(const FVector& WorldLocation)
 {
 	// Projects the player world location to render target (map) space
-	FSceneView::ProjectWorldToScreen(WorldLocation, MapRect, MapViewProjectionMatrix, PlayerMapPosition);
-	
-	// Let BP handle updates for the new player map position, adjusted for scaling and panning offset
-	OnSetPlayerMapPosition(PlayerMapPosition);
+	FVector2D ProjectedMapPosition;
+	FSceneView::ProjectWorldToScreen(WorldLocation, MapRect, MapViewProjectionMatrix, ProjectedMapPosition);
+
+	SetPlayerMapPosition(ProjectedMapPosition);
+}
+
+void UCitySampleMapWidget::AddTrackedPOI(AActor* const POI, const bool bStatic/*=true*/)
+{
+	if (POI)
+	{
+		FTrackedPOIState& POIState = TrackedPOIs.FindOrAdd(POI);
+		POIState.bStatic = bStatic;
+		// Re-project on the next update, even if the POI was already tracked as static
+		POIState.bPushed = false;
+	}
+}
+
+void UCitySampleMapWidget::RemoveTrackedPOI(AActor* const POI)
+{
+	if (TrackedPOIs.Remove(POI) > 0)
+	{
+		// Let BP handle removing the marker
+		OnRemoveTrackedPOI(POI);
+	}
+}
+
+void UCitySampleMapWidget::UpdateTrackedPOIs()
+{
+	if (TrackedPOIs.IsEmpty())
+	{
+		return;
+	}
+
+	// Batch up map positions for POIs that actually moved, so BP writes all marker transforms in one pass
+	TArray<FCitySampleMapPOIUpdate> POIUpdates;
+
+	for (auto It = TrackedPOIs.CreateIterator(); It; ++It)
+	{
+		AActor* const POI = It.Key().Get();
+		if (!POI)
+		{
+			// Drop markers for stale actors
+			It.RemoveCurrent();
+			continue;
+		}
+
+		FTrackedPOIState& POIState = It.Value();
+
+		// Static POIs keep their baked map position once pushed
+		if (POIState.bStatic && POIState.bPushed)
+		{
+			continue;
+		}
+
+		FVector2D ProjectedMapPosition;
+		FSceneView::ProjectWorldToScreen(POI->GetActorLocation(), MapRect, MapViewProjectionMatrix, ProjectedMapPosition);
+
+		// Skip POIs that have not moved at least a quantum on the map
+		if (POIState.bPushed && (MapUpdateQuantum > 0.0f) && ((ProjectedMapPosition - POIState.PushedMapPosition).GetAbsMax() < MapUpdateQuantum))
+		{
+			continue;
+		}
+
+		POIState.PushedMapPosition = ProjectedMapPosition;
+		POIState.bPushed = true;
+
+		FCitySampleMapPOIUpdate& POIUpdate = POIUpdates.AddDefaulted_GetRef();
+		POIUpdate.POI = POI;
+		POIUpdate.MapPosition = ProjectedMapPosition;
+	}
+
+	if (!POIUpdates.IsEmpty())
+	{
+		MarkPanelDirty();
+
+		// Let BP handle updates for the new POI map positions, adjusted for scaling and panning offset
+		OnSetPOIMapPositions(POIUpdates);
+	}
 }
 
 bool UCitySampleMapWidget::IsMapPositionWithinBounds(const FVector2D& MapPosition)
@@ -12,6 +12,21 @@ class USceneCaptureComponent2D;
 class UTexture2D;
 class UTextureRenderTarget2D;
 
+USTRUCT(BlueprintType)
+struct FCitySampleMapPOIUpdate
+{
+	GENERATED_BODY()
+
+public:
+	/** Point of interest actor whose map position has changed. */
+	UPROPERTY(BlueprintReadOnly, Category = "Map Widget")
+	AActor* POI = nullptr;
+
+	/** New position of the point of interest in render target (map) space. */
+	UPROPERTY(BlueprintReadOnly, Category = "Map Widget")
+	FVector2D MapPosition = FVector2D::ZeroVector;
+};
+
 /**
  * CitySample UI base class for a Map widget. Can be used with either a specific texture or a scene capture render target.
  */
@@ -87,6 +102,22 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Map Widget")
 	bool IsMapPositionWithinBounds(const FVector2D& MapPosition);
 
+	/**
+	 * Starts tracking a point of interest on the map.
+	 * @note	Static POIs are projected once and their map position stays baked; dynamic POIs are
+	 *			re-projected on update and pushed to the UI only when they move at least a map quantum.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Map Widget")
+	void AddTrackedPOI(AActor* const POI, const bool bStatic=true);
+
+	/** Stops tracking a point of interest on the map. */
+	UFUNCTION(BlueprintCallable, Category = "Map Widget")
+	void RemoveTrackedPOI(AActor* const POI);
+
+	/** Re-projects tracked POIs and pushes any that moved at least a map quantum to the UI in one batch. */
+	UFUNCTION(BlueprintCallable, Category = "Map Widget")
+	void UpdateTrackedPOIs();
+
 protected:
 	/** BP hook for handling UI updates to the map visibility. */
 	UFUNCTION(BlueprintImplementableEvent, Category = "Map Widget")
@@ -112,6 +143,14 @@ protected:
 	UFUNCTION(BlueprintImplementableEvent, Category = "Map Widget")
 	void OnSetPlayerMapRotation(const float ScreenRotation);
 
+	/** BP hook for handling a batch of tracked POI map position updates. */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Map Widget")
+	void OnSetPOIMapPositions(const TArray<FCitySampleMapPOIUpdate>& POIUpdates);
+
+	/** BP hook for handling when a POI is no longer tracked, i.e. removing its marker. */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Map Widget")
+	void OnRemoveTrackedPOI(AActor* const POI);
+
 	/** The UImage widget whose material is used when setting the scene render target as a texture parameter. */
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, meta=(BindWidget), Category = "Map Widget")
 	UImage* MapImage;
@@ -155,5 +194,23 @@ private:
 	UPROPERTY(Transient, VisibleAnywhere, Category = "Map Widget|Transient")
 	float PlayerMapRotation;
 
+	/** Last player map position/rotation pushed to the UI, used to skip updates smaller than the map update quantum. */
+	FVector2D PushedPlayerMapPosition;
+	float PushedPlayerMapRotation = 0.0f;
+	bool bHasPushedPlayerMapPosition = false;
+	bool bHasPushedPlayerMapRotation = false;
+
+	/** Per-POI tracking state for incremental marker updates. */
+	struct FTrackedPOIState
+	{
+		/** Static POIs are projected and pushed once, then their map position stays baked. */
+		bool bStatic = true;
+		bool bPushed = false;
+		FVector2D PushedMapPosition = FVector2D::ZeroVector;
+	};
+
+	/** Points of interest tracked on the map, keyed weakly so stale actors drop out on update. */
+	TMap<TWeakObjectPtr<AActor>, FTrackedPOIState> TrackedPOIs;
+
 	void InitializeMapViewProjectionMatrix(USceneCaptureComponent2D* const SceneCapture2D);
 };
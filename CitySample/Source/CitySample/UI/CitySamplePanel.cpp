@@ -79,14 +79,39 @@ void UCitySamplePanel::UpdatePanel(const float DeltaTime/*=0.0f*/, const UCitySa
 	const TArray<UCitySamplePanel*> ChildPanelsCopy = ChildPanels;
 	for (UCitySamplePanel* const Child : ChildPanelsCopy)
 	{
-		if (IsValid(Child) && Child->Parent == this)
+		// Skip subtrees with no pending updates, Slate keeps their last paint
+		if (IsValid(Child) && Child->Parent == this && Child->IsPanelUpdatePending())
 		{
 			Child->UpdatePanel(DeltaTime, OwningCitySampleUI);
 		}
 	}
 
-	// Let BP handle and updates
-	ReceiveUpdatePanel(DeltaTime, OwningCitySampleUI);
+	if (bAlwaysUpdatePanel || bPanelDirty)
+	{
+		bPanelDirty = false;
+
+		// Let BP handle and updates
+		ReceiveUpdatePanel(DeltaTime, OwningCitySampleUI);
+	}
+}
+
+bool UCitySamplePanel::IsPanelUpdatePending() const
+{
+	if (bAlwaysUpdatePanel || bPanelDirty)
+	{
+		return true;
+	}
+
+	// A clean panel still updates when any panel beneath it has an update pending
+	for (const UCitySamplePanel* const Child : ChildPanels)
+	{
+		if (IsValid(Child) && Child->IsPanelUpdatePending())
+		{
+			return true;
+		}
+	}
+
+	return false;
 }
 
 UCitySamplePanel* UCitySamplePanel::CreateChildPanel(TSubclassOf<UCitySamplePanel> PanelClass, FName Name, UPanelWidget* ContainerWidget /*= nullptr*/, const bool bSkipAnimation/*=false*/)
@@ -171,6 +196,10 @@ UCitySamplePanel* UCitySamplePanel::AddChildPanel(UCitySamplePanel* ChildPanel,
 	ChildPanel->Parent = this;
 	ChildPanels.Add(ChildPanel);
 
+	// New children need at least one update pass, as does the panel that gained them
+	ChildPanel->MarkPanelDirty();
+	MarkPanelDirty();
+
 	// Let BP handle any extra work after add
 	ChildPanel->NativeOnAddedToPanel();
 	NativeOnAddedChildPanel(ChildPanel);
@@ -232,11 +261,13 @@ void UCitySamplePanel::SetAllPanelsHidden(const bool bShouldBeHidden/*=true*/)
 		CachedVisibility = GetVisibility();
 		SetVisibility(ESlateVisibility::Hidden);
 		bIsHidingAllPanels = true;
+		MarkPanelDirty();
 	}
 	else if (!bShouldBeHidden && bIsHidingAllPanels)
 	{
 		SetVisibility(CachedVisibility);
 		bIsHidingAllPanels = false;
+		MarkPanelDirty();
 	}
 }
 
@@ -259,6 +290,7 @@ void UCitySamplePanel::SetControlsFlavor(const ECitySampleControlsFlavor NewCont
 void UCitySamplePanel::NativeControlsFlavorChanged(const ECitySampleControlsFlavor NewControlsFlavor)
 {
 	ControlsFlavor = NewControlsFlavor;
+	MarkPanelDirty();
 
 	// Let BP and delegates handle event
 	OnControlsFlavorChanged(NewControlsFlavor);
@@ -349,6 +381,9 @@ void UCitySamplePanel::RemoveChildPanelHelper(UCitySamplePanel* ChildPanel)
 	ChildPanels.Remove(ChildPanel);
 	ChildPanel->bIsASubWidget = false;
 
+	// The panel that lost a child needs an update pass
+	MarkPanelDirty();
+
 	// Let BP handle any extra work post animation
 	ChildPanel->OnFinishedAnimateOut();
 	OnChildFinishedAnimateOut(ChildPanel);
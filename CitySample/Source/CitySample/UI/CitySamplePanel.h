@@ -64,7 +64,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "CitySamplePanel")
 	virtual void UpdatePanel(const float DeltaTime=0.0f, const UCitySampleUIComponent* const OwningCitySampleUI=nullptr);
 
-	/** 
+	/** Flags the panel so the next UpdatePanel call runs its update hook, even when the panel does not update every frame. */
+	UFUNCTION(BlueprintCallable, Category = "CitySamplePanel")
+	void MarkPanelDirty()
+	{
+		bPanelDirty = true;
+	}
+
+	/** Whether this panel, or any panel beneath it, has an update pending. Clean subtrees are skipped by UpdatePanel. */
+	UFUNCTION(BlueprintPure, Category = "CitySamplePanel")
+	bool IsPanelUpdatePending() const;
+
+	/**
 	 * Creates a panel of the given class type, adds it as a child panel, and adds it to the viewport, or the specified container.
 	 *
 	 * @param	PanelClass		Class used to create the new CitySamplePanel.
@@ -291,6 +302,13 @@ protected:
 	void OnControlsFlavorChanged(const ECitySampleControlsFlavor NewControlsFlavor);
 	virtual void NativeControlsFlavorChanged(const ECitySampleControlsFlavor NewControlsFlavor);
 
+	/**
+	 * Whether UpdatePanel should run the panel's update hook every frame. When false, the hook
+	 * only runs after MarkPanelDirty, so panels that only change on events skip per-frame updates.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "CitySamplePanel")
+	bool bAlwaysUpdatePanel = true;
+
 private:
 	/** Removes child from parent without invalidating stored parameters for any pending add. Meant for use internally. */
 	void RemoveChildPanelChecked_Internal(UCitySamplePanel* ChildPanel, bool bSkipAnimation = false);
@@ -335,6 +353,10 @@ private:
 	UPROPERTY(VisibleAnywhere, Transient, Category = "CitySamplePanel")
 	bool bIsHidingAllPanels = false;
 
+	/** Whether the panel needs its update hook run on the next UpdatePanel. Starts dirty so new panels update at least once. */
+	UPROPERTY(VisibleAnywhere, Transient, Category = "CitySamplePanel")
+	bool bPanelDirty = true;
+
 	/** Cached slate visibility value while the CitySamplePanel is hidden. */
 	UPROPERTY(VisibleAnywhere, Transient, Category = "CitySamplePanel")
 	ESlateVisibility CachedVisibility;
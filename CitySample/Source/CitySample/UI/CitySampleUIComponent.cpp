@@ -110,7 +110,8 @@ void UCitySampleUIComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 
 void UCitySampleUIComponent::UpdateUI(const float DeltaTime/*=0.0f*/)
 {
-	if (BasePanel)
+	// Skip the panel walk entirely when no panel in the hierarchy has an update pending
+	if (BasePanel && BasePanel->IsPanelUpdatePending())
 	{
 		BasePanel->UpdatePanel(DeltaTime, this);
 	}
@@ -245,6 +246,12 @@ void UCitySampleUIComponent::AddInteractionPrompt(const UCitySampleInteractionCo
 		PromptWidget->AddToViewport();
 		bInteractPromptActive = true;
 		OnAddInteractionPrompt(PromptWidget, InteractionComp);
+
+		// The prompt widget lives outside the panel hierarchy, so panels mirroring prompt state need an update pass
+		if (BasePanel)
+		{
+			BasePanel->MarkPanelDirty();
+		}
 	}
 }
 
@@ -254,8 +261,13 @@ void UCitySampleUIComponent::RemoveInteractionPrompt()
 	{
 		PromptWidget->RemoveFromParent();
 	}
-	
+
 	bInteractPromptActive = false;
+
+	if (BasePanel)
+	{
+		BasePanel->MarkPanelDirty();
+	}
 }
 
 ECitySampleControlsFlavor UCitySampleUIComponent::SetControlsFlavor(const ECitySampleControlsFlavor NewControlsFlavor)
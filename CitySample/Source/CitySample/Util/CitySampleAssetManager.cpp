@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "CitySampleAssetManager.h"
+#include "CitySample.h"
 #include "HAL/IConsoleManager.h"
 #include "Misc/CommandLine.h"
 
@@ -32,7 +33,25 @@ const FName UCitySampleAssetManager::LoadStateClient = FName(TEXT("Client"));
 
 UCitySampleAssetManager::UCitySampleAssetManager()
 {
+	// Built-in profiles, config can override or extend these
 
+	// Full game client, preloads all variety assets at startup
+	FCitySamplePreloadProfile& FullGameProfile = PreloadProfiles.AddDefaulted_GetRef();
+	FullGameProfile.Name = FName(TEXT("FullGame"));
+
+	// Headless agent workload, never needs the variety bundles resident up front
+	FCitySamplePreloadProfile& AgentServerProfile = PreloadProfiles.AddDefaulted_GetRef();
+	AgentServerProfile.Name = FName(TEXT("AgentServer"));
+	AgentServerProfile.bPreloadCrowdCharacterData = false;
+	AgentServerProfile.bPreloadAnimToTextureData = false;
+	AgentServerProfile.bDeferVarietyPreload = true;
+
+	DefaultPreloadProfileName = FullGameProfile.Name;
+}
+
+UCitySampleAssetManager& UCitySampleAssetManager::Get()
+{
+	return *CastChecked<UCitySampleAssetManager>(&UAssetManager::Get());
 }
 
 void UCitySampleAssetManager::PostInitProperties()
@@ -45,9 +64,58 @@ void UCitySampleAssetManager::PostInitProperties()
 		PlatformBundleState.Add(LoadStateClient);
 
 		DefaultBundleState = PlatformBundleState;
+
+		// Resolve the preload profile, command line takes precedence over the config default
+		FName ProfileName = DefaultPreloadProfileName;
+		FString ProfileNameParam;
+		if (FParse::Value(FCommandLine::Get(), TEXT("CitySamplePreloadProfile="), ProfileNameParam))
+		{
+			ProfileName = FName(*ProfileNameParam);
+		}
+
+		ActivePreloadProfileIndex = PreloadProfiles.IndexOfByPredicate([ProfileName](const FCitySamplePreloadProfile& Profile)
+		{
+			return Profile.Name == ProfileName;
+		});
+
+		if ((ActivePreloadProfileIndex == INDEX_NONE) && !PreloadProfiles.IsEmpty())
+		{
+			UE_LOG(LogCitySample, Warning, TEXT("Unknown preload profile '%s', falling back to '%s'"), *ProfileName.ToString(), *PreloadProfiles[0].Name.ToString());
+			ActivePreloadProfileIndex = 0;
+		}
 	}
 }
 
+const FCitySamplePreloadProfile& UCitySampleAssetManager::GetActivePreloadProfile() const
+{
+	if (PreloadProfiles.IsValidIndex(ActivePreloadProfileIndex))
+	{
+		return PreloadProfiles[ActivePreloadProfileIndex];
+	}
+
+	// Preload everything when no profiles are configured at all
+	static const FCitySamplePreloadProfile DefaultProfile;
+	return DefaultProfile;
+}
+
+TSharedPtr<FStreamableHandle> UCitySampleAssetManager::EnsureVarietyAssetsLoaded()
+{
+	if (bVarietyAssetsRequested)
+	{
+		return nullptr;
+	}
+
+	bVarietyAssetsRequested = true;
+
+	if (GetActivePreloadProfile().bDeferVarietyPreload)
+	{
+		// First spawn request, run the preload that was deferred at startup
+		return PreloadItemDefinitions();
+	}
+
+	return nullptr;
+}
+
 TSharedPtr<FStreamableHandle> UCitySampleAssetManager::PreloadItemDefinitions()
 {
 #if WITH_EDITOR
@@ -84,10 +152,18 @@ TSharedPtr<FStreamableHandle> UCitySampleAssetManager::PreloadItemDefinitions()
 	}
 #endif
 
+	const FCitySamplePreloadProfile& PreloadProfile = GetActivePreloadProfile();
+
+	// Deferring profiles leave variety assets unloaded until the first spawn request asks for them
+	if (PreloadProfile.bDeferVarietyPreload && !bVarietyAssetsRequested)
+	{
+		return nullptr;
+	}
+
 	TArray<FPrimaryAssetId> AssetIdListWithBundle;
 	TArray<FPrimaryAssetId> AssetIdListWithoutBundle;
-	
-	if (CVarPreloadCrowdCharacterData->GetBool())
+
+	if (CVarPreloadCrowdCharacterData->GetBool() && PreloadProfile.bPreloadCrowdCharacterData)
 	{
 		GetPrimaryAssetIdList(FName(TEXT("CrowdCharacterDataAsset")), AssetIdListWithBundle, EAssetManagerFilter::UnloadedOnly);
 	}
@@ -96,7 +172,7 @@ TSharedPtr<FStreamableHandle> UCitySampleAssetManager::PreloadItemDefinitions()
 		GetPrimaryAssetIdList(FName(TEXT("CrowdCharacterDataAsset")), AssetIdListWithoutBundle, EAssetManagerFilter::UnloadedOnly);
 	}
 
-	if (CVarPreloadAnimToTextureData->GetBool())
+	if (CVarPreloadAnimToTextureData->GetBool() && PreloadProfile.bPreloadAnimToTextureData)
 	{
 		GetPrimaryAssetIdList(FName(TEXT("AnimToTextureDataAsset")), AssetIdListWithBundle, EAssetManagerFilter::UnloadedOnly);
 	}
@@ -104,11 +180,11 @@ TSharedPtr<FStreamableHandle> UCitySampleAssetManager::PreloadItemDefinitions()
 	{
 		GetPrimaryAssetIdList(FName(TEXT("AnimToTextureDataAsset")), AssetIdListWithoutBundle, EAssetManagerFilter::UnloadedOnly);
 	}
-	
+
 	// Loading with no bundle is significantly smaller
 	LoadPrimaryAssets(AssetIdListWithoutBundle);
 
-	return LoadPrimaryAssets(AssetIdListWithBundle, DefaultBundleState);
+	return LoadPrimaryAssets(AssetIdListWithBundle, !PreloadProfile.BundleState.IsEmpty() ? PreloadProfile.BundleState : DefaultBundleState);
 }
 
 void UCitySampleAssetManager::UnloadItemDefinitions()
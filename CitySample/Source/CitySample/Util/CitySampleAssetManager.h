@@ -7,6 +7,37 @@
 #include "CitySampleAssetManager.generated.h"
 
 
+/**
+ * Named preload profile defining which variety asset bundles are loaded at startup.
+ * Profiles are defined in config and selected with -CitySamplePreloadProfile=<Name> on the command line.
+ */
+USTRUCT()
+struct FCitySamplePreloadProfile
+{
+	GENERATED_BODY()
+
+public:
+	/** Name used to select the profile via config or command line. */
+	UPROPERTY(config)
+	FName Name;
+
+	/** Whether to preload crowd character data assets with their bundles. When false, they load without bundles, which is significantly smaller. */
+	UPROPERTY(config)
+	bool bPreloadCrowdCharacterData = true;
+
+	/** Whether to preload anim to texture data assets with their bundles. When false, they load without bundles. */
+	UPROPERTY(config)
+	bool bPreloadAnimToTextureData = true;
+
+	/** Whether to defer all variety asset preloading until the first spawn request asks for it. */
+	UPROPERTY(config)
+	bool bDeferVarietyPreload = false;
+
+	/** Bundle state to load primary assets with. Empty uses the platform default bundle state. */
+	UPROPERTY(config)
+	TArray<FName> BundleState;
+};
+
 /**
  * See docs https://docs.unrealengine.com/4.26/en-US/ProductionPipelines/AssetManagement/
  *
@@ -25,9 +56,9 @@ private:
 	static const FName LoadStateClient;
 
 	//~ Begin UObject Interface
-	virtual void PostInitProperties() override; 
+	virtual void PostInitProperties() override;
 	//~ End UObject Interface
-	
+
 	//~ Begin UAssetManager Interface
 	virtual void PostInitialAssetScan() override;
 	virtual bool ShouldScanPrimaryAssetType(FPrimaryAssetTypeInfo& TypeInfo) const override;
@@ -42,7 +73,7 @@ private:
 	bool bInPreBeginPIE = false;
 	bool bAlreadyLoadedForPIE = false;
 #endif
-	
+
 	/** Bundle states for current platform */
 	UPROPERTY()
 	TArray<FName> PlatformBundleState;
@@ -51,8 +82,34 @@ private:
 	UPROPERTY()
 	TArray<FName> DefaultBundleState;
 
+	/** Preload profiles available for selection. Built-in FullGame/AgentServer profiles can be overridden or extended in config. */
+	UPROPERTY(config)
+	TArray<FCitySamplePreloadProfile> PreloadProfiles;
+
+	/** Profile used when none is given on the command line. */
+	UPROPERTY(config)
+	FName DefaultPreloadProfileName;
+
+	/** Index into PreloadProfiles resolved from the command line/config at startup. */
+	int32 ActivePreloadProfileIndex = INDEX_NONE;
+
+	/** Whether a spawn request has asked for variety assets, ending any deferral. */
+	bool bVarietyAssetsRequested = false;
+
 public:
 
+	/** Returns the CitySample asset manager singleton. */
+	static UCitySampleAssetManager& Get();
+
 	TSharedPtr<FStreamableHandle> PreloadItemDefinitions();
 	void UnloadItemDefinitions();
-};
\ No newline at end of file
+
+	/** Returns the preload profile selected at startup. */
+	const FCitySamplePreloadProfile& GetActivePreloadProfile() const;
+
+	/**
+	 * Called on the first spawn request that needs crowd/vehicle variety assets. When the active
+	 * profile defers variety preloading, this kicks off the deferred preload; otherwise it does nothing.
+	 */
+	TSharedPtr<FStreamableHandle> EnsureVarietyAssetsLoaded();
+};
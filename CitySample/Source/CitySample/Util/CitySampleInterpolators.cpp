@@ -3,6 +3,87 @@
 
 #include "CitySampleInterpolators.h"
 
+#include "Math/VectorRegister.h"
+
+void FIIRInterpolatorBatch::Eval(float DeltaTime)
+{
+	if (DeltaTime < KINDA_SMALL_NUMBER)
+	{
+		return;
+	}
+
+	EvalStage(Stages[0], DeltaTime);
+
+	// resolve stage 1 goals from the stage 0 results they chain from
+	FStageChannels& Stage1 = Stages[1];
+	for (int32 ChannelIdx = 0; ChannelIdx < Stage1.GoalLinks.Num(); ChannelIdx++)
+	{
+		const int32 LinkedChannel = Stage1.GoalLinks[ChannelIdx];
+		if (Stages[0].CurrentValues.IsValidIndex(LinkedChannel))
+		{
+			Stage1.GoalValues[ChannelIdx] = Stages[0].CurrentValues[LinkedChannel];
+		}
+	}
+
+	EvalStage(Stage1, DeltaTime);
+}
+
+void FIIRInterpolatorBatch::EvalStage(FStageChannels& Stage, float DeltaTime)
+{
+	const int32 NumChannels = Stage.CurrentValues.Num();
+	if (NumChannels == 0)
+	{
+		return;
+	}
+
+	// pad out to a full register so the vectorized loop can step every channel
+	const int32 NumPaddedChannels = Align(NumChannels, 4);
+	Stage.CurrentValues.SetNumZeroed(NumPaddedChannels, EAllowShrinking::No);
+	Stage.GoalValues.SetNumZeroed(NumPaddedChannels, EAllowShrinking::No);
+	Stage.LastGoalValues.SetNumZeroed(NumPaddedChannels, EAllowShrinking::No);
+	Stage.InterpSpeeds.SetNumZeroed(NumPaddedChannels, EAllowShrinking::No);
+
+	// move each channel's goal linearly from last update's goal while we substep,
+	// same as the individual EvalSubstepped path
+	Stage.GoalStepRates.SetNumUninitialized(NumPaddedChannels, EAllowShrinking::No);
+	Stage.LerpedGoals.SetNumUninitialized(NumPaddedChannels, EAllowShrinking::No);
+	const float InvDeltaTime = 1.f / DeltaTime;
+	for (int32 ChannelIdx = 0; ChannelIdx < NumPaddedChannels; ChannelIdx++)
+	{
+		Stage.GoalStepRates[ChannelIdx] = (Stage.GoalValues[ChannelIdx] - Stage.LastGoalValues[ChannelIdx]) * InvDeltaTime;
+		Stage.LerpedGoals[ChannelIdx] = Stage.LastGoalValues[ChannelIdx];
+	}
+
+	float RemainingTime = DeltaTime;
+	while (RemainingTime > KINDA_SMALL_NUMBER)
+	{
+		const float StepTime = FMath::Min(MaxSubstepTime, RemainingTime);
+		RemainingTime -= StepTime;
+
+		const VectorRegister4Float StepTimeReg = VectorSetFloat1(StepTime);
+		for (int32 ChannelIdx = 0; ChannelIdx < NumPaddedChannels; ChannelIdx += 4)
+		{
+			const VectorRegister4Float LerpedGoal = VectorMultiplyAdd(VectorLoad(&Stage.GoalStepRates[ChannelIdx]), StepTimeReg, VectorLoad(&Stage.LerpedGoals[ChannelIdx]));
+			VectorStore(LerpedGoal, &Stage.LerpedGoals[ChannelIdx]);
+
+			// Current + (Goal - Current) * Clamp(Speed * StepTime, 0, 1), with non-positive
+			// speeds snapping to the goal the way FMath::FInterpTo does
+			const VectorRegister4Float Speed = VectorLoad(&Stage.InterpSpeeds[ChannelIdx]);
+			VectorRegister4Float Alpha = VectorMin(VectorMultiply(Speed, StepTimeReg), GlobalVectorConstants::FloatOne);
+			Alpha = VectorSelect(VectorCompareGT(Speed, GlobalVectorConstants::FloatZero), Alpha, GlobalVectorConstants::FloatOne);
+
+			const VectorRegister4Float Current = VectorLoad(&Stage.CurrentValues[ChannelIdx]);
+			VectorStore(VectorMultiplyAdd(VectorSubtract(LerpedGoal, Current), Alpha, Current), &Stage.CurrentValues[ChannelIdx]);
+		}
+	}
+
+	// drop the padding so channel indices stay stable for reads and later adds
+	Stage.CurrentValues.SetNum(NumChannels, EAllowShrinking::No);
+	Stage.GoalValues.SetNum(NumChannels, EAllowShrinking::No);
+	Stage.LastGoalValues.SetNum(NumChannels, EAllowShrinking::No);
+	Stage.InterpSpeeds.SetNum(NumChannels, EAllowShrinking::No);
+}
+
 bool FCitySampleInterpolatorTests::RunSubstepTest_CDSpringVector()
 {
 	static FVector Goal(10.f, 0.f, 0.f);			// initial goal
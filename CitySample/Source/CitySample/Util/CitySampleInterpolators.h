@@ -125,9 +125,30 @@ public:
 	};
 
 	/** Interpolator value will snap to the goal value on the next Eval() */
-	void Reset() 
-	{ 
-		bPendingReset = true; 
+	void Reset()
+	{
+		bPendingReset = true;
+	}
+
+	/** Returns true if the next Eval() will snap to the goal */
+	bool IsResetPending() const
+	{
+		return bPendingReset;
+	}
+
+	/** Returns the goal value from the last update, used for goal lerping when substepping */
+	T GetLastGoalValue() const
+	{
+		return LastGoalValue;
+	}
+
+	/** Commits results stepped externally by FIIRInterpolatorBatch */
+	void SetBatchedResult(T NewCurrentValue, T NewGoalValue)
+	{
+		CurrentValue = NewCurrentValue;
+		LastGoalValue = NewGoalValue;
+		LastUpdateLeftoverTime = 0.f;		// batch stepping does no partial-interval rewind
+		bPendingReset = false;
 	}
 
 protected:
@@ -284,6 +305,17 @@ public:
 		return PrimaryInterpolator.GetCurrentValue();
 	};
 
+	/** Direct access to the underlying filters, for FIIRInterpolatorBatch gathering */
+	TGenericIIRInterpolator<T>& GetIntermediateInterpolator()
+	{
+		return IntermediateInterpolator;
+	}
+
+	TGenericIIRInterpolator<T>& GetPrimaryInterpolator()
+	{
+		return PrimaryInterpolator;
+	}
+
 protected:
 
 	T SingleStepEval(T StepGoalValue, float StepTime)
@@ -308,7 +340,116 @@ protected:
 	TGenericIIRInterpolator<T> PrimaryInterpolator;
 };
 
-/** 
+/**
+ * Steps many scalar IIR channels in one substepped SoA pass, four channels per SIMD register.
+ * Callers gather channels from their interpolators each update (see AddToBatch on the wrapper
+ * structs below), run a single Eval, then read the results back. Stage 1 channels interpolate
+ * toward the post-eval value of a linked stage 0 channel, which is how the double IIR
+ * interpolators chain their intermediate and primary filters.
+ *
+ * Note the batch substeps like the individual interpolators do, but without their
+ * partial-interval rewinding.
+ */
+struct FIIRInterpolatorBatch
+{
+public:
+	static constexpr int32 NumStages = 2;
+
+	/** Identifies one interpolator's channels within the batch, for reading results back */
+	struct FChannelHandle
+	{
+		int32 StageFirstChannel[NumStages] = { INDEX_NONE, INDEX_NONE };
+	};
+
+	/** Clears all gathered channels, keeping allocations for reuse on the next update */
+	void Reset()
+	{
+		for (FStageChannels& Stage : Stages)
+		{
+			Stage.CurrentValues.Reset();
+			Stage.GoalValues.Reset();
+			Stage.LastGoalValues.Reset();
+			Stage.InterpSpeeds.Reset();
+			Stage.GoalLinks.Reset();
+		}
+	}
+
+	/**
+	 * Adds one scalar channel. Stage 1 channels take their goal from the linked stage 0
+	 * channel's post-eval value. Returns the channel index within the stage.
+	 */
+	int32 AddChannel(int32 StageIdx, float Current, float Goal, float LastGoal, float InterpSpeed, int32 GoalLinkChannel = INDEX_NONE)
+	{
+		FStageChannels& Stage = Stages[StageIdx];
+		const int32 ChannelIdx = Stage.CurrentValues.Num();
+		Stage.CurrentValues.Add(Current);
+		Stage.GoalValues.Add(Goal);
+		Stage.LastGoalValues.Add(LastGoal);
+		Stage.InterpSpeeds.Add(InterpSpeed);
+		Stage.GoalLinks.Add(GoalLinkChannel);
+		return ChannelIdx;
+	}
+
+	/** Adds a vector interpolator's three channels. Returns the first channel index within the stage. */
+	int32 AddVectorChannels(int32 StageIdx, const FVector& Current, const FVector& Goal, const FVector& LastGoal, float InterpSpeed, int32 GoalLinkChannel = INDEX_NONE)
+	{
+		const bool bLinked = (GoalLinkChannel != INDEX_NONE);
+		const int32 FirstChannel = AddChannel(StageIdx, (float)Current.X, (float)Goal.X, (float)LastGoal.X, InterpSpeed, GoalLinkChannel);
+		AddChannel(StageIdx, (float)Current.Y, (float)Goal.Y, (float)LastGoal.Y, InterpSpeed, bLinked ? GoalLinkChannel + 1 : INDEX_NONE);
+		AddChannel(StageIdx, (float)Current.Z, (float)Goal.Z, (float)LastGoal.Z, InterpSpeed, bLinked ? GoalLinkChannel + 2 : INDEX_NONE);
+		return FirstChannel;
+	}
+
+	/** Steps every gathered channel by DeltaTime, one SIMD pass per stage */
+	void Eval(float DeltaTime);
+
+	float GetChannelValue(int32 StageIdx, int32 ChannelIdx) const
+	{
+		return Stages[StageIdx].CurrentValues[ChannelIdx];
+	}
+
+	float GetChannelGoal(int32 StageIdx, int32 ChannelIdx) const
+	{
+		return Stages[StageIdx].GoalValues[ChannelIdx];
+	}
+
+	FVector GetVectorValue(int32 StageIdx, int32 FirstChannel) const
+	{
+		const FStageChannels& Stage = Stages[StageIdx];
+		return FVector(Stage.CurrentValues[FirstChannel], Stage.CurrentValues[FirstChannel + 1], Stage.CurrentValues[FirstChannel + 2]);
+	}
+
+	FVector GetVectorGoal(int32 StageIdx, int32 FirstChannel) const
+	{
+		const FStageChannels& Stage = Stages[StageIdx];
+		return FVector(Stage.GoalValues[FirstChannel], Stage.GoalValues[FirstChannel + 1], Stage.GoalValues[FirstChannel + 2]);
+	}
+
+private:
+	/** SoA state for one stage's channels */
+	struct FStageChannels
+	{
+		TArray<float> CurrentValues;
+		TArray<float> GoalValues;
+		TArray<float> LastGoalValues;
+		TArray<float> InterpSpeeds;
+		TArray<int32> GoalLinks;
+
+		// scratch for goal lerping, reused across evals
+		TArray<float> GoalStepRates;
+		TArray<float> LerpedGoals;
+	};
+
+	void EvalStage(FStageChannels& Stage, float DeltaTime);
+
+	/** Maximum timeslice per substep. */
+	static constexpr float MaxSubstepTime = 1.f / 120.f;
+
+	FStageChannels Stages[NumStages];
+};
+
+
+/**
  * Blueprint-accessible wrappers for the templated interpolators, for use as FProperties
  */
 USTRUCT(BlueprintType)
@@ -337,6 +478,30 @@ public:
 		return Interpolator.Eval(GoalLocation, DeltaTime);
 	}
 
+	/** Gathers this interpolator's channels into the batch; call ReadFromBatch after the batch eval to commit the result */
+	FIIRInterpolatorBatch::FChannelHandle AddToBatch(FIIRInterpolatorBatch& Batch, FVector GoalLocation)
+	{
+		// set every time so we can tweak values while game is live
+		Interpolator.SetInterpSpeed(InterpSpeed);
+
+		if (Interpolator.IsResetPending())
+		{
+			Interpolator.SetBatchedResult(GoalLocation, GoalLocation);
+		}
+
+		FIIRInterpolatorBatch::FChannelHandle Handle;
+		Handle.StageFirstChannel[0] = Batch.AddVectorChannels(0, Interpolator.GetCurrentValue(), GoalLocation, Interpolator.GetLastGoalValue(), InterpSpeed);
+		return Handle;
+	}
+
+	/** Commits the batch-stepped result back into this interpolator and returns it */
+	FVector ReadFromBatch(const FIIRInterpolatorBatch& Batch, const FIIRInterpolatorBatch::FChannelHandle& Handle)
+	{
+		const FVector NewValue = Batch.GetVectorValue(0, Handle.StageFirstChannel[0]);
+		Interpolator.SetBatchedResult(NewValue, Batch.GetVectorGoal(0, Handle.StageFirstChannel[0]));
+		return NewValue;
+	}
+
 	void Reset() { Interpolator.Reset(); }
 	void SetInitialValue(FVector InitialValue) { Interpolator.SetInitialValue(InitialValue); }
 	FVector GetCurrentValue() const { return Interpolator.GetCurrentValue(); }
@@ -377,6 +542,44 @@ public:
 		return Interpolator.Eval(GoalLocation, DeltaTime);
 	}
 
+	/** Gathers this interpolator's channels into the batch; call ReadFromBatch after the batch eval to commit the results */
+	FIIRInterpolatorBatch::FChannelHandle AddToBatch(FIIRInterpolatorBatch& Batch, FVector GoalLocation)
+	{
+		// set every time so we can tweak values while game is live
+		Interpolator.SetInterpSpeeds(PrimaryInterpSpeed, IntermediateInterpSpeed);
+
+		TGenericIIRInterpolator<FVector>& Intermediate = Interpolator.GetIntermediateInterpolator();
+		TGenericIIRInterpolator<FVector>& Primary = Interpolator.GetPrimaryInterpolator();
+
+		// the underlying interpolators would handle resets on eval, so resolve them while gathering
+		if (Intermediate.IsResetPending())
+		{
+			Intermediate.SetBatchedResult(GoalLocation, GoalLocation);
+		}
+		if (Primary.IsResetPending())
+		{
+			Primary.SetBatchedResult(GoalLocation, GoalLocation);
+		}
+
+		FIIRInterpolatorBatch::FChannelHandle Handle;
+		Handle.StageFirstChannel[0] = Batch.AddVectorChannels(0, Intermediate.GetCurrentValue(), GoalLocation, Intermediate.GetLastGoalValue(), IntermediateInterpSpeed);
+
+		// the primary filter chases the intermediate result, resolved by the batch after stage 0
+		Handle.StageFirstChannel[1] = Batch.AddVectorChannels(1, Primary.GetCurrentValue(), Primary.GetCurrentValue(), Primary.GetLastGoalValue(), PrimaryInterpSpeed, Handle.StageFirstChannel[0]);
+		return Handle;
+	}
+
+	/** Commits the batch-stepped results back into this interpolator and returns the primary value */
+	FVector ReadFromBatch(const FIIRInterpolatorBatch& Batch, const FIIRInterpolatorBatch::FChannelHandle& Handle)
+	{
+		const FVector IntermediateValue = Batch.GetVectorValue(0, Handle.StageFirstChannel[0]);
+		const FVector PrimaryValue = Batch.GetVectorValue(1, Handle.StageFirstChannel[1]);
+
+		Interpolator.GetIntermediateInterpolator().SetBatchedResult(IntermediateValue, Batch.GetVectorGoal(0, Handle.StageFirstChannel[0]));
+		Interpolator.GetPrimaryInterpolator().SetBatchedResult(PrimaryValue, IntermediateValue);
+		return PrimaryValue;
+	}
+
 	void Reset() { Interpolator.Reset(); }
 	void SetInitialValue(FVector InitialValue) { Interpolator.SetInitialValue(InitialValue); }
 	FVector GetCurrentValue() const { return Interpolator.GetCurrentValue(); }
@@ -2,9 +2,40 @@
 
 #include "LoadingUtilLibrary.h"
 #include "Engine/CoreSettings.h"
+#include "Engine/LevelStreaming.h"
 #include "GameFramework/WorldSettings.h"
 #include "MassSimulationSettings.h"
 #include "Engine/Engine.h"
+#include "ShaderCompiler.h"
+
+FTSTicker::FDelegateHandle ULoadingUtilLibrary::AsyncFlushTickerHandle;
+
+namespace
+{
+	/** Streaming levels that have not yet reached their target load/visibility state. */
+	int32 CountPendingStreamingLevels(const UWorld* const World)
+	{
+		int32 NumPending = 0;
+
+		for (const ULevelStreaming* const StreamingLevel : World->GetStreamingLevels())
+		{
+			if (StreamingLevel && StreamingLevel->ShouldBeLoaded())
+			{
+				if (!StreamingLevel->IsLevelLoaded() || (StreamingLevel->ShouldBeVisible() && !StreamingLevel->IsLevelVisible()))
+				{
+					NumPending++;
+				}
+			}
+		}
+
+		return NumPending;
+	}
+
+	int32 CountRemainingShaderJobs()
+	{
+		return GShaderCompilingManager ? GShaderCompilingManager->GetNumRemainingJobs() : 0;
+	}
+}
 
 bool ULoadingUtilLibrary::HasCapturedDefaults = false;
 float ULoadingUtilLibrary::DefaultLevelStreamingComponentsRegistrationGranularity;
@@ -83,6 +114,106 @@ void ULoadingUtilLibrary::FlushLevelStreaming(const UObject* WorldContextObject)
 	GEngine->BlockTillLevelStreamingCompleted(World);
 }
 
+void ULoadingUtilLibrary::FlushLevelStreamingAsync(const UObject* WorldContextObject, const FCitySampleAsyncFlushProgress& OnProgress, const FCitySampleAsyncFlushComplete& OnComplete)
+{
+	if (!ensure(WorldContextObject != nullptr))
+	{
+		return;
+	}
+
+	UWorld* World = WorldContextObject->GetWorld();
+
+	if (!ensure(World != nullptr))
+	{
+		return;
+	}
+
+	// Only one async flush at a time; a new request supersedes any flush in flight
+	CancelAsyncFlush(WorldContextObject);
+
+	// Raise priorities so streaming, async loads, and shader compiles all drain as fast as the frame
+	// budget allows, without the serialized blocking waits of FlushLevelStreaming
+	ApplyStreamingPriorityLoading(WorldContextObject);
+
+	// Capture the starting workload per system, so progress can be reported as a fraction of it
+	const int32 InitialPendingLevels = CountPendingStreamingLevels(World);
+	const int32 InitialAsyncPackages = GetNumAsyncPackages();
+	const int32 InitialShaderJobs = CountRemainingShaderJobs();
+
+	TWeakObjectPtr<UWorld> WeakWorld = World;
+	float LastProgress = 0.0f;
+
+	AsyncFlushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+		[WeakWorld, OnProgress, OnComplete, InitialPendingLevels, InitialAsyncPackages, InitialShaderJobs, LastProgress](float DeltaTime) mutable
+		{
+			UWorld* const World = WeakWorld.Get();
+			if (!World)
+			{
+				// World went away mid-flush, nothing left to wait on or restore against
+				AsyncFlushTickerHandle.Reset();
+				return false;
+			}
+
+			const int32 PendingLevels = CountPendingStreamingLevels(World);
+			const int32 AsyncPackages = GetNumAsyncPackages();
+			const int32 ShaderJobs = CountRemainingShaderJobs();
+
+			if ((PendingLevels == 0) && (AsyncPackages == 0) && !IsAsyncLoading() && (ShaderJobs == 0))
+			{
+				ApplyDefaultPriorityLoading(World);
+				AsyncFlushTickerHandle.Reset();
+
+				OnProgress.ExecuteIfBound(1.0f);
+				OnComplete.ExecuteIfBound();
+				return false;
+			}
+
+			// Fraction of the captured workload completed, averaged over the systems that had work.
+			// New work that appears mid-flush (e.g. levels requested by a freshly loaded level) can push
+			// fractions negative, so progress is clamped and kept monotonic.
+			float ProgressSum = 0.0f;
+			int32 NumProgressSources = 0;
+
+			if (InitialPendingLevels > 0)
+			{
+				ProgressSum += 1.0f - ((float)PendingLevels / (float)InitialPendingLevels);
+				NumProgressSources++;
+			}
+
+			if (InitialAsyncPackages > 0)
+			{
+				ProgressSum += 1.0f - ((float)AsyncPackages / (float)InitialAsyncPackages);
+				NumProgressSources++;
+			}
+
+			if (InitialShaderJobs > 0)
+			{
+				ProgressSum += 1.0f - ((float)ShaderJobs / (float)InitialShaderJobs);
+				NumProgressSources++;
+			}
+
+			const float Progress = (NumProgressSources > 0) ? FMath::Clamp(ProgressSum / NumProgressSources, 0.0f, 1.0f) : 0.0f;
+			LastProgress = FMath::Max(LastProgress, Progress);
+
+			OnProgress.ExecuteIfBound(LastProgress);
+			return true;
+		}));
+}
+
+void ULoadingUtilLibrary::CancelAsyncFlush(const UObject* WorldContextObject)
+{
+	if (AsyncFlushTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(AsyncFlushTickerHandle);
+		AsyncFlushTickerHandle.Reset();
+
+		if (WorldContextObject != nullptr)
+		{
+			ApplyDefaultPriorityLoading(WorldContextObject);
+		}
+	}
+}
+
 void ULoadingUtilLibrary::ForceGarbageCollection()
 {
 #if WITH_EDITOR
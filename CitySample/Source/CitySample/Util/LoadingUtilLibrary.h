@@ -2,12 +2,19 @@
 
 #pragma once
 
+#include "Containers/Ticker.h"
 #include "CoreMinimal.h"
 #include "UObject/ObjectMacros.h"
 #include "UObject/Object.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "LoadingUtilLibrary.generated.h"
 
+/** Progress callback for async flushes. Progress is 0-1 across streaming levels, async asset loads, and shader compiles. */
+DECLARE_DYNAMIC_DELEGATE_OneParam(FCitySampleAsyncFlushProgress, const float, Progress);
+
+/** Fired once an async flush has fully drained and default loading priorities have been restored. */
+DECLARE_DYNAMIC_DELEGATE(FCitySampleAsyncFlushComplete);
+
 UCLASS()
 class ULoadingUtilLibrary : public UBlueprintFunctionLibrary
 {
@@ -32,6 +39,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Loading", meta = (WorldContext = "WorldContextObject"))
 	static void FlushLevelStreaming(const UObject* WorldContextObject);
 
+	/**
+	 * Non-blocking alternative to FlushLevelStreaming for scripted teleports. Raises loading priority and
+	 * lets streaming level flushes, async asset loads, and shader compiles drain in parallel while the game
+	 * thread keeps ticking, reporting progress each frame. Restores default priority loading on completion.
+	 * Starting a new async flush cancels any flush already in flight.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Loading", meta = (WorldContext = "WorldContextObject", AutoCreateRefTerm = "OnProgress, OnComplete"))
+	static void FlushLevelStreamingAsync(const UObject* WorldContextObject, const FCitySampleAsyncFlushProgress& OnProgress, const FCitySampleAsyncFlushComplete& OnComplete);
+
+	/** Cancels an in-flight async flush, restoring default priority loading. Safe to call when none is active. */
+	UFUNCTION(BlueprintCallable, Category = "Loading", meta = (WorldContext = "WorldContextObject"))
+	static void CancelAsyncFlush(const UObject* WorldContextObject);
+
 private:
 	static void CaptureDefaultLoadingSettings();
 	static bool HasCapturedDefaults;
@@ -40,5 +60,7 @@ private:
 	static float DefaultAsyncLoadingTimeLimit;
 	static double DefaultMassActorDestructionTimeLimit;
 	static double DefaultMassActorSpawnTimeLimit;
-	
+
+	/** Ticker polling an in-flight async flush, invalid when none is active. */
+	static FTSTicker::FDelegateHandle AsyncFlushTickerHandle;
 };
@@ -45,6 +45,11 @@ FAutoConsoleVariableRef CVarDrawCenterOfMassDebug(TEXT("p.Vehicle.DrawCenterOfMa
 bool bDrawRumbleInfoDebug = false;
 FAutoConsoleVariableRef CVarDrawRumbleDebugInfo(TEXT("p.Vehicle.DrawRumbleDebugInfo"), bDrawRumbleInfoDebug, TEXT("Enable/Disable vehicle rumble debug info"));
 
+float VehicleTickDormancyDelay = 2.0f;
+FAutoConsoleVariableRef CVarVehicleTickDormancyDelay(TEXT("p.Vehicle.TickDormancyDelay"), VehicleTickDormancyDelay, TEXT("Seconds a vehicle must be stationary, unpossessed, and unrendered before its tick goes dormant. 0 disables tick dormancy."));
+float VehicleDormantTickInterval = 0.5f;
+FAutoConsoleVariableRef CVarVehicleDormantTickInterval(TEXT("p.Vehicle.DormantTickInterval"), VehicleDormantTickInterval, TEXT("Tick interval in seconds used while a vehicle's tick is dormant."));
+
 ACitySampleVehicleBase::ACitySampleVehicleBase()
 {
 	bHideDrivingUI = false;
@@ -97,6 +102,13 @@ void ACitySampleVehicleBase::Tick(float DeltaTime)
 
 	MeasuredVelocity = (GetActorLocation() - LocationLastTick) / DeltaTime;
 
+	// Dormant vehicles only run the wake check until an event or the physics body waking re-arms them
+	if (UpdateTickDormancy(DeltaTime))
+	{
+		return;
+	}
+
+	// Movement stage, keeps the driving state and physics feel adjustments in sync with the simulation
 	UpdateDrivingState();
 
 	UpdateAngularDamping();
@@ -109,6 +121,7 @@ void ACitySampleVehicleBase::Tick(float DeltaTime)
 
 	UpdateVehicleDriftingState();
 
+	// Occupancy stage, player feedback only runs on the possessed vehicle
 	if (bIsPossessedByPlayer)
 	{
 		UpdateBurnout(DeltaTime);
@@ -116,6 +129,7 @@ void ACitySampleVehicleBase::Tick(float DeltaTime)
 		UpdateWheelSuspensionStates(DeltaTime);
 	}
 
+	// Visibility stage
 	if (bLODBlendEnabled)
 	{
 		UpdateLODBlend(DeltaTime);
@@ -159,6 +173,8 @@ void ACitySampleVehicleBase::PossessedBy(AController* NewController)
 {
 	Super::PossessedBy(NewController);
 
+	WakeFromTickDormancy();
+
 	ACitySamplePlayerController* CitySamplePlayerController = UCitySampleBlueprintLibrary::GetCitySamplePlayerController(GetWorld());
 	if (CitySamplePlayerController != nullptr && CitySamplePlayerController == NewController)
 	{
@@ -263,6 +279,8 @@ void ACitySampleVehicleBase::UnPossessed()
 
 void ACitySampleVehicleBase::SetVehicleInputs_Implementation(const float Throttle, const float Brake, const bool bHandBrake, const float Steering, const bool bSetSteering)
 {
+	WakeFromTickDormancy();
+
 	SetThrottleInput(Throttle);
 	SetBrakeInput(Brake);
 	SetHandbrakeInput(bHandBrake);
@@ -330,6 +348,9 @@ void ACitySampleVehicleBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 void ACitySampleVehicleBase::PrepareForGame_Implementation()
 {
+	// Pooled vehicles come back with per-frame ticking so they settle into their new spot before dozing off again
+	WakeFromTickDormancy();
+
 	SetActorEnableCollision(true);
 
 	// Reset any wheel motion blur
@@ -549,6 +570,8 @@ void ACitySampleVehicleBase::OnExitVehicle()
 
 void ACitySampleVehicleBase::SetParked(bool bIsParked)
 {
+	WakeFromTickDormancy();
+
 	if (UChaosVehicleMovementComponent* const VMC = GetVehicleMovement())
 	{
 		VMC->SetParked(bIsParked);
@@ -1302,6 +1325,57 @@ void ACitySampleVehicleBase::UpdateTimeSpentSharpSteering(float DeltaTime)
 	}
 }
 
+bool ACitySampleVehicleBase::UpdateTickDormancy(float DeltaTime)
+{
+	bool bEligibleForDormancy = false;
+
+	if (VehicleTickDormancyDelay > 0.0f && !bIsPossessedByPlayer)
+	{
+		const bool bHasDrivingInputs = !FMath::IsNearlyZero(DrivingState.Throttle) || !FMath::IsNearlyZero(DrivingState.Brake) || !FMath::IsNearlyZero(DrivingState.Steering) || DrivingState.bHandbrakeOn;
+
+		bool bPhysicsAsleep = false;
+		if (UChaosVehicleMovementComponent* const VMC = GetVehicleMovement())
+		{
+			if (const FBodyInstance* TargetInstance = VMC->UpdatedPrimitive ? VMC->UpdatedPrimitive->GetBodyInstance() : nullptr)
+			{
+				bPhysicsAsleep = !TargetInstance->IsInstanceAwake();
+			}
+		}
+
+		bEligibleForDormancy = !bHasDrivingInputs && bPhysicsAsleep && !WasRecentlyRendered(VehicleTickDormancyDelay);
+	}
+
+	if (!bEligibleForDormancy)
+	{
+		// Catches wake-ups with no event of our own, like the physics body being woken by an impact
+		WakeFromTickDormancy();
+		return false;
+	}
+
+	if (!bTickDormant)
+	{
+		TimeSpentTickDormancyEligible += DeltaTime;
+		if (TimeSpentTickDormancyEligible >= VehicleTickDormancyDelay)
+		{
+			bTickDormant = true;
+			SetActorTickInterval(VehicleDormantTickInterval);
+		}
+	}
+
+	return bTickDormant;
+}
+
+void ACitySampleVehicleBase::WakeFromTickDormancy()
+{
+	TimeSpentTickDormancyEligible = 0.0f;
+
+	if (bTickDormant)
+	{
+		bTickDormant = false;
+		SetActorTickInterval(0.0f);
+	}
+}
+
 void ACitySampleVehicleBase::ApplyWheelMotionBlurNative(const TArray<UMaterialInstanceDynamic*>& MotionBlurMIDs)
 {
 	static FName NAME_Angle(TEXT("Angle"));
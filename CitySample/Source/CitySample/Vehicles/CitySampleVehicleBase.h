@@ -832,6 +832,12 @@ private:
 	/** Updates the time the vehicle spends steering sharply, an arbitrary value that the driving camera uses for turning behaviors */
 	void UpdateTimeSpentSharpSteering(float DeltaTime);
 
+	/** Tracks whether the tick can go dormant and drops the tick rate once the vehicle has been stationary, unpossessed, and unrendered long enough. Returns true while dormant. */
+	bool UpdateTickDormancy(float DeltaTime);
+
+	/** Restores per-frame ticking. Called by any event that can put a dormant vehicle back in motion */
+	void WakeFromTickDormancy();
+
 	/** Returns true if all wheels are currently in contact with a surface */
 	bool CheckAllWheelsOnGround() const;
 
@@ -899,6 +905,12 @@ private:
 	/** Previous Vehicle sleep state, used in UpdateLODBlend */
 	bool PreviouslyAwake = true;
 
+	/** Time the vehicle has continuously met the tick dormancy conditions, used in UpdateTickDormancy */
+	float TimeSpentTickDormancyEligible = 0.0f;
+
+	/** Whether the tick is currently running at the reduced dormant interval */
+	bool bTickDormant = false;
+
 	/** Current LOD blend timer value */
 	float BlendTimer = 0;
 
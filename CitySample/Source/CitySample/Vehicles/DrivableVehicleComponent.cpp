@@ -4,6 +4,8 @@
 
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+#include "MassTrafficSubsystem.h"
 
 #include "Character/CitySampleCharacter.h"
 #include "Vehicles/CitySampleVehicleBase.h"
@@ -12,9 +14,49 @@
 // Sets default values for this component's properties
 UDrivableVehicleComponent::UDrivableVehicleComponent()
 {
-	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-	// off to improve performance if you don't need them.
-	PrimaryComponentTick.bCanEverTick = false;
+	// Tick at a low rate to watch for the player approaching. The tick disables itself once the
+	// vehicle's physics setup has been prewarmed.
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.TickInterval = 0.5f;
+}
+
+void UDrivableVehicleComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (bPhysicsPrewarmed || PrewarmRadius <= 0.0f)
+	{
+		SetComponentTickEnabled(false);
+		return;
+	}
+
+	const APawn* const PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+	const AActor* const Owner = GetOwner();
+	if (PlayerPawn && Owner && FVector::DistSquared(PlayerPawn->GetActorLocation(), Owner->GetActorLocation()) <= FMath::Square(PrewarmRadius))
+	{
+		PrewarmVehiclePhysics();
+	}
+}
+
+void UDrivableVehicleComponent::PrewarmVehiclePhysics()
+{
+	if (bPhysicsPrewarmed)
+	{
+		return;
+	}
+
+	if (ACitySampleVehicleBase* const Vehicle = GetOwningVehicle())
+	{
+		// Extract and cache the traffic physics template for this vehicle class now, so the
+		// Mass handoff on possession finds it instead of spawning a temp actor to mine it from.
+		if (UMassTrafficSubsystem* const MassTrafficSubsystem = UWorld::GetSubsystem<UMassTrafficSubsystem>(GetWorld()))
+		{
+			MassTrafficSubsystem->GetOrExtractVehiclePhysicsTemplate(Vehicle->GetClass());
+		}
+
+		bPhysicsPrewarmed = true;
+		SetComponentTickEnabled(false);
+	}
 }
 
 bool UDrivableVehicleComponent::DriverGetIn(ACitySampleCharacter* NewDriver)
@@ -26,6 +68,9 @@ bool UDrivableVehicleComponent::DriverGetIn(ACitySampleCharacter* NewDriver)
 
 		if (Vehicle && NewDriverController && Vehicle->HasAuthority())
 		{
+			// Fallback for possessions that beat the proximity prewarm
+			PrewarmVehiclePhysics();
+
 			NewDriverController->Possess(Vehicle);
 
 			Vehicle->SetSeatOccupant(ECitySampleVehicleSeat::Driver, NewDriver);
@@ -46,7 +91,7 @@ void UDrivableVehicleComponent::DriverGetOut()
 	{
 		ACitySampleVehicleBase* const Vehicle = GetOwningVehicle();
 		if (Vehicle)
-		{			
+		{
 			Vehicle->SetSeatOccupant(ECitySampleVehicleSeat::Driver, nullptr);
 
 			if (APlayerController* const VehicleController = Vehicle->GetController<APlayerController>())
@@ -17,10 +17,12 @@ class CITYSAMPLE_API UDrivableVehicleComponent : public UActorComponent
 {
 	GENERATED_BODY()
 
-public:	
+public:
 	// Sets default values for this component's properties
 	UDrivableVehicleComponent();
 
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
 	UFUNCTION(BlueprintCallable)
 	bool DriverGetIn(ACitySampleCharacter* NewDriver);
 
@@ -33,9 +35,19 @@ public:
 	UPROPERTY(BlueprintAssignable)
 	FCitySampleVehicleOnDriverExit OnDriverExit;
 
+	/** Distance from the player at which the vehicle's physics setup is prewarmed ahead of possession. 0 disables prewarming. */
+	UPROPERTY(EditAnywhere, Category = "Prewarm")
+	float PrewarmRadius = 7500.0f;
+
 private:
 	ACitySampleVehicleBase* GetOwningVehicle() const;
 
+	/** Builds and caches the expensive possession-time physics state (notably the traffic vehicle physics template for this vehicle class) before the player gets in */
+	void PrewarmVehiclePhysics();
+
 	UPROPERTY(Transient, BlueprintReadOnly, Meta=(AllowPrivateAccess="true"))
 	ACitySampleCharacter* Driver;
+
+	/** Whether the possession-time physics state has already been prewarmed */
+	bool bPhysicsPrewarmed = false;
 };
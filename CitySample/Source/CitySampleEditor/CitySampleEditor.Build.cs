@@ -57,7 +57,11 @@ public class CitySampleEditor : ModuleRules
 
 		PrivateDependencyModuleNames.AddRange(new string[]
 		{
-			"WorldPartitionHLODUtilities"
+			"WorldPartitionHLODUtilities",
+			"MassEntity",
+			"MassSpawner",
+			"MassSimulation",
+			"MassTraffic"
 		});
 
 		DynamicallyLoadedModuleNames.AddRange(
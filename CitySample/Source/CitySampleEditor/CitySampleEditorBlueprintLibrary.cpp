@@ -26,13 +26,16 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Modules/ModuleManager.h"
 #include "AssetToolsModule.h"
+#include "ComponentReregisterContext.h"
 #include "Editor.h"
 #include "LevelEditorViewport.h"
+#include "Misc/ScopedSlowTask.h"
 #include "ScopedTransaction.h"
 #include "Layers/LayersSubsystem.h"
 
 #include "StaticMeshEditorTools.h"
 #include "EditorReimportHandler.h"
+#include "LevelInstance/CitySampleLevelInstanceUtils.h"
 
 void FCitySampleEditorBlueprintLibraryHelper::AddSingleRootNodeIfRequired(UGeometryCollection* GeometryCollectionObject)
 {
@@ -171,6 +174,38 @@ AGeometryCollectionActor* FCitySampleEditorBlueprintLibraryHelper::ConvertStatic
 	return NewActor;
 }
 
+namespace CitySampleEditorBulkOps
+{
+	/**
+	 * Shared wrapper for bulk static mesh edits driven by scripts: one transaction for the whole batch
+	 * and a single global component reregister instead of the reregister wave each PostEditChange
+	 * would otherwise trigger per asset.
+	 */
+	template <typename FuncType>
+	void ForEachMeshInBulkTransaction(const TArray<UStaticMesh*>& StaticMeshes, const FText& TransactionText, FuncType&& PerMesh)
+	{
+		if (StaticMeshes.IsEmpty())
+		{
+			return;
+		}
+
+		const FScopedTransaction Transaction(TransactionText);
+		FGlobalComponentReregisterContext ReregisterContext;
+
+		FScopedSlowTask SlowTask(StaticMeshes.Num(), TransactionText);
+		SlowTask.MakeDialog();
+
+		for (UStaticMesh* StaticMesh : StaticMeshes)
+		{
+			SlowTask.EnterProgressFrame(1);
+			if (StaticMesh)
+			{
+				PerMesh(StaticMesh);
+			}
+		}
+	}
+}
+
 void UCitySampleEditorBlueprintLibrary::SetNaniteSettings(UStaticMesh* StaticMesh, bool bEnabled, float PercentTriangles)
 {
 	StaticMesh->Modify();
@@ -179,6 +214,14 @@ void UCitySampleEditorBlueprintLibrary::SetNaniteSettings(UStaticMesh* StaticMes
 	StaticMesh->PostEditChange();
 }
 
+void UCitySampleEditorBlueprintLibrary::SetNaniteSettingsBulk(const TArray<UStaticMesh*>& StaticMeshes, bool bEnabled, float PercentTriangles)
+{
+	CitySampleEditorBulkOps::ForEachMeshInBulkTransaction(StaticMeshes, NSLOCTEXT("CitySampleEditor", "SetNaniteSettingsBulk", "Set Nanite Settings"), [bEnabled, PercentTriangles](UStaticMesh* StaticMesh)
+	{
+		SetNaniteSettings(StaticMesh, bEnabled, PercentTriangles);
+	});
+}
+
 void UCitySampleEditorBlueprintLibrary::GenerateGeometryCollection(const FString& AssetPath, TArray<AActor*> Actors)
 {
 	// This method is a hacked reimplementation FractureEditorModeToolkit::OnGenerateAssetPathChose that strips out most UI-coupled logic.
@@ -226,6 +269,14 @@ void UCitySampleEditorBlueprintLibrary::SetCollisionComplexity(UStaticMesh* Stat
 	StaticMesh->PostEditChange();
 }
 
+void UCitySampleEditorBlueprintLibrary::SetCollisionComplexityBulk(const TArray<UStaticMesh*>& StaticMeshes, const TEnumAsByte<ECollisionTraceFlag> Complexity)
+{
+	CitySampleEditorBulkOps::ForEachMeshInBulkTransaction(StaticMeshes, NSLOCTEXT("CitySampleEditor", "SetCollisionComplexityBulk", "Set Collision Complexity"), [Complexity](UStaticMesh* StaticMesh)
+	{
+		SetCollisionComplexity(StaticMesh, Complexity);
+	});
+}
+
 bool UCitySampleEditorBlueprintLibrary::GetCollisionComplexity(UStaticMesh* StaticMesh, TEnumAsByte<ECollisionTraceFlag>& Complexity)
 {
 	if (!StaticMesh)
@@ -252,6 +303,14 @@ void UCitySampleEditorBlueprintLibrary::SetNeverNeedsCookedCollisionData(UStatic
 	}
 }
 
+void UCitySampleEditorBlueprintLibrary::SetNeverNeedsCookedCollisionDataBulk(const TArray<UStaticMesh*>& StaticMeshes, bool bNeverNeedsCookedCollisionData)
+{
+	CitySampleEditorBulkOps::ForEachMeshInBulkTransaction(StaticMeshes, NSLOCTEXT("CitySampleEditor", "SetNeverNeedsCookedCollisionDataBulk", "Set Never Needs Cooked Collision Data"), [bNeverNeedsCookedCollisionData](UStaticMesh* StaticMesh)
+	{
+		SetNeverNeedsCookedCollisionData(StaticMesh, bNeverNeedsCookedCollisionData);
+	});
+}
+
 bool UCitySampleEditorBlueprintLibrary::GetNeverNeedsCookedCollisionData(UStaticMesh* StaticMesh)
 {
 	UBodySetup* BodySetup = StaticMesh ? StaticMesh->GetBodySetup() : nullptr;
@@ -432,11 +491,19 @@ void UCitySampleEditorBlueprintLibrary::UpdateReimportPath(UStaticMesh* Mesh, co
 
 void UCitySampleEditorBlueprintLibrary::ReimportStaticMeshWithModify(UStaticMesh* Mesh)
 {
-	Mesh->Modify(); 
+	Mesh->Modify();
 	FReimportManager::Instance()->Reimport(Mesh, false, false, "", nullptr, INDEX_NONE, false, false);
 	Mesh->PostEditChange();
 }
 
+void UCitySampleEditorBlueprintLibrary::ReimportStaticMeshWithModifyBulk(const TArray<UStaticMesh*>& StaticMeshes)
+{
+	CitySampleEditorBulkOps::ForEachMeshInBulkTransaction(StaticMeshes, NSLOCTEXT("CitySampleEditor", "ReimportStaticMeshWithModifyBulk", "Reimport Static Meshes"), [](UStaticMesh* StaticMesh)
+	{
+		ReimportStaticMeshWithModify(StaticMesh);
+	});
+}
+
 bool UCitySampleEditorBlueprintLibrary::GetGenerateLightmapUVs(UStaticMesh* StaticMesh)
 {
 	bool bGenerateLightmapUVs = false; 
@@ -460,8 +527,8 @@ void UCitySampleEditorBlueprintLibrary::ResetMaterialSectionSlots(UStaticMesh* M
 		{
 			if (Mesh->GetSectionInfoMap().IsValidSection(LodIndex, SectionIndex))
 			{
-				FMeshSectionInfo SectionInfo = Mesh->GetSectionInfoMap().Get(LodIndex, SectionIndex); 
-				SectionInfo.MaterialIndex = SectionIndex; 
+				FMeshSectionInfo SectionInfo = Mesh->GetSectionInfoMap().Get(LodIndex, SectionIndex);
+				SectionInfo.MaterialIndex = SectionIndex;
 				Mesh->GetSectionInfoMap().Set(LodIndex, SectionIndex, SectionInfo);
 			}
 		}
@@ -469,6 +536,14 @@ void UCitySampleEditorBlueprintLibrary::ResetMaterialSectionSlots(UStaticMesh* M
 	Mesh->PostEditChange();
 }
 
+void UCitySampleEditorBlueprintLibrary::ResetMaterialSectionSlotsBulk(const TArray<UStaticMesh*>& Meshes)
+{
+	CitySampleEditorBulkOps::ForEachMeshInBulkTransaction(Meshes, NSLOCTEXT("CitySampleEditor", "ResetMaterialSectionSlotsBulk", "Reset Material Section Slots"), [](UStaticMesh* Mesh)
+	{
+		ResetMaterialSectionSlots(Mesh);
+	});
+}
+
 bool UCitySampleEditorBlueprintLibrary::IsMaterialIndexUsed(UStaticMesh* Mesh, int32 MaterialIndex)
 {
 	if (!Mesh) return false;
@@ -593,3 +668,8 @@ TArray<FString> UCitySampleEditorBlueprintLibrary::GetSequenceEvents(ULevelSeque
 	}
 	return SequenceEvents;
 }
+
+int32 UCitySampleEditorBlueprintLibrary::ConvertPackedLevelActorsToISMActors(const TArray<APackedLevelActor*>& PackedLevelActors)
+{
+	return FCitySampleLevelInstanceUtils::ConvertPackedToActors(PackedLevelActors);
+}
@@ -38,18 +38,30 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "CitySample | StaticMesh", meta = (ScriptMethod))
 	static void SetNaniteSettings(UStaticMesh* StaticMesh, bool bEnabled, float PercentTriangles);
 
+	/** Bulk variant of SetNaniteSettings: one transaction and one component reregister wave for the whole batch */
+	UFUNCTION(BlueprintCallable, Category = "CitySample | StaticMesh", meta = (ScriptMethod))
+	static void SetNaniteSettingsBulk(const TArray<UStaticMesh*>& StaticMeshes, bool bEnabled, float PercentTriangles);
+
 	UFUNCTION(BlueprintCallable, Category = "CitySample | Fracture")
 	static void GenerateGeometryCollection(const FString& AssetPath, TArray<AActor*> Actors);
 
 	UFUNCTION(BlueprintCallable, Category = "CitySample | StaticMesh", meta=(ScriptMethod))
 	static void SetCollisionComplexity(UStaticMesh* StaticMesh,  const TEnumAsByte<ECollisionTraceFlag> Complexity);
 
+	/** Bulk variant of SetCollisionComplexity: one transaction and one component reregister wave for the whole batch */
+	UFUNCTION(BlueprintCallable, Category = "CitySample | StaticMesh", meta = (ScriptMethod))
+	static void SetCollisionComplexityBulk(const TArray<UStaticMesh*>& StaticMeshes, const TEnumAsByte<ECollisionTraceFlag> Complexity);
+
 	UFUNCTION(BlueprintPure, Category = "CitySample | StaticMesh", meta = (ScriptMethod))
 	static bool GetCollisionComplexity(UStaticMesh* StaticMesh, TEnumAsByte<ECollisionTraceFlag>& Complexity);
 
 	UFUNCTION(BlueprintCallable, Category = "CitySample | StaticMesh", meta = (ScriptMethod))
 	static void SetNeverNeedsCookedCollisionData(UStaticMesh* StaticMesh, bool bNeverNeedsCookedCollisionData);
 
+	/** Bulk variant of SetNeverNeedsCookedCollisionData: one transaction and one component reregister wave for the whole batch */
+	UFUNCTION(BlueprintCallable, Category = "CitySample | StaticMesh", meta = (ScriptMethod))
+	static void SetNeverNeedsCookedCollisionDataBulk(const TArray<UStaticMesh*>& StaticMeshes, bool bNeverNeedsCookedCollisionData);
+
 	UFUNCTION(BlueprintCallable, Category = "CitySample | StaticMesh", meta = (ScriptMethod))
 	static bool GetNeverNeedsCookedCollisionData(UStaticMesh* StaticMesh);
 
@@ -77,12 +89,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "CitySample | StaticMesh", meta = (ScriptMethod))
 	static void ReimportStaticMeshWithModify(UStaticMesh* StaticMesh);
 
+	/** Bulk variant of ReimportStaticMeshWithModify: one transaction and one component reregister wave for the whole batch */
+	UFUNCTION(BlueprintCallable, Category = "CitySample | StaticMesh", meta = (ScriptMethod))
+	static void ReimportStaticMeshWithModifyBulk(const TArray<UStaticMesh*>& StaticMeshes);
+
 	UFUNCTION(BlueprintCallable, Category = "CitySample | StaticMesh", meta = (ScriptMethod))
 	static bool GetGenerateLightmapUVs(UStaticMesh* StaticMesh);
 
 	UFUNCTION(BlueprintCallable, Category = "CitySample | StaticMesh", meta = (ScriptMethod))
 	static void ResetMaterialSectionSlots(UStaticMesh* Mesh);
 
+	/** Bulk variant of ResetMaterialSectionSlots: one transaction and one component reregister wave for the whole batch */
+	UFUNCTION(BlueprintCallable, Category = "CitySample | StaticMesh", meta = (ScriptMethod))
+	static void ResetMaterialSectionSlotsBulk(const TArray<UStaticMesh*>& Meshes);
+
 	UFUNCTION(BlueprintCallable, Category = "CitySample | StaticMesh", meta = (ScriptMethod))
 	static bool IsMaterialIndexUsed(UStaticMesh* Mesh, int32 MaterialIndex);
 
@@ -98,6 +118,14 @@ public:
 	UFUNCTION(BlueprintPure, Category = "CitySample | Sequencer", meta = (ScriptMethod))
 	static TArray<FString> GetSequenceEvents(ULevelSequence* LevelSequence);
 
+	/**
+	 * Converts a batch of Packed Level Actors to ISM Actors inside a single transaction, with
+	 * per-instance notifications suspended and one aggregate editor update at the end.
+	 * Returns the number of actors converted.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "CitySample | LevelInstance", meta = (ScriptMethod))
+	static int32 ConvertPackedLevelActorsToISMActors(const TArray<class APackedLevelActor*>& PackedLevelActors);
+
 private:
 	static void CopyConstraintSettings(UPhysicsConstraintTemplate* FromConstraintSetup, UPhysicsConstraintTemplate* ToConstraintSetup, bool bKeepPosition, bool bKeepRotation);
 }; 
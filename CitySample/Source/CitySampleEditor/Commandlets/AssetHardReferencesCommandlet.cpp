@@ -167,6 +167,101 @@ void CalculateReferencedBy(TMap<FName, FPackageReferenceInformation>& ReferenceM
 	}
 }
 
+// Streaming analysis: computes the same hard reference and referenced-by counts as the merge-based
+// path, but never materializes per-package closures. Each discovered package is visited once with a
+// depth-first walk over the registry's hard dependency edges; the walk's visited set is the only
+// closure-sized allocation alive at a time, and counts accumulate into a map bounded by the number
+// of reported assets, so peak memory no longer scales with the total content size. The trade is
+// recomputing shared subgraphs per seed, which costs time instead of memory.
+void RunStreamingAnalysis(IAssetRegistry& AssetRegistry, const TArray<FAssetData>& AssetsInFolder, TMap<FName, FPackageReferenceInformation>& OutReferenceMap)
+{
+	// Rows are only reported for the assets in the search folder, so only those need counts retained
+	for (const FAssetData& AssetInFolder : AssetsInFolder)
+	{
+		OutReferenceMap.FindOrAdd(AssetInFolder.PackageName);
+	}
+
+	// Every package reachable from the folder contributes to referenced-by counts, matching the
+	// merge-based path where discovered packages are added to the map and counted as referencers
+	TSet<FName> QueuedSeeds;
+	TArray<FName> SeedQueue;
+	QueuedSeeds.Reserve(AssetsInFolder.Num());
+	SeedQueue.Reserve(AssetsInFolder.Num());
+	for (const FAssetData& AssetInFolder : AssetsInFolder)
+	{
+		bool bAlreadyQueued = false;
+		QueuedSeeds.Add(AssetInFolder.PackageName, &bAlreadyQueued);
+		if (!bAlreadyQueued)
+		{
+			SeedQueue.Add(AssetInFolder.PackageName);
+		}
+	}
+
+	TSet<FName> Visited;
+	TArray<FName> Stack;
+	TArray<FAssetIdentifier> FoundDependencies;
+
+	for (int32 SeedIndex = 0; SeedIndex < SeedQueue.Num(); ++SeedIndex)
+	{
+		const FName SeedPackage = SeedQueue[SeedIndex];
+
+		Visited.Reset();
+		Stack.Reset();
+		Visited.Add(SeedPackage);
+		Stack.Push(SeedPackage);
+
+		while (!Stack.IsEmpty())
+		{
+			const FName CurrentPackage = Stack.Pop();
+
+			FoundDependencies.Reset();
+			AssetRegistry.GetDependencies(CurrentPackage, FoundDependencies, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+
+			for (const FAssetIdentifier& DependencyIdentifier : FoundDependencies)
+			{
+				bool bAlreadyVisited = false;
+				Visited.Add(DependencyIdentifier.PackageName, &bAlreadyVisited);
+				if (!bAlreadyVisited)
+				{
+					Stack.Push(DependencyIdentifier.PackageName);
+				}
+			}
+		}
+
+		if (FPackageReferenceInformation* SeedInformation = OutReferenceMap.Find(SeedPackage))
+		{
+			SeedInformation->HardReferenceCount = Visited.Num() - 1;
+		}
+
+		for (const FName& ClosureMember : Visited)
+		{
+			if (ClosureMember == SeedPackage)
+			{
+				continue;
+			}
+
+			if (FPackageReferenceInformation* MemberInformation = OutReferenceMap.Find(ClosureMember))
+			{
+				MemberInformation->ReferencedByCount++;
+			}
+
+			bool bAlreadyQueued = false;
+			QueuedSeeds.Add(ClosureMember, &bAlreadyQueued);
+			if (!bAlreadyQueued)
+			{
+				SeedQueue.Add(ClosureMember);
+			}
+		}
+
+		if (((SeedIndex + 1) % 1000) == 0)
+		{
+			UE_LOG(LogAssetHardReferences, Display, TEXT("Processed %d of %d packages"), SeedIndex + 1, SeedQueue.Num());
+		}
+	}
+
+	UE_LOG(LogAssetHardReferences, Display, TEXT("Processed %d packages"), SeedQueue.Num());
+}
+
 void SerializeHeader(FArchive* Archive)
 {
 	FTCHARToUTF8 UTF8Header(TEXT("Package Name,Asset Name,Asset Class,Hard Reference Count,Referenced By Count\n"));
@@ -216,7 +311,7 @@ UAssetHardReferencesCommandlet::UAssetHardReferencesCommandlet()
 {
 	HelpDescription = TEXT("Walks a directory and generates a CSV files containg the number of hard references for each asset. By default this is done without recursion starting in the project's content folder. The result will be created in a Reports subfolder within the Project Directory.");
 
-	HelpUsage = TEXT("AssetHardReferences Usage: AssetHardReferences [-Folder=FolderName] [-Recursive]");
+	HelpUsage = TEXT("AssetHardReferences Usage: AssetHardReferences [-Folder=FolderName] [-Recursive] [-Streaming]");
 
 	IsClient = false;
 	IsEditor = true;
@@ -259,8 +354,13 @@ int32 UAssetHardReferencesCommandlet::Main(const FString& FullCommandLine)
 
 	const bool bRecursive = Switches.Contains(TEXT("recursive")) || Switches.Contains(TEXT("r"));
 
+	// Streaming mode keeps peak memory bounded by the largest single reference closure instead of
+	// the whole content graph, at the cost of extra graph walking time. Use on memory-constrained agents.
+	const bool bStreaming = Switches.Contains(TEXT("streaming"));
+
 	UE_LOG(LogAssetHardReferences, Display, TEXT("Starting Folder\t\t- %s"), *StartingFolder);
 	UE_LOG(LogAssetHardReferences, Display, TEXT("Recursive\t\t- %s"), bRecursive ? TEXT("True") : TEXT("False"));
+	UE_LOG(LogAssetHardReferences, Display, TEXT("Streaming\t\t- %s"), bStreaming ? TEXT("True") : TEXT("False"));
 	
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
     IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
@@ -279,18 +379,24 @@ int32 UAssetHardReferencesCommandlet::Main(const FString& FullCommandLine)
 	
 	AssetRegistry.GetAssets(Filter, AssetsInFolder);	
 
-	// Prepare the map, this will be used for some existence checking later
-	for (const FAssetData& CurrentAssetData : AssetsInFolder)
+	FDateTime StartTime = FDateTime::Now();
+
+	if (bStreaming)
 	{
-		FPackageReferenceInformation& NewReferenceInformation = ReferenceMap.Add(CurrentAssetData.PackageName);
-		NewReferenceInformation.Initialize(CurrentAssetData.PackageName, AssetRegistry);
+		RunStreamingAnalysis(AssetRegistry, AssetsInFolder, ReferenceMap);
 	}
+	else
+	{
+		// Prepare the map, this will be used for some existence checking later
+		for (const FAssetData& CurrentAssetData : AssetsInFolder)
+		{
+			FPackageReferenceInformation& NewReferenceInformation = ReferenceMap.Add(CurrentAssetData.PackageName);
+			NewReferenceInformation.Initialize(CurrentAssetData.PackageName, AssetRegistry);
+		}
 
-
-	FDateTime StartTime = FDateTime::Now();
-
-	CalculateReferences(ReferenceMap);
-	CalculateReferencedBy(ReferenceMap);
+		CalculateReferences(ReferenceMap);
+		CalculateReferencedBy(ReferenceMap);
+	}
 
 	FTimespan ElapsedTime = FDateTime::Now() - StartTime;
 
@@ -145,6 +145,16 @@ int32 UCitySampleContentValidationCommandlet::Main(const FString& FullCommandLin
 
 	int32 MaxPackagesToLoad = 2000;
 
+	// Use to also validate assets affected by the changed packages through the asset registry
+	// dependency graph, e.g. "-ReferencerDepth=1" revalidates direct referencers of every changed
+	// asset, "-ReferencerDepth=2" also their referencers, and so on. This keeps changelist-based
+	// runs to the affected closure instead of requiring a broad -InPath sweep to catch knock-ons.
+	int32 ReferencerDepth = 0;
+	if (FString* ReferencerDepthString = Params.Find(TEXT("ReferencerDepth")))
+	{
+		ReferencerDepth = FCString::Atoi(**ReferencerDepthString);
+	}
+
 	FString* InPathString = Params.Find(TEXT("InPath"));
 	if (InPathString && !InPathString->IsEmpty())
 	{
@@ -179,6 +189,11 @@ int32 UCitySampleContentValidationCommandlet::Main(const FString& FullCommandLin
 		MaxPackagesToLoad = FCString::Atoi(**InMaxPackagesToLoadString);
 	}
 
+	if (ReferencerDepth > 0)
+	{
+		ExpandToAffectedReferencers(AssetRegistry, ReferencerDepth, MaxPackagesToLoad, ChangedPackageNames);
+	}
+
 	TArray<FString> AllWarningsAndErrors;
 	UCitySampleEditorValidator::ValidatePackages(ChangedPackageNames, DeletedPackageNames, MaxPackagesToLoad, AllWarningsAndErrors);
 
@@ -582,3 +597,53 @@ void UCitySampleContentValidationCommandlet::GetChangedAssetsForCode(IAssetRegis
 		}
 	}
 }
+
+void UCitySampleContentValidationCommandlet::ExpandToAffectedReferencers(IAssetRegistry& AssetRegistry, int32 MaxDepth, int32 MaxAssets, TArray<FString>& InOutPackageNames) const
+{
+	SCOPE_LOG_TIME_IN_SECONDS(TEXT("Expanding changed packages to affected referencers"), nullptr);
+
+	// Breadth-first walk up the dependency graph: the changed packages are the seed set, each pass
+	// adds the packages that reference the previous pass. Uncooked and test map content is pruned
+	// from the closure the same way it is pruned from the changed file list.
+	TSet<FString> Visited(InOutPackageNames);
+	TArray<FName> CurrentDepth;
+	CurrentDepth.Reserve(InOutPackageNames.Num());
+	for (const FString& PackageName : InOutPackageNames)
+	{
+		CurrentDepth.Add(FName(*PackageName));
+	}
+
+	const int32 InitialPackages = InOutPackageNames.Num();
+
+	for (int32 Depth = 0; Depth < MaxDepth && !CurrentDepth.IsEmpty(); ++Depth)
+	{
+		TArray<FName> NextDepth;
+		for (const FName& PackageName : CurrentDepth)
+		{
+			TArray<FName> PackageReferencers;
+			AssetRegistry.GetReferencers(PackageName, PackageReferencers, UE::AssetRegistry::EDependencyCategory::Package);
+			for (const FName& Referencer : PackageReferencers)
+			{
+				const FString ReferencerString = Referencer.ToString();
+				if (!Visited.Contains(ReferencerString) && !UCitySampleEditorValidator::IsInUncookedFolder(ReferencerString) && !UCitySampleEditorValidator::IsInTestMapsFolder(ReferencerString))
+				{
+					Visited.Add(ReferencerString);
+					NextDepth.Add(Referencer);
+					InOutPackageNames.Add(ReferencerString);
+
+					if (InOutPackageNames.Num() > MaxAssets)
+					{
+						// The closure exceeded the load budget; stop expanding here so the run reports
+						// the overflow via the MaxPackagesToLoad path rather than walking the whole graph
+						UE_LOG(LogCitySampleContentValidation, Warning, TEXT("Referencer closure exceeded %d packages at depth %d, stopping expansion."), MaxAssets, Depth + 1);
+						return;
+					}
+				}
+			}
+		}
+
+		CurrentDepth = MoveTemp(NextDepth);
+	}
+
+	UE_LOG(LogCitySampleContentValidation, Display, TEXT("Referencer expansion added %d packages to the %d changed (depth %d)."), InOutPackageNames.Num() - InitialPackages, InitialPackages, MaxDepth);
+}
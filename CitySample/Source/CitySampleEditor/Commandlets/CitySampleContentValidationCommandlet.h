@@ -25,4 +25,5 @@ private:
 	void GetAllPackagesOfType(const FString& OfTypeString, TArray<FString>& OutPackageNames) const;
 	bool LaunchP4(const FString& Args, TArray<FString>& Output, int32& OutReturnCode) const;
 	void GetChangedAssetsForCode(IAssetRegistry& AssetRegistry, const FString& InChangedHeader, TArray<FString>& OutChangedPackageNames) const;
+	void ExpandToAffectedReferencers(IAssetRegistry& AssetRegistry, int32 MaxDepth, int32 MaxAssets, TArray<FString>& InOutPackageNames) const;
 };
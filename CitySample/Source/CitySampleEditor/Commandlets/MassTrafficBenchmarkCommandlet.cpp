@@ -0,0 +1,348 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MassTrafficBenchmarkCommandlet.h"
+
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/ThreadManager.h"
+#include "MassSimulationSubsystem.h"
+#include "MassSpawner.h"
+#include "MassTraffic.h"
+#include "MassTrafficSubsystem.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/Package.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMassTrafficBenchmark, Log, All);
+
+namespace
+{
+
+constexpr int32 NumProcessingPhases = static_cast<int32>(EMassProcessingPhase::MAX);
+
+/** Per-frame wall time samples for one vehicle count run, split by Mass processing phase. */
+struct FMassTrafficBenchmarkRun
+{
+	int32 RequestedVehicleCount = 0;
+	int32 MeasuredVehicleCount = 0;
+
+	TArray<double> FrameMilliseconds;
+	TArray<double> PhaseMilliseconds[NumProcessingPhases];
+};
+
+double SamplePercentile(const TArray<double>& SortedSamples, double Ratio)
+{
+	if (SortedSamples.IsEmpty())
+	{
+		return 0.0;
+	}
+
+	const int32 SampleIndex = FMath::Clamp(FMath::CeilToInt32(Ratio * SortedSamples.Num()) - 1, 0, SortedSamples.Num() - 1);
+	return SortedSamples[SampleIndex];
+}
+
+double SampleMean(const TArray<double>& Samples)
+{
+	if (Samples.IsEmpty())
+	{
+		return 0.0;
+	}
+
+	double Sum = 0.0;
+	for (const double Sample : Samples)
+	{
+		Sum += Sample;
+	}
+	return Sum / Samples.Num();
+}
+
+FString ProcessingPhaseName(const int32 PhaseIndex)
+{
+	return StaticEnum<EMassProcessingPhase>()->GetNameStringByValue(PhaseIndex);
+}
+
+} // anonymous namespace
+
+UMassTrafficBenchmarkCommandlet::UMassTrafficBenchmarkCommandlet()
+{
+	HelpDescription = TEXT("Loads a map, spawns configurable traffic vehicle counts on its zone graph, ticks the Mass simulation headlessly for a fixed number of frames, and writes per-phase frame timing percentiles as CSV and JSON to the project's Reports folder.");
+
+	HelpUsage = TEXT("MassTrafficBenchmark Usage: MassTrafficBenchmark -Map=/Game/Map/MapName [-VehicleCounts=5000,10000,20000] [-NumFrames=600] [-WarmupFrames=120] [-DeltaSeconds=0.0333]");
+
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UMassTrafficBenchmarkCommandlet::Main(const FString& FullCommandLine)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> Params;
+
+	ParseCommandLine(*FullCommandLine, Tokens, Switches, Params);
+
+	if (Switches.Contains(TEXT("help")) || Switches.Contains(TEXT("h")))
+	{
+		UE_LOG(LogMassTrafficBenchmark, Display, TEXT("%s\n%s"), *HelpDescription, *HelpUsage);
+		return 0;
+	}
+
+	const FString* MapParam = Params.Find(TEXT("map"));
+	if (!MapParam)
+	{
+		UE_LOG(LogMassTrafficBenchmark, Error, TEXT("No map specified. %s"), *HelpUsage);
+		return 1;
+	}
+
+	TArray<int32> VehicleCounts;
+	{
+		FString VehicleCountsString = TEXT("5000,10000,20000");
+		if (const FString* VehicleCountsParam = Params.Find(TEXT("vehiclecounts")))
+		{
+			VehicleCountsString = *VehicleCountsParam;
+		}
+
+		TArray<FString> VehicleCountStrings;
+		VehicleCountsString.ParseIntoArray(VehicleCountStrings, TEXT(","));
+		for (const FString& VehicleCountString : VehicleCountStrings)
+		{
+			const int32 VehicleCount = FCString::Atoi(*VehicleCountString);
+			if (VehicleCount > 0)
+			{
+				VehicleCounts.Add(VehicleCount);
+			}
+		}
+	}
+	if (VehicleCounts.IsEmpty())
+	{
+		UE_LOG(LogMassTrafficBenchmark, Error, TEXT("No valid vehicle counts specified. %s"), *HelpUsage);
+		return 1;
+	}
+
+	const int32 NumFrames = Params.Contains(TEXT("numframes")) ? FCString::Atoi(*Params.FindChecked(TEXT("numframes"))) : 600;
+	const int32 WarmupFrames = Params.Contains(TEXT("warmupframes")) ? FCString::Atoi(*Params.FindChecked(TEXT("warmupframes"))) : 120;
+	const float DeltaSeconds = Params.Contains(TEXT("deltaseconds")) ? FCString::Atof(*Params.FindChecked(TEXT("deltaseconds"))) : 1.0f / 30.0f;
+
+	UE_LOG(LogMassTrafficBenchmark, Display, TEXT("Map\t\t- %s"), **MapParam);
+	UE_LOG(LogMassTrafficBenchmark, Display, TEXT("Frames\t\t- %d (+%d warmup) @ %.4fs"), NumFrames, WarmupFrames, DeltaSeconds);
+
+	// Load the map and boot it for headless play.
+	UPackage* MapPackage = LoadPackage(nullptr, **MapParam, LOAD_None);
+	UWorld* World = MapPackage ? UWorld::FindWorldInPackage(MapPackage) : nullptr;
+	if (!World)
+	{
+		UE_LOG(LogMassTrafficBenchmark, Error, TEXT("Unable to load a world from map %s"), **MapParam);
+		return 1;
+	}
+
+	World->WorldType = EWorldType::Game;
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	World->InitWorld(UWorld::InitializationValues()
+		.AllowAudioPlayback(false)
+		.RequiresHitProxies(false)
+		.CreateNavigation(false)
+		.CreateAISystem(false)
+		.ShouldSimulatePhysics(true)
+		.SetTransactional(false));
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	UMassSimulationSubsystem* SimulationSubsystem = UWorld::GetSubsystem<UMassSimulationSubsystem>(World);
+	UMassTrafficSubsystem* TrafficSubsystem = UWorld::GetSubsystem<UMassTrafficSubsystem>(World);
+	if (!SimulationSubsystem || !TrafficSubsystem)
+	{
+		UE_LOG(LogMassTrafficBenchmark, Error, TEXT("Map %s has no Mass simulation or traffic subsystem"), **MapParam);
+		return 1;
+	}
+
+	// Hook the Mass processing phase delegates to time each phase within the frame. Mass doesn't
+	// expose per-processor timing hooks, so per-phase wall time is the finest split available
+	// here; use "stat Traffic" captures to drill into individual processors.
+	bool bRecordSamples = false;
+	double PhaseStartSeconds[NumProcessingPhases] = { 0.0 };
+	TArray<double> PhaseMillisecondsThisRun[NumProcessingPhases];
+	FDelegateHandle PhaseStartedHandles[NumProcessingPhases];
+	FDelegateHandle PhaseFinishedHandles[NumProcessingPhases];
+	for (int32 PhaseIndex = 0; PhaseIndex < NumProcessingPhases; ++PhaseIndex)
+	{
+		const EMassProcessingPhase Phase = static_cast<EMassProcessingPhase>(PhaseIndex);
+		PhaseStartedHandles[PhaseIndex] = SimulationSubsystem->GetOnProcessingPhaseStarted(Phase).AddLambda([&PhaseStartSeconds, PhaseIndex](const float /*DeltaSeconds*/)
+		{
+			PhaseStartSeconds[PhaseIndex] = FPlatformTime::Seconds();
+		});
+		PhaseFinishedHandles[PhaseIndex] = SimulationSubsystem->GetOnProcessingPhaseFinished(Phase).AddLambda([&bRecordSamples, &PhaseStartSeconds, &PhaseMillisecondsThisRun, PhaseIndex](const float /*DeltaSeconds*/)
+		{
+			if (bRecordSamples)
+			{
+				PhaseMillisecondsThisRun[PhaseIndex].Add((FPlatformTime::Seconds() - PhaseStartSeconds[PhaseIndex]) * 1000.0);
+			}
+		});
+	}
+
+	auto TickWorld = [World, DeltaSeconds]()
+	{
+		GFrameCounter++;
+		World->Tick(LEVELTICK_All, DeltaSeconds);
+		FTSTicker::GetCoreTicker().Tick(DeltaSeconds);
+		FThreadManager::Get().Tick();
+	};
+
+	// Spawn at authored counts first to establish the baseline the scale multiplier is relative to.
+	TArray<AMassSpawner*> Spawners;
+	for (TActorIterator<AMassSpawner> It(World); It; ++It)
+	{
+		Spawners.Add(*It);
+		(*It)->DoSpawning();
+	}
+	for (int32 SettleFrame = 0; SettleFrame < 10; ++SettleFrame)
+	{
+		TickWorld();
+	}
+
+	const int32 BaseVehicleCount = TrafficSubsystem->GetNumTrafficVehicleAgents();
+	if (BaseVehicleCount <= 0)
+	{
+		UE_LOG(LogMassTrafficBenchmark, Error, TEXT("Map %s spawned no traffic vehicles - check its zone graph and Mass spawners"), **MapParam);
+		return 1;
+	}
+	UE_LOG(LogMassTrafficBenchmark, Display, TEXT("Authored spawner configuration yields %d traffic vehicles"), BaseVehicleCount);
+
+	const float PreviousNumTrafficVehiclesScale = GMassTrafficNumTrafficVehiclesScale;
+
+	TArray<FMassTrafficBenchmarkRun> Runs;
+	for (const int32 RequestedVehicleCount : VehicleCounts)
+	{
+		// MassTraffic.NumTrafficVehiclesScale multiplies only the traffic vehicle spawn data
+		// generator's count, so parked vehicles, trailers and crowd keep their authored counts.
+		GMassTrafficNumTrafficVehiclesScale = static_cast<float>(RequestedVehicleCount) / static_cast<float>(BaseVehicleCount);
+		for (AMassSpawner* Spawner : Spawners)
+		{
+			Spawner->DoDespawning();
+			Spawner->DoSpawning();
+		}
+
+		for (int32 WarmupFrame = 0; WarmupFrame < WarmupFrames; ++WarmupFrame)
+		{
+			TickWorld();
+		}
+
+		FMassTrafficBenchmarkRun& Run = Runs.AddDefaulted_GetRef();
+		Run.RequestedVehicleCount = RequestedVehicleCount;
+		Run.MeasuredVehicleCount = TrafficSubsystem->GetNumTrafficVehicleAgents();
+
+		for (int32 PhaseIndex = 0; PhaseIndex < NumProcessingPhases; ++PhaseIndex)
+		{
+			PhaseMillisecondsThisRun[PhaseIndex].Reset();
+		}
+
+		bRecordSamples = true;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			const double FrameStartSeconds = FPlatformTime::Seconds();
+			TickWorld();
+			Run.FrameMilliseconds.Add((FPlatformTime::Seconds() - FrameStartSeconds) * 1000.0);
+		}
+		bRecordSamples = false;
+
+		for (int32 PhaseIndex = 0; PhaseIndex < NumProcessingPhases; ++PhaseIndex)
+		{
+			Run.PhaseMilliseconds[PhaseIndex] = MoveTemp(PhaseMillisecondsThisRun[PhaseIndex]);
+		}
+
+		UE_LOG(LogMassTrafficBenchmark, Display, TEXT("Measured %d frames at %d traffic vehicles (%d requested)"), NumFrames, Run.MeasuredVehicleCount, RequestedVehicleCount);
+
+		CollectGarbage(RF_NoFlags);
+	}
+
+	GMassTrafficNumTrafficVehiclesScale = PreviousNumTrafficVehiclesScale;
+	for (int32 PhaseIndex = 0; PhaseIndex < NumProcessingPhases; ++PhaseIndex)
+	{
+		const EMassProcessingPhase Phase = static_cast<EMassProcessingPhase>(PhaseIndex);
+		SimulationSubsystem->GetOnProcessingPhaseStarted(Phase).Remove(PhaseStartedHandles[PhaseIndex]);
+		SimulationSubsystem->GetOnProcessingPhaseFinished(Phase).Remove(PhaseFinishedHandles[PhaseIndex]);
+	}
+
+	// Emit the results as CSV and JSON next to the other commandlet reports.
+	const FString ReportBasePath = FPaths::ProjectDir() / TEXT("Reports") / FString::Printf(TEXT("%s-%s-%s"), FApp::GetProjectName(), TEXT("MassTrafficBenchmark"), *FDateTime::Now().ToString());
+
+	FString CSV = TEXT("VehicleCount,MeasuredVehicleCount,Scope,Samples,MeanMs,P50Ms,P95Ms,P99Ms,MaxMs\n");
+	TArray<TSharedPtr<FJsonValue>> JsonRuns;
+	for (FMassTrafficBenchmarkRun& Run : Runs)
+	{
+		TSharedRef<FJsonObject> JsonRun = MakeShared<FJsonObject>();
+		JsonRun->SetNumberField(TEXT("RequestedVehicleCount"), Run.RequestedVehicleCount);
+		JsonRun->SetNumberField(TEXT("MeasuredVehicleCount"), Run.MeasuredVehicleCount);
+
+		TArray<TSharedPtr<FJsonValue>> JsonScopes;
+		auto EmitScope = [&CSV, &JsonScopes, &Run](const FString& ScopeName, TArray<double>& Samples)
+		{
+			Samples.Sort();
+
+			const double MeanMs = SampleMean(Samples);
+			const double P50Ms = SamplePercentile(Samples, 0.50);
+			const double P95Ms = SamplePercentile(Samples, 0.95);
+			const double P99Ms = SamplePercentile(Samples, 0.99);
+			const double MaxMs = Samples.IsEmpty() ? 0.0 : Samples.Last();
+
+			CSV += FString::Printf(TEXT("%d,%d,%s,%d,%.4f,%.4f,%.4f,%.4f,%.4f\n"),
+				Run.RequestedVehicleCount, Run.MeasuredVehicleCount, *ScopeName, Samples.Num(), MeanMs, P50Ms, P95Ms, P99Ms, MaxMs);
+
+			TSharedRef<FJsonObject> JsonScope = MakeShared<FJsonObject>();
+			JsonScope->SetStringField(TEXT("Scope"), ScopeName);
+			JsonScope->SetNumberField(TEXT("Samples"), Samples.Num());
+			JsonScope->SetNumberField(TEXT("MeanMs"), MeanMs);
+			JsonScope->SetNumberField(TEXT("P50Ms"), P50Ms);
+			JsonScope->SetNumberField(TEXT("P95Ms"), P95Ms);
+			JsonScope->SetNumberField(TEXT("P99Ms"), P99Ms);
+			JsonScope->SetNumberField(TEXT("MaxMs"), MaxMs);
+			JsonScopes.Add(MakeShared<FJsonValueObject>(JsonScope));
+		};
+
+		EmitScope(TEXT("Frame"), Run.FrameMilliseconds);
+		for (int32 PhaseIndex = 0; PhaseIndex < NumProcessingPhases; ++PhaseIndex)
+		{
+			EmitScope(ProcessingPhaseName(PhaseIndex), Run.PhaseMilliseconds[PhaseIndex]);
+		}
+
+		JsonRun->SetArrayField(TEXT("Scopes"), JsonScopes);
+		JsonRuns.Add(MakeShared<FJsonValueObject>(JsonRun));
+	}
+
+	TSharedRef<FJsonObject> JsonRoot = MakeShared<FJsonObject>();
+	JsonRoot->SetStringField(TEXT("Map"), *MapParam);
+	JsonRoot->SetNumberField(TEXT("NumFrames"), NumFrames);
+	JsonRoot->SetNumberField(TEXT("WarmupFrames"), WarmupFrames);
+	JsonRoot->SetNumberField(TEXT("DeltaSeconds"), DeltaSeconds);
+	JsonRoot->SetArrayField(TEXT("Runs"), JsonRuns);
+
+	FString JsonString;
+	const TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&JsonString);
+	FJsonSerializer::Serialize(JsonRoot, JsonWriter);
+
+	bool bSaved = FFileHelper::SaveStringToFile(CSV, *(ReportBasePath + TEXT(".csv")));
+	bSaved &= FFileHelper::SaveStringToFile(JsonString, *(ReportBasePath + TEXT(".json")));
+	if (!bSaved)
+	{
+		UE_LOG(LogMassTrafficBenchmark, Error, TEXT("Unable to write benchmark reports to %s"), *ReportBasePath);
+		return 2;
+	}
+	UE_LOG(LogMassTrafficBenchmark, Display, TEXT("Wrote benchmark reports to %s.csv/.json"), *ReportBasePath);
+
+	// Tear the world down now that the reports are on disk.
+	World->EndPlay(EEndPlayReason::Quit);
+	World->DestroyWorld(false);
+	GEngine->DestroyWorldContext(World);
+	CollectGarbage(RF_NoFlags);
+
+	return 0;
+}
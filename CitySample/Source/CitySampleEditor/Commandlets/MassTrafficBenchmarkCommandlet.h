@@ -0,0 +1,27 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Commandlets/Commandlet.h"
+
+#include "MassTrafficBenchmarkCommandlet.generated.h"
+
+/**
+ * Headless traffic performance harness. Loads a map, spawns configurable traffic vehicle counts
+ * on its zone graph, advances the Mass simulation a fixed number of frames and emits per-phase
+ * timing percentiles as CSV and JSON so builds can be gated on p95 frame cost.
+ */
+UCLASS()
+class CITYSAMPLEEDITOR_API UMassTrafficBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UMassTrafficBenchmarkCommandlet();
+
+	// Begin UCommandlet Interface
+	virtual int32 Main(const FString& FullCommandLine) override;
+	// End UCommandlet Interface
+};
@@ -1,14 +1,54 @@
-﻿// Copyright Epic Games, Inc. All Rights Reserved.
+// Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "NaniteMeshLodGroupUpdateCommandlet.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
 #include "Engine/StaticMesh.h"
 #include "FileHelpers.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogNaniteMeshLodGroupUpdate, Log, All);
 
 static const FName CitySampleNaniteMeshLODGroupName(TEXT("CitySampleNaniteMeshLODGroup"));
 
+/** Number of processed meshes between incremental saves and garbage collections. */
+static constexpr int32 MeshesPerSaveBatch = 300;
+
+static FString GetPackageHashManifestPath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("NaniteMeshLodGroupUpdate") / TEXT("PackageHashes.manifest");
+}
+
+static void LoadPackageHashManifest(TMap<FString, FString>& OutManifest)
+{
+	TArray<FString> Lines;
+	if (FFileHelper::LoadFileToStringArray(Lines, *GetPackageHashManifestPath()))
+	{
+		for (const FString& Line : Lines)
+		{
+			FString PackageName, Hash;
+			if (Line.Split(TEXT(" "), &PackageName, &Hash))
+			{
+				OutManifest.Add(PackageName, Hash);
+			}
+		}
+	}
+}
+
+static void SavePackageHashManifest(const TMap<FString, FString>& Manifest)
+{
+	TArray<FString> Lines;
+	Lines.Reserve(Manifest.Num());
+	for (const TPair<FString, FString>& Pair : Manifest)
+	{
+		Lines.Add(Pair.Key + TEXT(" ") + Pair.Value);
+	}
+	FFileHelper::SaveStringArrayToFile(Lines, *GetPackageHashManifestPath());
+}
+
 int32 UNaniteMeshLodGroupUpdateCommandlet::Main(const FString& FullCommandLine)
 {
 	TArray<FString> Tokens;
@@ -17,6 +57,12 @@ int32 UNaniteMeshLodGroupUpdateCommandlet::Main(const FString& FullCommandLine)
 
 	ParseCommandLine(*FullCommandLine, Tokens, Switches, Params);
 
+	const bool bIncremental = Switches.Contains(TEXT("Incremental"));
+
+	int32 MaxConcurrentLoads = 16;
+	FParse::Value(*FullCommandLine, TEXT("MaxConcurrentLoads="), MaxConcurrentLoads);
+	MaxConcurrentLoads = FMath::Max(1, MaxConcurrentLoads);
+
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
     IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
@@ -25,7 +71,6 @@ int32 UNaniteMeshLodGroupUpdateCommandlet::Main(const FString& FullCommandLine)
 	AssetRegistryModule.Get().SearchAllAssets(true);
 
 	TArray<FAssetData> Assets;
-	TArray<UObject*> ModifiedObjects;
 
 	FARFilter Filter;
 	Filter.bIncludeOnlyOnDiskAssets = true;
@@ -35,32 +80,177 @@ int32 UNaniteMeshLodGroupUpdateCommandlet::Main(const FString& FullCommandLine)
 
 	AssetRegistry.GetAssets(Filter, Assets);
 
-	int32 i = 0;
-	
-	for (FAssetData& Asset : Assets)
+	// Resolve package filenames up front, then hash the package files on disk in parallel. In
+	// incremental mode, packages whose hash matches the manifest from the last run were already
+	// processed and haven't changed since, so they can be skipped without ever being loaded.
+	TMap<FString, FString> Manifest;
+	if (bIncremental)
+	{
+		LoadPackageHashManifest(Manifest);
+	}
+
+	TArray<FString> PackageFilenames;
+	PackageFilenames.SetNum(Assets.Num());
+	for (int32 AssetIndex = 0; AssetIndex < Assets.Num(); ++AssetIndex)
+	{
+		FPackageName::DoesPackageExist(Assets[AssetIndex].PackageName.ToString(), &PackageFilenames[AssetIndex]);
+	}
+
+	TArray<FString> PackageHashes;
+	PackageHashes.SetNum(Assets.Num());
+	ParallelFor(Assets.Num(), [&PackageFilenames, &PackageHashes](const int32 AssetIndex)
+	{
+		if (!PackageFilenames[AssetIndex].IsEmpty())
+		{
+			PackageHashes[AssetIndex] = LexToString(FMD5Hash::HashFile(*PackageFilenames[AssetIndex]));
+		}
+	});
+
+	TArray<int32> PendingIndices;
+	PendingIndices.Reserve(Assets.Num());
+	for (int32 AssetIndex = 0; AssetIndex < Assets.Num(); ++AssetIndex)
+	{
+		const FString PackageName = Assets[AssetIndex].PackageName.ToString();
+		if (bIncremental && !PackageHashes[AssetIndex].IsEmpty() && (Manifest.FindRef(PackageName) == PackageHashes[AssetIndex]))
+		{
+			continue;
+		}
+
+		PendingIndices.Add(AssetIndex);
+	}
+
+	UE_LOG(LogNaniteMeshLodGroupUpdate, Display, TEXT("Processing %d of %d StaticMesh packages (%d unchanged since last run)."),
+		PendingIndices.Num(), Assets.Num(), Assets.Num() - PendingIndices.Num());
+
+	// Producer/consumer pipeline: keep a bounded window of async package loads in flight on the
+	// loading threads, with completion delegates (fired on the main thread while flushing) feeding
+	// a queue of ready assets. Only the LODGroup mutation and the periodic save/GC run on the main
+	// thread, so package deserialization overlaps instead of serializing the whole pass.
+	TArray<int32> ReadyAssetIndices;
+	TArray<int32> FlushOrder;
+	int32 NumInFlight = 0;
+	int32 NumProcessed = 0;
+	int32 NumFailed = 0;
+	int32 NextPendingIndex = 0;
+
+	TArray<int32> ModifiedIndices;
+	int32 NumSinceLastSave = 0;
+
+	auto KickLoads = [&]()
+	{
+		while ((NumInFlight < MaxConcurrentLoads) && (NextPendingIndex < PendingIndices.Num()))
+		{
+			const int32 AssetIndex = PendingIndices[NextPendingIndex++];
+			const int32 RequestId = LoadPackageAsync(Assets[AssetIndex].PackageName.ToString(),
+				FLoadPackageAsyncDelegate::CreateLambda([&ReadyAssetIndices, &NumInFlight, &NumProcessed, &NumFailed, AssetIndex](const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result)
+				{
+					--NumInFlight;
+
+					if (Result == EAsyncLoadingResult::Succeeded)
+					{
+						ReadyAssetIndices.Add(AssetIndex);
+					}
+					else
+					{
+						++NumProcessed;
+						++NumFailed;
+						UE_LOG(LogNaniteMeshLodGroupUpdate, Warning, TEXT("Failed to load package %s"), *PackageName.ToString());
+					}
+				}));
+
+			if (RequestId != INDEX_NONE)
+			{
+				++NumInFlight;
+				FlushOrder.Add(RequestId);
+			}
+			else
+			{
+				++NumProcessed;
+				++NumFailed;
+				UE_LOG(LogNaniteMeshLodGroupUpdate, Warning, TEXT("Failed to request async load of package %s"), *Assets[AssetIndex].PackageName.ToString());
+			}
+		}
+	};
+
+	while (NumProcessed < PendingIndices.Num())
 	{
-		UE_LOG(LogNaniteMeshLodGroupUpdate, Display, TEXT("Checking StaticMesh %s"), *Asset.GetObjectPathString());
-		if (UStaticMesh* Mesh = Cast<UStaticMesh>(Asset.GetAsset()))
+		KickLoads();
+
+		if (ReadyAssetIndices.IsEmpty())
 		{
-			if (Mesh->IsNaniteEnabled())
+			if (FlushOrder.IsEmpty())
 			{
-				UE_LOG(LogNaniteMeshLodGroupUpdate, Display, TEXT("Updating mesh %s to '%s' from '%s'"),
-					*Asset.GetObjectPathString(),
-					*CitySampleNaniteMeshLODGroupName.ToString(),
-					*Mesh->LODGroup.ToString());
-
-				Mesh->Modify();
-				Mesh->LODGroup = CitySampleNaniteMeshLODGroupName;
-				ModifiedObjects.Add(Mesh);
+				break;
 			}
+
+			// Flush the oldest request; the rest of the window keeps loading in parallel behind it
+			const int32 RequestId = FlushOrder[0];
+			FlushOrder.RemoveAt(0);
+			FlushAsyncLoading(RequestId);
 		}
 
-		if ((++i % 300) == 0)
+		while (!ReadyAssetIndices.IsEmpty())
 		{
+			const int32 AssetIndex = ReadyAssetIndices.Pop();
+			FAssetData& Asset = Assets[AssetIndex];
+
+			UE_LOG(LogNaniteMeshLodGroupUpdate, Display, TEXT("Checking StaticMesh %s"), *Asset.GetObjectPathString());
+			if (UStaticMesh* Mesh = Cast<UStaticMesh>(Asset.GetAsset()))
+			{
+				if (Mesh->IsNaniteEnabled() && (Mesh->LODGroup != CitySampleNaniteMeshLODGroupName))
+				{
+					UE_LOG(LogNaniteMeshLodGroupUpdate, Display, TEXT("Updating mesh %s to '%s' from '%s'"),
+						*Asset.GetObjectPathString(),
+						*CitySampleNaniteMeshLODGroupName.ToString(),
+						*Mesh->LODGroup.ToString());
+
+					Mesh->Modify();
+					Mesh->LODGroup = CitySampleNaniteMeshLODGroupName;
+					ModifiedIndices.Add(AssetIndex);
+				}
+			}
+
+			++NumProcessed;
+			++NumSinceLastSave;
+		}
+
+		if (NumSinceLastSave >= MeshesPerSaveBatch)
+		{
+			// Drain the load window before saving and collecting garbage, so neither races in-flight loads
+			FlushAsyncLoading();
 			UEditorLoadingAndSavingUtils::SaveDirtyPackages(/*bSaveMaps=*/false, /*bSaveAssets=*/true);
 			CollectGarbage(RF_NoFlags, true);
+			NumSinceLastSave = 0;
 		}
 	}
-	
+
+	FlushAsyncLoading();
+	UEditorLoadingAndSavingUtils::SaveDirtyPackages(/*bSaveMaps=*/false, /*bSaveAssets=*/true);
+
+	if (bIncremental)
+	{
+		// Saving rewrote the modified packages, so rehash those before recording the manifest
+		ParallelFor(ModifiedIndices.Num(), [&ModifiedIndices, &PackageFilenames, &PackageHashes](const int32 Index)
+		{
+			const int32 AssetIndex = ModifiedIndices[Index];
+			if (!PackageFilenames[AssetIndex].IsEmpty())
+			{
+				PackageHashes[AssetIndex] = LexToString(FMD5Hash::HashFile(*PackageFilenames[AssetIndex]));
+			}
+		});
+
+		for (int32 AssetIndex = 0; AssetIndex < Assets.Num(); ++AssetIndex)
+		{
+			if (!PackageHashes[AssetIndex].IsEmpty())
+			{
+				Manifest.Add(Assets[AssetIndex].PackageName.ToString(), PackageHashes[AssetIndex]);
+			}
+		}
+		SavePackageHashManifest(Manifest);
+	}
+
+	UE_LOG(LogNaniteMeshLodGroupUpdate, Display, TEXT("Done: %d processed, %d modified, %d failed, %d skipped as unchanged."),
+		NumProcessed, ModifiedIndices.Num(), NumFailed, Assets.Num() - PendingIndices.Num());
+
 	return 0;
-}
\ No newline at end of file
+}
@@ -7,15 +7,17 @@
 #include "Engine/Blueprint.h"
 #include "Engine/Selection.h"
 #include "Engine/Engine.h"
+#include "Misc/ScopedSlowTask.h"
 #include "ScopedTransaction.h"
 #include "PackedLevelActor/PackedLevelActor.h"
 #include "CitySample/LevelInstance/CitySampleConvertedISMActor.h"
 
 #define LOCTEXT_NAMESPACE "CitySampleLevelInstanceUtils"
 
-void ConvertPackedToActor(APackedLevelActor* PackedLevelActor)
+// Performs the conversion without opening a transaction or emitting aggregate editor updates;
+// callers wrap this in either the single actor or the batched entry point below
+void ConvertPackedToActorInternal(APackedLevelActor* PackedLevelActor)
 {
-	const FScopedTransaction Transaction(LOCTEXT("ConvertPLIToActor", "Convert Packed Level Instance to ISM Actor"));
 	UWorld* World = PackedLevelActor->GetWorld();
 	ULevel* Level = PackedLevelActor->GetLevel();
 	
@@ -66,6 +68,48 @@ void ConvertPackedToActor(APackedLevelActor* PackedLevelActor)
 	World->EditorDestroyActor(PackedLevelActor, false);
 }
 
+void ConvertPackedToActor(APackedLevelActor* PackedLevelActor)
+{
+	const FScopedTransaction Transaction(LOCTEXT("ConvertPLIToActor", "Convert Packed Level Instance to ISM Actor"));
+	ConvertPackedToActorInternal(PackedLevelActor);
+}
+
+int32 FCitySampleLevelInstanceUtils::ConvertPackedToActors(const TArray<APackedLevelActor*>& PackedLevelActors)
+{
+	if (PackedLevelActors.IsEmpty())
+	{
+		return 0;
+	}
+
+	const FScopedTransaction Transaction(LOCTEXT("ConvertPLIsToActors", "Convert Packed Level Instances to ISM Actors"));
+
+	FScopedSlowTask SlowTask(PackedLevelActors.Num(), LOCTEXT("ConvertingPLIsSlowTask", "Converting Packed Level Instances..."));
+	SlowTask.MakeDialog();
+
+	// Defer the per-actor selection broadcasts that EditorDestroyActor would otherwise emit once
+	// per conversion; a single aggregate update goes out after the whole batch
+	USelection* SelectedActors = GEditor->GetSelectedActors();
+	SelectedActors->BeginBatchSelectOperation();
+
+	int32 ConvertedCount = 0;
+	for (APackedLevelActor* PackedLevelActor : PackedLevelActors)
+	{
+		SlowTask.EnterProgressFrame(1);
+
+		if (PackedLevelActor)
+		{
+			ConvertPackedToActorInternal(PackedLevelActor);
+			++ConvertedCount;
+		}
+	}
+
+	SelectedActors->EndBatchSelectOperation(/*bNotify*/ false);
+	GEditor->NoteSelectionChange();
+	GEditor->RedrawLevelEditingViewports();
+
+	return ConvertedCount;
+}
+
 void FCitySampleLevelInstanceUtils::ExtendContextMenu()
 {
 	if (UToolMenu* Menu = UToolMenus::Get()->ExtendMenu("LevelEditor.ActorContextMenu"))
@@ -73,17 +117,30 @@ void FCitySampleLevelInstanceUtils::ExtendContextMenu()
 		FToolMenuSection& Section = Menu->AddDynamicSection("CitySamplePackedLevelActor", 
 			FNewToolMenuDelegate::CreateLambda([](UToolMenu* ToolMenu)
 			{
-				APackedLevelActor* SelectedActor = GEditor->GetSelectedActorCount() == 1 ? GEditor->GetSelectedActors()->GetTop<APackedLevelActor>() : nullptr;
-				if (SelectedActor)
+				TArray<APackedLevelActor*> SelectedPackedActors;
+				GEditor->GetSelectedActors()->GetSelectedObjects<APackedLevelActor>(SelectedPackedActors);
+				if (SelectedPackedActors.Num() > 0)
 				{
 					const FName SectionName = TEXT("CitySamplePackedLevelActor");
 					FToolMenuInsert InsertPosition("ActorControl", EToolMenuInsertType::After);
 					FToolMenuSection& Section = ToolMenu->AddSection(SectionName, LOCTEXT("CitySamplePackedLevelActor", "CitySample Packed Level Actor"), InsertPosition);
-					
+
 					FUIAction Action;
-					Action.ExecuteAction = FExecuteAction::CreateStatic(&ConvertPackedToActor, SelectedActor);
+					if (SelectedPackedActors.Num() == 1)
+					{
+						Action.ExecuteAction = FExecuteAction::CreateStatic(&ConvertPackedToActor, SelectedPackedActors[0]);
+					}
+					else
+					{
+						Action.ExecuteAction = FExecuteAction::CreateLambda([SelectedPackedActors]()
+						{
+							FCitySampleLevelInstanceUtils::ConvertPackedToActors(SelectedPackedActors);
+						});
+					}
 
-					const FText Label = LOCTEXT("ConvertPLAToActorLabel", "Convert to ISM Actor");
+					const FText Label = SelectedPackedActors.Num() == 1
+						? LOCTEXT("ConvertPLAToActorLabel", "Convert to ISM Actor")
+						: FText::Format(LOCTEXT("ConvertPLAsToActorsLabel", "Convert {0} to ISM Actors"), SelectedPackedActors.Num());
 					const FText ToolTip = LOCTEXT("ConvertPLAToActorToolTip", "Replaces Packed Level Actor with base Actor retaining packed components");
 
 					Section.AddMenuEntry("ConvertPLAToActor", Label, ToolTip, FSlateIcon(), Action);
@@ -3,8 +3,20 @@
 
 #include "CoreMinimal.h"
 
+class APackedLevelActor;
+
 class FCitySampleLevelInstanceUtils
 {
 public:
 	static void ExtendContextMenu();
-};
\ No newline at end of file
+
+	/**
+	 * Converts a batch of Packed Level Actors to ISM Actors inside a single transaction.
+	 * Per-instance selection and change notifications are suspended while the batch runs
+	 * and one aggregate editor update is emitted at the end, so scripted bulk refactors
+	 * don't pay the full notification cost once per instance.
+	 *
+	 * @returns The number of actors that were converted.
+	 */
+	static int32 ConvertPackedToActors(const TArray<APackedLevelActor*>& PackedLevelActors);
+};
@@ -3,6 +3,7 @@
 #include "CitySampleMeshMerging.h"
 
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
 #include "ContentBrowserModule.h"
 #include "AssetToolsModule.h"
 #include "Editor.h"
@@ -16,9 +17,13 @@
 #include "ScopedTransaction.h"
 #include "MeshUtilities.h"
 #include "UObject/UObjectGlobals.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 #include "Misc/ScopedSlowTask.h"
+#include "Misc/SecureHash.h"
 #include "RawMesh.h"
 #include "Components/StaticMeshComponent.h"
+#include "Materials/MaterialInterface.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Components/ShapeComponent.h"
 #include "Rendering/SkeletalMeshLODModel.h"
@@ -110,6 +115,76 @@ namespace HackMeshMerging
 			}
 		}
 	}
+
+	FString GetMergeManifestPath()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("CitySampleMeshMerging") / TEXT("MergeGroupHashes.txt");
+	}
+
+	/** Loads the PackageName -> source hash manifest written by the previous incremental merge run */
+	void LoadMergeManifest(TMap<FString, FString>& OutManifest)
+	{
+		TArray<FString> Lines;
+		if (FFileHelper::LoadFileToStringArray(Lines, *GetMergeManifestPath()))
+		{
+			for (const FString& Line : Lines)
+			{
+				FString PackageName;
+				FString Hash;
+				if (Line.Split(TEXT("|"), &PackageName, &Hash))
+				{
+					OutManifest.Add(PackageName, Hash);
+				}
+			}
+		}
+	}
+
+	void SaveMergeManifest(const TMap<FString, FString>& Manifest)
+	{
+		TArray<FString> Lines;
+		Lines.Reserve(Manifest.Num());
+		for (const TPair<FString, FString>& Pair : Manifest)
+		{
+			Lines.Add(Pair.Key + TEXT("|") + Pair.Value);
+		}
+		Lines.Sort();
+		FFileHelper::SaveStringArrayToFile(Lines, *GetMergeManifestPath());
+	}
+
+	/**
+	 * Collects plain text descriptions of everything that feeds a group's merge result: mesh assets (path plus
+	 * lighting guid, which changes when a mesh is rebuilt), component transforms and material assignments.
+	 * Must run on the game thread; the returned strings can then be hashed from any thread.
+	 */
+	void GatherGroupFingerprintEntries(const TArray<TSharedPtr<FMergeComponentData>>& ComponentsData, TArray<FString>& OutEntries)
+	{
+		for (const TSharedPtr<FMergeComponentData>& ComponentData : ComponentsData)
+		{
+			if (!ComponentData->bShouldIncorporate || !ComponentData->PrimComponent.IsValid())
+			{
+				continue;
+			}
+
+			UPrimitiveComponent* PrimComponent = ComponentData->PrimComponent.Get();
+			if (const UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(PrimComponent))
+			{
+				if (const UStaticMesh* StaticMesh = StaticMeshComponent->GetStaticMesh())
+				{
+					OutEntries.Add(StaticMesh->GetPathName());
+					OutEntries.Add(StaticMesh->GetLightingGuid().ToString());
+				}
+			}
+
+			OutEntries.Add(PrimComponent->GetComponentTransform().ToString());
+
+			const int32 NumMaterials = PrimComponent->GetNumMaterials();
+			for (int32 MaterialIndex = 0; MaterialIndex < NumMaterials; ++MaterialIndex)
+			{
+				const UMaterialInterface* Material = PrimComponent->GetMaterial(MaterialIndex);
+				OutEntries.Add(Material ? Material->GetPathName() : TEXT("None"));
+			}
+		}
+	}
 }
 
 USkeletalMesh* UCitySampleMeshMergingBlueprintLibrary::MergeSkeletalMeshes(TArray<USkeletalMesh*> SkeletalMeshes, const FString PackageName, USkeleton* Skeleton)
@@ -259,7 +334,177 @@ bool UCitySampleMeshMergingBlueprintLibrary::MergeActors(const FString PackageNa
 	return true;
 }
 
+int32 UCitySampleMeshMergingBlueprintLibrary::MergeActorGroups(const TArray<FCitySampleMergeActorGroup>& Groups, const FMeshMergingSettings& MergeSettings, const bool bIncrementalMerge /*= true*/, const bool bReplaceSourceActors /*= false*/, const bool bAllowShapeComponents /*= true*/)
+{
+	const IMeshMergeUtilities& MeshUtilities = FModuleManager::Get().LoadModuleChecked<IMeshMergeModule>("MeshMergeUtilities").GetUtilities();
+
+	/** Per group state carried from the game thread gather, through worker thread hashing, to the batched commit */
+	struct FGroupWorkItem
+	{
+		FString PackageName;
+		TArray<AActor*> Actors;
+		TArray<ULevel*> UniqueLevels;
+		TArray<UPrimitiveComponent*> ComponentsToMerge;
+		TArray<FString> FingerprintEntries;
+		FString SourceHash;
+		FVector MergedActorLocation = FVector::ZeroVector;
+		TArray<UObject*> AssetsToSync;
+	};
+
+	// Gather component data and plain text source fingerprints on the game thread
+	TArray<FGroupWorkItem> WorkItems;
+	WorkItems.Reserve(Groups.Num());
+	for (const FCitySampleMergeActorGroup& Group : Groups)
+	{
+		TArray<AActor*> GroupActors;
+		GroupActors.Reserve(Group.ActorsToMerge.Num());
+		for (const TObjectPtr<AActor>& Actor : Group.ActorsToMerge)
+		{
+			GroupActors.Add(Actor.Get());
+		}
+
+		FGroupWorkItem& WorkItem = WorkItems.Emplace_GetRef();
+		WorkItem.PackageName = Group.PackageName;
+
+		TArray<TSharedPtr<HackMeshMerging::FMergeComponentData>> SelectedComponents;
+		BuildMergeDataFromActorsArray(GroupActors, SelectedComponents, WorkItem.Actors, bReplaceSourceActors ? &WorkItem.UniqueLevels : nullptr, bAllowShapeComponents);
+
+		// This restriction is only for replacement of selected actors with merged mesh actor
+		if (WorkItem.UniqueLevels.Num() > 1 && bReplaceSourceActors)
+		{
+			UE_LOG(LogCitySampleMeshMerging, Error, TEXT("Unable to merge group %s: The selected actors should be in the same level"), *WorkItem.PackageName);
+			WorkItem.ComponentsToMerge.Empty();
+			continue;
+		}
+
+		for (const TSharedPtr<HackMeshMerging::FMergeComponentData>& SelectedComponent : SelectedComponents)
+		{
+			if (SelectedComponent->bShouldIncorporate && SelectedComponent->PrimComponent.IsValid())
+			{
+				WorkItem.ComponentsToMerge.Add(SelectedComponent->PrimComponent.Get());
+			}
+		}
+
+		HackMeshMerging::GatherGroupFingerprintEntries(SelectedComponents, WorkItem.FingerprintEntries);
+	}
+
+	// Hash the fingerprints on worker threads; only plain strings are touched here
+	ParallelFor(WorkItems.Num(), [&WorkItems](int32 Index)
+	{
+		FGroupWorkItem& WorkItem = WorkItems[Index];
+		WorkItem.SourceHash = FMD5::HashAnsiString(*FString::Join(WorkItem.FingerprintEntries, TEXT("\n")));
+	});
+
+	TMap<FString, FString> Manifest;
+	if (bIncrementalMerge)
+	{
+		HackMeshMerging::LoadMergeManifest(Manifest);
+	}
+
+	// Merge the dirty groups. The engine merge utilities create assets and bake materials, so this part
+	// stays on the game thread
+	int32 MergedGroupCount = 0;
+	{
+		FScopedSlowTask SlowTask(WorkItems.Num(), LOCTEXT("MergingActorGroupsSlowTask", "Merging actor groups..."));
+		SlowTask.MakeDialog();
+
+		for (FGroupWorkItem& WorkItem : WorkItems)
+		{
+			SlowTask.EnterProgressFrame(1);
+
+			if (WorkItem.ComponentsToMerge.IsEmpty())
+			{
+				continue;
+			}
+
+			// Skip groups whose sources are unchanged since the last run, as long as the previous result still exists
+			if (bIncrementalMerge && Manifest.FindRef(WorkItem.PackageName) == WorkItem.SourceHash && FindObject<UObject>(nullptr, *WorkItem.PackageName))
+			{
+				UE_LOG(LogCitySampleMeshMerging, Verbose, TEXT("Skipping unchanged merge group %s"), *WorkItem.PackageName);
+				continue;
+			}
+
+			UWorld* World = WorkItem.ComponentsToMerge[0]->GetWorld();
+			checkf(World != nullptr, TEXT("Invalid World retrieved from Mesh components"));
+			const float ScreenAreaSize = TNumericLimits<float>::Max();
+
+			// If the merge destination package already exists, it is possible that the mesh is already used in a scene somewhere, or its materials or even just its textures.
+			// Static primitives uniform buffers could become invalid after the operation completes and lead to memory corruption. To avoid it, we force a global reregister.
+			if (FindObject<UObject>(nullptr, *WorkItem.PackageName))
+			{
+				FGlobalComponentReregisterContext GlobalReregister;
+				MeshUtilities.MergeComponentsToStaticMesh(WorkItem.ComponentsToMerge, World, MergeSettings, nullptr, nullptr, WorkItem.PackageName, WorkItem.AssetsToSync, WorkItem.MergedActorLocation, ScreenAreaSize, true);
+			}
+			else
+			{
+				MeshUtilities.MergeComponentsToStaticMesh(WorkItem.ComponentsToMerge, World, MergeSettings, nullptr, nullptr, WorkItem.PackageName, WorkItem.AssetsToSync, WorkItem.MergedActorLocation, ScreenAreaSize, true);
+			}
+
+			Manifest.Add(WorkItem.PackageName, WorkItem.SourceHash);
+			++MergedGroupCount;
+		}
+	}
+
+	// Commit the editor side effects once for the whole batch instead of per group
+	TArray<UObject*> AllAssetsToSync;
+	for (const FGroupWorkItem& WorkItem : WorkItems)
+	{
+		AllAssetsToSync.Append(WorkItem.AssetsToSync);
+	}
+
+	if (AllAssetsToSync.Num())
+	{
+		FAssetRegistryModule& AssetRegistry = FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+		for (UObject* Asset : AllAssetsToSync)
+		{
+			AssetRegistry.AssetCreated(Asset);
+			GEditor->BroadcastObjectReimported(Asset);
+		}
+
+		//Also notify the content browser that the new assets exists
+		FContentBrowserModule& ContentBrowserModule = FModuleManager::Get().LoadModuleChecked<FContentBrowserModule>("ContentBrowser");
+		ContentBrowserModule.Get().SyncBrowserToAssets(AllAssetsToSync, true);
+
+		// Place new meshes in the world
+		if (bReplaceSourceActors)
+		{
+			const FScopedTransaction Transaction(LOCTEXT("PlaceMergedActors", "Place Merged Actors"));
+			for (FGroupWorkItem& WorkItem : WorkItems)
+			{
+				UStaticMesh* MergedMesh = nullptr;
+				if (!WorkItem.AssetsToSync.FindItemByClass(&MergedMesh) || WorkItem.UniqueLevels.IsEmpty())
+				{
+					continue;
+				}
+
+				WorkItem.UniqueLevels[0]->Modify();
+
+				UWorld* World = WorkItem.UniqueLevels[0]->OwningWorld;
+				FActorSpawnParameters Params;
+				Params.OverrideLevel = WorkItem.UniqueLevels[0];
+				FRotator MergedActorRotation(ForceInit);
 
+				AStaticMeshActor* MergedActor = World->SpawnActor<AStaticMeshActor>(WorkItem.MergedActorLocation, MergedActorRotation, Params);
+				MergedActor->GetStaticMeshComponent()->SetStaticMesh(MergedMesh);
+				MergedActor->SetActorLabel(MergedMesh->GetName());
+				World->UpdateCullDistanceVolumes(MergedActor, MergedActor->GetStaticMeshComponent());
+				// Remove source actors
+				for (AActor* Actor : WorkItem.Actors)
+				{
+					Actor->Destroy();
+				}
+			}
+			GEditor->SelectNone(true, true);
+		}
+	}
+
+	if (bIncrementalMerge)
+	{
+		HackMeshMerging::SaveMergeManifest(Manifest);
+	}
+
+	return MergedGroupCount;
+}
 
 
 bool UCitySampleMeshMergingBlueprintLibrary::ApproximateActors(const FString PackageName, const TArray<AActor*> ActorsToMerge, const FMeshApproximationSettings& UseSettings, const bool bReplaceSourceActors /*= false*/)
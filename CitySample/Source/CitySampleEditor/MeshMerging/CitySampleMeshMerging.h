@@ -12,6 +12,21 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(LogCitySampleMeshMerging, Log, All);
 
+/** One group of actors to merge into a single static mesh, used by MergeActorGroups */
+USTRUCT(BlueprintType)
+struct FCitySampleMergeActorGroup
+{
+	GENERATED_BODY()
+
+	/** The path to put the merged mesh for this group in */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CitySample | MeshMerging")
+	FString PackageName;
+
+	/** Actors merged into this group's mesh */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CitySample | MeshMerging")
+	TArray<TObjectPtr<AActor>> ActorsToMerge;
+};
+
 // Hack class that mimics the behavior of the Merge Actors editor tool for use with Python
 // Hopefully this can be removed when the actual merging functions are exposed directly
 UCLASS()
@@ -38,6 +53,27 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "CitySample | MeshMerging")
 	static bool MergeActors(const FString PackageName, const TArray<AActor*> ActorsToMerge, const FMeshMergingSettings& MergeSettings, const bool bReplaceSourceActors = false, const bool bAllowShapeComponents = true);
 
+	/**
+	 * Merge several groups of actors in one pass. Source fingerprints for all groups are hashed on worker
+	 * threads up front, and editor side effects (asset registry notifications, content browser sync, source
+	 * actor replacement) are batched once at the end instead of per group.
+	 *
+	 * In incremental mode a group is skipped when its source hash (mesh assets, transforms and materials)
+	 * matches the one recorded by the previous run in Saved/CitySampleMeshMerging, so a repeat pass only
+	 * rebuilds groups whose sources actually changed. Delete the manifest to force a full rebuild, e.g.
+	 * after changing the merge settings.
+	 *
+	 * @param	Groups					The merge groups, each with its own destination package
+	 * @param	MergeSettings			A structure containing all the settings required for the merge. The options are the same as what you'd see in the Merge Actors window
+	 * @param	bIncrementalMerge		(Optional) Whether to skip groups whose source hashes are unchanged since the last run. Defaults to True
+	 * @param	bReplaceSourceActors	(Optional) Whether the given actors should be replaced by the merged actors. Defaults to False
+	 * @param	bAllowShapeComponents	(Optional) Whether to include Shape Components when merging. Defaults to True
+	 *
+	 * @returns	The number of groups that were actually merged; incremental skips are not counted.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "CitySample | MeshMerging")
+	static int32 MergeActorGroups(const TArray<FCitySampleMergeActorGroup>& Groups, const FMeshMergingSettings& MergeSettings, const bool bIncrementalMerge = true, const bool bReplaceSourceActors = false, const bool bAllowShapeComponents = true);
+
 
 	/**
 	 * Approximate actors with a single static mesh actor
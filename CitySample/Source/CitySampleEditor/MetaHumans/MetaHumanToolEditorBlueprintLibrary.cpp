@@ -5,9 +5,54 @@
 #include "AnimGraphNode_PoseDriver.h"
 #include "AnimNodes/AnimNode_PoseDriver.h"
 #include "AnimationGraph.h"
+#include "Animation/AnimData/IAnimationDataModel.h"
+#include "Async/ParallelFor.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Misc/SecureHash.h"
 
 #include "EdGraph/EdGraph.h"
 
+namespace MetaHumanToolBatch
+{
+	static FString GetPoseUpdateManifestPath()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("CitySampleMetaHumanTool") / TEXT("PoseUpdateHashes.txt");
+	}
+
+	static TMap<FString, FString> LoadPoseUpdateManifest()
+	{
+		TMap<FString, FString> Manifest;
+		TArray<FString> Lines;
+		if (FFileHelper::LoadFileToStringArray(Lines, *GetPoseUpdateManifestPath()))
+		{
+			for (const FString& Line : Lines)
+			{
+				FString PoseAssetPath;
+				FString Hash;
+				if (Line.Split(TEXT("|"), &PoseAssetPath, &Hash))
+				{
+					Manifest.Add(PoseAssetPath, Hash);
+				}
+			}
+		}
+		return Manifest;
+	}
+
+	static void SavePoseUpdateManifest(const TMap<FString, FString>& Manifest)
+	{
+		TArray<FString> Lines;
+		Lines.Reserve(Manifest.Num());
+		for (const TPair<FString, FString>& Entry : Manifest)
+		{
+			Lines.Add(FString::Printf(TEXT("%s|%s"), *Entry.Key, *Entry.Value));
+		}
+		Lines.Sort();
+		FFileHelper::SaveStringArrayToFile(Lines, *GetPoseUpdateManifestPath());
+	}
+}
+
 void UMetaHumanToolEditorFunctionLibrary::RetrievePoseDriverGraphNodes(UAnimBlueprint* AnimBlueprint, TArray<UAnimGraphNode_PoseDriver*>& OutNodes)
 {
 	if (AnimBlueprint)
@@ -95,6 +140,81 @@ void UMetaHumanToolEditorFunctionLibrary::UpdateFromAnimSequence(UPoseAsset* Pos
 	PoseAsset->UpdatePoseFromAnimation(AnimSequence);
 }
 
+int32 UMetaHumanToolEditorFunctionLibrary::UpdatePosesFromAnimSequences(const TArray<UPoseAsset*>& PoseAssets, const TArray<UAnimSequence*>& AnimSequences, const bool bSkipUnchanged)
+{
+	if (PoseAssets.Num() != AnimSequences.Num())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to batch update pose assets because PoseAssets (%d) and AnimSequences (%d) have mismatched lengths"), PoseAssets.Num(), AnimSequences.Num());
+		return 0;
+	}
+
+	const int32 NumPairs = PoseAssets.Num();
+
+	// Gather fingerprint sources on the game thread; the strings are then safe to hash on workers
+	TArray<FString> Fingerprints;
+	Fingerprints.SetNum(NumPairs);
+	for (int32 PairIndex = 0; PairIndex < NumPairs; ++PairIndex)
+	{
+		if (PoseAssets[PairIndex] && AnimSequences[PairIndex])
+		{
+			const IAnimationDataModel* DataModel = AnimSequences[PairIndex]->GetDataModel();
+			Fingerprints[PairIndex] = FString::Printf(TEXT("%s\n%s\n%s"),
+				*PoseAssets[PairIndex]->GetPathName(),
+				*AnimSequences[PairIndex]->GetPathName(),
+				DataModel ? *DataModel->GenerateGuid().ToString() : TEXT(""));
+		}
+	}
+
+	TArray<FString> SourceHashes;
+	SourceHashes.SetNum(NumPairs);
+	ParallelFor(NumPairs, [&Fingerprints, &SourceHashes](int32 PairIndex)
+	{
+		if (!Fingerprints[PairIndex].IsEmpty())
+		{
+			SourceHashes[PairIndex] = FMD5::HashAnsiString(*Fingerprints[PairIndex]);
+		}
+	});
+
+	TMap<FString, FString> Manifest = MetaHumanToolBatch::LoadPoseUpdateManifest();
+
+	FScopedSlowTask SlowTask(NumPairs, NSLOCTEXT("CitySampleEditor", "UpdatePosesFromAnimSequences", "Updating Pose Assets"));
+	SlowTask.MakeDialog();
+
+	int32 UpdatedCount = 0;
+	for (int32 PairIndex = 0; PairIndex < NumPairs; ++PairIndex)
+	{
+		SlowTask.EnterProgressFrame(1);
+
+		UPoseAsset* PoseAsset = PoseAssets[PairIndex];
+		UAnimSequence* AnimSequence = AnimSequences[PairIndex];
+		if (!PoseAsset || !AnimSequence)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Skipping batch pose update pair %d because the PoseAsset or AnimSequence is invalid"), PairIndex);
+			continue;
+		}
+
+		const FString PoseAssetPath = PoseAsset->GetPathName();
+		if (bSkipUnchanged)
+		{
+			if (const FString* ExistingHash = Manifest.Find(PoseAssetPath))
+			{
+				if (*ExistingHash == SourceHashes[PairIndex])
+				{
+					continue;
+				}
+			}
+		}
+
+		PoseAsset->UpdatePoseFromAnimation(AnimSequence);
+		Manifest.Add(PoseAssetPath, SourceHashes[PairIndex]);
+		++UpdatedCount;
+	}
+
+	MetaHumanToolBatch::SavePoseUpdateManifest(Manifest);
+
+	return UpdatedCount;
+}
+
 //const TArray<FName> UMetaHumanToolEditorFunctionLibrary::GetPoseNames(UPoseAsset* PoseAsset)
 //{
 //	TArray<FName> PoseNames;
@@ -42,6 +42,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "MetaHumanCreator", meta = (ScriptMethod))
 	static void UpdateFromAnimSequence(UPoseAsset* PoseAsset, UAnimSequence* AnimSequence);
 
+	/**
+	 * Batch variant of UpdateFromAnimSequence for onboarding many characters at once. Pairs
+	 * PoseAssets and AnimSequences by index. Source fingerprints are hashed on worker threads and
+	 * compared against the manifest in Saved/CitySampleMetaHumanTool so pairs whose animation data
+	 * has not changed since the last run are skipped; delete the manifest to force a full rebuild.
+	 * The pose regeneration itself mutates assets and stays on the game thread, under a single
+	 * progress dialog. Returns the number of pose assets actually updated.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MetaHumanCreator", meta = (ScriptMethod))
+	static int32 UpdatePosesFromAnimSequences(const TArray<UPoseAsset*>& PoseAssets, const TArray<UAnimSequence*>& AnimSequences, const bool bSkipUnchanged = true);
+
 	// UFUNCTION(BlueprintPure, Category = "MetaHumanCreator", meta = (ScriptMethod))
 	// static const TArray<FName> GetPoseNames(UPoseAsset* PoseAsset);
 
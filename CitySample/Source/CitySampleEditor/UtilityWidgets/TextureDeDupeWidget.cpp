@@ -135,4 +135,169 @@ void UTextureDeDupeWidget::FindDuplicateCRCTextures(bool bMustBeInCook)
 			UE_LOG(LogTextureDeDupe, Log, TEXT("\t%s"), *Duplicates[i].PackageName.ToString());
 		}
 	}
+}
+
+void UTextureDeDupeWidget::StartIncrementalDuplicateCRCScan(bool bMustBeInCook, int32 TexturesPerTick)
+{
+	CancelDuplicateCRCScan();
+
+	const FString CookedFileListCollectionName = TEXT("Audit_InCook");
+	TArray<FSoftObjectPath> CookedObjects;
+	const TSharedRef<ICollectionContainer>& CollectionContainer = FCollectionManagerModule::GetModule().Get().GetProjectCollectionContainer();
+	if (CollectionContainer->CollectionExists(*CookedFileListCollectionName, ECollectionShareType::CST_All))
+	{
+		CollectionContainer->GetAssetsInCollection(*CookedFileListCollectionName, ECollectionShareType::CST_All, CookedObjects);
+	}
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UTexture2D::StaticClass()->GetClassPathName());
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+
+	TArray<FAssetData> TextureAssetData;
+	AssetRegistryModule.Get().GetAssets(Filter, TextureAssetData);
+
+	// These packages crash the editor if you try to open them
+	TArray<FName> DoNotOpenAssets;
+	DoNotOpenAssets.Add(TEXT("/Game/Vehicle/vehCar_vehicle03/Texture/Prototype/Weta/maskGrime/T_vehCar_vehicle03_Grime"));
+
+	PendingScanAssets.Reset();
+	PendingScanAssets.Reserve(TextureAssetData.Num());
+	for (int i = 0; i < TextureAssetData.Num(); i++)
+	{
+		if (bMustBeInCook && CookedObjects.Num() > 0 && !CookedObjects.Contains(TextureAssetData[i].GetSoftObjectPath()))
+		{
+			continue;
+		}
+
+		if (DoNotOpenAssets.Contains(TextureAssetData[i].PackageName))
+		{
+			continue;
+		}
+
+		PendingScanAssets.Add(TextureAssetData[i]);
+	}
+
+	NextScanIndex = 0;
+	ScanTexturesPerTick = FMath::Max(1, TexturesPerTick);
+	ScanCRCToAssetData.Reset();
+	DuplicateGroups.Reset();
+
+	if (PendingScanAssets.Num() == 0)
+	{
+		FinishScan();
+		return;
+	}
+
+	ScanTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UTextureDeDupeWidget::TickScan));
+}
+
+void UTextureDeDupeWidget::CancelDuplicateCRCScan()
+{
+	if (ScanTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ScanTickerHandle);
+		ScanTickerHandle.Reset();
+	}
+
+	PendingScanAssets.Reset();
+	ScanCRCToAssetData.Reset();
+	NextScanIndex = 0;
+}
+
+bool UTextureDeDupeWidget::IsScanInProgress() const
+{
+	return ScanTickerHandle.IsValid();
+}
+
+int32 UTextureDeDupeWidget::GetNumDuplicateGroups() const
+{
+	return DuplicateGroups.Num();
+}
+
+TArray<FString> UTextureDeDupeWidget::GetDuplicateGroup(int32 GroupIndex) const
+{
+	TArray<FString> PackageNames;
+	if (DuplicateGroups.IsValidIndex(GroupIndex))
+	{
+		for (const FAssetData& AssetData : DuplicateGroups[GroupIndex])
+		{
+			PackageNames.Add(AssetData.PackageName.ToString());
+		}
+	}
+	return PackageNames;
+}
+
+void UTextureDeDupeWidget::BeginDestroy()
+{
+	if (ScanTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ScanTickerHandle);
+		ScanTickerHandle.Reset();
+	}
+
+	Super::BeginDestroy();
+}
+
+bool UTextureDeDupeWidget::TickScan(float DeltaTime)
+{
+	const int32 EndIndex = FMath::Min(NextScanIndex + ScanTexturesPerTick, PendingScanAssets.Num());
+	for (; NextScanIndex < EndIndex; NextScanIndex++)
+	{
+		const FAssetData& AssetData = PendingScanAssets[NextScanIndex];
+
+		if (const uint32* CachedCRC = CRCCache.Find(AssetData.PackageName))
+		{
+			ScanCRCToAssetData.FindOrAdd(*CachedCRC).Add(AssetData);
+			continue;
+		}
+
+		if (UTexture2D* Texture = Cast<UTexture2D>(AssetData.GetAsset()))
+		{
+			uint32 CRC;
+			if (Texture->GetSourceArtCRC(CRC))
+			{
+				CRCCache.Add(AssetData.PackageName, CRC);
+				ScanCRCToAssetData.FindOrAdd(CRC).Add(AssetData);
+			}
+		}
+	}
+
+	OnScanProgress.Broadcast(NextScanIndex, PendingScanAssets.Num());
+
+	if (NextScanIndex >= PendingScanAssets.Num())
+	{
+		FinishScan();
+		return false;
+	}
+
+	return true;
+}
+
+void UTextureDeDupeWidget::FinishScan()
+{
+	ScanTickerHandle.Reset();
+	PendingScanAssets.Reset();
+	NextScanIndex = 0;
+
+	DuplicateGroups.Reset();
+	for (TMap<uint32, TArray<FAssetData>>::TIterator DupIt(ScanCRCToAssetData); DupIt; ++DupIt)
+	{
+		if (DupIt.Value().Num() > 1)
+		{
+			DuplicateGroups.Add(MoveTemp(DupIt.Value()));
+		}
+	}
+	ScanCRCToAssetData.Reset();
+
+	for (int GroupIndex = 0; GroupIndex < DuplicateGroups.Num(); GroupIndex++)
+	{
+		const TArray<FAssetData>& Duplicates = DuplicateGroups[GroupIndex];
+		UE_LOG(LogTextureDeDupe, Log, TEXT("Duplicate group %d"), GroupIndex);
+		for (int i = 0; i < Duplicates.Num(); i++)
+		{
+			UE_LOG(LogTextureDeDupe, Log, TEXT("\t%s"), *Duplicates[i].PackageName.ToString());
+		}
+	}
+
+	OnScanComplete.Broadcast(DuplicateGroups.Num());
 }
\ No newline at end of file
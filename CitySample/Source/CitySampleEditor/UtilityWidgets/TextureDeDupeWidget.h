@@ -1,12 +1,17 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
-#pragma once 
+#pragma once
 
 #include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "Containers/Ticker.h"
 #include "Editor/Blutility/Classes/EditorUtilityWidget.h"
 
 #include "TextureDeDupeWidget.generated.h"
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTextureScanProgress, int32, TexturesProcessed, int32, TexturesTotal);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTextureScanComplete, int32, NumDuplicateGroups);
+
 UCLASS(BlueprintType)
 class UTextureDeDupeWidget : public UEditorUtilityWidget
 {
@@ -17,4 +22,47 @@ class UTextureDeDupeWidget : public UEditorUtilityWidget
 
 	UFUNCTION(BlueprintCallable)
 	void FindDuplicateCRCTextures(bool bMustBeInCook = true);
-};
\ No newline at end of file
+
+	/**
+	 * Incremental version of FindDuplicateCRCTextures. Returns immediately; a fixed number of
+	 * textures is CRC'd each editor tick so the widget stays responsive, with progress and
+	 * completion surfaced through OnScanProgress/OnScanComplete. CRCs are cached per package for
+	 * the lifetime of the widget, so rescans only pay for textures not seen before.
+	 */
+	UFUNCTION(BlueprintCallable)
+	void StartIncrementalDuplicateCRCScan(bool bMustBeInCook = true, int32 TexturesPerTick = 8);
+
+	UFUNCTION(BlueprintCallable)
+	void CancelDuplicateCRCScan();
+
+	UFUNCTION(BlueprintPure)
+	bool IsScanInProgress() const;
+
+	/** Number of duplicate groups found by the last completed incremental scan */
+	UFUNCTION(BlueprintPure)
+	int32 GetNumDuplicateGroups() const;
+
+	/** Package names in one duplicate group; intended for list views materializing rows on demand */
+	UFUNCTION(BlueprintCallable)
+	TArray<FString> GetDuplicateGroup(int32 GroupIndex) const;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnTextureScanProgress OnScanProgress;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnTextureScanComplete OnScanComplete;
+
+	virtual void BeginDestroy() override;
+
+private:
+	bool TickScan(float DeltaTime);
+	void FinishScan();
+
+	FTSTicker::FDelegateHandle ScanTickerHandle;
+	TArray<FAssetData> PendingScanAssets;
+	int32 NextScanIndex = 0;
+	int32 ScanTexturesPerTick = 8;
+	TMap<uint32, TArray<FAssetData>> ScanCRCToAssetData;
+	TArray<TArray<FAssetData>> DuplicateGroups;
+	TMap<FName, uint32> CRCCache;
+};
@@ -0,0 +1,101 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CitySampleWorldPartitionBulkProcessor.h"
+
+#include "Engine/World.h"
+#include "Misc/ScopedSlowTask.h"
+#include "WorldPartition/WorldPartition.h"
+#include "WorldPartition/WorldPartitionActorDescInstance.h"
+#include "WorldPartition/WorldPartitionHandle.h"
+#include "WorldPartition/WorldPartitionHelpers.h"
+
+#define LOCTEXT_NAMESPACE "CitySampleWorldPartitionBulkProcessor"
+
+int32 FCitySampleWorldPartitionBulkProcessor::ProcessAllCells(UWorld* World, TFunctionRef<void(AActor*)> ProcessActor, const FCitySampleBulkCellProcessingParams& Params)
+{
+	UWorldPartition* WorldPartition = World ? World->GetWorldPartition() : nullptr;
+	if (!WorldPartition)
+	{
+		return 0;
+	}
+
+	// Bucket actor descs into grid cells so actors with spatial locality load and unload together
+	TMap<FIntPoint, TArray<FGuid>> Cells;
+	FWorldPartitionHelpers::ForEachActorDescInstance(WorldPartition, [&Cells, &Params](const FWorldPartitionActorDescInstance* ActorDescInstance)
+	{
+		const FVector Center = ActorDescInstance->GetBounds().GetCenter();
+		const FIntPoint CellKey(FMath::FloorToInt(Center.X / Params.CellSize), FMath::FloorToInt(Center.Y / Params.CellSize));
+		Cells.FindOrAdd(CellKey).Add(ActorDescInstance->GetGuid());
+		return true;
+	});
+
+	// Sweep the grid in a deterministic row-major order so the loaded window walks the city coherently
+	TArray<FIntPoint> CellKeys;
+	Cells.GenerateKeyArray(CellKeys);
+	CellKeys.Sort([](const FIntPoint& A, const FIntPoint& B)
+	{
+		return A.Y != B.Y ? A.Y < B.Y : A.X < B.X;
+	});
+
+	FScopedSlowTask SlowTask(CellKeys.Num(), LOCTEXT("ProcessingCellsSlowTask", "Processing world partition cells..."));
+	SlowTask.MakeDialog();
+
+	const int32 LoadWindow = FMath::Max(1, Params.MaxConcurrentLoadedCells);
+
+	// Pipelined load -> process -> unload: references for upcoming cells are taken before the current
+	// cell is visited and released as soon as it has been processed, bounding resident cell count
+	TArray<TArray<FWorldPartitionReference>> LoadedCells;
+	LoadedCells.SetNum(CellKeys.Num());
+
+	int32 NextCellToLoad = 0;
+	int32 ProcessedActorCount = 0;
+	int32 CellsSinceGarbageCollection = 0;
+
+	for (int32 CellIndex = 0; CellIndex < CellKeys.Num(); ++CellIndex)
+	{
+		SlowTask.EnterProgressFrame(1);
+
+		// Top up the load window ahead of the cell being processed
+		while (NextCellToLoad < CellKeys.Num() && NextCellToLoad - CellIndex < LoadWindow)
+		{
+			TArray<FWorldPartitionReference>& CellReferences = LoadedCells[NextCellToLoad];
+			const TArray<FGuid>& CellActorGuids = Cells.FindChecked(CellKeys[NextCellToLoad]);
+			CellReferences.Reserve(CellActorGuids.Num());
+			for (const FGuid& ActorGuid : CellActorGuids)
+			{
+				FWorldPartitionReference ActorRef(WorldPartition, ActorGuid);
+				if (ActorRef.IsValid())
+				{
+					CellReferences.Add(MoveTemp(ActorRef));
+				}
+			}
+			++NextCellToLoad;
+		}
+
+		for (const FWorldPartitionReference& ActorRef : LoadedCells[CellIndex])
+		{
+			if (AActor* Actor = ActorRef.GetActor())
+			{
+				ProcessActor(Actor);
+				++ProcessedActorCount;
+			}
+		}
+
+		// Drop this cell's references; actors still referenced by an upcoming cell stay loaded
+		LoadedCells[CellIndex].Empty();
+
+		// Collect garbage on a cadence, or immediately when the memory cap is exceeded
+		++CellsSinceGarbageCollection;
+		if (FWorldPartitionHelpers::HasExceededMaxMemory() || CellsSinceGarbageCollection >= Params.CellsPerGarbageCollection)
+		{
+			FWorldPartitionHelpers::DoCollectGarbage();
+			CellsSinceGarbageCollection = 0;
+		}
+	}
+
+	FWorldPartitionHelpers::DoCollectGarbage();
+
+	return ProcessedActorCount;
+}
+
+#undef LOCTEXT_NAMESPACE
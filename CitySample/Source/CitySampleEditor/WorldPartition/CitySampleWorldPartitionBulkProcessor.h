@@ -0,0 +1,45 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class UWorld;
+
+/** Tuning knobs for FCitySampleWorldPartitionBulkProcessor */
+struct FCitySampleBulkCellProcessingParams
+{
+	/** Side length of the processing grid cells, in centimeters */
+	double CellSize = 25600.0;
+
+	/** Number of cells kept loaded at once; the cells ahead of the one being processed act as a prefetch window */
+	int32 MaxConcurrentLoadedCells = 4;
+
+	/** Garbage collect after this many processed cells even if the memory cap hasn't been hit */
+	int32 CellsPerGarbageCollection = 8;
+};
+
+/**
+ * Runs a content-wide pass over every actor of a world partition world without loading the whole city at once.
+ *
+ * Actor descs are bucketed into grid cells and processed in a coherent sweep order with a pipelined
+ * load -> process -> unload flow: references for the next cells are taken before the current cell is
+ * processed, and dropped a bounded distance behind it, so at most MaxConcurrentLoadedCells cells are
+ * resident. Garbage is collected on a cell cadence and whenever the world partition memory cap is
+ * exceeded, keeping long passes from accumulating the entire map in memory.
+ */
+class CITYSAMPLEEDITOR_API FCitySampleWorldPartitionBulkProcessor
+{
+public:
+	/**
+	 * Loads and visits every actor in the world's partition, cell by cell.
+	 *
+	 * @param	World			World partition world to sweep
+	 * @param	ProcessActor	Called on the game thread for each loaded actor
+	 * @param	Params			(Optional) Cell size, loaded cell bound and garbage collection cadence
+	 *
+	 * @returns	The number of actors that were processed.
+	 */
+	static int32 ProcessAllCells(UWorld* World, TFunctionRef<void(AActor*)> ProcessActor, const FCitySampleBulkCellProcessingParams& Params = FCitySampleBulkCellProcessingParams());
+};